@@ -768,6 +768,41 @@ int UserOutput::open(UserData* udata)
       eoutstream << setprecision(numeric_limits<sunrealtype>::digits10);
     }
   }
+  else if (output == 3)
+  {
+    // Open binary time series files for solution and error, see
+    // scripts/sundialsdev/timeseries.py for reading the files
+    stringstream fname;
+    fname << "diffusion_2d_solution." << setfill('0') << setw(5)
+          << udata->myid_c << ".bin";
+    int flag = SUNTimeSeries_Create(fname.str().c_str(), &useries);
+    if (check_flag(&flag, "SUNTimeSeries_Create", 1)) { return -1; }
+
+    // Write in the background if SUNDIALS was built with async output
+    flag = SUNTimeSeries_SetAsync(useries, 2);
+    if (flag != SUN_ERR_NOT_IMPLEMENTED &&
+        check_flag(&flag, "SUNTimeSeries_SetAsync", 1))
+    {
+      return -1;
+    }
+
+    if (error)
+    {
+      fname.str("");
+      fname.clear();
+      fname << "diffusion_2d_error." << setfill('0') << setw(5) << udata->myid_c
+            << ".bin";
+      flag = SUNTimeSeries_Create(fname.str().c_str(), &eseries);
+      if (check_flag(&flag, "SUNTimeSeries_Create", 1)) { return -1; }
+
+      flag = SUNTimeSeries_SetAsync(eseries, 2);
+      if (flag != SUN_ERR_NOT_IMPLEMENTED &&
+          check_flag(&flag, "SUNTimeSeries_SetAsync", 1))
+      {
+        return -1;
+      }
+    }
+  }
 
   return 0;
 }
@@ -838,6 +873,18 @@ int UserOutput::write(sunrealtype t, N_Vector u, UserData* udata)
         eoutstream << endl;
       }
     }
+    else if (output == 3)
+    {
+      // Append solution and error to the binary time series
+      flag = SUNTimeSeries_Append(useries, t, u);
+      if (check_flag(&flag, "SUNTimeSeries_Append", 1)) { return -1; }
+
+      if (error)
+      {
+        flag = SUNTimeSeries_Append(eseries, t, error);
+        if (check_flag(&flag, "SUNTimeSeries_Append", 1)) { return -1; }
+      }
+    }
   }
   return 0;
 }
@@ -870,6 +917,12 @@ int UserOutput::close(UserData* udata)
     uoutstream.close();
     if (error) { eoutstream.close(); }
   }
+  else if (output == 3)
+  {
+    // Write the time series indices and close the files
+    SUNTimeSeries_Destroy(&useries);
+    SUNTimeSeries_Destroy(&eseries);
+  }
 
   if (error)
   {
@@ -194,11 +194,15 @@ struct UserOutput
 {
   // Ouput variables
   int output     = 1;    // 0 = no output, 1 = stats output, 2 = output to disk
+                         // 3 = binary output to disk
   int nout       = 20;   // number of output times
   N_Vector error = NULL; // error vector
   ofstream uoutstream;   // output file stream
   ofstream eoutstream;   // error file stream
 
+  SUNTimeSeries useries = NULL; // binary output time series
+  SUNTimeSeries eseries = NULL; // binary error time series
+
   // Helper functions
   int parse_args(vector<string>& args, bool outproc);
   void help();
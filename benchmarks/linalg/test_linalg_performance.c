@@ -0,0 +1,1029 @@
+/* -----------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the testing routine to evaluate the performance of the
+ * dense, band, sparse, and Gram-Schmidt kernels used by the
+ * SUNDIALS linear solvers. They do not check for accuracy.
+ *
+ * Each kernel is timed over a sweep of problem sizes and the
+ * achieved GFLOP/s and GB/s are reported along with the fraction of
+ * the measured STREAM triad bandwidth. The flop and byte counts are
+ * nominal, i.e., they count the compulsory memory traffic and
+ * ignore any reuse (or lack thereof) in cache.
+ * -----------------------------------------------------------------*/
+
+#include <sundials/sundials_config.h>
+
+/* POSIX timers */
+#if defined(SUNDIALS_HAVE_POSIX_TIMERS)
+#include <stddef.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+#include <nvector/nvector_serial.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sundials/sundials_band.h>
+#include <sundials/sundials_dense.h>
+#include <sundials/sundials_iterative.h>
+#include <sundials/sundials_math.h>
+#include <sundials/sundials_types.h>
+#include <sunmatrix/sunmatrix_sparse.h>
+
+#include "sundials_iterative_impl.h"
+
+#define ZERO SUN_RCONST(0.0)
+#define HALF SUN_RCONST(0.5)
+#define ONE  SUN_RCONST(1.0)
+
+/* length of the STREAM triad arrays and number of repetitions */
+#define STREAM_LEN  (1 << 22)
+#define STREAM_REPS 10
+
+/* nonzeros per row in the sparse tests (1D, 3D 7-point, 3D 27-point) */
+#define NUM_WIDTHS 3
+static const int sparse_widths[NUM_WIDTHS] = {3, 7, 27};
+
+/* private functions */
+static double get_time(void);
+static void time_stats(double* times, int num_warmups, int ntests,
+                       double* avg, double* sdev, double* min, double* max);
+static void print_result(const char* test, const char* kernel, long int n,
+                         long int param, double* times, double flops,
+                         double bytes);
+static void PrintTableHeader(void);
+static void SetTiming(int onoff);
+static void ClearCache(void);
+static int InitializeClearCache(int cachesize);
+static int FinalizeClearCache(void);
+static void rand_realtype(sunrealtype* data, sunindextype len,
+                          sunrealtype lower, sunrealtype upper);
+static sunindextype rand_index(sunindextype n);
+
+static double StreamTriad(void);
+static int Test_Dense(sunindextype max_n, int ntests);
+static int Test_Band(sunindextype n, int ntests);
+static int Test_Sparse(sunindextype n, int ntests, SUNContext ctx);
+static int Test_GramSchmidt(N_Vector X, int max_k, int ntests);
+static int Test_QRAdd(N_Vector X, int max_k, int ntests);
+
+/* private data */
+static int print_time   = 0;    /* flag for printing timing data      */
+static int nwarmups     = 1;    /* number of warmup tests to ignore   */
+static int num_tests    = 1;    /* number of timed tests              */
+static double stream_bw = 0.0;  /* measured STREAM bandwidth (GB/s)   */
+static FILE* csv_file   = NULL; /* optional CSV output file           */
+
+static sunindextype cache_len;   /* data length for clearing cache */
+static sunrealtype* cache_data;  /* data for clearing cache        */
+static unsigned int rand_state = 1; /* random number generator state */
+
+#if defined(SUNDIALS_HAVE_POSIX_TIMERS) && defined(_POSIX_TIMERS)
+time_t base_time_tv_sec = 0; /* Base time; makes time values returned
+                                by get_time easier to read when
+                                printed since they will be zero
+                                based.
+                              */
+#endif
+
+#define FMT1 "%33s %22.15e %22.15e %22.15e %22.15e %12.4f %12.4f %10.2f\n"
+
+/* ----------------------------------------------------------------------
+ * Main Linear Algebra Testing Routine
+ * --------------------------------------------------------------------*/
+int main(int argc, char* argv[])
+{
+  SUNContext ctx = NULL; /* SUNDIALS context */
+  N_Vector X     = NULL; /* test vector      */
+  sunindextype dense_n;  /* max dense size   */
+  sunindextype sparse_n; /* band/sparse size */
+  sunindextype veclen;   /* vector length    */
+
+  int print_timing; /* output timings       */
+  int ntests;       /* number of tests      */
+  int max_k;        /* max Krylov dimension */
+  int cachesize;    /* size of cache (MB)   */
+  int flag;         /* return flag          */
+
+  printf("\nStart Tests\n");
+
+  /* check inputs */
+  if (argc < 8)
+  {
+    printf("ERROR: SEVEN (7) arguments required: ");
+    printf("<max dense size> <band/sparse size> <vector length> ");
+    printf("<max Krylov dimension> <number of tests> <cache size (MB)> ");
+    printf("<print timing> [csv file]\n");
+    return (-1);
+  }
+
+  dense_n = (sunindextype)atol(argv[1]);
+  if (dense_n <= 0)
+  {
+    printf("ERROR: max dense size must be a positive integer \n");
+    return (-1);
+  }
+
+  sparse_n = (sunindextype)atol(argv[2]);
+  if (sparse_n <= 1)
+  {
+    printf("ERROR: band/sparse size must be an integer > 1 \n");
+    return (-1);
+  }
+
+  veclen = (sunindextype)atol(argv[3]);
+  if (veclen <= 0)
+  {
+    printf("ERROR: length of vector must be a positive integer \n");
+    return (-1);
+  }
+
+  max_k = atoi(argv[4]);
+  if (max_k < 2)
+  {
+    printf("ERROR: max Krylov dimension must be an integer > 1 \n");
+    return (-1);
+  }
+
+  ntests = atoi(argv[5]);
+  if (ntests <= 0)
+  {
+    printf("ERROR: number of tests must be a positive integer \n");
+    return (-1);
+  }
+  num_tests = ntests;
+
+  cachesize = atoi(argv[6]);
+  if (cachesize < 0)
+  {
+    printf("ERROR: cache size (MB) must be a non-negative integer \n");
+    return (-1);
+  }
+  InitializeClearCache(cachesize);
+
+  print_timing = atoi(argv[7]);
+  SetTiming(print_timing);
+
+  if (argc > 8)
+  {
+    csv_file = fopen(argv[8], "w");
+    if (csv_file == NULL)
+    {
+      printf("ERROR: could not open %s \n", argv[8]);
+      return (-1);
+    }
+    fprintf(csv_file, "kernel,n,param,ntest,avg,sdev,min,max,gflops,gbs,"
+                      "stream_pct\n");
+  }
+
+  printf("\nRunning with: \n");
+  printf("  max dense size        %ld \n", (long int)dense_n);
+  printf("  band/sparse size      %ld \n", (long int)sparse_n);
+  printf("  vector length         %ld \n", (long int)veclen);
+  printf("  max Krylov dimension  %d  \n", max_k);
+  printf("  number of tests       %d  \n", ntests);
+  printf("  timing on/off         %d  \n", print_timing);
+
+  flag = SUNContext_Create(SUN_COMM_NULL, &ctx);
+  if (flag) { return flag; }
+
+  /* measure the attainable memory bandwidth */
+  stream_bw = StreamTriad();
+  printf("\nSTREAM triad bandwidth: %.4f GB/s\n", stream_bw);
+
+  /* Create vectors */
+  X = N_VNew_Serial(veclen, ctx);
+
+  /* run tests */
+  if (print_timing) { printf("\n\n dense kernels:\n"); }
+  if (print_timing) { PrintTableHeader(); }
+  flag = Test_Dense(dense_n, ntests);
+
+  if (print_timing) { printf("\n\n band kernels:\n"); }
+  if (print_timing) { PrintTableHeader(); }
+  flag = Test_Band(sparse_n, ntests);
+
+  if (print_timing) { printf("\n\n sparse kernels:\n"); }
+  if (print_timing) { PrintTableHeader(); }
+  flag = Test_Sparse(sparse_n, ntests, ctx);
+
+  if (print_timing) { printf("\n\n Gram-Schmidt kernels:\n"); }
+  if (print_timing) { PrintTableHeader(); }
+  flag = Test_GramSchmidt(X, max_k, ntests);
+
+  if (print_timing) { printf("\n\n QR update kernels:\n"); }
+  if (print_timing) { PrintTableHeader(); }
+  flag = Test_QRAdd(X, max_k, ntests);
+
+  /* Free vectors */
+  N_VDestroy(X);
+
+  FinalizeClearCache();
+
+  if (csv_file) { fclose(csv_file); }
+
+  flag = SUNContext_Free(&ctx);
+  if (flag) { return flag; }
+
+  printf("\nFinished Tests\n");
+
+  return (flag);
+}
+
+/* ----------------------------------------------------------------------
+ * STREAM triad, a = b + s * c, returns the best bandwidth in GB/s
+ * --------------------------------------------------------------------*/
+static double StreamTriad(void)
+{
+  sunrealtype *a, *b, *c;
+  sunrealtype s = SUN_RCONST(3.0);
+  double start_time, best_time;
+  sunindextype i;
+  int rep;
+
+  a = (sunrealtype*)malloc(STREAM_LEN * sizeof(sunrealtype));
+  b = (sunrealtype*)malloc(STREAM_LEN * sizeof(sunrealtype));
+  c = (sunrealtype*)malloc(STREAM_LEN * sizeof(sunrealtype));
+
+  for (i = 0; i < STREAM_LEN; i++)
+  {
+    a[i] = ONE;
+    b[i] = SUN_RCONST(2.0);
+    c[i] = ZERO;
+  }
+
+  best_time = -1.0;
+  for (rep = 0; rep < STREAM_REPS; rep++)
+  {
+    start_time = get_time();
+    for (i = 0; i < STREAM_LEN; i++) { a[i] = b[i] + s * c[i]; }
+    start_time = get_time() - start_time;
+    if (best_time < 0.0 || start_time < best_time) { best_time = start_time; }
+  }
+
+  /* keep the compiler from discarding the loop */
+  if (a[STREAM_LEN / 2] != SUN_RCONST(2.0)) { printf("STREAM check failed\n"); }
+
+  free(a);
+  free(b);
+  free(c);
+
+  if (best_time <= 0.0) { return 0.0; }
+  return (3.0 * STREAM_LEN * sizeof(sunrealtype)) / best_time / 1.0e9;
+}
+
+/* -----------------------------------------------------------------------------
+ * Dense LU factorization and solve tests
+ * ---------------------------------------------------------------------------*/
+static void fill_dense(sunrealtype** a, sunindextype n)
+{
+  sunindextype j;
+  rand_realtype(a[0], n * n, -ONE, ONE);
+  for (j = 0; j < n; j++) { a[j][j] += (sunrealtype)n; }
+}
+
+static int Test_Dense(sunindextype max_n, int ntests)
+{
+  double start_time;
+  double* times;
+  double nd, flops, bytes;
+  sunrealtype** a;
+  sunrealtype* b;
+  sunindextype* p;
+  sunindextype n;
+  char name[64];
+  int i;
+
+  times = (double*)malloc((ntests + nwarmups) * sizeof(double));
+
+  for (n = 16; n <= max_n; n *= 2)
+  {
+    a = SUNDlsMat_newDenseMat(n, n);
+    p = SUNDlsMat_newIndexArray(n);
+    b = (sunrealtype*)malloc(n * sizeof(sunrealtype));
+    if (a == NULL || p == NULL || b == NULL)
+    {
+      printf("ERROR: dense allocation failed for n = %ld\n", (long int)n);
+      free(times);
+      return (1);
+    }
+    nd = (double)n;
+
+    /*
+     * LU factorization with partial pivoting
+     */
+
+    for (i = 0; i < ntests + nwarmups; i++)
+    {
+      fill_dense(a, n);
+
+      ClearCache();
+      start_time = get_time();
+      SUNDlsMat_denseGETRF(a, n, n, p);
+      times[i] = get_time() - start_time;
+    }
+
+    flops = 2.0 * nd * nd * nd / 3.0;
+    bytes = 2.0 * nd * nd * sizeof(sunrealtype);
+    snprintf(name, sizeof(name), "denseGETRF_n%ld", (long int)n);
+    print_result(name, "denseGETRF", (long int)n, 0, times, flops, bytes);
+
+    /*
+     * Forward and backward substitution with the factored matrix
+     */
+
+    for (i = 0; i < ntests + nwarmups; i++)
+    {
+      rand_realtype(b, n, -ONE, ONE);
+
+      ClearCache();
+      start_time = get_time();
+      SUNDlsMat_denseGETRS(a, n, p, b);
+      times[i] = get_time() - start_time;
+    }
+
+    flops = 2.0 * nd * nd;
+    bytes = (nd * nd + 2.0 * nd) * sizeof(sunrealtype) +
+            nd * sizeof(sunindextype);
+    snprintf(name, sizeof(name), "denseGETRS_n%ld", (long int)n);
+    print_result(name, "denseGETRS", (long int)n, 0, times, flops, bytes);
+
+    SUNDlsMat_destroyMat(a);
+    SUNDlsMat_destroyArray(p);
+    free(b);
+  }
+
+  free(times);
+  return (0);
+}
+
+/* -----------------------------------------------------------------------------
+ * Band LU factorization and solve tests with equal upper and lower bandwidths
+ * ---------------------------------------------------------------------------*/
+static void fill_band(sunrealtype** a, sunindextype n, sunindextype mu,
+                      sunindextype ml, sunindextype smu)
+{
+  sunindextype i, j;
+  rand_realtype(a[0], n * (smu + ml + 1), -ONE, ONE);
+  for (j = 0; j < n; j++)
+  {
+    /* zero the extra storage for fill-in above the upper bandwidth */
+    for (i = 0; i < smu - mu; i++) { a[j][i] = ZERO; }
+    a[j][smu] += (sunrealtype)(mu + ml + 1);
+  }
+}
+
+static int Test_Band(sunindextype n, int ntests)
+{
+  double start_time;
+  double* times;
+  double nd, flops, bytes;
+  sunrealtype** a;
+  sunrealtype* b;
+  sunindextype* p;
+  sunindextype bw, smu;
+  char name[64];
+  int i;
+
+  times = (double*)malloc((ntests + nwarmups) * sizeof(double));
+
+  p = SUNDlsMat_newIndexArray(n);
+  b = (sunrealtype*)malloc(n * sizeof(sunrealtype));
+  nd = (double)n;
+
+  for (bw = 1; bw <= 64 && bw < n; bw *= 2)
+  {
+    smu = SUNMIN(n - 1, bw + bw);
+    a   = SUNDlsMat_newBandMat(n, smu, bw);
+    if (a == NULL || p == NULL || b == NULL)
+    {
+      printf("ERROR: band allocation failed for n = %ld\n", (long int)n);
+      free(times);
+      return (1);
+    }
+
+    /*
+     * LU factorization with partial pivoting
+     */
+
+    for (i = 0; i < ntests + nwarmups; i++)
+    {
+      fill_band(a, n, bw, bw, smu);
+
+      ClearCache();
+      start_time = get_time();
+      SUNDlsMat_bandGBTRF(a, n, bw, bw, smu, p);
+      times[i] = get_time() - start_time;
+    }
+
+    flops = nd * (double)bw * (2.0 * (double)smu + 1.0);
+    bytes = 2.0 * nd * (double)(smu + bw + 1) * sizeof(sunrealtype);
+    snprintf(name, sizeof(name), "bandGBTRF_n%ld_bw%ld", (long int)n,
+             (long int)bw);
+    print_result(name, "bandGBTRF", (long int)n, (long int)bw, times, flops,
+                 bytes);
+
+    /*
+     * Forward and backward substitution with the factored matrix
+     */
+
+    for (i = 0; i < ntests + nwarmups; i++)
+    {
+      rand_realtype(b, n, -ONE, ONE);
+
+      ClearCache();
+      start_time = get_time();
+      SUNDlsMat_bandGBTRS(a, n, smu, bw, p, b);
+      times[i] = get_time() - start_time;
+    }
+
+    flops = 2.0 * nd * (double)(smu + bw + 1);
+    bytes = (nd * (double)(smu + bw + 1) + 2.0 * nd) * sizeof(sunrealtype) +
+            nd * sizeof(sunindextype);
+    snprintf(name, sizeof(name), "bandGBTRS_n%ld_bw%ld", (long int)n,
+             (long int)bw);
+    print_result(name, "bandGBTRS", (long int)n, (long int)bw, times, flops,
+                 bytes);
+
+    SUNDlsMat_destroyMat(a);
+  }
+
+  SUNDlsMat_destroyArray(p);
+  free(b);
+  free(times);
+  return (0);
+}
+
+/* -----------------------------------------------------------------------------
+ * Sparse matrix-vector product and scale-add-identity tests
+ *
+ * Two sparsity patterns with w nonzeros per row (or column) are tested: a
+ * banded pattern with contiguous entries around the diagonal and a random
+ * pattern with the diagonal and w - 1 randomly placed entries.
+ * ---------------------------------------------------------------------------*/
+static int compare_index(const void* a, const void* b)
+{
+  sunindextype ia = *(const sunindextype*)a;
+  sunindextype ib = *(const sunindextype*)b;
+  return (ia > ib) - (ia < ib);
+}
+
+static SUNMatrix create_sparse(sunindextype n, int w, int random, int type,
+                               SUNContext ctx)
+{
+  SUNMatrix A;
+  sunindextype *ptrs, *vals, *row;
+  sunindextype j, k, nnz, half;
+  int l;
+
+  A = SUNSparseMatrix(n, n, n * w, type, ctx);
+  if (A == NULL) { return NULL; }
+
+  ptrs = SUNSparseMatrix_IndexPointers(A);
+  vals = SUNSparseMatrix_IndexValues(A);
+  half = w / 2;
+  nnz  = 0;
+
+  for (j = 0; j < n; j++)
+  {
+    ptrs[j] = nnz;
+    row     = vals + nnz;
+    l       = 0;
+    if (random)
+    {
+      row[l++] = j;
+      while (l < w) { row[l++] = rand_index(n); }
+      qsort(row, w, sizeof(sunindextype), compare_index);
+
+      /* remove duplicate entries */
+      for (k = 1, l = 1; k < w; k++)
+      {
+        if (row[k] != row[l - 1]) { row[l++] = row[k]; }
+      }
+    }
+    else
+    {
+      for (k = SUNMAX(0, j - half); k <= SUNMIN(n - 1, j + half); k++)
+      {
+        row[l++] = k;
+      }
+    }
+    nnz += l;
+  }
+  ptrs[n] = nnz;
+
+  rand_realtype(SUNSparseMatrix_Data(A), nnz, -ONE, ONE);
+
+  return A;
+}
+
+static int Test_Sparse(sunindextype n, int ntests, SUNContext ctx)
+{
+  double start_time;
+  double* times;
+  double nd, nnz, flops, bytes;
+  SUNMatrix A;
+  N_Vector x, y;
+  const char* pattern;
+  const char* fmt;
+  char kernel[32];
+  char name[sizeof(kernel) + 16]; /* kernel name plus "_w<width>" */
+  int i, w, random, type;
+
+  times = (double*)malloc((ntests + nwarmups) * sizeof(double));
+
+  x  = N_VNew_Serial(n, ctx);
+  y  = N_VClone(x);
+  nd = (double)n;
+
+  for (type = CSC_MAT; type <= CSR_MAT; type++)
+  {
+    fmt = (type == CSR_MAT) ? "CSR" : "CSC";
+
+    for (random = 0; random <= 1; random++)
+    {
+      pattern = random ? "rand" : "band";
+
+      for (w = 0; w < NUM_WIDTHS; w++)
+      {
+        A = create_sparse(n, sparse_widths[w], random, type, ctx);
+        if (A == NULL)
+        {
+          printf("ERROR: sparse allocation failed for n = %ld\n", (long int)n);
+          free(times);
+          return (1);
+        }
+        nnz = (double)SUNSparseMatrix_NNZ(A);
+
+        /*
+         * Matrix-vector product, y = A x
+         */
+
+        for (i = 0; i < ntests + nwarmups; i++)
+        {
+          rand_realtype(N_VGetArrayPointer(x), n, -ONE, ONE);
+
+          ClearCache();
+          start_time = get_time();
+          SUNMatMatvec(A, x, y);
+          times[i] = get_time() - start_time;
+        }
+
+        flops = 2.0 * nnz;
+        bytes = nnz * (sizeof(sunrealtype) + sizeof(sunindextype)) +
+                (nd + 1.0) * sizeof(sunindextype) +
+                2.0 * nd * sizeof(sunrealtype);
+        snprintf(kernel, sizeof(kernel), "Matvec%s_%s", fmt, pattern);
+        snprintf(name, sizeof(name), "%s_w%d", kernel, sparse_widths[w]);
+        print_result(name, kernel, (long int)n, (long int)sparse_widths[w],
+                     times, flops, bytes);
+
+        /*
+         * Scale and add identity, A = c A + I, with the diagonal present
+         */
+
+        for (i = 0; i < ntests + nwarmups; i++)
+        {
+          rand_realtype(SUNSparseMatrix_Data(A), SUNSparseMatrix_NNZ(A), -ONE,
+                        ONE);
+
+          ClearCache();
+          start_time = get_time();
+          SUNMatScaleAddI(HALF, A);
+          times[i] = get_time() - start_time;
+        }
+
+        flops = nnz + nd;
+        bytes = 2.0 * nnz * sizeof(sunrealtype) + nnz * sizeof(sunindextype) +
+                (nd + 1.0) * sizeof(sunindextype);
+        snprintf(kernel, sizeof(kernel), "ScaleAddI%s_%s", fmt, pattern);
+        snprintf(name, sizeof(name), "%s_w%d", kernel, sparse_widths[w]);
+        print_result(name, kernel, (long int)n, (long int)sparse_widths[w],
+                     times, flops, bytes);
+
+        SUNMatDestroy(A);
+      }
+    }
+  }
+
+  N_VDestroy(x);
+  N_VDestroy(y);
+  free(times);
+  return (0);
+}
+
+/* -----------------------------------------------------------------------------
+ * Modified and classical Gram-Schmidt tests
+ *
+ * For each Krylov dimension k an orthonormal basis v[0], ..., v[k-1] is built
+ * (untimed) and then a random vector v[k] is orthogonalized against it. The
+ * tests are run with the fused vector operations disabled and enabled.
+ * ---------------------------------------------------------------------------*/
+static int build_basis(N_Vector* v, sunrealtype** h, int k, sunindextype n)
+{
+  sunrealtype norm;
+  int j;
+
+  rand_realtype(N_VGetArrayPointer(v[0]), n, -ONE, ONE);
+  N_VScale(ONE / SUNRsqrt(N_VDotProd(v[0], v[0])), v[0], v[0]);
+
+  for (j = 1; j < k; j++)
+  {
+    rand_realtype(N_VGetArrayPointer(v[j]), n, -ONE, ONE);
+    if (SUNModifiedGS(v, h, j, j, &norm)) { return (1); }
+    N_VScale(ONE / norm, v[j], v[j]);
+  }
+
+  return (0);
+}
+
+static int Test_GramSchmidt(N_Vector X, int max_k, int ntests)
+{
+  double start_time;
+  double* times;
+  double nd, kd, flops, bytes;
+  N_Vector *v, *vtemp;
+  sunrealtype **h, *stemp, norm;
+  sunindextype n;
+  char name[64];
+  const char* suffix;
+  int i, j, k, fused;
+
+  times = (double*)malloc((ntests + nwarmups) * sizeof(double));
+
+  n  = N_VGetLength(X);
+  nd = (double)n;
+
+  h = (sunrealtype**)malloc(max_k * sizeof(sunrealtype*));
+  for (j = 0; j < max_k; j++)
+  {
+    h[j] = (sunrealtype*)malloc(max_k * sizeof(sunrealtype));
+  }
+  stemp = (sunrealtype*)malloc((max_k + 1) * sizeof(sunrealtype));
+  vtemp = (N_Vector*)malloc((max_k + 1) * sizeof(N_Vector));
+
+  for (fused = 0; fused <= 1; fused++)
+  {
+    N_VEnableFusedOps_Serial(X, fused ? SUNTRUE : SUNFALSE);
+    suffix = fused ? "_fused" : "";
+
+    v = N_VCloneVectorArray(max_k + 1, X);
+
+    for (k = 2; k <= max_k; k = (k < max_k && 2 * k > max_k) ? max_k : 2 * k)
+    {
+      kd = (double)k;
+      if (build_basis(v, h, k, n))
+      {
+        printf("ERROR: failed to build an orthonormal basis\n");
+        return (1);
+      }
+
+      /*
+       * Modified Gram-Schmidt
+       */
+
+      for (i = 0; i < ntests + nwarmups; i++)
+      {
+        rand_realtype(N_VGetArrayPointer(v[k]), n, -ONE, ONE);
+
+        ClearCache();
+        start_time = get_time();
+        SUNModifiedGS(v, h, k, k, &norm);
+        times[i] = get_time() - start_time;
+      }
+
+      flops = 4.0 * nd * kd + 4.0 * nd;
+      bytes = 5.0 * nd * kd * sizeof(sunrealtype) +
+              2.0 * nd * sizeof(sunrealtype);
+      snprintf(name, sizeof(name), "SUNModifiedGS%s_k%d", suffix, k);
+      print_result(name, fused ? "SUNModifiedGS_fused" : "SUNModifiedGS",
+                   (long int)n, (long int)k, times, flops, bytes);
+
+      /*
+       * Classical Gram-Schmidt (the reorthogonalization is data dependent)
+       */
+
+      for (i = 0; i < ntests + nwarmups; i++)
+      {
+        rand_realtype(N_VGetArrayPointer(v[k]), n, -ONE, ONE);
+
+        ClearCache();
+        start_time = get_time();
+        SUNClassicalGS(v, h, k, k, &norm, stemp, vtemp);
+        times[i] = get_time() - start_time;
+      }
+
+      flops = 4.0 * nd * (kd + 1.0) + 2.0 * nd;
+      bytes = (2.0 * kd + 4.0) * nd * sizeof(sunrealtype);
+      snprintf(name, sizeof(name), "SUNClassicalGS%s_k%d", suffix, k);
+      print_result(name, fused ? "SUNClassicalGS_fused" : "SUNClassicalGS",
+                   (long int)n, (long int)k, times, flops, bytes);
+    }
+
+    N_VDestroyVectorArray(v, max_k + 1);
+  }
+
+  N_VEnableFusedOps_Serial(X, SUNFALSE);
+
+  for (j = 0; j < max_k; j++) { free(h[j]); }
+  free(h);
+  free(stemp);
+  free(vtemp);
+  free(times);
+  return (0);
+}
+
+/* -----------------------------------------------------------------------------
+ * QR factorization update tests for Anderson acceleration
+ *
+ * For each depth m the factorization of m random columns is built (untimed)
+ * and then the time to add column m is measured. The variants use different
+ * vector operations but the same nominal flop and byte counts as SUNQRAdd_MGS
+ * so the rates can be compared directly. The single buffer variants are only
+ * run when the vector provides the required reduction operations.
+ * ---------------------------------------------------------------------------*/
+#define NUM_QRADD 6
+
+static int Test_QRAdd(N_Vector X, int max_k, int ntests)
+{
+  static const char* names[NUM_QRADD] = {"SUNQRAdd_MGS",   "SUNQRAdd_ICWY",
+                                         "SUNQRAdd_ICWY_SB",
+                                         "SUNQRAdd_CGS2",  "SUNQRAdd_DCGS2",
+                                         "SUNQRAdd_DCGS2_SB"};
+  static const SUNQRAddFn funcs[NUM_QRADD] = {SUNQRAdd_MGS,     SUNQRAdd_ICWY,
+                                              SUNQRAdd_ICWY_SB, SUNQRAdd_CGS2,
+                                              SUNQRAdd_DCGS2,
+                                              SUNQRAdd_DCGS2_SB};
+  static const int single_buffer[NUM_QRADD] = {0, 0, 1, 0, 0, 1};
+
+  double start_time;
+  double* times;
+  double nd, md, flops, bytes;
+  N_Vector *Q, *df;
+  sunrealtype *R, *temp;
+  struct _SUNQRData qrdata;
+  sunindextype n;
+  char name[64];
+  int i, j, m, f;
+
+  times = (double*)malloc((ntests + nwarmups) * sizeof(double));
+
+  n  = N_VGetLength(X);
+  nd = (double)n;
+
+  N_VEnableFusedOps_Serial(X, SUNTRUE);
+
+  Q  = N_VCloneVectorArray(max_k, X);
+  df = N_VCloneVectorArray(max_k, X);
+  R  = (sunrealtype*)calloc(max_k * max_k, sizeof(sunrealtype));
+  temp = (sunrealtype*)calloc(max_k * max_k + 2 * (max_k + 1),
+                              sizeof(sunrealtype));
+
+  qrdata.vtemp      = N_VClone(X);
+  qrdata.vtemp2     = N_VClone(X);
+  qrdata.temp_array = temp;
+
+  for (f = 0; f < NUM_QRADD; f++)
+  {
+    if (single_buffer[f] && (X->ops->nvdotprodmultilocal == NULL ||
+                             X->ops->nvdotprodmultiallreduce == NULL))
+    {
+      if (print_time) { printf("%33s (skipped, not supported)\n", names[f]); }
+      continue;
+    }
+
+    for (m = 1; m < max_k; m = (m < max_k - 1 && 2 * m > max_k - 1) ? max_k - 1
+                                                                     : 2 * m)
+    {
+      md = (double)m;
+
+      for (i = 0; i < ntests + nwarmups; i++)
+      {
+        /* build the factorization of the first m columns */
+        for (j = 0; j <= m; j++)
+        {
+          rand_realtype(N_VGetArrayPointer(df[j]), n, -ONE, ONE);
+        }
+        for (j = 0; j < m; j++)
+        {
+          if (funcs[f](Q, R, df[j], j, max_k, &qrdata))
+          {
+            printf("ERROR: %s failed\n", names[f]);
+            return (1);
+          }
+        }
+
+        ClearCache();
+        start_time = get_time();
+        funcs[f](Q, R, df[m], m, max_k, &qrdata);
+        times[i] = get_time() - start_time;
+      }
+
+      flops = 4.0 * nd * md + 3.0 * nd;
+      bytes = (5.0 * md + 5.0) * nd * sizeof(sunrealtype);
+      snprintf(name, sizeof(name), "%s_m%d", names[f], m);
+      print_result(name, names[f], (long int)n, (long int)m, times, flops,
+                   bytes);
+    }
+  }
+
+  N_VEnableFusedOps_Serial(X, SUNFALSE);
+
+  N_VDestroy(qrdata.vtemp);
+  N_VDestroy(qrdata.vtemp2);
+  N_VDestroyVectorArray(Q, max_k);
+  N_VDestroyVectorArray(df, max_k);
+  free(R);
+  free(temp);
+  free(times);
+  return (0);
+}
+
+/* ======================================================================
+ * Private functions
+ * ====================================================================*/
+
+/* ----------------------------------------------------------------------
+ * Print a table row and, if enabled, a CSV row with the timing stats and
+ * the achieved rates computed from the average time
+ * --------------------------------------------------------------------*/
+static void print_result(const char* test, const char* kernel, long int n,
+                         long int param, double* times, double flops,
+                         double bytes)
+{
+  double avg, sdev, min, max, gflops, gbs, pct;
+
+  time_stats(times, nwarmups, num_tests, &avg, &sdev, &min, &max);
+
+  gflops = (avg > 0.0) ? flops / avg / 1.0e9 : 0.0;
+  gbs    = (avg > 0.0) ? bytes / avg / 1.0e9 : 0.0;
+  pct    = (stream_bw > 0.0) ? 100.0 * gbs / stream_bw : 0.0;
+
+  if (print_time)
+  {
+    printf(FMT1, test, avg, sdev, min, max, gflops, gbs, pct);
+  }
+
+  if (csv_file)
+  {
+    fprintf(csv_file,
+            "%s,%ld,%ld,%d,%.15e,%.15e,%.15e,%.15e,%.6f,%.6f,%.4f\n", kernel,
+            n, param, num_tests, avg, sdev, min, max, gflops, gbs, pct);
+  }
+}
+
+static void PrintTableHeader(void)
+{
+  printf("\n%33s %22s %22s %22s %22s %12s %12s %10s\n", "Operation", "Avg",
+         "Std Dev", "Min", "Max", "GFLOP/s", "GB/s", "% STREAM");
+}
+
+static void SetTiming(int onoff)
+{
+#if defined(SUNDIALS_HAVE_POSIX_TIMERS) && defined(_POSIX_TIMERS)
+  struct timespec spec;
+  clock_gettime(CLOCK_MONOTONIC, &spec);
+  base_time_tv_sec = spec.tv_sec;
+
+  clock_getres(CLOCK_MONOTONIC, &spec);
+  printf("Timer resolution: %ld ns = %g s\n", spec.tv_nsec,
+         ((double)(spec.tv_nsec) / 1E9));
+#endif
+
+  print_time = onoff;
+}
+
+/* ----------------------------------------------------------------------
+ * Fill a sunrealtype array with random numbers between lower and upper
+ * using a linear congruential generator suggested in the C99 standard.
+ * The generator is seeded once so the sparsity patterns are repeatable.
+ * --------------------------------------------------------------------*/
+static void rand_realtype(sunrealtype* data, sunindextype len,
+                          sunrealtype lower, sunrealtype upper)
+{
+  sunindextype i;
+  sunrealtype range = upper - lower;
+
+  for (i = 0; i < len; i++)
+  {
+    rand_state = (1103515245u * rand_state + 12345u) & 0x7fffffffu;
+    data[i] = range * ((sunrealtype)rand_state / (sunrealtype)0x7fffffff) +
+              lower;
+  }
+}
+
+/* random index in [0, n) */
+static sunindextype rand_index(sunindextype n)
+{
+  rand_state = (1103515245u * rand_state + 12345u) & 0x7fffffffu;
+  return (sunindextype)(((double)rand_state / 2147483648.0) * (double)n);
+}
+
+/* ----------------------------------------------------------------------
+ * Clear the cache by summing an array twice the size of the cache
+ * --------------------------------------------------------------------*/
+static int InitializeClearCache(int cachesize)
+{
+  size_t nbytes; /* cache size in bytes */
+
+  if (!cachesize)
+  {
+    cache_len  = 0;
+    cache_data = NULL;
+    return 0;
+  }
+
+  /* size of array to clear cache, N = ceil(2 * nbytes/sunrealtype) */
+  nbytes    = (size_t)(2 * cachesize * 1024 * 1024);
+  cache_len = (sunindextype)((nbytes + sizeof(sunrealtype) - 1) /
+                             sizeof(sunrealtype));
+
+  /* allocate data and fill random values */
+  cache_data = (sunrealtype*)malloc(cache_len * sizeof(sunrealtype));
+  rand_realtype(cache_data, cache_len, -ONE, ONE);
+
+  return (0);
+}
+
+static int FinalizeClearCache(void)
+{
+  if (cache_data) { free(cache_data); }
+  return (0);
+}
+
+static void ClearCache(void)
+{
+  if (cache_data)
+  {
+    sunrealtype sum;
+    sunindextype i;
+
+    sum = ZERO;
+    for (i = 0; i < cache_len; i++) { sum += cache_data[i]; }
+    (void)sum;
+  }
+}
+
+/* ----------------------------------------------------------------------
+ * Timer
+ * --------------------------------------------------------------------*/
+static double get_time(void)
+{
+  double time;
+#if defined(SUNDIALS_HAVE_POSIX_TIMERS) && defined(_POSIX_TIMERS)
+  struct timespec spec;
+  clock_gettime(CLOCK_MONOTONIC, &spec);
+  time = (double)(spec.tv_sec - base_time_tv_sec) +
+         ((double)(spec.tv_nsec) / 1E9);
+#else
+  time = 0;
+#endif
+  return time;
+}
+
+/* ----------------------------------------------------------------------
+ * compute average, standard deviation, max, and min
+ * --------------------------------------------------------------------*/
+static void time_stats(double* times, int num_warmups, int ntests,
+                       double* avg, double* sdev, double* min, double* max)
+{
+  int i, ntotal;
+
+  /* total number of times collected */
+  ntotal = num_warmups + ntests;
+
+  /* compute timing stats */
+  *avg = 0.0;
+  *min = times[num_warmups];
+  *max = times[num_warmups];
+
+  for (i = num_warmups; i < ntotal; i++)
+  {
+    *avg += times[i];
+    if (times[i] < *min) { *min = times[i]; }
+    if (times[i] > *max) { *max = times[i]; }
+  }
+  *avg /= ntests;
+
+  *sdev = 0.0;
+  if (ntests > 1)
+  {
+    for (i = num_warmups; i < ntotal; i++)
+    {
+      *sdev += (times[i] - *avg) * (times[i] - *avg);
+    }
+    *sdev = sqrt(*sdev / (ntests - 1));
+  }
+}
@@ -0,0 +1,669 @@
+/* -----------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This program replays the linear systems in an archive written by
+ * SUNLinSysCapture. Each captured right-hand side is solved with
+ * every applicable SUNLinearSolver (the direct solvers matching the
+ * matrix format and the Krylov solvers with no preconditioner and
+ * with a Jacobi preconditioner) and the time to reach the requested
+ * relative residual is reported.
+ * -----------------------------------------------------------------*/
+
+#include <sundials/sundials_config.h>
+
+/* POSIX timers */
+#if defined(SUNDIALS_HAVE_POSIX_TIMERS)
+#include <stddef.h>
+#include <time.h>
+#include <unistd.h>
+#endif
+
+#include <nvector/nvector_serial.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sundials/sundials_core.h>
+#include <sundials/sundials_math.h>
+#include <sunlinsol/sunlinsol_band.h>
+#include <sunlinsol/sunlinsol_dense.h>
+#include <sunlinsol/sunlinsol_pcg.h>
+#include <sunlinsol/sunlinsol_spbcgs.h>
+#include <sunlinsol/sunlinsol_spfgmr.h>
+#include <sunlinsol/sunlinsol_spgmr.h>
+#include <sunlinsol/sunlinsol_sptfqmr.h>
+#include <sunmatrix/sunmatrix_band.h>
+#include <sunmatrix/sunmatrix_dense.h>
+#include <sunmatrix/sunmatrix_sparse.h>
+
+#if defined(SUNDIALS_KLU_ENABLED)
+#include <sunlinsol/sunlinsol_klu.h>
+#endif
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+
+/* Krylov solvers */
+#define NUM_KRYLOV 5
+static const char* krylov_names[NUM_KRYLOV] = {"SPGMR", "SPFGMR", "SPBCGS",
+                                               "SPTFQMR", "PCG"};
+
+/* Preconditioner data, the inverse of the diagonal of A */
+typedef struct
+{
+  SUNMatrix A;
+  N_Vector dinv;
+  sunbooleantype jacobi;
+} PrecData;
+
+/* Result of replaying one system with one solver */
+typedef struct
+{
+  const char* solver;
+  const char* prec;
+  long int iters;
+  double setup;
+  double solve;
+  sunrealtype relres;
+} Result;
+
+/* private functions */
+static double get_time(void);
+static int ReadHeader(FILE* fp);
+static int ReadMatrix(FILE* fp, SUNLinSysCaptureRecord* rec, SUNContext ctx,
+                      SUNMatrix* A);
+static int ReadRhs(FILE* fp, SUNLinSysCaptureRecord* rec, N_Vector b);
+static int Replay(SUNMatrix A, N_Vector b, SUNLinSysCaptureRecord* mrec,
+                  long int rhs);
+static int ReplayOnes(SUNMatrix A, N_Vector b, SUNLinSysCaptureRecord* mrec);
+static int RunDirect(SUNMatrix A, N_Vector b, N_Vector x, Result* res);
+static int RunKrylov(int k, sunbooleantype jacobi, SUNMatrix A, N_Vector b,
+                     N_Vector x, Result* res);
+static sunrealtype RelResidual(SUNMatrix A, N_Vector x, N_Vector b);
+static int ATimes(void* A_data, N_Vector v, N_Vector z);
+static int JacobiSetup(void* P_data);
+static int JacobiSolve(void* P_data, N_Vector r, N_Vector z, sunrealtype tol,
+                       int lr);
+static void PrintResult(SUNLinSysCaptureRecord* mrec, long int rhs,
+                        Result* res);
+
+/* private data */
+static sunrealtype rtol = SUN_RCONST(1.0e-6); /* relative residual tolerance */
+static int maxit        = 100;                /* max Krylov iterations       */
+static int num_tests    = 1;                  /* number of timed tests       */
+static FILE* csv_file   = NULL;               /* optional CSV output file    */
+static const char* format_names[5] = {"unknown", "dense", "band", "csc", "csr"};
+
+#if defined(SUNDIALS_HAVE_POSIX_TIMERS) && defined(_POSIX_TIMERS)
+time_t base_time_tv_sec = 0; /* Base time; makes time values returned
+                                by get_time easier to read when
+                                printed since they will be zero
+                                based.
+                              */
+#endif
+
+#define FMT1 "%6ld %4ld %8s %7s %6ld %14.6e %14.6e %14.6e %12.4e %s\n"
+
+/* ----------------------------------------------------------------------
+ * Main Linear System Replay Routine
+ * --------------------------------------------------------------------*/
+int main(int argc, char* argv[])
+{
+  SUNContext ctx = NULL;           /* SUNDIALS context        */
+  SUNMatrix A    = NULL;           /* current system matrix   */
+  N_Vector b     = NULL;           /* current right-hand side */
+  FILE* fp       = NULL;           /* archive file            */
+  SUNLinSysCaptureRecord rec, mrec; /* record headers          */
+  long int nrhs = 0;                /* rhs replayed for A      */
+  int flag      = 0;                /* return flag             */
+
+  /* check inputs */
+  if (argc < 2)
+  {
+    printf("ERROR: ONE (1) argument required: <archive> [relative tolerance] ");
+    printf("[max iterations] [number of tests] [csv file]\n");
+    return (-1);
+  }
+
+  if (argc > 2) { rtol = (sunrealtype)atof(argv[2]); }
+  if (rtol <= ZERO)
+  {
+    printf("ERROR: relative tolerance must be positive \n");
+    return (-1);
+  }
+
+  if (argc > 3) { maxit = atoi(argv[3]); }
+  if (maxit <= 0)
+  {
+    printf("ERROR: max iterations must be a positive integer \n");
+    return (-1);
+  }
+
+  if (argc > 4) { num_tests = atoi(argv[4]); }
+  if (num_tests <= 0)
+  {
+    printf("ERROR: number of tests must be a positive integer \n");
+    return (-1);
+  }
+
+  if (argc > 5)
+  {
+    csv_file = fopen(argv[5], "w");
+    if (csv_file == NULL)
+    {
+      printf("ERROR: could not open csv file %s \n", argv[5]);
+      return (-1);
+    }
+    fprintf(csv_file, "system,rhs,t,gamma,n,format,solver,prec,iters,setup,"
+                      "solve,total,relres,converged\n");
+  }
+
+  fp = fopen(argv[1], "rb");
+  if (fp == NULL)
+  {
+    printf("ERROR: could not open archive %s \n", argv[1]);
+    return (-1);
+  }
+  if (ReadHeader(fp)) { return (-1); }
+
+  flag = SUNContext_Create(SUN_COMM_NULL, &ctx);
+  if (flag) { return flag; }
+
+#if defined(SUNDIALS_HAVE_POSIX_TIMERS) && defined(_POSIX_TIMERS)
+  {
+    struct timespec spec;
+    clock_gettime(CLOCK_MONOTONIC, &spec);
+    base_time_tv_sec = spec.tv_sec;
+  }
+#endif
+
+  printf("\nReplaying %s with relative tolerance %g, ", argv[1], (double)rtol);
+  printf("%d max iterations, and %d tests\n\n", maxit, num_tests);
+  printf("%6s %4s %8s %7s %6s %14s %14s %14s %12s %s\n", "system", "rhs",
+         "solver", "prec", "iters", "setup (s)", "solve (s)", "total (s)",
+         "rel. res.", "status");
+
+  while (flag == 0 && fread(&rec, sizeof(rec), 1, fp) == 1)
+  {
+    if (rec.kind == SUN_LINSYSCAPTURE_MATRIX)
+    {
+      /* replay a matrix without right-hand sides with b = A * 1 */
+      if (A != NULL && nrhs == 0) { flag = ReplayOnes(A, b, &mrec); }
+
+      if (A) { SUNMatDestroy(A); }
+      if (b) { N_VDestroy(b); }
+      A    = NULL;
+      b    = NULL;
+      mrec = rec;
+      nrhs = 0;
+
+      if (!flag) { flag = ReadMatrix(fp, &rec, ctx, &A); }
+      if (!flag)
+      {
+        b = N_VNew_Serial((sunindextype)rec.rows, ctx);
+        if (b == NULL) { flag = -1; }
+      }
+    }
+    else if (rec.kind == SUN_LINSYSCAPTURE_RHS && A != NULL &&
+             rec.system == mrec.system && rec.rows == mrec.rows)
+    {
+      flag = ReadRhs(fp, &rec, b);
+      if (!flag) { flag = Replay(A, b, &mrec, nrhs++); }
+    }
+    else
+    {
+      printf("ERROR: unexpected record in the archive \n");
+      flag = -1;
+    }
+  }
+
+  if (!flag && A != NULL && nrhs == 0) { flag = ReplayOnes(A, b, &mrec); }
+
+  if (A) { SUNMatDestroy(A); }
+  if (b) { N_VDestroy(b); }
+  fclose(fp);
+  if (csv_file) { fclose(csv_file); }
+  SUNContext_Free(&ctx);
+
+  printf("\nFinished Replay\n");
+
+  return (flag);
+}
+
+/* ----------------------------------------------------------------------
+ * Replay one system with all applicable solvers
+ * --------------------------------------------------------------------*/
+static int Replay(SUNMatrix A, N_Vector b, SUNLinSysCaptureRecord* mrec,
+                  long int rhs)
+{
+  N_Vector x = NULL;
+  Result res;
+  int k, p, flag;
+
+  x = N_VClone(b);
+  if (x == NULL) { return (-1); }
+
+  /* direct solver for the matrix format (if any) */
+  flag = RunDirect(A, b, x, &res);
+  if (flag > 0) { PrintResult(mrec, rhs, &res); }
+  else if (flag < 0)
+  {
+    N_VDestroy(x);
+    return (-1);
+  }
+
+  /* Krylov solvers without and with Jacobi preconditioning */
+  for (k = 0; k < NUM_KRYLOV; k++)
+  {
+    for (p = 0; p < 2; p++)
+    {
+      if (RunKrylov(k, p, A, b, x, &res))
+      {
+        N_VDestroy(x);
+        return (-1);
+      }
+      PrintResult(mrec, rhs, &res);
+    }
+  }
+
+  N_VDestroy(x);
+  return (0);
+}
+
+/* ----------------------------------------------------------------------
+ * Replay a system without captured right-hand sides using b = A * 1
+ * --------------------------------------------------------------------*/
+static int ReplayOnes(SUNMatrix A, N_Vector b, SUNLinSysCaptureRecord* mrec)
+{
+  N_Vector ones = N_VClone(b);
+  int flag;
+
+  if (ones == NULL) { return (-1); }
+  N_VConst(ONE, ones);
+
+  flag = SUNMatMatvec(A, ones, b);
+  N_VDestroy(ones);
+  if (flag) { return (-1); }
+
+  return (Replay(A, b, mrec, -1));
+}
+
+/* ----------------------------------------------------------------------
+ * Solve with the direct solver for the matrix format. Returns 1 if a
+ * solver was run, 0 if there is no direct solver for the format, and
+ * -1 on failure.
+ * --------------------------------------------------------------------*/
+static int RunDirect(SUNMatrix A, N_Vector b, N_Vector x, Result* res)
+{
+  SUNMatrix LU       = NULL;
+  SUNLinearSolver LS = NULL;
+  double start;
+  int i, flag = 0;
+
+  LU = SUNMatClone(A);
+  if (LU == NULL) { return (-1); }
+
+  switch (SUNMatGetID(A))
+  {
+  case SUNMATRIX_DENSE:
+    LS          = SUNLinSol_Dense(b, LU, b->sunctx);
+    res->solver = "DENSE";
+    break;
+  case SUNMATRIX_BAND:
+    LS          = SUNLinSol_Band(b, LU, b->sunctx);
+    res->solver = "BAND";
+    break;
+#if defined(SUNDIALS_KLU_ENABLED)
+  case SUNMATRIX_SPARSE:
+    LS          = SUNLinSol_KLU(b, LU, b->sunctx);
+    res->solver = "KLU";
+    break;
+#endif
+  default: SUNMatDestroy(LU); return (0);
+  }
+  if (LS == NULL)
+  {
+    SUNMatDestroy(LU);
+    return (-1);
+  }
+
+  res->prec  = "-";
+  res->iters = 0;
+  res->setup = 1.0e30;
+  res->solve = 1.0e30;
+
+  for (i = 0; i < num_tests && !flag; i++)
+  {
+    flag = SUNMatCopy(A, LU);
+    if (flag) { break; }
+
+    start      = get_time();
+    flag       = SUNLinSolSetup(LS, LU);
+    res->setup = SUNMIN(res->setup, get_time() - start);
+    if (flag) { break; }
+
+    start      = get_time();
+    flag       = SUNLinSolSolve(LS, LU, x, b, ZERO);
+    res->solve = SUNMIN(res->solve, get_time() - start);
+  }
+
+  /* a failed factorization or solve is reported as not converged */
+  res->relres = flag ? SUN_BIG_REAL : RelResidual(A, x, b);
+
+  SUNLinSolFree(LS);
+  SUNMatDestroy(LU);
+  return (1);
+}
+
+/* ----------------------------------------------------------------------
+ * Solve with Krylov solver k and the matrix-vector product with A
+ * --------------------------------------------------------------------*/
+static int RunKrylov(int k, sunbooleantype jacobi, SUNMatrix A, N_Vector b,
+                     N_Vector x, Result* res)
+{
+  SUNLinearSolver LS = NULL;
+  PrecData pdata;
+  sunrealtype delta;
+  double start;
+  int i, pretype, flag = 0;
+
+  pretype = jacobi ? SUN_PREC_RIGHT : SUN_PREC_NONE;
+
+  switch (k)
+  {
+  case 0: LS = SUNLinSol_SPGMR(b, pretype, maxit, b->sunctx); break;
+  case 1: LS = SUNLinSol_SPFGMR(b, pretype, maxit, b->sunctx); break;
+  case 2: LS = SUNLinSol_SPBCGS(b, pretype, maxit, b->sunctx); break;
+  case 3: LS = SUNLinSol_SPTFQMR(b, pretype, maxit, b->sunctx); break;
+  default: LS = SUNLinSol_PCG(b, pretype, maxit, b->sunctx); break;
+  }
+  if (LS == NULL) { return (-1); }
+
+  pdata.A      = A;
+  pdata.jacobi = jacobi;
+  pdata.dinv   = N_VClone(b);
+  if (pdata.dinv == NULL)
+  {
+    SUNLinSolFree(LS);
+    return (-1);
+  }
+
+  flag = SUNLinSolSetATimes(LS, A, ATimes);
+  if (!flag && jacobi)
+  {
+    flag = SUNLinSolSetPreconditioner(LS, &pdata, JacobiSetup, JacobiSolve);
+  }
+  if (!flag) { flag = SUNLinSolInitialize(LS); }
+  if (flag)
+  {
+    SUNLinSolFree(LS);
+    N_VDestroy(pdata.dinv);
+    return (-1);
+  }
+
+  /* the Krylov solvers test the unscaled 2-norm of the residual */
+  delta = rtol * SUNRsqrt(N_VDotProd(b, b));
+
+  res->solver = krylov_names[k];
+  res->prec   = jacobi ? "jacobi" : "none";
+  res->setup  = 1.0e30;
+  res->solve  = 1.0e30;
+
+  for (i = 0; i < num_tests && !flag; i++)
+  {
+    start      = get_time();
+    flag       = SUNLinSolSetup(LS, NULL);
+    res->setup = SUNMIN(res->setup, get_time() - start);
+    if (flag) { break; }
+
+    N_VConst(ZERO, x);
+    SUNLinSolSetZeroGuess(LS, SUNTRUE);
+
+    start      = get_time();
+    flag       = SUNLinSolSolve(LS, NULL, x, b, delta);
+    res->solve = SUNMIN(res->solve, get_time() - start);
+  }
+
+  /* an unconverged solve is detected by the residual check */
+  res->iters  = (long int)SUNLinSolNumIters(LS);
+  res->relres = (flag < 0) ? SUN_BIG_REAL : RelResidual(A, x, b);
+
+  SUNLinSolFree(LS);
+  N_VDestroy(pdata.dinv);
+  return (0);
+}
+
+/* ----------------------------------------------------------------------
+ * Compute ||b - A x||_2 / ||b||_2
+ * --------------------------------------------------------------------*/
+static sunrealtype RelResidual(SUNMatrix A, N_Vector x, N_Vector b)
+{
+  sunrealtype bnorm, rnorm;
+  N_Vector r = N_VClone(b);
+
+  if (r == NULL || SUNMatMatvec(A, x, r))
+  {
+    if (r) { N_VDestroy(r); }
+    return (SUN_BIG_REAL);
+  }
+  N_VLinearSum(ONE, b, -ONE, r, r);
+
+  bnorm = SUNRsqrt(N_VDotProd(b, b));
+  rnorm = SUNRsqrt(N_VDotProd(r, r));
+  N_VDestroy(r);
+
+  return (bnorm > ZERO ? rnorm / bnorm : rnorm);
+}
+
+/* ----------------------------------------------------------------------
+ * Matrix-vector product and Jacobi preconditioner
+ * --------------------------------------------------------------------*/
+static int ATimes(void* A_data, N_Vector v, N_Vector z)
+{
+  return (SUNMatMatvec((SUNMatrix)A_data, v, z));
+}
+
+static int JacobiSetup(void* P_data)
+{
+  PrecData* pdata = (PrecData*)P_data;
+  SUNMatrix A     = pdata->A;
+  sunrealtype* d  = N_VGetArrayPointer(pdata->dinv);
+  sunindextype i, j, n, np, *ptrs, *vals;
+
+  n = N_VGetLength(pdata->dinv);
+  for (i = 0; i < n; i++) { d[i] = ZERO; }
+
+  switch (SUNMatGetID(A))
+  {
+  case SUNMATRIX_DENSE:
+    for (i = 0; i < n; i++) { d[i] = SM_ELEMENT_D(A, i, i); }
+    break;
+  case SUNMATRIX_BAND:
+    for (i = 0; i < n; i++) { d[i] = SM_ELEMENT_B(A, i, i); }
+    break;
+  case SUNMATRIX_SPARSE:
+    np   = SM_NP_S(A);
+    ptrs = SM_INDEXPTRS_S(A);
+    vals = SM_INDEXVALS_S(A);
+    for (j = 0; j < np; j++)
+    {
+      for (i = ptrs[j]; i < ptrs[j + 1]; i++)
+      {
+        if (vals[i] == j) { d[j] += SM_DATA_S(A)[i]; }
+      }
+    }
+    break;
+  default: return (-1);
+  }
+
+  /* rows with a zero diagonal are not scaled */
+  for (i = 0; i < n; i++) { d[i] = (d[i] == ZERO) ? ONE : ONE / d[i]; }
+
+  return (0);
+}
+
+static int JacobiSolve(void* P_data, N_Vector r, N_Vector z, sunrealtype tol,
+                       int lr)
+{
+  PrecData* pdata = (PrecData*)P_data;
+  N_VProd(r, pdata->dinv, z);
+  return (0);
+}
+
+/* ----------------------------------------------------------------------
+ * Read the archive header and check it matches this build
+ * --------------------------------------------------------------------*/
+static int ReadHeader(FILE* fp)
+{
+  char magic[8];
+  uint32_t sizes[4];
+
+  if (fread(magic, sizeof(magic), 1, fp) != 1 ||
+      fread(sizes, sizeof(sizes), 1, fp) != 1 || memcmp(magic, "SUNLSC01", 8))
+  {
+    printf("ERROR: the file is not a linear system archive \n");
+    return (-1);
+  }
+
+  if (sizes[0] != 0x01020304 || sizes[1] != sizeof(sunrealtype) ||
+      sizes[2] != sizeof(sunindextype))
+  {
+    printf("ERROR: the archive byte order, sunrealtype, or sunindextype ");
+    printf("does not match this build \n");
+    return (-1);
+  }
+
+  return (0);
+}
+
+/* ----------------------------------------------------------------------
+ * Read a matrix record into a new SUNMatrix
+ * --------------------------------------------------------------------*/
+static int ReadMatrix(FILE* fp, SUNLinSysCaptureRecord* rec, SUNContext ctx,
+                      SUNMatrix* A)
+{
+  SUNMatrix M = NULL;
+  sunindextype j, m, n, mu, ml, nnz, np, width;
+  size_t count;
+
+  m   = (sunindextype)rec->rows;
+  n   = (sunindextype)rec->cols;
+  mu  = (sunindextype)rec->upper;
+  ml  = (sunindextype)rec->lower;
+  nnz = (sunindextype)rec->upper;
+
+  switch (rec->format)
+  {
+  case SUN_LINSYSCAPTURE_DENSE:
+    M = SUNDenseMatrix(m, n, ctx);
+    if (M == NULL) { return (-1); }
+    *A = M;
+    count = (size_t)(m * n);
+    if (fread(SM_DATA_D(M), sizeof(sunrealtype), count, fp) != count)
+    {
+      return (-1);
+    }
+    break;
+  case SUN_LINSYSCAPTURE_BAND:
+    /* storage for the LU factors as required by the band solver */
+    M = SUNBandMatrixStorage(n, mu, ml, SUNMIN(n - 1, mu + ml), ctx);
+    if (M == NULL) { return (-1); }
+    *A = M;
+    width = mu + ml + 1;
+    for (j = 0; j < n; j++)
+    {
+      if (fread(SM_COLUMN_B(M, j) - mu, sizeof(sunrealtype), width, fp) !=
+          (size_t)width)
+      {
+        return (-1);
+      }
+    }
+    break;
+  case SUN_LINSYSCAPTURE_CSC:
+  case SUN_LINSYSCAPTURE_CSR:
+    M = SUNSparseMatrix(m, n, nnz,
+                         (rec->format == SUN_LINSYSCAPTURE_CSC) ? CSC_MAT
+                                                                : CSR_MAT,
+                         ctx);
+    if (M == NULL) { return (-1); }
+    *A = M;
+    np = SM_NP_S(M);
+    if (fread(SM_INDEXPTRS_S(M), sizeof(sunindextype), np + 1, fp) !=
+          (size_t)(np + 1) ||
+        fread(SM_INDEXVALS_S(M), sizeof(sunindextype), nnz, fp) !=
+          (size_t)nnz ||
+        fread(SM_DATA_S(M), sizeof(sunrealtype), nnz, fp) != (size_t)nnz)
+    {
+      return (-1);
+    }
+    break;
+  default:
+    printf("ERROR: unknown matrix format in the archive \n");
+    return (-1);
+  }
+
+  return (0);
+}
+
+/* ----------------------------------------------------------------------
+ * Read a right-hand side record
+ * --------------------------------------------------------------------*/
+static int ReadRhs(FILE* fp, SUNLinSysCaptureRecord* rec, N_Vector b)
+{
+  size_t count = (size_t)rec->rows;
+
+  if (fread(N_VGetArrayPointer(b), sizeof(sunrealtype), count, fp) != count)
+  {
+    return (-1);
+  }
+  return (0);
+}
+
+/* ----------------------------------------------------------------------
+ * Print (and optionally save) the result of one solve
+ * --------------------------------------------------------------------*/
+static void PrintResult(SUNLinSysCaptureRecord* mrec, long int rhs,
+                        Result* res)
+{
+  int converged = (res->relres <= rtol);
+  double total  = res->setup + res->solve;
+
+  printf(FMT1, (long int)mrec->system, rhs, res->solver, res->prec, res->iters,
+         res->setup, res->solve, total, (double)res->relres,
+         converged ? "converged" : "FAILED");
+
+  if (csv_file)
+  {
+    fprintf(csv_file, "%ld,%ld,%.16e,%.16e,%ld,%s,%s,%s,%ld,%e,%e,%e,%e,%d\n",
+            (long int)mrec->system, rhs, mrec->t, mrec->value,
+            (long int)mrec->rows, format_names[mrec->format], res->solver,
+            res->prec, res->iters, res->setup, res->solve, total,
+            (double)res->relres, converged);
+  }
+}
+
+/* ----------------------------------------------------------------------
+ * Timer
+ * --------------------------------------------------------------------*/
+static double get_time(void)
+{
+  double time;
+#if defined(SUNDIALS_HAVE_POSIX_TIMERS) && defined(_POSIX_TIMERS)
+  struct timespec spec;
+  clock_gettime(CLOCK_MONOTONIC, &spec);
+  time = (double)(spec.tv_sec - base_time_tv_sec) +
+         ((double)(spec.tv_nsec) / 1E9);
+#else
+  time = 0;
+#endif
+  return time;
+}
@@ -18,14 +18,19 @@
 # where nelem is the number of elements in the vector, nvec is the nuber of
 # vectors, nsum is the number of sums, ntest is the number of tests, and timing
 # indicates if timing was enabled.
+#
+# With --csv the script instead reads the CSV files written by the linear
+# algebra benchmark (benchmarks/linalg) and compares the times of a kernel with
+# another kernel, by default the fused variant of the kernel (<op>_fused). The
+# matrix size or vector length (n) takes the place of the number of elements
+# and the bandwidth, nonzeros per row, Krylov dimension, or QR depth (param)
+# takes the place of the number of vectors.
 # -----------------------------------------------------------------------------
 
 def main():
 
     import argparse
     import os, sys
-    import shlex
-    import glob
 
     import numpy as np
     import scipy.stats as st
@@ -43,6 +48,12 @@ def main():
     parser.add_argument('datadir', type=str,
                         help='Directory where test output files are located')
 
+    parser.add_argument('--csv', dest='csv', action='store_true',
+                        help='Read the CSV output from the linear algebra benchmark')
+
+    parser.add_argument('--compare', dest='compare', type=str, default=None,
+                        help='Kernel to compare with when using --csv (default <op>_fused)')
+
     parser.add_argument('--timevelem', dest='timevelem', action='store_true',
                         help='Turn on plots for time vs number of elements')
 
@@ -69,109 +80,20 @@ def main():
         print("ERROR:",args.datadir,"does not exist")
         sys.exit()
 
-    # sort output files
-    output = sorted(glob.glob(args.datadir+'/output*.txt'))
-
-    # if (args.debug):
-    #     print("output files")
-    #     print(len(output))
-    #     for i in range(len(output)):
-    #         print(output[i])
-
-    # figure out vector sizes, number of vectors, and number of sums
-    nelem = []
-    nvec  = []
-    nsum  = []
-    ntest = []
-
-    # parse file names to get input parameters
-    for f in output:
-
-        split_fout = f.split("/")[-1]
-        split_fout = split_fout.split("_")
-
-        ne = int(split_fout[1])
-        nv = int(split_fout[2])
-        ns = int(split_fout[3])
-        nt = int(split_fout[4])
-
-        if (not ne in nelem):
-            nelem.append(ne)
-
-        if (not nv in nvec):
-            nvec.append(nv)
-
-        if (not ns in nsum):
-            nsum.append(ns)
-
-        if (not nt in ntest):
-            ntest.append(nt)
-
-    if (len(ntest) != 1):
-        print("Warning: Unequal numbers of tests")
-
-    if (args.debug):
-        print("nelem:",nelem, len(nelem))
-        print("nvec: ",nvec,  len(nvec))
-        print("nsum: ",nsum,  len(nsum))
-        print("ntest:",ntest, len(ntest))
-
-    # allocate numpy arrays for timing data
-    avg_fused  = np.zeros([len(nvec), len(nelem)])
-    sdev_fused = np.zeros([len(nvec), len(nelem)])
-
-    avg_unfused  = np.zeros([len(nvec), len(nelem)])
-    sdev_unfused = np.zeros([len(nvec), len(nelem)])
-
-    avg_ratio = np.zeros([len(nvec), len(nelem)])
-
-    # NVEC = np.zeros([len(nvec), len(nelem)])
-    # NELM = np.zeros([len(nvec), len(nelem)])
-
-    # read output files
-    for f in output:
-
-        if (args.debug):
-            print("Reading:",f)
-
-        # get test inputs from file name
-        split_fout = f.split("/")[-1]
-        split_fout = split_fout.split("_")
-
-        ne = int(split_fout[1])
-        nv = int(split_fout[2])
-        ns = int(split_fout[3])
-
-        with open(f) as fout:
-            for line in fout:
-
-                # split line into list
-                split_line = shlex.split(line)
-
-                # skip blank lines
-                if (not split_line):
-                    continue
-
-                # tests finished, stop reading file
-                if (split_line[0] == "Finished"):
-                    break
-
-                # check if the operation is the one we want and get data
-                if (args.op == split_line[0]):
-
-                    i = nvec.index(nv)
-                    j = nelem.index(ne)
-
-                    # NVEC[i][j] = nv
-                    # NELM[i][j] = ne
-
-                    avg_fused[i][j]  = float(split_line[1])
-                    sdev_fused[i][j] = float(split_line[2])
-
-                    avg_unfused[i][j]  = float(split_line[5])
-                    sdev_unfused[i][j] = float(split_line[6])
+    # read the timing data
+    if (args.csv):
+        if (args.compare is None):
+            args.compare = args.op+'_fused'
+        lbl_fused   = args.compare
+        lbl_unfused = args.op
+        data = read_csv(args)
+    else:
+        lbl_fused   = 'fused'
+        lbl_unfused = 'unfused'
+        data = read_output(args)
 
-                    avg_ratio[i][j] = avg_fused[i][j] / avg_unfused[i][j]
+    (nelem, nvec, ntest, avg_fused, sdev_fused, avg_unfused, sdev_unfused,
+     avg_ratio) = data
 
     if (args.debug):
         print(avg_fused)
@@ -215,6 +137,15 @@ def main():
     unfused_in = np.where(np.logical_and(avg_unfused < upper_fused,
                                          avg_unfused > lower_fused))
 
+    # plot positions, the NVector sweeps use log2(number of elements) and the
+    # number of vectors while the linear algebra sweeps are placed by index
+    if (args.csv):
+        xpos = lambda j: j
+        ypos = lambda i: i
+    else:
+        xpos = lambda j: np.log2(nelem[j])
+        ypos = lambda i: nvec[i]
+
     # get which numbers of vectors and elements for fused tests are in the
     # confidence interval of the unfused times
     df = np.zeros([len(fused_in[0])])
@@ -222,8 +153,8 @@ def main():
     ef = np.zeros([len(fused_in[0])])
 
     for i in range(len(fused_in[0])):
-        vf[i] = nvec[fused_in[0][i]]
-        ef[i] = np.log2(nelem[fused_in[1][i]])
+        vf[i] = ypos(fused_in[0][i])
+        ef[i] = xpos(fused_in[1][i])
         df[i] = 1
 
     if (args.debug):
@@ -237,8 +168,8 @@ def main():
     eu = np.zeros([len(unfused_in[0])])
 
     for i in range(len(unfused_in[0])):
-        vu[i] = nvec[unfused_in[0][i]]
-        eu[i] = np.log2(nelem[unfused_in[1][i]])
+        vu[i] = ypos(unfused_in[0][i])
+        eu[i] = xpos(unfused_in[1][i])
         du[i] = 1
 
     if (args.debug):
@@ -275,7 +206,10 @@ def main():
     if (args.heatmap):
 
         x = np.arange(len(nelem)+1)-0.5 # x = log2(number of elements) = 0,1,2,...
-        y = np.arange(len(nvec)+1)+1.5  # y = number of vectors = 2,3,4,...
+        if (args.csv):
+            y = np.arange(len(nvec)+1)-0.5  # y = index of param = 0,1,2,...
+        else:
+            y = np.arange(len(nvec)+1)+1.5  # y = number of vectors = 2,3,4,...
         # y = np.arange(len(nvec)+1)+0.5  # y = number of vectors = 1,2,3,...
         X, Y = np.meshgrid(x, y)
 
@@ -313,8 +247,8 @@ def main():
         clb.ax.set_title('Max = {0:.2f}\nMin = {1:.2f}'.format(rmax,rmin))
 
         # aff markers to indicate if the average time falls in a confidence interval
-        plt.scatter(ef,vf,s=40,marker='^',c=df,label='fused')
-        plt.scatter(eu,vu,s=40,marker='v',c=du,label='unfused')
+        plt.scatter(ef,vf,s=40,marker='^',c=df,label=lbl_fused)
+        plt.scatter(eu,vu,s=40,marker='v',c=du,label=lbl_unfused)
         plt.legend(loc=9, bbox_to_anchor=(0.5, -0.1), ncol=2)
 
         # add legend for scatter plot
@@ -323,11 +257,17 @@ def main():
         art.append(lgd)
 
         # add labels and title
-        plt.xticks(np.log2(nelem))
-        plt.yticks(nvec)
-        plt.xlabel('log2(num elements)')
-        plt.ylabel('num vectors')
-        plt.title('avg fused time / avg unfused time \n'+args.op)
+        if (args.csv):
+            plt.xticks(np.arange(len(nelem)), nelem)
+            plt.yticks(np.arange(len(nvec)), nvec)
+            plt.xlabel('n')
+            plt.ylabel('param')
+        else:
+            plt.xticks(np.log2(nelem))
+            plt.yticks(nvec)
+            plt.xlabel('log2(num elements)')
+            plt.ylabel('num vectors')
+        plt.title('avg '+lbl_fused+' time / avg '+lbl_unfused+' time \n'+args.op)
 
         # display or save figure
         if (args.show):
@@ -379,7 +319,7 @@ def main():
         ax.legend()
         ax.grid()
 
-        plt.title('Average Time Fused vs Unfused \n'+args.op)
+        plt.title('Average Time '+lbl_fused+' vs '+lbl_unfused+' \n'+args.op)
         plt.xlabel('vector length')
         plt.ylabel('time (s)')
 
@@ -406,14 +346,14 @@ def main():
             # plot run times
             if (args.loglog):
                 ax.loglog(nelem, avg_fused[idx],
-                          color='red', linestyle='-', label='Fused')
+                          color='red', linestyle='-', label=lbl_fused)
                 ax.loglog(nelem, avg_unfused[idx],
-                          color='blue', linestyle='--', label='Unfused')
+                          color='blue', linestyle='--', label=lbl_unfused)
             else:
                 ax.plot(nelem, avg_fused[idx],
-                        color='red', linestyle='-', label='Fused')
+                        color='red', linestyle='-', label=lbl_fused)
                 ax.plot(nelem, avg_unfused[idx],
-                        color='blue', linestyle='--', label='Unfused')
+                        color='blue', linestyle='--', label=lbl_unfused)
 
             # plot confidence intervals
             ax.fill_between(nelem, lower_fused[idx], upper_fused[idx],
@@ -424,7 +364,8 @@ def main():
             ax.legend()
             ax.grid()
 
-            plt.title('Average Time Fused vs Unfused with '+str(nv)+' vectors\n'+args.op)
+            plt.title('Average Time '+lbl_fused+' vs '+lbl_unfused+' with '+
+                      str(nv)+(' param' if args.csv else ' vectors')+'\n'+args.op)
             plt.xlabel('vector length')
             ax.set_ylabel('time (s)')
 
@@ -441,6 +382,193 @@ def main():
 
 # ===============================================================================
 
+def read_output(args):
+    """Read the timing data for an operation from the NVector benchmark output"""
+
+    import shlex
+    import glob
+
+    import numpy as np
+
+    # sort output files
+    output = sorted(glob.glob(args.datadir+'/output*.txt'))
+
+    # if (args.debug):
+    #     print("output files")
+    #     print(len(output))
+    #     for i in range(len(output)):
+    #         print(output[i])
+
+    # figure out vector sizes, number of vectors, and number of sums
+    nelem = []
+    nvec  = []
+    nsum  = []
+    ntest = []
+
+    # parse file names to get input parameters
+    for f in output:
+
+        split_fout = f.split("/")[-1]
+        split_fout = split_fout.split("_")
+
+        ne = int(split_fout[1])
+        nv = int(split_fout[2])
+        ns = int(split_fout[3])
+        nt = int(split_fout[4])
+
+        if (not ne in nelem):
+            nelem.append(ne)
+
+        if (not nv in nvec):
+            nvec.append(nv)
+
+        if (not ns in nsum):
+            nsum.append(ns)
+
+        if (not nt in ntest):
+            ntest.append(nt)
+
+    if (len(ntest) != 1):
+        print("Warning: Unequal numbers of tests")
+
+    if (args.debug):
+        print("nelem:",nelem, len(nelem))
+        print("nvec: ",nvec,  len(nvec))
+        print("nsum: ",nsum,  len(nsum))
+        print("ntest:",ntest, len(ntest))
+
+    # allocate numpy arrays for timing data
+    avg_fused  = np.zeros([len(nvec), len(nelem)])
+    sdev_fused = np.zeros([len(nvec), len(nelem)])
+
+    avg_unfused  = np.zeros([len(nvec), len(nelem)])
+    sdev_unfused = np.zeros([len(nvec), len(nelem)])
+
+    avg_ratio = np.zeros([len(nvec), len(nelem)])
+
+    # NVEC = np.zeros([len(nvec), len(nelem)])
+    # NELM = np.zeros([len(nvec), len(nelem)])
+
+    # read output files
+    for f in output:
+
+        if (args.debug):
+            print("Reading:",f)
+
+        # get test inputs from file name
+        split_fout = f.split("/")[-1]
+        split_fout = split_fout.split("_")
+
+        ne = int(split_fout[1])
+        nv = int(split_fout[2])
+        ns = int(split_fout[3])
+
+        with open(f) as fout:
+            for line in fout:
+
+                # split line into list
+                split_line = shlex.split(line)
+
+                # skip blank lines
+                if (not split_line):
+                    continue
+
+                # tests finished, stop reading file
+                if (split_line[0] == "Finished"):
+                    break
+
+                # check if the operation is the one we want and get data
+                if (args.op == split_line[0]):
+
+                    i = nvec.index(nv)
+                    j = nelem.index(ne)
+
+                    # NVEC[i][j] = nv
+                    # NELM[i][j] = ne
+
+                    avg_fused[i][j]  = float(split_line[1])
+                    sdev_fused[i][j] = float(split_line[2])
+
+                    avg_unfused[i][j]  = float(split_line[5])
+                    sdev_unfused[i][j] = float(split_line[6])
+
+                    avg_ratio[i][j] = avg_fused[i][j] / avg_unfused[i][j]
+
+    return (nelem, nvec, ntest, avg_fused, sdev_fused, avg_unfused,
+            sdev_unfused, avg_ratio)
+
+# ===============================================================================
+
+def read_csv(args):
+    """Read the timing data for two kernels from the linear algebra benchmark
+    CSV output, the kernel to compare with takes the place of the fused
+    timings and the kernel being plotted takes the place of the unfused
+    timings"""
+
+    import sys
+    import csv
+    import glob
+
+    import numpy as np
+
+    # read the rows for the two kernels from the CSV files
+    rows = []
+    for f in sorted(glob.glob(args.datadir+'/*.csv')):
+
+        if (args.debug):
+            print("Reading:",f)
+
+        with open(f) as fout:
+            for row in csv.DictReader(fout):
+                if (row['kernel'] in (args.op, args.compare)):
+                    rows.append(row)
+
+    if (not rows):
+        print("ERROR: no data for",args.op,"or",args.compare)
+        sys.exit()
+
+    # the sizes and parameters of the sweep
+    nelem = sorted(set(int(row['n']) for row in rows))
+    nvec  = sorted(set(int(row['param']) for row in rows))
+    ntest = sorted(set(int(row['ntest']) for row in rows))
+
+    if (len(ntest) != 1):
+        print("Warning: Unequal numbers of tests")
+
+    if (args.debug):
+        print("nelem:",nelem, len(nelem))
+        print("nvec: ",nvec,  len(nvec))
+        print("ntest:",ntest, len(ntest))
+
+    # allocate numpy arrays for timing data
+    avg_fused  = np.zeros([len(nvec), len(nelem)])
+    sdev_fused = np.zeros([len(nvec), len(nelem)])
+
+    avg_unfused  = np.zeros([len(nvec), len(nelem)])
+    sdev_unfused = np.zeros([len(nvec), len(nelem)])
+
+    for row in rows:
+
+        i = nvec.index(int(row['param']))
+        j = nelem.index(int(row['n']))
+
+        if (row['kernel'] == args.compare):
+            avg_fused[i][j]  = float(row['avg'])
+            sdev_fused[i][j] = float(row['sdev'])
+        else:
+            avg_unfused[i][j]  = float(row['avg'])
+            sdev_unfused[i][j] = float(row['sdev'])
+
+    # sizes where only one of the kernels was run have a ratio of zero
+    avg_ratio = np.divide(avg_fused, avg_unfused,
+                          out=np.zeros_like(avg_fused),
+                          where=avg_unfused > 0)
+
+    return (nelem, nvec, ntest, avg_fused, sdev_fused, avg_unfused,
+            sdev_unfused, avg_ratio)
+
+# ===============================================================================
+
 if __name__ == "__main__":
     main()
 
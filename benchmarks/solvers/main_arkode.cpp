@@ -0,0 +1,159 @@
+/* -----------------------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * ARKODE main for the solver benchmark suite. Stiff problems use the default
+ * DIRK method in ARKStep with each applicable linear solver, nonstiff problems
+ * use the default ERK method in ARKStep and, for separable Hamiltonian
+ * problems, a fourth order symplectic method in SPRKStep with a fixed step
+ * size chosen from the tolerance.
+ * ---------------------------------------------------------------------------*/
+
+#include "arkode/arkode_arkstep.h"
+#include "arkode/arkode_sprkstep.h"
+#include "solvers.hpp"
+
+static vector<pair<string, string>> arkode_configs(const Problem& prob)
+{
+  vector<pair<string, string>> configs;
+  if (prob.stiff)
+  {
+    for (auto& ls : problem_linsols(prob)) { configs.push_back({"DIRK", ls}); }
+  }
+  else
+  {
+    configs.push_back({"ERK", "none"});
+    if (prob.rhs1 && prob.rhs2) { configs.push_back({"SPRK", "none"}); }
+  }
+  return configs;
+}
+
+static int arkode_solve(SUNContext ctx, const Problem& prob,
+                        const UserOptions& opts, const string& method,
+                        const string& linsol, sunrealtype rtol, N_Vector y,
+                        Result& res)
+{
+  int flag;
+  void* arkode_mem   = nullptr;
+  SUNMatrix A        = nullptr;
+  SUNLinearSolver LS = nullptr;
+  sunrealtype tret   = prob.t0;
+
+  prob.initial(prob, N_VGetArrayPointer(y));
+
+  if (method == "DIRK")
+  {
+    arkode_mem = ARKStepCreate(nullptr, prob.rhs, prob.t0, y, ctx);
+    if (check_flag((void*)arkode_mem, "ARKStepCreate", 0)) { return 1; }
+  }
+  else if (method == "ERK")
+  {
+    arkode_mem = ARKStepCreate(prob.rhs, nullptr, prob.t0, y, ctx);
+    if (check_flag((void*)arkode_mem, "ARKStepCreate", 0)) { return 1; }
+  }
+  else
+  {
+    arkode_mem = SPRKStepCreate(prob.rhs1, prob.rhs2, prob.t0, y, ctx);
+    if (check_flag((void*)arkode_mem, "SPRKStepCreate", 0)) { return 1; }
+
+    flag = SPRKStepSetMethodName(arkode_mem, "ARKODE_SPRK_MCLACHLAN_4_4");
+    if (check_flag(&flag, "SPRKStepSetMethodName", 1)) { return 1; }
+
+    // Map the tolerance to a step size for the fourth order method
+    res.dt = HALF * pow(rtol, SUN_RCONST(0.25));
+
+    flag = ARKodeSetFixedStep(arkode_mem, res.dt);
+    if (check_flag(&flag, "ARKodeSetFixedStep", 1)) { return 1; }
+
+    flag = ARKodeSetStopTime(arkode_mem, prob.tf);
+    if (check_flag(&flag, "ARKodeSetStopTime", 1)) { return 1; }
+  }
+
+  if (method != "SPRK")
+  {
+    flag = ARKodeSStolerances(arkode_mem, rtol, rtol * prob.atol);
+    if (check_flag(&flag, "ARKodeSStolerances", 1)) { return 1; }
+    res.atol = rtol * prob.atol;
+  }
+
+  flag = ARKodeSetUserData(arkode_mem, const_cast<Problem*>(&prob));
+  if (check_flag(&flag, "ARKodeSetUserData", 1)) { return 1; }
+
+  flag = ARKodeSetMaxNumSteps(arkode_mem, 1000000);
+  if (check_flag(&flag, "ARKodeSetMaxNumSteps", 1)) { return 1; }
+
+  if (method == "DIRK")
+  {
+    flag = create_linsol(prob, linsol, y, ctx, &A, &LS);
+    if (flag) { return 1; }
+
+    flag = ARKodeSetLinearSolver(arkode_mem, LS, A);
+    if (check_flag(&flag, "ARKodeSetLinearSolver", 1)) { return 1; }
+  }
+
+  double start  = get_time();
+  res.status    = ARKodeEvolve(arkode_mem, prob.tf, y, &tret, ARK_NORMAL);
+  res.wall_time = get_time() - start;
+
+  long int nf1 = 0, nf2 = 0, nfeLS = 0;
+
+  flag = ARKodeGetNumSteps(arkode_mem, &res.steps);
+  if (check_flag(&flag, "ARKodeGetNumSteps", 1)) { return 1; }
+
+  if (method == "SPRK")
+  {
+    flag = SPRKStepGetNumRhsEvals(arkode_mem, &nf1, &nf2);
+    if (check_flag(&flag, "SPRKStepGetNumRhsEvals", 1)) { return 1; }
+  }
+  else
+  {
+    flag = ARKStepGetNumRhsEvals(arkode_mem, &nf1, &nf2);
+    if (check_flag(&flag, "ARKStepGetNumRhsEvals", 1)) { return 1; }
+
+    flag = ARKodeGetNumErrTestFails(arkode_mem, &res.err_test_fails);
+    if (check_flag(&flag, "ARKodeGetNumErrTestFails", 1)) { return 1; }
+  }
+
+  if (method == "DIRK")
+  {
+    flag = ARKodeGetNumNonlinSolvIters(arkode_mem, &res.nonlin_iters);
+    if (check_flag(&flag, "ARKodeGetNumNonlinSolvIters", 1)) { return 1; }
+
+    flag = ARKodeGetNumNonlinSolvConvFails(arkode_mem, &res.nonlin_fails);
+    if (check_flag(&flag, "ARKodeGetNumNonlinSolvConvFails", 1)) { return 1; }
+
+    flag = ARKodeGetNumLinSolvSetups(arkode_mem, &res.lin_setups);
+    if (check_flag(&flag, "ARKodeGetNumLinSolvSetups", 1)) { return 1; }
+
+    flag = ARKodeGetNumJacEvals(arkode_mem, &res.jac_evals);
+    if (check_flag(&flag, "ARKodeGetNumJacEvals", 1)) { return 1; }
+
+    flag = ARKodeGetNumLinIters(arkode_mem, &res.lin_iters);
+    if (check_flag(&flag, "ARKodeGetNumLinIters", 1)) { return 1; }
+
+    flag = ARKodeGetNumLinRhsEvals(arkode_mem, &nfeLS);
+    if (check_flag(&flag, "ARKodeGetNumLinRhsEvals", 1)) { return 1; }
+  }
+
+  res.rhs_evals = nf1 + nf2 + nfeLS;
+
+  ARKodeFree(&arkode_mem);
+  SUNLinSolFree(LS);
+  SUNMatDestroy(A);
+
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  return run_benchmarks("arkode", argc, argv, arkode_configs, arkode_solve);
+}
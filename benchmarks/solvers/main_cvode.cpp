@@ -0,0 +1,133 @@
+/* -----------------------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * CVODE main for the solver benchmark suite. Stiff problems use BDF methods
+ * with each applicable linear solver, nonstiff problems use Adams methods with
+ * a fixed-point or Newton iteration.
+ * ---------------------------------------------------------------------------*/
+
+#include "cvode/cvode.h"
+#include "solvers.hpp"
+#include "sunnonlinsol/sunnonlinsol_fixedpoint.h"
+
+static vector<pair<string, string>> cvode_configs(const Problem& prob)
+{
+  vector<pair<string, string>> configs;
+  if (prob.stiff)
+  {
+    for (auto& ls : problem_linsols(prob)) { configs.push_back({"BDF", ls}); }
+  }
+  else
+  {
+    configs.push_back({"Adams", "none"});
+    configs.push_back({"Adams", "dense"});
+  }
+  return configs;
+}
+
+static int cvode_solve(SUNContext ctx, const Problem& prob,
+                       const UserOptions& opts, const string& method,
+                       const string& linsol, sunrealtype rtol, N_Vector y,
+                       Result& res)
+{
+  int flag;
+  SUNMatrix A            = nullptr;
+  SUNLinearSolver LS     = nullptr;
+  SUNNonlinearSolver NLS = nullptr;
+  sunrealtype tret       = prob.t0;
+
+  prob.initial(prob, N_VGetArrayPointer(y));
+
+  void* cvode_mem = CVodeCreate((method == "BDF") ? CV_BDF : CV_ADAMS, ctx);
+  if (check_flag((void*)cvode_mem, "CVodeCreate", 0)) { return 1; }
+
+  flag = CVodeInit(cvode_mem, prob.rhs, prob.t0, y);
+  if (check_flag(&flag, "CVodeInit", 1)) { return 1; }
+
+  flag = CVodeSStolerances(cvode_mem, rtol, rtol * prob.atol);
+  if (check_flag(&flag, "CVodeSStolerances", 1)) { return 1; }
+
+  flag = CVodeSetUserData(cvode_mem, const_cast<Problem*>(&prob));
+  if (check_flag(&flag, "CVodeSetUserData", 1)) { return 1; }
+
+  flag = CVodeSetMaxNumSteps(cvode_mem, 100000);
+  if (check_flag(&flag, "CVodeSetMaxNumSteps", 1)) { return 1; }
+
+  if (linsol == "none")
+  {
+    NLS = SUNNonlinSol_FixedPoint(y, 0, ctx);
+    if (check_flag((void*)NLS, "SUNNonlinSol_FixedPoint", 0)) { return 1; }
+
+    flag = CVodeSetNonlinearSolver(cvode_mem, NLS);
+    if (check_flag(&flag, "CVodeSetNonlinearSolver", 1)) { return 1; }
+  }
+  else
+  {
+    flag = create_linsol(prob, linsol, y, ctx, &A, &LS);
+    if (flag) { return 1; }
+
+    flag = CVodeSetLinearSolver(cvode_mem, LS, A);
+    if (check_flag(&flag, "CVodeSetLinearSolver", 1)) { return 1; }
+  }
+
+  double start  = get_time();
+  res.status    = CVode(cvode_mem, prob.tf, y, &tret, CV_NORMAL);
+  res.wall_time = get_time() - start;
+
+  long int nfe = 0, nfeLS = 0;
+  res.atol     = rtol * prob.atol;
+
+  flag = CVodeGetNumSteps(cvode_mem, &res.steps);
+  if (check_flag(&flag, "CVodeGetNumSteps", 1)) { return 1; }
+
+  flag = CVodeGetNumRhsEvals(cvode_mem, &nfe);
+  if (check_flag(&flag, "CVodeGetNumRhsEvals", 1)) { return 1; }
+
+  flag = CVodeGetNumErrTestFails(cvode_mem, &res.err_test_fails);
+  if (check_flag(&flag, "CVodeGetNumErrTestFails", 1)) { return 1; }
+
+  flag = CVodeGetNumNonlinSolvIters(cvode_mem, &res.nonlin_iters);
+  if (check_flag(&flag, "CVodeGetNumNonlinSolvIters", 1)) { return 1; }
+
+  flag = CVodeGetNumNonlinSolvConvFails(cvode_mem, &res.nonlin_fails);
+  if (check_flag(&flag, "CVodeGetNumNonlinSolvConvFails", 1)) { return 1; }
+
+  if (LS)
+  {
+    flag = CVodeGetNumLinSolvSetups(cvode_mem, &res.lin_setups);
+    if (check_flag(&flag, "CVodeGetNumLinSolvSetups", 1)) { return 1; }
+
+    flag = CVodeGetNumJacEvals(cvode_mem, &res.jac_evals);
+    if (check_flag(&flag, "CVodeGetNumJacEvals", 1)) { return 1; }
+
+    flag = CVodeGetNumLinIters(cvode_mem, &res.lin_iters);
+    if (check_flag(&flag, "CVodeGetNumLinIters", 1)) { return 1; }
+
+    flag = CVodeGetNumLinRhsEvals(cvode_mem, &nfeLS);
+    if (check_flag(&flag, "CVodeGetNumLinRhsEvals", 1)) { return 1; }
+  }
+
+  res.rhs_evals = nfe + nfeLS;
+
+  CVodeFree(&cvode_mem);
+  SUNNonlinSolFree(NLS);
+  SUNLinSolFree(LS);
+  SUNMatDestroy(A);
+
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  return run_benchmarks("cvode", argc, argv, cvode_configs, cvode_solve);
+}
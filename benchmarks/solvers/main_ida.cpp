@@ -0,0 +1,145 @@
+/* -----------------------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * IDA main for the solver benchmark suite. The ODEs are solved in implicit
+ * form, F(t,y,y') = y' - f(t,y) = 0, with each applicable linear solver.
+ * ---------------------------------------------------------------------------*/
+
+#include "ida/ida.h"
+#include "solvers.hpp"
+
+// Residual function user data
+struct ResData
+{
+  const Problem* prob = nullptr;
+  N_Vector f          = nullptr;
+};
+
+static int residual(sunrealtype t, N_Vector y, N_Vector yp, N_Vector r,
+                    void* user_data)
+{
+  ResData* data = static_cast<ResData*>(user_data);
+
+  int flag = data->prob->rhs(t, y, data->f, const_cast<Problem*>(data->prob));
+  if (flag) { return flag; }
+
+  N_VLinearSum(ONE, yp, -ONE, data->f, r);
+
+  return 0;
+}
+
+static vector<pair<string, string>> ida_configs(const Problem& prob)
+{
+  vector<pair<string, string>> configs;
+  if (prob.stiff)
+  {
+    for (auto& ls : problem_linsols(prob)) { configs.push_back({"BDF", ls}); }
+  }
+  else { configs.push_back({"BDF", "dense"}); }
+  return configs;
+}
+
+static int ida_solve(SUNContext ctx, const Problem& prob,
+                     const UserOptions& opts, const string& method,
+                     const string& linsol, sunrealtype rtol, N_Vector y,
+                     Result& res)
+{
+  int flag;
+  SUNMatrix A        = nullptr;
+  SUNLinearSolver LS = nullptr;
+  sunrealtype tret   = prob.t0;
+  ResData data;
+
+  prob.initial(prob, N_VGetArrayPointer(y));
+
+  // Consistent initial derivative, y'(t0) = f(t0, y0)
+  N_Vector yp = N_VClone(y);
+  if (check_flag((void*)yp, "N_VClone", 0)) { return 1; }
+
+  data.prob = &prob;
+  data.f    = N_VClone(y);
+  if (check_flag((void*)data.f, "N_VClone", 0)) { return 1; }
+
+  flag = prob.rhs(prob.t0, y, yp, const_cast<Problem*>(&prob));
+  if (check_flag(&flag, "rhs", 1)) { return 1; }
+
+  void* ida_mem = IDACreate(ctx);
+  if (check_flag((void*)ida_mem, "IDACreate", 0)) { return 1; }
+
+  flag = IDAInit(ida_mem, residual, prob.t0, y, yp);
+  if (check_flag(&flag, "IDAInit", 1)) { return 1; }
+
+  flag = IDASStolerances(ida_mem, rtol, rtol * prob.atol);
+  if (check_flag(&flag, "IDASStolerances", 1)) { return 1; }
+
+  flag = IDASetUserData(ida_mem, &data);
+  if (check_flag(&flag, "IDASetUserData", 1)) { return 1; }
+
+  flag = IDASetMaxNumSteps(ida_mem, 100000);
+  if (check_flag(&flag, "IDASetMaxNumSteps", 1)) { return 1; }
+
+  flag = create_linsol(prob, linsol, y, ctx, &A, &LS);
+  if (flag) { return 1; }
+
+  flag = IDASetLinearSolver(ida_mem, LS, A);
+  if (check_flag(&flag, "IDASetLinearSolver", 1)) { return 1; }
+
+  double start  = get_time();
+  res.status    = IDASolve(ida_mem, prob.tf, &tret, y, yp, IDA_NORMAL);
+  res.wall_time = get_time() - start;
+
+  long int nre = 0, nreLS = 0;
+  res.atol     = rtol * prob.atol;
+
+  flag = IDAGetNumSteps(ida_mem, &res.steps);
+  if (check_flag(&flag, "IDAGetNumSteps", 1)) { return 1; }
+
+  flag = IDAGetNumResEvals(ida_mem, &nre);
+  if (check_flag(&flag, "IDAGetNumResEvals", 1)) { return 1; }
+
+  flag = IDAGetNumErrTestFails(ida_mem, &res.err_test_fails);
+  if (check_flag(&flag, "IDAGetNumErrTestFails", 1)) { return 1; }
+
+  flag = IDAGetNumNonlinSolvIters(ida_mem, &res.nonlin_iters);
+  if (check_flag(&flag, "IDAGetNumNonlinSolvIters", 1)) { return 1; }
+
+  flag = IDAGetNumNonlinSolvConvFails(ida_mem, &res.nonlin_fails);
+  if (check_flag(&flag, "IDAGetNumNonlinSolvConvFails", 1)) { return 1; }
+
+  flag = IDAGetNumLinSolvSetups(ida_mem, &res.lin_setups);
+  if (check_flag(&flag, "IDAGetNumLinSolvSetups", 1)) { return 1; }
+
+  flag = IDAGetNumJacEvals(ida_mem, &res.jac_evals);
+  if (check_flag(&flag, "IDAGetNumJacEvals", 1)) { return 1; }
+
+  flag = IDAGetNumLinIters(ida_mem, &res.lin_iters);
+  if (check_flag(&flag, "IDAGetNumLinIters", 1)) { return 1; }
+
+  flag = IDAGetNumLinResEvals(ida_mem, &nreLS);
+  if (check_flag(&flag, "IDAGetNumLinResEvals", 1)) { return 1; }
+
+  res.rhs_evals = nre + nreLS;
+
+  IDAFree(&ida_mem);
+  SUNLinSolFree(LS);
+  SUNMatDestroy(A);
+  N_VDestroy(yp);
+  N_VDestroy(data.f);
+
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  return run_benchmarks("ida", argc, argv, ida_configs, ida_solve);
+}
@@ -0,0 +1,166 @@
+/* -----------------------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * KINSOL main for the solver benchmark suite. The stiff problems are evolved
+ * with a fixed number of implicit Euler steps and KINSOL solves the nonlinear
+ * system in each step,
+ *
+ *   G(y) = y - y_old - h f(t, y) = 0,
+ *
+ * using a Newton method with a line search and each applicable linear solver.
+ * The tolerance sets the function norm stopping tolerance.
+ * ---------------------------------------------------------------------------*/
+
+#include "kinsol/kinsol.h"
+#include "solvers.hpp"
+
+// Nonlinear system user data
+struct SysData
+{
+  const Problem* prob = nullptr;
+  N_Vector yold       = nullptr;
+  N_Vector f          = nullptr;
+  sunrealtype t       = ZERO;
+  sunrealtype h       = ZERO;
+};
+
+static int implicit_euler(N_Vector y, N_Vector g, void* user_data)
+{
+  SysData* data = static_cast<SysData*>(user_data);
+
+  int flag = data->prob->rhs(data->t, y, data->f,
+                             const_cast<Problem*>(data->prob));
+  if (flag) { return flag; }
+
+  N_VLinearSum(ONE, y, -ONE, data->yold, g);
+  N_VLinearSum(ONE, g, -data->h, data->f, g);
+
+  return 0;
+}
+
+static vector<pair<string, string>> kinsol_configs(const Problem& prob)
+{
+  vector<pair<string, string>> configs;
+
+  // Fixed step implicit Euler systems for the Van der Pol oscillator have no
+  // solution near the previous step at the folds of the slow manifold
+  if (prob.stiff && prob.name != "vanderpol")
+  {
+    for (auto& ls : problem_linsols(prob))
+    {
+      configs.push_back({"Newton", ls});
+    }
+  }
+  return configs;
+}
+
+static int kinsol_solve(SUNContext ctx, const Problem& prob,
+                        const UserOptions& opts, const string& method,
+                        const string& linsol, sunrealtype rtol, N_Vector y,
+                        Result& res)
+{
+  int flag;
+  SUNMatrix A        = nullptr;
+  SUNLinearSolver LS = nullptr;
+  SysData data;
+
+  prob.initial(prob, N_VGetArrayPointer(y));
+
+  data.prob = &prob;
+  data.h    = (prob.tf - prob.t0) / opts.kin_steps;
+
+  data.yold = N_VClone(y);
+  if (check_flag((void*)data.yold, "N_VClone", 0)) { return 1; }
+
+  data.f = N_VClone(y);
+  if (check_flag((void*)data.f, "N_VClone", 0)) { return 1; }
+
+  N_Vector scale = N_VClone(y);
+  if (check_flag((void*)scale, "N_VClone", 0)) { return 1; }
+  N_VConst(ONE, scale);
+
+  void* kin_mem = KINCreate(ctx);
+  if (check_flag((void*)kin_mem, "KINCreate", 0)) { return 1; }
+
+  flag = KINInit(kin_mem, implicit_euler, y);
+  if (check_flag(&flag, "KINInit", 1)) { return 1; }
+
+  flag = KINSetUserData(kin_mem, &data);
+  if (check_flag(&flag, "KINSetUserData", 1)) { return 1; }
+
+  flag = KINSetFuncNormTol(kin_mem, rtol);
+  if (check_flag(&flag, "KINSetFuncNormTol", 1)) { return 1; }
+
+  // Update the Jacobian every iteration (exact Newton)
+  flag = KINSetMaxSetupCalls(kin_mem, 1);
+  if (check_flag(&flag, "KINSetMaxSetupCalls", 1)) { return 1; }
+
+  flag = create_linsol(prob, linsol, y, ctx, &A, &LS);
+  if (flag) { return 1; }
+
+  flag = KINSetLinearSolver(kin_mem, LS, A);
+  if (check_flag(&flag, "KINSetLinearSolver", 1)) { return 1; }
+
+  // The KINSOL counters are reset by each call to KINSol
+  res.steps     = opts.kin_steps;
+  res.dt        = data.h;
+  res.wall_time = 0.0;
+
+  for (int step = 0; step < opts.kin_steps; step++)
+  {
+    long int nni = 0, nfe = 0, nje = 0, nli = 0, nfeLS = 0;
+
+    N_VScale(ONE, y, data.yold);
+    data.t = prob.t0 + (step + 1) * data.h;
+
+    double start = get_time();
+    res.status   = KINSol(kin_mem, y, KIN_LINESEARCH, scale, scale);
+    res.wall_time += get_time() - start;
+
+    flag = KINGetNumNonlinSolvIters(kin_mem, &nni);
+    if (check_flag(&flag, "KINGetNumNonlinSolvIters", 1)) { return 1; }
+
+    flag = KINGetNumFuncEvals(kin_mem, &nfe);
+    if (check_flag(&flag, "KINGetNumFuncEvals", 1)) { return 1; }
+
+    flag = KINGetNumJacEvals(kin_mem, &nje);
+    if (check_flag(&flag, "KINGetNumJacEvals", 1)) { return 1; }
+
+    flag = KINGetNumLinIters(kin_mem, &nli);
+    if (check_flag(&flag, "KINGetNumLinIters", 1)) { return 1; }
+
+    flag = KINGetNumLinFuncEvals(kin_mem, &nfeLS);
+    if (check_flag(&flag, "KINGetNumLinFuncEvals", 1)) { return 1; }
+
+    res.nonlin_iters += nni;
+    res.rhs_evals += nfe + nfeLS;
+    res.jac_evals += nje;
+    res.lin_iters += nli;
+
+    if (res.status < 0) { break; }
+  }
+
+  KINFree(&kin_mem);
+  SUNLinSolFree(LS);
+  SUNMatDestroy(A);
+  N_VDestroy(scale);
+  N_VDestroy(data.yold);
+  N_VDestroy(data.f);
+
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  return run_benchmarks("kinsol", argc, argv, kinsol_configs, kinsol_solve);
+}
@@ -0,0 +1,440 @@
+/* -----------------------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Test problems for the solver benchmark suite. Unless otherwise noted the
+ * problems are from the IVP test set and
+ *
+ *   E. Hairer and G. Wanner, Solving Ordinary Differential Equations II,
+ *   Stiff and Differential-Algebraic Problems, Springer, 1996.
+ * ---------------------------------------------------------------------------*/
+
+#include "solvers.hpp"
+
+// -----------------------------------------------------------------------------
+// Robertson chemical kinetics
+// -----------------------------------------------------------------------------
+
+static void robertson_init(const Problem& prob, sunrealtype* y)
+{
+  y[0] = ONE;
+  y[1] = ZERO;
+  y[2] = ZERO;
+}
+
+static int robertson_rhs(sunrealtype t, N_Vector yvec, N_Vector fvec,
+                         void* user_data)
+{
+  sunrealtype* y = N_VGetArrayPointer(yvec);
+  sunrealtype* f = N_VGetArrayPointer(fvec);
+
+  const sunrealtype r1 = SUN_RCONST(0.04) * y[0];
+  const sunrealtype r2 = SUN_RCONST(1.0e4) * y[1] * y[2];
+  const sunrealtype r3 = SUN_RCONST(3.0e7) * y[1] * y[1];
+
+  f[0] = -r1 + r2;
+  f[1] = r1 - r2 - r3;
+  f[2] = r3;
+
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+// HIRES, high irradiance response of photomorphogenesis
+// -----------------------------------------------------------------------------
+
+static void hires_init(const Problem& prob, sunrealtype* y)
+{
+  for (sunindextype i = 0; i < prob.neq; i++) { y[i] = ZERO; }
+  y[0] = ONE;
+  y[7] = SUN_RCONST(0.0057);
+}
+
+static int hires_rhs(sunrealtype t, N_Vector yvec, N_Vector fvec,
+                     void* user_data)
+{
+  sunrealtype* y = N_VGetArrayPointer(yvec);
+  sunrealtype* f = N_VGetArrayPointer(fvec);
+
+  const sunrealtype r = SUN_RCONST(280.0) * y[5] * y[7];
+
+  f[0] = SUN_RCONST(-1.71) * y[0] + SUN_RCONST(0.43) * y[1] +
+         SUN_RCONST(8.32) * y[2] + SUN_RCONST(0.0007);
+  f[1] = SUN_RCONST(1.71) * y[0] - SUN_RCONST(8.75) * y[1];
+  f[2] = SUN_RCONST(-10.03) * y[2] + SUN_RCONST(0.43) * y[3] +
+         SUN_RCONST(0.035) * y[4];
+  f[3] = SUN_RCONST(8.32) * y[1] + SUN_RCONST(1.71) * y[2] -
+         SUN_RCONST(1.12) * y[3];
+  f[4] = SUN_RCONST(-1.745) * y[4] + SUN_RCONST(0.43) * y[5] +
+         SUN_RCONST(0.43) * y[6];
+  f[5] = -r + SUN_RCONST(0.69) * y[3] + SUN_RCONST(1.71) * y[4] -
+         SUN_RCONST(0.43) * y[5] + SUN_RCONST(0.69) * y[6];
+  f[6] = r - SUN_RCONST(1.81) * y[6];
+  f[7] = -f[6];
+
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+// Pollution, air pollution model from the Dutch National Institute of Public
+// Health and Environmental Protection
+// -----------------------------------------------------------------------------
+
+static void pollution_init(const Problem& prob, sunrealtype* y)
+{
+  for (sunindextype i = 0; i < prob.neq; i++) { y[i] = ZERO; }
+  y[1]  = SUN_RCONST(0.2);
+  y[3]  = SUN_RCONST(0.04);
+  y[6]  = SUN_RCONST(0.1);
+  y[7]  = SUN_RCONST(0.3);
+  y[8]  = SUN_RCONST(0.01);
+  y[16] = SUN_RCONST(0.007);
+}
+
+static int pollution_rhs(sunrealtype t, N_Vector yvec, N_Vector fvec,
+                         void* user_data)
+{
+  sunrealtype* y = N_VGetArrayPointer(yvec);
+  sunrealtype* f = N_VGetArrayPointer(fvec);
+
+  static const sunrealtype k[25] =
+    {SUN_RCONST(0.35),    SUN_RCONST(0.266e2), SUN_RCONST(0.123e5),
+     SUN_RCONST(0.86e-3), SUN_RCONST(0.82e-3), SUN_RCONST(0.15e5),
+     SUN_RCONST(0.13e-3), SUN_RCONST(0.24e5),  SUN_RCONST(0.165e5),
+     SUN_RCONST(0.9e4),   SUN_RCONST(0.22e-1), SUN_RCONST(0.12e5),
+     SUN_RCONST(0.188e1), SUN_RCONST(0.163e5), SUN_RCONST(0.48e7),
+     SUN_RCONST(0.35e-3), SUN_RCONST(0.175e-1), SUN_RCONST(0.1e9),
+     SUN_RCONST(0.444e12), SUN_RCONST(0.124e4), SUN_RCONST(0.21e1),
+     SUN_RCONST(0.578e1), SUN_RCONST(0.474e-1), SUN_RCONST(0.178e4),
+     SUN_RCONST(0.312e1)};
+
+  const sunrealtype r1  = k[0] * y[0];
+  const sunrealtype r2  = k[1] * y[1] * y[3];
+  const sunrealtype r3  = k[2] * y[4] * y[1];
+  const sunrealtype r4  = k[3] * y[6];
+  const sunrealtype r5  = k[4] * y[6];
+  const sunrealtype r6  = k[5] * y[6] * y[5];
+  const sunrealtype r7  = k[6] * y[8];
+  const sunrealtype r8  = k[7] * y[8] * y[5];
+  const sunrealtype r9  = k[8] * y[10] * y[1];
+  const sunrealtype r10 = k[9] * y[10] * y[0];
+  const sunrealtype r11 = k[10] * y[12];
+  const sunrealtype r12 = k[11] * y[9] * y[1];
+  const sunrealtype r13 = k[12] * y[13];
+  const sunrealtype r14 = k[13] * y[0] * y[5];
+  const sunrealtype r15 = k[14] * y[2];
+  const sunrealtype r16 = k[15] * y[3];
+  const sunrealtype r17 = k[16] * y[3];
+  const sunrealtype r18 = k[17] * y[15];
+  const sunrealtype r19 = k[18] * y[15];
+  const sunrealtype r20 = k[19] * y[16] * y[5];
+  const sunrealtype r21 = k[20] * y[18];
+  const sunrealtype r22 = k[21] * y[18];
+  const sunrealtype r23 = k[22] * y[0] * y[3];
+  const sunrealtype r24 = k[23] * y[18] * y[0];
+  const sunrealtype r25 = k[24] * y[19];
+
+  f[0]  = -r1 - r10 - r14 - r23 - r24 + r2 + r3 + r9 + r11 + r12 + r22 +
+          r25;
+  f[1]  = -r2 - r3 - r9 - r12 + r1 + r21;
+  f[2]  = -r15 + r1 + r17 + r19 + r22;
+  f[3]  = -r2 - r16 - r17 - r23 + r15;
+  f[4]  = -r3 + TWO * r4 + r6 + r7 + r13 + r20;
+  f[5]  = -r6 - r8 - r14 - r20 + r3 + TWO * r18;
+  f[6]  = -r4 - r5 - r6 + r13;
+  f[7]  = r4 + r5 + r6 + r7;
+  f[8]  = -r7 - r8;
+  f[9]  = -r12 + r7 + r9;
+  f[10] = -r9 - r10 + r8 + r11;
+  f[11] = r9;
+  f[12] = -r11 + r10;
+  f[13] = -r13 + r12;
+  f[14] = r14;
+  f[15] = -r18 - r19 + r16;
+  f[16] = -r20;
+  f[17] = r20;
+  f[18] = -r21 - r22 - r24 + r23 + r25;
+  f[19] = -r25 + r24;
+
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+// Van der Pol oscillator in the stiff scaling with epsilon = 1e-6
+// -----------------------------------------------------------------------------
+
+static void vanderpol_init(const Problem& prob, sunrealtype* y)
+{
+  y[0] = TWO;
+  y[1] = ZERO;
+}
+
+static int vanderpol_rhs(sunrealtype t, N_Vector yvec, N_Vector fvec,
+                         void* user_data)
+{
+  sunrealtype* y        = N_VGetArrayPointer(yvec);
+  sunrealtype* f        = N_VGetArrayPointer(fvec);
+  const sunrealtype eps = SUN_RCONST(1.0e-6);
+
+  f[0] = y[1];
+  f[1] = ((ONE - y[0] * y[0]) * y[1] - y[0]) / eps;
+
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+// Brusselator 1D, reaction-diffusion with Dirichlet boundary conditions. The
+// u and v components are interleaved so the Jacobian has bandwidth 2.
+// -----------------------------------------------------------------------------
+
+static void brusselator1D_init(const Problem& prob, sunrealtype* y)
+{
+  const sunrealtype dx = ONE / (prob.nx + 1);
+  for (int i = 0; i < prob.nx; i++)
+  {
+    const sunrealtype x = (i + 1) * dx;
+    y[2 * i]            = ONE + sin(TWO * PI * x);
+    y[2 * i + 1]        = SUN_RCONST(3.0);
+  }
+}
+
+static int brusselator1D_rhs(sunrealtype t, N_Vector yvec, N_Vector fvec,
+                             void* user_data)
+{
+  const Problem* prob = static_cast<const Problem*>(user_data);
+  sunrealtype* y      = N_VGetArrayPointer(yvec);
+  sunrealtype* f      = N_VGetArrayPointer(fvec);
+
+  const int nx          = prob->nx;
+  const sunrealtype dx  = ONE / (nx + 1);
+  const sunrealtype c   = SUN_RCONST(0.02) / (dx * dx);
+  const sunrealtype ubc = ONE;
+  const sunrealtype vbc = SUN_RCONST(3.0);
+
+  for (int i = 0; i < nx; i++)
+  {
+    const sunrealtype u  = y[2 * i];
+    const sunrealtype v  = y[2 * i + 1];
+    const sunrealtype ul = (i > 0) ? y[2 * (i - 1)] : ubc;
+    const sunrealtype vl = (i > 0) ? y[2 * (i - 1) + 1] : vbc;
+    const sunrealtype ur = (i < nx - 1) ? y[2 * (i + 1)] : ubc;
+    const sunrealtype vr = (i < nx - 1) ? y[2 * (i + 1) + 1] : vbc;
+
+    f[2 * i] = ONE + u * u * v - SUN_RCONST(4.0) * u + c * (ul - TWO * u + ur);
+    f[2 * i + 1] = SUN_RCONST(3.0) * u - u * u * v + c * (vl - TWO * v + vr);
+  }
+
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+// Brusselator 2D, reaction-diffusion on the unit square with homogeneous
+// Neumann boundary conditions. The u and v components are interleaved and
+// ordered by rows so the Jacobian has bandwidth 2 nx.
+// -----------------------------------------------------------------------------
+
+static void brusselator2D_init(const Problem& prob, sunrealtype* y)
+{
+  const int nx         = prob.nx;
+  const sunrealtype dx = ONE / (nx - 1);
+  for (int j = 0; j < nx; j++)
+  {
+    for (int i = 0; i < nx; i++)
+    {
+      const sunrealtype x     = i * dx;
+      const sunrealtype yc    = j * dx;
+      y[2 * (j * nx + i)]     = SUN_RCONST(22.0) * yc * pow(ONE - yc, 1.5);
+      y[2 * (j * nx + i) + 1] = SUN_RCONST(27.0) * x * pow(ONE - x, 1.5);
+    }
+  }
+}
+
+static int brusselator2D_rhs(sunrealtype t, N_Vector yvec, N_Vector fvec,
+                             void* user_data)
+{
+  const Problem* prob = static_cast<const Problem*>(user_data);
+  sunrealtype* y      = N_VGetArrayPointer(yvec);
+  sunrealtype* f      = N_VGetArrayPointer(fvec);
+
+  const int nx         = prob->nx;
+  const sunrealtype dx = ONE / (nx - 1);
+  const sunrealtype c  = SUN_RCONST(0.1) / (dx * dx);
+
+  for (int j = 0; j < nx; j++)
+  {
+    // Reflect the neighbors across the boundary
+    const int jd = (j > 0) ? j - 1 : 1;
+    const int ju = (j < nx - 1) ? j + 1 : nx - 2;
+
+    for (int i = 0; i < nx; i++)
+    {
+      const int il = (i > 0) ? i - 1 : 1;
+      const int ir = (i < nx - 1) ? i + 1 : nx - 2;
+
+      const int k  = 2 * (j * nx + i);
+      const int kl = 2 * (j * nx + il);
+      const int kr = 2 * (j * nx + ir);
+      const int kd = 2 * (jd * nx + i);
+      const int ku = 2 * (ju * nx + i);
+
+      const sunrealtype u = y[k];
+      const sunrealtype v = y[k + 1];
+
+      const sunrealtype lapu = y[kl] + y[kr] + y[kd] + y[ku] - 4 * u;
+      const sunrealtype lapv = y[kl + 1] + y[kr + 1] + y[kd + 1] + y[ku + 1] -
+                               4 * v;
+
+      f[k]     = ONE + u * u * v - SUN_RCONST(4.4) * u + c * lapu;
+      f[k + 1] = SUN_RCONST(3.4) * u - u * u * v + c * lapv;
+    }
+  }
+
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+// Kepler two-body problem with eccentricity 0.6, y = [q, p]. See
+//
+//   E. Hairer, C. Lubich, and G. Wanner, Geometric Numerical Integration,
+//   Springer, 2006.
+// -----------------------------------------------------------------------------
+
+static void kepler_init(const Problem& prob, sunrealtype* y)
+{
+  const sunrealtype ecc = SUN_RCONST(0.6);
+  y[0]                  = ONE - ecc;
+  y[1]                  = ZERO;
+  y[2]                  = ZERO;
+  y[3]                  = sqrt((ONE + ecc) / (ONE - ecc));
+}
+
+// Momentum update, p' = -q / |q|^3
+static int kepler_force(sunrealtype t, N_Vector yvec, N_Vector fvec,
+                        void* user_data)
+{
+  sunrealtype* y = N_VGetArrayPointer(yvec);
+  sunrealtype* f = N_VGetArrayPointer(fvec);
+
+  const sunrealtype r  = sqrt(y[0] * y[0] + y[1] * y[1]);
+  const sunrealtype r3 = r * r * r;
+
+  f[2] = -y[0] / r3;
+  f[3] = -y[1] / r3;
+
+  return 0;
+}
+
+// Position update, q' = p
+static int kepler_velocity(sunrealtype t, N_Vector yvec, N_Vector fvec,
+                           void* user_data)
+{
+  sunrealtype* y = N_VGetArrayPointer(yvec);
+  sunrealtype* f = N_VGetArrayPointer(fvec);
+
+  f[0] = y[2];
+  f[1] = y[3];
+
+  return 0;
+}
+
+static int kepler_rhs(sunrealtype t, N_Vector yvec, N_Vector fvec,
+                      void* user_data)
+{
+  kepler_velocity(t, yvec, fvec, user_data);
+  kepler_force(t, yvec, fvec, user_data);
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+// Problem list
+// -----------------------------------------------------------------------------
+
+vector<Problem> create_problems(int nx1d, int nx2d)
+{
+  vector<Problem> problems;
+  Problem prob;
+
+  prob         = Problem();
+  prob.name    = "robertson";
+  prob.neq     = 3;
+  prob.tf      = SUN_RCONST(40.0);
+  prob.atol    = SUN_RCONST(1.0e-6);
+  prob.initial = robertson_init;
+  prob.rhs     = robertson_rhs;
+  problems.push_back(prob);
+
+  prob         = Problem();
+  prob.name    = "hires";
+  prob.neq     = 8;
+  prob.tf      = SUN_RCONST(321.8122);
+  prob.atol    = SUN_RCONST(1.0e-3);
+  prob.initial = hires_init;
+  prob.rhs     = hires_rhs;
+  problems.push_back(prob);
+
+  prob         = Problem();
+  prob.name    = "pollution";
+  prob.neq     = 20;
+  prob.tf      = SUN_RCONST(60.0);
+  prob.atol    = SUN_RCONST(1.0e-3);
+  prob.initial = pollution_init;
+  prob.rhs     = pollution_rhs;
+  problems.push_back(prob);
+
+  prob         = Problem();
+  prob.name    = "vanderpol";
+  prob.neq     = 2;
+  prob.tf      = TWO;
+  prob.atol    = ONE;
+  prob.initial = vanderpol_init;
+  prob.rhs     = vanderpol_rhs;
+  problems.push_back(prob);
+
+  prob         = Problem();
+  prob.name    = "brusselator1D";
+  prob.nx      = nx1d;
+  prob.neq     = 2 * nx1d;
+  prob.tf      = SUN_RCONST(10.0);
+  prob.atol    = ONE;
+  prob.mu      = 2;
+  prob.ml      = 2;
+  prob.initial = brusselator1D_init;
+  prob.rhs     = brusselator1D_rhs;
+  problems.push_back(prob);
+
+  prob         = Problem();
+  prob.name    = "brusselator2D";
+  prob.nx      = nx2d;
+  prob.neq     = 2 * nx2d * nx2d;
+  prob.tf      = SUN_RCONST(11.5);
+  prob.atol    = ONE;
+  prob.dense   = false;
+  prob.mu      = 2 * nx2d;
+  prob.ml      = 2 * nx2d;
+  prob.initial = brusselator2D_init;
+  prob.rhs     = brusselator2D_rhs;
+  problems.push_back(prob);
+
+  prob         = Problem();
+  prob.name    = "kepler";
+  prob.neq     = 4;
+  prob.tf      = SUN_RCONST(20.0) * PI;
+  prob.atol    = ONE;
+  prob.stiff   = false;
+  prob.initial = kepler_init;
+  prob.rhs     = kepler_rhs;
+  prob.rhs1    = kepler_force;
+  prob.rhs2    = kepler_velocity;
+  problems.push_back(prob);
+
+  return problems;
+}
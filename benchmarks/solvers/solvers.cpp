@@ -0,0 +1,474 @@
+/* -----------------------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Shared options, linear solver setup, and output functions for the solver
+ * benchmark suite
+ * ---------------------------------------------------------------------------*/
+
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include "solvers.hpp"
+
+// -----------------------------------------------------------------------------
+// UserOptions helper functions
+// -----------------------------------------------------------------------------
+
+// Split a comma separated list
+static vector<string> split_list(const string& list)
+{
+  vector<string> items;
+  stringstream ss(list);
+  string item;
+  while (getline(ss, item, ','))
+  {
+    if (!item.empty()) { items.push_back(item); }
+  }
+  return items;
+}
+
+int UserOptions::parse_args(vector<string>& args, const string& package)
+{
+  vector<string>::iterator it;
+
+  it = find(args.begin(), args.end(), "--help");
+  if (it != args.end())
+  {
+    help(package);
+    return 0;
+  }
+
+  it = find(args.begin(), args.end(), "--problems");
+  if (it != args.end())
+  {
+    problems = split_list(*(it + 1));
+    args.erase(it, it + 2);
+  }
+
+  it = find(args.begin(), args.end(), "--linsols");
+  if (it != args.end())
+  {
+    linsols = split_list(*(it + 1));
+    args.erase(it, it + 2);
+  }
+
+  it = find(args.begin(), args.end(), "--rtols");
+  if (it != args.end())
+  {
+    rtols.clear();
+    for (auto& rtol : split_list(*(it + 1))) { rtols.push_back(stod(rtol)); }
+    args.erase(it, it + 2);
+  }
+
+  it = find(args.begin(), args.end(), "--ref_factor");
+  if (it != args.end())
+  {
+    ref_factor = stod(*(it + 1));
+    args.erase(it, it + 2);
+  }
+
+  it = find(args.begin(), args.end(), "--repeat");
+  if (it != args.end())
+  {
+    repeat = stoi(*(it + 1));
+    args.erase(it, it + 2);
+  }
+
+  it = find(args.begin(), args.end(), "--nx1d");
+  if (it != args.end())
+  {
+    nx1d = stoi(*(it + 1));
+    args.erase(it, it + 2);
+  }
+
+  it = find(args.begin(), args.end(), "--nx2d");
+  if (it != args.end())
+  {
+    nx2d = stoi(*(it + 1));
+    args.erase(it, it + 2);
+  }
+
+  it = find(args.begin(), args.end(), "--kin_steps");
+  if (it != args.end())
+  {
+    kin_steps = stoi(*(it + 1));
+    args.erase(it, it + 2);
+  }
+
+  it = find(args.begin(), args.end(), "--output");
+  if (it != args.end())
+  {
+    output = *(it + 1);
+    args.erase(it, it + 2);
+  }
+
+  if (output.empty()) { output = package + "_solvers.json"; }
+
+  // Check inputs for validity
+  if (rtols.empty() || repeat < 1 || nx1d < 1 || nx2d < 3 || kin_steps < 1)
+  {
+    cerr << "ERROR: Invalid benchmark options" << endl;
+    return -1;
+  }
+
+  return 0;
+}
+
+void UserOptions::help(const string& package)
+{
+  cout << endl;
+  cout << "Command line options for the " << package << " solver benchmarks:"
+       << endl;
+  cout << "  --problems <list>       : problems to run (default all)" << endl;
+  cout << "  --linsols <list>        : linear solvers to run (default all)"
+       << endl;
+  cout << "  --rtols <list>          : relative tolerances" << endl;
+  cout << "  --ref_factor <real>     : reference tolerance / smallest rtol"
+       << endl;
+  cout << "  --repeat <int>          : runs per configuration" << endl;
+  cout << "  --nx1d <int>            : 1D Brusselator mesh points" << endl;
+  cout << "  --nx2d <int>            : 2D Brusselator mesh points per side"
+       << endl;
+  if (package == "kinsol")
+  {
+    cout << "  --kin_steps <int>       : number of implicit Euler steps"
+         << endl;
+  }
+  cout << "  --output <file>         : JSON output file" << endl;
+  cout << "  --help                  : print options and exit" << endl;
+  cout << endl;
+  cout << "Lists are comma separated. Problems are robertson, hires, "
+       << "pollution, vanderpol," << endl
+       << "brusselator1D, brusselator2D, and kepler. Linear solvers are "
+       << "dense, band, spgmr," << endl
+       << "and none (explicit or fixed-point)." << endl;
+}
+
+bool UserOptions::use_problem(const Problem& prob) const
+{
+  if (problems.empty()) { return true; }
+  return find(problems.begin(), problems.end(), prob.name) != problems.end();
+}
+
+vector<string> UserOptions::select_linsols(
+  const vector<string>& candidates) const
+{
+  if (linsols.empty()) { return candidates; }
+
+  vector<string> selected;
+  for (auto& ls : candidates)
+  {
+    if (find(linsols.begin(), linsols.end(), ls) != linsols.end())
+    {
+      selected.push_back(ls);
+    }
+  }
+  return selected;
+}
+
+sunrealtype UserOptions::ref_tol() const
+{
+  return *min_element(rtols.begin(), rtols.end()) * ref_factor;
+}
+
+// -----------------------------------------------------------------------------
+// Benchmark driver
+// -----------------------------------------------------------------------------
+
+int run_benchmarks(const string& package, int argc, char* argv[],
+                   ConfigFn configs, SolveFn solve)
+{
+  int flag;
+
+  // Create SUNDIALS context
+  sundials::Context ctx;
+
+  // Parse command line inputs
+  vector<string> args(argv + 1, argv + argc);
+
+  UserOptions opts;
+  flag = opts.parse_args(args, package);
+  if (check_flag(&flag, "UserOptions::parse_args", 1)) { return 1; }
+
+  if (find(args.begin(), args.end(), "--help") != args.end()) { return 0; }
+
+  // Check for unparsed inputs
+  if (args.size() > 0)
+  {
+    cerr << "ERROR: Unknown inputs: ";
+    for (auto i = args.begin(); i != args.end(); ++i) { cerr << *i << ' '; }
+    cerr << endl;
+    return 1;
+  }
+
+  vector<Result> results;
+
+  for (auto& prob : create_problems(opts.nx1d, opts.nx2d))
+  {
+    if (!opts.use_problem(prob)) { continue; }
+
+    // Select the configurations for this problem
+    vector<pair<string, string>> cfgs;
+    for (auto& cfg : configs(prob))
+    {
+      if (!opts.select_linsols({cfg.second}).empty()) { cfgs.push_back(cfg); }
+    }
+    if (cfgs.empty()) { continue; }
+
+    N_Vector y = N_VNew_Serial(prob.neq, ctx);
+    if (check_flag((void*)y, "N_VNew_Serial", 0)) { return 1; }
+
+    N_Vector yref = N_VClone(y);
+    if (check_flag((void*)yref, "N_VClone", 0)) { return 1; }
+
+    // Reference solution from the first configuration at a tight tolerance
+    Result ref;
+    flag = solve(ctx, prob, opts, cfgs[0].first, cfgs[0].second,
+                 opts.ref_tol(), yref, ref);
+    if (check_flag(&flag, "solve", 1)) { return 1; }
+    if (ref.status < 0)
+    {
+      cerr << "WARNING: " << prob.name << " reference solution failed"
+           << endl;
+    }
+
+    for (auto& cfg : cfgs)
+    {
+      for (auto rtol : opts.rtols)
+      {
+        Result res;
+        for (int i = 0; i < opts.repeat; i++)
+        {
+          Result run;
+          flag = solve(ctx, prob, opts, cfg.first, cfg.second, rtol, y, run);
+          if (check_flag(&flag, "solve", 1)) { return 1; }
+          if (i == 0 || run.wall_time < res.wall_time) { res = run; }
+        }
+
+        res.problem = prob.name;
+        res.method  = cfg.first;
+        res.linsol  = cfg.second;
+        res.rtol    = rtol;
+        res.error   = (ref.status < 0 || res.status < 0)
+                        ? NAN
+                        : solution_error(prob, y, yref);
+
+        results.push_back(res);
+      }
+    }
+
+    N_VDestroy(y);
+    N_VDestroy(yref);
+  }
+
+  print_results(package, results);
+
+  flag = write_json(package, opts, results);
+  if (check_flag(&flag, "write_json", 1)) { return 1; }
+
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+// Linear solvers
+// -----------------------------------------------------------------------------
+
+vector<string> problem_linsols(const Problem& prob)
+{
+  vector<string> linsols;
+  if (prob.dense) { linsols.push_back("dense"); }
+  if (prob.mu >= 0 && prob.ml >= 0) { linsols.push_back("band"); }
+  linsols.push_back("spgmr");
+  return linsols;
+}
+
+int create_linsol(const Problem& prob, const string& ls, N_Vector y,
+                  SUNContext ctx, SUNMatrix* A, SUNLinearSolver* LS)
+{
+  *A  = nullptr;
+  *LS = nullptr;
+
+  if (ls == "dense")
+  {
+    *A = SUNDenseMatrix(prob.neq, prob.neq, ctx);
+    if (check_flag((void*)*A, "SUNDenseMatrix", 0)) { return 1; }
+    *LS = SUNLinSol_Dense(y, *A, ctx);
+    if (check_flag((void*)*LS, "SUNLinSol_Dense", 0)) { return 1; }
+  }
+  else if (ls == "band")
+  {
+    *A = SUNBandMatrix(prob.neq, prob.mu, prob.ml, ctx);
+    if (check_flag((void*)*A, "SUNBandMatrix", 0)) { return 1; }
+    *LS = SUNLinSol_Band(y, *A, ctx);
+    if (check_flag((void*)*LS, "SUNLinSol_Band", 0)) { return 1; }
+  }
+  else if (ls == "spgmr")
+  {
+    // Without a preconditioner, allow a full Krylov space for small systems
+    const int maxl = static_cast<int>(min(prob.neq, sunindextype(20)));
+    *LS            = SUNLinSol_SPGMR(y, SUN_PREC_NONE, maxl, ctx);
+    if (check_flag((void*)*LS, "SUNLinSol_SPGMR", 0)) { return 1; }
+  }
+  else if (ls != "none")
+  {
+    cerr << "ERROR: Unknown linear solver " << ls << endl;
+    return 1;
+  }
+
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+// Error and timing
+// -----------------------------------------------------------------------------
+
+sunrealtype solution_error(const Problem& prob, N_Vector y, N_Vector yref)
+{
+  sunrealtype* ydata    = N_VGetArrayPointer(y);
+  sunrealtype* yrefdata = N_VGetArrayPointer(yref);
+
+  sunrealtype error = ZERO;
+  for (sunindextype i = 0; i < prob.neq; i++)
+  {
+    const sunrealtype diff = abs(ydata[i] - yrefdata[i]);
+    error = max(error, diff / (abs(yrefdata[i]) + prob.atol));
+  }
+  return error;
+}
+
+double get_time()
+{
+  using namespace std::chrono;
+  return duration<double>(steady_clock::now().time_since_epoch()).count();
+}
+
+// -----------------------------------------------------------------------------
+// Output
+// -----------------------------------------------------------------------------
+
+void print_results(const string& package, const vector<Result>& results)
+{
+  cout << endl << package << " solver benchmark results:" << endl;
+  cout << left << setw(15) << "problem" << setw(8) << "method" << setw(7)
+       << "linsol" << right << setw(9) << "rtol" << setw(9) << "steps"
+       << setw(10) << "rhs" << setw(8) << "jac" << setw(11) << "time (s)"
+       << setw(11) << "error" << setw(7) << "flag" << endl;
+
+  for (auto& res : results)
+  {
+    cout << left << setw(15) << res.problem << setw(8) << res.method << setw(7)
+         << res.linsol << right << scientific << setprecision(1) << setw(9)
+         << res.rtol << setw(9) << res.steps << setw(10) << res.rhs_evals
+         << setw(8) << res.jac_evals << setprecision(2) << setw(11)
+         << res.wall_time << setw(11) << res.error << setw(7) << res.status
+         << endl;
+  }
+  cout << defaultfloat;
+}
+
+int write_json(const string& package, const UserOptions& opts,
+               const vector<Result>& results)
+{
+  ofstream out(opts.output);
+  if (!out)
+  {
+    cerr << "ERROR: Could not open " << opts.output << endl;
+    return 1;
+  }
+
+  out << setprecision(17);
+  out << "{" << endl;
+  out << "  \"package\": \"" << package << "\"," << endl;
+  out << "  \"sundials_version\": \"" << SUNDIALS_VERSION << "\"," << endl;
+#if defined(SUNDIALS_SINGLE_PRECISION)
+  out << "  \"precision\": \"single\"," << endl;
+#elif defined(SUNDIALS_EXTENDED_PRECISION)
+  out << "  \"precision\": \"extended\"," << endl;
+#else
+  out << "  \"precision\": \"double\"," << endl;
+#endif
+  out << "  \"reference_tol\": " << opts.ref_tol() << "," << endl;
+  out << "  \"repeat\": " << opts.repeat << "," << endl;
+  out << "  \"results\": [" << endl;
+
+  for (size_t i = 0; i < results.size(); i++)
+  {
+    const Result& res = results[i];
+    out << "    {\"problem\": \"" << res.problem << "\", \"method\": \""
+        << res.method << "\", \"linsol\": \"" << res.linsol
+        << "\", \"rtol\": " << res.rtol << ", \"atol\": " << res.atol
+        << ", \"dt\": " << res.dt << ", \"status\": " << res.status
+        << ", \"steps\": " << res.steps << ", \"rhs_evals\": " << res.rhs_evals
+        << ", \"jac_evals\": " << res.jac_evals
+        << ", \"lin_setups\": " << res.lin_setups
+        << ", \"lin_iters\": " << res.lin_iters
+        << ", \"nonlin_iters\": " << res.nonlin_iters
+        << ", \"nonlin_fails\": " << res.nonlin_fails
+        << ", \"err_test_fails\": " << res.err_test_fails
+        << ", \"wall_time\": " << res.wall_time << ", \"error\": ";
+    // JSON does not allow NaN, failed runs have a null error
+    if (isnan(res.error)) { out << "null"; }
+    else { out << res.error; }
+    out << "}" << ((i + 1 < results.size()) ? "," : "") << endl;
+  }
+
+  out << "  ]" << endl;
+  out << "}" << endl;
+
+  cout << endl << "Results written to " << opts.output << endl;
+
+  return 0;
+}
+
+// -----------------------------------------------------------------------------
+// Check function return flag
+// -----------------------------------------------------------------------------
+
+int check_flag(const void* flagvalue, const string funcname, int opt)
+{
+  // Check if the function returned a NULL pointer
+  if (opt == 0)
+  {
+    if (flagvalue == NULL)
+    {
+      cerr << endl
+           << "ERROR: " << funcname << " returned NULL pointer" << endl
+           << endl;
+      return 1;
+    }
+  }
+  // Check the function return flag value
+  else if (opt == 1 || opt == 2)
+  {
+    const int errflag = *((const int*)flagvalue);
+    if ((opt == 1 && errflag < 0) || (opt == 2 && errflag != 0))
+    {
+      cerr << endl
+           << "ERROR: " << funcname << " returned with flag = " << errflag << endl
+           << endl;
+      return 1;
+    }
+  }
+  else
+  {
+    cerr << endl
+         << "ERROR: check_flag called with an invalid option value" << endl;
+    return 1;
+  }
+
+  return 0;
+}
+
+//---- end of file ----
@@ -0,0 +1,176 @@
+/* -----------------------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Shared header file for the solver benchmark suite
+ * ---------------------------------------------------------------------------*/
+
+#ifndef SOLVERS_HPP
+#define SOLVERS_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <sundials/sundials_core.hpp>
+#include <vector>
+
+#include "nvector/nvector_serial.h"
+#include "sunlinsol/sunlinsol_band.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunlinsol/sunlinsol_spgmr.h"
+#include "sunmatrix/sunmatrix_band.h"
+#include "sunmatrix/sunmatrix_dense.h"
+
+// Macros for problem constants
+#define PI   SUN_RCONST(3.141592653589793238462643383279502884197169)
+#define ZERO SUN_RCONST(0.0)
+#define HALF SUN_RCONST(0.5)
+#define ONE  SUN_RCONST(1.0)
+#define TWO  SUN_RCONST(2.0)
+
+using namespace std;
+
+// -----------------------------------------------------------------------------
+// Test problems
+// -----------------------------------------------------------------------------
+
+// Right-hand side function, the user data is the Problem
+typedef int (*ProblemRhsFn)(sunrealtype t, N_Vector y, N_Vector ydot,
+                            void* user_data);
+
+struct Problem
+{
+  string name;              // problem name used in the output
+  sunindextype neq = 0;     // number of equations
+  sunrealtype t0   = ZERO;  // initial time
+  sunrealtype tf   = ZERO;  // final time
+  sunrealtype atol = ONE;   // absolute tolerance relative to rtol
+  bool stiff       = true;  // use implicit methods
+  bool dense       = true;  // dense linear solvers are practical
+  sunindextype mu  = -1;    // upper bandwidth (< 0 if not banded)
+  sunindextype ml  = -1;    // lower bandwidth (< 0 if not banded)
+  int nx           = 0;     // grid points per direction for PDEs
+
+  // Initial condition
+  void (*initial)(const Problem& prob, sunrealtype* y) = nullptr;
+
+  // ODE right-hand side, y' = f(t,y)
+  ProblemRhsFn rhs = nullptr;
+
+  // Partitioned right-hand side for symplectic methods, f = f1 + f2, where
+  // f1 updates the momentum and f2 the position (nullptr if not separable)
+  ProblemRhsFn rhs1 = nullptr;
+  ProblemRhsFn rhs2 = nullptr;
+};
+
+// Create the list of test problems
+vector<Problem> create_problems(int nx1d, int nx2d);
+
+// -----------------------------------------------------------------------------
+// Benchmark options and results
+// -----------------------------------------------------------------------------
+
+struct UserOptions
+{
+  vector<string> problems;                // problems to run (empty for all)
+  vector<string> linsols;                 // linear solvers (empty for all)
+  vector<sunrealtype> rtols = {SUN_RCONST(1.0e-4), SUN_RCONST(1.0e-6),
+                               SUN_RCONST(1.0e-8)};
+  sunrealtype ref_factor    = SUN_RCONST(1.0e-2); // reference tol / min rtol
+  int repeat                = 1;                  // runs per configuration
+  int nx1d                  = 100;                // 1D Brusselator grid
+  int nx2d                  = 16;                 // 2D Brusselator grid
+  int kin_steps             = 100;                // KINSOL implicit steps
+  string output;                                  // JSON output file
+
+  // Helper functions
+  int parse_args(vector<string>& args, const string& package);
+  void help(const string& package);
+
+  // Check if a problem or linear solver was selected
+  bool use_problem(const Problem& prob) const;
+  vector<string> select_linsols(const vector<string>& candidates) const;
+
+  // Reference tolerance
+  sunrealtype ref_tol() const;
+};
+
+struct Result
+{
+  string problem;
+  string method;
+  string linsol;
+  sunrealtype rtol = ZERO;
+  sunrealtype atol = ZERO;
+  sunrealtype dt   = ZERO; // fixed step size (zero if adaptive)
+
+  int status              = 0; // solver return flag (< 0 on failure)
+  long int steps          = 0;
+  long int rhs_evals      = 0; // including difference quotient evaluations
+  long int jac_evals      = 0;
+  long int lin_setups     = 0;
+  long int lin_iters      = 0;
+  long int nonlin_iters   = 0;
+  long int nonlin_fails   = 0;
+  long int err_test_fails = 0;
+  double wall_time        = 0.0; // seconds, minimum over repeated runs
+  sunrealtype error       = ZERO;
+};
+
+// -----------------------------------------------------------------------------
+// Benchmark driver
+// -----------------------------------------------------------------------------
+
+// Method and linear solver pairs to run with a problem
+typedef vector<pair<string, string>> (*ConfigFn)(const Problem& prob);
+
+// Solve a problem with the given configuration and tolerance, on return y
+// holds the solution at the final time
+typedef int (*SolveFn)(SUNContext ctx, const Problem& prob,
+                       const UserOptions& opts, const string& method,
+                       const string& linsol, sunrealtype rtol, N_Vector y,
+                       Result& res);
+
+// Run every selected configuration at each tolerance and write the results
+int run_benchmarks(const string& package, int argc, char* argv[],
+                   ConfigFn configs, SolveFn solve);
+
+// -----------------------------------------------------------------------------
+// Utility functions
+// -----------------------------------------------------------------------------
+
+// Create the linear solver (and matrix) named ls
+int create_linsol(const Problem& prob, const string& ls, N_Vector y,
+                  SUNContext ctx, SUNMatrix* A, SUNLinearSolver* LS);
+
+// Linear solvers to run with a problem
+vector<string> problem_linsols(const Problem& prob);
+
+// Relative max norm error between a solution and the reference solution
+sunrealtype solution_error(const Problem& prob, N_Vector y, N_Vector yref);
+
+// Wall clock time in seconds
+double get_time();
+
+// Print a summary table of the results
+void print_results(const string& package, const vector<Result>& results);
+
+// Write the results as JSON
+int write_json(const string& package, const UserOptions& opts,
+               const vector<Result>& results);
+
+// Check function return flag
+int check_flag(const void* flagvalue, const string funcname, int opt);
+
+#endif
@@ -20,14 +20,8 @@
 # Currently only available in CVODE.
 # ---------------------------------------------------------------
 
-if(ENABLE_CUDA OR ENABLE_HIP)
-  set(CUDA_OR_HIP TRUE)
-else()
-  set(CUDA_OR_HIP FALSE)
-endif()
-
-sundials_option(SUNDIALS_BUILD_PACKAGE_FUSED_KERNELS BOOL "Build specialized fused GPU kernels" OFF
-                DEPENDS_ON BUILD_CVODE CUDA_OR_HIP
+sundials_option(SUNDIALS_BUILD_PACKAGE_FUSED_KERNELS BOOL "Build specialized fused kernels" OFF
+                DEPENDS_ON BUILD_CVODE
                 DEPENDS_ON_THROW_ERROR)
 
 # ---------------------------------------------------------------
@@ -85,6 +85,27 @@ if(SUNDIALS_ENABLE_ERROR_CHECKS)
   message(WARNING "SUNDIALS is being built with extensive error checks, performance may be affected.")
 endif()
 
+# ---------------------------------------------------------------
+# Option to enable a thread-safe SUNContext
+# ---------------------------------------------------------------
+
+set(DOCSTR "Build with a SUNContext that can be shared by concurrent threads")
+sundials_option(SUNDIALS_ENABLE_THREAD_SAFE_CONTEXT BOOL "${DOCSTR}" OFF)
+
+# ---------------------------------------------------------------
+# Option to enable asynchronous time series output
+# ---------------------------------------------------------------
+
+set(DOCSTR "Build with background threads for asynchronous output and I/O")
+sundials_option(SUNDIALS_ENABLE_ASYNC_OUTPUT BOOL "${DOCSTR}" OFF)
+
+# ---------------------------------------------------------------
+# Option to enable threaded Matrix Market reading
+# ---------------------------------------------------------------
+
+set(DOCSTR "Build with threads for parsing Matrix Market files")
+sundials_option(SUNDIALS_ENABLE_THREADED_MATRIX_READ BOOL "${DOCSTR}" OFF)
+
 # ---------------------------------------------------------------
 # Option to enable logging
 # ---------------------------------------------------------------
@@ -37,6 +37,9 @@
 #define FSYM "f"
 #endif
 
+/* prototypes for custom tests */
+int Test_SUNBandMatrixMatrixMarket(SUNMatrix A);
+
 /* ----------------------------------------------------------------------
  * Main SUNMatrix Testing Routine
  * --------------------------------------------------------------------*/
@@ -147,6 +150,7 @@ int main(int argc, char* argv[])
   fails += Test_SUNMatScaleAddI(A, I, 0);
   fails += Test_SUNMatMatvec(A, x, y, 0);
   fails += Test_SUNMatSpace(A, 0);
+  fails += Test_SUNBandMatrixMatrixMarket(A);
 
   /* Print result */
   if (fails)
@@ -173,6 +177,56 @@ int main(int argc, char* argv[])
   return (fails);
 }
 
+/* ----------------------------------------------------------------------
+ * Extra band matrix tests
+ * --------------------------------------------------------------------*/
+
+int Test_SUNBandMatrixMatrixMarket(SUNMatrix A)
+{
+  FILE* fp;
+  SUNMatrix B = NULL;
+
+  fp = tmpfile();
+  if (fp == NULL)
+  {
+    printf(">>> FAILED test -- SUNBandMatrixMatrixMarket could not open a "
+           "file\n");
+    return (1);
+  }
+
+  if (SUNBandMatrix_WriteMatrixMarket(A, fp, SUNFALSE))
+  {
+    printf(">>> FAILED test -- SUNBandMatrix_WriteMatrixMarket returned "
+           "nonzero\n");
+    fclose(fp);
+    return (1);
+  }
+  rewind(fp);
+
+  if (SUNBandMatrix_ReadMatrixMarket(fp, 2, A->sunctx, &B))
+  {
+    printf(">>> FAILED test -- SUNBandMatrix_ReadMatrixMarket returned "
+           "nonzero\n");
+    fclose(fp);
+    return (1);
+  }
+  fclose(fp);
+
+  if (check_matrix(A, B, 10 * SUN_UNIT_ROUNDOFF))
+  {
+    printf(">>> FAILED test -- SUNBandMatrixMatrixMarket check_matrix "
+           "failed\n");
+    SUNMatDestroy(B);
+    return (1);
+  }
+
+  printf("    PASSED test -- SUNBandMatrixMatrixMarket\n");
+
+  SUNMatDestroy(B);
+
+  return (0);
+}
+
 /* ----------------------------------------------------------------------
  * Implementation-specific 'check' routines
  * --------------------------------------------------------------------*/
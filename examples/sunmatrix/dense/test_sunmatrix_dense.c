@@ -37,6 +37,9 @@
 #define FSYM "f"
 #endif
 
+/* prototypes for custom tests */
+int Test_SUNDenseMatrixMatrixMarket(SUNMatrix A, sunbooleantype symmetric);
+
 /* ----------------------------------------------------------------------
  * Main SUNMatrix Testing Routine
  * --------------------------------------------------------------------*/
@@ -139,6 +142,8 @@ int main(int argc, char* argv[])
   }
   fails += Test_SUNMatMatvec(A, x, y, 0);
   fails += Test_SUNMatSpace(A, 0);
+  fails += Test_SUNDenseMatrixMatrixMarket(A, SUNFALSE);
+  if (square) { fails += Test_SUNDenseMatrixMatrixMarket(I, SUNTRUE); }
 
   /* Print result */
   if (fails)
@@ -168,6 +173,59 @@ int main(int argc, char* argv[])
   return (fails);
 }
 
+/* ----------------------------------------------------------------------
+ * Extra dense matrix tests
+ * --------------------------------------------------------------------*/
+
+int Test_SUNDenseMatrixMatrixMarket(SUNMatrix A, sunbooleantype symmetric)
+{
+  FILE* fp;
+  SUNMatrix B = NULL;
+
+  fp = tmpfile();
+  if (fp == NULL)
+  {
+    printf(">>> FAILED test -- SUNDenseMatrixMatrixMarket could not open a "
+           "file\n");
+    return (1);
+  }
+
+  if (SUNDenseMatrix_WriteMatrixMarket(A, fp, symmetric))
+  {
+    printf(">>> FAILED test -- SUNDenseMatrix_WriteMatrixMarket returned "
+           "nonzero\n");
+    fclose(fp);
+    return (1);
+  }
+  rewind(fp);
+
+  if (SUNDenseMatrix_ReadMatrixMarket(fp, 2, A->sunctx, &B))
+  {
+    printf(">>> FAILED test -- SUNDenseMatrix_ReadMatrixMarket returned "
+           "nonzero\n");
+    fclose(fp);
+    return (1);
+  }
+  fclose(fp);
+
+  if (SUNDenseMatrix_Rows(A) != SUNDenseMatrix_Rows(B) ||
+      SUNDenseMatrix_Columns(A) != SUNDenseMatrix_Columns(B) ||
+      check_matrix(A, B, 10 * SUN_UNIT_ROUNDOFF))
+  {
+    printf(">>> FAILED test -- SUNDenseMatrixMatrixMarket check_matrix "
+           "failed\n");
+    SUNMatDestroy(B);
+    return (1);
+  }
+
+  printf("    PASSED test -- SUNDenseMatrixMatrixMarket%s\n",
+         symmetric ? " (symmetric)" : "");
+
+  SUNMatDestroy(B);
+
+  return (0);
+}
+
 /* ----------------------------------------------------------------------
  * Check matrix
  * --------------------------------------------------------------------*/
@@ -34,6 +34,11 @@ int Test_SUNMatScaleAdd2(SUNMatrix A, SUNMatrix B, N_Vector x, N_Vector y,
 int Test_SUNMatScaleAddI2(SUNMatrix A, N_Vector x, N_Vector y);
 int Test_SUNSparseMatrixToCSC(SUNMatrix A);
 int Test_SUNSparseMatrixToCSR(SUNMatrix A);
+int Test_SUNSparseMatrixMatrixMarket(SUNMatrix A);
+int Test_SUNSparseMatrixMatrixMarketSymmetric(int mattype, SUNContext sunctx);
+int Test_SUNSparseMatrixMatrixMarketChunks(int mattype, SUNContext sunctx);
+int Test_SUNSparseMatrixBinary(SUNMatrix A);
+int Test_SUNSparseMatrixBinaryCorrupt(SUNMatrix A);
 
 /* ----------------------------------------------------------------------
  * Main SUNMatrix Testing Routine
@@ -460,6 +465,11 @@ int main(int argc, char* argv[])
   fails += Test_SUNMatSpace(A, 0);
   if (mattype == CSR_MAT) { fails += Test_SUNSparseMatrixToCSC(A); }
   else { fails += Test_SUNSparseMatrixToCSR(A); }
+  fails += Test_SUNSparseMatrixMatrixMarket(A);
+  fails += Test_SUNSparseMatrixMatrixMarketSymmetric(mattype, sunctx);
+  fails += Test_SUNSparseMatrixMatrixMarketChunks(mattype, sunctx);
+  fails += Test_SUNSparseMatrixBinary(A);
+  fails += Test_SUNSparseMatrixBinaryCorrupt(A);
 
   /* Print result */
   if (fails)
@@ -974,6 +984,315 @@ int Test_SUNSparseMatrixToCSC(SUNMatrix A)
   return (0);
 }
 
+int Test_SUNSparseMatrixMatrixMarket(SUNMatrix A)
+{
+  FILE* fp;
+  SUNMatrix B = NULL;
+
+  fp = tmpfile();
+  if (fp == NULL)
+  {
+    printf(">>> FAILED test -- SUNSparseMatrixMatrixMarket could not open a "
+           "file\n");
+    return (1);
+  }
+
+  if (SUNSparseMatrix_WriteMatrixMarket(A, fp, SUNFALSE))
+  {
+    printf(">>> FAILED test -- SUNSparseMatrix_WriteMatrixMarket returned "
+           "nonzero\n");
+    fclose(fp);
+    return (1);
+  }
+  rewind(fp);
+
+  if (SUNSparseMatrix_ReadMatrixMarket(fp, SUNSparseMatrix_SparseType(A), 4,
+                                       A->sunctx, &B))
+  {
+    printf(">>> FAILED test -- SUNSparseMatrix_ReadMatrixMarket returned "
+           "nonzero\n");
+    fclose(fp);
+    return (1);
+  }
+  fclose(fp);
+
+  if (check_matrix(A, B, 10 * SUN_UNIT_ROUNDOFF))
+  {
+    printf(">>> FAILED test -- SUNSparseMatrixMatrixMarket check_matrix "
+           "failed\n");
+    SUNMatDestroy(B);
+    return (1);
+  }
+
+  printf("    PASSED test -- SUNSparseMatrixMatrixMarket\n");
+
+  SUNMatDestroy(B);
+
+  return (0);
+}
+
+int Test_SUNSparseMatrixMatrixMarketSymmetric(int mattype, SUNContext sunctx)
+{
+  FILE* fp;
+  SUNMatrix D = NULL, E = NULL, B = NULL;
+  int failure;
+
+  /* lower triangle of [ 4 -1 0; -1 4 -1; 0 -1 0 ] with a comment, a blank
+     line, and a duplicate diagonal entry */
+  const char* text = "%%MatrixMarket matrix coordinate real symmetric\n"
+                     "% comment\n"
+                     "3 3 5\n"
+                     "\n"
+                     "1 1 4.0\n"
+                     "2 1 -1.0\n"
+                     "3 2 -1.0e0\n"
+                     "2 2 2\n"
+                     "2 2 2\n";
+
+  fp = tmpfile();
+  if (fp == NULL)
+  {
+    printf(">>> FAILED test -- SUNSparseMatrixMatrixMarketSymmetric could "
+           "not open a file\n");
+    return (1);
+  }
+  fputs(text, fp);
+  rewind(fp);
+
+  failure = SUNSparseMatrix_ReadMatrixMarket(fp, mattype, 1, sunctx, &B);
+  fclose(fp);
+  if (failure)
+  {
+    printf(">>> FAILED test -- SUNSparseMatrix_ReadMatrixMarket returned "
+           "nonzero\n");
+    return (1);
+  }
+
+  D                     = SUNDenseMatrix(3, 3, sunctx);
+  SM_ELEMENT_D(D, 0, 0) = SUN_RCONST(4.0);
+  SM_ELEMENT_D(D, 1, 1) = SUN_RCONST(4.0);
+  SM_ELEMENT_D(D, 0, 1) = SUN_RCONST(-1.0);
+  SM_ELEMENT_D(D, 1, 0) = SUN_RCONST(-1.0);
+  SM_ELEMENT_D(D, 1, 2) = SUN_RCONST(-1.0);
+  SM_ELEMENT_D(D, 2, 1) = SUN_RCONST(-1.0);
+  E                     = SUNSparseFromDenseMatrix(D, ZERO, mattype);
+
+  failure = check_matrix(E, B, ZERO);
+  SUNMatDestroy(B);
+  SUNMatDestroy(D);
+  SUNMatDestroy(E);
+  if (failure)
+  {
+    printf(">>> FAILED test -- SUNSparseMatrixMatrixMarketSymmetric "
+           "check_matrix failed\n");
+    return (1);
+  }
+
+  printf("    PASSED test -- SUNSparseMatrixMatrixMarketSymmetric\n");
+
+  return (0);
+}
+
+int Test_SUNSparseMatrixMatrixMarketChunks(int mattype, SUNContext sunctx)
+{
+  FILE* fp;
+  SUNMatrix B = NULL;
+  sunindextype i, j, k, nk, n = 100000;
+  sunindextype *indexptrs, *indexvals;
+  sunrealtype* data;
+  int failure = 0;
+
+  /* A tridiagonal matrix with a[i][j] = 2i + j + 1 (zero-based). The file is
+     about 5 MB so it is split into several chunks when the reader is threaded.
+     Comments and blank lines are mixed into the entries so some of them fall
+     on chunk boundaries. */
+  fp = tmpfile();
+  if (fp == NULL)
+  {
+    printf(">>> FAILED test -- SUNSparseMatrixMatrixMarketChunks could not "
+           "open a file\n");
+    return (1);
+  }
+  fprintf(fp, "%%%%MatrixMarket matrix coordinate real general\n");
+  fprintf(fp, "%ld %ld %ld\n", (long int)n, (long int)n, (long int)(3 * n - 2));
+  for (j = n - 1; j >= 0; j--)
+  {
+    for (i = SUNMAX(j - 1, 0); i <= SUNMIN(j + 1, n - 1); i++)
+    {
+      fprintf(fp, "%ld %ld %ld\n", (long int)i + 1, (long int)j + 1,
+              (long int)(2 * i + j + 1));
+    }
+    if (j % 1000 == 0) { fprintf(fp, "%% column %ld\n\n", (long int)j); }
+  }
+  rewind(fp);
+
+  failure = SUNSparseMatrix_ReadMatrixMarket(fp, mattype, 4, sunctx, &B);
+  fclose(fp);
+  if (failure)
+  {
+    printf(">>> FAILED test -- SUNSparseMatrix_ReadMatrixMarket returned "
+           "nonzero\n");
+    return (1);
+  }
+
+  /* Each column (CSC) or row (CSR) holds the sorted tridiagonal entries */
+  indexptrs = SUNSparseMatrix_IndexPointers(B);
+  indexvals = SUNSparseMatrix_IndexValues(B);
+  data      = SUNSparseMatrix_Data(B);
+  if (SUNSparseMatrix_Rows(B) != n || SUNSparseMatrix_Columns(B) != n ||
+      indexptrs[n] != 3 * n - 2)
+  {
+    failure = 1;
+  }
+  for (j = 0; j < n && !failure; j++)
+  {
+    nk = SUNMIN(j + 1, n - 1) - SUNMAX(j - 1, 0) + 1;
+    if (indexptrs[j + 1] - indexptrs[j] != nk) { failure = 1; }
+    for (k = indexptrs[j]; k < indexptrs[j + 1] && !failure; k++)
+    {
+      i = indexvals[k];
+      if (i != SUNMAX(j - 1, 0) + (k - indexptrs[j])) { failure = 1; }
+      else if (mattype == CSC_MAT && data[k] != (sunrealtype)(2 * i + j + 1))
+      {
+        failure = 1;
+      }
+      else if (mattype == CSR_MAT && data[k] != (sunrealtype)(2 * j + i + 1))
+      {
+        failure = 1;
+      }
+    }
+  }
+  SUNMatDestroy(B);
+  if (failure)
+  {
+    printf(">>> FAILED test -- SUNSparseMatrixMatrixMarketChunks wrong "
+           "entries\n");
+    return (1);
+  }
+
+  printf("    PASSED test -- SUNSparseMatrixMatrixMarketChunks\n");
+
+  return (0);
+}
+
+int Test_SUNSparseMatrixBinary(SUNMatrix A)
+{
+  FILE* fp;
+  SUNMatrix B = NULL;
+
+  fp = tmpfile();
+  if (fp == NULL)
+  {
+    printf(">>> FAILED test -- SUNSparseMatrixBinary could not open a "
+           "file\n");
+    return (1);
+  }
+
+  if (SUNSparseMatrix_WriteBinary(A, fp))
+  {
+    printf(">>> FAILED test -- SUNSparseMatrix_WriteBinary returned "
+           "nonzero\n");
+    fclose(fp);
+    return (1);
+  }
+  rewind(fp);
+
+  if (SUNSparseMatrix_ReadBinary(fp, A->sunctx, &B))
+  {
+    printf(">>> FAILED test -- SUNSparseMatrix_ReadBinary returned "
+           "nonzero\n");
+    fclose(fp);
+    return (1);
+  }
+  fclose(fp);
+
+  if (check_matrix(A, B, ZERO))
+  {
+    printf(">>> FAILED test -- SUNSparseMatrixBinary check_matrix failed\n");
+    SUNMatDestroy(B);
+    return (1);
+  }
+
+  printf("    PASSED test -- SUNSparseMatrixBinary\n");
+
+  SUNMatDestroy(B);
+
+  return (0);
+}
+
+/* Write a copy of A with a bad index and check that reading it fails */
+static int read_binary_corrupt(SUNMatrix C)
+{
+  FILE* fp;
+  SUNMatrix B = NULL;
+  SUNErrCode err;
+
+  fp = tmpfile();
+  if (fp == NULL) { return (1); }
+  if (SUNSparseMatrix_WriteBinary(C, fp))
+  {
+    fclose(fp);
+    return (1);
+  }
+  rewind(fp);
+  err = SUNSparseMatrix_ReadBinary(fp, C->sunctx, &B);
+  fclose(fp);
+  if (B != NULL) { SUNMatDestroy(B); }
+
+  return (err == SUN_ERR_CORRUPT) ? 0 : 1;
+}
+
+int Test_SUNSparseMatrixBinaryCorrupt(SUNMatrix A)
+{
+  SUNMatrix C;
+  sunindextype np, nidx, tmp;
+  sunindextype *indexptrs, *indexvals;
+  int failure = 0;
+
+  np = SUNSparseMatrix_NP(A);
+  if (SUNSparseMatrix_SparseType(A) == CSC_MAT)
+  {
+    nidx = SUNSparseMatrix_Rows(A);
+  }
+  else { nidx = SUNSparseMatrix_Columns(A); }
+
+  C = SUNMatClone(A);
+  SUNMatCopy(A, C);
+  indexptrs = SUNSparseMatrix_IndexPointers(C);
+  indexvals = SUNSparseMatrix_IndexValues(C);
+
+  /* index value out of range */
+  if (indexptrs[np] > 0)
+  {
+    tmp          = indexvals[0];
+    indexvals[0] = nidx;
+    failure += read_binary_corrupt(C);
+    indexvals[0] = tmp;
+  }
+
+  /* decreasing index pointers */
+  if (np > 1)
+  {
+    tmp          = indexptrs[1];
+    indexptrs[1] = indexptrs[np] + 1;
+    failure += read_binary_corrupt(C);
+    indexptrs[1] = tmp;
+  }
+
+  SUNMatDestroy(C);
+
+  if (failure)
+  {
+    printf(">>> FAILED test -- SUNSparseMatrix_ReadBinary accepted a corrupt "
+           "file\n");
+    return (1);
+  }
+
+  printf("    PASSED test -- SUNSparseMatrixBinaryCorrupt\n");
+
+  return (0);
+}
+
 /* ----------------------------------------------------------------------
  * Check matrix
  * --------------------------------------------------------------------*/
@@ -152,6 +152,10 @@ typedef int (*ARKRhsFn)(sunrealtype t, N_Vector y, N_Vector ydot,
 typedef int (*ARKRootFn)(sunrealtype t, N_Vector y, sunrealtype* gout,
                          void* user_data);
 
+typedef int (*ARKPartialRootFn)(sunrealtype t, N_Vector y, int ncand,
+                                const int* cand, sunrealtype* gout,
+                                void* user_data);
+
 typedef int (*ARKEwtFn)(N_Vector y, N_Vector ewt, void* user_data);
 
 typedef int (*ARKRwtFn)(N_Vector y, N_Vector rwt, void* user_data);
@@ -216,6 +220,10 @@ SUNDIALS_EXPORT int ARKodeResFtolerance(void* arkode_mem, ARKRwtFn rfun);
 SUNDIALS_EXPORT int ARKodeRootInit(void* arkode_mem, int nrtfn, ARKRootFn g);
 SUNDIALS_EXPORT int ARKodeSetRootDirection(void* arkode_mem, int* rootdir);
 SUNDIALS_EXPORT int ARKodeSetNoInactiveRootWarn(void* arkode_mem);
+SUNDIALS_EXPORT int ARKodeSetPartialRootFn(void* arkode_mem,
+                                           ARKPartialRootFn gpart);
+SUNDIALS_EXPORT int ARKodeSetRootInverseInterp(void* arkode_mem,
+                                               sunbooleantype onoff);
 
 /* Optional input functions (general) */
 SUNDIALS_EXPORT int ARKodeSetDefaults(void* arkode_mem);
@@ -233,6 +241,8 @@ SUNDIALS_EXPORT int ARKodeSetPostprocessStepFn(void* arkode_mem,
                                                ARKPostProcessFn ProcessStep);
 SUNDIALS_EXPORT int ARKodeSetPostprocessStageFn(void* arkode_mem,
                                                 ARKPostProcessFn ProcessStage);
+SUNDIALS_EXPORT int ARKodeSetTelemetry(void* arkode_mem, SUNTelemetry tel);
+SUNDIALS_EXPORT int ARKodeSetNumStageThreads(void* arkode_mem, int nthreads);
 
 /* Optional input functions (implicit solver) */
 SUNDIALS_EXPORT int ARKodeSetNonlinearSolver(void* arkode_mem,
@@ -289,6 +299,10 @@ SUNDIALS_EXPORT int ARKodeEvolve(void* arkode_mem, sunrealtype tout,
 SUNDIALS_EXPORT int ARKodeGetDky(void* arkode_mem, sunrealtype t, int k,
                                  N_Vector dky);
 
+/* Computes the kth derivative of the y function at several times */
+SUNDIALS_EXPORT int ARKodeGetDkyBatch(void* arkode_mem, int nt, sunrealtype* t,
+                                      int k, N_Vector* dky);
+
 /* Utility function to update/compute y based on zcor */
 SUNDIALS_EXPORT int ARKodeComputeState(void* arkode_mem, N_Vector zcor,
                                        N_Vector z);
@@ -57,6 +57,8 @@ SUNDIALS_EXPORT void ARKodeButcherTable_Write(ARKodeButcherTable B,
                                               FILE* outfile);
 SUNDIALS_EXPORT sunbooleantype
 ARKodeButcherTable_IsStifflyAccurate(ARKodeButcherTable B);
+SUNDIALS_EXPORT int ARKodeButcherTable_StageGroups(ARKodeButcherTable B,
+                                                   int* groups);
 SUNDIALS_EXPORT int ARKodeButcherTable_CheckOrder(ARKodeButcherTable B, int* q,
                                                   int* p, FILE* outfile);
 SUNDIALS_EXPORT int ARKodeButcherTable_CheckARKOrder(ARKodeButcherTable B1,
@@ -52,7 +52,8 @@ typedef enum
   ARKODE_FORWARD_EULER_1_1,
   ARKODE_RALSTON_EULER_2_1_2,
   ARKODE_EXPLICIT_MIDPOINT_EULER_2_1_2,
-  ARKODE_MAX_ERK_NUM = ARKODE_EXPLICIT_MIDPOINT_EULER_2_1_2
+  ARKODE_PARALLEL_ERK_4_2_3,
+  ARKODE_MAX_ERK_NUM = ARKODE_PARALLEL_ERK_4_2_3
 } ARKODE_ERKTableID;
 
 /* Accessor routine to load built-in ERK table */
@@ -0,0 +1,946 @@
+/* -----------------------------------------------------------------------------
+ * Programmer(s): Daniel R. Reynolds @ SMU
+ * -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Compile-time Butcher tables for the explicit methods with specialized step
+ * kernels (see arkode_erkstep_kernels.hpp).
+ *
+ * THIS FILE IS GENERATED BY scripts/generateERKTables.py FROM
+ * src/arkode/arkode_butcher_erk.def, DO NOT EDIT IT DIRECTLY.
+ * ---------------------------------------------------------------------------*/
+
+#ifndef _ARKODE_BUTCHER_ERK_HPP
+#define _ARKODE_BUTCHER_ERK_HPP
+
+#include <arkode/arkode_butcher_erk.h>
+#include <sundials/sundials_types.h>
+
+/* X-macro listing the tables with a constexpr ERKTable specialization */
+#define ARKODE_ERK_CONSTEXPR_TABLES(X) \
+  X(ARKODE_HEUN_EULER_2_1_2)           \
+  X(ARKODE_BOGACKI_SHAMPINE_4_2_3)     \
+  X(ARKODE_ZONNEVELD_5_3_4)            \
+  X(ARKODE_CASH_KARP_6_4_5)            \
+  X(ARKODE_DORMAND_PRINCE_7_4_5)       \
+  X(ARKODE_VERNER_8_5_6)               \
+  X(ARKODE_VERNER_9_5_6)               \
+  X(ARKODE_VERNER_10_6_7)              \
+  X(ARKODE_VERNER_13_7_8)              \
+  X(ARKODE_VERNER_16_8_9)
+
+namespace sundials {
+namespace arkode {
+
+/* Primary template, only the tables listed above are defined */
+template<ARKODE_ERKTableID ID>
+struct ERKTable;
+
+template<>
+struct ERKTable<ARKODE_HEUN_EULER_2_1_2>
+{
+  static constexpr int stages = 2;
+  static constexpr int q      = 2;
+  static constexpr int p      = 1;
+
+  static constexpr sunrealtype A(int i, int j)
+  {
+    constexpr sunrealtype A_[2][2] = {{SUN_RCONST(0.0), SUN_RCONST(0.0)},
+                                      {SUN_RCONST(1.0), SUN_RCONST(0.0)}};
+    return A_[i][j];
+  }
+
+  static constexpr sunrealtype b(int j)
+  {
+    constexpr sunrealtype b_[2] = {SUN_RCONST(1.0) / SUN_RCONST(2.0),
+                                   SUN_RCONST(1.0) / SUN_RCONST(2.0)};
+    return b_[j];
+  }
+
+  static constexpr sunrealtype c(int j)
+  {
+    constexpr sunrealtype c_[2] = {SUN_RCONST(0.0), SUN_RCONST(1.0)};
+    return c_[j];
+  }
+
+  static constexpr sunrealtype d(int j)
+  {
+    constexpr sunrealtype d_[2] = {SUN_RCONST(1.0), SUN_RCONST(0.0)};
+    return d_[j];
+  }
+};
+
+template<>
+struct ERKTable<ARKODE_BOGACKI_SHAMPINE_4_2_3>
+{
+  static constexpr int stages = 4;
+  static constexpr int q      = 3;
+  static constexpr int p      = 2;
+
+  static constexpr sunrealtype A(int i, int j)
+  {
+    constexpr sunrealtype A_[4][4] = {{SUN_RCONST(0.0), SUN_RCONST(0.0),
+                                       SUN_RCONST(0.0), SUN_RCONST(0.0)},
+                                      {SUN_RCONST(1.0) / SUN_RCONST(2.0),
+                                       SUN_RCONST(0.0), SUN_RCONST(0.0),
+                                       SUN_RCONST(0.0)},
+                                      {SUN_RCONST(0.0),
+                                       SUN_RCONST(3.0) / SUN_RCONST(4.0),
+                                       SUN_RCONST(0.0), SUN_RCONST(0.0)},
+                                      {SUN_RCONST(2.0) / SUN_RCONST(9.0),
+                                       SUN_RCONST(1.0) / SUN_RCONST(3.0),
+                                       SUN_RCONST(4.0) / SUN_RCONST(9.0),
+                                       SUN_RCONST(0.0)}};
+    return A_[i][j];
+  }
+
+  static constexpr sunrealtype b(int j)
+  {
+    constexpr sunrealtype b_[4] = {SUN_RCONST(2.0) / SUN_RCONST(9.0),
+                                   SUN_RCONST(1.0) / SUN_RCONST(3.0),
+                                   SUN_RCONST(4.0) / SUN_RCONST(9.0),
+                                   SUN_RCONST(0.0)};
+    return b_[j];
+  }
+
+  static constexpr sunrealtype c(int j)
+  {
+    constexpr sunrealtype c_[4] = {SUN_RCONST(0.0),
+                                   SUN_RCONST(1.0) / SUN_RCONST(2.0),
+                                   SUN_RCONST(3.0) / SUN_RCONST(4.0),
+                                   SUN_RCONST(1.0)};
+    return c_[j];
+  }
+
+  static constexpr sunrealtype d(int j)
+  {
+    constexpr sunrealtype d_[4] = {SUN_RCONST(7.0) / SUN_RCONST(24.0),
+                                   SUN_RCONST(1.0) / SUN_RCONST(4.0),
+                                   SUN_RCONST(1.0) / SUN_RCONST(3.0),
+                                   SUN_RCONST(1.0) / SUN_RCONST(8.0)};
+    return d_[j];
+  }
+};
+
+template<>
+struct ERKTable<ARKODE_ZONNEVELD_5_3_4>
+{
+  static constexpr int stages = 5;
+  static constexpr int q      = 4;
+  static constexpr int p      = 3;
+
+  static constexpr sunrealtype A(int i, int j)
+  {
+    constexpr sunrealtype A_[5][5] = {{SUN_RCONST(0.0), SUN_RCONST(0.0),
+                                       SUN_RCONST(0.0), SUN_RCONST(0.0),
+                                       SUN_RCONST(0.0)},
+                                      {SUN_RCONST(0.5), SUN_RCONST(0.0),
+                                       SUN_RCONST(0.0), SUN_RCONST(0.0),
+                                       SUN_RCONST(0.0)},
+                                      {SUN_RCONST(0.0), SUN_RCONST(0.5),
+                                       SUN_RCONST(0.0), SUN_RCONST(0.0),
+                                       SUN_RCONST(0.0)},
+                                      {SUN_RCONST(0.0), SUN_RCONST(0.0),
+                                       SUN_RCONST(1.0), SUN_RCONST(0.0),
+                                       SUN_RCONST(0.0)},
+                                      {SUN_RCONST(5.0) / SUN_RCONST(32.0),
+                                       SUN_RCONST(7.0) / SUN_RCONST(32.0),
+                                       SUN_RCONST(13.0) / SUN_RCONST(32.0),
+                                       SUN_RCONST(-1.0) / SUN_RCONST(32.0),
+                                       SUN_RCONST(0.0)}};
+    return A_[i][j];
+  }
+
+  static constexpr sunrealtype b(int j)
+  {
+    constexpr sunrealtype b_[5] = {SUN_RCONST(1.0) / SUN_RCONST(6.0),
+                                   SUN_RCONST(1.0) / SUN_RCONST(3.0),
+                                   SUN_RCONST(1.0) / SUN_RCONST(3.0),
+                                   SUN_RCONST(1.0) / SUN_RCONST(6.0),
+                                   SUN_RCONST(0.0)};
+    return b_[j];
+  }
+
+  static constexpr sunrealtype c(int j)
+  {
+    constexpr sunrealtype c_[5] = {SUN_RCONST(0.0), SUN_RCONST(0.5),
+                                   SUN_RCONST(0.5), SUN_RCONST(1.0),
+                                   SUN_RCONST(0.75)};
+    return c_[j];
+  }
+
+  static constexpr sunrealtype d(int j)
+  {
+    constexpr sunrealtype d_[5] = {SUN_RCONST(-1.0) / SUN_RCONST(2.0),
+                                   SUN_RCONST(7.0) / SUN_RCONST(3.0),
+                                   SUN_RCONST(7.0) / SUN_RCONST(3.0),
+                                   SUN_RCONST(13.0) / SUN_RCONST(6.0),
+                                   SUN_RCONST(-16.0) / SUN_RCONST(3.0)};
+    return d_[j];
+  }
+};
+
+template<>
+struct ERKTable<ARKODE_CASH_KARP_6_4_5>
+{
+  static constexpr int stages = 6;
+  static constexpr int q      = 5;
+  static constexpr int p      = 4;
+
+  static constexpr sunrealtype A(int i, int j)
+  {
+    constexpr sunrealtype A_[6][6] =
+      {{SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0)},
+       {SUN_RCONST(1.0) / SUN_RCONST(5.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0)},
+       {SUN_RCONST(3.0) / SUN_RCONST(40.0), SUN_RCONST(9.0) / SUN_RCONST(40.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0)},
+       {SUN_RCONST(3.0) / SUN_RCONST(10.0), SUN_RCONST(-9.0) / SUN_RCONST(10.0),
+        SUN_RCONST(6.0) / SUN_RCONST(5.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0)},
+       {SUN_RCONST(-11.0) / SUN_RCONST(54.0), SUN_RCONST(5.0) / SUN_RCONST(2.0),
+        SUN_RCONST(-70.0) / SUN_RCONST(27.0),
+        SUN_RCONST(35.0) / SUN_RCONST(27.0), SUN_RCONST(0.0), SUN_RCONST(0.0)},
+       {SUN_RCONST(1631.0) / SUN_RCONST(55296.0),
+        SUN_RCONST(175.0) / SUN_RCONST(512.0),
+        SUN_RCONST(575.0) / SUN_RCONST(13824.0),
+        SUN_RCONST(44275.0) / SUN_RCONST(110592.0),
+        SUN_RCONST(253.0) / SUN_RCONST(4096.0), SUN_RCONST(0.0)}};
+    return A_[i][j];
+  }
+
+  static constexpr sunrealtype b(int j)
+  {
+    constexpr sunrealtype b_[6] = {SUN_RCONST(37.0) / SUN_RCONST(378.0),
+                                   SUN_RCONST(0.0),
+                                   SUN_RCONST(250.0) / SUN_RCONST(621.0),
+                                   SUN_RCONST(125.0) / SUN_RCONST(594.0),
+                                   SUN_RCONST(0.0),
+                                   SUN_RCONST(512.0) / SUN_RCONST(1771.0)};
+    return b_[j];
+  }
+
+  static constexpr sunrealtype c(int j)
+  {
+    constexpr sunrealtype c_[6] = {SUN_RCONST(0.0),
+                                   SUN_RCONST(1.0) / SUN_RCONST(5.0),
+                                   SUN_RCONST(3.0) / SUN_RCONST(10.0),
+                                   SUN_RCONST(3.0) / SUN_RCONST(5.0),
+                                   SUN_RCONST(1.0),
+                                   SUN_RCONST(7.0) / SUN_RCONST(8.0)};
+    return c_[j];
+  }
+
+  static constexpr sunrealtype d(int j)
+  {
+    constexpr sunrealtype d_[6] = {SUN_RCONST(2825.0) / SUN_RCONST(27648.0),
+                                   SUN_RCONST(0.0),
+                                   SUN_RCONST(18575.0) / SUN_RCONST(48384.0),
+                                   SUN_RCONST(13525.0) / SUN_RCONST(55296.0),
+                                   SUN_RCONST(277.0) / SUN_RCONST(14336.0),
+                                   SUN_RCONST(1.0) / SUN_RCONST(4.0)};
+    return d_[j];
+  }
+};
+
+template<>
+struct ERKTable<ARKODE_DORMAND_PRINCE_7_4_5>
+{
+  static constexpr int stages = 7;
+  static constexpr int q      = 5;
+  static constexpr int p      = 4;
+
+  static constexpr sunrealtype A(int i, int j)
+  {
+    constexpr sunrealtype A_[7][7] =
+      {{SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0)},
+       {SUN_RCONST(1.0) / SUN_RCONST(5.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0)},
+       {SUN_RCONST(3.0) / SUN_RCONST(40.0), SUN_RCONST(9.0) / SUN_RCONST(40.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0)},
+       {SUN_RCONST(44.0) / SUN_RCONST(45.0),
+        SUN_RCONST(-56.0) / SUN_RCONST(15.0),
+        SUN_RCONST(32.0) / SUN_RCONST(9.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0)},
+       {SUN_RCONST(19372.0) / SUN_RCONST(6561.0),
+        SUN_RCONST(-25360.0) / SUN_RCONST(2187.0),
+        SUN_RCONST(64448.0) / SUN_RCONST(6561.0),
+        SUN_RCONST(-212.0) / SUN_RCONST(729.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0)},
+       {SUN_RCONST(9017.0) / SUN_RCONST(3168.0),
+        SUN_RCONST(-355.0) / SUN_RCONST(33.0),
+        SUN_RCONST(46732.0) / SUN_RCONST(5247.0),
+        SUN_RCONST(49.0) / SUN_RCONST(176.0),
+        SUN_RCONST(-5103.0) / SUN_RCONST(18656.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0)},
+       {SUN_RCONST(35.0) / SUN_RCONST(384.0), SUN_RCONST(0.0),
+        SUN_RCONST(500.0) / SUN_RCONST(1113.0),
+        SUN_RCONST(125.0) / SUN_RCONST(192.0),
+        SUN_RCONST(-2187.0) / SUN_RCONST(6784.0),
+        SUN_RCONST(11.0) / SUN_RCONST(84.0), SUN_RCONST(0.0)}};
+    return A_[i][j];
+  }
+
+  static constexpr sunrealtype b(int j)
+  {
+    constexpr sunrealtype b_[7] = {SUN_RCONST(35.0) / SUN_RCONST(384.0),
+                                   SUN_RCONST(0.0),
+                                   SUN_RCONST(500.0) / SUN_RCONST(1113.0),
+                                   SUN_RCONST(125.0) / SUN_RCONST(192.0),
+                                   SUN_RCONST(-2187.0) / SUN_RCONST(6784.0),
+                                   SUN_RCONST(11.0) / SUN_RCONST(84.0),
+                                   SUN_RCONST(0.0)};
+    return b_[j];
+  }
+
+  static constexpr sunrealtype c(int j)
+  {
+    constexpr sunrealtype c_[7] = {SUN_RCONST(0.0),
+                                   SUN_RCONST(1.0) / SUN_RCONST(5.0),
+                                   SUN_RCONST(3.0) / SUN_RCONST(10.0),
+                                   SUN_RCONST(4.0) / SUN_RCONST(5.0),
+                                   SUN_RCONST(8.0) / SUN_RCONST(9.0),
+                                   SUN_RCONST(1.0), SUN_RCONST(1.0)};
+    return c_[j];
+  }
+
+  static constexpr sunrealtype d(int j)
+  {
+    constexpr sunrealtype d_[7] = {SUN_RCONST(5179.0) / SUN_RCONST(57600.0),
+                                   SUN_RCONST(0.0),
+                                   SUN_RCONST(7571.0) / SUN_RCONST(16695.0),
+                                   SUN_RCONST(393.0) / SUN_RCONST(640.0),
+                                   SUN_RCONST(-92097.0) / SUN_RCONST(339200.0),
+                                   SUN_RCONST(187.0) / SUN_RCONST(2100.0),
+                                   SUN_RCONST(1.0) / SUN_RCONST(40.0)};
+    return d_[j];
+  }
+};
+
+template<>
+struct ERKTable<ARKODE_VERNER_8_5_6>
+{
+  static constexpr int stages = 8;
+  static constexpr int q      = 6;
+  static constexpr int p      = 5;
+
+  static constexpr sunrealtype A(int i, int j)
+  {
+    constexpr sunrealtype A_[8][8] =
+      {{SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0)},
+       {SUN_RCONST(1.0) / SUN_RCONST(6.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0)},
+       {SUN_RCONST(4.0) / SUN_RCONST(75.0), SUN_RCONST(16.0) / SUN_RCONST(75.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0)},
+       {SUN_RCONST(5.0) / SUN_RCONST(6.0), SUN_RCONST(-8.0) / SUN_RCONST(3.0),
+        SUN_RCONST(5.0) / SUN_RCONST(2.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0)},
+       {SUN_RCONST(-165.0) / SUN_RCONST(64.0),
+        SUN_RCONST(55.0) / SUN_RCONST(6.0),
+        SUN_RCONST(-425.0) / SUN_RCONST(64.0),
+        SUN_RCONST(85.0) / SUN_RCONST(96.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0)},
+       {SUN_RCONST(12.0) / SUN_RCONST(5.0), SUN_RCONST(-8.0),
+        SUN_RCONST(4015.0) / SUN_RCONST(612.0),
+        SUN_RCONST(-11.0) / SUN_RCONST(36.0),
+        SUN_RCONST(88.0) / SUN_RCONST(255.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0)},
+       {SUN_RCONST(-8263.0) / SUN_RCONST(15000.0),
+        SUN_RCONST(124.0) / SUN_RCONST(75.0),
+        SUN_RCONST(-643.0) / SUN_RCONST(680.0),
+        SUN_RCONST(-81.0) / SUN_RCONST(250.0),
+        SUN_RCONST(2484.0) / SUN_RCONST(10625.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0)},
+       {SUN_RCONST(3501.0) / SUN_RCONST(1720.0),
+        SUN_RCONST(-300.0) / SUN_RCONST(43.0),
+        SUN_RCONST(297275.0) / SUN_RCONST(52632.0),
+        SUN_RCONST(-319.0) / SUN_RCONST(2322.0),
+        SUN_RCONST(24068.0) / SUN_RCONST(84065.0), SUN_RCONST(0.0),
+        SUN_RCONST(3850.0) / SUN_RCONST(26703.0), SUN_RCONST(0.0)}};
+    return A_[i][j];
+  }
+
+  static constexpr sunrealtype b(int j)
+  {
+    constexpr sunrealtype b_[8] = {SUN_RCONST(3.0) / SUN_RCONST(40.0),
+                                   SUN_RCONST(0.0),
+                                   SUN_RCONST(875.0) / SUN_RCONST(2244.0),
+                                   SUN_RCONST(23.0) / SUN_RCONST(72.0),
+                                   SUN_RCONST(264.0) / SUN_RCONST(1955.0),
+                                   SUN_RCONST(0.0),
+                                   SUN_RCONST(125.0) / SUN_RCONST(11592.0),
+                                   SUN_RCONST(43.0) / SUN_RCONST(616.0)};
+    return b_[j];
+  }
+
+  static constexpr sunrealtype c(int j)
+  {
+    constexpr sunrealtype c_[8] = {SUN_RCONST(0.0),
+                                   SUN_RCONST(1.0) / SUN_RCONST(6.0),
+                                   SUN_RCONST(4.0) / SUN_RCONST(15.0),
+                                   SUN_RCONST(2.0) / SUN_RCONST(3.0),
+                                   SUN_RCONST(5.0) / SUN_RCONST(6.0),
+                                   SUN_RCONST(1.0),
+                                   SUN_RCONST(1.0) / SUN_RCONST(15.0),
+                                   SUN_RCONST(1.0)};
+    return c_[j];
+  }
+
+  static constexpr sunrealtype d(int j)
+  {
+    constexpr sunrealtype d_[8] = {SUN_RCONST(13.0) / SUN_RCONST(160.0),
+                                   SUN_RCONST(0.0),
+                                   SUN_RCONST(2375.0) / SUN_RCONST(5984.0),
+                                   SUN_RCONST(5.0) / SUN_RCONST(16.0),
+                                   SUN_RCONST(12.0) / SUN_RCONST(85.0),
+                                   SUN_RCONST(3.0) / SUN_RCONST(44.0),
+                                   SUN_RCONST(0.0), SUN_RCONST(0.0)};
+    return d_[j];
+  }
+};
+
+template<>
+struct ERKTable<ARKODE_VERNER_9_5_6>
+{
+  static constexpr int stages = 9;
+  static constexpr int q      = 6;
+  static constexpr int p      = 5;
+
+  static constexpr sunrealtype A(int i, int j)
+  {
+    constexpr sunrealtype A_[9][9] =
+      {{SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0)},
+       {SUN_RCONST(0.06), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0)},
+       {SUN_RCONST(0.01923996296296296218408805600574851268902),
+        SUN_RCONST(0.07669337037037037008158080197972594760358),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0)},
+       {SUN_RCONST(0.035975), SUN_RCONST(0.0), SUN_RCONST(0.107925),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0)},
+       {SUN_RCONST(1.318683415233148359391179837984964251518), SUN_RCONST(0.0),
+        SUN_RCONST(-5.042058063628561903612990136025473475456),
+        SUN_RCONST(4.220674648395413619539340288611128926277), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0)},
+       {SUN_RCONST(-41.87259166432750845388000016100704669952), SUN_RCONST(0.0),
+        SUN_RCONST(159.432562163137475863550207577645778656),
+        SUN_RCONST(-122.1192135650100425436903606168925762177),
+        SUN_RCONST(5.531743066200053071668207849143072962761), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0)},
+       {SUN_RCONST(-54.43015693531650356362661113962531089783), SUN_RCONST(0.0),
+        SUN_RCONST(207.0672513650184782818541862070560455322),
+        SUN_RCONST(-158.6108137845899932472093496471643447876),
+        SUN_RCONST(6.99181658595024213553870140458457171917),
+        SUN_RCONST(-0.01859723106220323093906721112489321967587),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0)},
+       {SUN_RCONST(-54.66374178728197819054912542924284934998), SUN_RCONST(0.0),
+        SUN_RCONST(207.9528062553893619224254507571458816528),
+        SUN_RCONST(-159.2889574744995115906931459903717041016),
+        SUN_RCONST(7.018743740796944408089075295720249414444),
+        SUN_RCONST(-0.01833878590504572220210022237552038859576),
+        SUN_RCONST(-0.000511948499788209866745436471546781831421),
+        SUN_RCONST(0.0), SUN_RCONST(0.0)},
+       {SUN_RCONST(0.0343895786835703570760713887466408777982), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.2582624555633503682372520415810868144035),
+        SUN_RCONST(0.4209371189673536961528554911637911573052),
+        SUN_RCONST(4.405396469669310199890333024086430668831),
+        SUN_RCONST(-176.4831190242986451721662888303399085999),
+        SUN_RCONST(172.3641334014150743314530700445175170898),
+        SUN_RCONST(0.0)}};
+    return A_[i][j];
+  }
+
+  static constexpr sunrealtype b(int j)
+  {
+    constexpr sunrealtype b_[9] =
+      {SUN_RCONST(0.0343895786835703570760713887466408777982), SUN_RCONST(0.0),
+       SUN_RCONST(0.0), SUN_RCONST(0.2582624555633503682372520415810868144035),
+       SUN_RCONST(0.4209371189673536961528554911637911573052),
+       SUN_RCONST(4.405396469669310199890333024086430668831),
+       SUN_RCONST(-176.4831190242986451721662888303399085999),
+       SUN_RCONST(172.3641334014150743314530700445175170898), SUN_RCONST(0.0)};
+    return b_[j];
+  }
+
+  static constexpr sunrealtype c(int j)
+  {
+    constexpr sunrealtype c_[9] =
+      {SUN_RCONST(0.0), SUN_RCONST(0.06),
+       SUN_RCONST(0.09593333333333333333333333333333333333333),
+       SUN_RCONST(0.1439), SUN_RCONST(0.4973), SUN_RCONST(0.9725),
+       SUN_RCONST(0.9995), SUN_RCONST(1.0), SUN_RCONST(1.0)};
+    return c_[j];
+  }
+
+  static constexpr sunrealtype d(int j)
+  {
+    constexpr sunrealtype d_[9] =
+      {SUN_RCONST(0.04909967648382489863179145572757988702506), SUN_RCONST(0.0),
+       SUN_RCONST(0.0), SUN_RCONST(0.2251112229516524232408869465871248394251),
+       SUN_RCONST(0.4694682253029561769253064085205551236868),
+       SUN_RCONST(0.806579224998886790132246460416354238987), SUN_RCONST(0.0),
+       SUN_RCONST(-0.607119489177795901291290192602900788188),
+       SUN_RCONST(0.05686113944047568868889186433079885318875)};
+    return d_[j];
+  }
+};
+
+template<>
+struct ERKTable<ARKODE_VERNER_10_6_7>
+{
+  static constexpr int stages = 10;
+  static constexpr int q      = 7;
+  static constexpr int p      = 6;
+
+  static constexpr sunrealtype A(int i, int j)
+  {
+    constexpr sunrealtype A_[10][10] =
+      {{SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0)},
+       {SUN_RCONST(0.005), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0)},
+       {SUN_RCONST(-1.076790123456790123456790123456790123457),
+        SUN_RCONST(1.185679012345679012345679012345679012346), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0)},
+       {SUN_RCONST(0.04083333333333333333333333333333333333333),
+        SUN_RCONST(0.0), SUN_RCONST(0.1225), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0)},
+       {SUN_RCONST(0.6389139236255726439495106205868069082499), SUN_RCONST(0.0),
+        SUN_RCONST(-2.45567263822365688952231721486896276474),
+        SUN_RCONST(2.272258714598084150537715686368755996227), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0)},
+       {SUN_RCONST(-2.661577375018756796976049372460693120956), SUN_RCONST(0.0),
+        SUN_RCONST(10.80451388645613874928130826447159051895),
+        SUN_RCONST(-8.353914657396199316963247838430106639862),
+        SUN_RCONST(0.8204875949566569071080834874010179191828), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0)},
+       {SUN_RCONST(6.067741434696771740675558248767629265785), SUN_RCONST(0.0),
+        SUN_RCONST(-24.71127363591108760942915978375822305679),
+        SUN_RCONST(20.42751793078889477328630164265632629395),
+        SUN_RCONST(-1.906157978816647169395537275704555213451),
+        SUN_RCONST(1.006172249242067939789535557792987674475), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0)},
+       {SUN_RCONST(12.05467007625320441377425595419481396675), SUN_RCONST(0.0),
+        SUN_RCONST(-49.75478495046898785858502378687262535095),
+        SUN_RCONST(41.14288863860467415634047938510775566101),
+        SUN_RCONST(-4.461760149974003830664059933042153716087),
+        SUN_RCONST(2.042334822239175284863677006796933710575),
+        SUN_RCONST(-0.0983484366540610666085342472797492519021),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0)},
+       {SUN_RCONST(10.13814652288180795380867493804544210434), SUN_RCONST(0.0),
+        SUN_RCONST(-42.64113603171750099818382295779883861542),
+        SUN_RCONST(35.76384003992257021309342235326766967773),
+        SUN_RCONST(-4.348022840392907539808220462873578071594),
+        SUN_RCONST(2.009862268377035743327496675192378461361),
+        SUN_RCONST(0.3487490460338271702767087845131754875183),
+        SUN_RCONST(-0.2714390051048312657577810114162275567651),
+        SUN_RCONST(0.0), SUN_RCONST(0.0)},
+       {SUN_RCONST(-45.03007203429867644217665656469762325287), SUN_RCONST(0.0),
+        SUN_RCONST(187.3272437654588884470285847783088684082),
+        SUN_RCONST(-154.0288236935018630902050063014030456543),
+        SUN_RCONST(18.56465306347536170505918562412261962891),
+        SUN_RCONST(-7.141809679295079149596858769655227661133),
+        SUN_RCONST(1.3088085781613787439425777847645804286), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0)}};
+    return A_[i][j];
+  }
+
+  static constexpr sunrealtype b(int j)
+  {
+    constexpr sunrealtype b_[10] =
+      {SUN_RCONST(0.04715561848627222024665783806085528340191), SUN_RCONST(0.0),
+       SUN_RCONST(0.0), SUN_RCONST(0.2575056429843415317648691598151344805956),
+       SUN_RCONST(0.2621665397741262393260797125549288466573),
+       SUN_RCONST(0.1521609265673855848621798259046045131981),
+       SUN_RCONST(0.4939969170032484924171001239301403984427),
+       SUN_RCONST(-0.2943031171403250323415079492406221106648),
+       SUN_RCONST(0.08131747232495110944139327102675451897085),
+       SUN_RCONST(0.0)};
+    return b_[j];
+  }
+
+  static constexpr sunrealtype c(int j)
+  {
+    constexpr sunrealtype c_[10] =
+      {SUN_RCONST(0.0), SUN_RCONST(0.005),
+       SUN_RCONST(0.1088888888888888888888888888888888888889),
+       SUN_RCONST(0.1633333333333333333333333333333333333333),
+       SUN_RCONST(0.4555),
+       SUN_RCONST(0.6095094489978380991601625282783061265945),
+       SUN_RCONST(0.884), SUN_RCONST(0.925), SUN_RCONST(1.0), SUN_RCONST(1.0)};
+    return c_[j];
+  }
+
+  static constexpr sunrealtype d(int j)
+  {
+    constexpr sunrealtype d_[10] =
+      {SUN_RCONST(0.04460860660634117375034080055229424033314), SUN_RCONST(0.0),
+       SUN_RCONST(0.0), SUN_RCONST(0.2671640378571372709259890143584925681353),
+       SUN_RCONST(0.2201018300177293163244485185714438557625),
+       SUN_RCONST(0.2188431703143156881186115469972719438374),
+       SUN_RCONST(0.2289871705411202773561285539472009986639), SUN_RCONST(0.0),
+       SUN_RCONST(0.0),
+       SUN_RCONST(0.02029518466335628046337546948052477091551)};
+    return d_[j];
+  }
+};
+
+template<>
+struct ERKTable<ARKODE_VERNER_13_7_8>
+{
+  static constexpr int stages = 13;
+  static constexpr int q      = 8;
+  static constexpr int p      = 7;
+
+  static constexpr sunrealtype A(int i, int j)
+  {
+    constexpr sunrealtype A_[13][13] =
+      {{SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0)},
+       {SUN_RCONST(0.05), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0)},
+       {SUN_RCONST(-0.006993164062499999597544153573380754096434),
+        SUN_RCONST(0.1135556640625000057731597280508140102029), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0)},
+       {SUN_RCONST(0.0399609375), SUN_RCONST(0.0), SUN_RCONST(0.1198828125),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0)},
+       {SUN_RCONST(0.3613975628004575391116759419674053788185), SUN_RCONST(0.0),
+        SUN_RCONST(-1.341524066700492845427561405813321471214),
+        SUN_RCONST(1.370126503900035208616259296832140535116), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0)},
+       {SUN_RCONST(0.04904720279720279491053602782812959048897),
+        SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.2350972042214404811311112553084967657924),
+        SUN_RCONST(0.1808555929813567275665775468951324000955), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0)},
+       {SUN_RCONST(0.06169289044289043982827180911954201292247),
+        SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.112365683146402772774052891691098921001),
+        SUN_RCONST(-0.03885046071451366683779937716280983295292),
+        SUN_RCONST(0.01979188712522046006414555563424073625356),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0)},
+       {SUN_RCONST(-1.767630240222326953869469434721395373344), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(-62.5),
+        SUN_RCONST(-6.061889377376669330033109872601926326752),
+        SUN_RCONST(5.6508231982227634659921022830531001091),
+        SUN_RCONST(65.6216964193762350987526588141918182373), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0)},
+       {SUN_RCONST(-1.180945066554970779293398663867264986038), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(-41.50473441114321104805640061385929584503),
+        SUN_RCONST(-4.434438319103724879255423729773610830307),
+        SUN_RCONST(4.26040818858613334896290325559675693512),
+        SUN_RCONST(43.75364022446171219371535698883235454559),
+        SUN_RCONST(0.007871425489912309975126802896738809067756),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0)},
+       {SUN_RCONST(-1.281405999441488363643770753697026520967), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(-45.04713996013986587740873801521956920624),
+        SUN_RCONST(-4.731362069449575713520061981398612260818),
+        SUN_RCONST(4.514967016593807613844546722248196601868),
+        SUN_RCONST(47.4490955717298490412758837919682264328),
+        SUN_RCONST(0.01059228297111661047658071055366235668771),
+        SUN_RCONST(-0.005746842263844615696088968803678653785028),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0)},
+       {SUN_RCONST(-1.724470134262485077059068316884804517031), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(-60.92349008483054007001555874012410640717),
+        SUN_RCONST(-5.951518376222391992769189528189599514008),
+        SUN_RCONST(5.55652373069845673114741657627746462822),
+        SUN_RCONST(63.98301198033306036450085230171680450439),
+        SUN_RCONST(0.01464202825041496271174512600055095390417),
+        SUN_RCONST(0.06460408772358203211005900357122300192714),
+        SUN_RCONST(-0.07930323169008879347074980614706873893738),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0)},
+       {SUN_RCONST(-3.30162266774707902072805154602974653244), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(-118.0112723597525103969019255600869655609),
+        SUN_RCONST(-10.14142238845611210251718148356303572655),
+        SUN_RCONST(9.139311332232058049385159392841160297394),
+        SUN_RCONST(123.3759428284042769519146531820297241211),
+        SUN_RCONST(4.623244378874581173022306757047772407532),
+        SUN_RCONST(-3.383277738068201756505004595965147018433),
+        SUN_RCONST(4.527592100324618229478801367804408073425),
+        SUN_RCONST(-5.828495485811623133542980212951079010963), SUN_RCONST(0.0),
+        SUN_RCONST(0.0)},
+       {SUN_RCONST(-3.039515033766308604867845133412629365921), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(-109.260868089417627402326615992933511734),
+        SUN_RCONST(-9.290642497400291688336437800899147987366),
+        SUN_RCONST(8.43050498176491203139448771253228187561),
+        SUN_RCONST(114.2010010378331372749016736634075641632),
+        SUN_RCONST(-0.9637271342145479202656588313402608036995),
+        SUN_RCONST(-5.034884088802189516798080148873850703239),
+        SUN_RCONST(5.958130824002923375815043982584029436111), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0)}};
+    return A_[i][j];
+  }
+
+  static constexpr sunrealtype b(int j)
+  {
+    constexpr sunrealtype b_[13] =
+      {SUN_RCONST(0.04427989419007950788742533632103004492819), SUN_RCONST(0.0),
+       SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+       SUN_RCONST(0.3541049391724448991425333588267676532269),
+       SUN_RCONST(0.2479692154956437688539949704136233776808),
+       SUN_RCONST(-15.69420203883808540012978482991456985474),
+       SUN_RCONST(25.08406496555856435293208051007241010666),
+       SUN_RCONST(-31.73836778626027665950459777377545833588),
+       SUN_RCONST(22.93828327398878386134128959383815526962),
+       SUN_RCONST(-0.2361324633071542056228508954518474638462),
+       SUN_RCONST(0.0)};
+    return b_[j];
+  }
+
+  static constexpr sunrealtype c(int j)
+  {
+    constexpr sunrealtype c_[13] =
+      {SUN_RCONST(0.0), SUN_RCONST(0.05), SUN_RCONST(0.1065625),
+       SUN_RCONST(0.15984375), SUN_RCONST(0.39), SUN_RCONST(0.465),
+       SUN_RCONST(0.155), SUN_RCONST(0.943),
+       SUN_RCONST(0.9018020417358569851273841777583584189415),
+       SUN_RCONST(0.909), SUN_RCONST(0.94), SUN_RCONST(1.0), SUN_RCONST(1.0)};
+    return c_[j];
+  }
+
+  static constexpr sunrealtype d(int j)
+  {
+    constexpr sunrealtype d_[13] =
+      {SUN_RCONST(0.04431261522908979538781792939516890328377), SUN_RCONST(0.0),
+       SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+       SUN_RCONST(0.3546095642343226606030270886549260467291),
+       SUN_RCONST(0.2478480431366653080615947146725375205278),
+       SUN_RCONST(4.448134732475784502980786783155053853989),
+       SUN_RCONST(19.8468863661187349123338208300992846489),
+       SUN_RCONST(-23.58162337746561831863800762221217155457), SUN_RCONST(0.0),
+       SUN_RCONST(0.0),
+       SUN_RCONST(-0.3601679437289775354003040774841792881489)};
+    return d_[j];
+  }
+};
+
+template<>
+struct ERKTable<ARKODE_VERNER_16_8_9>
+{
+  static constexpr int stages = 16;
+  static constexpr int q      = 9;
+  static constexpr int p      = 8;
+
+  static constexpr sunrealtype A(int i, int j)
+  {
+    constexpr sunrealtype A_[16][16] =
+      {{SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0)},
+       {SUN_RCONST(0.3462e-1), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0)},
+       {SUN_RCONST(-0.389335438857287327017042687229284478532e-1),
+        SUN_RCONST(0.1359578945245091786499878854939346230295), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0)},
+       {SUN_RCONST(0.3638413148954266723060635628912731569111e-1),
+        SUN_RCONST(0.0), SUN_RCONST(0.1091523944686280016918190688673819470733),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0)},
+       {SUN_RCONST(2.025763914393969636805657604282571047511), SUN_RCONST(0.0),
+        SUN_RCONST(-7.638023836496292020387602153091964592952),
+        SUN_RCONST(6.173259922102322383581944548809393545442), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0)},
+       {SUN_RCONST(0.5112275589406060872792270881648288397197e-1),
+        SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.1770823794555021537929910813839068684087),
+        SUN_RCONST(0.80277624092225014536138698108025283759e-3),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0)},
+       {SUN_RCONST(0.1316006357975216279279871693164256985334), SUN_RCONST(0.0),
+        SUN_RCONST(0.0),
+        SUN_RCONST(-0.2957276252669636417685183174672273730699),
+        SUN_RCONST(0.878137803564295237421124704053886667082e-1),
+        SUN_RCONST(0.6213052975225274774321435005639430026100), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0)},
+       {SUN_RCONST(0.7166666666666666666666666666666666666667e-1),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.3305533578915319409260346730051472207728),
+        SUN_RCONST(0.2427799754418013924072986603281861125606), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0)},
+       {SUN_RCONST(0.7180664062500000000000000000000000000000e-1),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.3294380283228177160744825466257672816401),
+        SUN_RCONST(0.1165190029271822839255174533742327183599),
+        SUN_RCONST(-0.3401367187500000000000000000000000000000e-1),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0)},
+       {SUN_RCONST(0.4836757646340646986611287718844085773549e-1),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.3928989925676163974333190042057047002852e-1),
+        SUN_RCONST(0.1054740945890344608263649267140088017604),
+        SUN_RCONST(-0.2143865284648312665982642293830533996214e-1),
+        SUN_RCONST(-0.1041229174627194437759832813847147895623),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0)},
+       {SUN_RCONST(-0.2664561487201478635337289243849737340534e-1),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.3333333333333333333333333333333333333333e-1),
+        SUN_RCONST(-0.1631072244872467239162704487554706387141),
+        SUN_RCONST(0.3396081684127761199487954930015522928244e-1),
+        SUN_RCONST(0.1572319413814626097110769806810024118077),
+        SUN_RCONST(0.2152267478031879552303534778794770376960), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(0.0)},
+       {SUN_RCONST(0.3689009248708622334786359863227633989718e-1),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(-0.1465181576725542928653609891758501156785),
+        SUN_RCONST(0.2242577768172024345345469822625833796001),
+        SUN_RCONST(0.2294405717066072637090897902753790803034e-1),
+        SUN_RCONST(-0.35850052905728761357394424889330334334e-2),
+        SUN_RCONST(0.8669223316444385506869203619044453906053e-1),
+        SUN_RCONST(0.4383840651968337846196219974168630120572), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0)},
+       {SUN_RCONST(-0.4866012215113340846662212357570395295088),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(-6.304602650282852990657772792012007122988),
+        SUN_RCONST(-0.281245618289472564778284183790118418111),
+        SUN_RCONST(-2.679019236219849057687906597489223155566),
+        SUN_RCONST(0.518815663924157511565311164615012522024),
+        SUN_RCONST(1.365353187603341710683633635235238678626),
+        SUN_RCONST(5.885091088503946585721274891680604830712),
+        SUN_RCONST(2.802808786272062889819965117517532194812), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0)},
+       {SUN_RCONST(0.4185367457753471441471025246471931649633), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(6.724547581906459363100870806514855026676),
+        SUN_RCONST(-0.425444280164611790606983409697113064616),
+        SUN_RCONST(3.343279153001265577811816947557982637749),
+        SUN_RCONST(0.617081663117537759528421117507709784737),
+        SUN_RCONST(-0.929966123939932833937749523988800852013),
+        SUN_RCONST(-6.099948804751010722472962837945508844846),
+        SUN_RCONST(-3.002206187889399044804158084895173690015),
+        SUN_RCONST(0.2553202529443445472336424602988558373637), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0)},
+       {SUN_RCONST(-0.779374086122884664644623040843840506343), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(-13.93734253810777678786523664804936051203),
+        SUN_RCONST(1.252048853379357320949735183924200895136),
+        SUN_RCONST(-14.69150040801686878191527989293072091588),
+        SUN_RCONST(-0.494705058533141685655191992136962873577),
+        SUN_RCONST(2.242974909146236657906984549543692874755),
+        SUN_RCONST(13.36789380382864375813864978592679139881),
+        SUN_RCONST(14.39665048665068644512236935340272139005),
+        SUN_RCONST(-0.7975813331776800379127866056663258667437),
+        SUN_RCONST(0.4409353709534277758753793068298041158235), SUN_RCONST(0.0),
+        SUN_RCONST(0.0)},
+       {SUN_RCONST(2.058051337466886442151242368989994043993), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+        SUN_RCONST(22.35793772796803295519317565842520212899),
+        SUN_RCONST(0.90949810997556332745009198137971890783),
+        SUN_RCONST(35.89110098240264104710550686568482456493),
+        SUN_RCONST(-3.442515027624453437985000403608480262211),
+        SUN_RCONST(-4.865481358036368826566013387928704014496),
+        SUN_RCONST(-18.90980381354342625688427480879773032857),
+        SUN_RCONST(-34.26354448030451782929251177395134170515),
+        SUN_RCONST(1.264756521695642578827783499806516664686), SUN_RCONST(0.0),
+        SUN_RCONST(0.0), SUN_RCONST(0.0)}};
+    return A_[i][j];
+  }
+
+  static constexpr sunrealtype b(int j)
+  {
+    constexpr sunrealtype b_[16] =
+      {SUN_RCONST(0.1461197685842315252051541915018784713459e-1),
+       SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+       SUN_RCONST(0.0), SUN_RCONST(0.0),
+       SUN_RCONST(-0.3915211862331339089410228267288242030810),
+       SUN_RCONST(0.2310932500289506415909675644868993669908),
+       SUN_RCONST(0.1274766769992852382560589467488989175618),
+       SUN_RCONST(0.2246434176204157731566981937082069688984),
+       SUN_RCONST(0.5684352689748512932705226972873692126743),
+       SUN_RCONST(0.5825871557215827200814768021863420902155e-1),
+       SUN_RCONST(0.1364317403482215641609022744494239843327),
+       SUN_RCONST(0.3057013983082797397721005067920369646664e-1),
+       SUN_RCONST(0.0)};
+    return b_[j];
+  }
+
+  static constexpr sunrealtype c(int j)
+  {
+    constexpr sunrealtype c_[16] =
+      {SUN_RCONST(0.0), SUN_RCONST(0.3462e-1),
+       SUN_RCONST(0.9702435063878044594828361677100617517633e-1),
+       SUN_RCONST(0.1455365259581706689224254251565092627645),
+       SUN_RCONST(0.561),
+       SUN_RCONST(0.2290079115904850126662751771814700052182),
+       SUN_RCONST(0.5449920884095149873337248228185299947818),
+       SUN_RCONST(0.645), SUN_RCONST(0.48375), SUN_RCONST(0.6757e-1),
+       SUN_RCONST(0.25), SUN_RCONST(0.6590650618730998549405331618649220295334),
+       SUN_RCONST(0.8206), SUN_RCONST(0.9012), SUN_RCONST(1.0),
+       SUN_RCONST(1.0)};
+    return c_[j];
+  }
+
+  static constexpr sunrealtype d(int j)
+  {
+    constexpr sunrealtype d_[16] =
+      {SUN_RCONST(0.1996996514886773085518508418098868756464e-1),
+       SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0), SUN_RCONST(0.0),
+       SUN_RCONST(0.0), SUN_RCONST(0.0),
+       SUN_RCONST(2.191499304949330054530747099310837524864),
+       SUN_RCONST(0.8857071848208438030833722031786358862953e-1),
+       SUN_RCONST(0.1140560234865965622484956605091432032674),
+       SUN_RCONST(0.2533163805345107065564577734569651977347),
+       SUN_RCONST(-2.056564386240941011158999594595981300493),
+       SUN_RCONST(0.3408096799013119935160094894224543812830), SUN_RCONST(0.0),
+       SUN_RCONST(0.0),
+       SUN_RCONST(0.4834231373823958314376726739772871714902e-1)};
+    return d_[j];
+  }
+};
+
+} // namespace arkode
+} // namespace sundials
+
+#endif
@@ -0,0 +1,298 @@
+/* -----------------------------------------------------------------------------
+ * Programmer(s): Daniel R. Reynolds @ SMU
+ * -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Header-only explicit Runge--Kutta step kernels operating on raw arrays.
+ *
+ * For the tables in arkode_butcher_erk.hpp the stage combinations are
+ * generated at compile time, so every stage update is a single loop over the
+ * state with the nonzero coefficients folded in as constants. Other tables
+ * use a generic loop over an ARKodeButcherTable.
+ *
+ * The right-hand side is any callable with the signature
+ *
+ *   int f(sunrealtype t, const sunrealtype* y, sunrealtype* ydot)
+ *
+ * returning 0 on success. A nonzero value stops the step and is returned.
+ * ---------------------------------------------------------------------------*/
+
+#ifndef _ARKODE_ERKSTEP_KERNELS_HPP
+#define _ARKODE_ERKSTEP_KERNELS_HPP
+
+#include <arkode/arkode.h>
+#include <arkode/arkode_butcher.h>
+#include <arkode/arkode_butcher_erk.h>
+#include <arkode/arkode_butcher_erk.hpp>
+#include <initializer_list>
+#include <sundials/sundials_types.h>
+#include <type_traits>
+#include <utility>
+
+namespace sundials {
+namespace arkode {
+namespace impl {
+
+/* Coefficient accessors for a row of A, b, and the embedding error b - d */
+template<class Table, int I>
+struct RowA
+{
+  static constexpr sunrealtype coef(int j) { return Table::A(I, j); }
+};
+
+template<class Table>
+struct RowB
+{
+  static constexpr sunrealtype coef(int j) { return Table::b(j); }
+};
+
+template<class Table>
+struct RowE
+{
+  static constexpr sunrealtype coef(int j) { return Table::b(j) - Table::d(j); }
+};
+
+/* Add coef(J) * F_J[k] to sum, skipping zero coefficients at compile time */
+template<class Row, int J>
+inline void AddTerm(sunrealtype& sum, const sunrealtype* F, sunindextype n,
+                    sunindextype k, std::true_type)
+{
+  constexpr sunrealtype coef = Row::coef(J);
+  sum += coef * F[J * n + k];
+}
+
+template<class Row, int J>
+inline void AddTerm(sunrealtype&, const sunrealtype*, sunindextype,
+                    sunindextype, std::false_type)
+{}
+
+/* Unrolled sum_j coef(j) * F_j[k] over the stages in J... */
+template<class Row, int... J>
+inline sunrealtype Combine(const sunrealtype* F, sunindextype n, sunindextype k,
+                           std::integer_sequence<int, J...>)
+{
+  sunrealtype sum = SUN_RCONST(0.0);
+  (void)std::initializer_list<int>{
+    0, (AddTerm<Row, J>(sum, F, n, k,
+                        std::integral_constant<bool, Row::coef(J) != 0>{}),
+        0)...};
+  return sum;
+}
+
+/* All stages have been computed */
+template<class Table, int I, class RHS>
+inline int Stages(RHS&, sunrealtype, sunrealtype, sunindextype,
+                  const sunrealtype*, sunrealtype*, sunrealtype*, std::false_type)
+{
+  return 0;
+}
+
+/* Compute stage I and evaluate the RHS, then continue with stage I + 1 */
+template<class Table, int I, class RHS>
+inline int Stages(RHS& f, sunrealtype t, sunrealtype h, sunindextype n,
+                  const sunrealtype* y, sunrealtype* z, sunrealtype* F,
+                  std::true_type)
+{
+  for (sunindextype k = 0; k < n; k++)
+  {
+    z[k] = y[k] + h * Combine<RowA<Table, I>>(F, n, k,
+                                              std::make_integer_sequence<int, I>{});
+  }
+
+  int retval = f(t + Table::c(I) * h, z, F + I * n);
+  if (retval != 0) { return retval; }
+
+  return Stages<Table, I + 1>(f, t, h, n, y, z, F,
+                              std::integral_constant<bool, (I + 1 < Table::stages)>{});
+}
+
+/* Generic step with the coefficients read from a Butcher table at runtime */
+template<class RHS>
+int ERKStepGeneric(ARKodeButcherTable B, RHS& f, sunrealtype t, sunrealtype h,
+                   sunindextype n, const sunrealtype* y, sunrealtype* ynew,
+                   sunrealtype* yerr, sunrealtype* work)
+{
+  const int stages = B->stages;
+  sunrealtype* F   = work;
+  sunrealtype* z   = work + stages * n;
+
+  int retval = f(t, y, F);
+  if (retval != 0) { return retval; }
+
+  for (int i = 1; i < stages; i++)
+  {
+    for (sunindextype k = 0; k < n; k++)
+    {
+      sunrealtype sum = SUN_RCONST(0.0);
+      for (int j = 0; j < i; j++) { sum += B->A[i][j] * F[j * n + k]; }
+      z[k] = y[k] + h * sum;
+    }
+
+    retval = f(t + B->c[i] * h, z, F + i * n);
+    if (retval != 0) { return retval; }
+  }
+
+  for (sunindextype k = 0; k < n; k++)
+  {
+    sunrealtype sum = SUN_RCONST(0.0);
+    for (int j = 0; j < stages; j++) { sum += B->b[j] * F[j * n + k]; }
+    ynew[k] = y[k] + h * sum;
+  }
+
+  if (yerr != nullptr && B->d != nullptr)
+  {
+    for (sunindextype k = 0; k < n; k++)
+    {
+      sunrealtype sum = SUN_RCONST(0.0);
+      for (int j = 0; j < stages; j++)
+      {
+        sum += (B->b[j] - B->d[j]) * F[j * n + k];
+      }
+      yerr[k] = h * sum;
+    }
+  }
+
+  return 0;
+}
+
+} // namespace impl
+
+/*
+ * Take one step of size h from (t, y) with the compile-time table Table,
+ * e.g., ERKTable<ARKODE_DORMAND_PRINCE_7_4_5>.
+ *
+ * On return ynew holds the new solution and, if yerr is not null, yerr holds
+ * the embedded error estimate h * sum_j (b_j - d_j) F_j. The array work must
+ * hold (Table::stages + 1) * n values. ynew may not alias y.
+ */
+template<class Table, class RHS>
+int ERKStepKernel(RHS&& f, sunrealtype t, sunrealtype h, sunindextype n,
+                  const sunrealtype* y, sunrealtype* ynew, sunrealtype* yerr,
+                  sunrealtype* work)
+{
+  constexpr int stages = Table::stages;
+  sunrealtype* F       = work;
+  sunrealtype* z       = work + stages * n;
+
+  int retval = f(t, y, F);
+  if (retval != 0) { return retval; }
+
+  retval = impl::Stages<Table, 1>(f, t, h, n, y, z, F,
+                                  std::integral_constant<bool, (stages > 1)>{});
+  if (retval != 0) { return retval; }
+
+  for (sunindextype k = 0; k < n; k++)
+  {
+    ynew[k] = y[k] + h * impl::Combine<impl::RowB<Table>>(
+                           F, n, k, std::make_integer_sequence<int, stages>{});
+  }
+
+  if (yerr != nullptr && Table::p > 0)
+  {
+    for (sunindextype k = 0; k < n; k++)
+    {
+      yerr[k] = h * impl::Combine<impl::RowE<Table>>(
+                      F, n, k, std::make_integer_sequence<int, stages>{});
+    }
+  }
+
+  return 0;
+}
+
+/*
+ * Explicit Runge--Kutta step kernel selected at runtime by table ID.
+ *
+ * Tables listed in ARKODE_ERK_CONSTEXPR_TABLES dispatch to the compile-time
+ * specialized ERKStepKernel, all other tables use a generic loop over the
+ * coefficients loaded with ARKodeButcherTable_LoadERK.
+ */
+class ERKKernel
+{
+public:
+  explicit ERKKernel(ARKODE_ERKTableID id)
+    : id_(id), B_(ARKodeButcherTable_LoadERK(id))
+  {}
+
+  ERKKernel(ERKKernel&& other) noexcept : id_(other.id_), B_(other.B_)
+  {
+    other.B_ = nullptr;
+  }
+
+  ERKKernel& operator=(ERKKernel&& rhs) noexcept
+  {
+    std::swap(id_, rhs.id_);
+    std::swap(B_, rhs.B_);
+    return *this;
+  }
+
+  ERKKernel(const ERKKernel&)            = delete;
+  ERKKernel& operator=(const ERKKernel&) = delete;
+
+  ~ERKKernel() { ARKodeButcherTable_Free(B_); }
+
+  /* False if the table ID is not a valid ERK table */
+  bool IsValid() const { return B_ != nullptr; }
+
+  /* True if steps use a compile-time specialized kernel */
+  bool IsSpecialized() const
+  {
+    switch (id_)
+    {
+#define ARK_ERK_KERNEL_CASE(name) case name:
+      ARKODE_ERK_CONSTEXPR_TABLES(ARK_ERK_KERNEL_CASE)
+#undef ARK_ERK_KERNEL_CASE
+      return true;
+    default: return false;
+    }
+  }
+
+  int Stages() const { return B_ ? B_->stages : 0; }
+
+  int Order() const { return B_ ? B_->q : 0; }
+
+  int EmbeddingOrder() const { return B_ ? B_->p : 0; }
+
+  /* Length of the work array required by Step */
+  sunindextype WorkspaceSize(sunindextype n) const
+  {
+    return (Stages() + 1) * n;
+  }
+
+  /* Take one step, see ERKStepKernel. Returns ARK_ILL_INPUT if the table is
+     not valid, otherwise 0 or the first nonzero value returned by f. */
+  template<class RHS>
+  int Step(RHS&& f, sunrealtype t, sunrealtype h, sunindextype n,
+           const sunrealtype* y, sunrealtype* ynew, sunrealtype* yerr,
+           sunrealtype* work) const
+  {
+    if (B_ == nullptr) { return ARK_ILL_INPUT; }
+
+    switch (id_)
+    {
+#define ARK_ERK_KERNEL_CASE(name) \
+  case name:                      \
+    return ERKStepKernel<ERKTable<name>>(f, t, h, n, y, ynew, yerr, work);
+      ARKODE_ERK_CONSTEXPR_TABLES(ARK_ERK_KERNEL_CASE)
+#undef ARK_ERK_KERNEL_CASE
+    default:
+      return impl::ERKStepGeneric(B_, f, t, h, n, y, ynew, yerr, work);
+    }
+  }
+
+private:
+  ARKODE_ERKTableID id_;
+  ARKodeButcherTable B_;
+};
+
+} // namespace arkode
+} // namespace sundials
+
+#endif
@@ -20,6 +20,7 @@
 #include <sundials/sundials_direct.h>
 #include <sundials/sundials_iterative.h>
 #include <sundials/sundials_linearsolver.h>
+#include <sundials/sundials_linsyscapture.h>
 #include <sundials/sundials_matrix.h>
 #include <sundials/sundials_nvector.h>
 
@@ -77,6 +78,9 @@ typedef int (*ARKLsLinSysFn)(sunrealtype t, N_Vector y, N_Vector fy,
                              void* user_data, N_Vector tmp1, N_Vector tmp2,
                              N_Vector tmp3);
 
+typedef int (*ARKLsRhsBatchFn)(int nbatch, sunrealtype t, N_Vector* y,
+                               N_Vector* ydot, void* user_data);
+
 typedef int (*ARKLsMassTimesSetupFn)(sunrealtype t, void* mtimes_data);
 
 typedef int (*ARKLsMassTimesVecFn)(N_Vector v, N_Vector Mv, sunrealtype t,
@@ -117,6 +121,11 @@ SUNDIALS_EXPORT int ARKodeSetJacTimes(void* arkode_mem,
                                       ARKLsJacTimesVecFn jtimes);
 SUNDIALS_EXPORT int ARKodeSetJacTimesRhsFn(void* arkode_mem,
                                            ARKRhsFn jtimesRhsFn);
+SUNDIALS_EXPORT int ARKodeSetJacRhsBatchFn(void* arkode_mem,
+                                           ARKLsRhsBatchFn rhsbatch,
+                                           int maxbatch);
+SUNDIALS_EXPORT int ARKodeSetLinSysCapture(void* arkode_mem,
+                                           SUNLinSysCapture capture);
 SUNDIALS_EXPORT int ARKodeSetMassTimes(void* arkode_mem,
                                        ARKLsMassTimesSetupFn msetup,
                                        ARKLsMassTimesVecFn mtimes,
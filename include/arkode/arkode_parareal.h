@@ -0,0 +1,69 @@
+/* -----------------------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * This is the header file for the ARKODE Parareal driver.
+ * ---------------------------------------------------------------------------*/
+
+#ifndef _ARKODE_PARAREAL_H
+#define _ARKODE_PARAREAL_H
+
+#include <arkode/arkode.h>
+#include <sundials/sundials_nvector.h>
+#include <sundials/sundials_types.h>
+
+#ifdef __cplusplus /* wrapper to enable C++ usage */
+extern "C" {
+#endif
+
+/* Parareal driver object */
+typedef struct ARKPararealMemRec* ARKParareal;
+
+/* -------------------------------
+ * Construct, evolve, and free
+ * ------------------------------- */
+
+SUNDIALS_EXPORT int ARKParareal_Create(void* coarse_mem, int nfine,
+                                       void** fine_mem, ARKParareal* pr);
+
+SUNDIALS_EXPORT int ARKParareal_Evolve(ARKParareal pr, sunrealtype t0,
+                                       sunrealtype tf, int nslices, N_Vector y);
+
+SUNDIALS_EXPORT int ARKParareal_Free(ARKParareal* pr);
+
+/* ------------------------
+ * ARKParareal Set Functions
+ * ------------------------ */
+
+SUNDIALS_EXPORT int ARKParareal_SetMaxIters(ARKParareal pr, int maxiters);
+
+SUNDIALS_EXPORT int ARKParareal_SetTolerances(ARKParareal pr,
+                                              sunrealtype reltol,
+                                              sunrealtype abstol);
+
+/* ------------------------
+ * ARKParareal Get Functions
+ * ------------------------ */
+
+SUNDIALS_EXPORT int ARKParareal_GetNumIters(ARKParareal pr, int* iters);
+
+SUNDIALS_EXPORT int ARKParareal_GetCorrectionNorm(ARKParareal pr,
+                                                  sunrealtype* norm);
+
+SUNDIALS_EXPORT int ARKParareal_GetSliceSolution(ARKParareal pr, int slice,
+                                                 sunrealtype* t, N_Vector y);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
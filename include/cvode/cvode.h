@@ -92,6 +92,10 @@ typedef int (*CVRhsFn)(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data
 typedef int (*CVRootFn)(sunrealtype t, N_Vector y, sunrealtype* gout,
                         void* user_data);
 
+typedef int (*CVPartialRootFn)(sunrealtype t, N_Vector y, int ncand,
+                               const int* cand, sunrealtype* gout,
+                               void* user_data);
+
 typedef int (*CVEwtFn)(N_Vector y, N_Vector ewt, void* user_data);
 
 typedef int (*CVMonitorFn)(void* cvode_mem, void* user_data);
@@ -137,11 +141,14 @@ SUNDIALS_EXPORT int CVodeSetNonlinearSolver(void* cvode_mem,
                                             SUNNonlinearSolver NLS);
 SUNDIALS_EXPORT int CVodeSetStabLimDet(void* cvode_mem, sunbooleantype stldet);
 SUNDIALS_EXPORT int CVodeSetStopTime(void* cvode_mem, sunrealtype tstop);
+SUNDIALS_EXPORT int CVodeSetTelemetry(void* cvode_mem, SUNTelemetry tel);
 SUNDIALS_EXPORT int CVodeSetInterpolateStopTime(void* cvode_mem,
                                                 sunbooleantype interp);
 SUNDIALS_EXPORT int CVodeClearStopTime(void* cvode_mem);
 SUNDIALS_EXPORT int CVodeSetUseIntegratorFusedKernels(void* cvode_mem,
                                                       sunbooleantype onoff);
+SUNDIALS_EXPORT int CVodeSetUseContiguousHistory(void* cvode_mem,
+                                                 sunbooleantype onoff);
 SUNDIALS_EXPORT int CVodeSetUserData(void* cvode_mem, void* user_data);
 
 /* Optional step adaptivity input functions */
@@ -173,6 +180,10 @@ SUNDIALS_EXPORT int CVodeRootInit(void* cvode_mem, int nrtfn, CVRootFn g);
 /* Rootfinding optional input functions */
 SUNDIALS_EXPORT int CVodeSetRootDirection(void* cvode_mem, int* rootdir);
 SUNDIALS_EXPORT int CVodeSetNoInactiveRootWarn(void* cvode_mem);
+SUNDIALS_EXPORT int CVodeSetPartialRootFn(void* cvode_mem,
+                                          CVPartialRootFn gpart);
+SUNDIALS_EXPORT int CVodeSetRootInverseInterp(void* cvode_mem,
+                                              sunbooleantype onoff);
 
 /* Solver function */
 SUNDIALS_EXPORT int CVode(void* cvode_mem, sunrealtype tout, N_Vector yout,
@@ -184,6 +195,8 @@ SUNDIALS_EXPORT int CVodeComputeState(void* cvode_mem, N_Vector ycor, N_Vector y
 /* Dense output function */
 SUNDIALS_EXPORT int CVodeGetDky(void* cvode_mem, sunrealtype t, int k,
                                 N_Vector dky);
+SUNDIALS_EXPORT int CVodeGetDkyBatch(void* cvode_mem, int nt, sunrealtype* t,
+                                     int k, N_Vector* dky);
 
 /* Optional output functions */
 SUNDIALS_EXPORT int CVodeGetWorkSpace(void* cvode_mem, long int* lenrw,
@@ -22,6 +22,7 @@
 #include <sundials/sundials_direct.h>
 #include <sundials/sundials_iterative.h>
 #include <sundials/sundials_linearsolver.h>
+#include <sundials/sundials_linsyscapture.h>
 #include <sundials/sundials_matrix.h>
 #include <sundials/sundials_nvector.h>
 
@@ -72,6 +73,9 @@ typedef int (*CVLsLinSysFn)(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix A,
                             sunrealtype gamma, void* user_data, N_Vector tmp1,
                             N_Vector tmp2, N_Vector tmp3);
 
+typedef int (*CVLsRhsBatchFn)(int nbatch, sunrealtype t, N_Vector* y,
+                              N_Vector* ydot, void* user_data);
+
 /*=================================================================
   CVLS Exported functions
   =================================================================*/
@@ -96,6 +100,11 @@ SUNDIALS_EXPORT int CVodeSetPreconditioner(void* cvode_mem, CVLsPrecSetupFn pset
 SUNDIALS_EXPORT int CVodeSetJacTimes(void* cvode_mem, CVLsJacTimesSetupFn jtsetup,
                                      CVLsJacTimesVecFn jtimes);
 SUNDIALS_EXPORT int CVodeSetLinSysFn(void* cvode_mem, CVLsLinSysFn linsys);
+SUNDIALS_EXPORT int CVodeSetJacRhsBatchFn(void* cvode_mem,
+                                          CVLsRhsBatchFn rhsbatch,
+                                          int maxbatch);
+SUNDIALS_EXPORT int CVodeSetLinSysCapture(void* cvode_mem,
+                                          SUNLinSysCapture capture);
 
 /*-----------------------------------------------------------------
   Optional outputs from the CVLS linear solver interface
@@ -257,6 +257,8 @@ SUNDIALS_EXPORT int CVodeComputeStateSens1(void* cvode_mem, int idx,
 /* Dense output function */
 SUNDIALS_EXPORT int CVodeGetDky(void* cvode_mem, sunrealtype t, int k,
                                 N_Vector dky);
+SUNDIALS_EXPORT int CVodeGetDkyBatch(void* cvode_mem, int nt, sunrealtype* t,
+                                     int k, N_Vector* dky);
 
 /* Optional output functions */
 SUNDIALS_EXPORT int CVodeGetWorkSpace(void* cvode_mem, long int* lenrw,
@@ -372,6 +374,11 @@ SUNDIALS_EXPORT int CVodeSetSensDQMethod(void* cvode_mem, int DQtype,
                                          sunrealtype DQrhomax);
 SUNDIALS_EXPORT int CVodeSetSensErrCon(void* cvode_mem, sunbooleantype errconS);
 SUNDIALS_EXPORT int CVodeSetSensMaxNonlinIters(void* cvode_mem, int maxcorS);
+SUNDIALS_EXPORT int CVodeSetSensNumThreads(void* cvode_mem, int nthreads);
+SUNDIALS_EXPORT int CVodeSetSensThreadParams(void* cvode_mem, void** user_data,
+                                             sunrealtype** p);
+SUNDIALS_EXPORT int CVodeSetSensRhsBatchFn(void* cvode_mem,
+                                           CVLsRhsBatchFn fbatch, int maxbatch);
 SUNDIALS_EXPORT int CVodeSetSensParams(void* cvode_mem, sunrealtype* p,
                                        sunrealtype* pbar, int* plist);
 
@@ -530,6 +537,8 @@ SUNDIALS_EXPORT int CVodeB(void* cvode_mem, sunrealtype tBout, int itaskB);
 
 SUNDIALS_EXPORT int CVodeSetAdjNoSensi(void* cvode_mem);
 
+SUNDIALS_EXPORT int CVodeSetAdjMaxCheckPoints(void* cvode_mem, int maxckpnts);
+
 SUNDIALS_EXPORT int CVodeSetUserDataB(void* cvode_mem, int which,
                                       void* user_dataB);
 SUNDIALS_EXPORT int CVodeSetMaxOrdB(void* cvode_mem, int which, int maxordB);
@@ -578,6 +587,11 @@ typedef struct
 SUNDIALS_EXPORT int CVodeGetAdjCheckPointsInfo(void* cvode_mem,
                                                CVadjCheckPointRec* ckpnt);
 
+SUNDIALS_EXPORT int CVodeGetAdjCheckPointStats(void* cvode_mem,
+                                               long int* nststore,
+                                               long int* nstrecomp,
+                                               int* nckpntsmax);
+
 /* CVLS interface function that depends on CVRhsFn */
 SUNDIALS_EXPORT int CVodeSetJacTimesRhsFnB(void* cvode_mem, int which,
                                            CVRhsFn jtimesRhsFn);
@@ -80,6 +80,9 @@ typedef int (*CVLsLinSysFn)(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix A,
                             sunrealtype gamma, void* user_data, N_Vector tmp1,
                             N_Vector tmp2, N_Vector tmp3);
 
+typedef int (*CVLsRhsBatchFn)(int nbatch, sunrealtype t, N_Vector* y,
+                              N_Vector* ydot, void* user_data);
+
 /*=================================================================
   CVLS Exported functions
   =================================================================*/
@@ -104,6 +107,9 @@ SUNDIALS_EXPORT int CVodeSetPreconditioner(void* cvode_mem, CVLsPrecSetupFn pset
 SUNDIALS_EXPORT int CVodeSetJacTimes(void* cvode_mem, CVLsJacTimesSetupFn jtsetup,
                                      CVLsJacTimesVecFn jtimes);
 SUNDIALS_EXPORT int CVodeSetLinSysFn(void* cvode_mem, CVLsLinSysFn linsys);
+SUNDIALS_EXPORT int CVodeSetJacRhsBatchFn(void* cvode_mem,
+                                          CVLsRhsBatchFn rhsbatch,
+                                          int maxbatch);
 
 /*-----------------------------------------------------------------
   Optional outputs from the CVLS linear solver interface
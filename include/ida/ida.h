@@ -90,6 +90,10 @@ typedef int (*IDAResFn)(sunrealtype tt, N_Vector yy, N_Vector yp, N_Vector rr,
 typedef int (*IDARootFn)(sunrealtype t, N_Vector y, N_Vector yp,
                          sunrealtype* gout, void* user_data);
 
+typedef int (*IDAPartialRootFn)(sunrealtype t, N_Vector y, N_Vector yp,
+                                int ncand, const int* cand, sunrealtype* gout,
+                                void* user_data);
+
 typedef int (*IDAEwtFn)(N_Vector y, N_Vector ewt, void* user_data);
 
 /* -------------------
@@ -133,6 +137,7 @@ SUNDIALS_EXPORT int IDASetMaxStep(void* ida_mem, sunrealtype hmax);
 SUNDIALS_EXPORT int IDASetMinStep(void* ida_mem, sunrealtype hmin);
 SUNDIALS_EXPORT int IDASetStopTime(void* ida_mem, sunrealtype tstop);
 SUNDIALS_EXPORT int IDAClearStopTime(void* ida_mem);
+SUNDIALS_EXPORT int IDASetTelemetry(void* ida_mem, SUNTelemetry tel);
 SUNDIALS_EXPORT int IDASetMaxErrTestFails(void* ida_mem, int maxnef);
 SUNDIALS_EXPORT int IDASetSuppressAlg(void* ida_mem, sunbooleantype suppressalg);
 SUNDIALS_EXPORT int IDASetId(void* ida_mem, N_Vector id);
@@ -166,6 +171,9 @@ SUNDIALS_EXPORT int IDARootInit(void* ida_mem, int nrtfn, IDARootFn g);
 /* Rootfinding optional input functions */
 SUNDIALS_EXPORT int IDASetRootDirection(void* ida_mem, int* rootdir);
 SUNDIALS_EXPORT int IDASetNoInactiveRootWarn(void* ida_mem);
+SUNDIALS_EXPORT int IDASetPartialRootFn(void* ida_mem, IDAPartialRootFn gpart);
+SUNDIALS_EXPORT int IDASetRootInverseInterp(void* ida_mem,
+                                            sunbooleantype onoff);
 
 /* Solver function */
 SUNDIALS_EXPORT int IDASolve(void* ida_mem, sunrealtype tout, sunrealtype* tret,
@@ -177,6 +185,8 @@ SUNDIALS_EXPORT int IDAComputeYp(void* ida_mem, N_Vector ycor, N_Vector yp);
 
 /* Dense output function */
 SUNDIALS_EXPORT int IDAGetDky(void* ida_mem, sunrealtype t, int k, N_Vector dky);
+SUNDIALS_EXPORT int IDAGetDkyBatch(void* ida_mem, int nt, sunrealtype* t,
+                                   int k, N_Vector* dky);
 
 /* Optional output functions */
 SUNDIALS_EXPORT int IDAGetWorkSpace(void* ida_mem, long int* lenrw,
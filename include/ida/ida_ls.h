@@ -22,6 +22,7 @@
 #include <sundials/sundials_direct.h>
 #include <sundials/sundials_iterative.h>
 #include <sundials/sundials_linearsolver.h>
+#include <sundials/sundials_linsyscapture.h>
 #include <sundials/sundials_matrix.h>
 #include <sundials/sundials_nvector.h>
 
@@ -69,6 +70,9 @@ typedef int (*IDALsJacTimesVecFn)(sunrealtype tt, N_Vector yy, N_Vector yp,
                                   sunrealtype c_j, void* user_data,
                                   N_Vector tmp1, N_Vector tmp2);
 
+typedef int (*IDALsResBatchFn)(sunrealtype tt, N_Vector* yy, N_Vector* yp,
+                               N_Vector* rr, int nbatch, void* user_data);
+
 /*=================================================================
   IDALS Exported functions
   =================================================================*/
@@ -90,6 +94,10 @@ SUNDIALS_EXPORT int IDASetLSNormFactor(void* ida_mem, sunrealtype nrmfac);
 SUNDIALS_EXPORT int IDASetLinearSolutionScaling(void* ida_mem,
                                                 sunbooleantype onoff);
 SUNDIALS_EXPORT int IDASetIncrementFactor(void* ida_mem, sunrealtype dqincfac);
+SUNDIALS_EXPORT int IDASetLinSysCapture(void* ida_mem,
+                                        SUNLinSysCapture capture);
+SUNDIALS_EXPORT int IDASetJacResBatchFn(void* ida_mem, IDALsResBatchFn resbatch,
+                                        int maxbatch);
 
 /*-----------------------------------------------------------------
   Optional outputs from the IDALS linear solver interface
@@ -156,6 +156,14 @@ typedef int (*IDAQuadRhsFnBS)(sunrealtype t, N_Vector yy, N_Vector yp,
                               N_Vector* yyS, N_Vector* ypS, N_Vector yyB,
                               N_Vector ypB, N_Vector rhsvalBQS, void* user_dataB);
 
+typedef int (*IDAAdjCheckPointStoreFn)(long int index, const void* data,
+                                       size_t size, void* content);
+
+typedef int (*IDAAdjCheckPointLoadFn)(long int index, void* data, size_t size,
+                                      void* content);
+
+typedef void (*IDAAdjCheckPointFreeFn)(void* content);
+
 /* ---------------------------------------
  * Exported Functions -- Forward Problems
  * --------------------------------------- */
@@ -244,6 +252,8 @@ SUNDIALS_EXPORT int IDAComputeYpSens(void* ida_mem, N_Vector* ycor,
 
 /* Dense output function */
 SUNDIALS_EXPORT int IDAGetDky(void* ida_mem, sunrealtype t, int k, N_Vector dky);
+SUNDIALS_EXPORT int IDAGetDkyBatch(void* ida_mem, int nt, sunrealtype* t,
+                                   int k, N_Vector* dky);
 
 /* Optional output functions */
 SUNDIALS_EXPORT int IDAGetWorkSpace(void* ida_mem, long int* lenrw,
@@ -362,6 +372,9 @@ SUNDIALS_EXPORT int IDASetSensErrCon(void* ida_mem, sunbooleantype errconS);
 SUNDIALS_EXPORT int IDASetSensMaxNonlinIters(void* ida_mem, int maxcorS);
 SUNDIALS_EXPORT int IDASetSensParams(void* ida_mem, sunrealtype* p,
                                      sunrealtype* pbar, int* plist);
+SUNDIALS_EXPORT int IDASetSensResBatchFn(void* ida_mem,
+                                         IDALsResBatchFn resbatch,
+                                         int maxbatch);
 
 /* Integrator nonlinear solver specification functions */
 SUNDIALS_EXPORT int IDASetNonlinearSolverSensSim(void* ida_mem,
@@ -512,6 +525,11 @@ SUNDIALS_EXPORT int IDASolveB(void* ida_mem, sunrealtype tBout, int itaskB);
 /* Optional Input Functions For Adjoint Problems */
 
 SUNDIALS_EXPORT int IDAAdjSetNoSensi(void* ida_mem);
+SUNDIALS_EXPORT int IDAAdjSetCheckPointFile(void* ida_mem, const char* fname);
+SUNDIALS_EXPORT int IDAAdjSetCheckPointStorage(void* ida_mem, void* content,
+                                               IDAAdjCheckPointStoreFn store,
+                                               IDAAdjCheckPointLoadFn load,
+                                               IDAAdjCheckPointFreeFn freefn);
 
 SUNDIALS_EXPORT int IDASetUserDataB(void* ida_mem, int which, void* user_dataB);
 SUNDIALS_EXPORT int IDASetMaxOrdB(void* ida_mem, int which, int maxordB);
@@ -559,6 +577,10 @@ typedef struct
 
 SUNDIALS_EXPORT int IDAGetAdjCheckPointsInfo(void* ida_mem,
                                              IDAadjCheckPointRec* ckpnt);
+SUNDIALS_EXPORT int IDAGetAdjCheckPointFileStats(void* ida_mem,
+                                                 long int* nckfile,
+                                                 long int* nbyteswrite,
+                                                 long int* nbytesread);
 
 /* IDALS interface function that depends on IDAResFn */
 SUNDIALS_EXPORT int IDASetJacTimesResFnB(void* ida_mem, int which,
@@ -76,6 +76,9 @@ typedef int (*IDALsJacTimesVecFn)(sunrealtype tt, N_Vector yy, N_Vector yp,
                                   sunrealtype c_j, void* user_data,
                                   N_Vector tmp1, N_Vector tmp2);
 
+typedef int (*IDALsResBatchFn)(sunrealtype tt, N_Vector* yy, N_Vector* yp,
+                               N_Vector* rr, int nbatch, void* user_data);
+
 /*=================================================================
   IDALS Exported functions
   =================================================================*/
@@ -97,6 +100,8 @@ SUNDIALS_EXPORT int IDASetLSNormFactor(void* ida_mem, sunrealtype nrmfac);
 SUNDIALS_EXPORT int IDASetLinearSolutionScaling(void* ida_mem,
                                                 sunbooleantype onoff);
 SUNDIALS_EXPORT int IDASetIncrementFactor(void* ida_mem, sunrealtype dqincfac);
+SUNDIALS_EXPORT int IDASetJacResBatchFn(void* ida_mem, IDALsResBatchFn resbatch,
+                                        int maxbatch);
 
 /*-----------------------------------------------------------------
   Optional outputs from the IDALS linear solver interface
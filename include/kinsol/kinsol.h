@@ -127,6 +127,7 @@ SUNDIALS_EXPORT int KINSetFuncNormTol(void* kinmem, sunrealtype fnormtol);
 SUNDIALS_EXPORT int KINSetScaledStepTol(void* kinmem, sunrealtype scsteptol);
 SUNDIALS_EXPORT int KINSetConstraints(void* kinmem, N_Vector constraints);
 SUNDIALS_EXPORT int KINSetSysFunc(void* kinmem, KINSysFn func);
+SUNDIALS_EXPORT int KINSetTelemetry(void* kinmem, SUNTelemetry tel);
 
 /* Optional output functions */
 SUNDIALS_EXPORT int KINGetWorkSpace(void* kinmem, long int* lenrw,
@@ -22,6 +22,7 @@
 #include <sundials/sundials_direct.h>
 #include <sundials/sundials_iterative.h>
 #include <sundials/sundials_linearsolver.h>
+#include <sundials/sundials_linsyscapture.h>
 #include <sundials/sundials_matrix.h>
 #include <sundials/sundials_nvector.h>
 
@@ -60,6 +61,9 @@ typedef int (*KINLsPrecSolveFn)(N_Vector uu, N_Vector uscale, N_Vector fval,
 typedef int (*KINLsJacTimesVecFn)(N_Vector v, N_Vector Jv, N_Vector uu,
                                   sunbooleantype* new_uu, void* J_data);
 
+typedef int (*KINLsSysBatchFn)(N_Vector* u, N_Vector* fval, int nbatch,
+                               void* user_data);
+
 /*==================================================================
   KINLS Exported functions
   ==================================================================*/
@@ -75,6 +79,9 @@ SUNDIALS_EXPORT int KINSetJacFn(void* kinmem, KINLsJacFn jac);
 SUNDIALS_EXPORT int KINSetPreconditioner(void* kinmem, KINLsPrecSetupFn psetup,
                                          KINLsPrecSolveFn psolve);
 SUNDIALS_EXPORT int KINSetJacTimesVecFn(void* kinmem, KINLsJacTimesVecFn jtv);
+SUNDIALS_EXPORT int KINSetLinSysCapture(void* kinmem, SUNLinSysCapture capture);
+SUNDIALS_EXPORT int KINSetJacSysBatchFn(void* kinmem, KINLsSysBatchFn sysbatch,
+                                        int maxbatch);
 
 /*-----------------------------------------------------------------
   Optional outputs from the KINLS linear solver interface
@@ -0,0 +1,88 @@
+/* -----------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * !!!!!!!!!!!!!!!!!!!!!!!!! WARNING !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+ * This is a 'private' header file and should not be used in user
+ * code. It is subject to change without warning.
+ * !!!!!!!!!!!!!!!!!!!!!!!!! WARNING !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+ * -----------------------------------------------------------------
+ * Allocation audit used to find heap allocations in the time step
+ * loop. The allocation sites record their allocations and the
+ * packages mark the steps taken after the first step.
+ * ----------------------------------------------------------------*/
+
+#ifndef _SUNDIALS_ALLOCAUDIT_IMPL_H
+#define _SUNDIALS_ALLOCAUDIT_IMPL_H
+
+#include <stddef.h>
+#include <stdio.h>
+#include <sundials/sundials_types.h>
+
+#ifdef __cplusplus /* wrapper to enable C++ usage */
+extern "C" {
+#endif
+
+typedef struct sunAllocAudit_* sunAllocAudit;
+
+/* Create, free, and print an audit, used by the SUNContext */
+SUNErrCode sunAllocAuditCreate(int mode, SUNProfiler profiler,
+                               sunAllocAudit* audit);
+
+void sunAllocAuditFree(sunAllocAudit* audit);
+
+void sunAllocAuditSetProfiler(sunAllocAudit audit, SUNProfiler profiler);
+
+void sunAllocAuditGetCounts(sunAllocAudit audit, long int* num_allocs,
+                            long int* num_bytes);
+
+void sunAllocAuditPrint(sunAllocAudit audit, FILE* fp);
+
+/* Record an allocation of the given size made by site */
+SUNDIALS_EXPORT
+void sunAllocAuditRecord(sunAllocAudit audit, size_t bytes, const char* site);
+
+/* Mark the start and end of a step. Allocations are reported when they occur
+   in a step marked as steady, or in a step nested in a steady step. */
+SUNDIALS_EXPORT
+void sunAllocAuditBeginStep(sunAllocAudit audit, sunbooleantype steady);
+
+SUNDIALS_EXPORT
+void sunAllocAuditEndStep(sunAllocAudit audit);
+
+/* Convenience macros for code with access to the SUNContext */
+#define SUNAllocAuditRecord(sunctx, bytes)                                     \
+  do {                                                                         \
+    if ((sunctx)->audit)                                                       \
+    {                                                                          \
+      sunAllocAuditRecord((sunctx)->audit, (size_t)(bytes), __func__);         \
+    }                                                                          \
+  }                                                                            \
+  while (0)
+
+#define SUNAllocAuditBeginStep(sunctx, steady)                                 \
+  do {                                                                         \
+    if ((sunctx)->audit) { sunAllocAuditBeginStep((sunctx)->audit, steady); }  \
+  }                                                                            \
+  while (0)
+
+#define SUNAllocAuditEndStep(sunctx)                                           \
+  do {                                                                         \
+    if ((sunctx)->audit) { sunAllocAuditEndStep((sunctx)->audit); }            \
+  }                                                                            \
+  while (0)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
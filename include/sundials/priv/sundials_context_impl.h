@@ -22,6 +22,7 @@
 #ifndef _SUNDIALS_CONTEXT_IMPL_H
 #define _SUNDIALS_CONTEXT_IMPL_H
 
+#include <sundials/priv/sundials_allocaudit_impl.h>
 #include <sundials/sundials_types.h>
 
 #ifdef __cplusplus /* wrapper to enable C++ usage */
@@ -37,8 +38,28 @@ struct SUNContext_
   SUNErrCode last_err;
   SUNErrHandler err_handler;
   SUNComm comm;
+  sunAllocAudit audit;
+#if defined(SUNDIALS_ENABLE_THREAD_SAFE_CONTEXT)
+  struct sunContextThreads_* threads; /* per-thread errors and handler lock */
+#endif
 };
 
+/* Objects that share a context may be used by several threads at once if the
+   context is thread safe, or if operations do not update the profiler and only
+   errors and warnings are logged */
+#if defined(SUNDIALS_ENABLE_THREAD_SAFE_CONTEXT) || \
+  (!defined(SUNDIALS_BUILD_WITH_PROFILING) && SUNDIALS_LOGGING_LEVEL <= 2)
+#define SUNDIALS_CONTEXT_SHARED_BY_THREADS
+#endif
+
+#if defined(SUNDIALS_ENABLE_THREAD_SAFE_CONTEXT)
+/* Set the last error of the calling thread and get the error handlers to
+   call. Handlers removed from the stack remain valid until the context is
+   freed, so the handlers can be called without holding a lock. */
+SUNDIALS_EXPORT
+SUNErrHandler sunContextRecordError(SUNContext sunctx, SUNErrCode code);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
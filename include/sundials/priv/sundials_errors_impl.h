@@ -152,8 +152,12 @@ static inline void SUNHandleErrWithMsg(int line, const char* func,
 {
   if (!sunctx) { SUNGlobalFallbackErrHandler(line, func, file, msg, code); }
 
+#if defined(SUNDIALS_ENABLE_THREAD_SAFE_CONTEXT)
+  SUNErrHandler eh = sunContextRecordError(sunctx, code);
+#else
   sunctx->last_err = code;
   SUNErrHandler eh = sunctx->err_handler;
+#endif
   while (eh != NULL)
   {
     eh->call(line, func, file, msg, code, eh->data, sunctx);
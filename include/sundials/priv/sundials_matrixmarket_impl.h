@@ -0,0 +1,72 @@
+/* -----------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * !!!!!!!!!!!!!!!!!!!!!!!!! WARNING !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+ * This is a 'private' header file and should not be used in user
+ * code. It is subject to change without warning.
+ * !!!!!!!!!!!!!!!!!!!!!!!!! WARNING !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+ * -----------------------------------------------------------------
+ * Matrix Market coordinate file utilities shared by the dense, band,
+ * and sparse SUNMatrix modules.
+ * ----------------------------------------------------------------*/
+
+#ifndef _SUNDIALS_MATRIXMARKET_IMPL_H
+#define _SUNDIALS_MATRIXMARKET_IMPL_H
+
+#include <stdio.h>
+#include <sundials/sundials_types.h>
+
+#ifdef __cplusplus /* wrapper to enable C++ usage */
+extern "C" {
+#endif
+
+/* Entries of a Matrix Market file in coordinate form with zero-based
+   indices. Symmetric files are expanded so both triangles are stored.
+   Duplicate entries are kept in file order. */
+typedef struct
+{
+  sunindextype rows; /* number of rows                     */
+  sunindextype cols; /* number of columns                  */
+  sunindextype nnz;  /* number of entries                  */
+  sunindextype* row; /* row index of each entry            */
+  sunindextype* col; /* column index of each entry         */
+  sunrealtype* val;  /* value of each entry (pattern: one) */
+} sunMatrixMarketCOO;
+
+/* Read a "matrix coordinate" file with a real, integer, or pattern field
+   and general or symmetric symmetry from the current position of infile
+   to the end of the file. The entries are parsed by up to nthreads
+   threads when SUNDIALS_ENABLE_THREADED_MATRIX_READ is defined. */
+SUNDIALS_EXPORT
+SUNErrCode sunMatrixMarketRead(FILE* infile, int nthreads,
+                               sunMatrixMarketCOO* coo);
+
+SUNDIALS_EXPORT
+void sunMatrixMarketFree(sunMatrixMarketCOO* coo);
+
+/* Write the banner and size line of a real coordinate file */
+SUNDIALS_EXPORT
+void sunMatrixMarketWriteHeader(FILE* outfile, sunbooleantype symmetric,
+                                sunindextype rows, sunindextype cols,
+                                sunindextype nnz);
+
+/* Write one entry given zero-based indices */
+SUNDIALS_EXPORT
+void sunMatrixMarketWriteEntry(FILE* outfile, sunindextype row,
+                               sunindextype col, sunrealtype value);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
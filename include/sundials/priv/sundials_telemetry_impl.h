@@ -0,0 +1,54 @@
+/* -----------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * !!!!!!!!!!!!!!!!!!!!!!!!! WARNING !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+ * This is a 'private' header file and should not be used in user
+ * code. It is subject to change without warning.
+ * !!!!!!!!!!!!!!!!!!!!!!!!! WARNING !!!!!!!!!!!!!!!!!!!!!!!!!!!!!!!
+ * -----------------------------------------------------------------
+ * Utilities used by the packages to fill telemetry records.
+ * ----------------------------------------------------------------*/
+
+#ifndef _SUNDIALS_TELEMETRY_IMPL_H
+#define _SUNDIALS_TELEMETRY_IMPL_H
+
+#include <sundials/sundials_telemetry.h>
+#include <sundials/sundials_types.h>
+
+#ifdef __cplusplus /* wrapper to enable C++ usage */
+extern "C" {
+#endif
+
+/* State kept by a package while a step is in progress. The counters hold the
+   package totals at the start of the step so the record can store the
+   differences and the wall clock times accumulate over the step. */
+typedef struct
+{
+  double tic;
+  long int nni;
+  long int nli;
+  long int netf;
+  long int ncfn;
+  long int nsetups;
+  SUNTelemetryRecord rec;
+} sunTelemetryStep;
+
+/* Monotonic wall clock time in seconds */
+SUNDIALS_EXPORT
+double sunTelemetryWallTime(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -19,12 +19,21 @@
 #ifndef _SUNDIALS_CONTEXT_H
 #define _SUNDIALS_CONTEXT_H
 
+#include <stdio.h>
 #include <sundials/priv/sundials_context_impl.h>
 
 #ifdef __cplusplus /* wrapper to enable C++ usage */
 extern "C" {
 #endif
 
+/* Allocation audit modes */
+typedef enum
+{
+  SUN_ALLOCAUDIT_OFF,    /* allocations are not recorded                   */
+  SUN_ALLOCAUDIT_REPORT, /* allocations are recorded for a report          */
+  SUN_ALLOCAUDIT_ASSERT  /* abort on an allocation after the first step    */
+} SUNAllocAuditMode;
+
 SUNDIALS_EXPORT
 SUNErrCode SUNContext_Create(SUNComm comm, SUNContext* sunctx_out);
 
@@ -56,6 +65,17 @@ SUNErrCode SUNContext_GetLogger(SUNContext sunctx, SUNLogger* logger);
 SUNDIALS_EXPORT
 SUNErrCode SUNContext_SetLogger(SUNContext sunctx, SUNLogger logger);
 
+SUNDIALS_EXPORT
+SUNErrCode SUNContext_SetAllocAudit(SUNContext sunctx, SUNAllocAuditMode mode);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNContext_GetAllocAuditCounts(SUNContext sunctx,
+                                          long int* num_allocs,
+                                          long int* num_bytes);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNContext_PrintAllocAudit(SUNContext sunctx, FILE* fp);
+
 SUNDIALS_EXPORT
 SUNErrCode SUNContext_Free(SUNContext* ctx);
 
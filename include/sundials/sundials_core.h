@@ -21,6 +21,7 @@
 #include <sundials/sundials_errors.h>
 #include <sundials/sundials_iterative.h>
 #include <sundials/sundials_linearsolver.h>
+#include <sundials/sundials_linsyscapture.h>
 #include <sundials/sundials_logger.h>
 #include <sundials/sundials_math.h>
 #include <sundials/sundials_matrix.h>
@@ -28,6 +29,8 @@
 #include <sundials/sundials_nonlinearsolver.h>
 #include <sundials/sundials_nvector.h>
 #include <sundials/sundials_profiler.h>
+#include <sundials/sundials_telemetry.h>
+#include <sundials/sundials_timeseries.h>
 #include <sundials/sundials_types.h>
 #include <sundials/sundials_version.h>
 
@@ -0,0 +1,89 @@
+/* -----------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * SUNLinSysCapture writes selected linear systems (matrices and the
+ * right-hand sides solved with them) from the linear solver
+ * interfaces to a binary archive so they can be replayed outside of
+ * the integrator.
+ * -----------------------------------------------------------------*/
+
+#ifndef _SUNDIALS_LINSYSCAPTURE_H
+#define _SUNDIALS_LINSYSCAPTURE_H
+
+#include <stdint.h>
+#include <sundials/sundials_config.h>
+#include <sundials/sundials_matrix.h>
+#include <sundials/sundials_nvector.h>
+#include <sundials/sundials_types.h>
+
+#ifdef __cplusplus /* wrapper to enable C++ usage */
+extern "C" {
+#endif
+
+/* Record kinds */
+#define SUN_LINSYSCAPTURE_MATRIX 1
+#define SUN_LINSYSCAPTURE_RHS    2
+
+/* Matrix storage formats */
+#define SUN_LINSYSCAPTURE_DENSE 1
+#define SUN_LINSYSCAPTURE_BAND  2
+#define SUN_LINSYSCAPTURE_CSC   3
+#define SUN_LINSYSCAPTURE_CSR   4
+
+/* The header preceding each record in the archive, all fields are fixed
+   size and the header has no padding so the layout does not depend on
+   the build */
+typedef struct SUNLinSysCaptureRecord_
+{
+  uint32_t kind;   /* record kind (matrix or right-hand side)            */
+  uint32_t format; /* matrix storage format (right-hand side: 0)         */
+  int64_t system;  /* index of the captured system, starting from 0      */
+  int64_t rows;    /* number of rows (right-hand side: vector length)    */
+  int64_t cols;    /* number of columns (right-hand side: 1)             */
+  int64_t upper;   /* band: upper bandwidth, sparse: number of nonzeros  */
+  int64_t lower;   /* band: lower bandwidth                              */
+  double t;        /* time of the system (KINSOL: iteration number)      */
+  double value;    /* matrix: gamma (IDA: cj), right-hand side: tolerance */
+} SUNLinSysCaptureRecord;
+
+SUNDIALS_EXPORT
+SUNErrCode SUNLinSysCapture_Create(const char* filename,
+                                   SUNLinSysCapture* cap);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNLinSysCapture_Destroy(SUNLinSysCapture* cap);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNLinSysCapture_SetSelection(SUNLinSysCapture cap, long interval,
+                                         long max_systems, long max_rhs);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNLinSysCapture_Matrix(SUNLinSysCapture cap, sunrealtype t,
+                                   sunrealtype gamma, SUNMatrix A);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNLinSysCapture_Rhs(SUNLinSysCapture cap, sunrealtype t,
+                                sunrealtype tol, N_Vector b);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNLinSysCapture_GetNumSystems(SUNLinSysCapture cap,
+                                          long* num_systems);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNLinSysCapture_GetNumRhs(SUNLinSysCapture cap, long* num_rhs);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _SUNDIALS_LINSYSCAPTURE_H */
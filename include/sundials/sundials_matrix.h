@@ -81,6 +81,9 @@ typedef _SUNDIALS_STRUCT_ _generic_SUNMatrix_Ops* SUNMatrix_Ops;
 /* Forward reference for pointer to SUNMatrix object */
 typedef _SUNDIALS_STRUCT_ _generic_SUNMatrix* SUNMatrix;
 
+/* Header of a captured matrix record (see sundials_linsyscapture.h) */
+struct SUNLinSysCaptureRecord_;
+
 /* Structure containing function pointers to matrix operations  */
 struct _generic_SUNMatrix_Ops
 {
@@ -94,6 +97,8 @@ struct _generic_SUNMatrix_Ops
   SUNErrCode (*matvecsetup)(SUNMatrix);
   SUNErrCode (*matvec)(SUNMatrix, N_Vector, N_Vector);
   SUNErrCode (*space)(SUNMatrix, long int*, long int*);
+  SUNErrCode (*writecapture)(SUNMatrix, struct SUNLinSysCaptureRecord_*,
+                             FILE*);
 };
 
 /* A matrix is a structure with an implementation-dependent
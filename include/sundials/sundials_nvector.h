@@ -334,6 +334,15 @@ SUNDIALS_EXPORT N_Vector N_VGetVecAtIndexVectorArray(N_Vector* vs, int index);
 SUNDIALS_EXPORT void N_VSetVecAtIndexVectorArray(N_Vector* vs, int index,
                                                  N_Vector w);
 
+/* -----------------------------------------------------------------
+ * Binary I/O functions
+ * ----------------------------------------------------------------- */
+
+SUNDIALS_EXPORT SUNErrCode N_VWriteBinary(N_Vector x, FILE* outfile,
+                                          sunbooleantype header);
+SUNDIALS_EXPORT SUNErrCode N_VReadBinary(N_Vector x, FILE* infile,
+                                         sunbooleantype header);
+
 /* -----------------------------------------------------------------
  * Debugging functions
  * ----------------------------------------------------------------- */
@@ -30,6 +30,9 @@ extern "C" {
 SUNDIALS_EXPORT
 SUNErrCode SUNProfiler_Create(SUNComm comm, const char* title, SUNProfiler* p);
 SUNDIALS_EXPORT
+SUNErrCode SUNProfiler_CreateFromEnv(SUNComm comm, const char* title,
+                                     SUNProfiler* p);
+SUNDIALS_EXPORT
 SUNErrCode SUNProfiler_Free(SUNProfiler* p);
 
 SUNDIALS_EXPORT
@@ -38,6 +41,16 @@ SUNErrCode SUNProfiler_Begin(SUNProfiler p, const char* name);
 SUNDIALS_EXPORT
 SUNErrCode SUNProfiler_End(SUNProfiler p, const char* name);
 
+SUNDIALS_EXPORT
+SUNErrCode SUNProfiler_RegisterTimer(SUNProfiler p, const char* name,
+                                     int* handle);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNProfiler_BeginTimer(SUNProfiler p, int handle);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNProfiler_EndTimer(SUNProfiler p, int handle);
+
 SUNDIALS_EXPORT
 SUNErrCode SUNProfiler_GetTimerResolution(SUNProfiler p, double* resolution);
 
@@ -51,6 +64,24 @@ SUNErrCode SUNProfiler_Print(SUNProfiler p, FILE* fp);
 SUNDIALS_EXPORT
 SUNErrCode SUNProfiler_Reset(SUNProfiler p);
 
+SUNDIALS_EXPORT
+SUNErrCode SUNProfiler_EnableTrace(SUNProfiler p, long capacity);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNProfiler_SetTraceFilename(SUNProfiler p, const char* filename);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNProfiler_WriteTrace(SUNProfiler p, FILE* fp);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNProfiler_EnableCounters(SUNProfiler p);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNProfiler_GetCounters(SUNProfiler p, const char* name,
+                                   long long* cycles, long long* instructions,
+                                   long long* llc_references,
+                                   long long* llc_misses);
+
 #if defined(SUNDIALS_BUILD_WITH_PROFILING) && defined(SUNDIALS_CALIPER_ENABLED)
 
 #define SUNDIALS_MARK_FUNCTION_BEGIN(profobj) CALI_MARK_FUNCTION_BEGIN
@@ -0,0 +1,88 @@
+/* -----------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * SUNTelemetry collects a fixed-layout record for every step taken
+ * by an integrator (or every iteration of KINSOL) in a preallocated
+ * ring buffer. The records can be drained by the user or written to
+ * a binary file.
+ * -----------------------------------------------------------------*/
+
+#ifndef _SUNDIALS_TELEMETRY_H
+#define _SUNDIALS_TELEMETRY_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <sundials/sundials_config.h>
+#include <sundials/sundials_types.h>
+
+#ifdef __cplusplus /* wrapper to enable C++ usage */
+extern "C" {
+#endif
+
+/* Record flags */
+#define SUN_TELEMETRY_LSETUP 1 /* the linear solver setup was called */
+
+/* A telemetry record, all fields are fixed size and the record has no
+   padding so the binary file layout does not depend on the build */
+typedef struct
+{
+  double t;           /* time reached by the step (KINSOL: 0)           */
+  double h;           /* step size used (KINSOL: step length)           */
+  double error_norm;  /* local error test norm (KINSOL: scaled fnorm)   */
+  double wall_step;   /* wall clock time of the step in seconds         */
+  double wall_nls;    /* wall clock time in the nonlinear solver        */
+  double wall_lsetup; /* wall clock time in the linear solver setup     */
+  double wall_lsolve; /* wall clock time in linear solves               */
+  int64_t step;       /* step (KINSOL: iteration) number                */
+  int32_t order;      /* method order used (KINSOL: 0)                  */
+  int32_t nni;        /* nonlinear iterations in the step               */
+  int32_t nli;        /* linear iterations in the step                  */
+  int32_t netf;       /* error test failures in the step                */
+  int32_t ncfn;       /* nonlinear solver convergence failures          */
+  int32_t flags;      /* combination of the SUN_TELEMETRY_* flags       */
+} SUNTelemetryRecord;
+
+SUNDIALS_EXPORT
+SUNErrCode SUNTelemetry_Create(long capacity, SUNTelemetry* tel);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNTelemetry_Destroy(SUNTelemetry* tel);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNTelemetry_SetBinaryFilename(SUNTelemetry tel,
+                                          const char* filename);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNTelemetry_Record(SUNTelemetry tel, const SUNTelemetryRecord* rec);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNTelemetry_Drain(SUNTelemetry tel, SUNTelemetryRecord* records,
+                              long max_records, long* num_records);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNTelemetry_Flush(SUNTelemetry tel);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNTelemetry_GetNumRecords(SUNTelemetry tel, long* num_records);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNTelemetry_GetNumDropped(SUNTelemetry tel, long* num_dropped);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNTelemetry_Print(SUNTelemetry tel, FILE* fp);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _SUNDIALS_TELEMETRY_H */
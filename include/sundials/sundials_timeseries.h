@@ -0,0 +1,61 @@
+/* -----------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * SUNTimeSeries appends solution snapshots to a binary file. The
+ * snapshots are stored at fixed, aligned offsets and followed by an
+ * index of the snapshot times so the file can be memory-mapped.
+ * Snapshots may be written by a background thread when SUNDIALS is
+ * built with SUNDIALS_ENABLE_ASYNC_OUTPUT.
+ * -----------------------------------------------------------------*/
+
+#ifndef _SUNDIALS_TIMESERIES_H
+#define _SUNDIALS_TIMESERIES_H
+
+#include <sundials/sundials_config.h>
+#include <sundials/sundials_nvector.h>
+#include <sundials/sundials_types.h>
+
+#ifdef __cplusplus /* wrapper to enable C++ usage */
+extern "C" {
+#endif
+
+SUNDIALS_EXPORT
+SUNErrCode SUNTimeSeries_Create(const char* filename, SUNTimeSeries* ts);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNTimeSeries_Destroy(SUNTimeSeries* ts);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNTimeSeries_Append(SUNTimeSeries ts, sunrealtype t, N_Vector y);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNTimeSeries_Flush(SUNTimeSeries ts);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNTimeSeries_SetAsync(SUNTimeSeries ts, int nbuffers);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNTimeSeries_GetNumStalls(SUNTimeSeries ts, long* num_stalls);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNTimeSeries_GetNumSnapshots(SUNTimeSeries ts, long* num_snapshots);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNTimeSeries_ReadSnapshot(const char* filename, long k,
+                                      sunrealtype* t, N_Vector y);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _SUNDIALS_TIMESERIES_H */
@@ -192,6 +192,15 @@ typedef struct SUNProfiler_* SUNProfiler;
 /* SUNDIALS logger */
 typedef struct SUNLogger_* SUNLogger;
 
+/* SUNDIALS telemetry */
+typedef struct SUNTelemetry_* SUNTelemetry;
+
+/* SUNDIALS time series writer */
+typedef struct SUNTimeSeries_* SUNTimeSeries;
+
+/* SUNDIALS linear system capture */
+typedef struct SUNLinSysCapture_* SUNLinSysCapture;
+
 /* -----------------------------------------------------------------------------
  * SUNDIALS function types
  * ---------------------------------------------------------------------------*/
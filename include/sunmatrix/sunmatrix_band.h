@@ -32,6 +32,7 @@
 #define _SUNMATRIX_BAND_H
 
 #include <stdio.h>
+#include <sundials/sundials_linsyscapture.h>
 #include <sundials/sundials_matrix.h>
 
 #ifdef __cplusplus /* wrapper to enable C++ usage */
@@ -101,6 +102,14 @@ SUNDIALS_EXPORT SUNMatrix SUNBandMatrixStorage(sunindextype N, sunindextype mu,
 
 SUNDIALS_EXPORT void SUNBandMatrix_Print(SUNMatrix A, FILE* outfile);
 
+SUNDIALS_EXPORT SUNErrCode SUNBandMatrix_WriteMatrixMarket(
+  SUNMatrix A, FILE* outfile, sunbooleantype symmetric);
+
+SUNDIALS_EXPORT SUNErrCode SUNBandMatrix_ReadMatrixMarket(FILE* infile,
+                                                          int nthreads,
+                                                          SUNContext sunctx,
+                                                          SUNMatrix* A);
+
 SUNDIALS_EXPORT sunindextype SUNBandMatrix_Rows(SUNMatrix A);
 SUNDIALS_EXPORT sunindextype SUNBandMatrix_Columns(SUNMatrix A);
 SUNDIALS_EXPORT sunindextype SUNBandMatrix_LowerBandwidth(SUNMatrix A);
@@ -123,6 +132,9 @@ SUNDIALS_EXPORT SUNErrCode SUNMatScaleAddI_Band(sunrealtype c, SUNMatrix A);
 SUNDIALS_EXPORT SUNErrCode SUNMatMatvec_Band(SUNMatrix A, N_Vector x, N_Vector y);
 SUNDIALS_EXPORT SUNErrCode SUNMatSpace_Band(SUNMatrix A, long int* lenrw,
                                             long int* leniw);
+SUNDIALS_EXPORT SUNErrCode SUNMatWriteCapture_Band(SUNMatrix A,
+                                                   SUNLinSysCaptureRecord* rec,
+                                                   FILE* outfile);
 
 #ifdef __cplusplus
 }
@@ -32,6 +32,7 @@
 #define _SUNMATRIX_DENSE_H
 
 #include <stdio.h>
+#include <sundials/sundials_linsyscapture.h>
 #include <sundials/sundials_matrix.h>
 
 #ifdef __cplusplus /* wrapper to enable C++ usage */
@@ -82,6 +83,14 @@ SUNDIALS_EXPORT SUNMatrix SUNDenseMatrix(sunindextype M, sunindextype N,
 
 SUNDIALS_EXPORT void SUNDenseMatrix_Print(SUNMatrix A, FILE* outfile);
 
+SUNDIALS_EXPORT SUNErrCode SUNDenseMatrix_WriteMatrixMarket(
+  SUNMatrix A, FILE* outfile, sunbooleantype symmetric);
+
+SUNDIALS_EXPORT SUNErrCode SUNDenseMatrix_ReadMatrixMarket(FILE* infile,
+                                                           int nthreads,
+                                                           SUNContext sunctx,
+                                                           SUNMatrix* A);
+
 SUNDIALS_EXPORT sunindextype SUNDenseMatrix_Rows(SUNMatrix A);
 SUNDIALS_EXPORT sunindextype SUNDenseMatrix_Columns(SUNMatrix A);
 SUNDIALS_EXPORT sunindextype SUNDenseMatrix_LData(SUNMatrix A);
@@ -101,6 +110,9 @@ SUNDIALS_EXPORT SUNErrCode SUNMatMatvec_Dense(SUNMatrix A, N_Vector x,
                                               N_Vector y);
 SUNDIALS_EXPORT SUNErrCode SUNMatSpace_Dense(SUNMatrix A, long int* lenrw,
                                              long int* leniw);
+SUNDIALS_EXPORT SUNErrCode SUNMatWriteCapture_Dense(SUNMatrix A,
+                                                    SUNLinSysCaptureRecord* rec,
+                                                    FILE* outfile);
 
 #ifdef __cplusplus
 }
@@ -33,6 +33,7 @@
 #define _SUNMATRIX_SPARSE_H
 
 #include <stdio.h>
+#include <sundials/sundials_linsyscapture.h>
 #include <sundials/sundials_matrix.h>
 #include <sunmatrix/sunmatrix_band.h>
 #include <sunmatrix/sunmatrix_dense.h>
@@ -127,6 +128,22 @@ SUNErrCode SUNSparseMatrix_Reallocate(SUNMatrix A, sunindextype NNZ);
 SUNDIALS_EXPORT
 void SUNSparseMatrix_Print(SUNMatrix A, FILE* outfile);
 
+SUNDIALS_EXPORT
+SUNErrCode SUNSparseMatrix_WriteMatrixMarket(SUNMatrix A, FILE* outfile,
+                                             sunbooleantype symmetric);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNSparseMatrix_ReadMatrixMarket(FILE* infile, int sparsetype,
+                                            int nthreads, SUNContext sunctx,
+                                            SUNMatrix* A);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNSparseMatrix_WriteBinary(SUNMatrix A, FILE* outfile);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNSparseMatrix_ReadBinary(FILE* infile, SUNContext sunctx,
+                                      SUNMatrix* A);
+
 SUNDIALS_EXPORT
 sunindextype SUNSparseMatrix_Rows(SUNMatrix A);
 
@@ -178,6 +195,10 @@ SUNErrCode SUNMatMatvec_Sparse(SUNMatrix A, N_Vector x, N_Vector y);
 SUNDIALS_EXPORT
 SUNErrCode SUNMatSpace_Sparse(SUNMatrix A, long int* lenrw, long int* leniw);
 
+SUNDIALS_EXPORT
+SUNErrCode SUNMatWriteCapture_Sparse(SUNMatrix A, SUNLinSysCaptureRecord* rec,
+                                     FILE* outfile);
+
 #ifdef __cplusplus
 }
 #endif
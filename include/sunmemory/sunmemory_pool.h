@@ -0,0 +1,84 @@
+/* -----------------------------------------------------------------
+ * Programmer(s): Cody J. Balos @ LLNL
+ * -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * SUNDIALS pooled system memory helper header file.
+ * ----------------------------------------------------------------*/
+
+#ifndef _SUNDIALS_POOLMEMORY_H
+#define _SUNDIALS_POOLMEMORY_H
+
+#include <stdio.h>
+#include <sundials/sundials_memory.h>
+
+#ifdef __cplusplus /* wrapper to enable C++ usage */
+extern "C" {
+#endif
+
+/* Implementation specific functions */
+
+SUNDIALS_EXPORT
+SUNMemoryHelper SUNMemoryHelper_Pool(SUNContext sunctx);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNMemoryHelper_SetAlignment_Pool(SUNMemoryHelper helper,
+                                             size_t alignment);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNMemoryHelper_SetUseHugePages_Pool(SUNMemoryHelper helper,
+                                                sunbooleantype onoff);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNMemoryHelper_GetPoolStats_Pool(SUNMemoryHelper helper,
+                                             unsigned long* num_reused,
+                                             unsigned long* num_sys_allocations,
+                                             size_t* bytes_reserved);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNMemoryHelper_PrintStats_Pool(SUNMemoryHelper helper,
+                                           FILE* outfile);
+
+/* SUNMemoryHelper functions */
+
+SUNDIALS_EXPORT
+SUNErrCode SUNMemoryHelper_Alloc_Pool(SUNMemoryHelper helper, SUNMemory* memptr,
+                                      size_t mem_size, SUNMemoryType mem_type,
+                                      void* queue);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNMemoryHelper_Dealloc_Pool(SUNMemoryHelper helper, SUNMemory mem,
+                                        void* queue);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNMemoryHelper_Copy_Pool(SUNMemoryHelper helper, SUNMemory dst,
+                                     SUNMemory src, size_t memory_size,
+                                     void* queue);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNMemoryHelper_GetAllocStats_Pool(SUNMemoryHelper helper,
+                                              SUNMemoryType mem_type,
+                                              unsigned long* num_allocations,
+                                              unsigned long* num_deallocations,
+                                              size_t* bytes_allocated,
+                                              size_t* bytes_high_watermark);
+
+SUNDIALS_EXPORT
+SUNMemoryHelper SUNMemoryHelper_Clone_Pool(SUNMemoryHelper helper);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNMemoryHelper_Destroy_Pool(SUNMemoryHelper helper);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,273 @@
+#!/usr/bin/env python3
+# -----------------------------------------------------------------------------
+# Programmer(s): Daniel R. Reynolds @ SMU
+# -----------------------------------------------------------------------------
+# SUNDIALS Copyright Start
+# Copyright (c) 2002-2024, Lawrence Livermore National Security
+# and Southern Methodist University.
+# All rights reserved.
+#
+# See the top-level LICENSE and NOTICE files for details.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+# SUNDIALS Copyright End
+# -----------------------------------------------------------------------------
+# Script to generate the constexpr ERK Butcher tables in
+# include/arkode/arkode_butcher_erk.hpp from src/arkode/arkode_butcher_erk.def
+#
+# Example usage:
+#   $ ./generateERKTables.py ../.
+# -----------------------------------------------------------------------------
+
+import os
+import re
+import sys
+
+# Tables with compile-time specialized kernels
+TABLES = [
+    "ARKODE_HEUN_EULER_2_1_2",
+    "ARKODE_BOGACKI_SHAMPINE_4_2_3",
+    "ARKODE_ZONNEVELD_5_3_4",
+    "ARKODE_CASH_KARP_6_4_5",
+    "ARKODE_DORMAND_PRINCE_7_4_5",
+    "ARKODE_VERNER_8_5_6",
+    "ARKODE_VERNER_9_5_6",
+    "ARKODE_VERNER_10_6_7",
+    "ARKODE_VERNER_13_7_8",
+    "ARKODE_VERNER_16_8_9",
+]
+
+HEADER = """\
+/* -----------------------------------------------------------------------------
+ * Programmer(s): Daniel R. Reynolds @ SMU
+ * -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Compile-time Butcher tables for the explicit methods with specialized step
+ * kernels (see arkode_erkstep_kernels.hpp).
+ *
+ * THIS FILE IS GENERATED BY scripts/generateERKTables.py FROM
+ * src/arkode/arkode_butcher_erk.def, DO NOT EDIT IT DIRECTLY.
+ * ---------------------------------------------------------------------------*/
+
+#ifndef _ARKODE_BUTCHER_ERK_HPP
+#define _ARKODE_BUTCHER_ERK_HPP
+
+#include <arkode/arkode_butcher_erk.h>
+#include <sundials/sundials_types.h>
+
+/* X-macro listing the tables with a constexpr ERKTable specialization */
+{xmacro}
+
+namespace sundials {{
+namespace arkode {{
+
+/* Primary template, only the tables listed above are defined */
+template<ARKODE_ERKTableID ID>
+struct ERKTable;
+{tables}
+}} // namespace arkode
+}} // namespace sundials
+
+#endif
+"""
+
+TABLE = """
+template<>
+struct ERKTable<{name}>
+{{
+  static constexpr int stages = {s};
+  static constexpr int q      = {q};
+  static constexpr int p      = {p};
+
+  static constexpr sunrealtype A(int i, int j)
+  {{
+{A}
+    return A_[i][j];
+  }}
+
+  static constexpr sunrealtype b(int j)
+  {{
+{b}
+    return b_[j];
+  }}
+
+  static constexpr sunrealtype c(int j)
+  {{
+{c}
+    return c_[j];
+  }}
+
+  static constexpr sunrealtype d(int j)
+  {{
+{d}
+    return d_[j];
+  }}
+}};
+"""
+
+ZERO = "SUN_RCONST(0.0)"
+
+
+def parse(deffile):
+    """Parse the ERK tables in the X-macro definition file"""
+
+    with open(deffile, "r") as f:
+        text = f.read()
+
+    tables = {}
+    for m in re.finditer(r"ARK_BUTCHER_TABLE\((\w+),\s*\{(.*?)\n\s*\}\)",
+                         text, re.S):
+        name, body = m.group(1), m.group(2)
+        alloc = re.search(r"ARKodeButcherTable_Alloc\((\d+),\s*(\w+)\)", body)
+        if alloc is None:
+            continue
+        s = int(alloc.group(1))
+        tab = {"s": s, "q": 0, "p": 0,
+               "A": [[ZERO] * s for _ in range(s)],
+               "b": [ZERO] * s, "c": [ZERO] * s, "d": [ZERO] * s}
+        for key in ("q", "p"):
+            val = re.search(r"B->%s\s*=\s*(\d+);" % key, body)
+            if val:
+                tab[key] = int(val.group(1))
+        for a in re.finditer(r"B->(A|b|c|d)\[(\d+)\](?:\[(\d+)\])?\s*=\s*"
+                             r"([^;]*);", body):
+            expr = " ".join(a.group(4).split())
+            # only literal coefficients can be evaluated at compile time
+            if re.sub(r"SUN_RCONST\([^)]*\)", "", expr).strip(" +-*/()"):
+                tab["error"] = "non-literal coefficient " + expr
+            if a.group(1) == "A":
+                tab["A"][int(a.group(2))][int(a.group(3))] = expr
+            else:
+                tab[a.group(1)][int(a.group(2))] = expr
+        tables[name] = tab
+
+    return tables
+
+
+def fmt_expr(expr):
+    """Put spaces around the binary operators in a coefficient expression"""
+
+    return re.sub(r"\)\s*([*/+-])\s*", r") \1 ", expr)
+
+
+def pack(items, col, last):
+    """Bin-pack list items into lines aligned at the given column, the first
+    line starts at the column and the last item is followed by last"""
+
+    lines, line = [], ""
+    for k, item in enumerate(items):
+        item += last if k == len(items) - 1 else ","
+        if line and col + len(line) + len(item) + 1 > 80:
+            lines.append(line)
+            line = ""
+        line += (" " if line else "") + item
+    lines.append(line)
+    return lines
+
+
+def layout(lhs, items, col):
+    """Lay out a braced list initializer starting at the given column with the
+    items aligned after the opening brace. Each entry in items is either a
+    coefficient or a list of coefficients (a nested braced list)."""
+
+    if isinstance(items[0], list):
+        rows = ["{" + ", ".join(row) + "}" for row in items]
+    else:
+        rows = items
+
+    # everything on one line
+    one = "{" + ", ".join(rows) + "};"
+    if col + len(one) <= 80:
+        return [lhs + one]
+
+    lines = []
+    if isinstance(items[0], list):
+        # one nested list per line, each bin-packed after its own brace
+        for k, row in enumerate(items):
+            last = "}," if k < len(items) - 1 else "}};"
+            for j, line in enumerate(pack(row, col + 2, last)):
+                if j == 0:
+                    line = ("{{" if k == 0 else " {") + line
+                else:
+                    line = "  " + line
+                lines.append(line)
+    else:
+        for j, line in enumerate(pack(items, col + 1, "};")):
+            lines.append(("{" if j == 0 else " ") + line)
+
+    return [lhs + lines[0]] + [" " * col + line for line in lines[1:]]
+
+
+def initializer(name, dims, items):
+    """Format the constexpr array declaration as clang-format lays it out,
+    breaking after the assignment when the list does not fit aligned after
+    the opening brace"""
+
+    lhs = "    constexpr sunrealtype %s%s = " % (name, dims)
+    lines = layout(lhs, items, len(lhs))
+    if max(len(line) for line in lines) > 80:
+        lines = layout("", items, 6)
+        lines = [lhs.rstrip()] + ["      " + lines[0]] + lines[1:]
+    return "\n".join(lines)
+
+
+def xmacro(name, entries):
+    """Format the X-macro with the line continuations aligned left"""
+
+    lines = ["#define %s(X)" % name] + ["  X(%s)" % e for e in entries]
+    width = max(len(line) for line in lines[:-1]) + 1
+    return "\n".join([line.ljust(width) + "\\" for line in lines[:-1]] +
+                     [lines[-1]])
+
+
+def main():
+
+    import argparse
+
+    parser = argparse.ArgumentParser(
+        description="Generate constexpr ERK Butcher tables")
+    parser.add_argument("sundials", type=str,
+                        help="Path to the SUNDIALS source directory")
+    args = parser.parse_args()
+
+    deffile = os.path.join(args.sundials, "src", "arkode",
+                           "arkode_butcher_erk.def")
+    outfile = os.path.join(args.sundials, "include", "arkode",
+                           "arkode_butcher_erk.hpp")
+
+    tables = parse(deffile)
+
+    out = []
+    for name in TABLES:
+        tab = tables[name]
+        if "error" in tab:
+            raise ValueError("%s: %s" % (name, tab["error"]))
+        s = tab["s"]
+        A = [[fmt_expr(a) for a in row] for row in tab["A"]]
+        b, c, d = ([fmt_expr(x) for x in tab[v]] for v in "bcd")
+        out.append(TABLE.format(
+            name=name, s=s, q=tab["q"], p=tab["p"],
+            A=initializer("A_", "[%d][%d]" % (s, s), A),
+            b=initializer("b_", "[%d]" % s, b),
+            c=initializer("c_", "[%d]" % s, c),
+            d=initializer("d_", "[%d]" % s, d)))
+
+    tables_macro = xmacro("ARKODE_ERK_CONSTEXPR_TABLES", TABLES)
+
+    with open(outfile, "w") as f:
+        f.write(HEADER.format(xmacro=tables_macro, tables="".join(out)))
+
+    print("Wrote %s" % outfile)
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,187 @@
+#!/usr/bin/env python3
+# -----------------------------------------------------------------------------
+# Programmer(s): David J. Gardner @ LLNL
+# -----------------------------------------------------------------------------
+# SUNDIALS Copyright Start
+# Copyright (c) 2002-2024, Lawrence Livermore National Security
+# and Southern Methodist University.
+# All rights reserved.
+#
+# See the top-level LICENSE and NOTICE files for details.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+# SUNDIALS Copyright End
+# -----------------------------------------------------------------------------
+# Convert a binary log file written by SUNLogger (see
+# SUNLogger_SetBinaryFilename) to the SUNLogger text format or to JSON lines.
+#
+# Usage: binlog.py [--jsonl] binary_log [output]
+# -----------------------------------------------------------------------------
+
+import argparse
+import json
+import re
+import struct
+import sys
+
+MAGIC = b"SUNLOG01"
+
+LEVELS = {1: "ERROR", 2: "WARNING", 3: "INFO", 4: "DEBUG"}
+
+# printf conversion specification (see sunParseConversion in sundials_logger.c)
+CONVERSION = re.compile(
+    r"%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d*))?(hh|h|ll|l|L|z|j|t)?([diouxXeEfFgGaAcsp%])"
+)
+
+
+def read_records(data):
+    """
+    Generator for the message records of a binary log. Each message is a
+    dictionary with the level, rank, scope, label, format, and arguments.
+    """
+    if data[:8] != MAGIC:
+        raise ValueError("not a SUNLogger binary log file")
+
+    # The byte order and size of long double of the writer
+    order = "<" if struct.unpack("<I", data[8:12])[0] == 0x01020304 else ">"
+    ldsize = struct.unpack(order + "I", data[12:16])[0]
+
+    strings = {}
+    pos = 16
+    while pos < len(data):
+        rtype = data[pos : pos + 1]
+        if rtype == b"S":
+            sid, length = struct.unpack(order + "II", data[pos + 4 : pos + 12])
+            strings[sid] = data[pos + 12 : pos + 12 + length - 1].decode()
+            pos += 12 + length
+        elif rtype == b"M":
+            level, rank, scope, label, fmt, size = struct.unpack(
+                order + "xbxxiIIII", data[pos : pos + 24]
+            )
+            args = read_args(data[pos + 24 : pos + 24 + size], order, ldsize)
+            pos += 24 + size
+            yield {
+                "level": LEVELS.get(level, str(level)),
+                "rank": rank,
+                "scope": strings[scope],
+                "label": strings[label],
+                "format": strings[fmt],
+                "args": args,
+            }
+        else:
+            raise ValueError("corrupt record at byte %d" % pos)
+
+
+def read_args(data, order, ldsize):
+    """
+    Decode the tagged arguments of a message.
+    """
+    args = []
+    pos = 0
+    while pos < len(data):
+        tag = data[pos : pos + 1]
+        pos += 1
+        if tag == b"i":
+            args.append(struct.unpack(order + "q", data[pos : pos + 8])[0])
+            pos += 8
+        elif tag in (b"u", b"p"):
+            args.append(struct.unpack(order + "Q", data[pos : pos + 8])[0])
+            pos += 8
+        elif tag == b"d":
+            args.append(struct.unpack(order + "d", data[pos : pos + 8])[0])
+            pos += 8
+        elif tag == b"L":
+            args.append(long_double(data[pos : pos + ldsize], order))
+            pos += ldsize
+        elif tag == b"s":
+            length = struct.unpack(order + "I", data[pos : pos + 4])[0]
+            args.append(data[pos + 4 : pos + 4 + length - 1].decode())
+            pos += 4 + length
+        else:
+            raise ValueError("corrupt argument")
+    return args
+
+
+def long_double(raw, order):
+    """
+    Convert an x87 80-bit extended precision value (the usual long double)
+    to a float, other long double formats are read as doubles.
+    """
+    if len(raw) >= 10 and order == "<":
+        mantissa, exp = struct.unpack("<QH", raw[:10])
+        sign = -1.0 if exp & 0x8000 else 1.0
+        exp &= 0x7FFF
+        if exp == 0x7FFF:
+            return sign * float("inf") if mantissa << 1 == 0 else float("nan")
+        return sign * mantissa * 2.0 ** (exp - 16383 - 63)
+    return struct.unpack(order + "d", raw[:8])[0]
+
+
+def format_message(fmt, args):
+    """
+    Format a message with Python's printf-style formatting, which ignores the
+    C length modifiers.
+    """
+    values = iter(args)
+    out = []
+    last = 0
+    for m in CONVERSION.finditer(fmt):
+        out.append(fmt[last : m.start()])
+        last = m.end()
+        flags, width, prec, _, conv = m.groups()
+        if conv == "%":
+            out.append("%")
+            continue
+        spec = "%" + flags
+        stars = []
+        if width == "*":
+            stars.append(next(values))
+        spec += width or ""
+        if prec is not None:
+            if prec == "*":
+                stars.append(next(values))
+            spec += "." + prec
+        value = next(values)
+        if conv == "p":
+            spec, conv = "%#", "x"
+        elif "#" in flags and conv in "xX" and value == 0:
+            # C omits the 0x prefix for zero
+            spec = spec.replace("#", "")
+        elif conv in "aA":
+            conv = "g"
+        out.append((spec + conv) % tuple(stars + [value]))
+    out.append(fmt[last:])
+    return "".join(out)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Convert a SUNLogger binary log to text or JSON lines"
+    )
+    parser.add_argument("binary_log", help="binary log file")
+    parser.add_argument("output", nargs="?", help="output file (default stdout)")
+    parser.add_argument("--jsonl", action="store_true", help="write JSON lines")
+    args = parser.parse_args()
+
+    with open(args.binary_log, "rb") as f:
+        data = f.read()
+
+    out = open(args.output, "w") if args.output else sys.stdout
+
+    for rec in read_records(data):
+        msg = format_message(rec["format"], rec["args"])
+        if args.jsonl:
+            rec["message"] = msg
+            out.write(json.dumps(rec) + "\n")
+        else:
+            out.write(
+                "[%s][rank %d][%s][%s] %s\n"
+                % (rec["level"], rec["rank"], rec["scope"], rec["label"], msg)
+            )
+
+    if out is not sys.stdout:
+        out.close()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,84 @@
+#!/usr/bin/env python3
+# -----------------------------------------------------------------------------
+# Programmer(s): David J. Gardner @ LLNL
+# -----------------------------------------------------------------------------
+# SUNDIALS Copyright Start
+# Copyright (c) 2002-2024, Lawrence Livermore National Security
+# and Southern Methodist University.
+# All rights reserved.
+#
+# See the top-level LICENSE and NOTICE files for details.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+# SUNDIALS Copyright End
+# -----------------------------------------------------------------------------
+# Memory-map a sparse matrix file written by SUNSparseMatrix_WriteBinary. The
+# matrix is returned as a SciPy CSC or CSR matrix that uses the mapped arrays
+# without reading the file into memory.
+#
+# Usage: sparsematrix.py sparse_matrix_file
+# -----------------------------------------------------------------------------
+
+import struct
+import sys
+
+import numpy as np
+import scipy.sparse as sp
+
+MAGIC = b"SUNSPM01"
+
+REALTYPES = {4: "f4", 8: "f8", 16: "f16"}
+
+INDEXTYPES = {4: "i4", 8: "i8"}
+
+CSC_MAT = 0
+
+
+def read_sparse_matrix(filename):
+    """
+    Return a SciPy sparse matrix with memory-mapped index and data arrays.
+    """
+    with open(filename, "rb") as f:
+        header = f.read(64)
+
+    if header[:8] != MAGIC:
+        raise ValueError("not a SUNSparseMatrix binary file")
+
+    # The byte order and sizes of sunrealtype and sunindextype of the writer
+    order = "<" if struct.unpack("<I", header[8:12])[0] == 0x01020304 else ">"
+    realsize, indexsize, sparsetype = struct.unpack(order + "3I", header[12:24])
+    rows, cols, nnz, indexvals_offset, data_offset = struct.unpack(
+        order + "5Q", header[24:64]
+    )
+
+    rtype = np.dtype(order + REALTYPES[realsize])
+    itype = np.dtype(order + INDEXTYPES[indexsize])
+    np_ = cols if sparsetype == CSC_MAT else rows
+
+    def mapped(dtype, offset, count):
+        if count == 0:
+            return np.empty(0, dtype=dtype)
+        return np.memmap(filename, dtype=dtype, mode="r", offset=offset,
+                         shape=(count,))
+
+    indexptrs = mapped(itype, 64, np_ + 1)
+    indexvals = mapped(itype, indexvals_offset, nnz)
+    data = mapped(rtype, data_offset, nnz)
+
+    fmt = sp.csc_matrix if sparsetype == CSC_MAT else sp.csr_matrix
+    return fmt((data, indexvals, indexptrs), shape=(rows, cols), copy=False)
+
+
+def main():
+    if len(sys.argv) != 2:
+        print("Usage: sparsematrix.py sparse_matrix_file")
+        sys.exit(1)
+
+    A = read_sparse_matrix(sys.argv[1])
+
+    print(f"{A.format} matrix: {A.shape[0]} by {A.shape[1]}, nnz: {A.nnz}")
+    print(f"max |a_ij| = {np.abs(A.data).max() if A.nnz else 0.0:.6e}")
+
+
+if __name__ == "__main__":
+    main()
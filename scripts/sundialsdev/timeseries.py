@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+# -----------------------------------------------------------------------------
+# Programmer(s): David J. Gardner @ LLNL
+# -----------------------------------------------------------------------------
+# SUNDIALS Copyright Start
+# Copyright (c) 2002-2024, Lawrence Livermore National Security
+# and Southern Methodist University.
+# All rights reserved.
+#
+# See the top-level LICENSE and NOTICE files for details.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+# SUNDIALS Copyright End
+# -----------------------------------------------------------------------------
+# Memory-map a time series file written by SUNTimeSeries. The snapshots are
+# returned as a read-only array with one row per snapshot without reading the
+# file into memory.
+#
+# Usage: timeseries.py time_series_file
+# -----------------------------------------------------------------------------
+
+import struct
+import sys
+
+import numpy as np
+
+MAGIC = b"SUNTS001"
+
+REALTYPES = {4: "f4", 8: "f8", 16: "f16"}
+
+
+def read_timeseries(filename):
+    """
+    Return the snapshot times and a memory-mapped array of the snapshots with
+    shape (number of snapshots, number of values in a snapshot).
+    """
+    with open(filename, "rb") as f:
+        header = f.read(64)
+
+    if header[:8] != MAGIC:
+        raise ValueError("not a SUNTimeSeries file")
+
+    # The byte order and size of sunrealtype of the writer
+    order = "<" if struct.unpack("<I", header[8:12])[0] == 0x01020304 else ">"
+    realsize = struct.unpack(order + "I", header[12:16])[0]
+    size, stride, count, data_offset, index_offset = struct.unpack(
+        order + "5Q", header[16:56]
+    )
+
+    dtype = np.dtype(order + REALTYPES[realsize])
+
+    times = np.fromfile(filename, dtype=dtype, count=count, offset=index_offset)
+
+    if count == 0:
+        return times, np.empty((0, size // realsize), dtype=dtype)
+
+    # Map the snapshots with the padding and drop the padding in a view
+    data = np.memmap(
+        filename,
+        dtype=dtype,
+        mode="r",
+        offset=data_offset,
+        shape=(count, stride // realsize),
+    )
+
+    return times, data[:, : size // realsize]
+
+
+def main():
+    if len(sys.argv) != 2:
+        print("Usage: timeseries.py time_series_file")
+        sys.exit(1)
+
+    times, data = read_timeseries(sys.argv[1])
+
+    print(f"snapshots: {data.shape[0]}, values per snapshot: {data.shape[1]}")
+    for t, y in zip(times, data):
+        print(f"t = {t:.6e}, max |y| = {np.abs(y).max():.6e}")
+
+
+if __name__ == "__main__":
+    main()
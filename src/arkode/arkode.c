@@ -30,6 +30,7 @@
 
 #include "arkode_impl.h"
 #include "arkode_interp_impl.h"
+#include "arkode_ls_impl.h"
 #include "sundials/priv/sundials_errors_impl.h"
 #include "sundials/sundials_context.h"
 #include "sundials/sundials_logger.h"
@@ -863,6 +864,12 @@ int ARKodeEvolve(void* arkode_mem, sunrealtype tout, N_Vector yout,
       }
     }
 
+    /* Save the counters and start the clock for the telemetry record */
+    if (ark_mem->telemetry) { arkTelemetryBeginStep(ark_mem); }
+
+    /* Steps after the first are audited for heap allocations */
+    SUNAllocAuditBeginStep(ark_mem->sunctx, ark_mem->nst > 0);
+
     /* Looping point for step attempts */
     dsm      = ZERO;
     attempts = ncf = nef = constrfails = ark_mem->last_kflag = 0;
@@ -940,6 +947,7 @@ int ARKodeEvolve(void* arkode_mem, sunrealtype tout, N_Vector yout,
       /* unsuccessful step, if |h| = hmin, return ARK_ERR_FAILURE */
       if (SUNRabs(ark_mem->h) <= ark_mem->hmin * ONEPSM)
       {
+        SUNAllocAuditEndStep(ark_mem->sunctx);
         SUNDIALS_MARK_FUNCTION_END(ARK_PROFILER);
         return (ARK_ERR_FAILURE);
       }
@@ -955,6 +963,13 @@ int ARKodeEvolve(void* arkode_mem, sunrealtype tout, N_Vector yout,
        (added stuff from arkStep_PrepareNextStep -- revisit) */
     if (kflag == ARK_SUCCESS) { kflag = arkCompleteStep(ark_mem, dsm); }
 
+    SUNAllocAuditEndStep(ark_mem->sunctx);
+
+    if (ark_mem->telemetry && kflag == ARK_SUCCESS)
+    {
+      arkTelemetryEndStep(ark_mem, dsm);
+    }
+
     /* If step attempt loop failed, process flag and return to user */
     if (kflag != ARK_SUCCESS)
     {
@@ -1169,6 +1184,110 @@ int ARKodeGetDky(void* arkode_mem, sunrealtype t, int k, N_Vector dky)
   return (ARK_SUCCESS);
 }
 
+/*---------------------------------------------------------------
+  ARKodeGetDkyBatch:
+
+  This routine computes the k-th derivative of the interpolating
+  polynomial at the nt times t[i] and stores the results in the
+  vectors dky[i]. All times are checked before any output is
+  computed. The interpolation module computes the data that does
+  not depend on t once and evaluates the outputs in groups, with
+  each history vector applied to all outputs of a group in a
+  single N_VScaleAddMulti call.
+  ---------------------------------------------------------------*/
+int ARKodeGetDkyBatch(void* arkode_mem, int nt, sunrealtype* t, int k,
+                      N_Vector* dky)
+{
+  sunrealtype tfuzz, tp, tn1;
+  sunrealtype* s;
+  int i, retval;
+  ARKodeMem ark_mem;
+
+  /* Check if ark_mem exists */
+  if (arkode_mem == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_MEM);
+    return (ARK_MEM_NULL);
+  }
+  ark_mem = (ARKodeMem)arkode_mem;
+
+  SUNDIALS_MARK_FUNCTION_BEGIN(ARK_PROFILER);
+
+  /* Check all inputs for legality */
+  if ((nt < 1) || (t == NULL))
+  {
+    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    MSG_ARK_BAD_NT);
+    SUNDIALS_MARK_FUNCTION_END(ARK_PROFILER);
+    return (ARK_ILL_INPUT);
+  }
+  if (dky == NULL)
+  {
+    arkProcessError(ark_mem, ARK_BAD_DKY, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NULL_DKY);
+    SUNDIALS_MARK_FUNCTION_END(ARK_PROFILER);
+    return (ARK_BAD_DKY);
+  }
+  if (ark_mem->interp == NULL)
+  {
+    arkProcessError(ark_mem, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    "Missing interpolation structure");
+    SUNDIALS_MARK_FUNCTION_END(ARK_PROFILER);
+    return (ARK_MEM_NULL);
+  }
+
+  /* Allow for some slack */
+  tfuzz = FUZZ_FACTOR * ark_mem->uround *
+          (SUNRabs(ark_mem->tcur) + SUNRabs(ark_mem->hold));
+  if (ark_mem->hold < ZERO) { tfuzz = -tfuzz; }
+  tp  = ark_mem->tcur - ark_mem->hold - tfuzz;
+  tn1 = ark_mem->tcur + tfuzz;
+  for (i = 0; i < nt; i++)
+  {
+    if (dky[i] == NULL)
+    {
+      arkProcessError(ark_mem, ARK_BAD_DKY, __LINE__, __func__, __FILE__,
+                      MSG_ARK_NULL_DKY);
+      SUNDIALS_MARK_FUNCTION_END(ARK_PROFILER);
+      return (ARK_BAD_DKY);
+    }
+    if ((t[i] - tp) * (t[i] - tn1) > ZERO)
+    {
+      arkProcessError(ark_mem, ARK_BAD_T, __LINE__, __func__, __FILE__,
+                      MSG_ARK_BAD_T, t[i], ark_mem->tcur - ark_mem->hold,
+                      ark_mem->tcur);
+      SUNDIALS_MARK_FUNCTION_END(ARK_PROFILER);
+      return (ARK_BAD_T);
+    }
+  }
+
+  /* convert the output times to the interpolation variable */
+  s = (sunrealtype*)malloc(nt * sizeof(sunrealtype));
+  if (s == NULL)
+  {
+    arkProcessError(ark_mem, ARK_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_MEM_FAIL);
+    SUNDIALS_MARK_FUNCTION_END(ARK_PROFILER);
+    return (ARK_MEM_FAIL);
+  }
+  for (i = 0; i < nt; i++) { s[i] = (t[i] - ark_mem->tcur) / ark_mem->h; }
+
+  /* call arkInterpEvaluateBatch to evaluate the results */
+  retval = arkInterpEvaluateBatch(ark_mem, ark_mem->interp, nt, s, k,
+                                  ARK_INTERP_MAX_DEGREE, dky);
+  free(s);
+  if (retval != ARK_SUCCESS)
+  {
+    arkProcessError(ark_mem, retval, __LINE__, __func__, __FILE__,
+                    "Error calling arkInterpEvaluateBatch");
+    SUNDIALS_MARK_FUNCTION_END(ARK_PROFILER);
+    return (retval);
+  }
+  SUNDIALS_MARK_FUNCTION_END(ARK_PROFILER);
+  return (ARK_SUCCESS);
+}
+
 /*---------------------------------------------------------------
   ARKodeFree:
 
@@ -1416,6 +1535,7 @@ ARKodeMem arkCreate(SUNContext sunctx)
   ark_mem->step_computestate              = NULL;
   ark_mem->step_setrelaxfn                = NULL;
   ark_mem->step_setorder                  = NULL;
+  ark_mem->step_setnumstagethreads        = NULL;
   ark_mem->step_setnonlinearsolver        = NULL;
   ark_mem->step_setlinear                 = NULL;
   ark_mem->step_setnonlinear              = NULL;
@@ -1470,6 +1590,9 @@ ARKodeMem arkCreate(SUNContext sunctx)
   /* No user-supplied stage postprocessing function yet */
   ark_mem->ProcessStage = NULL;
 
+  /* No telemetry yet */
+  ark_mem->telemetry = NULL;
+
   /* No user_data pointer yet */
   ark_mem->user_data = NULL;
 
@@ -1697,22 +1820,9 @@ int arkInit(ARKodeMem ark_mem, sunrealtype t0, N_Vector y0, int init_type)
     ark_mem->netf         = 0;
     ark_mem->nconstrfails = 0;
 
-    /* Initial, old, and next step sizes */
-    ark_mem->h0u    = ZERO;
-    ark_mem->hold   = ZERO;
-    ark_mem->next_h = ZERO;
-
-    /* Tolerance scale factor */
-    ark_mem->tolsf = ONE;
-
-    /* Reset error controller object */
-    retval = SUNAdaptController_Reset(ark_mem->hadapt_mem->hcontroller);
-    if (retval != SUN_SUCCESS)
-    {
-      arkProcessError(ark_mem, ARK_CONTROLLER_ERR, __LINE__, __func__, __FILE__,
-                      "Unable to reset error controller object");
-      return (ARK_CONTROLLER_ERR);
-    }
+    /* Step sizes, tolerance scale factor, and error controller */
+    retval = arkResetStepHistory(ark_mem);
+    if (retval != ARK_SUCCESS) { return (retval); }
 
     /* Adaptivity counters */
     ark_mem->hadapt_mem->nst_acc = 0;
@@ -1772,6 +1882,42 @@ sunbooleantype arkCheckNvector(N_Vector tmpl) /* to be updated?? */
   else { return (SUNTRUE); }
 }
 
+/*---------------------------------------------------------------
+  arkResetStepHistory:
+
+  This routine discards the step size history: the initial, old,
+  and next step sizes, the tolerance scale factor, and the state
+  of the error controller. It is called on a first initialization
+  and by drivers that reuse an integrator for unrelated time
+  intervals (e.g., Parareal slices).
+  ---------------------------------------------------------------*/
+int arkResetStepHistory(ARKodeMem ark_mem)
+{
+  int retval;
+
+  /* Initial, old, and next step sizes */
+  ark_mem->h0u    = ZERO;
+  ark_mem->hold   = ZERO;
+  ark_mem->next_h = ZERO;
+
+  /* Tolerance scale factor */
+  ark_mem->tolsf = ONE;
+
+  /* Reset error controller object */
+  if (ark_mem->hadapt_mem != NULL)
+  {
+    retval = SUNAdaptController_Reset(ark_mem->hadapt_mem->hcontroller);
+    if (retval != SUN_SUCCESS)
+    {
+      arkProcessError(ark_mem, ARK_CONTROLLER_ERR, __LINE__, __func__, __FILE__,
+                      "Unable to reset error controller object");
+      return (ARK_CONTROLLER_ERR);
+    }
+  }
+
+  return (ARK_SUCCESS);
+}
+
 /*---------------------------------------------------------------
   arkInitialSetup
 
@@ -2568,6 +2714,79 @@ int arkCompleteStep(ARKodeMem ark_mem, sunrealtype dsm)
   return (ARK_SUCCESS);
 }
 
+/*---------------------------------------------------------------
+  arkTelemetryCounters
+
+  This routine gets the nonlinear iteration, linear iteration,
+  and linear solver setup counters from the time stepper module
+  (zero for steppers without these solvers).
+  ---------------------------------------------------------------*/
+static void arkTelemetryCounters(ARKodeMem ark_mem, long int* nni,
+                                 long int* nli, long int* nsetups)
+{
+  void* lmem = NULL;
+
+  *nni = *nli = *nsetups = 0;
+
+  if (ark_mem->step_getnumnonlinsolviters)
+  {
+    (void)ark_mem->step_getnumnonlinsolviters(ark_mem, nni);
+  }
+  if (ark_mem->step_getnumlinsolvsetups)
+  {
+    (void)ark_mem->step_getnumlinsolvsetups(ark_mem, nsetups);
+  }
+  if (ark_mem->step_getlinmem) { lmem = ark_mem->step_getlinmem(ark_mem); }
+  if (lmem) { *nli = ((ARKLsMem)lmem)->nli; }
+}
+
+/*---------------------------------------------------------------
+  arkTelemetryBeginStep
+
+  This routine saves the solver counters and the wall clock time
+  at the start of a step.
+  ---------------------------------------------------------------*/
+void arkTelemetryBeginStep(ARKodeMem ark_mem)
+{
+  sunTelemetryStep* ts = &ark_mem->tel_step;
+
+  memset(&ts->rec, 0, sizeof(ts->rec));
+  arkTelemetryCounters(ark_mem, &ts->nni, &ts->nli, &ts->nsetups);
+  ts->netf = ark_mem->netf;
+  ts->ncfn = ark_mem->ncfn;
+  ts->tic  = sunTelemetryWallTime();
+}
+
+/*---------------------------------------------------------------
+  arkTelemetryEndStep
+
+  This routine completes the telemetry record of a successful
+  step and stores it.
+  ---------------------------------------------------------------*/
+void arkTelemetryEndStep(ARKodeMem ark_mem, sunrealtype dsm)
+{
+  sunTelemetryStep* ts    = &ark_mem->tel_step;
+  SUNTelemetryRecord* rec = &ts->rec;
+  long int nni, nli, nsetups;
+
+  rec->wall_step = sunTelemetryWallTime() - ts->tic;
+
+  arkTelemetryCounters(ark_mem, &nni, &nli, &nsetups);
+
+  rec->t          = (double)ark_mem->tn;
+  rec->h          = (double)ark_mem->hold;
+  rec->error_norm = (double)dsm;
+  rec->step       = ark_mem->nst;
+  rec->order      = ark_mem->hadapt_mem->q;
+  rec->nni        = (int32_t)(nni - ts->nni);
+  rec->nli        = (int32_t)(nli - ts->nli);
+  rec->netf       = (int32_t)(ark_mem->netf - ts->netf);
+  rec->ncfn       = (int32_t)(ark_mem->ncfn - ts->ncfn);
+  if (nsetups != ts->nsetups) { rec->flags |= SUN_TELEMETRY_LSETUP; }
+
+  (void)SUNTelemetry_Record(ark_mem->telemetry, rec);
+}
+
 /*---------------------------------------------------------------
   arkHandleFailure
 
@@ -419,9 +419,17 @@ int arkStep_Nls(ARKodeMem ark_mem, int nflag)
   step_mem->eRNrm = SUN_RCONST(0.1) * step_mem->nlscoef;
 
   /* solve the nonlinear system for the actual correction */
+  if (ark_mem->telemetry)
+  {
+    ark_mem->tel_step.rec.wall_nls -= sunTelemetryWallTime();
+  }
   retval = SUNNonlinSolSolve(step_mem->NLS, step_mem->zpred, step_mem->zcor,
                              ark_mem->ewt, step_mem->nlscoef, callLSetup,
                              ark_mem);
+  if (ark_mem->telemetry)
+  {
+    ark_mem->tel_step.rec.wall_nls += sunTelemetryWallTime();
+  }
 
 #ifdef SUNDIALS_LOGGING_EXTRA_DEBUG
   SUNLogger_QueueMsg(ARK_LOGGER, SUN_LOGLEVEL_DEBUG, "ARKODE::arkStep_Nls",
@@ -476,10 +484,18 @@ int arkStep_NlsLSetup(sunbooleantype jbad, sunbooleantype* jcur, void* arkode_me
   /* Use ARKODE's tempv1, tempv2 and tempv3 as
      temporary vectors for the linear solver setup routine */
   step_mem->nsetups++;
+  if (ark_mem->telemetry)
+  {
+    ark_mem->tel_step.rec.wall_lsetup -= sunTelemetryWallTime();
+  }
   retval = step_mem->lsetup(ark_mem, step_mem->convfail, ark_mem->tcur,
                             ark_mem->ycur, step_mem->Fi[step_mem->istage],
                             &(step_mem->jcur), ark_mem->tempv1, ark_mem->tempv2,
                             ark_mem->tempv3);
+  if (ark_mem->telemetry)
+  {
+    ark_mem->tel_step.rec.wall_lsetup += sunTelemetryWallTime();
+  }
 
   /* update Jacobian status */
   *jcur = step_mem->jcur;
@@ -517,9 +533,17 @@ int arkStep_NlsLSolve(N_Vector b, void* arkode_mem)
   if (retval != SUN_SUCCESS) { return (ARK_NLS_OP_ERR); }
 
   /* call linear solver interface, and handle return value */
+  if (ark_mem->telemetry)
+  {
+    ark_mem->tel_step.rec.wall_lsolve -= sunTelemetryWallTime();
+  }
   retval = step_mem->lsolve(ark_mem, b, ark_mem->tcur, ark_mem->ycur,
                             step_mem->Fi[step_mem->istage], step_mem->eRNrm,
                             nonlin_iter);
+  if (ark_mem->telemetry)
+  {
+    ark_mem->tel_step.rec.wall_lsolve += sunTelemetryWallTime();
+  }
 
   if (retval < 0) { return (ARK_LSOLVE_FAIL); }
   if (retval > 0) { return (CONV_FAIL); }
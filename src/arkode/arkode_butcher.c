@@ -429,6 +429,47 @@ sunbooleantype ARKodeButcherTable_IsStifflyAccurate(ARKodeButcherTable B)
   return SUNTRUE;
 }
 
+/*---------------------------------------------------------------
+  Routine to partition the stages of a Butcher table into groups
+  of mutually independent stages.  Stage i is placed in group
+
+     groups[i] = 1 + max{ groups[j] : j != i, A[i][j] != 0 }
+
+  (or 0 if stage i depends on no other stage), so that every stage
+  depends only on stages in lower-numbered groups and the stages
+  within a group may be computed concurrently.  Diagonal entries
+  of A are ignored since they only couple a stage to itself.
+
+  Inputs:
+     B: Butcher table to analyze (must be explicit or diagonally
+        implicit)
+     groups: array of length B->stages to fill
+
+  Return value: the number of stage groups on success, or -1 if B
+  or groups is NULL or if B is not diagonally implicit.
+  ---------------------------------------------------------------*/
+int ARKodeButcherTable_StageGroups(ARKodeButcherTable B, int* groups)
+{
+  int i, j, ngroups;
+
+  if ((B == NULL) || (groups == NULL) || (B->A == NULL)) { return (-1); }
+
+  ngroups = 0;
+  for (i = 0; i < B->stages; i++)
+  {
+    groups[i] = 0;
+    for (j = 0; j < B->stages; j++)
+    {
+      if ((j == i) || (B->A[i][j] == SUN_RCONST(0.0))) { continue; }
+      if (j > i) { return (-1); }
+      groups[i] = SUNMAX(groups[i], groups[j] + 1);
+    }
+    ngroups = SUNMAX(ngroups, groups[i] + 1);
+  }
+
+  return (ngroups);
+}
+
 /*---------------------------------------------------------------
   Routine to determine the analytical order of accuracy for a
   specified Butcher table.  We check the analytical [necessary]
@@ -102,6 +102,7 @@ void* ERKStepCreate(ARKRhsFn f, sunrealtype t0, N_Vector y0, SUNContext sunctx)
   ark_mem->step_setdefaults         = erkStep_SetDefaults;
   ark_mem->step_setrelaxfn          = erkStep_SetRelaxFn;
   ark_mem->step_setorder            = erkStep_SetOrder;
+  ark_mem->step_setnumstagethreads  = erkStep_SetNumStageThreads;
   ark_mem->step_getestlocalerrors   = erkStep_GetEstLocalErrors;
   ark_mem->step_supports_adaptive   = SUNTRUE;
   ark_mem->step_supports_relaxation = SUNTRUE;
@@ -249,6 +250,21 @@ int erkStep_Resize(ARKodeMem ark_mem, N_Vector y0,
     }
   }
 
+  /* Resize the stage solution vectors (if applicable) */
+  if (step_mem->Z != NULL)
+  {
+    for (i = 0; i < step_mem->stages; i++)
+    {
+      if (!arkResizeVec(ark_mem, resize, resize_data, lrw_diff, liw_diff, y0,
+                        &step_mem->Z[i]))
+      {
+        arkProcessError(ark_mem, ARK_MEM_FAIL, __LINE__, __func__, __FILE__,
+                        "Unable to resize vector");
+        return (ARK_MEM_FAIL);
+      }
+    }
+  }
+
   return (ARK_SUCCESS);
 }
 
@@ -305,6 +321,48 @@ void erkStep_Free(ARKodeMem ark_mem)
       ark_mem->liw -= (step_mem->stages + 1);
     }
 
+    /* free the workspace for concurrent stage evaluation */
+    if (step_mem->group_start != NULL)
+    {
+      free(step_mem->group_start);
+      step_mem->group_start = NULL;
+      ark_mem->liw -= (step_mem->stages + 1);
+    }
+    if (step_mem->stage_order != NULL)
+    {
+      free(step_mem->stage_order);
+      step_mem->stage_order = NULL;
+      ark_mem->liw -= step_mem->stages;
+    }
+    if (step_mem->stage_flag != NULL)
+    {
+      free(step_mem->stage_flag);
+      step_mem->stage_flag = NULL;
+      ark_mem->liw -= step_mem->stages;
+    }
+    if (step_mem->Z != NULL)
+    {
+      for (j = 0; j < step_mem->stages; j++)
+      {
+        arkFreeVec(ark_mem, &step_mem->Z[j]);
+      }
+      free(step_mem->Z);
+      step_mem->Z = NULL;
+      ark_mem->liw -= step_mem->stages;
+    }
+    if (step_mem->stage_cvals != NULL)
+    {
+      free(step_mem->stage_cvals);
+      step_mem->stage_cvals = NULL;
+      ark_mem->lrw -= step_mem->stages * (step_mem->stages + 1);
+    }
+    if (step_mem->stage_Xvecs != NULL)
+    {
+      free(step_mem->stage_Xvecs);
+      step_mem->stage_Xvecs = NULL;
+      ark_mem->liw -= step_mem->stages * (step_mem->stages + 1);
+    }
+
     /* free the time stepper module itself */
     free(ark_mem->step_mem);
     ark_mem->step_mem = NULL;
@@ -451,6 +509,13 @@ int erkStep_Init(ARKodeMem ark_mem, int init_type)
     ark_mem->liw += (step_mem->stages + 1); /* pointers */
   }
 
+  /* Allocate workspace for concurrent evaluation of independent stages */
+  if (step_mem->nstagethreads > 1)
+  {
+    retval = erkStep_SetupStageGroups(ark_mem);
+    if (retval != ARK_SUCCESS) { return (retval); }
+  }
+
   /* Override the interpolant degree (if needed), used in arkInitialSetup */
   if (step_mem->q > 1 && ark_mem->interp_degree > (step_mem->q - 1))
   {
@@ -657,58 +722,68 @@ int erkStep_TakeStep(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPtr)
     ark_mem->fn_is_current = SUNTRUE;
   }
 
-  /* Loop over internal stages to the step; since the method is explicit
-     the first stage RHS is just the full RHS from the start of the step */
-  for (is = 1; is < step_mem->stages; is++)
+  /* Evaluate groups of independent stages concurrently (if enabled) */
+  if ((step_mem->Z != NULL) && (step_mem->nstagethreads > 1))
+  {
+    retval = erkStep_ComputeStageGroups(ark_mem);
+    if (retval != ARK_SUCCESS) { return (retval); }
+  }
+  else
   {
-    /* Set current stage time(s) */
-    ark_mem->tcur = ark_mem->tn + step_mem->B->c[is] * ark_mem->h;
+    /* Loop over internal stages to the step; since the method is explicit
+       the first stage RHS is just the full RHS from the start of the step */
+    for (is = 1; is < step_mem->stages; is++)
+    {
+      /* Set current stage time(s) */
+      ark_mem->tcur = ark_mem->tn + step_mem->B->c[is] * ark_mem->h;
 
 #if SUNDIALS_LOGGING_LEVEL >= SUNDIALS_LOGGING_DEBUG
-    SUNLogger_QueueMsg(ARK_LOGGER, SUN_LOGLEVEL_DEBUG,
-                       "ARKODE::erkStep_TakeStep", "start-stage",
-                       "step = %li, stage = %i, h = %" RSYM ", tcur = %" RSYM,
-                       ark_mem->nst, is, ark_mem->h, ark_mem->tcur);
+      SUNLogger_QueueMsg(ARK_LOGGER, SUN_LOGLEVEL_DEBUG,
+                         "ARKODE::erkStep_TakeStep", "start-stage",
+                         "step = %li, stage = %i, h = %" RSYM ", tcur = %" RSYM,
+                         ark_mem->nst, is, ark_mem->h, ark_mem->tcur);
 #endif
 
-    /* Set ycur to current stage solution */
-    nvec = 0;
-    for (js = 0; js < is; js++)
-    {
-      cvals[nvec] = ark_mem->h * step_mem->B->A[is][js];
-      Xvecs[nvec] = step_mem->F[js];
+      /* Set ycur to current stage solution */
+      nvec = 0;
+      for (js = 0; js < is; js++)
+      {
+        cvals[nvec] = ark_mem->h * step_mem->B->A[is][js];
+        Xvecs[nvec] = step_mem->F[js];
+        nvec += 1;
+      }
+      cvals[nvec] = ONE;
+      Xvecs[nvec] = ark_mem->yn;
       nvec += 1;
-    }
-    cvals[nvec] = ONE;
-    Xvecs[nvec] = ark_mem->yn;
-    nvec += 1;
 
-    /*   call fused vector operation to do the work */
-    retval = N_VLinearCombination(nvec, cvals, Xvecs, ark_mem->ycur);
-    if (retval != 0) { return (ARK_VECTOROP_ERR); }
+      /*   call fused vector operation to do the work */
+      retval = N_VLinearCombination(nvec, cvals, Xvecs, ark_mem->ycur);
+      if (retval != 0) { return (ARK_VECTOROP_ERR); }
 
-    /* apply user-supplied stage postprocessing function (if supplied) */
-    if (ark_mem->ProcessStage != NULL)
-    {
-      retval = ark_mem->ProcessStage(ark_mem->tcur, ark_mem->ycur,
-                                     ark_mem->user_data);
-      if (retval != 0) { return (ARK_POSTPROCESS_STAGE_FAIL); }
-    }
+      /* apply user-supplied stage postprocessing function (if supplied) */
+      if (ark_mem->ProcessStage != NULL)
+      {
+        retval = ark_mem->ProcessStage(ark_mem->tcur, ark_mem->ycur,
+                                       ark_mem->user_data);
+        if (retval != 0) { return (ARK_POSTPROCESS_STAGE_FAIL); }
+      }
 
-    /* compute updated RHS */
-    retval = step_mem->f(ark_mem->tcur, ark_mem->ycur, step_mem->F[is],
-                         ark_mem->user_data);
-    step_mem->nfe++;
-    if (retval < 0) { return (ARK_RHSFUNC_FAIL); }
-    if (retval > 0) { return (ARK_UNREC_RHSFUNC_ERR); }
+      /* compute updated RHS */
+      retval = step_mem->f(ark_mem->tcur, ark_mem->ycur, step_mem->F[is],
+                           ark_mem->user_data);
+      step_mem->nfe++;
+      if (retval < 0) { return (ARK_RHSFUNC_FAIL); }
+      if (retval > 0) { return (ARK_UNREC_RHSFUNC_ERR); }
 
 #ifdef SUNDIALS_LOGGING_EXTRA_DEBUG
-    SUNLogger_QueueMsg(ARK_LOGGER, SUN_LOGLEVEL_DEBUG,
-                       "ARKODE::erkStep_TakeStep", "stage RHS", "F_%i(:) =", is);
-    N_VPrintFile(step_mem->F[is], ARK_LOGGER->debug_fp);
+      SUNLogger_QueueMsg(ARK_LOGGER, SUN_LOGLEVEL_DEBUG,
+                         "ARKODE::erkStep_TakeStep", "stage RHS",
+                         "F_%i(:) =", is);
+      N_VPrintFile(step_mem->F[is], ARK_LOGGER->debug_fp);
 #endif
 
-  } /* loop over stages */
+    } /* loop over stages */
+  }
 
   /* compute time-evolved solution (in ark_ycur), error estimate (in dsm) */
   retval = erkStep_ComputeSolutions(ark_mem, dsmPtr);
@@ -966,6 +1041,250 @@ int erkStep_CheckButcherTable(ARKodeMem ark_mem)
   return (ARK_SUCCESS);
 }
 
+/*---------------------------------------------------------------
+  erkStep_SetupStageGroups
+
+  This routine partitions the stages of the Butcher table into
+  groups of mutually independent stages (see
+  ARKodeButcherTable_StageGroups).  If any group contains more than
+  one stage, it allocates the per-stage solution vectors and fused
+  vector operation arrays used by erkStep_ComputeStageGroups;
+  otherwise the workspace is left unallocated and the sequential
+  stage loop is used.
+  ---------------------------------------------------------------*/
+int erkStep_SetupStageGroups(ARKodeMem ark_mem)
+{
+  ARKodeERKStepMem step_mem;
+  int retval, ig, is, j, stages;
+
+  /* access ARKodeERKStepMem structure */
+  retval = erkStep_AccessStepMem(ark_mem, __func__, &step_mem);
+  if (retval != ARK_SUCCESS) { return (retval); }
+  stages = step_mem->stages;
+
+  /* Allocate integer workspace */
+  if (step_mem->stage_flag == NULL)
+  {
+    step_mem->stage_flag = (int*)calloc(stages, sizeof(int));
+    if (step_mem->stage_flag == NULL) { return (ARK_MEM_FAIL); }
+    ark_mem->liw += stages;
+  }
+  if (step_mem->stage_order == NULL)
+  {
+    step_mem->stage_order = (int*)calloc(stages, sizeof(int));
+    if (step_mem->stage_order == NULL) { return (ARK_MEM_FAIL); }
+    ark_mem->liw += stages;
+  }
+  if (step_mem->group_start == NULL)
+  {
+    step_mem->group_start = (int*)calloc(stages + 1, sizeof(int));
+    if (step_mem->group_start == NULL) { return (ARK_MEM_FAIL); }
+    ark_mem->liw += (stages + 1);
+  }
+
+  /* Determine the stage groups (stored temporarily in stage_flag) */
+  step_mem->ngroups = ARKodeButcherTable_StageGroups(step_mem->B,
+                                                     step_mem->stage_flag);
+  if (step_mem->ngroups < 0)
+  {
+    arkProcessError(ark_mem, ARK_INVALID_TABLE, __LINE__, __func__, __FILE__,
+                    "Unable to determine the independent stages");
+    return (ARK_INVALID_TABLE);
+  }
+
+  /* Sort the stages by group, skipping the first stage since its RHS is
+     computed at the start of the step */
+  j = 0;
+  for (ig = 0; ig < step_mem->ngroups; ig++)
+  {
+    step_mem->group_start[ig] = j;
+    for (is = 1; is < stages; is++)
+    {
+      if (step_mem->stage_flag[is] == ig) { step_mem->stage_order[j++] = is; }
+    }
+  }
+  step_mem->group_start[step_mem->ngroups] = j;
+
+  /* Nothing more to do if every stage must be computed in sequence */
+  if (step_mem->ngroups == stages) { return (ARK_SUCCESS); }
+
+  /* Allocate the stage solution vectors and fused operation arrays */
+  if (step_mem->Z == NULL)
+  {
+    step_mem->Z = (N_Vector*)calloc(stages, sizeof(N_Vector));
+    if (step_mem->Z == NULL) { return (ARK_MEM_FAIL); }
+    ark_mem->liw += stages; /* pointers */
+  }
+  for (j = 0; j < stages; j++)
+  {
+    if (!arkAllocVec(ark_mem, ark_mem->ewt, &(step_mem->Z[j])))
+    {
+      return (ARK_MEM_FAIL);
+    }
+  }
+  if (step_mem->stage_cvals == NULL)
+  {
+    step_mem->stage_cvals = (sunrealtype*)calloc(stages * (stages + 1),
+                                                 sizeof(sunrealtype));
+    if (step_mem->stage_cvals == NULL) { return (ARK_MEM_FAIL); }
+    ark_mem->lrw += stages * (stages + 1);
+  }
+  if (step_mem->stage_Xvecs == NULL)
+  {
+    step_mem->stage_Xvecs = (N_Vector*)calloc(stages * (stages + 1),
+                                              sizeof(N_Vector));
+    if (step_mem->stage_Xvecs == NULL) { return (ARK_MEM_FAIL); }
+    ark_mem->liw += stages * (stages + 1); /* pointers */
+  }
+
+  return (ARK_SUCCESS);
+}
+
+/*---------------------------------------------------------------
+  erkStep_ComputeStage
+
+  This routine computes the solution z for stage is, applies the
+  user-supplied stage postprocessing function (if any), and stores
+  the stage RHS in F[is].  Only ark_mem and step_mem data that is
+  fixed for the duration of the step is read and only z, F[is],
+  cvals and Xvecs are written, so stages with distinct work arrays
+  may be computed concurrently.
+  ---------------------------------------------------------------*/
+int erkStep_ComputeStage(ARKodeMem ark_mem, int is, sunrealtype* cvals,
+                         N_Vector* Xvecs, N_Vector z)
+{
+  ARKodeERKStepMem step_mem;
+  int retval, js, nvec;
+  sunrealtype tstage;
+
+  /* access ARKodeERKStepMem structure */
+  step_mem = (ARKodeERKStepMem)ark_mem->step_mem;
+
+  tstage = ark_mem->tn + step_mem->B->c[is] * ark_mem->h;
+
+  /* Set z to current stage solution */
+  nvec = 0;
+  for (js = 0; js < is; js++)
+  {
+    cvals[nvec] = ark_mem->h * step_mem->B->A[is][js];
+    Xvecs[nvec] = step_mem->F[js];
+    nvec += 1;
+  }
+  cvals[nvec] = ONE;
+  Xvecs[nvec] = ark_mem->yn;
+  nvec += 1;
+
+  /*   call fused vector operation to do the work */
+  retval = N_VLinearCombination(nvec, cvals, Xvecs, z);
+  if (retval != 0) { return (ARK_VECTOROP_ERR); }
+
+  /* apply user-supplied stage postprocessing function (if supplied) */
+  if (ark_mem->ProcessStage != NULL)
+  {
+    retval = ark_mem->ProcessStage(tstage, z, ark_mem->user_data);
+    if (retval != 0) { return (ARK_POSTPROCESS_STAGE_FAIL); }
+  }
+
+  /* compute updated RHS */
+  retval = step_mem->f(tstage, z, step_mem->F[is], ark_mem->user_data);
+  if (retval < 0) { return (ARK_RHSFUNC_FAIL); }
+  if (retval > 0) { return (ARK_UNREC_RHSFUNC_ERR); }
+
+  return (ARK_SUCCESS);
+}
+
+/*---------------------------------------------------------------
+  erkStep_ComputeStageGroups
+
+  This routine replaces the sequential stage loop in
+  erkStep_TakeStep when the stage workspace has been allocated by
+  erkStep_SetupStageGroups.  The groups of independent stages are
+  processed in order; a group with a single stage is computed in
+  ark_ycur exactly as in the sequential loop, while the stages of
+  larger groups are computed in the vectors Z using up to
+  nstagethreads OpenMP threads.  Since each stage only depends on
+  stages in earlier groups, the results match the sequential loop.
+  ---------------------------------------------------------------*/
+int erkStep_ComputeStageGroups(ARKodeMem ark_mem)
+{
+  ARKodeERKStepMem step_mem;
+  int retval, ig, k, first, last, nvec;
+
+  /* access ARKodeERKStepMem structure */
+  retval = erkStep_AccessStepMem(ark_mem, __func__, &step_mem);
+  if (retval != ARK_SUCCESS) { return (retval); }
+
+  nvec = step_mem->stages + 1;
+
+  for (ig = 0; ig < step_mem->ngroups; ig++)
+  {
+    first = step_mem->group_start[ig];
+    last  = step_mem->group_start[ig + 1];
+    if (first == last) { continue; }
+
+#if SUNDIALS_LOGGING_LEVEL >= SUNDIALS_LOGGING_DEBUG
+    for (k = first; k < last; k++)
+    {
+      SUNLogger_QueueMsg(ARK_LOGGER, SUN_LOGLEVEL_DEBUG,
+                         "ARKODE::erkStep_TakeStep", "start-stage",
+                         "step = %li, stage = %i, h = %" RSYM ", tcur = %" RSYM,
+                         ark_mem->nst, step_mem->stage_order[k], ark_mem->h,
+                         ark_mem->tn + step_mem->B->c[step_mem->stage_order[k]] *
+                                         ark_mem->h);
+    }
+#endif
+
+    if (last - first == 1)
+    {
+      /* compute a lone stage in ycur */
+      retval = erkStep_ComputeStage(ark_mem, step_mem->stage_order[first],
+                                    step_mem->cvals, step_mem->Xvecs,
+                                    ark_mem->ycur);
+      step_mem->nfe++;
+      if (retval != ARK_SUCCESS) { return (retval); }
+    }
+    else
+    {
+      /* compute the independent stages concurrently */
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(step_mem->nstagethreads) schedule(static, 1)
+#endif
+      for (k = first; k < last; k++)
+      {
+        int is = step_mem->stage_order[k];
+        step_mem->stage_flag[is] =
+          erkStep_ComputeStage(ark_mem, is, step_mem->stage_cvals + is * nvec,
+                               step_mem->stage_Xvecs + is * nvec,
+                               step_mem->Z[is]);
+      }
+      step_mem->nfe += last - first;
+
+      /* return the first failure in stage order */
+      for (k = first; k < last; k++)
+      {
+        retval = step_mem->stage_flag[step_mem->stage_order[k]];
+        if (retval != ARK_SUCCESS) { return (retval); }
+      }
+    }
+
+    /* Set current stage time to the last stage of the group */
+    ark_mem->tcur = ark_mem->tn +
+                    step_mem->B->c[step_mem->stage_order[last - 1]] * ark_mem->h;
+
+#ifdef SUNDIALS_LOGGING_EXTRA_DEBUG
+    for (k = first; k < last; k++)
+    {
+      SUNLogger_QueueMsg(ARK_LOGGER, SUN_LOGLEVEL_DEBUG,
+                         "ARKODE::erkStep_TakeStep", "stage RHS",
+                         "F_%i(:) =", step_mem->stage_order[k]);
+      N_VPrintFile(step_mem->F[step_mem->stage_order[k]], ARK_LOGGER->debug_fp);
+    }
+#endif
+  }
+
+  return (ARK_SUCCESS);
+}
+
 /*---------------------------------------------------------------
   erkStep_ComputeSolutions
 
@@ -61,6 +61,16 @@ typedef struct ARKodeERKStepMemRec
   sunrealtype* cvals;
   N_Vector* Xvecs;
 
+  /* Concurrent evaluation of independent stages */
+  int nstagethreads;        /* threads for independent stages   */
+  int ngroups;              /* number of stage groups           */
+  int* group_start;         /* offset of each group in order    */
+  int* stage_order;         /* stage indices sorted by group    */
+  int* stage_flag;          /* return flag of each stage        */
+  N_Vector* Z;              /* stage solutions (NULL if unused) */
+  sunrealtype* stage_cvals; /* per-stage fused op coefficients  */
+  N_Vector* stage_Xvecs;    /* per-stage fused op vectors       */
+
 }* ARKodeERKStepMem;
 
 /*===============================================================
@@ -75,6 +85,7 @@ int erkStep_TakeStep(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPtr);
 int erkStep_SetUserData(ARKodeMem ark_mem, void* user_data);
 int erkStep_SetDefaults(ARKodeMem ark_mem);
 int erkStep_SetOrder(ARKodeMem ark_mem, int ord);
+int erkStep_SetNumStageThreads(ARKodeMem ark_mem, int nthreads);
 int erkStep_PrintAllStats(ARKodeMem ark_mem, FILE* outfile, SUNOutputFormat fmt);
 int erkStep_WriteParameters(ARKodeMem ark_mem, FILE* fp);
 int erkStep_Reset(ARKodeMem ark_mem, sunrealtype tR, N_Vector yR);
@@ -93,6 +104,10 @@ sunbooleantype erkStep_CheckNVector(N_Vector tmpl);
 int erkStep_SetButcherTable(ARKodeMem ark_mem);
 int erkStep_CheckButcherTable(ARKodeMem ark_mem);
 int erkStep_ComputeSolutions(ARKodeMem ark_mem, sunrealtype* dsm);
+int erkStep_SetupStageGroups(ARKodeMem ark_mem);
+int erkStep_ComputeStage(ARKodeMem ark_mem, int is, sunrealtype* cvals,
+                         N_Vector* Xvecs, N_Vector z);
+int erkStep_ComputeStageGroups(ARKodeMem ark_mem);
 
 /* private functions for relaxation */
 int erkStep_SetRelaxFn(ARKodeMem ark_mem, ARKRelaxFn rfn, ARKRelaxJacFn rjac);
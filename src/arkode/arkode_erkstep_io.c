@@ -315,6 +315,9 @@ int erkStep_SetDefaults(ARKodeMem ark_mem)
                                         SUN_RCONST(1.2));
   (void)SUNAdaptController_SetParams_PI(ark_mem->hadapt_mem->hcontroller,
                                         SUN_RCONST(0.8), -SUN_RCONST(0.31));
+
+  /* evaluate stages sequentially by default */
+  step_mem->nstagethreads = 1;
   return (ARK_SUCCESS);
 }
 
@@ -351,6 +354,45 @@ int erkStep_SetOrder(ARKodeMem ark_mem, int ord)
   return (ARK_SUCCESS);
 }
 
+/*---------------------------------------------------------------
+  erkStep_SetNumStageThreads:
+
+  Specifies the number of threads used to evaluate independent
+  stages concurrently; the stage workspace is allocated in
+  erkStep_Init.  The value is ignored when ARKODE is built without
+  OpenMP so the workspace is never allocated.
+  ---------------------------------------------------------------*/
+int erkStep_SetNumStageThreads(ARKodeMem ark_mem, int nthreads)
+{
+  ARKodeERKStepMem step_mem;
+  int retval;
+
+  /* access ARKodeERKStepMem structure */
+  retval = erkStep_AccessStepMem(ark_mem, __func__, &step_mem);
+  if (retval != ARK_SUCCESS) { return (retval); }
+
+#if !defined(SUNDIALS_CONTEXT_SHARED_BY_THREADS)
+  /* concurrent stages would update the profiler or logger from many threads */
+  if (nthreads > 1)
+  {
+    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "Concurrent stages require a thread-safe SUNContext when "
+                    "profiling or logging is enabled");
+    return (ARK_ILL_INPUT);
+  }
+#endif
+
+#ifdef _OPENMP
+  /* set user-provided value, or default, depending on argument */
+  step_mem->nstagethreads = (nthreads > 1) ? nthreads : 1;
+#else
+  /* without OpenMP the stages are always computed in sequence */
+  step_mem->nstagethreads = 1;
+#endif
+
+  return (ARK_SUCCESS);
+}
+
 /*---------------------------------------------------------------
   erkStep_GetEstLocalErrors: Returns the current local truncation
   error estimate vector
@@ -419,6 +461,10 @@ int erkStep_WriteParameters(ARKodeMem ark_mem, FILE* fp)
   /* print integrator parameters to file */
   fprintf(fp, "ERKStep time step module parameters:\n");
   fprintf(fp, "  Method order %i\n", step_mem->q);
+  if (step_mem->nstagethreads > 1)
+  {
+    fprintf(fp, "  Stage threads %i\n", step_mem->nstagethreads);
+  }
   fprintf(fp, "\n");
 
   return (ARK_SUCCESS);
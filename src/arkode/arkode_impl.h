@@ -25,6 +25,7 @@
 #include <arkode/arkode_butcher_erk.h>
 #include <sundials/priv/sundials_context_impl.h>
 #include <sundials/priv/sundials_errors_impl.h>
+#include <sundials/priv/sundials_telemetry_impl.h>
 #include <sundials/sundials_adaptcontroller.h>
 #include <sundials/sundials_context.h>
 #include <sundials/sundials_linearsolver.h>
@@ -224,6 +225,7 @@ typedef void (*ARKTimestepFree)(ARKodeMem ark_mem);
 typedef void (*ARKTimestepPrintMem)(ARKodeMem ark_mem, FILE* outfile);
 typedef int (*ARKTimestepSetDefaults)(ARKodeMem ark_mem);
 typedef int (*ARKTimestepSetOrder)(ARKodeMem ark_mem, int maxord);
+typedef int (*ARKTimestepSetNumStageThreads)(ARKodeMem ark_mem, int nthreads);
 
 /* time stepper interface functions -- temporal adaptivity */
 typedef int (*ARKTimestepGetEstLocalErrors)(ARKodeMem ark_mem, N_Vector ele);
@@ -310,6 +312,8 @@ struct _generic_ARKInterpOps
   int (*update)(ARKodeMem ark_mem, ARKInterp interp, sunrealtype tnew);
   int (*evaluate)(ARKodeMem ark_mem, ARKInterp interp, sunrealtype tau, int d,
                   int order, N_Vector yout);
+  int (*evaluatebatch)(ARKodeMem ark_mem, ARKInterp interp, int ntau,
+                       sunrealtype* tau, int d, int order, N_Vector* yout);
 };
 
 /* An interpolation module consists of an implementation-dependent 'content'
@@ -331,6 +335,8 @@ int arkInterpInit(ARKodeMem ark_mem, ARKInterp interp, sunrealtype tnew);
 int arkInterpUpdate(ARKodeMem ark_mem, ARKInterp interp, sunrealtype tnew);
 int arkInterpEvaluate(ARKodeMem ark_mem, ARKInterp interp, sunrealtype tau,
                       int d, int order, N_Vector yout);
+int arkInterpEvaluateBatch(ARKodeMem ark_mem, ARKInterp interp, int ntau,
+                           sunrealtype* tau, int d, int order, N_Vector* yout);
 
 /*===============================================================
   ARKODE data structures
@@ -406,6 +412,7 @@ struct ARKodeMemRec
   ARKTimestepPrintMem step_printmem;
   ARKTimestepSetDefaults step_setdefaults;
   ARKTimestepSetOrder step_setorder;
+  ARKTimestepSetNumStageThreads step_setnumstagethreads;
 
   /* Time stepper module -- temporal adaptivity */
   sunbooleantype step_supports_adaptive;
@@ -547,6 +554,10 @@ struct ARKodeMemRec
   /* User-supplied stage solution post-processing function */
   ARKPostProcessFn ProcessStage;
 
+  /* Per-step telemetry */
+  SUNTelemetry telemetry;     /* telemetry records (NULL if not collected) */
+  sunTelemetryStep tel_step;  /* telemetry state of the current step       */
+
   sunbooleantype use_compensated_sums;
 
   /* XBraid interface variables */
@@ -585,6 +596,7 @@ void arkProcessError(ARKodeMem ark_mem, int error_code, int line,
 
 ARKodeMem arkCreate(SUNContext sunctx);
 int arkInit(ARKodeMem ark_mem, sunrealtype t0, N_Vector y0, int init_type);
+int arkResetStepHistory(ARKodeMem ark_mem);
 sunbooleantype arkAllocVec(ARKodeMem ark_mem, N_Vector tmpl, N_Vector* v);
 sunbooleantype arkAllocVecArray(int count, N_Vector tmpl, N_Vector** v,
                                 sunindextype lrw1, long int* lrw,
@@ -615,6 +627,8 @@ sunrealtype arkUpperBoundH0(ARKodeMem ark_mem, sunrealtype tdist);
 int arkYddNorm(ARKodeMem ark_mem, sunrealtype hg, sunrealtype* yddnrm);
 
 int arkCompleteStep(ARKodeMem ark_mem, sunrealtype dsm);
+void arkTelemetryBeginStep(ARKodeMem ark_mem);
+void arkTelemetryEndStep(ARKodeMem ark_mem, sunrealtype dsm);
 int arkHandleFailure(ARKodeMem ark_mem, int flag);
 
 int arkEwtSetSS(N_Vector ycur, N_Vector weight, void* arkode_mem);
@@ -695,6 +709,7 @@ int arkGetLastKFlag(void* arkode_mem, int* last_kflag);
 #define MSG_ARK_BAD_NVECTOR    "A required vector operation is not implemented."
 #define MSG_ARK_BAD_CONSTR     "Illegal values in constraints vector."
 #define MSG_ARK_NULL_DKY       "dky = NULL illegal."
+#define MSG_ARK_BAD_NT         "nt < 1 or t = NULL illegal."
 #define MSG_ARK_BAD_T          "Illegal value for t. " MSG_TIME_INT
 #define MSG_ARK_NO_ROOT        "Rootfinding was not initialized."
 
@@ -1135,6 +1150,14 @@ int arkGetLastKFlag(void* arkode_mem, int* last_kflag);
   requested method order parameter that was passed to
   ARKodeSetOrder.
 
+  ---------------------------------------------------------------
+
+  ARKTimestepSetNumStageThreads
+
+  This optional routine allows the stepper to accept the number of
+  threads to use for concurrent evaluation of independent stages
+  that was passed to ARKodeSetNumStageThreads.
+
   ===============================================================
 
   Internal Interface to Time Steppers -- Temporal Adaptivity
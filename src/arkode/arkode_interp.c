@@ -80,6 +80,48 @@ int arkInterpEvaluate(ARKodeMem ark_mem, ARKInterp interp, sunrealtype tau,
   return ((int)interp->ops->evaluate(ark_mem, interp, tau, d, order, yout));
 }
 
+int arkInterpEvaluateBatch(ARKodeMem ark_mem, ARKInterp interp, int ntau,
+                           sunrealtype* tau, int d, int order, N_Vector* yout)
+{
+  int i, retval;
+  if (interp == NULL) { return (ARK_SUCCESS); }
+  if (interp->ops->evaluatebatch != NULL)
+  {
+    return ((int)interp->ops->evaluatebatch(ark_mem, interp, ntau, tau, d,
+                                            order, yout));
+  }
+  for (i = 0; i < ntau; i++)
+  {
+    retval = interp->ops->evaluate(ark_mem, interp, tau[i], d, order, yout[i]);
+    if (retval != ARK_SUCCESS) { return (retval); }
+  }
+  return (ARK_SUCCESS);
+}
+
+/*---------------------------------------------------------------
+  arkInterpCombineBatch
+
+  This routine evaluates nb linear combinations of the same nvec
+  vectors with different coefficients,
+     yout[i] = sum_j a[j*nb+i] X[j],  i = 0,...,nb-1,
+  applying each X[j] to all outputs with a single call to
+  N_VScaleAddMulti.
+  ---------------------------------------------------------------*/
+static int arkInterpCombineBatch(int nb, int nvec, sunrealtype* a, N_Vector* X,
+                                 N_Vector* yout)
+{
+  int i, j, retval;
+
+  for (i = 0; i < nb; i++) { N_VScale(a[i], X[0], yout[i]); }
+  for (j = 1; j < nvec; j++)
+  {
+    retval = N_VScaleAddMulti(nb, a + j * nb, X[j], yout, yout);
+    if (retval != 0) { return (ARK_VECTOROP_ERR); }
+  }
+
+  return (ARK_SUCCESS);
+}
+
 /*---------------------------------------------------------------
   Section II: Hermite interpolation module implementation
   ---------------------------------------------------------------*/
@@ -113,13 +155,14 @@ ARKInterp arkInterpCreate_Hermite(ARKodeMem ark_mem, int degree)
     free(interp);
     return (NULL);
   }
-  ops->resize    = arkInterpResize_Hermite;
-  ops->free      = arkInterpFree_Hermite;
-  ops->print     = arkInterpPrintMem_Hermite;
-  ops->setdegree = arkInterpSetDegree_Hermite;
-  ops->init      = arkInterpInit_Hermite;
-  ops->update    = arkInterpUpdate_Hermite;
-  ops->evaluate  = arkInterpEvaluate_Hermite;
+  ops->resize        = arkInterpResize_Hermite;
+  ops->free          = arkInterpFree_Hermite;
+  ops->print         = arkInterpPrintMem_Hermite;
+  ops->setdegree     = arkInterpSetDegree_Hermite;
+  ops->init          = arkInterpInit_Hermite;
+  ops->update        = arkInterpUpdate_Hermite;
+  ops->evaluate      = arkInterpEvaluate_Hermite;
+  ops->evaluatebatch = arkInterpEvaluateBatch_Hermite;
 
   /* create content, and initialize everything to zero/NULL */
   content = NULL;
@@ -406,43 +449,80 @@ int arkInterpUpdate_Hermite(ARKodeMem ark_mem, ARKInterp interp, sunrealtype tne
 }
 
 /*---------------------------------------------------------------
-  arkInterpEvaluate_Hermite
+  arkInterpHermitePrepare
 
-  This routine evaluates a temporal interpolation/extrapolation
-  based on the data in the interpolation structure:
-     yold = y(told)
-     ynew = y(tnew)
-     fold = f(told, yold)
-     fnew = f(told, ynew)
-  This typically consists of using a cubic Hermite interpolating
-  formula with this data.  If greater polynomial degree than 3 is
-  requested, then we can bootstrap up to a 5th-order interpolant.
-  For lower order interpolants than cubic, we use:
-     {yold,ynew,fnew} for quadratic
-     {yold,ynew} for linear
-     {0.5*(yold+ynew)} for constant.
+  This routine computes the data of the Hermite interpolant of
+  degree q that does not depend on tau, i.e., the RHS values fa
+  (and fb) at the interior points used to bootstrap the quartic
+  and quintic interpolants. The vector ytmp is used as temporary
+  storage.
+  ---------------------------------------------------------------*/
+static int arkInterpHermitePrepare(ARKodeMem ark_mem, ARKInterp interp, int q,
+                                 N_Vector ytmp)
+{
+  int retval;
+  sunrealtype tval, h;
 
-  Derivatives have lower accuracy than the interpolant
-  itself, losing one order per derivative.  We will provide
-  derivatives up to d = min(5,q).
+  h = HINT_H(interp);
 
-  The input 'tau' specifies the time at which to evaluate the Hermite
-  polynomial.  The formula for tau is defined using the
-  most-recently-completed solution interval [told,tnew], and is
-  given by:
-               t = tnew + tau*(tnew-told),
-  where h = tnew-told, i.e. values -1<tau<0 provide interpolation,
-  other values result in extrapolation.
+  switch (q)
+  {
+  case (4): /* quartic interpolant */
+    /* first, evaluate cubic interpolant at tau=-1/3 */
+    tval   = -ONE / THREE;
+    retval = arkInterpEvaluate(ark_mem, interp, tval, 0, 3, ytmp);
+    if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
+
+    /* second, evaluate RHS at tau=-1/3, storing the result in fa */
+    tval   = HINT_TNEW(interp) - h / THREE;
+    retval = ark_mem->step_fullrhs(ark_mem, tval, ytmp, HINT_FA(interp),
+                                   ARK_FULLRHS_OTHER);
+    if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
+    break;
+
+  case (5): /* quintic interpolant */
+    /* first, evaluate quartic interpolant at tau=-1/3 */
+    tval   = -ONE / THREE;
+    retval = arkInterpEvaluate(ark_mem, interp, tval, 0, 4, ytmp);
+    if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
+
+    /* second, evaluate RHS at tau=-1/3, storing the result in fa */
+    tval   = HINT_TNEW(interp) - h / THREE;
+    retval = ark_mem->step_fullrhs(ark_mem, tval, ytmp, HINT_FA(interp),
+                                   ARK_FULLRHS_OTHER);
+    if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
+
+    /* third, evaluate quartic interpolant at tau=-2/3 */
+    tval   = -TWO / THREE;
+    retval = arkInterpEvaluate(ark_mem, interp, tval, 0, 4, ytmp);
+    if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
+
+    /* fourth, evaluate RHS at tau=-2/3, storing the result in fb */
+    tval   = HINT_TNEW(interp) - h * TWO / THREE;
+    retval = ark_mem->step_fullrhs(ark_mem, tval, ytmp, HINT_FB(interp),
+                                   ARK_FULLRHS_OTHER);
+    if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
+    break;
+  }
+
+  return (ARK_SUCCESS);
+}
+
+/*---------------------------------------------------------------
+  arkInterpHermiteCoeffs
+
+  This routine fills the coefficients a and vectors X of the
+  linear combination that evaluates the d-th derivative of the
+  Hermite interpolant of degree q at tau (0 <= d <= q). The data
+  from arkInterpHermitePrepare must be current. Returns the number
+  of vectors, or 0 for an illegal degree.
   ---------------------------------------------------------------*/
-int arkInterpEvaluate_Hermite(ARKodeMem ark_mem, ARKInterp interp,
-                              sunrealtype tau, int d, int order, N_Vector yout)
+static int arkInterpHermiteCoeffs(ARKodeMem ark_mem, ARKInterp interp,
+                                  sunrealtype tau, int d, int q,
+                                  sunrealtype* a, N_Vector* X)
 {
-  /* local variables */
-  int q, retval;
-  sunrealtype tval, a0, a1, tau2, tau3, tau4, tau5;
+  sunrealtype tau2, tau3, tau4, tau5;
   sunrealtype h, h2, h3, h4, h5;
-  sunrealtype a[6];
-  N_Vector X[6];
 
   /* set constants */
   tau2 = tau * tau;
@@ -456,61 +536,30 @@ int arkInterpEvaluate_Hermite(ARKodeMem ark_mem, ARKInterp interp,
   h4 = h * h3;
   h5 = h * h4;
 
-  /* determine polynomial order q */
-  q = SUNMAX(order, 0);               /* respect lower bound  */
-  q = SUNMIN(q, HINT_DEGREE(interp)); /* respect max possible */
-
-#if SUNDIALS_LOGGING_LEVEL >= SUNDIALS_LOGGING_DEBUG
-  SUNLogger_QueueMsg(ARK_LOGGER, SUN_LOGLEVEL_DEBUG,
-                     "ARKODE::arkInterpEvaluate_Hermite", "interp-eval",
-                     "tau = %" RSYM ", d = %i, q = %i", tau, d, q);
-#endif
-
-  /* call full RHS if needed -- called just AFTER the end of a step, so yn has
-     been updated to ycur */
-  if (!(ark_mem->fn_is_current))
-  {
-    retval = ark_mem->step_fullrhs(ark_mem, ark_mem->tn, ark_mem->yn,
-                                   ark_mem->fn, ARK_FULLRHS_END);
-    if (retval) { return ARK_RHSFUNC_FAIL; }
-    ark_mem->fn_is_current = SUNTRUE;
-  }
-
-  /* error on illegal d */
-  if (d < 0)
-  {
-    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
-                    "Requested illegal derivative.");
-    return (ARK_ILL_INPUT);
-  }
-
-  /* if d is too high, just return zeros */
-  if (d > q)
-  {
-    N_VConst(ZERO, yout);
-    return (ARK_SUCCESS);
-  }
-
-  /* build polynomial based on order */
+  /* build polynomial coefficients based on order */
   switch (q)
   {
   case (0): /* constant interpolant, yout = 0.5*(yn+yp) */
-    N_VLinearSum(HALF, HINT_YOLD(interp), HALF, ark_mem->yn, yout);
-    break;
+    a[0] = HALF;
+    a[1] = HALF;
+    X[0] = HINT_YOLD(interp);
+    X[1] = ark_mem->yn;
+    return (2);
 
   case (1): /* linear interpolant */
     if (d == 0)
     {
-      a0 = -tau;
-      a1 = ONE + tau;
+      a[0] = -tau;
+      a[1] = ONE + tau;
     }
     else
     { /* d=1 */
-      a0 = -ONE / h;
-      a1 = ONE / h;
+      a[0] = -ONE / h;
+      a[1] = ONE / h;
     }
-    N_VLinearSum(a0, HINT_YOLD(interp), a1, ark_mem->yn, yout);
-    break;
+    X[0] = HINT_YOLD(interp);
+    X[1] = ark_mem->yn;
+    return (2);
 
   case (2): /* quadratic interpolant */
     if (d == 0)
@@ -531,12 +580,10 @@ int arkInterpEvaluate_Hermite(ARKodeMem ark_mem, ARKInterp interp,
       a[1] = -TWO / h / h;
       a[2] = TWO / h;
     }
-    X[0]   = HINT_YOLD(interp);
-    X[1]   = ark_mem->yn;
-    X[2]   = ark_mem->fn;
-    retval = N_VLinearCombination(3, a, X, yout);
-    if (retval != 0) { return (ARK_VECTOROP_ERR); }
-    break;
+    X[0] = HINT_YOLD(interp);
+    X[1] = ark_mem->yn;
+    X[2] = ark_mem->fn;
+    return (3);
 
   case (3): /* cubic interpolant */
     if (d == 0)
@@ -567,27 +614,13 @@ int arkInterpEvaluate_Hermite(ARKodeMem ark_mem, ARKInterp interp,
       a[2] = SIX / h2;
       a[3] = SIX / h2;
     }
-    X[0]   = HINT_YOLD(interp);
-    X[1]   = ark_mem->yn;
-    X[2]   = HINT_FOLD(interp);
-    X[3]   = ark_mem->fn;
-    retval = N_VLinearCombination(4, a, X, yout);
-    if (retval != 0) { return (ARK_VECTOROP_ERR); }
-    break;
+    X[0] = HINT_YOLD(interp);
+    X[1] = ark_mem->yn;
+    X[2] = HINT_FOLD(interp);
+    X[3] = ark_mem->fn;
+    return (4);
 
   case (4): /* quartic interpolant */
-
-    /* first, evaluate cubic interpolant at tau=-1/3 */
-    tval   = -ONE / THREE;
-    retval = arkInterpEvaluate(ark_mem, interp, tval, 0, 3, yout);
-    if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
-
-    /* second, evaluate RHS at tau=-1/3, storing the result in fa */
-    tval   = HINT_TNEW(interp) - h / THREE;
-    retval = ark_mem->step_fullrhs(ark_mem, tval, yout, HINT_FA(interp),
-                                   ARK_FULLRHS_OTHER);
-    if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
-
     /* evaluate desired function */
     if (d == 0)
     {
@@ -636,39 +669,14 @@ int arkInterpEvaluate_Hermite(ARKodeMem ark_mem, ARKInterp interp,
       a[3] = ZERO;
       a[4] = -SUN_RCONST(162.0) / h3;
     }
-    X[0]   = HINT_YOLD(interp);
-    X[1]   = ark_mem->yn;
-    X[2]   = HINT_FOLD(interp);
-    X[3]   = ark_mem->fn;
-    X[4]   = HINT_FA(interp);
-    retval = N_VLinearCombination(5, a, X, yout);
-    if (retval != 0) { return (ARK_VECTOROP_ERR); }
-    break;
+    X[0] = HINT_YOLD(interp);
+    X[1] = ark_mem->yn;
+    X[2] = HINT_FOLD(interp);
+    X[3] = ark_mem->fn;
+    X[4] = HINT_FA(interp);
+    return (5);
 
   case (5): /* quintic interpolant */
-
-    /* first, evaluate quartic interpolant at tau=-1/3 */
-    tval   = -ONE / THREE;
-    retval = arkInterpEvaluate(ark_mem, interp, tval, 0, 4, yout);
-    if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
-
-    /* second, evaluate RHS at tau=-1/3, storing the result in fa */
-    tval   = HINT_TNEW(interp) - h / THREE;
-    retval = ark_mem->step_fullrhs(ark_mem, tval, yout, HINT_FA(interp),
-                                   ARK_FULLRHS_OTHER);
-    if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
-
-    /* third, evaluate quartic interpolant at tau=-2/3 */
-    tval   = -TWO / THREE;
-    retval = arkInterpEvaluate(ark_mem, interp, tval, 0, 4, yout);
-    if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
-
-    /* fourth, evaluate RHS at tau=-2/3, storing the result in fb */
-    tval   = HINT_TNEW(interp) - h * TWO / THREE;
-    retval = ark_mem->step_fullrhs(ark_mem, tval, yout, HINT_FB(interp),
-                                   ARK_FULLRHS_OTHER);
-    if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
-
     /* evaluate desired function */
     if (d == 0)
     {
@@ -763,21 +771,178 @@ int arkInterpEvaluate_Hermite(ARKodeMem ark_mem, ARKInterp interp,
       a[4] = SUN_RCONST(2430.0) / h4;
       a[5] = a[4];
     }
-    X[0]   = HINT_YOLD(interp);
-    X[1]   = ark_mem->yn;
-    X[2]   = HINT_FOLD(interp);
-    X[3]   = ark_mem->fn;
-    X[4]   = HINT_FA(interp);
-    X[5]   = HINT_FB(interp);
-    retval = N_VLinearCombination(6, a, X, yout);
-    if (retval != 0) { return (ARK_VECTOROP_ERR); }
-    break;
+    X[0] = HINT_YOLD(interp);
+    X[1] = ark_mem->yn;
+    X[2] = HINT_FOLD(interp);
+    X[3] = ark_mem->fn;
+    X[4] = HINT_FA(interp);
+    X[5] = HINT_FB(interp);
+    return (6);
+
+  default: return (0);
+  }
+}
+
+/*---------------------------------------------------------------
+  arkInterpEvaluate_Hermite
 
-  default:
+  This routine evaluates a temporal interpolation/extrapolation
+  based on the data in the interpolation structure:
+     yold = y(told)
+     ynew = y(tnew)
+     fold = f(told, yold)
+     fnew = f(told, ynew)
+  This typically consists of using a cubic Hermite interpolating
+  formula with this data.  If greater polynomial degree than 3 is
+  requested, then we can bootstrap up to a 5th-order interpolant.
+  For lower order interpolants than cubic, we use:
+     {yold,ynew,fnew} for quadratic
+     {yold,ynew} for linear
+     {0.5*(yold+ynew)} for constant.
+
+  Derivatives have lower accuracy than the interpolant
+  itself, losing one order per derivative.  We will provide
+  derivatives up to d = min(5,q).
+
+  The input 'tau' specifies the time at which to evaluate the Hermite
+  polynomial.  The formula for tau is defined using the
+  most-recently-completed solution interval [told,tnew], and is
+  given by:
+               t = tnew + tau*(tnew-told),
+  where h = tnew-told, i.e. values -1<tau<0 provide interpolation,
+  other values result in extrapolation.
+  ---------------------------------------------------------------*/
+int arkInterpEvaluate_Hermite(ARKodeMem ark_mem, ARKInterp interp,
+                              sunrealtype tau, int d, int order, N_Vector yout)
+{
+  /* local variables */
+  int q, nvec, retval;
+  sunrealtype a[6];
+  N_Vector X[6];
+
+  /* determine polynomial order q */
+  q = SUNMAX(order, 0);               /* respect lower bound  */
+  q = SUNMIN(q, HINT_DEGREE(interp)); /* respect max possible */
+
+#if SUNDIALS_LOGGING_LEVEL >= SUNDIALS_LOGGING_DEBUG
+  SUNLogger_QueueMsg(ARK_LOGGER, SUN_LOGLEVEL_DEBUG,
+                     "ARKODE::arkInterpEvaluate_Hermite", "interp-eval",
+                     "tau = %" RSYM ", d = %i, q = %i", tau, d, q);
+#endif
+
+  /* call full RHS if needed -- called just AFTER the end of a step, so yn has
+     been updated to ycur */
+  if (!(ark_mem->fn_is_current))
+  {
+    retval = ark_mem->step_fullrhs(ark_mem, ark_mem->tn, ark_mem->yn,
+                                   ark_mem->fn, ARK_FULLRHS_END);
+    if (retval) { return ARK_RHSFUNC_FAIL; }
+    ark_mem->fn_is_current = SUNTRUE;
+  }
+
+  /* error on illegal d */
+  if (d < 0)
+  {
+    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "Requested illegal derivative.");
+    return (ARK_ILL_INPUT);
+  }
+
+  /* if d is too high, just return zeros */
+  if (d > q)
+  {
+    N_VConst(ZERO, yout);
+    return (ARK_SUCCESS);
+  }
+
+  /* compute the RHS values needed by higher-degree interpolants */
+  retval = arkInterpHermitePrepare(ark_mem, interp, q, yout);
+  if (retval != ARK_SUCCESS) { return (retval); }
+
+  /* build and evaluate polynomial based on order */
+  nvec = arkInterpHermiteCoeffs(ark_mem, interp, tau, d, q, a, X);
+  if (nvec < 1)
+  {
     arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
                     "Illegal polynomial order");
     return (ARK_ILL_INPUT);
   }
+  retval = N_VLinearCombination(nvec, a, X, yout);
+  if (retval != 0) { return (ARK_VECTOROP_ERR); }
+
+  return (ARK_SUCCESS);
+}
+
+/*---------------------------------------------------------------
+  arkInterpEvaluateBatch_Hermite
+
+  This routine evaluates the Hermite interpolant (or its d-th
+  derivative) at the ntau values tau[i], storing the results in
+  yout[i]. The data that does not depend on tau is computed once
+  and the outputs are evaluated in groups of ARK_INTERP_BATCH.
+  ---------------------------------------------------------------*/
+int arkInterpEvaluateBatch_Hermite(ARKodeMem ark_mem, ARKInterp interp,
+                                   int ntau, sunrealtype* tau, int d, int order,
+                                   N_Vector* yout)
+{
+  /* local variables */
+  int q, i, j, i0, nb, nvec, retval;
+  sunrealtype a[6];
+  sunrealtype abatch[6 * ARK_INTERP_BATCH];
+  N_Vector X[6];
+
+  /* determine polynomial order q */
+  q = SUNMAX(order, 0);               /* respect lower bound  */
+  q = SUNMIN(q, HINT_DEGREE(interp)); /* respect max possible */
+
+  /* call full RHS if needed -- called just AFTER the end of a step, so yn has
+     been updated to ycur */
+  if (!(ark_mem->fn_is_current))
+  {
+    retval = ark_mem->step_fullrhs(ark_mem, ark_mem->tn, ark_mem->yn,
+                                   ark_mem->fn, ARK_FULLRHS_END);
+    if (retval) { return ARK_RHSFUNC_FAIL; }
+    ark_mem->fn_is_current = SUNTRUE;
+  }
+
+  /* error on illegal d */
+  if (d < 0)
+  {
+    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "Requested illegal derivative.");
+    return (ARK_ILL_INPUT);
+  }
+
+  /* if d is too high, just return zeros */
+  if (d > q)
+  {
+    for (i = 0; i < ntau; i++) { N_VConst(ZERO, yout[i]); }
+    return (ARK_SUCCESS);
+  }
+
+  /* compute the RHS values needed by higher-degree interpolants */
+  retval = arkInterpHermitePrepare(ark_mem, interp, q, yout[0]);
+  if (retval != ARK_SUCCESS) { return (retval); }
+
+  /* build and evaluate polynomials for each group of outputs */
+  nvec = 0;
+  for (i0 = 0; i0 < ntau; i0 += ARK_INTERP_BATCH)
+  {
+    nb = SUNMIN(ARK_INTERP_BATCH, ntau - i0);
+    for (i = 0; i < nb; i++)
+    {
+      nvec = arkInterpHermiteCoeffs(ark_mem, interp, tau[i0 + i], d, q, a, X);
+      if (nvec < 1)
+      {
+        arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                        "Illegal polynomial order");
+        return (ARK_ILL_INPUT);
+      }
+      for (j = 0; j < nvec; j++) { abatch[j * nb + i] = a[j]; }
+    }
+    retval = arkInterpCombineBatch(nb, nvec, abatch, X, yout + i0);
+    if (retval != ARK_SUCCESS) { return (retval); }
+  }
 
   return (ARK_SUCCESS);
 }
@@ -815,13 +980,14 @@ ARKInterp arkInterpCreate_Lagrange(ARKodeMem ark_mem, int degree)
     free(interp);
     return (NULL);
   }
-  ops->resize    = arkInterpResize_Lagrange;
-  ops->free      = arkInterpFree_Lagrange;
-  ops->print     = arkInterpPrintMem_Lagrange;
-  ops->setdegree = arkInterpSetDegree_Lagrange;
-  ops->init      = arkInterpInit_Lagrange;
-  ops->update    = arkInterpUpdate_Lagrange;
-  ops->evaluate  = arkInterpEvaluate_Lagrange;
+  ops->resize        = arkInterpResize_Lagrange;
+  ops->free          = arkInterpFree_Lagrange;
+  ops->print         = arkInterpPrintMem_Lagrange;
+  ops->setdegree     = arkInterpSetDegree_Lagrange;
+  ops->init          = arkInterpInit_Lagrange;
+  ops->update        = arkInterpUpdate_Lagrange;
+  ops->evaluate      = arkInterpEvaluate_Lagrange;
+  ops->evaluatebatch = arkInterpEvaluateBatch_Lagrange;
 
   /* create content, and initialize everything to zero/NULL */
   content = NULL;
@@ -1160,6 +1326,61 @@ int arkInterpUpdate_Lagrange(ARKodeMem ark_mem, ARKInterp I, sunrealtype tnew)
   return (ARK_SUCCESS);
 }
 
+/*---------------------------------------------------------------
+  arkInterpLagrangeCoeffs
+
+  This routine fills the coefficients a and vectors X of the
+  linear combination that evaluates the deriv-th derivative of
+  the Lagrange interpolant of degree q at tau (0 <= deriv <= q,
+  deriv <= 3). Returns the number of vectors.
+  ---------------------------------------------------------------*/
+static int arkInterpLagrangeCoeffs(ARKInterp I, sunrealtype tau, int deriv,
+                                   int q, sunrealtype* a, N_Vector* X)
+{
+  int j;
+  sunrealtype tval;
+  sunrealtype* thist;
+  N_Vector* yhist;
+
+  /* set readability shortcuts */
+  thist = LINT_THIST(I);
+  yhist = LINT_YHIST(I);
+
+  /* if constant interpolant is requested, just return ynew */
+  if (q == 0)
+  {
+    a[0] = ONE;
+    X[0] = yhist[0];
+    return (1);
+  }
+
+  /* convert from tau back to t (both tnew and told are valid since q>0 => NHIST>1) */
+  tval = thist[0] + tau * (thist[0] - thist[1]);
+
+  /* construct linear combination coefficients based on derivative requested */
+  for (j = 0; j < q + 1; j++) { X[j] = yhist[j]; }
+  switch (deriv)
+  {
+  case (0): /* p(t) */
+    for (j = 0; j < q + 1; j++) { a[j] = LBasis(I, j, tval); }
+    break;
+
+  case (1): /* p'(t) */
+    for (j = 0; j < q + 1; j++) { a[j] = LBasisD(I, j, tval); }
+    break;
+
+  case (2): /* p''(t) */
+    for (j = 0; j < q + 1; j++) { a[j] = LBasisD2(I, j, tval); }
+    break;
+
+  case (3): /* p'''(t) */
+    for (j = 0; j < q + 1; j++) { a[j] = LBasisD3(I, j, tval); }
+    break;
+  }
+
+  return (q + 1);
+}
+
 /*---------------------------------------------------------------
   arkInterpEvaluate_Lagrange
 
@@ -1186,22 +1407,13 @@ int arkInterpEvaluate_Lagrange(ARKodeMem ark_mem, ARKInterp I, sunrealtype tau,
                                int deriv, int degree, N_Vector yout)
 {
   /* local variables */
-  int q, retval, i, j;
-  sunrealtype tval;
+  int q, nvec, retval;
   sunrealtype a[6];
   N_Vector X[6];
-  int nhist;
-  sunrealtype* thist;
-  N_Vector* yhist;
-
-  /* set readability shortcuts */
-  nhist = LINT_NHIST(I);
-  thist = LINT_THIST(I);
-  yhist = LINT_YHIST(I);
 
   /* determine polynomial degree q */
-  q = SUNMAX(degree, 0);    /* respect lower bound */
-  q = SUNMIN(q, nhist - 1); /* respect max possible */
+  q = SUNMAX(degree, 0);            /* respect lower bound */
+  q = SUNMIN(q, LINT_NHIST(I) - 1); /* respect max possible */
 
 #if SUNDIALS_LOGGING_LEVEL >= SUNDIALS_LOGGING_DEBUG
   SUNLogger_QueueMsg(ARK_LOGGER, SUN_LOGLEVEL_DEBUG,
@@ -1224,65 +1436,65 @@ int arkInterpEvaluate_Lagrange(ARKodeMem ark_mem, ARKInterp I, sunrealtype tau,
     return (ARK_SUCCESS);
   }
 
-  /* if constant interpolant is requested, just return ynew */
-  if (q == 0)
-  {
-    N_VScale(ONE, yhist[0], yout);
-    return (ARK_SUCCESS);
-  }
+  /* call N_VLinearCombination to evaluate the result, and return */
+  nvec   = arkInterpLagrangeCoeffs(I, tau, deriv, q, a, X);
+  retval = N_VLinearCombination(nvec, a, X, yout);
+  if (retval != 0) { return (ARK_VECTOROP_ERR); }
 
-  /* convert from tau back to t (both tnew and told are valid since q>0 => NHIST>1) */
-  tval = thist[0] + tau * (thist[0] - thist[1]);
+  return (ARK_SUCCESS);
+}
+
+/*---------------------------------------------------------------
+  arkInterpEvaluateBatch_Lagrange
+
+  This routine evaluates the Lagrange interpolant (or its deriv-th
+  derivative) at the ntau values tau[i], storing the results in
+  yout[i]. The outputs are evaluated in groups of
+  ARK_INTERP_BATCH.
+  ---------------------------------------------------------------*/
+int arkInterpEvaluateBatch_Lagrange(ARKodeMem ark_mem, ARKInterp I, int ntau,
+                                    sunrealtype* tau, int deriv, int degree,
+                                    N_Vector* yout)
+{
+  /* local variables */
+  int q, i, j, i0, nb, nvec, retval;
+  sunrealtype a[6];
+  sunrealtype abatch[6 * ARK_INTERP_BATCH];
+  N_Vector X[6];
+
+  /* determine polynomial degree q */
+  q = SUNMAX(degree, 0);            /* respect lower bound */
+  q = SUNMIN(q, LINT_NHIST(I) - 1); /* respect max possible */
 
-  /* linear interpolant */
-  if (q == 1)
+  /* error on illegal deriv */
+  if ((deriv < 0) || (deriv > 3))
   {
-    if (deriv == 0)
-    {
-      a[0] = LBasis(I, 0, tval);
-      a[1] = LBasis(I, 1, tval);
-    }
-    else
-    { /* deriv == 1 */
-      a[0] = LBasisD(I, 0, tval);
-      a[1] = LBasisD(I, 1, tval);
-    }
-    N_VLinearSum(a[0], yhist[0], a[1], yhist[1], yout);
-    return (ARK_SUCCESS);
+    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "Requested illegal derivative.");
+    return (ARK_ILL_INPUT);
   }
 
-  /* higher-degree interpolant */
-  /*    initialize arguments for N_VLinearCombination */
-  for (i = 0; i < q + 1; i++)
+  /* if deriv is too high, just return zeros */
+  if (deriv > q)
   {
-    a[i] = ZERO;
-    X[i] = yhist[i];
+    for (i = 0; i < ntau; i++) { N_VConst(ZERO, yout[i]); }
+    return (ARK_SUCCESS);
   }
 
-  /*    construct linear combination coefficients based on derivative requested */
-  switch (deriv)
+  /* build and evaluate polynomials for each group of outputs */
+  nvec = 0;
+  for (i0 = 0; i0 < ntau; i0 += ARK_INTERP_BATCH)
   {
-  case (0): /* p(t) */
-    for (j = 0; j < q + 1; j++) { a[j] = LBasis(I, j, tval); }
-    break;
-
-  case (1): /* p'(t) */
-    for (j = 0; j < q + 1; j++) { a[j] = LBasisD(I, j, tval); }
-    break;
-
-  case (2): /* p''(t) */
-    for (j = 0; j < q + 1; j++) { a[j] = LBasisD2(I, j, tval); }
-    break;
-
-  case (3): /* p'''(t) */
-    for (j = 0; j < q + 1; j++) { a[j] = LBasisD3(I, j, tval); }
-    break;
+    nb = SUNMIN(ARK_INTERP_BATCH, ntau - i0);
+    for (i = 0; i < nb; i++)
+    {
+      nvec = arkInterpLagrangeCoeffs(I, tau[i0 + i], deriv, q, a, X);
+      for (j = 0; j < nvec; j++) { abatch[j * nb + i] = a[j]; }
+    }
+    retval = arkInterpCombineBatch(nb, nvec, abatch, X, yout + i0);
+    if (retval != ARK_SUCCESS) { return (retval); }
   }
 
-  /*    call N_VLinearCombination to evaluate the result, and return */
-  retval = N_VLinearCombination(q + 1, a, X, yout);
-  if (retval != 0) { return (ARK_VECTOROP_ERR); }
-
   return (ARK_SUCCESS);
 }
 
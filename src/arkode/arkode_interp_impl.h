@@ -37,6 +37,9 @@ extern "C" {
 #define SIX    SUN_RCONST(6.0)
 #define TWELVE SUN_RCONST(12.0)
 
+/* Number of outputs evaluated per pass in the batched evaluations */
+#define ARK_INTERP_BATCH 32
+
 /*===============================================================
   ARKODE Hermite Temporal Interpolation Data Structure
   ===============================================================*/
@@ -84,6 +87,9 @@ int arkInterpUpdate_Hermite(ARKodeMem ark_mem, ARKInterp interp,
                             sunrealtype tnew);
 int arkInterpEvaluate_Hermite(ARKodeMem ark_mem, ARKInterp interp,
                               sunrealtype tau, int d, int order, N_Vector yout);
+int arkInterpEvaluateBatch_Hermite(ARKodeMem ark_mem, ARKInterp interp,
+                                   int ntau, sunrealtype* tau, int d,
+                                   int order, N_Vector* yout);
 
 /*===============================================================
   ARKODE Lagrange Temporal Interpolation Data Structure
@@ -130,6 +136,9 @@ int arkInterpUpdate_Lagrange(ARKodeMem ark_mem, ARKInterp interp,
                              sunrealtype tnew);
 int arkInterpEvaluate_Lagrange(ARKodeMem ark_mem, ARKInterp interp,
                                sunrealtype tau, int d, int order, N_Vector yout);
+int arkInterpEvaluateBatch_Lagrange(ARKodeMem ark_mem, ARKInterp interp,
+                                    int ntau, sunrealtype* tau, int d,
+                                    int order, N_Vector* yout);
 
 /* Lagrange structure utility routines */
 sunrealtype LBasis(ARKInterp interp, int idx, sunrealtype t);
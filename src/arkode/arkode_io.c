@@ -1348,6 +1348,63 @@ int ARKodeSetNoInactiveRootWarn(void* arkode_mem)
   return (ARK_SUCCESS);
 }
 
+/*---------------------------------------------------------------
+  ARKodeSetPartialRootFn:
+
+  Specifies an optional function that evaluates only the listed
+  components of g.  It is used during the root search in place of
+  the full g function.
+  ---------------------------------------------------------------*/
+int ARKodeSetPartialRootFn(void* arkode_mem, ARKPartialRootFn gpart)
+{
+  ARKodeMem ark_mem;
+  ARKodeRootMem ark_root_mem;
+  if (arkode_mem == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_MEM);
+    return (ARK_MEM_NULL);
+  }
+  ark_mem = (ARKodeMem)arkode_mem;
+  if (ark_mem->root_mem == NULL)
+  {
+    arkProcessError(ark_mem, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_MEM);
+    return (ARK_MEM_NULL);
+  }
+  ark_root_mem        = (ARKodeRootMem)ark_mem->root_mem;
+  ark_root_mem->gpart = gpart;
+  return (ARK_SUCCESS);
+}
+
+/*---------------------------------------------------------------
+  ARKodeSetRootInverseInterp:
+
+  Enables or disables inverse quadratic interpolation steps in
+  the root search.
+  ---------------------------------------------------------------*/
+int ARKodeSetRootInverseInterp(void* arkode_mem, sunbooleantype onoff)
+{
+  ARKodeMem ark_mem;
+  ARKodeRootMem ark_root_mem;
+  if (arkode_mem == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_MEM);
+    return (ARK_MEM_NULL);
+  }
+  ark_mem = (ARKodeMem)arkode_mem;
+  if (ark_mem->root_mem == NULL)
+  {
+    arkProcessError(ark_mem, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_MEM);
+    return (ARK_MEM_NULL);
+  }
+  ark_root_mem          = (ARKodeRootMem)ark_mem->root_mem;
+  ark_root_mem->rootiqi = onoff;
+  return (ARK_SUCCESS);
+}
+
 /*---------------------------------------------------------------
   ARKodeSetPostprocessStepFn:
 
@@ -1412,6 +1469,63 @@ int ARKodeSetPostprocessStageFn(void* arkode_mem, ARKPostProcessFn ProcessStage)
   return (ARK_SUCCESS);
 }
 
+/*---------------------------------------------------------------
+  ARKodeSetTelemetry:
+
+  Specifies the telemetry object in which a record is stored for
+  each successful step.  A NULL input disables telemetry.
+  ---------------------------------------------------------------*/
+int ARKodeSetTelemetry(void* arkode_mem, SUNTelemetry tel)
+{
+  ARKodeMem ark_mem;
+  if (arkode_mem == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_MEM);
+    return (ARK_MEM_NULL);
+  }
+  ark_mem = (ARKodeMem)arkode_mem;
+
+  ark_mem->telemetry = tel;
+
+  return (ARK_SUCCESS);
+}
+
+/*---------------------------------------------------------------
+  ARKodeSetNumStageThreads:
+
+  Specifies the number of threads used to evaluate mutually
+  independent stages of the method concurrently (see
+  ARKodeButcherTable_StageGroups).  Values <= 1 select the default
+  sequential stage loop.  When more than one thread is requested,
+  the user-supplied RHS and stage postprocessing functions must be
+  safe to call concurrently with distinct output vectors.
+  ---------------------------------------------------------------*/
+int ARKodeSetNumStageThreads(void* arkode_mem, int nthreads)
+{
+  ARKodeMem ark_mem;
+  if (arkode_mem == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_MEM);
+    return (ARK_MEM_NULL);
+  }
+  ark_mem = (ARKodeMem)arkode_mem;
+
+  /* Call stepper routine (if provided) */
+  if (ark_mem->step_setnumstagethreads)
+  {
+    return (ark_mem->step_setnumstagethreads(arkode_mem, nthreads));
+  }
+  else
+  {
+    arkProcessError(ark_mem, ARK_STEPPER_UNSUPPORTED, __LINE__, __func__,
+                    __FILE__,
+                    "time-stepping module does not support this function");
+    return (ARK_STEPPER_UNSUPPORTED);
+  }
+}
+
 /*---------------------------------------------------------------
   ARKodeSetConstraints:
 
@@ -37,6 +37,16 @@ static int arkLsLinSys(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix A,
                        SUNMatrix M, sunbooleantype jok, sunbooleantype* jcur,
                        sunrealtype gamma, void* arkode_mem, N_Vector tmp1,
                        N_Vector tmp2, N_Vector tmp3);
+static sunrealtype arkLsDQInc(ARKodeMem ark_mem, sunrealtype yj,
+                              sunrealtype ewtj, sunrealtype cnsj,
+                              sunrealtype srur, sunrealtype minInc);
+static int arkLsDenseDQJacBatch(sunrealtype t, N_Vector y, N_Vector fy,
+                                SUNMatrix Jac, ARKodeMem ark_mem,
+                                ARKLsMem arkls_mem);
+static int arkLsBandDQJacBatch(sunrealtype t, N_Vector y, N_Vector fy,
+                               SUNMatrix Jac, ARKodeMem ark_mem,
+                               ARKLsMem arkls_mem);
+static void arkLsFreeRhsBatch(ARKLsMem arkls_mem);
 
 /*===============================================================
   Exported routines
@@ -191,6 +201,12 @@ int ARKodeSetLinearSolver(void* arkode_mem, SUNLinearSolver LS, SUNMatrix A)
   arkls_mem->Jt_data  = ark_mem;
   arkls_mem->Jt_f     = ark_mem->step_getimplicitrhs(ark_mem);
 
+  arkls_mem->rhsbatch = NULL;
+  arkls_mem->maxbatch = 0;
+  arkls_mem->ybatch   = NULL;
+  arkls_mem->fbatch   = NULL;
+  arkls_mem->incbatch = NULL;
+
   if (arkls_mem->Jt_f == NULL)
   {
     arkProcessError(ark_mem, ARKLS_ILL_INPUT, __LINE__, __func__, __FILE__,
@@ -204,6 +220,8 @@ int ARKodeSetLinearSolver(void* arkode_mem, SUNLinearSolver LS, SUNMatrix A)
   arkls_mem->linsys      = arkLsLinSys;
   arkls_mem->A_data      = ark_mem;
 
+  arkls_mem->capture = NULL;
+
   /* Set defaults for preconditioner-related fields */
   arkls_mem->pset   = NULL;
   arkls_mem->psolve = NULL;
@@ -1001,6 +1019,119 @@ int ARKodeSetJacTimesRhsFn(void* arkode_mem, ARKRhsFn jtimesRhsFn)
   return (ARKLS_SUCCESS);
 }
 
+/*---------------------------------------------------------------
+  ARKodeSetJacRhsBatchFn specifies a batched implicit RHS function
+  for use in the internal difference quotient Jacobian
+  approximation.
+  ---------------------------------------------------------------*/
+int ARKodeSetJacRhsBatchFn(void* arkode_mem, ARKLsRhsBatchFn rhsbatch,
+                           int maxbatch)
+{
+  ARKodeMem ark_mem;
+  ARKLsMem arkls_mem;
+  int retval;
+
+  /* Return immediately if arkode_mem is NULL */
+  if (arkode_mem == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_MEM);
+    return (ARK_MEM_NULL);
+  }
+  ark_mem = (ARKodeMem)arkode_mem;
+
+  /* Guard against use for time steppers that do not need an algebraic solver */
+  if (!ark_mem->step_supports_implicit)
+  {
+    arkProcessError(ark_mem, ARK_STEPPER_UNSUPPORTED, __LINE__, __func__,
+                    __FILE__, "time-stepping module does not require an algebraic solver");
+    return (ARK_STEPPER_UNSUPPORTED);
+  }
+
+  /* access ARKLsMem structure */
+  retval = arkLs_AccessLMem(ark_mem, __func__, &arkls_mem);
+  if (retval != ARK_SUCCESS) { return (retval); }
+
+  /* the DQ Jacobian approximation requires a matrix */
+  if ((rhsbatch != NULL) && (arkls_mem->A == NULL))
+  {
+    arkProcessError(ark_mem, ARKLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    MSG_LS_BATCH_NULL_MAT);
+    return (ARKLS_ILL_INPUT);
+  }
+
+  if ((rhsbatch != NULL) && (maxbatch < 1))
+  {
+    arkProcessError(ark_mem, ARKLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    MSG_LS_BAD_MAXBATCH);
+    return (ARKLS_ILL_INPUT);
+  }
+
+  /* free any existing batch workspace */
+  arkLsFreeRhsBatch(arkls_mem);
+  if (rhsbatch == NULL) { return (ARKLS_SUCCESS); }
+
+  /* allocate the perturbed states, their RHS values, and increments */
+  arkls_mem->ybatch   = N_VCloneVectorArray(maxbatch, ark_mem->tempv1);
+  arkls_mem->fbatch   = N_VCloneVectorArray(maxbatch, ark_mem->tempv1);
+  arkls_mem->incbatch = (sunrealtype*)malloc(maxbatch * sizeof(sunrealtype));
+  arkls_mem->maxbatch = maxbatch;
+  if ((arkls_mem->ybatch == NULL) || (arkls_mem->fbatch == NULL) ||
+      (arkls_mem->incbatch == NULL))
+  {
+    arkLsFreeRhsBatch(arkls_mem);
+    arkProcessError(ark_mem, ARKLS_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_LS_MEM_FAIL);
+    return (ARKLS_MEM_FAIL);
+  }
+
+  arkls_mem->rhsbatch = rhsbatch;
+
+  return (ARKLS_SUCCESS);
+}
+
+/* ARKodeSetLinSysCapture specifies an archive to which selected linear
+   systems and right-hand sides are written. */
+int ARKodeSetLinSysCapture(void* arkode_mem, SUNLinSysCapture capture)
+{
+  ARKodeMem ark_mem;
+  ARKLsMem arkls_mem;
+  int retval;
+
+  /* Return immediately if arkode_mem is NULL */
+  if (arkode_mem == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_MEM);
+    return (ARK_MEM_NULL);
+  }
+  ark_mem = (ARKodeMem)arkode_mem;
+
+  /* Guard against use for time steppers that do not need an algebraic solver */
+  if (!ark_mem->step_supports_implicit)
+  {
+    arkProcessError(ark_mem, ARK_STEPPER_UNSUPPORTED, __LINE__, __func__,
+                    __FILE__, "time-stepping module does not require an algebraic solver");
+    return (ARK_STEPPER_UNSUPPORTED);
+  }
+
+  /* access ARKLsMem structure */
+  retval = arkLs_AccessLMem(ark_mem, __func__, &arkls_mem);
+  if (retval != ARK_SUCCESS) { return (retval); }
+
+  /* only matrix-based linear systems can be captured */
+  if ((capture != NULL) && (arkls_mem->A == NULL))
+  {
+    arkProcessError(ark_mem, ARKLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    MSG_LS_CAPTURE_NO_MATRIX);
+    return (ARKLS_ILL_INPUT);
+  }
+
+  arkls_mem->capture = capture;
+
+  return (ARKLS_SUCCESS);
+}
+
 /* ARKodeSetLinSysFn specifies the linear system setup function. */
 int ARKodeSetLinSysFn(void* arkode_mem, ARKLsLinSysFn linsys)
 {
@@ -1190,6 +1321,13 @@ int ARKodeGetLinWorkSpace(void* arkode_mem, long int* lenrw, long int* leniw)
     N_VSpace(arkls_mem->x, &lrw1, &liw1);
     *lenrw += 2 * lrw1;
     *leniw += 2 * liw1;
+
+    /* add batched DQ Jacobian workspace (if applicable) */
+    if (arkls_mem->rhsbatch)
+    {
+      *lenrw += arkls_mem->maxbatch * (2 * lrw1 + 1);
+      *leniw += 2 * arkls_mem->maxbatch * liw1;
+    }
   }
 
   /* add SUNMatrix size (only account for the one owned by Ls interface) */
@@ -2631,6 +2769,12 @@ int arkLsDenseDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
   sunindextype j, N;
   int retval = 0;
 
+  /* evaluate the perturbed RHS in batches (if enabled) */
+  if (arkls_mem->rhsbatch)
+  {
+    return (arkLsDenseDQJacBatch(t, y, fy, Jac, ark_mem, arkls_mem));
+  }
+
   /* access matrix dimension */
   N = SUNDenseMatrix_Columns(Jac);
 
@@ -2717,6 +2861,12 @@ int arkLsBandDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
   sunindextype N, mupper, mlower;
   int retval = 0;
 
+  /* evaluate the perturbed RHS in batches (if enabled) */
+  if (arkls_mem->rhsbatch)
+  {
+    return (arkLsBandDQJacBatch(t, y, fy, Jac, ark_mem, arkls_mem));
+  }
+
   /* access matrix dimensions */
   N      = SUNBandMatrix_Columns(Jac);
   mupper = SUNBandMatrix_UpperBandwidth(Jac);
@@ -2813,6 +2963,222 @@ int arkLsBandDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
   return (retval);
 }
 
+/*---------------------------------------------------------------
+  arkLsDQInc:
+
+  This routine returns the increment used in the difference
+  quotient approximation of column j of the Jacobian, with its
+  sign adjusted if y_j has an inequality constraint.
+  ---------------------------------------------------------------*/
+static sunrealtype arkLsDQInc(ARKodeMem ark_mem, sunrealtype yj,
+                              sunrealtype ewtj, sunrealtype cnsj,
+                              sunrealtype srur, sunrealtype minInc)
+{
+  sunrealtype inc = SUNMAX(srur * SUNRabs(yj), minInc / ewtj);
+
+  if (ark_mem->constraintsSet)
+  {
+    if (SUNRabs(cnsj) == ONE)
+    {
+      if ((yj + inc) * cnsj < ZERO) { inc = -inc; }
+    }
+    else if (SUNRabs(cnsj) == TWO)
+    {
+      if ((yj + inc) * cnsj <= ZERO) { inc = -inc; }
+    }
+  }
+
+  return (inc);
+}
+
+/*---------------------------------------------------------------
+  arkLsDenseDQJacBatch:
+
+  This routine computes the same dense difference quotient
+  approximation as arkLsDenseDQJac, but perturbs up to maxbatch
+  columns at a time and evaluates the perturbed states with a
+  single call to the user-supplied batched RHS function.
+  ---------------------------------------------------------------*/
+static int arkLsDenseDQJacBatch(sunrealtype t, N_Vector y, N_Vector fy,
+                                SUNMatrix Jac, ARKodeMem ark_mem,
+                                ARKLsMem arkls_mem)
+{
+  sunrealtype fnorm, minInc, inc_inv, srur, cnsj;
+  sunrealtype *y_data, *ewt_data, *cns_data;
+  N_Vector jthCol;
+  sunindextype j, N;
+  int b, nbatch, retval = 0;
+
+  /* access matrix dimension */
+  N = SUNDenseMatrix_Columns(Jac);
+
+  /* Create an empty vector for matrix column calculations */
+  jthCol = N_VCloneEmpty(y);
+
+  /* Obtain pointers to the data for various vectors */
+  ewt_data = N_VGetArrayPointer(ark_mem->ewt);
+  y_data   = N_VGetArrayPointer(y);
+  cns_data = (ark_mem->constraintsSet) ? N_VGetArrayPointer(ark_mem->constraints)
+                                       : NULL;
+
+  /* Set minimum increment based on uround and norm of f */
+  srur   = SUNRsqrt(ark_mem->uround);
+  fnorm  = N_VWrmsNorm(fy, ark_mem->rwt);
+  minInc = (fnorm != ZERO)
+             ? (MIN_INC_MULT * SUNRabs(ark_mem->h) * ark_mem->uround * N * fnorm)
+             : ONE;
+
+  for (j = 0; j < N; j += nbatch)
+  {
+    nbatch = (int)SUNMIN(arkls_mem->maxbatch, N - j);
+
+    /* Perturb column j + b of y in the b-th batch vector */
+    for (b = 0; b < nbatch; b++)
+    {
+      cnsj = (ark_mem->constraintsSet) ? cns_data[j + b] : ZERO;
+      arkls_mem->incbatch[b] = arkLsDQInc(ark_mem, y_data[j + b],
+                                          ewt_data[j + b], cnsj, srur, minInc);
+
+      N_VScale(ONE, y, arkls_mem->ybatch[b]);
+      N_VGetArrayPointer(arkls_mem->ybatch[b])[j + b] += arkls_mem->incbatch[b];
+    }
+
+    retval = arkls_mem->rhsbatch(nbatch, t, arkls_mem->ybatch,
+                                 arkls_mem->fbatch, ark_mem->user_data);
+    arkls_mem->nfeDQ += nbatch;
+    if (retval != 0) { break; }
+
+    /* Form the difference quotients */
+    for (b = 0; b < nbatch; b++)
+    {
+      N_VSetArrayPointer(SUNDenseMatrix_Column(Jac, j + b), jthCol);
+      inc_inv = ONE / arkls_mem->incbatch[b];
+      N_VLinearSum(inc_inv, arkls_mem->fbatch[b], -inc_inv, fy, jthCol);
+    }
+  }
+
+  /* Destroy jthCol vector */
+  N_VSetArrayPointer(NULL, jthCol);
+  N_VDestroy(jthCol);
+
+  return (retval);
+}
+
+/*---------------------------------------------------------------
+  arkLsBandDQJacBatch:
+
+  This routine computes the same banded difference quotient
+  approximation as arkLsBandDQJac, but perturbs up to maxbatch
+  column groups at a time and evaluates the perturbed states with
+  a single call to the user-supplied batched RHS function.
+  ---------------------------------------------------------------*/
+static int arkLsBandDQJacBatch(sunrealtype t, N_Vector y, N_Vector fy,
+                               SUNMatrix Jac, ARKodeMem ark_mem,
+                               ARKLsMem arkls_mem)
+{
+  sunrealtype fnorm, minInc, inc, inc_inv, srur, cnsj;
+  sunrealtype *col_j, *ewt_data, *fy_data, *f_data, *y_data, *yb_data;
+  sunrealtype* cns_data;
+  sunindextype group, i, j, width, ngroups, i1, i2;
+  sunindextype N, mupper, mlower;
+  int b, nbatch, retval = 0;
+
+  /* access matrix dimensions */
+  N      = SUNBandMatrix_Columns(Jac);
+  mupper = SUNBandMatrix_UpperBandwidth(Jac);
+  mlower = SUNBandMatrix_LowerBandwidth(Jac);
+
+  /* Obtain pointers to the data for ewt, fy, y */
+  ewt_data = N_VGetArrayPointer(ark_mem->ewt);
+  fy_data  = N_VGetArrayPointer(fy);
+  y_data   = N_VGetArrayPointer(y);
+  cns_data = (ark_mem->constraintsSet) ? N_VGetArrayPointer(ark_mem->constraints)
+                                       : NULL;
+
+  /* Set minimum increment based on uround and norm of f */
+  srur   = SUNRsqrt(ark_mem->uround);
+  fnorm  = N_VWrmsNorm(fy, ark_mem->rwt);
+  minInc = (fnorm != ZERO)
+             ? (MIN_INC_MULT * SUNRabs(ark_mem->h) * ark_mem->uround * N * fnorm)
+             : ONE;
+
+  /* Set bandwidth and number of column groups for band differencing */
+  width   = mlower + mupper + 1;
+  ngroups = SUNMIN(width, N);
+
+  /* Loop over batches of column groups */
+  for (group = 1; group <= ngroups; group += nbatch)
+  {
+    nbatch = (int)SUNMIN(arkls_mem->maxbatch, ngroups - group + 1);
+
+    /* Increment all y_j of group + b in the b-th batch vector */
+    for (b = 0; b < nbatch; b++)
+    {
+      N_VScale(ONE, y, arkls_mem->ybatch[b]);
+      yb_data = N_VGetArrayPointer(arkls_mem->ybatch[b]);
+      for (j = group + b - 1; j < N; j += width)
+      {
+        cnsj = (ark_mem->constraintsSet) ? cns_data[j] : ZERO;
+        yb_data[j] += arkLsDQInc(ark_mem, y_data[j], ewt_data[j], cnsj, srur,
+                                 minInc);
+      }
+    }
+
+    retval = arkls_mem->rhsbatch(nbatch, t, arkls_mem->ybatch,
+                                 arkls_mem->fbatch, ark_mem->user_data);
+    arkls_mem->nfeDQ += nbatch;
+    if (retval != 0) { break; }
+
+    /* Form and load difference quotients */
+    for (b = 0; b < nbatch; b++)
+    {
+      f_data = N_VGetArrayPointer(arkls_mem->fbatch[b]);
+      for (j = group + b - 1; j < N; j += width)
+      {
+        col_j   = SUNBandMatrix_Column(Jac, j);
+        cnsj    = (ark_mem->constraintsSet) ? cns_data[j] : ZERO;
+        inc     = arkLsDQInc(ark_mem, y_data[j], ewt_data[j], cnsj, srur,
+                             minInc);
+        inc_inv = ONE / inc;
+        i1      = SUNMAX(0, j - mupper);
+        i2      = SUNMIN(j + mlower, N - 1);
+        for (i = i1; i <= i2; i++)
+        {
+          SM_COLUMN_ELEMENT_B(col_j, i, j) = inc_inv * (f_data[i] - fy_data[i]);
+        }
+      }
+    }
+  }
+
+  return (retval);
+}
+
+/*---------------------------------------------------------------
+  arkLsFreeRhsBatch:
+
+  This routine frees the batched DQ Jacobian workspace.
+  ---------------------------------------------------------------*/
+static void arkLsFreeRhsBatch(ARKLsMem arkls_mem)
+{
+  if (arkls_mem->ybatch)
+  {
+    N_VDestroyVectorArray(arkls_mem->ybatch, arkls_mem->maxbatch);
+    arkls_mem->ybatch = NULL;
+  }
+  if (arkls_mem->fbatch)
+  {
+    N_VDestroyVectorArray(arkls_mem->fbatch, arkls_mem->maxbatch);
+    arkls_mem->fbatch = NULL;
+  }
+  if (arkls_mem->incbatch)
+  {
+    free(arkls_mem->incbatch);
+    arkls_mem->incbatch = NULL;
+  }
+  arkls_mem->rhsbatch = NULL;
+  arkls_mem->maxbatch = 0;
+}
+
 /*---------------------------------------------------------------
   arkLsDQJtimes:
 
@@ -3249,6 +3615,13 @@ int arkLsSetup(ARKodeMem ark_mem, int convfail, sunrealtype tpred,
       }
       else { return (retval); }
     }
+
+    /* Write A to the capture archive (if selected) */
+    if (arkls_mem->capture)
+    {
+      (void)SUNLinSysCapture_Matrix(arkls_mem->capture, tpred, gamma,
+                                    arkls_mem->A);
+    }
   }
   else
   {
@@ -3384,6 +3757,12 @@ int arkLsSolve(ARKodeMem ark_mem, N_Vector b, sunrealtype tnow, N_Vector ynow,
     }
   }
 
+  /* Write b to the capture archive (if A was captured) */
+  if (arkls_mem->capture)
+  {
+    (void)SUNLinSysCapture_Rhs(arkls_mem->capture, tnow, delta, b);
+  }
+
   /* Call solver, and copy x to b */
   retval = SUNLinSolSolve(arkls_mem->LS, arkls_mem->A, arkls_mem->x, b, delta);
   N_VScale(ONE, arkls_mem->x, b);
@@ -3512,6 +3891,9 @@ int arkLsFree(ARKodeMem ark_mem)
     arkls_mem->savedJ = NULL;
   }
 
+  /* Free batched DQ Jacobian workspace */
+  arkLsFreeRhsBatch(arkls_mem);
+
   /* Nullify other N_Vector pointers */
   arkls_mem->ycur = NULL;
   arkls_mem->fcur = NULL;
@@ -0,0 +1,490 @@
+/* -----------------------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * This is the implementation file for the ARKODE Parareal driver.
+ *
+ * The interval [t0, tf] is split into N time slices T_0 < T_1 < ... < T_N.
+ * With G and F the coarse and fine propagators over a slice, the iterates
+ * U_n^k at the slice boundaries are updated with
+ *
+ *   U_{n+1}^{k+1} = G(U_n^{k+1}) + F(U_n^k) - G(U_n^k)
+ *
+ * The fine propagations F(U_n^k) are independent and run concurrently with
+ * one fine integrator per OpenMP thread. The fine integrator i propagates the
+ * slices n with n % nfine == i in F[n], a vector cloned from its own state, so
+ * each thread only uses vectors of its own SUNContext. After iteration k the
+ * first k slices
+ * equal the sequential fine solution, so each iteration only propagates the
+ * slices that have not converged and at most N iterations are needed.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "arkode/arkode_parareal.h"
+#include "arkode_impl.h"
+#include "arkode_parareal_impl.h"
+#include "sundials/sundials_math.h"
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+
+/* Default convergence tolerances */
+#define PARAREAL_RELTOL SUN_RCONST(1.0e-6)
+#define PARAREAL_ABSTOL SUN_RCONST(1.0e-10)
+
+/* -------------------------
+ * Private helper functions
+ * ------------------------- */
+
+/* Propagate y0 at time t0 to y1 at time t1 with an ARKODE integrator, y0 and
+   y1 may be the same vector */
+static int arkParareal_Propagate(void* arkode_mem, sunrealtype t0,
+                                 sunrealtype t1, N_Vector y0, N_Vector y1)
+{
+  int flag;
+  sunrealtype tret;
+  ARKodeMem ark_mem = (ARKodeMem)arkode_mem;
+
+  if (y0 != y1) { N_VScale(ONE, y0, y1); }
+
+  flag = ARKodeReset(arkode_mem, t0, y1);
+  if (flag != ARK_SUCCESS) { return flag; }
+
+  /* Discard the step size history so the propagation of a slice does not
+     depend on which slices the integrator propagated before */
+  flag = arkResetStepHistory(ark_mem);
+  if (flag != ARK_SUCCESS) { return flag; }
+
+  flag = ARKodeSetStopTime(arkode_mem, t1);
+  if (flag != ARK_SUCCESS) { return flag; }
+
+  flag = ARKodeEvolve(arkode_mem, t1, y1, &tret, ARK_NORMAL);
+  if (flag < 0) { return flag; }
+
+  return ARK_SUCCESS;
+}
+
+/* Time at the start of slice n */
+static sunrealtype arkParareal_SliceTime(ARKParareal pr, int n)
+{
+  if (n == pr->nslices) { return pr->tf; }
+  return pr->t0 + ((sunrealtype)n) * (pr->tf - pr->t0) / pr->nslices;
+}
+
+/* Free the slice vectors */
+static void arkParareal_FreeVectors(ARKParareal pr)
+{
+  int n;
+
+  if (pr->U != NULL) { N_VDestroyVectorArray(pr->U, pr->nslices + 1); }
+  if (pr->G != NULL) { N_VDestroyVectorArray(pr->G, pr->nslices); }
+  if (pr->F != NULL)
+  {
+    for (n = 0; n < pr->nslices; n++)
+    {
+      if (pr->F[n] != NULL) { N_VDestroy(pr->F[n]); }
+    }
+    free(pr->F);
+  }
+  if (pr->ewt != NULL) { N_VDestroy(pr->ewt); }
+  if (pr->tmp != NULL) { N_VDestroy(pr->tmp); }
+  free(pr->flags);
+
+  pr->U     = NULL;
+  pr->G     = NULL;
+  pr->F     = NULL;
+  pr->ewt   = NULL;
+  pr->tmp   = NULL;
+  pr->flags = NULL;
+}
+
+/* Allocate the slice vectors for nslices time slices */
+static int arkParareal_AllocVectors(ARKParareal pr, int nslices, N_Vector tmpl)
+{
+  int n;
+  ARKodeMem fine_mem;
+
+  if (pr->U != NULL && pr->nslices == nslices) { return ARK_SUCCESS; }
+
+  arkParareal_FreeVectors(pr);
+  pr->nslices = nslices;
+
+  pr->U     = N_VCloneVectorArray(nslices + 1, tmpl);
+  pr->G     = N_VCloneVectorArray(nslices, tmpl);
+  pr->F     = (N_Vector*)calloc(nslices, sizeof(N_Vector));
+  pr->ewt   = N_VClone(tmpl);
+  pr->tmp   = N_VClone(tmpl);
+  pr->flags = (int*)malloc(nslices * sizeof(int));
+
+  /* clone F[n] from the fine integrator that propagates slice n */
+  for (n = 0; pr->F != NULL && n < nslices; n++)
+  {
+    fine_mem = (ARKodeMem)pr->fine_mem[n % pr->nfine];
+    pr->F[n] = N_VClone(fine_mem->yn);
+    if (pr->F[n] == NULL) { break; }
+  }
+
+  if (pr->U == NULL || pr->G == NULL || pr->F == NULL || pr->ewt == NULL ||
+      pr->tmp == NULL || pr->flags == NULL || n < nslices)
+  {
+    arkParareal_FreeVectors(pr);
+    pr->nslices = 0;
+    return ARK_MEM_FAIL;
+  }
+
+  return ARK_SUCCESS;
+}
+
+/* Weighted RMS norm of the change between Unew and Uold */
+static sunrealtype arkParareal_ChangeNorm(ARKParareal pr, N_Vector Unew,
+                                          N_Vector Uold)
+{
+  N_VAbs(Unew, pr->ewt);
+  N_VScale(pr->reltol, pr->ewt, pr->ewt);
+  N_VAddConst(pr->ewt, pr->abstol, pr->ewt);
+  N_VInv(pr->ewt, pr->ewt);
+
+  N_VLinearSum(ONE, Unew, -ONE, Uold, pr->tmp);
+
+  return N_VWrmsNorm(pr->tmp, pr->ewt);
+}
+
+/* -------------------------------
+ * Construct, evolve, and free
+ * ------------------------------- */
+
+/* Create the Parareal driver from a coarse integrator and one fine integrator
+   per thread */
+int ARKParareal_Create(void* coarse_mem, int nfine, void** fine_mem,
+                       ARKParareal* pr)
+{
+  int i, j;
+  ARKParareal content;
+
+  if (coarse_mem == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_MEM);
+    return ARK_MEM_NULL;
+  }
+
+  if (pr == NULL || fine_mem == NULL || nfine < 1)
+  {
+    arkProcessError((ARKodeMem)coarse_mem, ARK_ILL_INPUT, __LINE__, __func__,
+                    __FILE__, "At least one fine integrator is required");
+    return ARK_ILL_INPUT;
+  }
+
+  for (i = 0; i < nfine; i++)
+  {
+    if (fine_mem[i] == NULL || fine_mem[i] == coarse_mem)
+    {
+      arkProcessError((ARKodeMem)coarse_mem, ARK_ILL_INPUT, __LINE__, __func__,
+                      __FILE__,
+                      "Fine integrators must be distinct from the coarse "
+                      "integrator");
+      return ARK_ILL_INPUT;
+    }
+    if (!((ARKodeMem)fine_mem[i])->MallocDone)
+    {
+      arkProcessError((ARKodeMem)coarse_mem, ARK_ILL_INPUT, __LINE__, __func__,
+                      __FILE__, "Fine integrators must be initialized");
+      return ARK_ILL_INPUT;
+    }
+  }
+
+#if !defined(SUNDIALS_CONTEXT_SHARED_BY_THREADS)
+  /* The fine integrators run concurrently and would update the profiler or
+     logger of a shared context from several threads */
+  for (i = 1; i < nfine; i++)
+  {
+    for (j = 0; j < i; j++)
+    {
+      if (((ARKodeMem)fine_mem[i])->sunctx == ((ARKodeMem)fine_mem[j])->sunctx)
+      {
+        arkProcessError((ARKodeMem)coarse_mem, ARK_ILL_INPUT, __LINE__,
+                        __func__, __FILE__,
+                        "Fine integrators must have distinct contexts");
+        return ARK_ILL_INPUT;
+      }
+    }
+  }
+#else
+  (void)j;
+#endif
+
+  content = (ARKParareal)calloc(1, sizeof(*content));
+  if (content == NULL)
+  {
+    arkProcessError((ARKodeMem)coarse_mem, ARK_MEM_FAIL, __LINE__, __func__,
+                    __FILE__, MSG_ARK_ARKMEM_FAIL);
+    return ARK_MEM_FAIL;
+  }
+
+  content->fine_mem = (void**)malloc(nfine * sizeof(void*));
+  if (content->fine_mem == NULL)
+  {
+    free(content);
+    arkProcessError((ARKodeMem)coarse_mem, ARK_MEM_FAIL, __LINE__, __func__,
+                    __FILE__, MSG_ARK_ARKMEM_FAIL);
+    return ARK_MEM_FAIL;
+  }
+
+  content->coarse_mem = coarse_mem;
+  content->nfine      = nfine;
+  for (i = 0; i < nfine; i++) { content->fine_mem[i] = fine_mem[i]; }
+
+  content->maxiters = 0;
+  content->reltol   = PARAREAL_RELTOL;
+  content->abstol   = PARAREAL_ABSTOL;
+  content->niters   = 0;
+  content->cnorm    = ZERO;
+
+  *pr = content;
+
+  return ARK_SUCCESS;
+}
+
+/* Evolve y from t0 to tf with nslices time slices */
+int ARKParareal_Evolve(ARKParareal pr, sunrealtype t0, sunrealtype tf,
+                       int nslices, N_Vector y)
+{
+  int flag, i, k, n, maxiters;
+  sunrealtype norm;
+  ARKodeMem ark_mem;
+
+  if (pr == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_MEM);
+    return ARK_MEM_NULL;
+  }
+  ark_mem = (ARKodeMem)pr->coarse_mem;
+
+  if (y == NULL || nslices < 1 || tf == t0)
+  {
+    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "Illegal input, y must be non-NULL, nslices > 0, and "
+                    "tf != t0");
+    return ARK_ILL_INPUT;
+  }
+
+  flag = arkParareal_AllocVectors(pr, nslices, y);
+  if (flag != ARK_SUCCESS)
+  {
+    arkProcessError(ark_mem, ARK_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_MEM_FAIL);
+    return flag;
+  }
+
+  pr->t0     = t0;
+  pr->tf     = tf;
+  pr->niters = 0;
+  pr->cnorm  = ZERO;
+
+  /* at most nslices iterations are needed */
+  maxiters = (pr->maxiters > 0) ? SUNMIN(pr->maxiters, nslices) : nslices;
+
+  /* initial coarse sweep, U_{n+1}^0 = G(U_n^0) */
+  N_VScale(ONE, y, pr->U[0]);
+  for (n = 0; n < nslices; n++)
+  {
+    flag = arkParareal_Propagate(pr->coarse_mem, arkParareal_SliceTime(pr, n),
+                                 arkParareal_SliceTime(pr, n + 1), pr->U[n],
+                                 pr->G[n]);
+    if (flag != ARK_SUCCESS) { return flag; }
+    N_VScale(ONE, pr->G[n], pr->U[n + 1]);
+  }
+
+  for (k = 0; k < maxiters; k++)
+  {
+    /* copy the initial condition of each unconverged slice to F */
+    for (n = k; n < nslices; n++) { N_VScale(ONE, pr->U[n], pr->F[n]); }
+
+    /* fine propagation of the unconverged slices, the fine integrator i
+       propagates the slices n >= k with n % nfine == i */
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(pr->nfine) schedule(static, 1)
+#endif
+    for (i = 0; i < pr->nfine; i++)
+    {
+      int m;
+      for (m = k + (i - k % pr->nfine + pr->nfine) % pr->nfine; m < nslices;
+           m += pr->nfine)
+      {
+        pr->flags[m] = arkParareal_Propagate(pr->fine_mem[i],
+                                             arkParareal_SliceTime(pr, m),
+                                             arkParareal_SliceTime(pr, m + 1),
+                                             pr->F[m], pr->F[m]);
+      }
+    }
+
+    for (n = k; n < nslices; n++)
+    {
+      if (pr->flags[n] != ARK_SUCCESS) { return pr->flags[n]; }
+    }
+
+    /* sequential coarse correction sweep, U_k is exact so U_{k+1} = F(U_k) */
+    pr->cnorm = arkParareal_ChangeNorm(pr, pr->F[k], pr->U[k + 1]);
+    N_VScale(ONE, pr->F[k], pr->U[k + 1]);
+
+    for (n = k + 1; n < nslices; n++)
+    {
+      /* F(U_n^k) - G(U_n^k) */
+      N_VLinearSum(ONE, pr->F[n], -ONE, pr->G[n], pr->F[n]);
+
+      flag = arkParareal_Propagate(pr->coarse_mem, arkParareal_SliceTime(pr, n),
+                                   arkParareal_SliceTime(pr, n + 1), pr->U[n],
+                                   pr->G[n]);
+      if (flag != ARK_SUCCESS) { return flag; }
+
+      N_VLinearSum(ONE, pr->G[n], ONE, pr->F[n], pr->F[n]);
+
+      norm      = arkParareal_ChangeNorm(pr, pr->F[n], pr->U[n + 1]);
+      pr->cnorm = SUNMAX(pr->cnorm, norm);
+      N_VScale(ONE, pr->F[n], pr->U[n + 1]);
+    }
+
+    pr->niters = k + 1;
+
+    if (pr->cnorm <= ONE) { break; }
+  }
+
+  N_VScale(ONE, pr->U[nslices], y);
+
+  if (pr->cnorm > ONE && pr->niters < nslices)
+  {
+    arkProcessError(ark_mem, ARK_CONV_FAILURE, __LINE__, __func__, __FILE__,
+                    "Parareal iteration did not converge in %d iterations",
+                    pr->niters);
+    return ARK_CONV_FAILURE;
+  }
+
+  return ARK_SUCCESS;
+}
+
+/* Free the Parareal driver, the integrators are not freed */
+int ARKParareal_Free(ARKParareal* pr)
+{
+  if (pr == NULL || *pr == NULL) { return ARK_SUCCESS; }
+
+  arkParareal_FreeVectors(*pr);
+  free((*pr)->fine_mem);
+  free(*pr);
+  *pr = NULL;
+
+  return ARK_SUCCESS;
+}
+
+/* ------------------------
+ * ARKParareal Set Functions
+ * ------------------------ */
+
+/* Set the maximum number of iterations, <= 0 uses the number of slices */
+int ARKParareal_SetMaxIters(ARKParareal pr, int maxiters)
+{
+  if (pr == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_MEM);
+    return ARK_MEM_NULL;
+  }
+
+  pr->maxiters = (maxiters > 0) ? maxiters : 0;
+
+  return ARK_SUCCESS;
+}
+
+/* Set the convergence tolerances, non-positive values restore the defaults */
+int ARKParareal_SetTolerances(ARKParareal pr, sunrealtype reltol,
+                              sunrealtype abstol)
+{
+  if (pr == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_MEM);
+    return ARK_MEM_NULL;
+  }
+
+  if (reltol < ZERO || abstol < ZERO || (reltol == ZERO && abstol == ZERO))
+  {
+    pr->reltol = PARAREAL_RELTOL;
+    pr->abstol = PARAREAL_ABSTOL;
+  }
+  else
+  {
+    pr->reltol = reltol;
+    pr->abstol = abstol;
+  }
+
+  return ARK_SUCCESS;
+}
+
+/* ------------------------
+ * ARKParareal Get Functions
+ * ------------------------ */
+
+/* Number of iterations in the last call to ARKParareal_Evolve */
+int ARKParareal_GetNumIters(ARKParareal pr, int* iters)
+{
+  if (pr == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_MEM);
+    return ARK_MEM_NULL;
+  }
+
+  *iters = pr->niters;
+
+  return ARK_SUCCESS;
+}
+
+/* Largest weighted change of a slice solution in the last iteration */
+int ARKParareal_GetCorrectionNorm(ARKParareal pr, sunrealtype* norm)
+{
+  if (pr == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_MEM);
+    return ARK_MEM_NULL;
+  }
+
+  *norm = pr->cnorm;
+
+  return ARK_SUCCESS;
+}
+
+/* Solution at the start of a time slice (slice = nslices gives tf) */
+int ARKParareal_GetSliceSolution(ARKParareal pr, int slice, sunrealtype* t,
+                                 N_Vector y)
+{
+  if (pr == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_MEM);
+    return ARK_MEM_NULL;
+  }
+
+  if (pr->U == NULL || slice < 0 || slice > pr->nslices || y == NULL)
+  {
+    arkProcessError((ARKodeMem)pr->coarse_mem, ARK_ILL_INPUT, __LINE__,
+                    __func__, __FILE__, "Illegal slice or output vector");
+    return ARK_ILL_INPUT;
+  }
+
+  *t = arkParareal_SliceTime(pr, slice);
+  N_VScale(ONE, pr->U[slice], y);
+
+  return ARK_SUCCESS;
+}
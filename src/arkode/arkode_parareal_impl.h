@@ -0,0 +1,67 @@
+/* -----------------------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * This is the implementation header file for the ARKODE Parareal driver.
+ * ---------------------------------------------------------------------------*/
+
+#ifndef _ARKODE_PARAREAL_IMPL_H
+#define _ARKODE_PARAREAL_IMPL_H
+
+#include <arkode/arkode_parareal.h>
+#include <sundials/sundials_nvector.h>
+#include <sundials/sundials_types.h>
+
+#ifdef __cplusplus /* wrapper to enable C++ usage */
+extern "C" {
+#endif
+
+/* ------------------------------
+ * ARKParareal structure content
+ * ------------------------------ */
+
+struct ARKPararealMemRec
+{
+  /* Integrators */
+  void* coarse_mem; /* coarse propagator                    */
+  void** fine_mem;  /* fine propagators, one per thread     */
+  int nfine;        /* number of fine propagators (threads) */
+
+  /* Options */
+  int maxiters;       /* maximum iterations (0 = nslices)   */
+  sunrealtype reltol; /* relative convergence tolerance     */
+  sunrealtype abstol; /* absolute convergence tolerance     */
+
+  /* Time slices */
+  int nslices;    /* number of time slices              */
+  sunrealtype t0; /* initial time                       */
+  sunrealtype tf; /* final time                         */
+
+  /* Slice data */
+  N_Vector* U; /* solution at slice boundaries (nslices + 1) */
+  N_Vector* G; /* coarse propagation of each slice           */
+  N_Vector* F; /* fine propagation of each slice, F[n] is a  */
+               /* clone of the fine integrator n % nfine     */
+  N_Vector ewt;
+  N_Vector tmp;
+  int* flags; /* fine propagation return flags */
+
+  /* Statistics */
+  int niters;        /* iterations in the last evolve        */
+  sunrealtype cnorm; /* correction norm of the last iteration */
+};
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
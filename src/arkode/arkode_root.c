@@ -92,6 +92,9 @@ int ARKodeRootInit(void* arkode_mem, int nrtfn, ARKRootFn g)
     ark_mem->root_mem->gactive   = NULL;
     ark_mem->root_mem->mxgnull   = 1;
     ark_mem->root_mem->root_data = ark_mem->user_data;
+    ark_mem->root_mem->gpart     = NULL;
+    ark_mem->root_mem->rcand     = NULL;
+    ark_mem->root_mem->rootiqi   = SUNFALSE;
 
     ark_mem->lrw += ARK_ROOT_LRW;
     ark_mem->liw += ARK_ROOT_LIW;
@@ -114,9 +117,11 @@ int ARKodeRootInit(void* arkode_mem, int nrtfn, ARKRootFn g)
     ark_mem->root_mem->rootdir = NULL;
     free(ark_mem->root_mem->gactive);
     ark_mem->root_mem->gactive = NULL;
+    free(ark_mem->root_mem->rcand);
+    ark_mem->root_mem->rcand = NULL;
 
     ark_mem->lrw -= 3 * (ark_mem->root_mem->nrtfn);
-    ark_mem->liw -= 3 * (ark_mem->root_mem->nrtfn);
+    ark_mem->liw -= 4 * (ark_mem->root_mem->nrtfn);
   }
 
   /* If ARKodeRootInit() was called with nrtfn == 0, then set
@@ -151,9 +156,11 @@ int ARKodeRootInit(void* arkode_mem, int nrtfn, ARKRootFn g)
         ark_mem->root_mem->rootdir = NULL;
         free(ark_mem->root_mem->gactive);
         ark_mem->root_mem->gactive = NULL;
+        free(ark_mem->root_mem->rcand);
+        ark_mem->root_mem->rcand = NULL;
 
         ark_mem->lrw -= 3 * nrt;
-        ark_mem->liw -= 3 * nrt;
+        ark_mem->liw -= 4 * nrt;
 
         arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
                         MSG_ARK_NULL_G);
@@ -259,6 +266,27 @@ int ARKodeRootInit(void* arkode_mem, int nrtfn, ARKRootFn g)
     return (ARK_MEM_FAIL);
   }
 
+  ark_mem->root_mem->rcand = NULL;
+  ark_mem->root_mem->rcand = (int*)malloc(nrt * sizeof(int));
+  if (ark_mem->root_mem->rcand == NULL)
+  {
+    free(ark_mem->root_mem->glo);
+    ark_mem->root_mem->glo = NULL;
+    free(ark_mem->root_mem->ghi);
+    ark_mem->root_mem->ghi = NULL;
+    free(ark_mem->root_mem->grout);
+    ark_mem->root_mem->grout = NULL;
+    free(ark_mem->root_mem->iroots);
+    ark_mem->root_mem->iroots = NULL;
+    free(ark_mem->root_mem->rootdir);
+    ark_mem->root_mem->rootdir = NULL;
+    free(ark_mem->root_mem->gactive);
+    ark_mem->root_mem->gactive = NULL;
+    arkProcessError(ark_mem, ARK_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_MEM_FAIL);
+    return (ARK_MEM_FAIL);
+  }
+
   /* Set default values for rootdir (both directions) */
   for (i = 0; i < nrt; i++) { ark_mem->root_mem->rootdir[i] = 0; }
 
@@ -266,7 +294,7 @@ int ARKodeRootInit(void* arkode_mem, int nrtfn, ARKRootFn g)
   for (i = 0; i < nrt; i++) { ark_mem->root_mem->gactive[i] = SUNTRUE; }
 
   ark_mem->lrw += 3 * nrt;
-  ark_mem->liw += 3 * nrt;
+  ark_mem->liw += 4 * nrt;
 
   return (ARK_SUCCESS);
 }
@@ -307,8 +335,10 @@ int arkRootFree(void* arkode_mem)
       ark_mem->root_mem->rootdir = NULL;
       free(ark_mem->root_mem->gactive);
       ark_mem->root_mem->gactive = NULL;
+      free(ark_mem->root_mem->rcand);
+      ark_mem->root_mem->rcand = NULL;
       ark_mem->lrw -= 3 * ark_mem->root_mem->nrtfn;
-      ark_mem->liw -= 3 * ark_mem->root_mem->nrtfn;
+      ark_mem->liw -= 4 * ark_mem->root_mem->nrtfn;
     }
     free(ark_mem->root_mem);
     ark_mem->lrw -= ARK_ROOT_LRW;
@@ -673,6 +703,19 @@ int arkRootCheck3(void* arkode_mem)
   gfun     = user-defined function for g(t).  Its form is
              (void) gfun(t, y, gt, user_data)
 
+  gpart    = optional user-defined function for a subset of g(t).
+             Its form is (void) gpart(t, y, ncand, cand, gt, user_data)
+             and it sets gt[cand[j]] for j = 0, ..., ncand-1.  If
+             gpart is supplied, only the components of g with a sign
+             change (or a zero) in the interval are evaluated during
+             the search and candidates are dropped as the interval
+             shrinks, so the cost of an iteration scales with the
+             number of crossings rather than nrtfn.
+
+  rootiqi  = flag to use inverse quadratic interpolation in place of
+             the secant step when the previous two iterates bracket
+             the root from opposite sides.
+
   rootdir  = in array specifying the direction of zero-crossings.
              If rootdir[i] > 0, search for roots of g_i only if
              g_i is increasing; if rootdir[i] < 0, search for
@@ -730,8 +773,10 @@ int arkRootCheck3(void* arkode_mem)
 int arkRootfind(void* arkode_mem)
 {
   sunrealtype alpha, tmid, gfrac, maxfrac, fracint, fracsub;
-  int i, retval, imax, side, sideprev;
-  sunbooleantype zroot, sgnchg;
+  sunrealtype tiqi, ga, gb, tc, gc;
+  int i, j, k, retval, imax, ic, ncand, side, sideprev;
+  int* cand;
+  sunbooleantype zroot, sgnchg, partial;
   ARKodeMem ark_mem;
   ARKodeRootMem rootmem;
   if (arkode_mem == NULL)
@@ -743,25 +788,38 @@ int arkRootfind(void* arkode_mem)
   ark_mem = (ARKodeMem)arkode_mem;
   rootmem = ark_mem->root_mem;
 
-  imax = 0;
+  imax    = 0;
+  cand    = rootmem->rcand;
+  partial = (rootmem->gpart != NULL);
 
-  /* First check for change in sign in ghi or for a zero in ghi. */
+  /* First check for change in sign in ghi or for a zero in ghi.
+     Record the candidate components for the root search. With a partial
+     g function these are only the components that change sign or are zero,
+     otherwise all components are candidates. */
   maxfrac = ZERO;
   zroot   = SUNFALSE;
   sgnchg  = SUNFALSE;
+  ncand   = 0;
   for (i = 0; i < rootmem->nrtfn; i++)
   {
+    if (!partial) { cand[ncand++] = i; }
     if (!rootmem->gactive[i]) { continue; }
     if (SUNRabs(rootmem->ghi[i]) == ZERO)
     {
-      if (rootmem->rootdir[i] * rootmem->glo[i] <= ZERO) { zroot = SUNTRUE; }
+      if (rootmem->rootdir[i] * rootmem->glo[i] <= ZERO)
+      {
+        zroot = SUNTRUE;
+        if (partial) { cand[ncand++] = i; }
+      }
     }
     else
     {
       if ((DIFFERENT_SIGN(rootmem->glo[i], rootmem->ghi[i])) &&
           (rootmem->rootdir[i] * rootmem->glo[i] <= ZERO))
       {
-        gfrac = SUNRabs(rootmem->ghi[i] / (rootmem->ghi[i] - rootmem->glo[i]));
+        if (partial) { cand[ncand++] = i; }
+        gfrac =
+          SUNRabs(rootmem->ghi[i] / (rootmem->ghi[i] - rootmem->glo[i]));
         if (gfrac > maxfrac)
         {
           sgnchg  = SUNTRUE;
@@ -794,10 +852,16 @@ int arkRootfind(void* arkode_mem)
     return (RTFOUND);
   }
 
-  /* Initialize alpha to avoid compiler warning */
+  /* Initialize alpha, tc, and gc to avoid compiler warnings. The point
+     (tc, gc) is the last discarded endpoint for component ic and is used
+     with inverse quadratic interpolation. */
   alpha = ONE;
+  tc   = rootmem->thi;
+  gc   = ZERO;
+  ic   = -1;
 
   /* A sign change was found.  Loop to locate nearest root. */
+
   side     = 0;
   sideprev = -1;
   for (;;)
@@ -807,22 +871,45 @@ int arkRootfind(void* arkode_mem)
     if (SUNRabs(rootmem->thi - rootmem->tlo) <= rootmem->ttol) { break; }
 
     /* Set weight alpha.
-       On the first two passes, set alpha = 1.  Thereafter, reset alpha
+       On the first two passes, set alphaa = 1.  Thereafter, reset alphaa
        according to the side (low vs high) of the subinterval in which
        the sign change was found in the previous two passes.
-       If the sides were opposite, set alpha = 1.
+       If the sides were opposite, set alphaa = 1.
        If the sides were the same, then double alpha (if high side),
        or halve alpha (if low side).
        The next guess tmid is the secant method value if alpha = 1, but
        is closer to tlo if alpha < 1, and closer to thi if alpha > 1.    */
+
     if (sideprev == side) { alpha = (side == 2) ? alpha * TWO : alpha * HALF; }
     else { alpha = ONE; }
 
     /* Set next root approximation tmid and get g(tmid).
        If tmid is too close to tlo or thi, adjust it inward,
        by a fractional distance that is between 0.1 and 0.5.  */
-    tmid = rootmem->thi - (rootmem->thi - rootmem->tlo) * rootmem->ghi[imax] /
-                            (rootmem->ghi[imax] - alpha * rootmem->glo[imax]);
+    tmid = rootmem->thi -
+           (rootmem->thi - rootmem->tlo) * rootmem->ghi[imax] /
+             (rootmem->ghi[imax] - alpha * rootmem->glo[imax]);
+
+    /* If enabled, replace the secant value with the inverse quadratic
+       interpolant through tlo, thi, and tc when the last two passes were on
+       opposite sides and the result lies inside (tlo,thi). Otherwise the
+       Illinois weighting above guards against slow one-sided convergence. */
+    if (rootmem->rootiqi && ic == imax && alpha == ONE)
+    {
+      ga = rootmem->glo[imax];
+      gb = rootmem->ghi[imax];
+      if (ga != gc && gb != gc)
+      {
+        tiqi = rootmem->tlo * gb * gc / ((ga - gb) * (ga - gc)) +
+               rootmem->thi * ga * gc / ((gb - ga) * (gb - gc)) +
+               tc * ga * gb / ((gc - ga) * (gc - gb));
+        if ((tiqi - rootmem->tlo) * (rootmem->thi - tiqi) > ZERO)
+        {
+          tmid = tiqi;
+        }
+      }
+    }
+
     if (SUNRabs(tmid - rootmem->tlo) < HALF * rootmem->ttol)
     {
       fracint = SUNRabs(rootmem->thi - rootmem->tlo) / rootmem->ttol;
@@ -837,8 +924,16 @@ int arkRootfind(void* arkode_mem)
     }
 
     (void)ARKodeGetDky(ark_mem, tmid, 0, ark_mem->ycur);
-    retval = rootmem->gfun(tmid, ark_mem->ycur, rootmem->grout,
-                           rootmem->root_data);
+    if (partial)
+    {
+      retval = rootmem->gpart(tmid, ark_mem->ycur, ncand, cand,
+                                rootmem->grout, rootmem->root_data);
+    }
+    else
+    {
+      retval = rootmem->gfun(tmid, ark_mem->ycur, rootmem->grout,
+                               rootmem->root_data);
+    }
     rootmem->nge++;
     if (retval != 0) { return (ARK_RTFUNC_FAIL); }
 
@@ -848,20 +943,24 @@ int arkRootfind(void* arkode_mem)
     zroot    = SUNFALSE;
     sgnchg   = SUNFALSE;
     sideprev = side;
-    for (i = 0; i < rootmem->nrtfn; i++)
+    for (j = 0; j < ncand; j++)
     {
+      i = cand[j];
       if (!rootmem->gactive[i]) { continue; }
       if (SUNRabs(rootmem->grout[i]) == ZERO)
       {
-        if (rootmem->rootdir[i] * rootmem->glo[i] <= ZERO) { zroot = SUNTRUE; }
+        if (rootmem->rootdir[i] * rootmem->glo[i] <= ZERO)
+        {
+          zroot = SUNTRUE;
+        }
       }
       else
       {
         if ((DIFFERENT_SIGN(rootmem->glo[i], rootmem->grout[i])) &&
             (rootmem->rootdir[i] * rootmem->glo[i] <= ZERO))
         {
-          gfrac =
-            SUNRabs(rootmem->grout[i] / (rootmem->grout[i] - rootmem->glo[i]));
+          gfrac = SUNRabs(rootmem->grout[i] /
+                          (rootmem->grout[i] - rootmem->glo[i]));
           if (gfrac > maxfrac)
           {
             sgnchg  = SUNTRUE;
@@ -873,15 +972,30 @@ int arkRootfind(void* arkode_mem)
     }
     if (sgnchg)
     {
-      /* Sign change found in (tlo,tmid); replace thi with tmid. */
+      /* Sign change found in (tlo,tmid); replace thi with tmid. With a
+         partial g function, drop the candidates whose sign change is in
+         (tmid,thi) since they cannot have the nearest root. */
+      tc = rootmem->thi;
+      gc = rootmem->ghi[imax];
+      ic = imax;
       rootmem->thi = tmid;
-      for (i = 0; i < rootmem->nrtfn; i++)
+      for (j = 0, k = 0; j < ncand; j++)
       {
+        i                 = cand[j];
         rootmem->ghi[i] = rootmem->grout[i];
+        if (!partial || SUNRabs(rootmem->ghi[i]) == ZERO ||
+            DIFFERENT_SIGN(rootmem->glo[i], rootmem->ghi[i]))
+        {
+          cand[k++] = i;
+        }
       }
-      side = 1;
+      ncand = k;
+      side  = 1;
       /* Stop at root thi if converged; otherwise loop. */
-      if (SUNRabs(rootmem->thi - rootmem->tlo) <= rootmem->ttol) { break; }
+      if (SUNRabs(rootmem->thi - rootmem->tlo) <= rootmem->ttol)
+      {
+        break;
+      }
       continue; /* Return to looping point. */
     }
 
@@ -889,8 +1003,9 @@ int arkRootfind(void* arkode_mem)
     {
       /* No sign change in (tlo,tmid), but g = 0 at tmid; return root tmid. */
       rootmem->thi = tmid;
-      for (i = 0; i < rootmem->nrtfn; i++)
+      for (j = 0; j < ncand; j++)
       {
+        i                 = cand[j];
         rootmem->ghi[i] = rootmem->grout[i];
       }
       break;
@@ -898,9 +1013,13 @@ int arkRootfind(void* arkode_mem)
 
     /* No sign change in (tlo,tmid), and no zero at tmid.
        Sign change must be in (tmid,thi).  Replace tlo with tmid. */
+    tc = rootmem->tlo;
+    gc = rootmem->glo[imax];
+    ic = imax;
     rootmem->tlo = tmid;
-    for (i = 0; i < rootmem->nrtfn; i++)
+    for (j = 0; j < ncand; j++)
     {
+      i                 = cand[j];
       rootmem->glo[i] = rootmem->grout[i];
     }
     side = 2;
@@ -909,7 +1028,9 @@ int arkRootfind(void* arkode_mem)
 
   } /* End of root-search loop */
 
-  /* Reset trout and grout, set iroots, and return RTFOUND. */
+  /* Reset trout and grout, set iroots, and return RTFOUND. Components that
+     were not candidates keep their values at the initial thi, which have the
+     same sign as their values at trout. */
   rootmem->trout = rootmem->thi;
   for (i = 0; i < rootmem->nrtfn; i++)
   {
@@ -65,6 +65,9 @@ typedef struct ARKodeRootMemRec
   long int nge;            /* counter for g evaluations                    */
   sunbooleantype* gactive; /* array with active/inactive event functions   */
   int mxgnull;             /* num. warning messages about possible g==0    */
+  ARKPartialRootFn gpart;  /* optional function for a subset of g          */
+  int* rcand;              /* candidate components in root search          */
+  sunbooleantype rootiqi;  /* use inverse quadratic interpolation?         */
   void* root_data;         /* pointer to user_data                         */
 
 }* ARKodeRootMem;
@@ -113,8 +113,11 @@ module farkode_mod
  public :: FARKodeRootInit
  public :: FARKodeSetRootDirection
  public :: FARKodeSetNoInactiveRootWarn
+ public :: FARKodeSetPartialRootFn
+ public :: FARKodeSetRootInverseInterp
  public :: FARKodeSetDefaults
  public :: FARKodeSetOrder
+ public :: FARKodeSetNumStageThreads
  public :: FARKodeSetInterpolantType
  public :: FARKodeSetInterpolantDegree
  public :: FARKodeSetMaxNumSteps
@@ -162,6 +165,7 @@ module farkode_mod
  public :: FARKodeSetMaxNumConstrFails
  public :: FARKodeEvolve
  public :: FARKodeGetDky
+ public :: FARKodeGetDkyBatch
  public :: FARKodeComputeState
  public :: FARKodeGetNumStepAttempts
  public :: FARKodeGetWorkSpace
@@ -287,6 +291,7 @@ module farkode_mod
  public :: FARKodeButcherTable_Free
  public :: FARKodeButcherTable_Write
  public :: FARKodeButcherTable_IsStifflyAccurate
+ public :: FARKodeButcherTable_StageGroups
  public :: FARKodeButcherTable_CheckOrder
  public :: FARKodeButcherTable_CheckARKOrder
  ! typedef enum ARKODE_DIRKTableID
@@ -320,7 +325,8 @@ module farkode_mod
   enumerator :: ARKODE_BACKWARD_EULER_1_1
   enumerator :: ARKODE_IMPLICIT_MIDPOINT_1_2
   enumerator :: ARKODE_IMPLICIT_TRAPEZOIDAL_2_2
-  enumerator :: ARKODE_MAX_DIRK_NUM = ARKODE_IMPLICIT_TRAPEZOIDAL_2_2
+  enumerator :: ARKODE_PARALLEL_DIRK_4_2_4
+  enumerator :: ARKODE_MAX_DIRK_NUM = ARKODE_PARALLEL_DIRK_4_2_4
  end enum
  integer, parameter, public :: ARKODE_DIRKTableID = kind(ARKODE_DIRK_NONE)
  public :: ARKODE_DIRK_NONE, ARKODE_MIN_DIRK_NUM, ARKODE_SDIRK_2_1_2, ARKODE_BILLINGTON_3_3_2, ARKODE_TRBDF2_3_3_2, &
@@ -329,7 +335,8 @@ module farkode_mod
     ARKODE_ARK437L2SA_DIRK_7_3_4, ARKODE_ARK548L2SAb_DIRK_8_4_5, ARKODE_ESDIRK324L2SA_4_2_3, ARKODE_ESDIRK325L2SA_5_2_3, &
     ARKODE_ESDIRK32I5L2SA_5_2_3, ARKODE_ESDIRK436L2SA_6_3_4, ARKODE_ESDIRK43I6L2SA_6_3_4, ARKODE_QESDIRK436L2SA_6_3_4, &
     ARKODE_ESDIRK437L2SA_7_3_4, ARKODE_ESDIRK547L2SA_7_4_5, ARKODE_ESDIRK547L2SA2_7_4_5, ARKODE_ARK2_DIRK_3_1_2, &
-    ARKODE_BACKWARD_EULER_1_1, ARKODE_IMPLICIT_MIDPOINT_1_2, ARKODE_IMPLICIT_TRAPEZOIDAL_2_2, ARKODE_MAX_DIRK_NUM
+    ARKODE_BACKWARD_EULER_1_1, ARKODE_IMPLICIT_MIDPOINT_1_2, ARKODE_IMPLICIT_TRAPEZOIDAL_2_2, ARKODE_PARALLEL_DIRK_4_2_4, &
+    ARKODE_MAX_DIRK_NUM
  public :: FARKodeButcherTable_LoadDIRK
  public :: FARKodeButcherTable_LoadDIRKByName
  public :: FARKodeButcherTable_DIRKIDToName
@@ -362,7 +369,8 @@ module farkode_mod
   enumerator :: ARKODE_FORWARD_EULER_1_1
   enumerator :: ARKODE_RALSTON_EULER_2_1_2
   enumerator :: ARKODE_EXPLICIT_MIDPOINT_EULER_2_1_2
-  enumerator :: ARKODE_MAX_ERK_NUM = ARKODE_EXPLICIT_MIDPOINT_EULER_2_1_2
+  enumerator :: ARKODE_PARALLEL_ERK_4_2_3
+  enumerator :: ARKODE_MAX_ERK_NUM = ARKODE_PARALLEL_ERK_4_2_3
  end enum
  integer, parameter, public :: ARKODE_ERKTableID = kind(ARKODE_ERK_NONE)
  public :: ARKODE_ERK_NONE, ARKODE_MIN_ERK_NUM, ARKODE_HEUN_EULER_2_1_2, ARKODE_BOGACKI_SHAMPINE_4_2_3, &
@@ -371,7 +379,7 @@ module farkode_mod
     ARKODE_VERNER_8_5_6, ARKODE_FEHLBERG_13_7_8, ARKODE_KNOTH_WOLKE_3_3, ARKODE_ARK437L2SA_ERK_7_3_4, &
     ARKODE_ARK548L2SAb_ERK_8_4_5, ARKODE_ARK2_ERK_3_1_2, ARKODE_SOFRONIOU_SPALETTA_5_3_4, ARKODE_SHU_OSHER_3_2_3, &
     ARKODE_VERNER_9_5_6, ARKODE_VERNER_10_6_7, ARKODE_VERNER_13_7_8, ARKODE_VERNER_16_8_9, ARKODE_FORWARD_EULER_1_1, &
-    ARKODE_RALSTON_EULER_2_1_2, ARKODE_EXPLICIT_MIDPOINT_EULER_2_1_2, ARKODE_MAX_ERK_NUM
+    ARKODE_RALSTON_EULER_2_1_2, ARKODE_EXPLICIT_MIDPOINT_EULER_2_1_2, ARKODE_PARALLEL_ERK_4_2_3, ARKODE_MAX_ERK_NUM
  public :: FARKodeButcherTable_LoadERK
  public :: FARKodeButcherTable_LoadERKByName
  public :: FARKodeButcherTable_ERKIDToName
@@ -455,6 +463,7 @@ module farkode_mod
  public :: FARKodeSetJacTimesRhsFn
  public :: FARKodeSetMassTimes
  public :: FARKodeSetLinSysFn
+ public :: FARKodeSetJacRhsBatchFn
 
 ! WRAPPER DECLARATIONS
 interface
@@ -564,6 +573,24 @@ type(C_PTR), value :: farg1
 integer(C_INT) :: fresult
 end function
 
+function swigc_FARKodeSetPartialRootFn(farg1, farg2) &
+bind(C, name="_wrap_FARKodeSetPartialRootFn") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_FUNPTR), value :: farg2
+integer(C_INT) :: fresult
+end function
+
+function swigc_FARKodeSetRootInverseInterp(farg1, farg2) &
+bind(C, name="_wrap_FARKodeSetRootInverseInterp") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FARKodeSetDefaults(farg1) &
 bind(C, name="_wrap_FARKodeSetDefaults") &
 result(fresult)
@@ -581,6 +608,15 @@ integer(C_INT), intent(in) :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FARKodeSetNumStageThreads(farg1, farg2) &
+bind(C, name="_wrap_FARKodeSetNumStageThreads") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FARKodeSetInterpolantType(farg1, farg2) &
 bind(C, name="_wrap_FARKodeSetInterpolantType") &
 result(fresult)
@@ -1009,6 +1045,18 @@ type(C_PTR), value :: farg4
 integer(C_INT) :: fresult
 end function
 
+function swigc_FARKodeGetDkyBatch(farg1, farg2, farg3, farg4, farg5) &
+bind(C, name="_wrap_FARKodeGetDkyBatch") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+type(C_PTR), value :: farg3
+integer(C_INT), intent(in) :: farg4
+type(C_PTR), value :: farg5
+integer(C_INT) :: fresult
+end function
+
 function swigc_FARKodeComputeState(farg1, farg2, farg3) &
 bind(C, name="_wrap_FARKodeComputeState") &
 result(fresult)
@@ -1971,6 +2019,15 @@ type(C_PTR), value :: farg1
 integer(C_INT) :: fresult
 end function
 
+function swigc_FARKodeButcherTable_StageGroups(farg1, farg2) &
+bind(C, name="_wrap_FARKodeButcherTable_StageGroups") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_PTR), value :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FARKodeButcherTable_CheckOrder(farg1, farg2, farg3, farg4) &
 bind(C, name="_wrap_FARKodeButcherTable_CheckOrder") &
 result(fresult)
@@ -2364,6 +2421,16 @@ type(C_FUNPTR), value :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FARKodeSetJacRhsBatchFn(farg1, farg2, farg3) &
+bind(C, name="_wrap_FARKodeSetJacRhsBatchFn") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_FUNPTR), value :: farg2
+integer(C_INT), intent(in) :: farg3
+integer(C_INT) :: fresult
+end function
+
 end interface
 
 
@@ -2566,6 +2633,38 @@ fresult = swigc_FARKodeSetNoInactiveRootWarn(farg1)
 swig_result = fresult
 end function
 
+function FARKodeSetPartialRootFn(arkode_mem, gpart) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: arkode_mem
+type(C_FUNPTR), intent(in), value :: gpart
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_FUNPTR) :: farg2 
+
+farg1 = arkode_mem
+farg2 = gpart
+fresult = swigc_FARKodeSetPartialRootFn(farg1, farg2)
+swig_result = fresult
+end function
+
+function FARKodeSetRootInverseInterp(arkode_mem, onoff) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: arkode_mem
+integer(C_INT), intent(in) :: onoff
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = arkode_mem
+farg2 = onoff
+fresult = swigc_FARKodeSetRootInverseInterp(farg1, farg2)
+swig_result = fresult
+end function
+
 function FARKodeSetDefaults(arkode_mem) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -2595,6 +2694,22 @@ fresult = swigc_FARKodeSetOrder(farg1, farg2)
 swig_result = fresult
 end function
 
+function FARKodeSetNumStageThreads(arkode_mem, nthreads) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: arkode_mem
+integer(C_INT), intent(in) :: nthreads
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = arkode_mem
+farg2 = nthreads
+fresult = swigc_FARKodeSetNumStageThreads(farg1, farg2)
+swig_result = fresult
+end function
+
 function FARKodeSetInterpolantType(arkode_mem, itype) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -3362,6 +3477,31 @@ fresult = swigc_FARKodeGetDky(farg1, farg2, farg3, farg4)
 swig_result = fresult
 end function
 
+function FARKodeGetDkyBatch(arkode_mem, nt, t, k, dky) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: arkode_mem
+integer(C_INT), intent(in) :: nt
+real(C_DOUBLE), dimension(*), target, intent(inout) :: t
+integer(C_INT), intent(in) :: k
+type(C_PTR) :: dky
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+type(C_PTR) :: farg3 
+integer(C_INT) :: farg4 
+type(C_PTR) :: farg5 
+
+farg1 = arkode_mem
+farg2 = nt
+farg3 = c_loc(t(1))
+farg4 = k
+farg5 = dky
+fresult = swigc_FARKodeGetDkyBatch(farg1, farg2, farg3, farg4, farg5)
+swig_result = fresult
+end function
+
 function FARKodeComputeState(arkode_mem, zcor, z) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -5071,6 +5211,22 @@ fresult = swigc_FARKodeButcherTable_IsStifflyAccurate(farg1)
 swig_result = fresult
 end function
 
+function FARKodeButcherTable_StageGroups(b, groups) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: b
+integer(C_INT), dimension(*), target, intent(inout) :: groups
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_PTR) :: farg2 
+
+farg1 = b
+farg2 = c_loc(groups(1))
+fresult = swigc_FARKodeButcherTable_StageGroups(farg1, farg2)
+swig_result = fresult
+end function
+
 function FARKodeButcherTable_CheckOrder(b, q, p, outfile) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -5765,5 +5921,24 @@ fresult = swigc_FARKodeSetLinSysFn(farg1, farg2)
 swig_result = fresult
 end function
 
+function FARKodeSetJacRhsBatchFn(arkode_mem, rhsbatch, maxbatch) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: arkode_mem
+type(C_FUNPTR), intent(in), value :: rhsbatch
+integer(C_INT), intent(in) :: maxbatch
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_FUNPTR) :: farg2 
+integer(C_INT) :: farg3 
+
+farg1 = arkode_mem
+farg2 = rhsbatch
+farg3 = maxbatch
+fresult = swigc_FARKodeSetJacRhsBatchFn(farg1, farg2, farg3)
+swig_result = fresult
+end function
+
 
 end module
@@ -483,6 +483,34 @@ SWIGEXPORT int _wrap_FARKodeSetNoInactiveRootWarn(void *farg1) {
 }
 
 
+SWIGEXPORT int _wrap_FARKodeSetPartialRootFn(void *farg1, ARKPartialRootFn farg2) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  ARKPartialRootFn arg2 = (ARKPartialRootFn) 0 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (ARKPartialRootFn)(farg2);
+  result = (int)ARKodeSetPartialRootFn(arg1,arg2);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
+SWIGEXPORT int _wrap_FARKodeSetRootInverseInterp(void *farg1, int const *farg2) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  int arg2 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (int)(*farg2);
+  result = (int)ARKodeSetRootInverseInterp(arg1,arg2);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FARKodeSetDefaults(void *farg1) {
   int fresult ;
   void *arg1 = (void *) 0 ;
@@ -509,6 +537,20 @@ SWIGEXPORT int _wrap_FARKodeSetOrder(void *farg1, int const *farg2) {
 }
 
 
+SWIGEXPORT int _wrap_FARKodeSetNumStageThreads(void *farg1, int const *farg2) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  int arg2 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (int)(*farg2);
+  result = (int)ARKodeSetNumStageThreads(arg1,arg2);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FARKodeSetInterpolantType(void *farg1, int const *farg2) {
   int fresult ;
   void *arg1 = (void *) 0 ;
@@ -1177,6 +1219,26 @@ SWIGEXPORT int _wrap_FARKodeGetDky(void *farg1, double const *farg2, int const *
 }
 
 
+SWIGEXPORT int _wrap_FARKodeGetDkyBatch(void *farg1, int const *farg2, double *farg3, int const *farg4, void *farg5) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  int arg2 ;
+  sunrealtype *arg3 = (sunrealtype *) 0 ;
+  int arg4 ;
+  N_Vector *arg5 = (N_Vector *) 0 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (int)(*farg2);
+  arg3 = (sunrealtype *)(farg3);
+  arg4 = (int)(*farg4);
+  arg5 = (N_Vector *)(farg5);
+  result = (int)ARKodeGetDkyBatch(arg1,arg2,arg3,arg4,arg5);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FARKodeComputeState(void *farg1, N_Vector farg2, N_Vector farg3) {
   int fresult ;
   void *arg1 = (void *) 0 ;
@@ -2652,6 +2714,20 @@ SWIGEXPORT int _wrap_FARKodeButcherTable_IsStifflyAccurate(void *farg1) {
 }
 
 
+SWIGEXPORT int _wrap_FARKodeButcherTable_StageGroups(void *farg1, int *farg2) {
+  int fresult ;
+  ARKodeButcherTable arg1 = (ARKodeButcherTable) 0 ;
+  int *arg2 = (int *) 0 ;
+  int result;
+  
+  arg1 = (ARKodeButcherTable)(farg1);
+  arg2 = (int *)(farg2);
+  result = (int)ARKodeButcherTable_StageGroups(arg1,arg2);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FARKodeButcherTable_CheckOrder(void *farg1, int *farg2, int *farg3, void *farg4) {
   int fresult ;
   ARKodeButcherTable arg1 = (ARKodeButcherTable) 0 ;
@@ -3243,4 +3319,20 @@ SWIGEXPORT int _wrap_FARKodeSetLinSysFn(void *farg1, ARKLsLinSysFn farg2) {
 }
 
 
+SWIGEXPORT int _wrap_FARKodeSetJacRhsBatchFn(void *farg1, ARKLsRhsBatchFn farg2, int const *farg3) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  ARKLsRhsBatchFn arg2 = (ARKLsRhsBatchFn) 0 ;
+  int arg3 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (ARKLsRhsBatchFn)(farg2);
+  arg3 = (int)(*farg3);
+  result = (int)ARKodeSetJacRhsBatchFn(arg1,arg2,arg3);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 
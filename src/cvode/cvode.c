@@ -28,7 +28,9 @@
 #include <sundials/sundials_types.h>
 #include <sunnonlinsol/sunnonlinsol_newton.h>
 
+#include "cvode_fused_host.h"
 #include "cvode_impl.h"
+#include "cvode_ls_impl.h"
 #include "sundials/priv/sundials_errors_impl.h"
 
 /*=================================================================*/
@@ -98,6 +100,10 @@
  *
  *    FUZZ_FACTOR fuzz factor used to estimate infinitesimal time intervals
  *
+ * CVodeGetDkyBatch
+ *
+ *    DKY_BATCH   number of output times evaluated per pass over zn
+ *
  * cvHin
  *
  *    HLB_FACTOR  factor for upper bound on initial step size
@@ -113,6 +119,8 @@
 
 #define FUZZ_FACTOR SUN_RCONST(100.0)
 
+#define DKY_BATCH 32
+
 #define HLB_FACTOR SUN_RCONST(100.0)
 #define HUB_FACTOR SUN_RCONST(0.1)
 #define H_BIAS     HALF
@@ -147,6 +155,8 @@ static int cvYddNorm(CVodeMem cv_mem, sunrealtype hg, sunrealtype* yddnrm);
 /* Main cvStep function */
 
 static int cvStep(CVodeMem cv_mem);
+static void cvTelemetryBeginStep(CVodeMem cv_mem);
+static void cvTelemetryEndStep(CVodeMem cv_mem, sunrealtype dsm);
 
 /* Function called at beginning of step */
 
@@ -168,6 +178,16 @@ static void cvSetTqBDF(CVodeMem cv_mem, sunrealtype hsum, sunrealtype alpha0,
                        sunrealtype alpha0_hat, sunrealtype xi_inv,
                        sunrealtype xistar_inv);
 
+/* Contiguous history array functions */
+
+static sunbooleantype cvHostHistorySupported(N_Vector tmpl);
+static int cvContigHistoryData(CVodeMem cv_mem, int jstart, int nvec,
+                               sunrealtype** znd);
+static void cvPredictContig(CVodeMem cv_mem, sunrealtype sign);
+static void cvRescaleContig(CVodeMem cv_mem);
+static void cvScaleAddHistoryContig(CVodeMem cv_mem, int nvec, sunrealtype* c,
+                                    N_Vector x, int jstart);
+
 /* Nonlinear solver functions */
 
 static int cvNls(CVodeMem cv_mem, int nflag);
@@ -308,6 +328,9 @@ void* CVodeCreate(int lmm, SUNContext sunctx)
   cv_mem->cv_constraints      = NULL;
   cv_mem->cv_constraintsSet   = SUNFALSE;
 
+  /* Initialize telemetry */
+  cv_mem->cv_telemetry = NULL;
+
   /* Initialize root finding variables */
 
   cv_mem->cv_glo     = NULL;
@@ -319,6 +342,9 @@ void* CVodeCreate(int lmm, SUNContext sunctx)
   cv_mem->cv_nrtfn   = 0;
   cv_mem->cv_gactive = NULL;
   cv_mem->cv_mxgnull = 1;
+  cv_mem->cv_gpart   = NULL;
+  cv_mem->cv_rcand   = NULL;
+  cv_mem->cv_rootiqi = SUNFALSE;
 
   /* Initialize projection variables */
   cv_mem->proj_mem     = NULL;
@@ -347,6 +373,11 @@ void* CVodeCreate(int lmm, SUNContext sunctx)
   /* Initialize fused operations variable */
   cv_mem->cv_usefused = SUNFALSE;
 
+  /* Initialize history storage variables */
+  cv_mem->cv_zn_contig  = SUNFALSE;
+  cv_mem->cv_zn_data    = NULL;
+  cv_mem->cv_zn_length  = 0;
+
   /* Return pointer to CVODE memory block */
 
   return ((void*)cv_mem);
@@ -843,9 +874,11 @@ int CVodeRootInit(void* cvode_mem, int nrtfn, CVRootFn g)
     cv_mem->cv_rootdir = NULL;
     free(cv_mem->cv_gactive);
     cv_mem->cv_gactive = NULL;
+    free(cv_mem->cv_rcand);
+    cv_mem->cv_rcand = NULL;
 
     cv_mem->cv_lrw -= 3 * (cv_mem->cv_nrtfn);
-    cv_mem->cv_liw -= 3 * (cv_mem->cv_nrtfn);
+    cv_mem->cv_liw -= 4 * (cv_mem->cv_nrtfn);
   }
 
   /* If CVodeRootInit() was called with nrtfn == 0, then set cv_nrtfn to
@@ -880,9 +913,11 @@ int CVodeRootInit(void* cvode_mem, int nrtfn, CVRootFn g)
         cv_mem->cv_rootdir = NULL;
         free(cv_mem->cv_gactive);
         cv_mem->cv_gactive = NULL;
+        free(cv_mem->cv_rcand);
+        cv_mem->cv_rcand = NULL;
 
         cv_mem->cv_lrw -= 3 * nrt;
-        cv_mem->cv_liw -= 3 * nrt;
+        cv_mem->cv_liw -= 4 * nrt;
 
         cvProcessError(cv_mem, CV_ILL_INPUT, __LINE__, __func__, __FILE__,
                        MSGCV_NULL_G);
@@ -992,6 +1027,27 @@ int CVodeRootInit(void* cvode_mem, int nrtfn, CVRootFn g)
     return (CV_MEM_FAIL);
   }
 
+  cv_mem->cv_rcand = NULL;
+  cv_mem->cv_rcand = (int*)malloc(nrt * sizeof(int));
+  if (cv_mem->cv_rcand == NULL)
+  {
+    free(cv_mem->cv_glo);
+    cv_mem->cv_glo = NULL;
+    free(cv_mem->cv_ghi);
+    cv_mem->cv_ghi = NULL;
+    free(cv_mem->cv_grout);
+    cv_mem->cv_grout = NULL;
+    free(cv_mem->cv_iroots);
+    cv_mem->cv_iroots = NULL;
+    free(cv_mem->cv_rootdir);
+    cv_mem->cv_rootdir = NULL;
+    free(cv_mem->cv_gactive);
+    cv_mem->cv_gactive = NULL;
+    cvProcessError(cv_mem, CV_MEM_FAIL, __LINE__, __func__, __FILE__,
+                   MSGCV_MEM_FAIL);
+    return (CV_MEM_FAIL);
+  }
+
   /* Set default values for rootdir (both directions) */
   for (i = 0; i < nrt; i++) { cv_mem->cv_rootdir[i] = 0; }
 
@@ -999,7 +1055,7 @@ int CVodeRootInit(void* cvode_mem, int nrtfn, CVRootFn g)
   for (i = 0; i < nrt; i++) { cv_mem->cv_gactive[i] = SUNTRUE; }
 
   cv_mem->cv_lrw += 3 * nrt;
-  cv_mem->cv_liw += 3 * nrt;
+  cv_mem->cv_liw += 4 * nrt;
 
   return (CV_SUCCESS);
 }
@@ -1464,8 +1520,11 @@ int CVode(void* cvode_mem, sunrealtype tout, N_Vector yout, sunrealtype* tret,
       }
     }
 
-    /* Call cvStep to take a step */
+    /* Call cvStep to take a step, steps after the first are audited for
+       heap allocations when the audit is enabled */
+    SUNAllocAuditBeginStep(cv_mem->cv_sunctx, cv_mem->cv_nst > 0);
     kflag = cvStep(cv_mem);
+    SUNAllocAuditEndStep(cv_mem->cv_sunctx);
 
     /* Process failed step cases, and exit loop */
     if (kflag != CV_SUCCESS)
@@ -1696,6 +1755,128 @@ int CVodeGetDky(void* cvode_mem, sunrealtype t, int k, N_Vector dky)
   return (CV_SUCCESS);
 }
 
+/*
+ * CVodeGetDkyBatch
+ *
+ * This routine computes the k-th derivative of the interpolating
+ * polynomial at the nt times t[i] and stores the results in the
+ * vectors dky[i]. All times are checked before any output is
+ * computed. The times are processed in groups of DKY_BATCH and,
+ * for each group, every column of the Nordsieck history array is
+ * applied to all outputs of the group with a single call to
+ * N_VScaleAddMulti, instead of one linear combination per time.
+ * The factor h^(-k) is folded into the coefficients.
+ */
+
+int CVodeGetDkyBatch(void* cvode_mem, int nt, sunrealtype* t, int k,
+                     N_Vector* dky)
+{
+  sunrealtype s, r;
+  sunrealtype tfuzz, tp, tn1;
+  sunrealtype cvals[L_MAX * DKY_BATCH];
+  int i, j, l, i0, nb, ier;
+  CVodeMem cv_mem;
+
+  /* Check all inputs for legality */
+
+  if (cvode_mem == NULL)
+  {
+    cvProcessError(NULL, CV_MEM_NULL, __LINE__, __func__, __FILE__, MSGCV_NO_MEM);
+    return (CV_MEM_NULL);
+  }
+  cv_mem = (CVodeMem)cvode_mem;
+
+  SUNDIALS_MARK_FUNCTION_BEGIN(CV_PROFILER);
+
+  if ((nt < 1) || (t == NULL))
+  {
+    cvProcessError(cv_mem, CV_ILL_INPUT, __LINE__, __func__, __FILE__,
+                   MSGCV_BAD_NT);
+    SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+    return (CV_ILL_INPUT);
+  }
+
+  if (dky == NULL)
+  {
+    cvProcessError(cv_mem, CV_BAD_DKY, __LINE__, __func__, __FILE__,
+                   MSGCV_NULL_DKY);
+    SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+    return (CV_BAD_DKY);
+  }
+
+  if ((k < 0) || (k > cv_mem->cv_q))
+  {
+    cvProcessError(cv_mem, CV_BAD_K, __LINE__, __func__, __FILE__, MSGCV_BAD_K);
+    SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+    return (CV_BAD_K);
+  }
+
+  /* Allow for some slack */
+  tfuzz = FUZZ_FACTOR * cv_mem->cv_uround *
+          (SUNRabs(cv_mem->cv_tn) + SUNRabs(cv_mem->cv_hu));
+  if (cv_mem->cv_hu < ZERO) { tfuzz = -tfuzz; }
+  tp  = cv_mem->cv_tn - cv_mem->cv_hu - tfuzz;
+  tn1 = cv_mem->cv_tn + tfuzz;
+
+  for (i = 0; i < nt; i++)
+  {
+    if (dky[i] == NULL)
+    {
+      cvProcessError(cv_mem, CV_BAD_DKY, __LINE__, __func__, __FILE__,
+                     MSGCV_NULL_DKY);
+      SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+      return (CV_BAD_DKY);
+    }
+    if ((t[i] - tp) * (t[i] - tn1) > ZERO)
+    {
+      cvProcessError(cv_mem, CV_BAD_T, __LINE__, __func__, __FILE__,
+                     MSGCV_BAD_T, t[i], cv_mem->cv_tn - cv_mem->cv_hu,
+                     cv_mem->cv_tn);
+      SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+      return (CV_BAD_T);
+    }
+  }
+
+  r = (k == 0) ? ONE : SUNRpowerI(cv_mem->cv_h, -k);
+
+  for (i0 = 0; i0 < nt; i0 += DKY_BATCH)
+  {
+    nb = SUNMIN(DKY_BATCH, nt - i0);
+
+    /* Coefficients of zn[j] for each time, stored by column j */
+    for (i = 0; i < nb; i++)
+    {
+      s = (t[i0 + i] - cv_mem->cv_tn) / cv_mem->cv_h;
+      for (j = cv_mem->cv_q; j >= k; j--)
+      {
+        cvals[j * nb + i] = r;
+        for (l = j; l >= j - k + 1; l--) { cvals[j * nb + i] *= l; }
+        for (l = 0; l < j - k; l++) { cvals[j * nb + i] *= s; }
+      }
+    }
+
+    /* Sum the differentiated interpolating polynomials */
+    for (i = 0; i < nb; i++)
+    {
+      N_VScale(cvals[cv_mem->cv_q * nb + i], cv_mem->cv_zn[cv_mem->cv_q],
+               dky[i0 + i]);
+    }
+    for (j = cv_mem->cv_q - 1; j >= k; j--)
+    {
+      ier = N_VScaleAddMulti(nb, cvals + j * nb, cv_mem->cv_zn[j], dky + i0,
+                             dky + i0);
+      if (ier != CV_SUCCESS)
+      {
+        SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+        return (CV_VECTOROP_ERR);
+      }
+    }
+  }
+
+  SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+  return (CV_SUCCESS);
+}
+
 /*
  * CVodeComputeState
  *
@@ -1765,6 +1946,8 @@ void CVodeFree(void** cvode_mem)
     cv_mem->cv_rootdir = NULL;
     free(cv_mem->cv_gactive);
     cv_mem->cv_gactive = NULL;
+    free(cv_mem->cv_rcand);
+    cv_mem->cv_rcand = NULL;
   }
 
   if (cv_mem->proj_mem) { cvProjFree(&(cv_mem->proj_mem)); }
@@ -1885,9 +2068,30 @@ static sunbooleantype cvAllocVectors(CVodeMem cv_mem, N_Vector tmpl)
 
   /* Allocate zn[0] ... zn[qmax] */
 
+  cv_mem->cv_zn_data   = NULL;
+  cv_mem->cv_zn_length = 0;
+  if (cv_mem->cv_zn_contig && cvHostHistorySupported(tmpl))
+  {
+    /* Use one allocation for all of zn with zn[j] in the j-th block */
+    cv_mem->cv_zn_length = N_VGetLength(tmpl);
+    cv_mem->cv_zn_data   = (sunrealtype*)malloc((cv_mem->cv_qmax + 1) *
+                                                cv_mem->cv_zn_length *
+                                                sizeof(sunrealtype));
+  }
+
   for (j = 0; j <= cv_mem->cv_qmax; j++)
   {
-    cv_mem->cv_zn[j] = N_VClone(tmpl);
+    if (cv_mem->cv_zn_data)
+    {
+      cv_mem->cv_zn[j] = N_VCloneEmpty(tmpl);
+      if (cv_mem->cv_zn[j])
+      {
+        N_VSetArrayPointer(cv_mem->cv_zn_data + j * cv_mem->cv_zn_length,
+                           cv_mem->cv_zn[j]);
+      }
+    }
+    else { cv_mem->cv_zn[j] = N_VClone(tmpl); }
+
     if (cv_mem->cv_zn[j] == NULL)
     {
       N_VDestroy(cv_mem->cv_ewt);
@@ -1898,6 +2102,8 @@ static sunbooleantype cvAllocVectors(CVodeMem cv_mem, N_Vector tmpl)
       N_VDestroy(cv_mem->cv_vtemp2);
       N_VDestroy(cv_mem->cv_vtemp3);
       for (i = 0; i < j; i++) { N_VDestroy(cv_mem->cv_zn[i]); }
+      free(cv_mem->cv_zn_data);
+      cv_mem->cv_zn_data = NULL;
       return (SUNFALSE);
     }
   }
@@ -1932,6 +2138,11 @@ static void cvFreeVectors(CVodeMem cv_mem)
   N_VDestroy(cv_mem->cv_vtemp2);
   N_VDestroy(cv_mem->cv_vtemp3);
   for (j = 0; j <= maxord; j++) { N_VDestroy(cv_mem->cv_zn[j]); }
+  if (cv_mem->cv_zn_data)
+  {
+    free(cv_mem->cv_zn_data);
+    cv_mem->cv_zn_data = NULL;
+  }
 
   cv_mem->cv_lrw -= (maxord + 8) * cv_mem->cv_lrw1;
   cv_mem->cv_liw -= (maxord + 8) * cv_mem->cv_liw1;
@@ -2330,6 +2541,9 @@ static int cvStep(CVodeMem cv_mem)
 
   ncf = npf = nef = 0;
 
+  /* Save the counters and start the clock for the telemetry record */
+  if (cv_mem->cv_telemetry) { cvTelemetryBeginStep(cv_mem); }
+
   /* If the step size has changed, update the history array */
   if ((cv_mem->cv_nst > 0) && (cv_mem->cv_hprime != cv_mem->cv_h))
   {
@@ -2364,7 +2578,13 @@ static int cvStep(CVodeMem cv_mem)
     cvPredict(cv_mem);
     cvSet(cv_mem);
 
-    nflag = cvNls(cv_mem, nflag);
+    if (cv_mem->cv_telemetry)
+    {
+      cv_mem->cv_tel_step.rec.wall_nls -= sunTelemetryWallTime();
+      nflag = cvNls(cv_mem, nflag);
+      cv_mem->cv_tel_step.rec.wall_nls += sunTelemetryWallTime();
+    }
+    else { nflag = cvNls(cv_mem, nflag); }
     kflag = cvHandleNFlag(cv_mem, &nflag, saved_t, &ncf);
 
     /* Go back in loop if we need to predict again (nflag=PREV_CONV_FAIL) */
@@ -2422,9 +2642,80 @@ static int cvStep(CVodeMem cv_mem)
 
   N_VScale(cv_mem->cv_tq[2], cv_mem->cv_acor, cv_mem->cv_acor);
 
+  if (cv_mem->cv_telemetry) { cvTelemetryEndStep(cv_mem, dsm); }
+
   return (CV_SUCCESS);
 }
 
+/*
+ * -----------------------------------------------------------------
+ * Telemetry functions
+ * -----------------------------------------------------------------
+ */
+
+/*
+ * cvTelemetryNumLinIters
+ *
+ * Returns the number of linear iterations if the CVLS interface is
+ * attached and zero otherwise.
+ */
+
+static long int cvTelemetryNumLinIters(CVodeMem cv_mem)
+{
+  if (cv_mem->cv_lmem == NULL || cv_mem->cv_linit != cvLsInitialize)
+  {
+    return 0;
+  }
+  return ((CVLsMem)cv_mem->cv_lmem)->nli;
+}
+
+/*
+ * cvTelemetryBeginStep
+ *
+ * This routine saves the solver counters and the wall clock time at
+ * the start of a step.
+ */
+
+static void cvTelemetryBeginStep(CVodeMem cv_mem)
+{
+  sunTelemetryStep* ts = &cv_mem->cv_tel_step;
+
+  memset(&ts->rec, 0, sizeof(ts->rec));
+  ts->nni     = cv_mem->cv_nni;
+  ts->nli     = cvTelemetryNumLinIters(cv_mem);
+  ts->netf    = cv_mem->cv_netf;
+  ts->ncfn    = cv_mem->cv_ncfn;
+  ts->nsetups = cv_mem->cv_nsetups;
+  ts->tic     = sunTelemetryWallTime();
+}
+
+/*
+ * cvTelemetryEndStep
+ *
+ * This routine completes the telemetry record of a successful step
+ * and stores it.
+ */
+
+static void cvTelemetryEndStep(CVodeMem cv_mem, sunrealtype dsm)
+{
+  sunTelemetryStep* ts    = &cv_mem->cv_tel_step;
+  SUNTelemetryRecord* rec = &ts->rec;
+
+  rec->wall_step  = sunTelemetryWallTime() - ts->tic;
+  rec->t          = (double)cv_mem->cv_tn;
+  rec->h          = (double)cv_mem->cv_hu;
+  rec->error_norm = (double)dsm;
+  rec->step       = cv_mem->cv_nst;
+  rec->order      = cv_mem->cv_qu;
+  rec->nni        = (int32_t)(cv_mem->cv_nni - ts->nni);
+  rec->nli        = (int32_t)(cvTelemetryNumLinIters(cv_mem) - ts->nli);
+  rec->netf       = (int32_t)(cv_mem->cv_netf - ts->netf);
+  rec->ncfn       = (int32_t)(cv_mem->cv_ncfn - ts->ncfn);
+  if (cv_mem->cv_nsetups != ts->nsetups) { rec->flags |= SUN_TELEMETRY_LSETUP; }
+
+  (void)SUNTelemetry_Record(cv_mem->cv_telemetry, rec);
+}
+
 /*
  * -----------------------------------------------------------------
  * Function called at beginning of step
@@ -2528,9 +2819,17 @@ static void cvAdjustAdams(CVodeMem cv_mem, int deltaq)
 
   if (cv_mem->cv_q > 2)
   {
-    (void)N_VScaleAddMulti(cv_mem->cv_q - 2, cv_mem->cv_cvals,
-                           cv_mem->cv_zn[cv_mem->cv_q], cv_mem->cv_zn + 2,
-                           cv_mem->cv_zn + 2);
+    if (cv_mem->cv_zn_data)
+    {
+      cvScaleAddHistoryContig(cv_mem, cv_mem->cv_q - 2, cv_mem->cv_cvals,
+                              cv_mem->cv_zn[cv_mem->cv_q], 2);
+    }
+    else
+    {
+      (void)N_VScaleAddMulti(cv_mem->cv_q - 2, cv_mem->cv_cvals,
+                             cv_mem->cv_zn[cv_mem->cv_q], cv_mem->cv_zn + 2,
+                             cv_mem->cv_zn + 2);
+    }
   }
 }
 
@@ -2595,9 +2894,17 @@ static void cvIncreaseBDF(CVodeMem cv_mem)
   /* for (j=2; j <= cv_mem->cv_q; j++) */
   if (cv_mem->cv_q > 1)
   {
-    (void)N_VScaleAddMulti(cv_mem->cv_q - 1, cv_mem->cv_l + 2,
-                           cv_mem->cv_zn[cv_mem->cv_L], cv_mem->cv_zn + 2,
-                           cv_mem->cv_zn + 2);
+    if (cv_mem->cv_zn_data)
+    {
+      cvScaleAddHistoryContig(cv_mem, cv_mem->cv_q - 1, cv_mem->cv_l + 2,
+                              cv_mem->cv_zn[cv_mem->cv_L], 2);
+    }
+    else
+    {
+      (void)N_VScaleAddMulti(cv_mem->cv_q - 1, cv_mem->cv_l + 2,
+                             cv_mem->cv_zn[cv_mem->cv_L], cv_mem->cv_zn + 2,
+                             cv_mem->cv_zn + 2);
+    }
   }
 }
 
@@ -2636,9 +2943,17 @@ static void cvDecreaseBDF(CVodeMem cv_mem)
 
   if (cv_mem->cv_q > 2)
   {
-    (void)N_VScaleAddMulti(cv_mem->cv_q - 2, cv_mem->cv_cvals,
-                           cv_mem->cv_zn[cv_mem->cv_q], cv_mem->cv_zn + 2,
-                           cv_mem->cv_zn + 2);
+    if (cv_mem->cv_zn_data)
+    {
+      cvScaleAddHistoryContig(cv_mem, cv_mem->cv_q - 2, cv_mem->cv_cvals,
+                              cv_mem->cv_zn[cv_mem->cv_q], 2);
+    }
+    else
+    {
+      (void)N_VScaleAddMulti(cv_mem->cv_q - 2, cv_mem->cv_cvals,
+                             cv_mem->cv_zn[cv_mem->cv_q], cv_mem->cv_zn + 2,
+                             cv_mem->cv_zn + 2);
+    }
   }
 }
 
@@ -2661,8 +2976,19 @@ void cvRescale(CVodeMem cv_mem)
     cv_mem->cv_cvals[j] = cv_mem->cv_eta * cv_mem->cv_cvals[j - 1];
   }
 
-  (void)N_VScaleVectorArray(cv_mem->cv_q, cv_mem->cv_cvals, cv_mem->cv_zn + 1,
-                            cv_mem->cv_zn + 1);
+#ifdef SUNDIALS_BUILD_PACKAGE_FUSED_KERNELS
+  if (cv_mem->cv_usefused)
+  {
+    cvRescale_fused(cv_mem->cv_q, cv_mem->cv_cvals, cv_mem->cv_zn);
+  }
+  else
+#endif
+  if (cv_mem->cv_zn_data) { cvRescaleContig(cv_mem); }
+  else
+  {
+    (void)N_VScaleVectorArray(cv_mem->cv_q, cv_mem->cv_cvals, cv_mem->cv_zn + 1,
+                              cv_mem->cv_zn + 1);
+  }
 
   cv_mem->cv_h      = cv_mem->cv_hscale * cv_mem->cv_eta;
   cv_mem->cv_next_h = cv_mem->cv_h;
@@ -2670,6 +2996,97 @@ void cvRescale(CVodeMem cv_mem)
   cv_mem->cv_nscon  = 0;
 }
 
+/*
+ * -----------------------------------------------------------------
+ * Contiguous history array functions
+ * -----------------------------------------------------------------
+ */
+
+/*
+ * cvHostHistorySupported
+ *
+ * This routine determines if the Nordsieck array can be stored in a
+ * single contiguous allocation i.e., if the vector data is a host
+ * array that can be attached to an empty clone of tmpl.
+ */
+
+static sunbooleantype cvHostHistorySupported(N_Vector tmpl)
+{
+  switch (N_VGetVectorID(tmpl))
+  {
+  case SUNDIALS_NVEC_SERIAL:
+  case SUNDIALS_NVEC_OPENMP:
+  case SUNDIALS_NVEC_PTHREADS:
+    return (tmpl->ops->nvcloneempty && tmpl->ops->nvsetarraypointer &&
+            N_VGetArrayPointer(tmpl));
+  default: return SUNFALSE;
+  }
+}
+
+/*
+ * cvContigHistoryData
+ *
+ * This routine loads the pointers to the blocks zn[jstart], ...,
+ * zn[jstart+nvec-1] of the contiguous Nordsieck array and returns
+ * the number of threads to use for the host loops.
+ */
+
+static int cvContigHistoryData(CVodeMem cv_mem, int jstart, int nvec,
+                               sunrealtype** znd)
+{
+  int j;
+  for (j = 0; j < nvec; j++)
+  {
+    znd[j] = cv_mem->cv_zn_data + (jstart + j) * cv_mem->cv_zn_length;
+  }
+  return cvFusedHostThreads(cv_mem->cv_zn[0]);
+}
+
+/*
+ * cvPredictContig
+ *
+ * This routine applies the prediction (sign = 1) or undoes the
+ * prediction (sign = -1) of the contiguous Nordsieck array.
+ */
+
+static void cvPredictContig(CVodeMem cv_mem, sunrealtype sign)
+{
+  sunrealtype* znd[L_MAX];
+  int nthreads = cvContigHistoryData(cv_mem, 0, cv_mem->cv_q + 1, znd);
+  cvFusedHostPredict(cv_mem->cv_q, sign, cv_mem->cv_zn_length, znd, nthreads);
+}
+
+/*
+ * cvRescaleContig
+ *
+ * This routine multiplies zn[j] by cvals[j-1] = eta^j, j = 1,...,q,
+ * in the contiguous Nordsieck array.
+ */
+
+static void cvRescaleContig(CVodeMem cv_mem)
+{
+  sunrealtype* znd[L_MAX];
+  int nthreads = cvContigHistoryData(cv_mem, 0, cv_mem->cv_q + 1, znd);
+  cvFusedHostRescale(cv_mem->cv_q, cv_mem->cv_cvals, cv_mem->cv_zn_length, znd,
+                     nthreads);
+}
+
+/*
+ * cvScaleAddHistoryContig
+ *
+ * This routine computes zn[jstart+k] += c[k] * x, k = 0,...,nvec-1,
+ * in the contiguous Nordsieck array with a single pass over x.
+ */
+
+static void cvScaleAddHistoryContig(CVodeMem cv_mem, int nvec, sunrealtype* c,
+                                    N_Vector x, int jstart)
+{
+  sunrealtype* znd[L_MAX];
+  int nthreads = cvContigHistoryData(cv_mem, jstart, nvec, znd);
+  cvFusedHostScaleAdd(nvec, c, N_VGetArrayPointer(x), cv_mem->cv_zn_length, znd,
+                      nthreads);
+}
+
 /*
  * cvPredict
  *
@@ -2693,12 +3110,20 @@ static void cvPredict(CVodeMem cv_mem)
     }
   }
 
-  for (k = 1; k <= cv_mem->cv_q; k++)
+#ifdef SUNDIALS_BUILD_PACKAGE_FUSED_KERNELS
+  if (cv_mem->cv_usefused) { cvPredict_fused(cv_mem->cv_q, cv_mem->cv_zn); }
+  else
+#endif
+  if (cv_mem->cv_zn_data) { cvPredictContig(cv_mem, ONE); }
+  else
   {
-    for (j = cv_mem->cv_q; j >= k; j--)
+    for (k = 1; k <= cv_mem->cv_q; k++)
     {
-      N_VLinearSum(ONE, cv_mem->cv_zn[j - 1], ONE, cv_mem->cv_zn[j],
-                   cv_mem->cv_zn[j - 1]);
+      for (j = cv_mem->cv_q; j >= k; j--)
+      {
+        N_VLinearSum(ONE, cv_mem->cv_zn[j - 1], ONE, cv_mem->cv_zn[j],
+                     cv_mem->cv_zn[j - 1]);
+      }
     }
   }
 
@@ -3245,12 +3670,20 @@ void cvRestore(CVodeMem cv_mem, sunrealtype saved_t)
   int j, k;
 
   cv_mem->cv_tn = saved_t;
-  for (k = 1; k <= cv_mem->cv_q; k++)
+#ifdef SUNDIALS_BUILD_PACKAGE_FUSED_KERNELS
+  if (cv_mem->cv_usefused) { cvRestore_fused(cv_mem->cv_q, cv_mem->cv_zn); }
+  else
+#endif
+  if (cv_mem->cv_zn_data) { cvPredictContig(cv_mem, -ONE); }
+  else
   {
-    for (j = cv_mem->cv_q; j >= k; j--)
+    for (k = 1; k <= cv_mem->cv_q; k++)
     {
-      N_VLinearSum(ONE, cv_mem->cv_zn[j - 1], -ONE, cv_mem->cv_zn[j],
-                   cv_mem->cv_zn[j - 1]);
+      for (j = cv_mem->cv_q; j >= k; j--)
+      {
+        N_VLinearSum(ONE, cv_mem->cv_zn[j - 1], -ONE, cv_mem->cv_zn[j],
+                     cv_mem->cv_zn[j - 1]);
+      }
     }
   }
 }
@@ -3421,15 +3854,39 @@ static void cvCompleteStep(CVodeMem cv_mem)
   cv_mem->cv_tau[1] = cv_mem->cv_h;
 
   /* Apply correction to column j of zn: l_j * Delta_n */
-  (void)N_VScaleAddMulti(cv_mem->cv_q + 1, cv_mem->cv_l, cv_mem->cv_acor,
-                         cv_mem->cv_zn, cv_mem->cv_zn);
+#ifdef SUNDIALS_BUILD_PACKAGE_FUSED_KERNELS
+  if (cv_mem->cv_usefused)
+  {
+    cvCorrect_fused(cv_mem->cv_q, cv_mem->cv_l, cv_mem->cv_acor, cv_mem->cv_zn);
+  }
+  else
+#endif
+  if (cv_mem->cv_zn_data)
+  {
+    cvScaleAddHistoryContig(cv_mem, cv_mem->cv_q + 1, cv_mem->cv_l,
+                            cv_mem->cv_acor, 0);
+  }
+  else
+  {
+    (void)N_VScaleAddMulti(cv_mem->cv_q + 1, cv_mem->cv_l, cv_mem->cv_acor,
+                           cv_mem->cv_zn, cv_mem->cv_zn);
+  }
 
   /* Apply the projection correction to column j of zn: p_j * Delta_n */
   if (cv_mem->proj_applied)
   {
-    (void)N_VScaleAddMulti(cv_mem->cv_q + 1, cv_mem->proj_p,
-                           cv_mem->cv_tempv, /* tempv = acorP */
-                           cv_mem->cv_zn, cv_mem->cv_zn);
+    if (cv_mem->cv_zn_data)
+    {
+      cvScaleAddHistoryContig(cv_mem, cv_mem->cv_q + 1, cv_mem->proj_p,
+                              cv_mem->cv_tempv, /* tempv = acorP */
+                              0);
+    }
+    else
+    {
+      (void)N_VScaleAddMulti(cv_mem->cv_q + 1, cv_mem->proj_p,
+                             cv_mem->cv_tempv, /* tempv = acorP */
+                             cv_mem->cv_zn, cv_mem->cv_zn);
+    }
   }
 
   cv_mem->cv_qwait--;
@@ -4416,6 +4873,19 @@ static int cvRcheck3(CVodeMem cv_mem)
  * gfun     = user-defined function for g(t).  Its form is
  *            (void) gfun(t, y, gt, user_data)
  *
+ * gpart    = optional user-defined function for a subset of g(t).
+ *            Its form is (void) gpart(t, y, ncand, cand, gt, user_data)
+ *            and it sets gt[cand[j]] for j = 0, ..., ncand-1.  If
+ *            gpart is supplied, only the components of g with a sign
+ *            change (or a zero) in the interval are evaluated during
+ *            the search and candidates are dropped as the interval
+ *            shrinks, so the cost of an iteration scales with the
+ *            number of crossings rather than nrtfn.
+ *
+ * rootiqi  = flag to use inverse quadratic interpolation in place of
+ *            the secant step when the previous two iterates bracket
+ *            the root from opposite sides.
+ *
  * rootdir  = in array specifying the direction of zero-crossings.
  *            If rootdir[i] > 0, search for roots of g_i only if
  *            g_i is increasing; if rootdir[i] < 0, search for
@@ -4474,23 +4944,33 @@ static int cvRcheck3(CVodeMem cv_mem)
 static int cvRootfind(CVodeMem cv_mem)
 {
   sunrealtype alph, tmid, gfrac, maxfrac, fracint, fracsub;
-  int i, retval, imax, side, sideprev;
-  sunbooleantype zroot, sgnchg;
-
-  imax = 0;
-
-  /* First check for change in sign in ghi or for a zero in ghi. */
+  sunrealtype tiqi, ga, gb, tc, gc;
+  int i, j, k, retval, imax, ic, ncand, side, sideprev;
+  int* cand;
+  sunbooleantype zroot, sgnchg, partial;
+
+  imax    = 0;
+  cand    = cv_mem->cv_rcand;
+  partial = (cv_mem->cv_gpart != NULL);
+
+  /* First check for change in sign in ghi or for a zero in ghi.
+     Record the candidate components for the root search. With a partial
+     g function these are only the components that change sign or are zero,
+     otherwise all components are candidates. */
   maxfrac = ZERO;
   zroot   = SUNFALSE;
   sgnchg  = SUNFALSE;
+  ncand   = 0;
   for (i = 0; i < cv_mem->cv_nrtfn; i++)
   {
+    if (!partial) { cand[ncand++] = i; }
     if (!cv_mem->cv_gactive[i]) { continue; }
     if (SUNRabs(cv_mem->cv_ghi[i]) == ZERO)
     {
       if (cv_mem->cv_rootdir[i] * cv_mem->cv_glo[i] <= ZERO)
       {
         zroot = SUNTRUE;
+        if (partial) { cand[ncand++] = i; }
       }
     }
     else
@@ -4498,6 +4978,7 @@ static int cvRootfind(CVodeMem cv_mem)
       if ((DIFFERENT_SIGN(cv_mem->cv_glo[i], cv_mem->cv_ghi[i])) &&
           (cv_mem->cv_rootdir[i] * cv_mem->cv_glo[i] <= ZERO))
       {
+        if (partial) { cand[ncand++] = i; }
         gfrac =
           SUNRabs(cv_mem->cv_ghi[i] / (cv_mem->cv_ghi[i] - cv_mem->cv_glo[i]));
         if (gfrac > maxfrac)
@@ -4533,8 +5014,13 @@ static int cvRootfind(CVodeMem cv_mem)
     return (RTFOUND);
   }
 
-  /* Initialize alph to avoid compiler warning */
+  /* Initialize alph, tc, and gc to avoid compiler warnings. The point
+     (tc, gc) is the last discarded endpoint for component ic and is used
+     with inverse quadratic interpolation. */
   alph = ONE;
+  tc   = cv_mem->cv_thi;
+  gc   = ZERO;
+  ic   = -1;
 
   /* A sign change was found.  Loop to locate nearest root. */
 
@@ -4565,6 +5051,27 @@ static int cvRootfind(CVodeMem cv_mem)
     tmid = cv_mem->cv_thi -
            (cv_mem->cv_thi - cv_mem->cv_tlo) * cv_mem->cv_ghi[imax] /
              (cv_mem->cv_ghi[imax] - alph * cv_mem->cv_glo[imax]);
+
+    /* If enabled, replace the secant value with the inverse quadratic
+       interpolant through tlo, thi, and tc when the last two passes were on
+       opposite sides and the result lies inside (tlo,thi). Otherwise the
+       Illinois weighting above guards against slow one-sided convergence. */
+    if (cv_mem->cv_rootiqi && ic == imax && alph == ONE)
+    {
+      ga = cv_mem->cv_glo[imax];
+      gb = cv_mem->cv_ghi[imax];
+      if (ga != gc && gb != gc)
+      {
+        tiqi = cv_mem->cv_tlo * gb * gc / ((ga - gb) * (ga - gc)) +
+               cv_mem->cv_thi * ga * gc / ((gb - ga) * (gb - gc)) +
+               tc * ga * gb / ((gc - ga) * (gc - gb));
+        if ((tiqi - cv_mem->cv_tlo) * (cv_mem->cv_thi - tiqi) > ZERO)
+        {
+          tmid = tiqi;
+        }
+      }
+    }
+
     if (SUNRabs(tmid - cv_mem->cv_tlo) < HALF * cv_mem->cv_ttol)
     {
       fracint = SUNRabs(cv_mem->cv_thi - cv_mem->cv_tlo) / cv_mem->cv_ttol;
@@ -4579,8 +5086,16 @@ static int cvRootfind(CVodeMem cv_mem)
     }
 
     (void)CVodeGetDky(cv_mem, tmid, 0, cv_mem->cv_y);
-    retval = cv_mem->cv_gfun(tmid, cv_mem->cv_y, cv_mem->cv_grout,
-                             cv_mem->cv_user_data);
+    if (partial)
+    {
+      retval = cv_mem->cv_gpart(tmid, cv_mem->cv_y, ncand, cand,
+                                cv_mem->cv_grout, cv_mem->cv_user_data);
+    }
+    else
+    {
+      retval = cv_mem->cv_gfun(tmid, cv_mem->cv_y, cv_mem->cv_grout,
+                               cv_mem->cv_user_data);
+    }
     cv_mem->cv_nge++;
     if (retval != 0) { return (CV_RTFUNC_FAIL); }
 
@@ -4590,8 +5105,9 @@ static int cvRootfind(CVodeMem cv_mem)
     zroot    = SUNFALSE;
     sgnchg   = SUNFALSE;
     sideprev = side;
-    for (i = 0; i < cv_mem->cv_nrtfn; i++)
+    for (j = 0; j < ncand; j++)
     {
+      i = cand[j];
       if (!cv_mem->cv_gactive[i]) { continue; }
       if (SUNRabs(cv_mem->cv_grout[i]) == ZERO)
       {
@@ -4618,13 +5134,25 @@ static int cvRootfind(CVodeMem cv_mem)
     }
     if (sgnchg)
     {
-      /* Sign change found in (tlo,tmid); replace thi with tmid. */
+      /* Sign change found in (tlo,tmid); replace thi with tmid. With a
+         partial g function, drop the candidates whose sign change is in
+         (tmid,thi) since they cannot have the nearest root. */
+      tc = cv_mem->cv_thi;
+      gc = cv_mem->cv_ghi[imax];
+      ic = imax;
       cv_mem->cv_thi = tmid;
-      for (i = 0; i < cv_mem->cv_nrtfn; i++)
+      for (j = 0, k = 0; j < ncand; j++)
       {
+        i                 = cand[j];
         cv_mem->cv_ghi[i] = cv_mem->cv_grout[i];
+        if (!partial || SUNRabs(cv_mem->cv_ghi[i]) == ZERO ||
+            DIFFERENT_SIGN(cv_mem->cv_glo[i], cv_mem->cv_ghi[i]))
+        {
+          cand[k++] = i;
+        }
       }
-      side = 1;
+      ncand = k;
+      side  = 1;
       /* Stop at root thi if converged; otherwise loop. */
       if (SUNRabs(cv_mem->cv_thi - cv_mem->cv_tlo) <= cv_mem->cv_ttol)
       {
@@ -4637,8 +5165,9 @@ static int cvRootfind(CVodeMem cv_mem)
     {
       /* No sign change in (tlo,tmid), but g = 0 at tmid; return root tmid. */
       cv_mem->cv_thi = tmid;
-      for (i = 0; i < cv_mem->cv_nrtfn; i++)
+      for (j = 0; j < ncand; j++)
       {
+        i                 = cand[j];
         cv_mem->cv_ghi[i] = cv_mem->cv_grout[i];
       }
       break;
@@ -4646,9 +5175,13 @@ static int cvRootfind(CVodeMem cv_mem)
 
     /* No sign change in (tlo,tmid), and no zero at tmid.
        Sign change must be in (tmid,thi).  Replace tlo with tmid. */
+    tc = cv_mem->cv_tlo;
+    gc = cv_mem->cv_glo[imax];
+    ic = imax;
     cv_mem->cv_tlo = tmid;
-    for (i = 0; i < cv_mem->cv_nrtfn; i++)
+    for (j = 0; j < ncand; j++)
     {
+      i                 = cand[j];
       cv_mem->cv_glo[i] = cv_mem->cv_grout[i];
     }
     side = 2;
@@ -4657,7 +5190,9 @@ static int cvRootfind(CVodeMem cv_mem)
 
   } /* End of root-search loop */
 
-  /* Reset trout and grout, set iroots, and return RTFOUND. */
+  /* Reset trout and grout, set iroots, and return RTFOUND. Components that
+     were not candidates keep their values at the initial thi, which have the
+     same sign as their values at trout. */
   cv_mem->cv_trout = cv_mem->cv_thi;
   for (i = 0; i < cv_mem->cv_nrtfn; i++)
   {
@@ -4735,13 +5270,11 @@ static int cvEwtSetSS(CVodeMem cv_mem, N_Vector ycur, N_Vector weight)
 #ifdef SUNDIALS_BUILD_PACKAGE_FUSED_KERNELS
   if (cv_mem->cv_usefused)
   {
-    /* We compute weight (inverse of tempv) regardless of the component test
-       since it will be thrown away in this case anyways. */
-    cvEwtSetSS_fused(cv_mem->cv_atolmin0, cv_mem->cv_reltol, cv_mem->cv_Sabstol,
-                     ycur, cv_mem->cv_tempv, weight);
-    if (cv_mem->cv_atolmin0)
+    /* The fused kernel tests for non-positive components when needed */
+    if (cvEwtSetSS_fused(cv_mem->cv_atolmin0, cv_mem->cv_reltol, cv_mem->cv_Sabstol,
+                         ycur, cv_mem->cv_tempv, weight))
     {
-      if (N_VMin(cv_mem->cv_tempv) <= ZERO) return (-1);
+      return (-1);
     }
   }
   else
@@ -4775,13 +5308,11 @@ static int cvEwtSetSV(CVodeMem cv_mem, N_Vector ycur, N_Vector weight)
 #ifdef SUNDIALS_BUILD_PACKAGE_FUSED_KERNELS
   if (cv_mem->cv_usefused)
   {
-    /* We compute weight (inverse of tempv) regardless of the component test
-       since it will be thrown away in this case anyways. */
-    cvEwtSetSV_fused(cv_mem->cv_atolmin0, cv_mem->cv_reltol, cv_mem->cv_Vabstol,
-                     ycur, cv_mem->cv_tempv, weight);
-    if (cv_mem->cv_atolmin0)
+    /* The fused kernel tests for non-positive components when needed */
+    if (cvEwtSetSV_fused(cv_mem->cv_atolmin0, cv_mem->cv_reltol, cv_mem->cv_Vabstol,
+                         ycur, cv_mem->cv_tempv, weight))
     {
-      if (N_VMin(cv_mem->cv_tempv) <= ZERO) return (-1);
+      return (-1);
     }
   }
   else
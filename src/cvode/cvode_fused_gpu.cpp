@@ -46,6 +46,21 @@ constexpr auto gpuAssert            = SUNDIALS_HIP_Assert;
 #error Incompatible GPU option for fused kernels
 #endif
 
+#include "cvode_impl.h"
+
+/*
+ * -----------------------------------------------------------------
+ * Check if the fused kernels support the given vector.
+ * -----------------------------------------------------------------
+ */
+
+extern "C" sunbooleantype cvFusedKernelsSupported(N_Vector v)
+{
+  const N_Vector_ID id = N_VGetVectorID(v);
+  return (id == SUNDIALS_NVEC_CUDA || id == SUNDIALS_NVEC_HIP) ? SUNTRUE
+                                                               : SUNFALSE;
+}
+
 /*
  * -----------------------------------------------------------------
  * Compute the ewt vector when the tol type is CV_SS.
@@ -93,6 +108,12 @@ extern "C" int cvEwtSetSS_fused(const sunbooleantype atolMin0,
   if (!gpuAssert(gpuGetLastError(), __FILE__, __LINE__)) return -1;
 #endif
 
+  /* Test for non-positive components */
+  if (atolMin0)
+  {
+    if (N_VMin(tempv) <= 0.0) { return -1; }
+  }
+
   return 0;
 }
 
@@ -144,6 +165,12 @@ extern "C" int cvEwtSetSV_fused(const sunbooleantype atolMin0,
   if (!gpuAssert(gpuGetLastError(), __FILE__, __LINE__)) return -1;
 #endif
 
+  /* Test for non-positive components */
+  if (atolMin0)
+  {
+    if (N_VMin(tempv) <= 0.0) { return -1; }
+  }
+
   return 0;
 }
 
@@ -404,3 +431,146 @@ extern "C" int cvDiagSolve_updateM(const sunrealtype r, N_Vector M)
 
   return 0;
 }
+
+/*
+ * -----------------------------------------------------------------
+ * Nordsieck array updates. The data pointers for zn[0],...,zn[q]
+ * are passed to the kernels by value.
+ * -----------------------------------------------------------------
+ */
+
+struct cvNordsieckPtrs
+{
+  sunrealtype* zn[L_MAX];
+};
+
+static cvNordsieckPtrs cvNordsieckDevicePtrs(const int q, N_Vector* zn)
+{
+  cvNordsieckPtrs ptrs;
+  for (int j = 0; j <= q; j++) { ptrs.zn[j] = N_VGetDeviceArrayPointer(zn[j]); }
+  return ptrs;
+}
+
+__global__ void cvPredict_kernel(const sunindextype length, const int q,
+                                 const sunrealtype sign, cvNordsieckPtrs ptrs)
+{
+  GRID_STRIDE_XLOOP(sunindextype, i, length)
+  {
+    // for (k = 1; k <= q; k++)
+    //   for (j = q; j >= k; j--)
+    //     N_VLinearSum(ONE, zn[j - 1], sign, zn[j], zn[j - 1]);
+    sunrealtype z[L_MAX];
+    for (int j = 0; j <= q; j++) { z[j] = ptrs.zn[j][i]; }
+    for (int k = 1; k <= q; k++)
+    {
+      for (int j = q; j >= k; j--) { z[j - 1] += sign * z[j]; }
+    }
+    for (int j = 0; j < q; j++) { ptrs.zn[j][i] = z[j]; }
+  }
+}
+
+static int cvPredictRestore(const int q, const sunrealtype sign, N_Vector* zn)
+{
+  const SUNExecPolicy* exec_policy =
+    ((NVectorContent)zn[0]->content)->stream_exec_policy;
+  const sunindextype N = N_VGetLength(zn[0]);
+  size_t block         = exec_policy->blockSize(N);
+  size_t grid          = exec_policy->gridSize(N);
+
+  cvPredict_kernel<<<grid, block, 0,
+                     *(exec_policy->stream())>>>(N, q, sign,
+                                                 cvNordsieckDevicePtrs(q, zn));
+
+#ifdef SUNDIALS_DEBUG_GPU_LASTERROR
+  gpuDeviceSynchronize();
+  if (!gpuAssert(gpuGetLastError(), __FILE__, __LINE__)) return -1;
+#endif
+
+  return 0;
+}
+
+extern "C" int cvPredict_fused(const int q, N_Vector* zn)
+{
+  return cvPredictRestore(q, 1.0, zn);
+}
+
+extern "C" int cvRestore_fused(const int q, N_Vector* zn)
+{
+  return cvPredictRestore(q, -1.0, zn);
+}
+
+struct cvNordsieckCoeffs
+{
+  sunrealtype c[L_MAX];
+};
+
+__global__ void cvRescale_kernel(const sunindextype length, const int q,
+                                 cvNordsieckCoeffs cvals, cvNordsieckPtrs ptrs)
+{
+  GRID_STRIDE_XLOOP(sunindextype, i, length)
+  {
+    // N_VScaleVectorArray(q, cvals, zn + 1, zn + 1);
+    for (int j = 1; j <= q; j++) { ptrs.zn[j][i] *= cvals.c[j - 1]; }
+  }
+}
+
+extern "C" int cvRescale_fused(const int q, sunrealtype* cvals,
+                               N_Vector* zn)
+{
+  const SUNExecPolicy* exec_policy =
+    ((NVectorContent)zn[0]->content)->stream_exec_policy;
+  const sunindextype N = N_VGetLength(zn[0]);
+  size_t block         = exec_policy->blockSize(N);
+  size_t grid          = exec_policy->gridSize(N);
+
+  cvNordsieckCoeffs coeffs;
+  for (int j = 0; j < q; j++) { coeffs.c[j] = cvals[j]; }
+
+  cvRescale_kernel<<<grid, block, 0,
+                     *(exec_policy->stream())>>>(N, q, coeffs,
+                                                 cvNordsieckDevicePtrs(q, zn));
+
+#ifdef SUNDIALS_DEBUG_GPU_LASTERROR
+  gpuDeviceSynchronize();
+  if (!gpuAssert(gpuGetLastError(), __FILE__, __LINE__)) return -1;
+#endif
+
+  return 0;
+}
+
+__global__ void cvCorrect_kernel(const sunindextype length, const int q,
+                                 cvNordsieckCoeffs l, const sunrealtype* acor,
+                                 cvNordsieckPtrs ptrs)
+{
+  GRID_STRIDE_XLOOP(sunindextype, i, length)
+  {
+    // N_VScaleAddMulti(q + 1, l, acor, zn, zn);
+    const sunrealtype a = acor[i];
+    for (int j = 0; j <= q; j++) { ptrs.zn[j][i] += l.c[j] * a; }
+  }
+}
+
+extern "C" int cvCorrect_fused(const int q, sunrealtype* l,
+                               const N_Vector acor, N_Vector* zn)
+{
+  const SUNExecPolicy* exec_policy =
+    ((NVectorContent)zn[0]->content)->stream_exec_policy;
+  const sunindextype N = N_VGetLength(zn[0]);
+  size_t block         = exec_policy->blockSize(N);
+  size_t grid          = exec_policy->gridSize(N);
+
+  cvNordsieckCoeffs coeffs;
+  for (int j = 0; j <= q; j++) { coeffs.c[j] = l[j]; }
+
+  cvCorrect_kernel<<<grid, block, 0,
+                     *(exec_policy->stream())>>>(N, q, coeffs,
+                                                 N_VGetDeviceArrayPointer(acor),
+                                                 cvNordsieckDevicePtrs(q, zn));
+
+#ifdef SUNDIALS_DEBUG_GPU_LASTERROR
+  gpuDeviceSynchronize();
+  if (!gpuAssert(gpuGetLastError(), __FILE__, __LINE__)) return -1;
+#endif
+
+  return 0;
+}
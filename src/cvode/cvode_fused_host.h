@@ -0,0 +1,137 @@
+/*
+ * -----------------------------------------------------------------
+ * Programmer(s): Cody J. Balos @ LLNL
+ * -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * Host loops for the CVODE Nordsieck array updates. These are used
+ * by the fused host kernels and by the contiguous history storage.
+ * Each loop loads the q+1 history values of a component once,
+ * applies the update in registers, and stores the result. The loops
+ * are threaded with OpenMP when it is enabled.
+ * -----------------------------------------------------------------
+ */
+
+#ifndef _CVODE_FUSED_HOST_H
+#define _CVODE_FUSED_HOST_H
+
+#include <nvector/nvector_openmp.h>
+
+#include "cvode_impl.h"
+
+/* OpenMP work sharing with nthr threads for the host loops (without OpenMP
+   the loops are serial and the thread count is unused) */
+#if defined(_OPENMP)
+#define CV_FUSED_PRAGMA(x) _Pragma(#x)
+#define CV_FUSED_OMP_FOR(nthr)                                        \
+  CV_FUSED_PRAGMA(omp parallel for schedule(static) num_threads(nthr) \
+                    if (nthr > 1))
+#define CV_FUSED_OMP_FOR_MIN(nthr, var)                               \
+  CV_FUSED_PRAGMA(omp parallel for schedule(static) num_threads(nthr) \
+                    if (nthr > 1) reduction(min : var))
+#else
+#define CV_FUSED_OMP_FOR(nthr)          (void)(nthr);
+#define CV_FUSED_OMP_FOR_MIN(nthr, var) (void)(nthr);
+#endif
+
+/*
+ * -----------------------------------------------------------------
+ * Determine the number of threads to use with a vector. Returns 0
+ * if the vector data is not available as a contiguous host array.
+ * -----------------------------------------------------------------
+ */
+
+static inline int cvFusedHostThreads(N_Vector v)
+{
+  switch (N_VGetVectorID(v))
+  {
+  case SUNDIALS_NVEC_SERIAL:
+  case SUNDIALS_NVEC_PTHREADS:
+    return (N_VGetArrayPointer(v) != NULL) ? 1 : 0;
+  case SUNDIALS_NVEC_OPENMP:
+    return (NV_DATA_OMP(v) != NULL) ? SUNMAX(NV_NUM_THREADS_OMP(v), 1) : 0;
+  default: return 0;
+  }
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Apply the prediction (sign = 1) or undo the prediction (sign = -1)
+ * of the Nordsieck array znd[0], ..., znd[q] by repeated additions
+ * (multiplication by the Pascal triangle matrix).
+ * -----------------------------------------------------------------
+ */
+
+static inline void cvFusedHostPredict(const int q, const sunrealtype sign,
+                                      const sunindextype N, sunrealtype** znd,
+                                      const int nthreads)
+{
+  sunindextype i;
+
+  CV_FUSED_OMP_FOR(nthreads)
+  for (i = 0; i < N; i++)
+  {
+    sunrealtype z[L_MAX];
+    int jj, kk;
+    for (jj = 0; jj <= q; jj++) { z[jj] = znd[jj][i]; }
+    for (kk = 1; kk <= q; kk++)
+    {
+      for (jj = q; jj >= kk; jj--) { z[jj - 1] += sign * z[jj]; }
+    }
+    for (jj = 0; jj < q; jj++) { znd[jj][i] = z[jj]; }
+  }
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Rescale the Nordsieck array, znd[j] = eta^j znd[j] for j = 1,...,q,
+ * with the scaling factors eta^j stored in cvals[j-1].
+ * -----------------------------------------------------------------
+ */
+
+static inline void cvFusedHostRescale(const int q, const sunrealtype* cvals,
+                                      const sunindextype N, sunrealtype** znd,
+                                      const int nthreads)
+{
+  sunindextype i;
+
+  CV_FUSED_OMP_FOR(nthreads)
+  for (i = 0; i < N; i++)
+  {
+    int jj;
+    for (jj = 1; jj <= q; jj++) { znd[jj][i] *= cvals[jj - 1]; }
+  }
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Update nvec history vectors with a single pass over x,
+ * znd[k] += c[k] * x for k = 0,...,nvec-1.
+ * -----------------------------------------------------------------
+ */
+
+static inline void cvFusedHostScaleAdd(const int nvec, const sunrealtype* c,
+                                       const sunrealtype* xd,
+                                       const sunindextype N, sunrealtype** znd,
+                                       const int nthreads)
+{
+  sunindextype i;
+
+  CV_FUSED_OMP_FOR(nthreads)
+  for (i = 0; i < N; i++)
+  {
+    sunrealtype a = xd[i];
+    int kk;
+    for (kk = 0; kk < nvec; kk++) { znd[kk][i] += c[kk] * a; }
+  }
+}
+
+#endif
@@ -12,11 +12,16 @@
  * SPDX-License-Identifier: BSD-3-Clause
  * SUNDIALS Copyright End
  * -----------------------------------------------------------------
- * This file implements fused stub kernels for CVODE.
+ * This file implements fused host kernels for CVODE. When the
+ * vectors store their data in a contiguous host array (serial,
+ * OpenMP, and Pthreads vectors) each kernel makes a single pass
+ * over the data, otherwise the kernels fall back to a sequence of
+ * generic N_Vector operations.
  * -----------------------------------------------------------------
  */
 
 #include "cvode_diag_impl.h"
+#include "cvode_fused_host.h"
 #include "cvode_impl.h"
 #include "sundials_macros.h"
 
@@ -26,6 +31,17 @@
 #define ONEPT5 SUN_RCONST(1.50)
 #define ONE    SUN_RCONST(1.0)
 
+/*
+ * -----------------------------------------------------------------
+ * Check if the fused kernels support the given vector.
+ * -----------------------------------------------------------------
+ */
+
+sunbooleantype cvFusedKernelsSupported(N_Vector v)
+{
+  return (cvFusedHostThreads(v) > 0) ? SUNTRUE : SUNFALSE;
+}
+
 /*
  * -----------------------------------------------------------------
  * Compute the ewt vector when the tol type is CV_SS.
@@ -36,14 +52,40 @@ int cvEwtSetSS_fused(const sunbooleantype atolmin0, const sunrealtype reltol,
                      const sunrealtype Sabstol, const N_Vector ycur,
                      N_Vector tempv, N_Vector weight)
 {
-  N_VAbs(ycur, tempv);
-  N_VScale(reltol, tempv, tempv);
-  N_VAddConst(tempv, Sabstol, tempv);
-  if (atolmin0)
+  sunindextype i, N;
+  sunrealtype *yd, *td, *wd, tmin;
+  int nthreads = cvFusedHostThreads(weight);
+
+  if (nthreads == 0)
   {
-    if (N_VMin(tempv) <= ZERO) { return (-1); }
+    N_VAbs(ycur, tempv);
+    N_VScale(reltol, tempv, tempv);
+    N_VAddConst(tempv, Sabstol, tempv);
+    if (atolmin0)
+    {
+      if (N_VMin(tempv) <= ZERO) { return (-1); }
+    }
+    N_VInv(tempv, weight);
+    return 0;
   }
-  N_VInv(tempv, weight);
+
+  N    = N_VGetLength(weight);
+  yd   = N_VGetArrayPointer(ycur);
+  td   = N_VGetArrayPointer(tempv);
+  wd   = N_VGetArrayPointer(weight);
+  tmin = ONE;
+
+  /* We compute weight (inverse of tempv) regardless of the component test
+     since it will be thrown away in this case anyways. */
+  CV_FUSED_OMP_FOR_MIN(nthreads, tmin)
+  for (i = 0; i < N; i++)
+  {
+    td[i] = reltol * SUNRabs(yd[i]) + Sabstol;
+    wd[i] = ONE / td[i];
+    tmin  = SUNMIN(tmin, td[i]);
+  }
+
+  if (atolmin0 && tmin <= ZERO) { return (-1); }
   return 0;
 }
 
@@ -57,13 +99,38 @@ int cvEwtSetSV_fused(const sunbooleantype atolmin0, const sunrealtype reltol,
                      const N_Vector Vabstol, const N_Vector ycur,
                      N_Vector tempv, N_Vector weight)
 {
-  N_VAbs(ycur, tempv);
-  N_VLinearSum(reltol, tempv, ONE, Vabstol, tempv);
-  if (atolmin0)
+  sunindextype i, N;
+  sunrealtype *ad, *yd, *td, *wd, tmin;
+  int nthreads = cvFusedHostThreads(weight);
+
+  if (nthreads == 0)
   {
-    if (N_VMin(tempv) <= ZERO) { return (-1); }
+    N_VAbs(ycur, tempv);
+    N_VLinearSum(reltol, tempv, ONE, Vabstol, tempv);
+    if (atolmin0)
+    {
+      if (N_VMin(tempv) <= ZERO) { return (-1); }
+    }
+    N_VInv(tempv, weight);
+    return 0;
   }
-  N_VInv(tempv, weight);
+
+  N    = N_VGetLength(weight);
+  ad   = N_VGetArrayPointer(Vabstol);
+  yd   = N_VGetArrayPointer(ycur);
+  td   = N_VGetArrayPointer(tempv);
+  wd   = N_VGetArrayPointer(weight);
+  tmin = ONE;
+
+  CV_FUSED_OMP_FOR_MIN(nthreads, tmin)
+  for (i = 0; i < N; i++)
+  {
+    td[i] = reltol * SUNRabs(yd[i]) + ad[i];
+    wd[i] = ONE / td[i];
+    tmin  = SUNMIN(tmin, td[i]);
+  }
+
+  if (atolmin0 && tmin <= ZERO) { return (-1); }
   return 0;
 }
 
@@ -77,11 +144,35 @@ int cvEwtSetSV_fused(const sunbooleantype atolmin0, const sunrealtype reltol,
 int cvCheckConstraints_fused(const N_Vector c, const N_Vector ewt,
                              const N_Vector y, const N_Vector mm, N_Vector tmp)
 {
-  N_VCompare(ONEPT5, c, tmp);           /* a[i]=1 when |c[i]|=2  */
-  N_VProd(tmp, c, tmp);                 /* a * c                 */
-  N_VDiv(tmp, ewt, tmp);                /* a * c * wt            */
-  N_VLinearSum(ONE, y, -PT1, tmp, tmp); /* y - 0.1 * a * c * wt  */
-  N_VProd(tmp, mm, tmp);                /* v = mm*(y-0.1*a*c*wt) */
+  sunindextype i, N;
+  sunrealtype *cd, *ed, *yd, *md, *td;
+  int nthreads = cvFusedHostThreads(tmp);
+
+  if (nthreads == 0)
+  {
+    N_VCompare(ONEPT5, c, tmp);           /* a[i]=1 when |c[i]|=2  */
+    N_VProd(tmp, c, tmp);                 /* a * c                 */
+    N_VDiv(tmp, ewt, tmp);                /* a * c * wt            */
+    N_VLinearSum(ONE, y, -PT1, tmp, tmp); /* y - 0.1 * a * c * wt  */
+    N_VProd(tmp, mm, tmp);                /* v = mm*(y-0.1*a*c*wt) */
+    return 0;
+  }
+
+  N  = N_VGetLength(tmp);
+  cd = N_VGetArrayPointer(c);
+  ed = N_VGetArrayPointer(ewt);
+  yd = N_VGetArrayPointer(y);
+  md = N_VGetArrayPointer(mm);
+  td = N_VGetArrayPointer(tmp);
+
+  CV_FUSED_OMP_FOR(nthreads)
+  for (i = 0; i < N; i++)
+  {
+    /* a[i] = 1 when |c[i]| = 2 */
+    sunrealtype a = (SUNRabs(cd[i]) >= ONEPT5) ? ONE : ZERO;
+    td[i]         = (yd[i] - PT1 * (a * cd[i] / ed[i])) * md[i];
+  }
+
   return 0;
 }
 
@@ -95,8 +186,26 @@ int cvNlsResid_fused(const sunrealtype rl1, const sunrealtype ngamma,
                      const N_Vector zn1, const N_Vector ycor,
                      const N_Vector ftemp, N_Vector res)
 {
-  N_VLinearSum(rl1, zn1, ONE, ycor, res);
-  N_VLinearSum(ngamma, ftemp, ONE, res, res);
+  sunindextype i, N;
+  sunrealtype *zd, *yd, *fd, *rd;
+  int nthreads = cvFusedHostThreads(res);
+
+  if (nthreads == 0)
+  {
+    N_VLinearSum(rl1, zn1, ONE, ycor, res);
+    N_VLinearSum(ngamma, ftemp, ONE, res, res);
+    return 0;
+  }
+
+  N  = N_VGetLength(res);
+  zd = N_VGetArrayPointer(zn1);
+  yd = N_VGetArrayPointer(ycor);
+  fd = N_VGetArrayPointer(ftemp);
+  rd = N_VGetArrayPointer(res);
+
+  CV_FUSED_OMP_FOR(nthreads)
+  for (i = 0; i < N; i++) { rd[i] = ngamma * fd[i] + (rl1 * zd[i] + yd[i]); }
+
   return 0;
 }
 
@@ -110,8 +219,31 @@ int cvDiagSetup_formY(const sunrealtype h, const sunrealtype r,
                       const N_Vector fpred, const N_Vector zn1,
                       const N_Vector ypred, N_Vector ftemp, N_Vector y)
 {
-  N_VLinearSum(h, fpred, -ONE, zn1, ftemp);
-  N_VLinearSum(r, ftemp, ONE, ypred, y);
+  sunindextype i, N;
+  sunrealtype *fpd, *zd, *ypd, *ftd, *yd;
+  int nthreads = cvFusedHostThreads(y);
+
+  if (nthreads == 0)
+  {
+    N_VLinearSum(h, fpred, -ONE, zn1, ftemp);
+    N_VLinearSum(r, ftemp, ONE, ypred, y);
+    return 0;
+  }
+
+  N   = N_VGetLength(y);
+  fpd = N_VGetArrayPointer(fpred);
+  zd  = N_VGetArrayPointer(zn1);
+  ypd = N_VGetArrayPointer(ypred);
+  ftd = N_VGetArrayPointer(ftemp);
+  yd  = N_VGetArrayPointer(y);
+
+  CV_FUSED_OMP_FOR(nthreads)
+  for (i = 0; i < N; i++)
+  {
+    ftd[i] = h * fpd[i] - zd[i];
+    yd[i]  = r * ftd[i] + ypd[i];
+  }
+
   return 0;
 }
 
@@ -128,17 +260,46 @@ int cvDiagSetup_buildM(SUNDIALS_MAYBE_UNUSED const sunrealtype fract,
                        const N_Vector ewt, N_Vector bit, N_Vector bitcomp,
                        N_Vector y, N_Vector M)
 {
-  N_VLinearSum(ONE, M, -ONE, fpred, M);
-  N_VLinearSum(FRACT, ftemp, -h, M, M);
-  N_VProd(ftemp, ewt, y);
-  /* Protect against deltay_i being at roundoff level */
-  N_VCompare(uround, y, bit);
-  N_VAddConst(bit, -ONE, bitcomp);
-  N_VProd(ftemp, bit, y);
-  N_VLinearSum(FRACT, y, -ONE, bitcomp, y);
-  N_VDiv(M, y, M);
-  N_VProd(M, bit, M);
-  N_VLinearSum(ONE, M, -ONE, bitcomp, M);
+  sunindextype i, N;
+  sunrealtype *ftd, *fpd, *ed, *bd, *bcd, *yd, *Md;
+  int nthreads = cvFusedHostThreads(M);
+
+  if (nthreads == 0)
+  {
+    N_VLinearSum(ONE, M, -ONE, fpred, M);
+    N_VLinearSum(FRACT, ftemp, -h, M, M);
+    N_VProd(ftemp, ewt, y);
+    /* Protect against deltay_i being at roundoff level */
+    N_VCompare(uround, y, bit);
+    N_VAddConst(bit, -ONE, bitcomp);
+    N_VProd(ftemp, bit, y);
+    N_VLinearSum(FRACT, y, -ONE, bitcomp, y);
+    N_VDiv(M, y, M);
+    N_VProd(M, bit, M);
+    N_VLinearSum(ONE, M, -ONE, bitcomp, M);
+    return 0;
+  }
+
+  N   = N_VGetLength(M);
+  ftd = N_VGetArrayPointer(ftemp);
+  fpd = N_VGetArrayPointer(fpred);
+  ed  = N_VGetArrayPointer(ewt);
+  bd  = N_VGetArrayPointer(bit);
+  bcd = N_VGetArrayPointer(bitcomp);
+  yd  = N_VGetArrayPointer(y);
+  Md  = N_VGetArrayPointer(M);
+
+  CV_FUSED_OMP_FOR(nthreads)
+  for (i = 0; i < N; i++)
+  {
+    Md[i] = FRACT * ftd[i] - h * (Md[i] - fpd[i]);
+    /* Protect against deltay_i being at roundoff level */
+    bd[i]  = (SUNRabs(ftd[i] * ed[i]) >= uround) ? ONE : ZERO;
+    bcd[i] = bd[i] - ONE;
+    yd[i]  = FRACT * ftd[i] * bd[i] - bcd[i];
+    Md[i]  = Md[i] / yd[i] * bd[i] - bcd[i];
+  }
+
   return 0;
 }
 
@@ -150,9 +311,145 @@ int cvDiagSetup_buildM(SUNDIALS_MAYBE_UNUSED const sunrealtype fract,
 
 int cvDiagSolve_updateM(const sunrealtype r, N_Vector M)
 {
-  N_VInv(M, M);
-  N_VAddConst(M, -ONE, M);
-  N_VScale(r, M, M);
-  N_VAddConst(M, ONE, M);
+  sunindextype i, N;
+  sunrealtype* Md;
+  int nthreads = cvFusedHostThreads(M);
+
+  if (nthreads == 0)
+  {
+    N_VInv(M, M);
+    N_VAddConst(M, -ONE, M);
+    N_VScale(r, M, M);
+    N_VAddConst(M, ONE, M);
+    return 0;
+  }
+
+  N  = N_VGetLength(M);
+  Md = N_VGetArrayPointer(M);
+
+  CV_FUSED_OMP_FOR(nthreads)
+  for (i = 0; i < N; i++) { Md[i] = r * (ONE / Md[i] - ONE) + ONE; }
+
+  return 0;
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Nordsieck array updates. The host loops are shared with the
+ * contiguous history storage (see cvode_fused_host.h).
+ * -----------------------------------------------------------------
+ */
+
+/* Load the data pointers for zn[0], ..., zn[q] */
+static int cvFusedNordsieckData(const int q, N_Vector* zn, sunrealtype** znd)
+{
+  int j;
+  int nthreads = cvFusedHostThreads(zn[0]);
+  if (nthreads == 0) { return 0; }
+  for (j = 0; j <= q; j++) { znd[j] = N_VGetArrayPointer(zn[j]); }
+  return nthreads;
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Compute the predicted Nordsieck array by repeated additions
+ * (multiplication by the Pascal triangle matrix).
+ * -----------------------------------------------------------------
+ */
+
+int cvPredict_fused(const int q, N_Vector* zn)
+{
+  sunrealtype* znd[L_MAX];
+  int j, k;
+  int nthreads = cvFusedNordsieckData(q, zn, znd);
+
+  if (nthreads == 0)
+  {
+    for (k = 1; k <= q; k++)
+    {
+      for (j = q; j >= k; j--) { N_VLinearSum(ONE, zn[j - 1], ONE, zn[j], zn[j - 1]); }
+    }
+    return 0;
+  }
+
+  cvFusedHostPredict(q, ONE, N_VGetLength(zn[0]), znd, nthreads);
+
+  return 0;
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Undo the prediction of the Nordsieck array.
+ * -----------------------------------------------------------------
+ */
+
+int cvRestore_fused(const int q, N_Vector* zn)
+{
+  sunrealtype* znd[L_MAX];
+  int j, k;
+  int nthreads = cvFusedNordsieckData(q, zn, znd);
+
+  if (nthreads == 0)
+  {
+    for (k = 1; k <= q; k++)
+    {
+      for (j = q; j >= k; j--)
+      {
+        N_VLinearSum(ONE, zn[j - 1], -ONE, zn[j], zn[j - 1]);
+      }
+    }
+    return 0;
+  }
+
+  cvFusedHostPredict(q, -ONE, N_VGetLength(zn[0]), znd, nthreads);
+
+  return 0;
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Rescale the Nordsieck array, zn[j] = eta^j zn[j] for j = 1,...,q,
+ * with the scaling factors eta^j stored in cvals[j-1].
+ * -----------------------------------------------------------------
+ */
+
+int cvRescale_fused(const int q, sunrealtype* cvals, N_Vector* zn)
+{
+  sunrealtype* znd[L_MAX];
+  int nthreads = cvFusedNordsieckData(q, zn, znd);
+
+  if (nthreads == 0)
+  {
+    (void)N_VScaleVectorArray(q, cvals, zn + 1, zn + 1);
+    return 0;
+  }
+
+  cvFusedHostRescale(q, cvals, N_VGetLength(zn[0]), znd, nthreads);
+
+  return 0;
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Apply the correction to the Nordsieck array, zn[j] += l[j] * acor
+ * for j = 0,...,q.
+ * -----------------------------------------------------------------
+ */
+
+int cvCorrect_fused(const int q, sunrealtype* l, const N_Vector acor,
+                    N_Vector* zn)
+{
+  sunrealtype* znd[L_MAX];
+  int nthreads = cvFusedNordsieckData(q, zn, znd);
+
+  if (nthreads == 0)
+  {
+    (void)N_VScaleAddMulti(q + 1, l, acor, zn, zn);
+    return 0;
+  }
+
+  cvFusedHostScaleAdd(q + 1, l, N_VGetArrayPointer(acor),
+                      N_VGetLength(zn[0]), znd, nthreads);
+
   return 0;
 }
@@ -22,6 +22,7 @@
 #include <cvode/cvode.h>
 #include <sundials/priv/sundials_context_impl.h>
 #include <sundials/priv/sundials_errors_impl.h>
+#include <sundials/priv/sundials_telemetry_impl.h>
 #include <sundials/sundials_math.h>
 
 #include "cvode_proj_impl.h"
@@ -233,6 +234,11 @@ typedef struct CVodeMemRec
                              zn[j] = [1/factorial(j)] * h^j *
                              (jth derivative of the interpolating polynomial) */
 
+  sunbooleantype cv_zn_contig; /* SUNTRUE if zn should be stored contiguously */
+  sunrealtype* cv_zn_data;     /* contiguous storage for zn[0],...,zn[qmax],
+                                  where zn[j] starts at cv_zn_data + j * N     */
+  sunindextype cv_zn_length;   /* length N of each vector in cv_zn_data       */
+
   /*-------------------
     Vectors of length N
     -------------------*/
@@ -418,6 +424,12 @@ typedef struct CVodeMemRec
   CVMonitorFn cv_monitorfun;    /* func called with CVODE mem and user data  */
   long int cv_monitor_interval; /* step interval to call cv_monitorfun       */
 
+  /*-------------------------------------------
+    Per-step telemetry
+    -------------------------------------------*/
+  SUNTelemetry cv_telemetry;    /* telemetry records (NULL if not collected) */
+  sunTelemetryStep cv_tel_step; /* telemetry state of the current step       */
+
   /*-------------------------
     Stability Limit Detection
     -------------------------*/
@@ -448,6 +460,9 @@ typedef struct CVodeMemRec
   long int cv_nge;       /* counter for g evaluations                       */
   sunbooleantype* cv_gactive; /* array with active/inactive event functions      */
   int cv_mxgnull; /* number of warning messages about possible g==0  */
+  CVPartialRootFn cv_gpart;  /* optional function for a subset of g          */
+  int* cv_rcand;             /* candidate components in root search          */
+  sunbooleantype cv_rootiqi; /* use inverse quadratic interpolation?         */
 
   /*---------------
     Projection Data
@@ -636,6 +651,8 @@ void cvRestore(CVodeMem cv_mem, sunrealtype saved_t);
 void cvRescale(CVodeMem cv_mem);
 
 #ifdef SUNDIALS_BUILD_PACKAGE_FUSED_KERNELS
+sunbooleantype cvFusedKernelsSupported(N_Vector v);
+
 int cvEwtSetSS_fused(const sunbooleantype atolmin0, const sunrealtype reltol,
                      const sunrealtype Sabstol, const N_Vector ycur,
                      N_Vector tempv, N_Vector weight);
@@ -661,6 +678,15 @@ int cvDiagSetup_buildM(const sunrealtype fract, const sunrealtype uround,
                        N_Vector bitcomp, N_Vector y, N_Vector M);
 
 int cvDiagSolve_updateM(const sunrealtype r, N_Vector M);
+
+int cvPredict_fused(const int q, N_Vector* zn);
+
+int cvRestore_fused(const int q, N_Vector* zn);
+
+int cvRescale_fused(const int q, sunrealtype* cvals, N_Vector* zn);
+
+int cvCorrect_fused(const int q, sunrealtype* l, const N_Vector acor,
+                    N_Vector* zn);
 #endif
 
 /*
@@ -722,6 +748,7 @@ int cvDiagSolve_updateM(const sunrealtype r, N_Vector M);
 #define MSGCV_BAD_CONSTR     "Illegal values in constraints vector."
 #define MSGCV_BAD_K          "Illegal value for k."
 #define MSGCV_NULL_DKY       "dky = NULL illegal."
+#define MSGCV_BAD_NT         "nt < 1 or t = NULL illegal."
 #define MSGCV_BAD_T          "Illegal value for t." MSG_TIME_INT
 #define MSGCV_NO_ROOT        "Rootfinding was not initialized."
 #define MSGCV_NLS_INIT_FAIL  "The nonlinear solver's init routine failed."
@@ -147,6 +147,30 @@ int CVodeSetMonitorFrequency(void* cvode_mem, long int nst)
 #endif
 }
 
+/*
+ * CVodeSetTelemetry
+ *
+ * Specifies the telemetry object in which a record is stored for
+ * each successful step. Passing NULL turns telemetry off.
+ */
+
+int CVodeSetTelemetry(void* cvode_mem, SUNTelemetry tel)
+{
+  CVodeMem cv_mem;
+
+  if (cvode_mem == NULL)
+  {
+    cvProcessError(NULL, CV_MEM_NULL, __LINE__, __func__, __FILE__, MSGCV_NO_MEM);
+    return (CV_MEM_NULL);
+  }
+
+  cv_mem = (CVodeMem)cvode_mem;
+
+  cv_mem->cv_telemetry = tel;
+
+  return (CV_SUCCESS);
+}
+
 /*
  * CVodeSetMaxOrd
  *
@@ -922,6 +946,55 @@ int CVodeSetNoInactiveRootWarn(void* cvode_mem)
   return (CV_SUCCESS);
 }
 
+/*
+ * CVodeSetPartialRootFn
+ *
+ * Specifies an optional function that evaluates only the listed
+ * components of g. It is used during the root search in place of
+ * the full g function.
+ */
+
+int CVodeSetPartialRootFn(void* cvode_mem, CVPartialRootFn gpart)
+{
+  CVodeMem cv_mem;
+
+  if (cvode_mem == NULL)
+  {
+    cvProcessError(NULL, CV_MEM_NULL, __LINE__, __func__, __FILE__, MSGCV_NO_MEM);
+    return (CV_MEM_NULL);
+  }
+
+  cv_mem = (CVodeMem)cvode_mem;
+
+  cv_mem->cv_gpart = gpart;
+
+  return (CV_SUCCESS);
+}
+
+/*
+ * CVodeSetRootInverseInterp
+ *
+ * Enables or disables inverse quadratic interpolation steps in
+ * the root search
+ */
+
+int CVodeSetRootInverseInterp(void* cvode_mem, sunbooleantype onoff)
+{
+  CVodeMem cv_mem;
+
+  if (cvode_mem == NULL)
+  {
+    cvProcessError(NULL, CV_MEM_NULL, __LINE__, __func__, __FILE__, MSGCV_NO_MEM);
+    return (CV_MEM_NULL);
+  }
+
+  cv_mem = (CVodeMem)cvode_mem;
+
+  cv_mem->cv_rootiqi = onoff;
+
+  return (CV_SUCCESS);
+}
+
 /*
  * CVodeSetConstraints
  *
@@ -1001,9 +1074,6 @@ int CVodeSetConstraints(void* cvode_mem, N_Vector constraints)
 int CVodeSetUseIntegratorFusedKernels(void* cvode_mem, sunbooleantype onoff)
 {
   CVodeMem cv_mem;
-#ifdef SUNDIALS_BUILD_PACKAGE_FUSED_KERNELS
-  N_Vector_ID id;
-#endif
 
   if (cvode_mem == NULL)
   {
@@ -1014,9 +1084,7 @@ int CVodeSetUseIntegratorFusedKernels(void* cvode_mem, sunbooleantype onoff)
   cv_mem = (CVodeMem)cvode_mem;
 
 #ifdef SUNDIALS_BUILD_PACKAGE_FUSED_KERNELS
-  id = N_VGetVectorID(cv_mem->cv_ewt);
-  if (!cv_mem->cv_MallocDone ||
-      (id != SUNDIALS_NVEC_CUDA && id != SUNDIALS_NVEC_HIP))
+  if (!cv_mem->cv_MallocDone || !cvFusedKernelsSupported(cv_mem->cv_ewt))
   {
     cvProcessError(cv_mem, CV_ILL_INPUT, __LINE__, __func__, __FILE__,
                    "Fused Kernels not supported for the provided vector");
@@ -1033,6 +1101,37 @@ int CVodeSetUseIntegratorFusedKernels(void* cvode_mem, sunbooleantype onoff)
 #endif
 }
 
+/*
+ * CVodeSetUseContiguousHistory
+ *
+ * Enable or disable storing the Nordsieck history array in a single
+ * contiguous allocation. Must be called before CVodeInit.
+ */
+
+int CVodeSetUseContiguousHistory(void* cvode_mem, sunbooleantype onoff)
+{
+  CVodeMem cv_mem;
+
+  if (cvode_mem == NULL)
+  {
+    cvProcessError(NULL, CV_MEM_NULL, __LINE__, __func__, __FILE__, MSGCV_NO_MEM);
+    return (CV_MEM_NULL);
+  }
+
+  cv_mem = (CVodeMem)cvode_mem;
+
+  if (cv_mem->cv_MallocDone)
+  {
+    cvProcessError(cv_mem, CV_ILL_INPUT, __LINE__, __func__, __FILE__,
+                   "The history storage must be set before calling CVodeInit");
+    return (CV_ILL_INPUT);
+  }
+
+  cv_mem->cv_zn_contig = onoff;
+
+  return (CV_SUCCESS);
+}
+
 /*
  * =================================================================
  * CVODE optional output functions
@@ -115,6 +115,17 @@ typedef struct CVLsMemRec
   CVRhsFn jt_f;
   void* jt_data;
 
+  /* Batched RHS function for the DQ Jacobian approximation, with
+     workspace for up to maxbatch perturbed states */
+  CVLsRhsBatchFn rhsbatch;
+  int maxbatch;
+  N_Vector* ybatch;
+  N_Vector* fbatch;
+  sunrealtype* incbatch;
+
+  /* Archive for selected linear systems and right-hand sides */
+  SUNLinSysCapture capture;
+
   /* Linear system setup function
    * (a) user-provided linsys function:
    *     - user_linsys = SUNTRUE
@@ -177,6 +188,11 @@ int cvLs_AccessLMem(void* cvode_mem, const char* fname, CVodeMem* cv_mem,
 #define MSG_LS_BAD_SIZES \
   "Illegal bandwidth parameter(s). Must have 0 <=  ml, mu <= N-1."
 #define MSG_LS_BAD_EPLIN "eplifac < 0 illegal."
+#define MSG_LS_BATCH_NULL_MAT \
+  "Batched RHS function cannot be supplied for NULL SUNMatrix."
+#define MSG_LS_BAD_MAXBATCH "maxbatch < 1 illegal."
+#define MSG_LS_CAPTURE_NO_MATRIX \
+  "Linear systems cannot be captured for NULL SUNMatrix."
 
 #define MSG_LS_PSET_FAILED \
   "The preconditioner setup routine failed in an unrecoverable manner."
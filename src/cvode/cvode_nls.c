@@ -266,11 +266,19 @@ static int cvNlsLSetup(sunbooleantype jbad, sunbooleantype* jcur, void* cvode_me
   if (jbad) { cv_mem->convfail = CV_FAIL_BAD_J; }
 
   /* setup the linear solver */
+  if (cv_mem->cv_telemetry)
+  {
+    cv_mem->cv_tel_step.rec.wall_lsetup -= sunTelemetryWallTime();
+  }
   retval = cv_mem->cv_lsetup(cv_mem, cv_mem->convfail, cv_mem->cv_y,
                              cv_mem->cv_ftemp, &(cv_mem->cv_jcur),
                              cv_mem->cv_vtemp1, cv_mem->cv_vtemp2,
                              cv_mem->cv_vtemp3);
   cv_mem->cv_nsetups++;
+  if (cv_mem->cv_telemetry)
+  {
+    cv_mem->cv_tel_step.rec.wall_lsetup += sunTelemetryWallTime();
+  }
 
   /* update Jacobian status */
   *jcur = cv_mem->cv_jcur;
@@ -298,8 +306,16 @@ static int cvNlsLSolve(N_Vector delta, void* cvode_mem)
   }
   cv_mem = (CVodeMem)cvode_mem;
 
+  if (cv_mem->cv_telemetry)
+  {
+    cv_mem->cv_tel_step.rec.wall_lsolve -= sunTelemetryWallTime();
+  }
   retval = cv_mem->cv_lsolve(cv_mem, delta, cv_mem->cv_ewt, cv_mem->cv_y,
                              cv_mem->cv_ftemp);
+  if (cv_mem->cv_telemetry)
+  {
+    cv_mem->cv_tel_step.rec.wall_lsolve += sunTelemetryWallTime();
+  }
 
   if (retval < 0) { return (CV_LSOLVE_FAIL); }
   if (retval > 0) { return (SUN_NLS_CONV_RECVR); }
@@ -638,6 +638,20 @@ SWIGEXPORT int _wrap_FCVodeSetUseIntegratorFusedKernels(void *farg1, int const *
 }
 
 
+SWIGEXPORT int _wrap_FCVodeSetUseContiguousHistory(void *farg1, int const *farg2) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  int arg2 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (int)(*farg2);
+  result = (int)CVodeSetUseContiguousHistory(arg1,arg2);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FCVodeSetUserData(void *farg1, void *farg2) {
   int fresult ;
   void *arg1 = (void *) 0 ;
@@ -836,6 +850,34 @@ SWIGEXPORT int _wrap_FCVodeSetNoInactiveRootWarn(void *farg1) {
 }
 
 
+SWIGEXPORT int _wrap_FCVodeSetPartialRootFn(void *farg1, CVPartialRootFn farg2) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  CVPartialRootFn arg2 = (CVPartialRootFn) 0 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (CVPartialRootFn)(farg2);
+  result = (int)CVodeSetPartialRootFn(arg1,arg2);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
+SWIGEXPORT int _wrap_FCVodeSetRootInverseInterp(void *farg1, int const *farg2) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  int arg2 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (int)(*farg2);
+  result = (int)CVodeSetRootInverseInterp(arg1,arg2);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FCVode(void *farg1, double const *farg2, N_Vector farg3, double *farg4, int const *farg5) {
   int fresult ;
   void *arg1 = (void *) 0 ;
@@ -890,6 +932,26 @@ SWIGEXPORT int _wrap_FCVodeGetDky(void *farg1, double const *farg2, int const *f
 }
 
 
+SWIGEXPORT int _wrap_FCVodeGetDkyBatch(void *farg1, int const *farg2, double *farg3, int const *farg4, void *farg5) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  int arg2 ;
+  sunrealtype *arg3 = (sunrealtype *) 0 ;
+  int arg4 ;
+  N_Vector *arg5 = (N_Vector *) 0 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (int)(*farg2);
+  arg3 = (sunrealtype *)(farg3);
+  arg4 = (int)(*farg4);
+  arg5 = (N_Vector *)(farg5);
+  result = (int)CVodeGetDkyBatch(arg1,arg2,arg3,arg4,arg5);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FCVodeGetWorkSpace(void *farg1, long *farg2, long *farg3) {
   int fresult ;
   void *arg1 = (void *) 0 ;
@@ -1680,6 +1742,22 @@ SWIGEXPORT int _wrap_FCVodeSetLinSysFn(void *farg1, CVLsLinSysFn farg2) {
 }
 
 
+SWIGEXPORT int _wrap_FCVodeSetJacRhsBatchFn(void *farg1, CVLsRhsBatchFn farg2, int const *farg3) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  CVLsRhsBatchFn arg2 = (CVLsRhsBatchFn) 0 ;
+  int arg3 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (CVLsRhsBatchFn)(farg2);
+  arg3 = (int)(*farg3);
+  result = (int)CVodeSetJacRhsBatchFn(arg1,arg2,arg3);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FCVodeGetJac(void *farg1, void *farg2) {
   int fresult ;
   void *arg1 = (void *) 0 ;
@@ -91,6 +91,7 @@ module fcvode_mod
  public :: FCVodeSetInterpolateStopTime
  public :: FCVodeClearStopTime
  public :: FCVodeSetUseIntegratorFusedKernels
+ public :: FCVodeSetUseContiguousHistory
  public :: FCVodeSetUserData
  public :: FCVodeSetEtaFixedStepBounds
  public :: FCVodeSetEtaMaxFirstStep
@@ -105,9 +106,12 @@ module fcvode_mod
  public :: FCVodeRootInit
  public :: FCVodeSetRootDirection
  public :: FCVodeSetNoInactiveRootWarn
+ public :: FCVodeSetPartialRootFn
+ public :: FCVodeSetRootInverseInterp
  public :: FCVode
  public :: FCVodeComputeState
  public :: FCVodeGetDky
+ public :: FCVodeGetDkyBatch
  public :: FCVodeGetWorkSpace
  public :: FCVodeGetNumSteps
  public :: FCVodeGetNumRhsEvals
@@ -182,6 +186,7 @@ module fcvode_mod
  public :: FCVodeSetPreconditioner
  public :: FCVodeSetJacTimes
  public :: FCVodeSetLinSysFn
+ public :: FCVodeSetJacRhsBatchFn
  public :: FCVodeGetJac
  public :: FCVodeGetJacTime
  public :: FCVodeGetJacNumSteps
@@ -464,6 +469,15 @@ integer(C_INT), intent(in) :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FCVodeSetUseContiguousHistory(farg1, farg2) &
+bind(C, name="_wrap_FCVodeSetUseContiguousHistory") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FCVodeSetUserData(farg1, farg2) &
 bind(C, name="_wrap_FCVodeSetUserData") &
 result(fresult)
@@ -591,6 +605,24 @@ type(C_PTR), value :: farg1
 integer(C_INT) :: fresult
 end function
 
+function swigc_FCVodeSetPartialRootFn(farg1, farg2) &
+bind(C, name="_wrap_FCVodeSetPartialRootFn") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_FUNPTR), value :: farg2
+integer(C_INT) :: fresult
+end function
+
+function swigc_FCVodeSetRootInverseInterp(farg1, farg2) &
+bind(C, name="_wrap_FCVodeSetRootInverseInterp") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FCVode(farg1, farg2, farg3, farg4, farg5) &
 bind(C, name="_wrap_FCVode") &
 result(fresult)
@@ -624,6 +656,18 @@ type(C_PTR), value :: farg4
 integer(C_INT) :: fresult
 end function
 
+function swigc_FCVodeGetDkyBatch(farg1, farg2, farg3, farg4, farg5) &
+bind(C, name="_wrap_FCVodeGetDkyBatch") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+type(C_PTR), value :: farg3
+integer(C_INT), intent(in) :: farg4
+type(C_PTR), value :: farg5
+integer(C_INT) :: fresult
+end function
+
 function swigc_FCVodeGetWorkSpace(farg1, farg2, farg3) &
 bind(C, name="_wrap_FCVodeGetWorkSpace") &
 result(fresult)
@@ -1129,6 +1173,16 @@ type(C_FUNPTR), value :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FCVodeSetJacRhsBatchFn(farg1, farg2, farg3) &
+bind(C, name="_wrap_FCVodeSetJacRhsBatchFn") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_FUNPTR), value :: farg2
+integer(C_INT), intent(in) :: farg3
+integer(C_INT) :: fresult
+end function
+
 function swigc_FCVodeGetJac(farg1, farg2) &
 bind(C, name="_wrap_FCVodeGetJac") &
 result(fresult)
@@ -1809,6 +1863,22 @@ fresult = swigc_FCVodeSetUseIntegratorFusedKernels(farg1, farg2)
 swig_result = fresult
 end function
 
+function FCVodeSetUseContiguousHistory(cvode_mem, onoff) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: cvode_mem
+integer(C_INT), intent(in) :: onoff
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = cvode_mem
+farg2 = onoff
+fresult = swigc_FCVodeSetUseContiguousHistory(farg1, farg2)
+swig_result = fresult
+end function
+
 function FCVodeSetUserData(cvode_mem, user_data) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -2036,6 +2106,38 @@ fresult = swigc_FCVodeSetNoInactiveRootWarn(farg1)
 swig_result = fresult
 end function
 
+function FCVodeSetPartialRootFn(cvode_mem, gpart) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: cvode_mem
+type(C_FUNPTR), intent(in), value :: gpart
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_FUNPTR) :: farg2 
+
+farg1 = cvode_mem
+farg2 = gpart
+fresult = swigc_FCVodeSetPartialRootFn(farg1, farg2)
+swig_result = fresult
+end function
+
+function FCVodeSetRootInverseInterp(cvode_mem, onoff) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: cvode_mem
+integer(C_INT), intent(in) :: onoff
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = cvode_mem
+farg2 = onoff
+fresult = swigc_FCVodeSetRootInverseInterp(farg1, farg2)
+swig_result = fresult
+end function
+
 function FCVode(cvode_mem, tout, yout, tret, itask) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -2102,6 +2204,31 @@ fresult = swigc_FCVodeGetDky(farg1, farg2, farg3, farg4)
 swig_result = fresult
 end function
 
+function FCVodeGetDkyBatch(cvode_mem, nt, t, k, dky) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: cvode_mem
+integer(C_INT), intent(in) :: nt
+real(C_DOUBLE), dimension(*), target, intent(inout) :: t
+integer(C_INT), intent(in) :: k
+type(C_PTR) :: dky
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+type(C_PTR) :: farg3 
+integer(C_INT) :: farg4 
+type(C_PTR) :: farg5 
+
+farg1 = cvode_mem
+farg2 = nt
+farg3 = c_loc(t(1))
+farg4 = k
+farg5 = dky
+fresult = swigc_FCVodeGetDkyBatch(farg1, farg2, farg3, farg4, farg5)
+swig_result = fresult
+end function
+
 function FCVodeGetWorkSpace(cvode_mem, lenrw, leniw) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -3042,6 +3169,25 @@ fresult = swigc_FCVodeSetLinSysFn(farg1, farg2)
 swig_result = fresult
 end function
 
+function FCVodeSetJacRhsBatchFn(cvode_mem, rhsbatch, maxbatch) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: cvode_mem
+type(C_FUNPTR), intent(in), value :: rhsbatch
+integer(C_INT), intent(in) :: maxbatch
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_FUNPTR) :: farg2 
+integer(C_INT) :: farg3 
+
+farg1 = cvode_mem
+farg2 = rhsbatch
+farg3 = maxbatch
+fresult = swigc_FCVodeSetJacRhsBatchFn(farg1, farg2, farg3)
+swig_result = fresult
+end function
+
 function FCVodeGetJac(cvode_mem, j) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
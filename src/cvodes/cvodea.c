@@ -56,9 +56,14 @@
 static CVckpntMem CVAckpntInit(CVodeMem cv_mem);
 static CVckpntMem CVAckpntNew(CVodeMem cv_mem);
 static void CVAckpntDelete(CVckpntMem* ck_memPtr);
+static void CVAckpntMerge(CVadjMem ca_mem, CVckpntMem ck_mem);
+static void CVAckpntThin(CVadjMem ca_mem, int maxckpnts);
+static void CVAckpntEnd(CVadjMem ca_mem, CVckpntMem ck_mem, sunrealtype* t1,
+                        long int* nst1);
 
 static void CVAbckpbDelete(CVodeBMem* cvB_memPtr);
 
+static int CVArevolve(CVodeMem cv_mem, CVckpntMem* ck_memPtr);
 static int CVAdataStore(CVodeMem cv_mem, CVckpntMem ck_mem);
 static int CVAckpntGet(CVodeMem cv_mem, CVckpntMem ck_mem);
 
@@ -162,6 +167,19 @@ int CVodeAdjInit(void* cvode_mem, long int steps, int interp)
   /* No interpolation data is available */
   ca_mem->ca_ckpntData = NULL;
 
+  /* No limit on the number of check points */
+  ca_mem->ca_maxckpnts = 0;
+
+  /* No backward sweep in progress */
+  ca_mem->ca_ckpntEnd = NULL;
+  ca_mem->ca_tEnd     = ZERO;
+  ca_mem->ca_nstEnd   = 0;
+
+  /* Initialize checkpointing statistics */
+  ca_mem->ca_nstStore   = 0;
+  ca_mem->ca_nstRecomp  = 0;
+  ca_mem->ca_nckpntsMax = 0;
+
   /* ------------------------------------
    * Initialization of interpolation data
    * ------------------------------------ */
@@ -329,6 +347,11 @@ int CVodeAdjReInit(void* cvode_mem)
   ca_mem->ck_mem       = NULL;
   ca_mem->ca_nckpnts   = 0;
   ca_mem->ca_ckpntData = NULL;
+  ca_mem->ca_ckpntEnd  = NULL;
+
+  ca_mem->ca_nstStore   = 0;
+  ca_mem->ca_nstRecomp  = 0;
+  ca_mem->ca_nckpntsMax = 0;
 
   /* CVodeF and CVodeB not called yet */
 
@@ -481,6 +504,7 @@ int CVodeF(void* cvode_mem, sunrealtype tout, N_Vector yout, sunrealtype* tret,
       SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
       return (CV_MEM_FAIL);
     }
+    ca_mem->ca_nckpntsMax = 1;
 
     if (!ca_mem->ca_IMmallocDone)
     {
@@ -579,7 +603,16 @@ int CVodeF(void* cvode_mem, sunrealtype tout, N_Vector yout, sunrealtype* tret,
 
     if (cv_mem->cv_nst % ca_mem->ca_nsteps == 0)
     {
-      ca_mem->ck_mem->ck_t1 = cv_mem->cv_tn;
+      ca_mem->ck_mem->ck_t1   = cv_mem->cv_tn;
+      ca_mem->ck_mem->ck_nst1 = cv_mem->cv_nst;
+
+      /* If the number of check points is limited, make room for the new one
+         (half of the budget is kept free for recomputations in CVodeB) */
+      if (ca_mem->ca_maxckpnts > 0)
+      {
+        CVAckpntThin(ca_mem,
+                     ca_mem->ca_maxckpnts - ca_mem->ca_maxckpnts / 2 - 1);
+      }
 
       /* Create a new check point, load it, and append it to the list */
       tmp = CVAckpntNew(cv_mem);
@@ -595,6 +628,11 @@ int CVodeF(void* cvode_mem, sunrealtype tout, N_Vector yout, sunrealtype* tret,
       ca_mem->ca_nckpnts++;
       cv_mem->cv_forceSetup = SUNTRUE;
 
+      if (ca_mem->ca_nckpnts + 1 > ca_mem->ca_nckpntsMax)
+      {
+        ca_mem->ca_nckpntsMax = ca_mem->ca_nckpnts + 1;
+      }
+
       /* Reset i=0 and load dt_mem[0] */
       dt_mem[0]->t = ca_mem->ck_mem->ck_t0;
       ca_mem->ca_IMstore(cv_mem, dt_mem[0]);
@@ -609,7 +647,8 @@ int CVodeF(void* cvode_mem, sunrealtype tout, N_Vector yout, sunrealtype* tret,
     /* Set t1 field of the current ckeck point structure
        for the case in which there will be no future
        check points */
-    ca_mem->ck_mem->ck_t1 = cv_mem->cv_tn;
+    ca_mem->ck_mem->ck_t1   = cv_mem->cv_tn;
+    ca_mem->ck_mem->ck_nst1 = cv_mem->cv_nst;
 
     /* tfinal is now set to tn */
     ca_mem->ca_tfinal = cv_mem->cv_tn;
@@ -1367,7 +1406,7 @@ int CVodeB(void* cvode_mem, sunrealtype tBout, int itaskB)
   CVodeMem cv_mem;
   CVadjMem ca_mem;
   CVodeBMem cvB_mem, tmp_cvB_mem;
-  CVckpntMem ck_mem;
+  CVckpntMem ck_mem, tmp_ck_mem, next_ck_mem;
   int sign, flag = 0;
   sunrealtype tfuzz, tBret, tBn;
   sunbooleantype gotCheckpoint, isActive, reachedTBout;
@@ -1532,6 +1571,44 @@ int CVodeB(void* cvode_mem, sunrealtype tBout, int itaskB)
     ck_mem = ck_mem->ck_next;
   }
 
+  /* In CV_ONE_STEP mode the sweep returns before it moves on to the next
+     check point. Record where the sweep entered the current check point and
+     merge the temporary check points all backward problems have passed. */
+
+  if ((ca_mem->ca_maxckpnts > 0) && (ck_mem != ca_mem->ck_mem) &&
+      (ck_mem != ca_mem->ca_ckpntEnd))
+  {
+    ca_mem->ca_ckpntEnd = ck_mem;
+    ca_mem->ca_tEnd     = ck_mem->ck_t1;
+    ca_mem->ca_nstEnd   = ck_mem->ck_nst1;
+
+    tmp_ck_mem = ca_mem->ck_mem;
+    while (tmp_ck_mem != ck_mem)
+    {
+      next_ck_mem = tmp_ck_mem->ck_next;
+      if (tmp_ck_mem->ck_tmp) { CVAckpntMerge(ca_mem, tmp_ck_mem); }
+      tmp_ck_mem = next_ck_mem;
+    }
+  }
+
+  /* If a previous sweep stopped inside this check point, its recorded end is
+     only valid if no backward problem was moved past it since */
+
+  if (ck_mem == ca_mem->ca_ckpntEnd)
+  {
+    tmp_cvB_mem = cvB_mem;
+    while (tmp_cvB_mem != NULL)
+    {
+      if (sign * (tmp_cvB_mem->cv_mem->cv_tn - ca_mem->ca_tEnd) > ZERO)
+      {
+        ca_mem->ca_ckpntEnd = NULL;
+        if (ck_mem == ca_mem->ca_ckpntData) { ca_mem->ca_ckpntData = NULL; }
+        break;
+      }
+      tmp_cvB_mem = tmp_cvB_mem->cv_next;
+    }
+  }
+
   /* Starting with the current check point from above, loop over check points
      while propagating backward problems */
 
@@ -1542,6 +1619,11 @@ int CVodeB(void* cvode_mem, sunrealtype tBout, int itaskB)
 
     if (ck_mem != ca_mem->ca_ckpntData)
     {
+      /* If the number of check points is limited, the interval may span more
+         than nsteps steps and must first be split by recomputation */
+      flag = CVArevolve(cv_mem, &ck_mem);
+      if (flag != CV_SUCCESS) { break; }
+
       flag = CVAdataStore(cv_mem, ck_mem);
       if (flag != CV_SUCCESS) { break; }
     }
@@ -1628,9 +1710,18 @@ int CVodeB(void* cvode_mem, sunrealtype tBout, int itaskB)
 
     if (reachedTBout) { break; }
 
-    /* Move check point in linked list to next one */
+    /* Move check point in linked list to next one and record where the
+       sweep entered it. A temporary check point is no longer needed and is
+       merged into the next one so the list still covers the whole interval. */
 
-    ck_mem = ck_mem->ck_next;
+    tmp_ck_mem = ck_mem;
+    ck_mem     = ck_mem->ck_next;
+
+    ca_mem->ca_ckpntEnd = ck_mem;
+    ca_mem->ca_tEnd     = tmp_ck_mem->ck_t0;
+    ca_mem->ca_nstEnd   = tmp_ck_mem->ck_nst;
+
+    if (tmp_ck_mem->ck_tmp) { CVAckpntMerge(ca_mem, tmp_ck_mem); }
   }
 
   SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
@@ -1790,10 +1881,13 @@ static CVckpntMem CVAckpntInit(CVodeMem cv_mem)
 
   /* Load ckdata from cv_mem */
   N_VScale(ONE, cv_mem->cv_zn[0], ck_mem->ck_zn[0]);
-  ck_mem->ck_t0  = cv_mem->cv_tn;
-  ck_mem->ck_nst = 0;
-  ck_mem->ck_q   = 1;
-  ck_mem->ck_h   = ZERO;
+  ck_mem->ck_t0   = cv_mem->cv_tn;
+  ck_mem->ck_t1   = cv_mem->cv_tn;
+  ck_mem->ck_nst  = 0;
+  ck_mem->ck_nst1 = 0;
+  ck_mem->ck_tmp  = SUNFALSE;
+  ck_mem->ck_q    = 1;
+  ck_mem->ck_h    = ZERO;
 
   /* Do we need to carry quadratures */
   ck_mem->ck_quadr = cv_mem->cv_quadr && cv_mem->cv_errconQ;
@@ -2186,6 +2280,9 @@ static CVckpntMem CVAckpntNew(CVodeMem cv_mem)
   ck_mem->ck_eta       = cv_mem->cv_eta;
   ck_mem->ck_etamax    = cv_mem->cv_etamax;
   ck_mem->ck_t0        = cv_mem->cv_tn;
+  ck_mem->ck_t1        = cv_mem->cv_tn;
+  ck_mem->ck_nst1      = cv_mem->cv_nst;
+  ck_mem->ck_tmp       = SUNFALSE;
   ck_mem->ck_saved_tq5 = cv_mem->cv_saved_tq5;
 
   return (ck_mem);
@@ -2270,6 +2367,97 @@ static void CVAckpntDelete(CVckpntMem* ck_memPtr)
   tmp = NULL;
 }
 
+/*
+ * CVAckpntMerge
+ *
+ * This routine removes the check point ck_mem (which must not be the
+ * one at t_initial) from the list and extends the interval of the
+ * next (older) check point to cover it.
+ */
+
+static void CVAckpntMerge(CVadjMem ca_mem, CVckpntMem ck_mem)
+{
+  CVckpntMem* prev;
+  CVckpntMem older;
+
+  older = ck_mem->ck_next;
+
+  /* find the list entry pointing to ck_mem */
+  prev = &(ca_mem->ck_mem);
+  while (*prev != ck_mem) { prev = &((*prev)->ck_next); }
+
+  older->ck_t1   = ck_mem->ck_t1;
+  older->ck_nst1 = ck_mem->ck_nst1;
+
+  if (ca_mem->ca_ckpntEnd == ck_mem) { ca_mem->ca_ckpntEnd = older; }
+  if ((ca_mem->ca_ckpntData == ck_mem) || (ca_mem->ca_ckpntData == older))
+  {
+    ca_mem->ca_ckpntData = NULL;
+  }
+
+  CVAckpntDelete(prev);
+  ca_mem->ca_nckpnts--;
+}
+
+/*
+ * CVAckpntThin
+ *
+ * This routine reduces the number of check points to at most
+ * maxckpnts by repeatedly merging the pair of neighboring intervals
+ * with the fewest steps. The check point at t_initial is always
+ * kept. The resulting intervals are multiples of nsteps steps of
+ * roughly equal length.
+ */
+
+static void CVAckpntThin(CVadjMem ca_mem, int maxckpnts)
+{
+  CVckpntMem ck_mem, ck_min;
+  long int len, lenmin;
+
+  while (ca_mem->ca_nckpnts + 1 > maxckpnts)
+  {
+    ck_min = NULL;
+    lenmin = 0;
+
+    for (ck_mem = ca_mem->ck_mem; ck_mem->ck_next != NULL;
+         ck_mem = ck_mem->ck_next)
+    {
+      len = ck_mem->ck_nst1 - ck_mem->ck_next->ck_nst;
+      if ((ck_min == NULL) || (len < lenmin))
+      {
+        ck_min = ck_mem;
+        lenmin = len;
+      }
+    }
+
+    if (ck_min == NULL) { break; }
+
+    CVAckpntMerge(ca_mem, ck_min);
+  }
+}
+
+/*
+ * CVAckpntEnd
+ *
+ * This routine returns the end of the part of the interval of
+ * ck_mem that the current backward sweep still has to cover.
+ */
+
+static void CVAckpntEnd(CVadjMem ca_mem, CVckpntMem ck_mem, sunrealtype* t1,
+                        long int* nst1)
+{
+  if (ck_mem == ca_mem->ca_ckpntEnd)
+  {
+    *t1   = ca_mem->ca_tEnd;
+    *nst1 = ca_mem->ca_nstEnd;
+  }
+  else
+  {
+    *t1   = ck_mem->ck_t1;
+    *nst1 = ck_mem->ck_nst1;
+  }
+}
+
 /*
  * =================================================================
  * PRIVATE FUNCTIONS FOR BACKWARD PROBLEMS
@@ -2313,6 +2501,141 @@ static void CVAbckpbDelete(CVodeBMem* cvB_memPtr)
  * =================================================================
  */
 
+/*
+ * CVArevolve
+ *
+ * When the number of check points is limited, the interval of the
+ * check point ck_mem may span more than nsteps steps. This routine
+ * then recomputes the forward solution from ck_mem and inserts
+ * temporary check points at multiples of nsteps steps until the
+ * newest interval can be stored in dt_mem. The positions follow the
+ * binomial (revolve) schedule for the number of free check points:
+ * with s free check points and an interval of K segments, let r be
+ * the smallest integer with C(s+r,s) >= K; the new check point is
+ * placed K - C(s+r-1,s-1) segments after ck_mem. On return, ck_mem
+ * points to the newest check point.
+ *
+ * Return values:
+ * CV_SUCCESS
+ * CV_REIFWD_FAIL
+ * CV_FWD_FAIL
+ * CV_MEM_FAIL
+ */
+
+static int CVArevolve(CVodeMem cv_mem, CVckpntMem* ck_memPtr)
+{
+  CVadjMem ca_mem;
+  CVckpntMem ck_mem, tmp;
+  CVckpntMem* prev;
+  sunrealtype t, t1;
+  long int nst0, nst1, nseg, nfree, beta, r, m;
+  int flag;
+
+  ca_mem = cv_mem->cv_adj_mem;
+  ck_mem = *ck_memPtr;
+
+  for (;;)
+  {
+    /* Number of nsteps segments in the remaining interval */
+    CVAckpntEnd(ca_mem, ck_mem, &t1, &nst1);
+    nseg = (nst1 - ck_mem->ck_nst + ca_mem->ca_nsteps - 1) / ca_mem->ca_nsteps;
+    if (nseg <= 1) { break; }
+
+    /* Number of free check points */
+    if (ca_mem->ca_maxckpnts > 0)
+    {
+      nfree = ca_mem->ca_maxckpnts - (ca_mem->ca_nckpnts + 1);
+    }
+    else { nfree = nseg - 1; }
+
+    if (nfree < 1)
+    {
+      /* Make room by merging an older temporary check point or, as a
+         last resort, the current one into the next check point */
+      for (tmp = ck_mem->ck_next; tmp != NULL; tmp = tmp->ck_next)
+      {
+        if (tmp->ck_tmp) { break; }
+      }
+
+      if (tmp != NULL) { CVAckpntMerge(ca_mem, tmp); }
+      else if (ck_mem->ck_tmp)
+      {
+        tmp = ck_mem->ck_next;
+        CVAckpntMerge(ca_mem, ck_mem);
+        ck_mem = tmp;
+      }
+      else { return (CV_REIFWD_FAIL); }
+
+      continue;
+    }
+
+    /* Revolve split: beta = C(nfree+r, nfree) >= nseg */
+    beta = 1;
+    r    = 0;
+    while (beta < nseg)
+    {
+      r++;
+      beta = beta * (nfree + r) / r;
+    }
+    m = nseg - beta * nfree / (nfree + r);
+    if (m < 1) { m = 1; }
+
+    /* Recompute the forward solution up to the new check point */
+    flag = CVAckpntGet(cv_mem, ck_mem);
+    if (flag != CV_SUCCESS) { return (CV_REIFWD_FAIL); }
+
+    if (ca_mem->ca_tstopCVodeFcall)
+    {
+      CVodeSetStopTime(cv_mem, ca_mem->ca_tstopCVodeF);
+    }
+
+    nst0 = cv_mem->cv_nst;
+
+    while (cv_mem->cv_nst < ck_mem->ck_nst + m * ca_mem->ca_nsteps)
+    {
+      flag = CVode(cv_mem, t1, ca_mem->ca_ytmp, &t, CV_ONE_STEP);
+      if (flag < 0) { return (CV_FWD_FAIL); }
+
+      /* CVodeF forced a setup at every multiple of nsteps */
+      if (cv_mem->cv_nst % ca_mem->ca_nsteps == 0)
+      {
+        cv_mem->cv_forceSetup = SUNTRUE;
+      }
+    }
+
+    ca_mem->ca_nstRecomp += cv_mem->cv_nst - nst0;
+
+    /* Create the temporary check point and insert it before ck_mem */
+    tmp = CVAckpntNew(cv_mem);
+    if (tmp == NULL) { return (CV_MEM_FAIL); }
+
+    tmp->ck_tmp     = SUNTRUE;
+    tmp->ck_t1      = ck_mem->ck_t1;
+    tmp->ck_nst1    = ck_mem->ck_nst1;
+    ck_mem->ck_t1   = tmp->ck_t0;
+    ck_mem->ck_nst1 = tmp->ck_nst;
+
+    prev = &(ca_mem->ck_mem);
+    while (*prev != ck_mem) { prev = &((*prev)->ck_next); }
+    tmp->ck_next = ck_mem;
+    *prev        = tmp;
+
+    if (ca_mem->ca_ckpntEnd == ck_mem) { ca_mem->ca_ckpntEnd = tmp; }
+
+    ca_mem->ca_nckpnts++;
+    if (ca_mem->ca_nckpnts + 1 > ca_mem->ca_nckpntsMax)
+    {
+      ca_mem->ca_nckpntsMax = ca_mem->ca_nckpnts + 1;
+    }
+
+    ck_mem = tmp;
+  }
+
+  *ck_memPtr = ck_mem;
+
+  return (CV_SUCCESS);
+}
+
 /*
  * CVAdataStore
  *
@@ -2329,13 +2652,16 @@ static int CVAdataStore(CVodeMem cv_mem, CVckpntMem ck_mem)
 {
   CVadjMem ca_mem;
   CVdtpntMem* dt_mem;
-  sunrealtype t;
-  long int i;
+  sunrealtype t, t1;
+  long int i, nst1;
   int flag, sign;
 
   ca_mem = cv_mem->cv_adj_mem;
   dt_mem = ca_mem->dt_mem;
 
+  /* End of the part of the interval still needed by the backward sweep */
+  CVAckpntEnd(ca_mem, ck_mem, &t1, &nst1);
+
   /* Initialize cv_mem with data from ck_mem */
   flag = CVAckpntGet(cv_mem, ck_mem);
   if (flag != CV_SUCCESS) { return (CV_REIFWD_FAIL); }
@@ -2355,14 +2681,16 @@ static int CVAdataStore(CVodeMem cv_mem, CVckpntMem ck_mem)
   /* Run CVode to set following structures in dt_mem[i] */
   i = 1;
   do {
-    flag = CVode(cv_mem, ck_mem->ck_t1, ca_mem->ca_ytmp, &t, CV_ONE_STEP);
+    flag = CVode(cv_mem, t1, ca_mem->ca_ytmp, &t, CV_ONE_STEP);
     if (flag < 0) { return (CV_FWD_FAIL); }
 
     dt_mem[i]->t = t;
     ca_mem->ca_IMstore(cv_mem, dt_mem[i]);
     i++;
   }
-  while (sign * (ck_mem->ck_t1 - t) > ZERO);
+  while (sign * (t1 - t) > ZERO);
+
+  ca_mem->ca_nstStore += cv_mem->cv_nst - ck_mem->ck_nst;
 
   ca_mem->ca_IMnewData = SUNTRUE; /* New data is now available    */
   ca_mem->ca_ckpntData = ck_mem;  /* starting at this check point */
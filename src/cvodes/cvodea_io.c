@@ -78,6 +78,41 @@ int CVodeSetAdjNoSensi(void* cvode_mem)
   return (CV_SUCCESS);
 }
 
+int CVodeSetAdjMaxCheckPoints(void* cvode_mem, int maxckpnts)
+{
+  CVodeMem cv_mem;
+  CVadjMem ca_mem;
+
+  /* Check if cvode_mem exists */
+  if (cvode_mem == NULL)
+  {
+    cvProcessError(NULL, CV_MEM_NULL, __LINE__, __func__, __FILE__, MSGCV_NO_MEM);
+    return (CV_MEM_NULL);
+  }
+  cv_mem = (CVodeMem)cvode_mem;
+
+  /* Was ASA initialized? */
+  if (cv_mem->cv_adjMallocDone == SUNFALSE)
+  {
+    cvProcessError(cv_mem, CV_NO_ADJ, __LINE__, __func__, __FILE__, MSGCV_NO_ADJ);
+    return (CV_NO_ADJ);
+  }
+  ca_mem = cv_mem->cv_adj_mem;
+
+  /* The check point at t_initial, the newest one, and at least one for
+     recomputation are needed */
+  if ((maxckpnts < 0) || (maxckpnts == 1) || (maxckpnts == 2))
+  {
+    cvProcessError(cv_mem, CV_ILL_INPUT, __LINE__, __func__, __FILE__,
+                   MSGCV_BAD_MAXCKPNTS);
+    return (CV_ILL_INPUT);
+  }
+
+  ca_mem->ca_maxckpnts = maxckpnts;
+
+  return (CV_SUCCESS);
+}
+
 /*
  * -----------------------------------------------------------------
  * Optional input functions for backward integration
@@ -661,6 +696,43 @@ int CVodeGetAdjCheckPointsInfo(void* cvode_mem, CVadjCheckPointRec* ckpnt)
   return (CV_SUCCESS);
 }
 
+/*
+ * CVodeGetAdjCheckPointStats
+ *
+ * This routine returns the number of forward steps retaken to store
+ * interpolation data, the number of forward steps retaken only to
+ * reach check points, and the largest number of check points held.
+ */
+
+int CVodeGetAdjCheckPointStats(void* cvode_mem, long int* nststore,
+                               long int* nstrecomp, int* nckpntsmax)
+{
+  CVodeMem cv_mem;
+  CVadjMem ca_mem;
+
+  /* Check if cvode_mem exists */
+  if (cvode_mem == NULL)
+  {
+    cvProcessError(NULL, CV_MEM_NULL, __LINE__, __func__, __FILE__, MSGCV_NO_MEM);
+    return (CV_MEM_NULL);
+  }
+  cv_mem = (CVodeMem)cvode_mem;
+
+  /* Was ASA initialized? */
+  if (cv_mem->cv_adjMallocDone == SUNFALSE)
+  {
+    cvProcessError(cv_mem, CV_NO_ADJ, __LINE__, __func__, __FILE__, MSGCV_NO_ADJ);
+    return (CV_NO_ADJ);
+  }
+  ca_mem = cv_mem->cv_adj_mem;
+
+  *nststore   = ca_mem->ca_nstStore;
+  *nstrecomp  = ca_mem->ca_nstRecomp;
+  *nckpntsmax = ca_mem->ca_nckpntsMax;
+
+  return (CV_SUCCESS);
+}
+
 /*
  * -----------------------------------------------------------------
  * Undocumented Development User-Callable Functions
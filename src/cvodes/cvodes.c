@@ -192,6 +192,10 @@
 #include <sundials/sundials_types.h>
 #include <sunnonlinsol/sunnonlinsol_newton.h>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include "cvodes_impl.h"
 #include "sundials/priv/sundials_errors_impl.h"
 #include "sundials/sundials_context.h"
@@ -282,6 +286,10 @@
  *
  *    FUZZ_FACTOR fuzz factor used to estimate infinitesimal time intervals
  *
+ * CVodeGetDkyBatch
+ *
+ *    DKY_BATCH   number of output times evaluated per pass over zn
+ *
  * cvHin
  *
  *    HLB_FACTOR  factor for upper bound on initial step size
@@ -297,6 +305,8 @@
 
 #define FUZZ_FACTOR SUN_RCONST(100.0)
 
+#define DKY_BATCH 32
+
 #define HLB_FACTOR SUN_RCONST(100.0)
 #define HUB_FACTOR SUN_RCONST(0.1)
 #define H_BIAS     HALF
@@ -324,6 +334,10 @@ static void cvQuadFreeVectors(CVodeMem cv_mem);
 
 static sunbooleantype cvSensAllocVectors(CVodeMem cv_mem, N_Vector tmpl);
 static void cvSensFreeVectors(CVodeMem cv_mem);
+static void cvSensFreeThreadVectors(CVodeMem cv_mem);
+static sunbooleantype cvSensThreadSetup(CVodeMem cv_mem);
+static void cvSensFreeBatchVectors(CVodeMem cv_mem);
+static sunbooleantype cvSensBatchSetup(CVodeMem cv_mem);
 
 static sunbooleantype cvQuadSensAllocVectors(CVodeMem cv_mem, N_Vector tmpl);
 static void cvQuadSensFreeVectors(CVodeMem cv_mem);
@@ -434,6 +448,21 @@ static sunrealtype cvQuadSensUpdateNorm(CVodeMem cv_mem, sunrealtype old_nrm,
 
 /* Internal sensitivity RHS DQ functions */
 
+static int cvSensDQMethod(CVodeMem cv_mem, int is, N_Vector yS,
+                          sunrealtype* Deltay, sunrealtype* rDeltay,
+                          sunrealtype* Deltap);
+static int cvSensRhs1DQ(CVodeMem cv_mem, sunrealtype t, N_Vector y,
+                        N_Vector ydot, int is, N_Vector yS, N_Vector ySdot,
+                        N_Vector ytemp, N_Vector ftemp, sunrealtype* p,
+                        void* user_data, sunbooleantype ydone, long int* nfeS);
+static int cvSensRhsThreads(CVodeMem cv_mem, sunrealtype time, N_Vector ycur,
+                            N_Vector fcur, N_Vector* yScur, N_Vector* fScur);
+static int cvSensRhsBatchDQ(CVodeMem cv_mem, sunrealtype t, N_Vector y,
+                            N_Vector ydot, N_Vector* yS, N_Vector* ySdot,
+                            N_Vector ytemp, N_Vector ftemp);
+static int cvSensRhsBatchEval(CVodeMem cv_mem, sunrealtype t, N_Vector ydot,
+                              N_Vector* ySdot, int nbatch);
+
 static int cvQuadSensRhsInternalDQ(int Ns, sunrealtype t, N_Vector y,
                                    N_Vector* yS, N_Vector yQdot, N_Vector* yQSdot,
                                    void* cvode_mem, N_Vector tmp, N_Vector tmpQ);
@@ -582,6 +611,19 @@ void* CVodeCreate(int lmm, SUNContext sunctx)
   cv_mem->cv_pbar      = NULL;
   cv_mem->cv_plist     = NULL;
   cv_mem->cv_errconS   = SUNFALSE;
+  cv_mem->cv_nsensthreads   = 1;
+  cv_mem->cv_nsensthr_alloc = 0;
+  cv_mem->cv_tempSthr       = NULL;
+  cv_mem->cv_flagS          = NULL;
+  cv_mem->cv_user_dataSthr  = NULL;
+  cv_mem->cv_pSthr          = NULL;
+  cv_mem->cv_fbatchS        = NULL;
+  cv_mem->cv_maxbatchS      = 0;
+  cv_mem->cv_nbatchS_alloc  = 0;
+  cv_mem->cv_ybatchS        = NULL;
+  cv_mem->cv_fvbatchS       = NULL;
+  cv_mem->cv_isbatchS       = NULL;
+  cv_mem->cv_cbatchS        = NULL;
   cv_mem->cv_ncfS1     = NULL;
   cv_mem->cv_ncfnS1    = NULL;
   cv_mem->cv_nniS1     = NULL;
@@ -3817,6 +3859,128 @@ int CVodeGetDky(void* cvode_mem, sunrealtype t, int k, N_Vector dky)
   return (CV_SUCCESS);
 }
 
+/*
+ * CVodeGetDkyBatch
+ *
+ * This routine computes the k-th derivative of the interpolating
+ * polynomial at the nt times t[i] and stores the results in the
+ * vectors dky[i]. All times are checked before any output is
+ * computed. The times are processed in groups of DKY_BATCH and,
+ * for each group, every column of the Nordsieck history array is
+ * applied to all outputs of the group with a single call to
+ * N_VScaleAddMulti, instead of one linear combination per time.
+ * The factor h^(-k) is folded into the coefficients.
+ */
+
+int CVodeGetDkyBatch(void* cvode_mem, int nt, sunrealtype* t, int k,
+                     N_Vector* dky)
+{
+  sunrealtype s, r;
+  sunrealtype tfuzz, tp, tn1;
+  sunrealtype cvals[L_MAX * DKY_BATCH];
+  int i, j, l, i0, nb, ier;
+  CVodeMem cv_mem;
+
+  /* Check all inputs for legality */
+
+  if (cvode_mem == NULL)
+  {
+    cvProcessError(NULL, CV_MEM_NULL, __LINE__, __func__, __FILE__, MSGCV_NO_MEM);
+    return (CV_MEM_NULL);
+  }
+  cv_mem = (CVodeMem)cvode_mem;
+
+  SUNDIALS_MARK_FUNCTION_BEGIN(CV_PROFILER);
+
+  if ((nt < 1) || (t == NULL))
+  {
+    cvProcessError(cv_mem, CV_ILL_INPUT, __LINE__, __func__, __FILE__,
+                   MSGCV_BAD_NT);
+    SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+    return (CV_ILL_INPUT);
+  }
+
+  if (dky == NULL)
+  {
+    cvProcessError(cv_mem, CV_BAD_DKY, __LINE__, __func__, __FILE__,
+                   MSGCV_NULL_DKY);
+    SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+    return (CV_BAD_DKY);
+  }
+
+  if ((k < 0) || (k > cv_mem->cv_q))
+  {
+    cvProcessError(cv_mem, CV_BAD_K, __LINE__, __func__, __FILE__, MSGCV_BAD_K);
+    SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+    return (CV_BAD_K);
+  }
+
+  /* Allow for some slack */
+  tfuzz = FUZZ_FACTOR * cv_mem->cv_uround *
+          (SUNRabs(cv_mem->cv_tn) + SUNRabs(cv_mem->cv_hu));
+  if (cv_mem->cv_hu < ZERO) { tfuzz = -tfuzz; }
+  tp  = cv_mem->cv_tn - cv_mem->cv_hu - tfuzz;
+  tn1 = cv_mem->cv_tn + tfuzz;
+
+  for (i = 0; i < nt; i++)
+  {
+    if (dky[i] == NULL)
+    {
+      cvProcessError(cv_mem, CV_BAD_DKY, __LINE__, __func__, __FILE__,
+                     MSGCV_NULL_DKY);
+      SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+      return (CV_BAD_DKY);
+    }
+    if ((t[i] - tp) * (t[i] - tn1) > ZERO)
+    {
+      cvProcessError(cv_mem, CV_BAD_T, __LINE__, __func__, __FILE__,
+                     MSGCV_BAD_T, t[i], cv_mem->cv_tn - cv_mem->cv_hu,
+                     cv_mem->cv_tn);
+      SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+      return (CV_BAD_T);
+    }
+  }
+
+  r = (k == 0) ? ONE : SUNRpowerI(cv_mem->cv_h, -k);
+
+  for (i0 = 0; i0 < nt; i0 += DKY_BATCH)
+  {
+    nb = SUNMIN(DKY_BATCH, nt - i0);
+
+    /* Coefficients of zn[j] for each time, stored by column j */
+    for (i = 0; i < nb; i++)
+    {
+      s = (t[i0 + i] - cv_mem->cv_tn) / cv_mem->cv_h;
+      for (j = cv_mem->cv_q; j >= k; j--)
+      {
+        cvals[j * nb + i] = r;
+        for (l = j; l >= j - k + 1; l--) { cvals[j * nb + i] *= l; }
+        for (l = 0; l < j - k; l++) { cvals[j * nb + i] *= s; }
+      }
+    }
+
+    /* Sum the differentiated interpolating polynomials */
+    for (i = 0; i < nb; i++)
+    {
+      N_VScale(cvals[cv_mem->cv_q * nb + i], cv_mem->cv_zn[cv_mem->cv_q],
+               dky[i0 + i]);
+    }
+    for (j = cv_mem->cv_q - 1; j >= k; j--)
+    {
+      ier = N_VScaleAddMulti(nb, cvals + j * nb, cv_mem->cv_zn[j], dky + i0,
+                             dky + i0);
+      if (ier != CV_SUCCESS)
+      {
+        SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+        return (CV_VECTOROP_ERR);
+      }
+    }
+  }
+
+  SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+  return (CV_SUCCESS);
+}
+
 /*
  * CVodeGetQuad
  *
@@ -4996,6 +5160,149 @@ static void cvSensFreeVectors(CVodeMem cv_mem)
   }
   cv_mem->cv_VabstolSMallocDone = SUNFALSE;
   cv_mem->cv_SabstolSMallocDone = SUNFALSE;
+
+  cvSensFreeThreadVectors(cv_mem);
+  cvSensFreeBatchVectors(cv_mem);
+}
+
+/*
+ * cvSensFreeThreadVectors
+ *
+ * This routine frees the workspace allocated in cvSensThreadSetup.
+ */
+
+static void cvSensFreeThreadVectors(CVodeMem cv_mem)
+{
+  if (cv_mem->cv_tempSthr != NULL)
+  {
+    N_VDestroyVectorArray(cv_mem->cv_tempSthr, 2 * cv_mem->cv_nsensthr_alloc);
+    cv_mem->cv_tempSthr = NULL;
+    cv_mem->cv_lrw -= 2 * cv_mem->cv_nsensthr_alloc * cv_mem->cv_lrw1;
+    cv_mem->cv_liw -= 2 * cv_mem->cv_nsensthr_alloc * cv_mem->cv_liw1;
+  }
+  if (cv_mem->cv_flagS != NULL)
+  {
+    free(cv_mem->cv_flagS);
+    cv_mem->cv_flagS = NULL;
+    cv_mem->cv_liw -= cv_mem->cv_Ns;
+  }
+  cv_mem->cv_nsensthr_alloc = 0;
+}
+
+/*
+ * cvSensThreadSetup
+ *
+ * This routine (re)allocates the per-thread temporary vectors and the
+ * per-sensitivity return flags used when the sensitivity RHS functions are
+ * evaluated concurrently. It returns SUNTRUE if the workspace matches the
+ * requested number of threads and SUNFALSE otherwise, in which case the
+ * sensitivities are evaluated sequentially. The internal DQ approximation
+ * is only evaluated concurrently if each thread has its own parameters.
+ */
+
+static sunbooleantype cvSensThreadSetup(CVodeMem cv_mem)
+{
+  int nthreads = cv_mem->cv_nsensthreads;
+
+  if (nthreads < 2) { return SUNFALSE; }
+  if (cv_mem->cv_fSDQ && (cv_mem->cv_pSthr == NULL)) { return SUNFALSE; }
+  if (cv_mem->cv_nsensthr_alloc == nthreads) { return SUNTRUE; }
+
+  cvSensFreeThreadVectors(cv_mem);
+
+  cv_mem->cv_tempSthr = N_VCloneVectorArray(2 * nthreads, cv_mem->cv_tempv);
+  if (cv_mem->cv_tempSthr == NULL) { return SUNFALSE; }
+
+  cv_mem->cv_flagS = (int*)malloc(cv_mem->cv_Ns * sizeof(int));
+  if (cv_mem->cv_flagS == NULL)
+  {
+    N_VDestroyVectorArray(cv_mem->cv_tempSthr, 2 * nthreads);
+    cv_mem->cv_tempSthr = NULL;
+    return SUNFALSE;
+  }
+
+  cv_mem->cv_nsensthr_alloc = nthreads;
+  cv_mem->cv_lrw += 2 * nthreads * cv_mem->cv_lrw1;
+  cv_mem->cv_liw += 2 * nthreads * cv_mem->cv_liw1 + cv_mem->cv_Ns;
+
+  return SUNTRUE;
+}
+
+/*
+ * cvSensFreeBatchVectors
+ *
+ * This routine frees the workspace allocated in cvSensBatchSetup.
+ */
+
+static void cvSensFreeBatchVectors(CVodeMem cv_mem)
+{
+  int nbatch = cv_mem->cv_nbatchS_alloc;
+
+  if (nbatch == 0) { return; }
+
+  N_VDestroyVectorArray(cv_mem->cv_ybatchS, nbatch);
+  N_VDestroyVectorArray(cv_mem->cv_fvbatchS, nbatch);
+  free(cv_mem->cv_isbatchS);
+  free(cv_mem->cv_cbatchS);
+  cv_mem->cv_ybatchS  = NULL;
+  cv_mem->cv_fvbatchS = NULL;
+  cv_mem->cv_isbatchS = NULL;
+  cv_mem->cv_cbatchS  = NULL;
+
+  cv_mem->cv_lrw -= nbatch * (2 * cv_mem->cv_lrw1 + 1);
+  cv_mem->cv_liw -= nbatch * (2 * cv_mem->cv_liw1 + 1);
+  cv_mem->cv_nbatchS_alloc = 0;
+}
+
+/*
+ * cvSensBatchSetup
+ *
+ * This routine (re)allocates the perturbed states, their RHS values, and
+ * the bookkeeping arrays used when the internal DQ sensitivity RHS is
+ * evaluated with a batched RHS function. It returns SUNTRUE if a batched
+ * RHS function is attached and the workspace matches its batch size, and
+ * SUNFALSE otherwise, in which case the perturbed states are evaluated one
+ * at a time.
+ */
+
+static sunbooleantype cvSensBatchSetup(CVodeMem cv_mem)
+{
+  int nbatch = cv_mem->cv_maxbatchS;
+
+  if (cv_mem->cv_fbatchS == NULL) { return SUNFALSE; }
+  if (cv_mem->cv_nbatchS_alloc == nbatch) { return SUNTRUE; }
+
+  cvSensFreeBatchVectors(cv_mem);
+
+  cv_mem->cv_ybatchS  = N_VCloneVectorArray(nbatch, cv_mem->cv_tempv);
+  cv_mem->cv_fvbatchS = N_VCloneVectorArray(nbatch, cv_mem->cv_tempv);
+  cv_mem->cv_isbatchS = (int*)malloc(nbatch * sizeof(int));
+  cv_mem->cv_cbatchS  = (sunrealtype*)malloc(nbatch * sizeof(sunrealtype));
+  if ((cv_mem->cv_ybatchS == NULL) || (cv_mem->cv_fvbatchS == NULL) ||
+      (cv_mem->cv_isbatchS == NULL) || (cv_mem->cv_cbatchS == NULL))
+  {
+    if (cv_mem->cv_ybatchS != NULL)
+    {
+      N_VDestroyVectorArray(cv_mem->cv_ybatchS, nbatch);
+    }
+    if (cv_mem->cv_fvbatchS != NULL)
+    {
+      N_VDestroyVectorArray(cv_mem->cv_fvbatchS, nbatch);
+    }
+    free(cv_mem->cv_isbatchS);
+    free(cv_mem->cv_cbatchS);
+    cv_mem->cv_ybatchS  = NULL;
+    cv_mem->cv_fvbatchS = NULL;
+    cv_mem->cv_isbatchS = NULL;
+    cv_mem->cv_cbatchS  = NULL;
+    return SUNFALSE;
+  }
+
+  cv_mem->cv_nbatchS_alloc = nbatch;
+  cv_mem->cv_lrw += nbatch * (2 * cv_mem->cv_lrw1 + 1);
+  cv_mem->cv_liw += nbatch * (2 * cv_mem->cv_liw1 + 1);
+
+  return SUNTRUE;
 }
 
 /*
@@ -9511,7 +9818,11 @@ static sunrealtype cvQuadSensUpdateNorm(CVodeMem cv_mem, sunrealtype old_nrm,
  * CVSensRhs is a high level routine that returns right hand side
  * of sensitivity equations. Depending on the 'ifS' flag, it either
  * calls directly the fS routine (ifS=CV_ALLSENS) or (if ifS=CV_ONESENS)
- * calls the fS1 routine in a loop over all sensitivities.
+ * calls the fS1 routine in a loop over all sensitivities. With the
+ * internal DQ approximation and a batched RHS function, the perturbed
+ * states are evaluated in batches by cvSensRhsBatchDQ. Otherwise, with
+ * more than one sensitivity thread, the sensitivities are evaluated
+ * concurrently by cvSensRhsThreads.
  *
  * CVSensRhs is called:
  *  (*) by CVode at the first step
@@ -9531,7 +9842,18 @@ int cvSensRhsWrapper(CVodeMem cv_mem, sunrealtype time, N_Vector ycur,
 {
   int retval = 0, is;
 
-  if (cv_mem->cv_ifS == CV_ALLSENS)
+  if (cv_mem->cv_fSDQ && cvSensBatchSetup(cv_mem))
+  {
+    retval = cvSensRhsBatchDQ(cv_mem, time, ycur, fcur, yScur, fScur, temp1,
+                              temp2);
+    cv_mem->cv_nfSe += (cv_mem->cv_ifS == CV_ALLSENS) ? 1 : cv_mem->cv_Ns;
+  }
+  else if ((cv_mem->cv_fSDQ || (cv_mem->cv_ifS == CV_ONESENS)) &&
+           cvSensThreadSetup(cv_mem))
+  {
+    retval = cvSensRhsThreads(cv_mem, time, ycur, fcur, yScur, fScur);
+  }
+  else if (cv_mem->cv_ifS == CV_ALLSENS)
   {
     retval = cv_mem->cv_fS(cv_mem->cv_Ns, time, ycur, fcur, yScur, fScur,
                            cv_mem->cv_fS_data, temp1, temp2);
@@ -9551,6 +9873,74 @@ int cvSensRhsWrapper(CVodeMem cv_mem, sunrealtype time, N_Vector ycur,
   return (retval);
 }
 
+/*
+ * cvSensRhsThreads
+ *
+ * cvSensRhsThreads evaluates the fS1 routine for all sensitivities
+ * concurrently. Each thread uses its own temporary vectors and, with the
+ * internal DQ approximation, perturbs its own copy of the parameters. The
+ * return value is that of the first failed sensitivity in order.
+ */
+
+static int cvSensRhsThreads(CVodeMem cv_mem, sunrealtype time, N_Vector ycur,
+                            N_Vector fcur, N_Vector* yScur, N_Vector* fScur)
+{
+  long int nfeS = 0;
+  int retval = 0, is, it, which;
+
+  /* the copies start from the current values of the parameters */
+  if (cv_mem->cv_fSDQ)
+  {
+    for (it = 0; it < cv_mem->cv_nsensthreads; it++)
+    {
+      for (is = 0; is < cv_mem->cv_Ns; is++)
+      {
+        which                       = cv_mem->cv_plist[is];
+        cv_mem->cv_pSthr[it][which] = cv_mem->cv_p[which];
+      }
+    }
+  }
+
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(cv_mem->cv_nsensthreads) \
+  schedule(static) reduction(+ : nfeS)
+#endif
+  for (is = 0; is < cv_mem->cv_Ns; is++)
+  {
+    int tid = 0;
+#ifdef _OPENMP
+    tid = omp_get_thread_num();
+#endif
+    if (cv_mem->cv_fSDQ)
+    {
+      cv_mem->cv_flagS[is] =
+        cvSensRhs1DQ(cv_mem, time, ycur, fcur, is, yScur[is], fScur[is],
+                     cv_mem->cv_tempSthr[2 * tid],
+                     cv_mem->cv_tempSthr[2 * tid + 1], cv_mem->cv_pSthr[tid],
+                     cv_mem->cv_user_dataSthr[tid], SUNFALSE, &nfeS);
+    }
+    else
+    {
+      cv_mem->cv_flagS[is] =
+        cv_mem->cv_fS1(cv_mem->cv_Ns, time, ycur, fcur, is, yScur[is],
+                       fScur[is], cv_mem->cv_fS_data,
+                       cv_mem->cv_tempSthr[2 * tid],
+                       cv_mem->cv_tempSthr[2 * tid + 1]);
+    }
+  }
+  cv_mem->cv_nfSe += (cv_mem->cv_ifS == CV_ALLSENS) ? 1 : cv_mem->cv_Ns;
+  cv_mem->cv_nfeS += nfeS;
+
+  /* report the first failure in sensitivity order */
+  for (is = 0; is < cv_mem->cv_Ns; is++)
+  {
+    retval = cv_mem->cv_flagS[is];
+    if (retval != 0) { break; }
+  }
+
+  return (retval);
+}
+
 /*
  * cvSensRhs1Wrapper
  *
@@ -9625,52 +10015,48 @@ int cvSensRhs1InternalDQ(SUNDIALS_MAYBE_UNUSED int Ns, sunrealtype t, N_Vector y
                          void* cvode_mem, N_Vector ytemp, N_Vector ftemp)
 {
   CVodeMem cv_mem;
+
+  /* cvode_mem is passed here as user data */
+  cv_mem = (CVodeMem)cvode_mem;
+
+  return (cvSensRhs1DQ(cv_mem, t, y, ydot, is, yS, ySdot, ytemp, ftemp,
+                       cv_mem->cv_p, cv_mem->cv_user_data, SUNFALSE,
+                       &cv_mem->cv_nfeS));
+}
+
+/*
+ * cvSensRhs1DQ
+ *
+ * cvSensRhs1DQ does the work of cvSensRhs1InternalDQ. The parameter
+ * array p is perturbed in place and f is called with user_data, which
+ * must give f access to p. The number of calls to f is added to nfeS.
+ * If ydone is SUNTRUE and the separate DQ approximation is used, ySdot
+ * already holds the difference quotient in the direction of yS (see
+ * cvSensRhsBatchDQ) and only the parameter is perturbed.
+ */
+
+static int cvSensRhs1DQ(CVodeMem cv_mem, sunrealtype t, N_Vector y,
+                        N_Vector ydot, int is, N_Vector yS, N_Vector ySdot,
+                        N_Vector ytemp, N_Vector ftemp, sunrealtype* p,
+                        void* user_data, sunbooleantype ydone, long int* nfeS)
+{
   int retval, method;
   int nfel = 0, which;
-  sunrealtype psave, pbari;
-  sunrealtype delta, rdelta;
+  sunrealtype psave;
   sunrealtype Deltap, rDeltap, r2Deltap;
   sunrealtype Deltay, rDeltay, r2Deltay;
   sunrealtype Delta, rDelta, r2Delta;
-  sunrealtype norms, ratio;
 
   /* local variables for fused vector operations */
   sunrealtype cvals[3];
   N_Vector Xvecs[3];
 
-  /* cvode_mem is passed here as user data */
-  cv_mem = (CVodeMem)cvode_mem;
-
-  delta  = SUNRsqrt(SUNMAX(cv_mem->cv_reltol, cv_mem->cv_uround));
-  rdelta = ONE / delta;
-
-  pbari = cv_mem->cv_pbar[is];
-
   which = cv_mem->cv_plist[is];
 
-  psave = cv_mem->cv_p[which];
+  psave = p[which];
 
-  Deltap  = pbari * delta;
+  method  = cvSensDQMethod(cv_mem, is, yS, &Deltay, &rDeltay, &Deltap);
   rDeltap = ONE / Deltap;
-  norms   = N_VWrmsNorm(yS, cv_mem->cv_ewt) * pbari;
-  rDeltay = SUNMAX(norms, rdelta) / pbari;
-  Deltay  = ONE / rDeltay;
-
-  if (cv_mem->cv_DQrhomax == ZERO)
-  {
-    /* No switching */
-    method = (cv_mem->cv_DQtype == CV_CENTERED) ? CENTERED1 : FORWARD1;
-  }
-  else
-  {
-    /* switch between simultaneous/separate DQ */
-    ratio = Deltay * rDeltap;
-    if (SUNMAX(ONE / ratio, ratio) <= cv_mem->cv_DQrhomax)
-    {
-      method = (cv_mem->cv_DQtype == CV_CENTERED) ? CENTERED1 : FORWARD1;
-    }
-    else { method = (cv_mem->cv_DQtype == CV_CENTERED) ? CENTERED2 : FORWARD2; }
-  }
 
   switch (method)
   {
@@ -9680,16 +10066,16 @@ int cvSensRhs1InternalDQ(SUNDIALS_MAYBE_UNUSED int Ns, sunrealtype t, N_Vector y
     r2Delta = HALF / Delta;
 
     N_VLinearSum(ONE, y, Delta, yS, ytemp);
-    cv_mem->cv_p[which] = psave + Delta;
+    p[which] = psave + Delta;
 
-    retval = cv_mem->cv_f(t, ytemp, ySdot, cv_mem->cv_user_data);
+    retval = cv_mem->cv_f(t, ytemp, ySdot, user_data);
     nfel++;
     if (retval != 0) { return (retval); }
 
     N_VLinearSum(ONE, y, -Delta, yS, ytemp);
-    cv_mem->cv_p[which] = psave - Delta;
+    p[which] = psave - Delta;
 
-    retval = cv_mem->cv_f(t, ytemp, ftemp, cv_mem->cv_user_data);
+    retval = cv_mem->cv_f(t, ytemp, ftemp, user_data);
     nfel++;
     if (retval != 0) { return (retval); }
 
@@ -9702,27 +10088,30 @@ int cvSensRhs1InternalDQ(SUNDIALS_MAYBE_UNUSED int Ns, sunrealtype t, N_Vector y
     r2Deltap = HALF / Deltap;
     r2Deltay = HALF / Deltay;
 
-    N_VLinearSum(ONE, y, Deltay, yS, ytemp);
+    if (!ydone)
+    {
+      N_VLinearSum(ONE, y, Deltay, yS, ytemp);
 
-    retval = cv_mem->cv_f(t, ytemp, ySdot, cv_mem->cv_user_data);
-    nfel++;
-    if (retval != 0) { return (retval); }
+      retval = cv_mem->cv_f(t, ytemp, ySdot, user_data);
+      nfel++;
+      if (retval != 0) { return (retval); }
 
-    N_VLinearSum(ONE, y, -Deltay, yS, ytemp);
+      N_VLinearSum(ONE, y, -Deltay, yS, ytemp);
 
-    retval = cv_mem->cv_f(t, ytemp, ftemp, cv_mem->cv_user_data);
-    nfel++;
-    if (retval != 0) { return (retval); }
+      retval = cv_mem->cv_f(t, ytemp, ftemp, user_data);
+      nfel++;
+      if (retval != 0) { return (retval); }
 
-    N_VLinearSum(r2Deltay, ySdot, -r2Deltay, ftemp, ySdot);
+      N_VLinearSum(r2Deltay, ySdot, -r2Deltay, ftemp, ySdot);
+    }
 
-    cv_mem->cv_p[which] = psave + Deltap;
-    retval              = cv_mem->cv_f(t, y, ytemp, cv_mem->cv_user_data);
+    p[which] = psave + Deltap;
+    retval   = cv_mem->cv_f(t, y, ytemp, user_data);
     nfel++;
     if (retval != 0) { return (retval); }
 
-    cv_mem->cv_p[which] = psave - Deltap;
-    retval              = cv_mem->cv_f(t, y, ftemp, cv_mem->cv_user_data);
+    p[which] = psave - Deltap;
+    retval   = cv_mem->cv_f(t, y, ftemp, user_data);
     nfel++;
     if (retval != 0) { return (retval); }
 
@@ -9745,9 +10134,9 @@ int cvSensRhs1InternalDQ(SUNDIALS_MAYBE_UNUSED int Ns, sunrealtype t, N_Vector y
     rDelta = ONE / Delta;
 
     N_VLinearSum(ONE, y, Delta, yS, ytemp);
-    cv_mem->cv_p[which] = psave + Delta;
+    p[which] = psave + Delta;
 
-    retval = cv_mem->cv_f(t, ytemp, ySdot, cv_mem->cv_user_data);
+    retval = cv_mem->cv_f(t, ytemp, ySdot, user_data);
     nfel++;
     if (retval != 0) { return (retval); }
 
@@ -9757,16 +10146,19 @@ int cvSensRhs1InternalDQ(SUNDIALS_MAYBE_UNUSED int Ns, sunrealtype t, N_Vector y
 
   case FORWARD2:
 
-    N_VLinearSum(ONE, y, Deltay, yS, ytemp);
+    if (!ydone)
+    {
+      N_VLinearSum(ONE, y, Deltay, yS, ytemp);
 
-    retval = cv_mem->cv_f(t, ytemp, ySdot, cv_mem->cv_user_data);
-    nfel++;
-    if (retval != 0) { return (retval); }
+      retval = cv_mem->cv_f(t, ytemp, ySdot, user_data);
+      nfel++;
+      if (retval != 0) { return (retval); }
 
-    N_VLinearSum(rDeltay, ySdot, -rDeltay, ydot, ySdot);
+      N_VLinearSum(rDeltay, ySdot, -rDeltay, ydot, ySdot);
+    }
 
-    cv_mem->cv_p[which] = psave + Deltap;
-    retval              = cv_mem->cv_f(t, y, ytemp, cv_mem->cv_user_data);
+    p[which] = psave + Deltap;
+    retval   = cv_mem->cv_f(t, y, ytemp, user_data);
     nfel++;
     if (retval != 0) { return (retval); }
 
@@ -9784,10 +10176,149 @@ int cvSensRhs1InternalDQ(SUNDIALS_MAYBE_UNUSED int Ns, sunrealtype t, N_Vector y
     break;
   }
 
-  cv_mem->cv_p[which] = psave;
+  p[which] = psave;
 
   /* Increment counter nfeS */
-  cv_mem->cv_nfeS += nfel;
+  *nfeS += nfel;
+
+  return (0);
+}
+
+/*
+ * cvSensDQMethod
+ *
+ * cvSensDQMethod returns the DQ method used for the is-th sensitivity
+ * together with the increments in the directions of yS and p.
+ */
+
+static int cvSensDQMethod(CVodeMem cv_mem, int is, N_Vector yS,
+                          sunrealtype* Deltay, sunrealtype* rDeltay,
+                          sunrealtype* Deltap)
+{
+  sunrealtype delta, rdelta, pbari, norms, ratio;
+
+  delta  = SUNRsqrt(SUNMAX(cv_mem->cv_reltol, cv_mem->cv_uround));
+  rdelta = ONE / delta;
+
+  pbari = cv_mem->cv_pbar[is];
+
+  *Deltap  = pbari * delta;
+  norms    = N_VWrmsNorm(yS, cv_mem->cv_ewt) * pbari;
+  *rDeltay = SUNMAX(norms, rdelta) / pbari;
+  *Deltay  = ONE / *rDeltay;
+
+  if (cv_mem->cv_DQrhomax == ZERO)
+  {
+    /* No switching */
+    return ((cv_mem->cv_DQtype == CV_CENTERED) ? CENTERED1 : FORWARD1);
+  }
+
+  /* switch between simultaneous/separate DQ */
+  ratio = *Deltay * (ONE / *Deltap);
+  if (SUNMAX(ONE / ratio, ratio) <= cv_mem->cv_DQrhomax)
+  {
+    return ((cv_mem->cv_DQtype == CV_CENTERED) ? CENTERED1 : FORWARD1);
+  }
+  return ((cv_mem->cv_DQtype == CV_CENTERED) ? CENTERED2 : FORWARD2);
+}
+
+/*
+ * cvSensRhsBatchDQ
+ *
+ * cvSensRhsBatchDQ computes the right hand side of all sensitivity
+ * equations by finite differences, evaluating the states perturbed in the
+ * directions yS of all sensitivities that use the separate DQ methods
+ * (CENTERED2 and FORWARD2) in batches with the batched RHS function. The
+ * parameter perturbations, and the simultaneous methods (the default) that
+ * perturb the state and the parameter together, still call f once per
+ * evaluation since f only sees p through user_data.
+ */
+
+static int cvSensRhsBatchDQ(CVodeMem cv_mem, sunrealtype t, N_Vector y,
+                            N_Vector ydot, N_Vector* yS, N_Vector* ySdot,
+                            N_Vector ytemp, N_Vector ftemp)
+{
+  int is, k, nev, method, nbatch = 0, retval;
+  sunrealtype Deltay, rDeltay, Deltap, sign;
+
+  /* Queue the states perturbed in the directions of yS */
+  for (is = 0; is < cv_mem->cv_Ns; is++)
+  {
+    method = cvSensDQMethod(cv_mem, is, yS[is], &Deltay, &rDeltay, &Deltap);
+    if ((method == CENTERED1) || (method == FORWARD1)) { continue; }
+
+    nev = (method == CENTERED2) ? 2 : 1;
+    for (k = 0; k < nev; k++)
+    {
+      sign = (k == 0) ? ONE : -ONE;
+      N_VLinearSum(ONE, y, sign * Deltay, yS[is], cv_mem->cv_ybatchS[nbatch]);
+      cv_mem->cv_isbatchS[nbatch] = is;
+      cv_mem->cv_cbatchS[nbatch]  = (nev == 2) ? sign * (HALF / Deltay)
+                                               : rDeltay;
+      nbatch++;
+
+      if (nbatch == cv_mem->cv_maxbatchS)
+      {
+        retval = cvSensRhsBatchEval(cv_mem, t, ydot, ySdot, nbatch);
+        if (retval != 0) { return (retval); }
+        nbatch = 0;
+      }
+    }
+  }
+
+  if (nbatch > 0)
+  {
+    retval = cvSensRhsBatchEval(cv_mem, t, ydot, ySdot, nbatch);
+    if (retval != 0) { return (retval); }
+  }
+
+  /* Add the parameter perturbations (or do the simultaneous methods) */
+  for (is = 0; is < cv_mem->cv_Ns; is++)
+  {
+    retval = cvSensRhs1DQ(cv_mem, t, y, ydot, is, yS[is], ySdot[is], ytemp,
+                          ftemp, cv_mem->cv_p, cv_mem->cv_user_data, SUNTRUE,
+                          &cv_mem->cv_nfeS);
+    if (retval != 0) { return (retval); }
+  }
+
+  return (0);
+}
+
+/*
+ * cvSensRhsBatchEval
+ *
+ * cvSensRhsBatchEval evaluates the first nbatch queued states with the
+ * batched RHS function and forms the difference quotients in the
+ * directions of yS in ySdot. A positive coefficient marks the forward (or
+ * only) state of a sensitivity, a negative one the backward state of a
+ * centered difference, whose forward RHS value is kept in ySdot until then.
+ */
+
+static int cvSensRhsBatchEval(CVodeMem cv_mem, sunrealtype t, N_Vector ydot,
+                              N_Vector* ySdot, int nbatch)
+{
+  int b, is, retval;
+  sunrealtype c;
+
+  retval = cv_mem->cv_fbatchS(nbatch, t, cv_mem->cv_ybatchS,
+                              cv_mem->cv_fvbatchS, cv_mem->cv_user_data);
+  cv_mem->cv_nfeS += nbatch;
+  if (retval != 0) { return (retval); }
+
+  for (b = 0; b < nbatch; b++)
+  {
+    is = cv_mem->cv_isbatchS[b];
+    c  = cv_mem->cv_cbatchS[b];
+    if (c < ZERO)
+    {
+      N_VLinearSum(-c, ySdot[is], c, cv_mem->cv_fvbatchS[b], ySdot[is]);
+    }
+    else if (cv_mem->cv_DQtype == CV_CENTERED)
+    {
+      N_VScale(ONE, cv_mem->cv_fvbatchS[b], ySdot[is]);
+    }
+    else { N_VLinearSum(c, cv_mem->cv_fvbatchS[b], -c, ydot, ySdot[is]); }
+  }
 
   return (0);
 }
@@ -295,6 +295,21 @@ typedef struct CVodeMemRec
 
   sunbooleantype cv_errconS; /* SUNTRUE if yS are considered in err. control */
 
+  int cv_nsensthreads;       /* threads for the sensitivity RHS           */
+  int cv_nsensthr_alloc;     /* threads the workspace was allocated for   */
+  N_Vector* cv_tempSthr;     /* two temporary vectors per thread          */
+  int* cv_flagS;             /* return flag of each sensitivity           */
+  void** cv_user_dataSthr;   /* user data of each thread for internal DQ  */
+  sunrealtype** cv_pSthr;    /* parameters of each thread for internal DQ */
+
+  CVLsRhsBatchFn cv_fbatchS;  /* batched RHS for the internal DQ          */
+  int cv_maxbatchS;           /* max. states per call to fbatchS          */
+  int cv_nbatchS_alloc;       /* batch size the workspace was alloc. for  */
+  N_Vector* cv_ybatchS;       /* perturbed states                         */
+  N_Vector* cv_fvbatchS;      /* RHS values at the perturbed states       */
+  int* cv_isbatchS;           /* sensitivity of each perturbed state      */
+  sunrealtype* cv_cbatchS;    /* DQ coefficient of each perturbed state   */
+
   int cv_itolS;
   sunrealtype cv_reltolS;   /* relative tolerance for sensitivities         */
   sunrealtype* cv_SabstolS; /* scalar absolute tolerances for sensi.        */
@@ -710,6 +725,13 @@ struct CVckpntMemRec
   sunrealtype ck_t0;
   sunrealtype ck_t1;
 
+  /* Step counter at t1 */
+  long int ck_nst1;
+
+  /* Was this check point created while recomputing the forward
+     solution in CVodeB (i.e., is it not needed for later sweeps)? */
+  sunbooleantype ck_tmp;
+
   /* Nordsieck History Array */
   N_Vector ck_zn[L_MAX];
 
@@ -936,6 +958,20 @@ struct CVadjMemRec
   /* address of the check point structure for which data is available */
   struct CVckpntMemRec* ca_ckpntData;
 
+  /* Maximum number of check points held at any time (0 = no limit) */
+  int ca_maxckpnts;
+
+  /* Check point reached by the current backward sweep and the time and step
+     counter where the sweep entered it (its interval may extend further) */
+  struct CVckpntMemRec* ca_ckpntEnd;
+  sunrealtype ca_tEnd;
+  long int ca_nstEnd;
+
+  /* Checkpointing statistics */
+  long int ca_nstStore;   /* forward steps retaken to store data      */
+  long int ca_nstRecomp;  /* forward steps retaken to reach check pts */
+  int ca_nckpntsMax;      /* peak number of check points held         */
+
   /* ------------------
    * Interpolation data
    * ------------------ */
@@ -1244,6 +1280,7 @@ int cvSensRhs1InternalDQ(int Ns, sunrealtype t, N_Vector y, N_Vector ydot,
 #define MSGCV_BAD_CONSTR    "Illegal values in constraints vector."
 #define MSGCV_BAD_K         "Illegal value for k."
 #define MSGCV_NULL_DKY      "dky = NULL illegal."
+#define MSGCV_BAD_NT        "nt < 1 or t = NULL illegal."
 #define MSGCV_BAD_T         "Illegal value for t." MSG_TIME_INT
 #define MSGCV_NO_ROOT       "Rootfinding was not initialized."
 #define MSGCV_NLS_INIT_FAIL "The nonlinear solver's init routine failed."
@@ -1277,6 +1314,11 @@ int cvSensRhs1InternalDQ(int Ns, sunrealtype t, N_Vector y, N_Vector ydot,
 #define MSGCV_BAD_DQTYPE \
   "Illegal value for DQtype. Legal values are: CV_CENTERED and CV_FORWARD."
 #define MSGCV_BAD_DQRHO "DQrhomax < 0 illegal."
+#define MSGCV_SENS_THREADS                                          \
+  "Concurrent sensitivities require a thread-safe SUNContext when " \
+  "profiling or logging is enabled."
+#define MSGCV_NULL_PSTHR "user_data = NULL or p = NULL illegal."
+#define MSGCV_BAD_MAXBATCH "maxbatch < 1 illegal."
 
 #define MSGCV_BAD_ITOLQS \
   "Illegal value for itolQS. The legal values are CV_SS, CV_SV, and CV_EE."
@@ -1432,6 +1474,8 @@ int cvSensRhs1InternalDQ(int Ns, sunrealtype t, N_Vector y, N_Vector ydot,
 #define MSGCV_NO_ADJ     "Illegal attempt to call before calling CVodeAdjMalloc."
 #define MSGCV_BAD_STEPS  "Steps nonpositive illegal."
 #define MSGCV_BAD_INTERP "Illegal value for interp."
+#define MSGCV_BAD_MAXCKPNTS \
+  "maxckpnts must be zero (no limit) or at least 3."
 #define MSGCV_BAD_WHICH  "Illegal value for which."
 #define MSGCV_NO_BCK     "No backward problems have been defined yet."
 #define MSGCV_NO_FWD     "Illegal attempt to call before calling CVodeF."
@@ -1140,6 +1140,93 @@ int CVodeSetSensMaxNonlinIters(void* cvode_mem, int maxcorS)
 
 /*-----------------------------------------------------------------*/
 
+int CVodeSetSensNumThreads(void* cvode_mem, int nthreads)
+{
+  CVodeMem cv_mem;
+
+  if (cvode_mem == NULL)
+  {
+    cvProcessError(NULL, CV_MEM_NULL, __LINE__, __func__, __FILE__, MSGCV_NO_MEM);
+    return (CV_MEM_NULL);
+  }
+  cv_mem = (CVodeMem)cvode_mem;
+
+  /* Each thread calls the vector operations on the integrator's context */
+#if !defined(SUNDIALS_CONTEXT_SHARED_BY_THREADS)
+  if (nthreads > 1)
+  {
+    cvProcessError(cv_mem, CV_ILL_INPUT, __LINE__, __func__, __FILE__,
+                   MSGCV_SENS_THREADS);
+    return (CV_ILL_INPUT);
+  }
+#endif
+
+#ifdef _OPENMP
+  cv_mem->cv_nsensthreads = (nthreads > 1) ? nthreads : 1;
+#else
+  cv_mem->cv_nsensthreads = 1;
+#endif
+
+  return (CV_SUCCESS);
+}
+
+/*-----------------------------------------------------------------*/
+
+int CVodeSetSensThreadParams(void* cvode_mem, void** user_data,
+                             sunrealtype** p)
+{
+  CVodeMem cv_mem;
+
+  if (cvode_mem == NULL)
+  {
+    cvProcessError(NULL, CV_MEM_NULL, __LINE__, __func__, __FILE__, MSGCV_NO_MEM);
+    return (CV_MEM_NULL);
+  }
+  cv_mem = (CVodeMem)cvode_mem;
+
+  if ((user_data == NULL) != (p == NULL))
+  {
+    cvProcessError(cv_mem, CV_ILL_INPUT, __LINE__, __func__, __FILE__,
+                   MSGCV_NULL_PSTHR);
+    return (CV_ILL_INPUT);
+  }
+
+  cv_mem->cv_user_dataSthr = user_data;
+  cv_mem->cv_pSthr         = p;
+
+  return (CV_SUCCESS);
+}
+
+/*-----------------------------------------------------------------*/
+
+int CVodeSetSensRhsBatchFn(void* cvode_mem, CVLsRhsBatchFn fbatch,
+                           int maxbatch)
+{
+  CVodeMem cv_mem;
+
+  if (cvode_mem == NULL)
+  {
+    cvProcessError(NULL, CV_MEM_NULL, __LINE__, __func__, __FILE__, MSGCV_NO_MEM);
+    return (CV_MEM_NULL);
+  }
+  cv_mem = (CVodeMem)cvode_mem;
+
+  if ((fbatch != NULL) && (maxbatch < 1))
+  {
+    cvProcessError(cv_mem, CV_ILL_INPUT, __LINE__, __func__, __FILE__,
+                   MSGCV_BAD_MAXBATCH);
+    return (CV_ILL_INPUT);
+  }
+
+  /* the workspace is (re)allocated when the sensitivity RHS is evaluated */
+  cv_mem->cv_fbatchS   = fbatch;
+  cv_mem->cv_maxbatchS = (fbatch != NULL) ? maxbatch : 0;
+
+  return (CV_SUCCESS);
+}
+
+/*-----------------------------------------------------------------*/
+
 int CVodeSetSensParams(void* cvode_mem, sunrealtype* p, sunrealtype* pbar,
                        int* plist)
 {
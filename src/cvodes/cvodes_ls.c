@@ -48,6 +48,15 @@ static int cvLsLinSys(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix A,
                       sunrealtype gamma, void* user_data, N_Vector tmp1,
                       N_Vector tmp2, N_Vector tmp3);
 
+static sunrealtype cvLsDQInc(CVodeMem cv_mem, sunrealtype yj, sunrealtype ewtj,
+                             sunrealtype cnsj, sunrealtype srur,
+                             sunrealtype minInc);
+static int cvLsDenseDQJacBatch(sunrealtype t, N_Vector y, N_Vector fy,
+                               SUNMatrix Jac, CVodeMem cv_mem);
+static int cvLsBandDQJacBatch(sunrealtype t, N_Vector y, N_Vector fy,
+                              SUNMatrix Jac, CVodeMem cv_mem);
+static void cvLsFreeRhsBatch(CVLsMem cvls_mem);
+
 /*=================================================================
   PRIVATE FUNCTION PROTOTYPES - backward problems
   =================================================================*/
@@ -261,6 +270,12 @@ int CVodeSetLinearSolver(void* cvode_mem, SUNLinearSolver LS, SUNMatrix A)
   cvls_mem->jt_f     = cv_mem->cv_f;
   cvls_mem->jt_data  = cv_mem;
 
+  cvls_mem->rhsbatch = NULL;
+  cvls_mem->maxbatch = 0;
+  cvls_mem->ybatch   = NULL;
+  cvls_mem->fbatch   = NULL;
+  cvls_mem->incbatch = NULL;
+
   cvls_mem->user_linsys = SUNFALSE;
   cvls_mem->linsys      = cvLsLinSys;
   cvls_mem->A_data      = cv_mem;
@@ -634,6 +649,57 @@ int CVodeSetJacTimesRhsFn(void* cvode_mem, CVRhsFn jtimesRhsFn)
   return (CVLS_SUCCESS);
 }
 
+/* CVodeSetJacRhsBatchFn specifies a batched RHS function for use in
+   the internal difference quotient Jacobian approximation. */
+int CVodeSetJacRhsBatchFn(void* cvode_mem, CVLsRhsBatchFn rhsbatch,
+                          int maxbatch)
+{
+  CVodeMem cv_mem;
+  CVLsMem cvls_mem;
+  int retval;
+
+  /* access CVLsMem structure */
+  retval = cvLs_AccessLMem(cvode_mem, __func__, &cv_mem, &cvls_mem);
+  if (retval != CVLS_SUCCESS) { return (retval); }
+
+  /* the DQ Jacobian approximation requires a matrix */
+  if ((rhsbatch != NULL) && (cvls_mem->A == NULL))
+  {
+    cvProcessError(cv_mem, CVLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                   MSG_LS_BATCH_NULL_MAT);
+    return (CVLS_ILL_INPUT);
+  }
+
+  if ((rhsbatch != NULL) && (maxbatch < 1))
+  {
+    cvProcessError(cv_mem, CVLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                   MSG_LS_BAD_MAXBATCH);
+    return (CVLS_ILL_INPUT);
+  }
+
+  /* free any existing batch workspace */
+  cvLsFreeRhsBatch(cvls_mem);
+  if (rhsbatch == NULL) { return (CVLS_SUCCESS); }
+
+  /* allocate the perturbed states, their RHS values, and increments */
+  cvls_mem->ybatch   = N_VCloneVectorArray(maxbatch, cv_mem->cv_tempv);
+  cvls_mem->fbatch   = N_VCloneVectorArray(maxbatch, cv_mem->cv_tempv);
+  cvls_mem->incbatch = (sunrealtype*)malloc(maxbatch * sizeof(sunrealtype));
+  cvls_mem->maxbatch = maxbatch;
+  if ((cvls_mem->ybatch == NULL) || (cvls_mem->fbatch == NULL) ||
+      (cvls_mem->incbatch == NULL))
+  {
+    cvLsFreeRhsBatch(cvls_mem);
+    cvProcessError(cv_mem, CVLS_MEM_FAIL, __LINE__, __func__, __FILE__,
+                   MSG_LS_MEM_FAIL);
+    return (CVLS_MEM_FAIL);
+  }
+
+  cvls_mem->rhsbatch = rhsbatch;
+
+  return (CVLS_SUCCESS);
+}
+
 /* CVodeSetLinSysFn specifies the linear system setup function. */
 int CVodeSetLinSysFn(void* cvode_mem, CVLsLinSysFn linsys)
 {
@@ -737,6 +803,13 @@ int CVodeGetLinWorkSpace(void* cvode_mem, long int* lenrwLS, long int* leniwLS)
     N_VSpace(cv_mem->cv_tempv, &lrw1, &liw1);
     *lenrwLS += 2 * lrw1;
     *leniwLS += 2 * liw1;
+
+    /* add batched DQ Jacobian workspace (if applicable) */
+    if (cvls_mem->rhsbatch)
+    {
+      *lenrwLS += cvls_mem->maxbatch * (2 * lrw1 + 1);
+      *leniwLS += 2 * cvls_mem->maxbatch * liw1;
+    }
   }
 
   /* add SUNMatrix size (only account for the one owned by Ls interface) */
@@ -1138,6 +1211,12 @@ int cvLsDenseDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
   /* access LsMem interface structure */
   cvls_mem = (CVLsMem)cv_mem->cv_lmem;
 
+  /* evaluate the perturbed RHS in batches (if enabled) */
+  if (cvls_mem->rhsbatch)
+  {
+    return (cvLsDenseDQJacBatch(t, y, fy, Jac, cv_mem));
+  }
+
   /* access matrix dimension */
   N = SUNDenseMatrix_Columns(Jac);
 
@@ -1232,6 +1311,12 @@ int cvLsBandDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
   /* access LsMem interface structure */
   cvls_mem = (CVLsMem)cv_mem->cv_lmem;
 
+  /* evaluate the perturbed RHS in batches (if enabled) */
+  if (cvls_mem->rhsbatch)
+  {
+    return (cvLsBandDQJacBatch(t, y, fy, Jac, cv_mem));
+  }
+
   /* access matrix dimensions */
   N      = SUNBandMatrix_Columns(Jac);
   mupper = SUNBandMatrix_UpperBandwidth(Jac);
@@ -1330,6 +1415,237 @@ int cvLsBandDQJac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix Jac,
   return (retval);
 }
 
+/*-----------------------------------------------------------------
+  cvLsDQInc
+
+  This routine returns the increment used in the difference
+  quotient approximation of column j of the Jacobian, with its
+  sign adjusted if y_j has an inequality constraint.
+  -----------------------------------------------------------------*/
+static sunrealtype cvLsDQInc(CVodeMem cv_mem, sunrealtype yj, sunrealtype ewtj,
+                             sunrealtype cnsj, sunrealtype srur,
+                             sunrealtype minInc)
+{
+  sunrealtype inc = SUNMAX(srur * SUNRabs(yj), minInc / ewtj);
+
+  if (cv_mem->cv_constraintsSet)
+  {
+    if (SUNRabs(cnsj) == ONE)
+    {
+      if ((yj + inc) * cnsj < ZERO) { inc = -inc; }
+    }
+    else if (SUNRabs(cnsj) == TWO)
+    {
+      if ((yj + inc) * cnsj <= ZERO) { inc = -inc; }
+    }
+  }
+
+  return (inc);
+}
+
+/*-----------------------------------------------------------------
+  cvLsDenseDQJacBatch
+
+  This routine computes the same dense difference quotient
+  approximation as cvLsDenseDQJac, but perturbs up to maxbatch
+  columns at a time and evaluates the perturbed states with a
+  single call to the user-supplied batched RHS function.
+  -----------------------------------------------------------------*/
+static int cvLsDenseDQJacBatch(sunrealtype t, N_Vector y, N_Vector fy,
+                               SUNMatrix Jac, CVodeMem cv_mem)
+{
+  sunrealtype fnorm, minInc, inc_inv, srur, cnsj;
+  sunrealtype *y_data, *ewt_data, *cns_data;
+  N_Vector jthCol;
+  sunindextype j, N;
+  int b, nbatch, retval = 0;
+  CVLsMem cvls_mem;
+
+  /* initialize cns_data to avoid compiler warning */
+  cns_data = NULL;
+
+  /* access LsMem interface structure */
+  cvls_mem = (CVLsMem)cv_mem->cv_lmem;
+
+  /* access matrix dimension */
+  N = SUNDenseMatrix_Columns(Jac);
+
+  /* Create an empty vector for matrix column calculations */
+  jthCol = N_VCloneEmpty(y);
+
+  /* Obtain pointers to the data for ewt, y */
+  ewt_data = N_VGetArrayPointer(cv_mem->cv_ewt);
+  y_data   = N_VGetArrayPointer(y);
+  if (cv_mem->cv_constraintsSet)
+  {
+    cns_data = N_VGetArrayPointer(cv_mem->cv_constraints);
+  }
+
+  /* Set minimum increment based on uround and norm of f */
+  srur   = SUNRsqrt(cv_mem->cv_uround);
+  fnorm  = N_VWrmsNorm(fy, cv_mem->cv_ewt);
+  minInc = (fnorm != ZERO) ? (MIN_INC_MULT * SUNRabs(cv_mem->cv_h) *
+                              cv_mem->cv_uround * N * fnorm)
+                           : ONE;
+
+  for (j = 0; j < N; j += nbatch)
+  {
+    nbatch = (int)SUNMIN(cvls_mem->maxbatch, N - j);
+
+    /* Perturb column j + b of y in the b-th batch vector */
+    for (b = 0; b < nbatch; b++)
+    {
+      cnsj = (cv_mem->cv_constraintsSet) ? cns_data[j + b] : ZERO;
+      cvls_mem->incbatch[b] = cvLsDQInc(cv_mem, y_data[j + b],
+                                        ewt_data[j + b], cnsj, srur, minInc);
+
+      N_VScale(ONE, y, cvls_mem->ybatch[b]);
+      N_VGetArrayPointer(cvls_mem->ybatch[b])[j + b] += cvls_mem->incbatch[b];
+    }
+
+    retval = cvls_mem->rhsbatch(nbatch, t, cvls_mem->ybatch, cvls_mem->fbatch,
+                                cv_mem->cv_user_data);
+    cvls_mem->nfeDQ += nbatch;
+    if (retval != 0) { break; }
+
+    /* Form the difference quotients */
+    for (b = 0; b < nbatch; b++)
+    {
+      N_VSetArrayPointer(SUNDenseMatrix_Column(Jac, j + b), jthCol);
+      inc_inv = ONE / cvls_mem->incbatch[b];
+      N_VLinearSum(inc_inv, cvls_mem->fbatch[b], -inc_inv, fy, jthCol);
+    }
+  }
+
+  /* Destroy jthCol vector */
+  N_VSetArrayPointer(NULL, jthCol);
+  N_VDestroy(jthCol);
+
+  return (retval);
+}
+
+/*-----------------------------------------------------------------
+  cvLsBandDQJacBatch
+
+  This routine computes the same banded difference quotient
+  approximation as cvLsBandDQJac, but perturbs up to maxbatch
+  column groups at a time and evaluates the perturbed states with
+  a single call to the user-supplied batched RHS function.
+  -----------------------------------------------------------------*/
+static int cvLsBandDQJacBatch(sunrealtype t, N_Vector y, N_Vector fy,
+                              SUNMatrix Jac, CVodeMem cv_mem)
+{
+  sunrealtype fnorm, minInc, inc, inc_inv, srur, cnsj;
+  sunrealtype *col_j, *ewt_data, *fy_data, *f_data, *y_data, *yb_data;
+  sunrealtype* cns_data;
+  sunindextype group, i, j, width, ngroups, i1, i2;
+  sunindextype N, mupper, mlower;
+  int b, nbatch, retval = 0;
+  CVLsMem cvls_mem;
+
+  /* initialize cns_data to avoid compiler warning */
+  cns_data = NULL;
+
+  /* access LsMem interface structure */
+  cvls_mem = (CVLsMem)cv_mem->cv_lmem;
+
+  /* access matrix dimensions */
+  N      = SUNBandMatrix_Columns(Jac);
+  mupper = SUNBandMatrix_UpperBandwidth(Jac);
+  mlower = SUNBandMatrix_LowerBandwidth(Jac);
+
+  /* Obtain pointers to the data for ewt, fy, y */
+  ewt_data = N_VGetArrayPointer(cv_mem->cv_ewt);
+  fy_data  = N_VGetArrayPointer(fy);
+  y_data   = N_VGetArrayPointer(y);
+  if (cv_mem->cv_constraintsSet)
+  {
+    cns_data = N_VGetArrayPointer(cv_mem->cv_constraints);
+  }
+
+  /* Set minimum increment based on uround and norm of f */
+  srur   = SUNRsqrt(cv_mem->cv_uround);
+  fnorm  = N_VWrmsNorm(fy, cv_mem->cv_ewt);
+  minInc = (fnorm != ZERO) ? (MIN_INC_MULT * SUNRabs(cv_mem->cv_h) *
+                              cv_mem->cv_uround * N * fnorm)
+                           : ONE;
+
+  /* Set bandwidth and number of column groups for band differencing */
+  width   = mlower + mupper + 1;
+  ngroups = SUNMIN(width, N);
+
+  /* Loop over batches of column groups */
+  for (group = 1; group <= ngroups; group += nbatch)
+  {
+    nbatch = (int)SUNMIN(cvls_mem->maxbatch, ngroups - group + 1);
+
+    /* Increment all y_j of group + b in the b-th batch vector */
+    for (b = 0; b < nbatch; b++)
+    {
+      N_VScale(ONE, y, cvls_mem->ybatch[b]);
+      yb_data = N_VGetArrayPointer(cvls_mem->ybatch[b]);
+      for (j = group + b - 1; j < N; j += width)
+      {
+        cnsj = (cv_mem->cv_constraintsSet) ? cns_data[j] : ZERO;
+        yb_data[j] += cvLsDQInc(cv_mem, y_data[j], ewt_data[j], cnsj, srur,
+                                minInc);
+      }
+    }
+
+    retval = cvls_mem->rhsbatch(nbatch, t, cvls_mem->ybatch, cvls_mem->fbatch,
+                                cv_mem->cv_user_data);
+    cvls_mem->nfeDQ += nbatch;
+    if (retval != 0) { break; }
+
+    /* Form and load difference quotients */
+    for (b = 0; b < nbatch; b++)
+    {
+      f_data = N_VGetArrayPointer(cvls_mem->fbatch[b]);
+      for (j = group + b - 1; j < N; j += width)
+      {
+        col_j   = SUNBandMatrix_Column(Jac, j);
+        cnsj    = (cv_mem->cv_constraintsSet) ? cns_data[j] : ZERO;
+        inc     = cvLsDQInc(cv_mem, y_data[j], ewt_data[j], cnsj, srur, minInc);
+        inc_inv = ONE / inc;
+        i1      = SUNMAX(0, j - mupper);
+        i2      = SUNMIN(j + mlower, N - 1);
+        for (i = i1; i <= i2; i++)
+        {
+          SM_COLUMN_ELEMENT_B(col_j, i, j) = inc_inv * (f_data[i] - fy_data[i]);
+        }
+      }
+    }
+  }
+
+  return (retval);
+}
+
+/*-----------------------------------------------------------------
+  cvLsFreeRhsBatch
+
+  This routine frees the batched DQ Jacobian workspace.
+  -----------------------------------------------------------------*/
+static void cvLsFreeRhsBatch(CVLsMem cvls_mem)
+{
+  if (cvls_mem->ybatch)
+  {
+    N_VDestroyVectorArray(cvls_mem->ybatch, cvls_mem->maxbatch);
+    cvls_mem->ybatch = NULL;
+  }
+  if (cvls_mem->fbatch)
+  {
+    N_VDestroyVectorArray(cvls_mem->fbatch, cvls_mem->maxbatch);
+    cvls_mem->fbatch = NULL;
+  }
+  if (cvls_mem->incbatch)
+  {
+    free(cvls_mem->incbatch);
+    cvls_mem->incbatch = NULL;
+  }
+  cvls_mem->rhsbatch = NULL;
+  cvls_mem->maxbatch = 0;
+}
+
 /*-----------------------------------------------------------------
   cvLsDQJtimes
 
@@ -1956,6 +2272,9 @@ int cvLsFree(CVodeMem cv_mem)
     cvls_mem->savedJ = NULL;
   }
 
+  /* Free batched DQ Jacobian workspace */
+  cvLsFreeRhsBatch(cvls_mem);
+
   /* Nullify other N_Vector pointers */
   cvls_mem->ycur = NULL;
   cvls_mem->fcur = NULL;
@@ -140,6 +140,7 @@ module fcvodes_mod
  public :: FCVodeComputeStateSens
  public :: FCVodeComputeStateSens1
  public :: FCVodeGetDky
+ public :: FCVodeGetDkyBatch
  public :: FCVodeGetWorkSpace
  public :: FCVodeGetNumSteps
  public :: FCVodeGetNumRhsEvals
@@ -198,6 +199,9 @@ module fcvodes_mod
  public :: FCVodeSetSensDQMethod
  public :: FCVodeSetSensErrCon
  public :: FCVodeSetSensMaxNonlinIters
+ public :: FCVodeSetSensNumThreads
+ public :: FCVodeSetSensThreadParams
+ public :: FCVodeSetSensRhsBatchFn
  public :: FCVodeSetSensParams
  public :: FCVodeSetNonlinearSolverSensSim
  public :: FCVodeSetNonlinearSolverSensStg
@@ -254,6 +258,7 @@ module fcvodes_mod
  public :: FCVodeF
  public :: FCVodeB
  public :: FCVodeSetAdjNoSensi
+ public :: FCVodeSetAdjMaxCheckPoints
  public :: FCVodeSetUserDataB
  public :: FCVodeSetMaxOrdB
  public :: FCVodeSetMaxNumStepsB
@@ -302,6 +307,7 @@ module fcvodes_mod
   module procedure swigf_create_CVadjCheckPointRec
  end interface
  public :: FCVodeGetAdjCheckPointsInfo
+ public :: FCVodeGetAdjCheckPointStats
  public :: FCVodeSetJacTimesRhsFnB
  public :: FCVodeGetAdjDataPointHermite
  public :: FCVodeGetAdjDataPointPolynomial
@@ -353,6 +359,7 @@ module fcvodes_mod
  public :: FCVodeSetPreconditioner
  public :: FCVodeSetJacTimes
  public :: FCVodeSetLinSysFn
+ public :: FCVodeSetJacRhsBatchFn
  public :: FCVodeGetJac
  public :: FCVodeGetJacTime
  public :: FCVodeGetJacNumSteps
@@ -811,6 +818,18 @@ type(C_PTR), value :: farg4
 integer(C_INT) :: fresult
 end function
 
+function swigc_FCVodeGetDkyBatch(farg1, farg2, farg3, farg4, farg5) &
+bind(C, name="_wrap_FCVodeGetDkyBatch") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+type(C_PTR), value :: farg3
+integer(C_INT), intent(in) :: farg4
+type(C_PTR), value :: farg5
+integer(C_INT) :: fresult
+end function
+
 function swigc_FCVodeGetWorkSpace(farg1, farg2, farg3) &
 bind(C, name="_wrap_FCVodeGetWorkSpace") &
 result(fresult)
@@ -1337,6 +1356,35 @@ integer(C_INT), intent(in) :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FCVodeSetSensNumThreads(farg1, farg2) &
+bind(C, name="_wrap_FCVodeSetSensNumThreads") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
+function swigc_FCVodeSetSensThreadParams(farg1, farg2, farg3) &
+bind(C, name="_wrap_FCVodeSetSensThreadParams") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_PTR), value :: farg2
+type(C_PTR), value :: farg3
+integer(C_INT) :: fresult
+end function
+
+function swigc_FCVodeSetSensRhsBatchFn(farg1, farg2, farg3) &
+bind(C, name="_wrap_FCVodeSetSensRhsBatchFn") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_FUNPTR), value :: farg2
+integer(C_INT), intent(in) :: farg3
+integer(C_INT) :: fresult
+end function
+
 function swigc_FCVodeSetSensParams(farg1, farg2, farg3, farg4) &
 bind(C, name="_wrap_FCVodeSetSensParams") &
 result(fresult)
@@ -1883,6 +1931,15 @@ type(C_PTR), value :: farg1
 integer(C_INT) :: fresult
 end function
 
+function swigc_FCVodeSetAdjMaxCheckPoints(farg1, farg2) &
+bind(C, name="_wrap_FCVodeSetAdjMaxCheckPoints") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FCVodeSetUserDataB(farg1, farg2, farg3) &
 bind(C, name="_wrap_FCVodeSetUserDataB") &
 result(fresult)
@@ -2176,6 +2233,17 @@ type(SwigClassWrapper) :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FCVodeGetAdjCheckPointStats(farg1, farg2, farg3, farg4) &
+bind(C, name="_wrap_FCVodeGetAdjCheckPointStats") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_PTR), value :: farg2
+type(C_PTR), value :: farg3
+type(C_PTR), value :: farg4
+integer(C_INT) :: fresult
+end function
+
 function swigc_FCVodeSetJacTimesRhsFnB(farg1, farg2, farg3) &
 bind(C, name="_wrap_FCVodeSetJacTimesRhsFnB") &
 result(fresult)
@@ -2483,6 +2551,16 @@ type(C_FUNPTR), value :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FCVodeSetJacRhsBatchFn(farg1, farg2, farg3) &
+bind(C, name="_wrap_FCVodeSetJacRhsBatchFn") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_FUNPTR), value :: farg2
+integer(C_INT), intent(in) :: farg3
+integer(C_INT) :: fresult
+end function
+
 function swigc_FCVodeGetJac(farg1, farg2) &
 bind(C, name="_wrap_FCVodeGetJac") &
 result(fresult)
@@ -3534,6 +3612,31 @@ fresult = swigc_FCVodeGetDky(farg1, farg2, farg3, farg4)
 swig_result = fresult
 end function
 
+function FCVodeGetDkyBatch(cvode_mem, nt, t, k, dky) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: cvode_mem
+integer(C_INT), intent(in) :: nt
+real(C_DOUBLE), dimension(*), target, intent(inout) :: t
+integer(C_INT), intent(in) :: k
+type(C_PTR) :: dky
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+type(C_PTR) :: farg3 
+integer(C_INT) :: farg4 
+type(C_PTR) :: farg5 
+
+farg1 = cvode_mem
+farg2 = nt
+farg3 = c_loc(t(1))
+farg4 = k
+farg5 = dky
+fresult = swigc_FCVodeGetDkyBatch(farg1, farg2, farg3, farg4, farg5)
+swig_result = fresult
+end function
+
 function FCVodeGetWorkSpace(cvode_mem, lenrw, leniw) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -4519,6 +4622,60 @@ fresult = swigc_FCVodeSetSensMaxNonlinIters(farg1, farg2)
 swig_result = fresult
 end function
 
+function FCVodeSetSensNumThreads(cvode_mem, nthreads) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: cvode_mem
+integer(C_INT), intent(in) :: nthreads
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = cvode_mem
+farg2 = nthreads
+fresult = swigc_FCVodeSetSensNumThreads(farg1, farg2)
+swig_result = fresult
+end function
+
+function FCVodeSetSensThreadParams(cvode_mem, user_data, p) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: cvode_mem
+type(C_PTR), target, intent(inout) :: user_data
+type(C_PTR), target, intent(inout) :: p
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_PTR) :: farg2 
+type(C_PTR) :: farg3 
+
+farg1 = cvode_mem
+farg2 = c_loc(user_data)
+farg3 = c_loc(p)
+fresult = swigc_FCVodeSetSensThreadParams(farg1, farg2, farg3)
+swig_result = fresult
+end function
+
+function FCVodeSetSensRhsBatchFn(cvode_mem, fbatch, maxbatch) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: cvode_mem
+type(C_FUNPTR), intent(in), value :: fbatch
+integer(C_INT), intent(in) :: maxbatch
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_FUNPTR) :: farg2 
+integer(C_INT) :: farg3 
+
+farg1 = cvode_mem
+farg2 = fbatch
+farg3 = maxbatch
+fresult = swigc_FCVodeSetSensRhsBatchFn(farg1, farg2, farg3)
+swig_result = fresult
+end function
+
 function FCVodeSetSensParams(cvode_mem, p, pbar, plist) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -5547,6 +5704,22 @@ fresult = swigc_FCVodeSetAdjNoSensi(farg1)
 swig_result = fresult
 end function
 
+function FCVodeSetAdjMaxCheckPoints(cvode_mem, maxckpnts) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: cvode_mem
+integer(C_INT), intent(in) :: maxckpnts
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = cvode_mem
+farg2 = maxckpnts
+fresult = swigc_FCVodeSetAdjMaxCheckPoints(farg1, farg2)
+swig_result = fresult
+end function
+
 function FCVodeSetUserDataB(cvode_mem, which, user_datab) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -6044,6 +6217,28 @@ fresult = swigc_FCVodeGetAdjCheckPointsInfo(farg1, farg2)
 swig_result = fresult
 end function
 
+function FCVodeGetAdjCheckPointStats(cvode_mem, nststore, nstrecomp, nckpntsmax) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: cvode_mem
+integer(C_LONG), dimension(*), target, intent(inout) :: nststore
+integer(C_LONG), dimension(*), target, intent(inout) :: nstrecomp
+integer(C_INT), dimension(*), target, intent(inout) :: nckpntsmax
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_PTR) :: farg2 
+type(C_PTR) :: farg3 
+type(C_PTR) :: farg4 
+
+farg1 = cvode_mem
+farg2 = c_loc(nststore(1))
+farg3 = c_loc(nstrecomp(1))
+farg4 = c_loc(nckpntsmax(1))
+fresult = swigc_FCVodeGetAdjCheckPointStats(farg1, farg2, farg3, farg4)
+swig_result = fresult
+end function
+
 function FCVodeSetJacTimesRhsFnB(cvode_mem, which, jtimesrhsfn) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -6633,6 +6828,25 @@ fresult = swigc_FCVodeSetLinSysFn(farg1, farg2)
 swig_result = fresult
 end function
 
+function FCVodeSetJacRhsBatchFn(cvode_mem, rhsbatch, maxbatch) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: cvode_mem
+type(C_FUNPTR), intent(in), value :: rhsbatch
+integer(C_INT), intent(in) :: maxbatch
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_FUNPTR) :: farg2 
+integer(C_INT) :: farg3 
+
+farg1 = cvode_mem
+farg2 = rhsbatch
+farg3 = maxbatch
+fresult = swigc_FCVodeSetJacRhsBatchFn(farg1, farg2, farg3)
+swig_result = fresult
+end function
+
 function FCVodeGetJac(cvode_mem, j) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -984,6 +984,26 @@ SWIGEXPORT int _wrap_FCVodeGetDky(void *farg1, double const *farg2, int const *f
 }
 
 
+SWIGEXPORT int _wrap_FCVodeGetDkyBatch(void *farg1, int const *farg2, double *farg3, int const *farg4, void *farg5) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  int arg2 ;
+  sunrealtype *arg3 = (sunrealtype *) 0 ;
+  int arg4 ;
+  N_Vector *arg5 = (N_Vector *) 0 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (int)(*farg2);
+  arg3 = (sunrealtype *)(farg3);
+  arg4 = (int)(*farg4);
+  arg5 = (N_Vector *)(farg5);
+  result = (int)CVodeGetDkyBatch(arg1,arg2,arg3,arg4,arg5);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FCVodeGetWorkSpace(void *farg1, long *farg2, long *farg3) {
   int fresult ;
   void *arg1 = (void *) 0 ;
@@ -1809,6 +1829,52 @@ SWIGEXPORT int _wrap_FCVodeSetSensMaxNonlinIters(void *farg1, int const *farg2)
 }
 
 
+SWIGEXPORT int _wrap_FCVodeSetSensNumThreads(void *farg1, int const *farg2) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  int arg2 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (int)(*farg2);
+  result = (int)CVodeSetSensNumThreads(arg1,arg2);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
+SWIGEXPORT int _wrap_FCVodeSetSensThreadParams(void *farg1, void *farg2, void *farg3) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  void **arg2 = (void **) 0 ;
+  sunrealtype **arg3 = (sunrealtype **) 0 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (void **)(farg2);
+  arg3 = (sunrealtype **)(farg3);
+  result = (int)CVodeSetSensThreadParams(arg1,arg2,arg3);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
+SWIGEXPORT int _wrap_FCVodeSetSensRhsBatchFn(void *farg1, CVLsRhsBatchFn farg2, int const *farg3) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  CVLsRhsBatchFn arg2 = (CVLsRhsBatchFn) 0 ;
+  int arg3 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (CVLsRhsBatchFn)(farg2);
+  arg3 = (int)(*farg3);
+  result = (int)CVodeSetSensRhsBatchFn(arg1,arg2,arg3);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FCVodeSetSensParams(void *farg1, double *farg2, double *farg3, int *farg4) {
   int fresult ;
   void *arg1 = (void *) 0 ;
@@ -2677,6 +2743,20 @@ SWIGEXPORT int _wrap_FCVodeSetAdjNoSensi(void *farg1) {
 }
 
 
+SWIGEXPORT int _wrap_FCVodeSetAdjMaxCheckPoints(void *farg1, int const *farg2) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  int arg2 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (int)(*farg2);
+  result = (int)CVodeSetAdjMaxCheckPoints(arg1,arg2);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FCVodeSetUserDataB(void *farg1, int const *farg2, void *farg3) {
   int fresult ;
   void *arg1 = (void *) 0 ;
@@ -3117,6 +3197,24 @@ SWIGEXPORT int _wrap_FCVodeGetAdjCheckPointsInfo(void *farg1, SwigClassWrapper c
 }
 
 
+SWIGEXPORT int _wrap_FCVodeGetAdjCheckPointStats(void *farg1, long *farg2, long *farg3, int *farg4) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  long *arg2 = (long *) 0 ;
+  long *arg3 = (long *) 0 ;
+  int *arg4 = (int *) 0 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (long *)(farg2);
+  arg3 = (long *)(farg3);
+  arg4 = (int *)(farg4);
+  result = (int)CVodeGetAdjCheckPointStats(arg1,arg2,arg3,arg4);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FCVodeSetJacTimesRhsFnB(void *farg1, int const *farg2, CVRhsFn farg3) {
   int fresult ;
   void *arg1 = (void *) 0 ;
@@ -3610,6 +3708,22 @@ SWIGEXPORT int _wrap_FCVodeSetLinSysFn(void *farg1, CVLsLinSysFn farg2) {
 }
 
 
+SWIGEXPORT int _wrap_FCVodeSetJacRhsBatchFn(void *farg1, CVLsRhsBatchFn farg2, int const *farg3) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  CVLsRhsBatchFn arg2 = (CVLsRhsBatchFn) 0 ;
+  int arg3 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (CVLsRhsBatchFn)(farg2);
+  arg3 = (int)(*farg3);
+  result = (int)CVodeSetJacRhsBatchFn(arg1,arg2,arg3);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FCVodeGetJac(void *farg1, void *farg2) {
   int fresult ;
   void *arg1 = (void *) 0 ;
@@ -823,6 +823,34 @@ SWIGEXPORT int _wrap_FIDASetNoInactiveRootWarn(void *farg1) {
 }
 
 
+SWIGEXPORT int _wrap_FIDASetPartialRootFn(void *farg1, IDAPartialRootFn farg2) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  IDAPartialRootFn arg2 = (IDAPartialRootFn) 0 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (IDAPartialRootFn)(farg2);
+  result = (int)IDASetPartialRootFn(arg1,arg2);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
+SWIGEXPORT int _wrap_FIDASetRootInverseInterp(void *farg1, int const *farg2) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  int arg2 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (int)(*farg2);
+  result = (int)IDASetRootInverseInterp(arg1,arg2);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FIDASolve(void *farg1, double const *farg2, double *farg3, N_Vector farg4, N_Vector farg5, int const *farg6) {
   int fresult ;
   void *arg1 = (void *) 0 ;
@@ -895,6 +923,26 @@ SWIGEXPORT int _wrap_FIDAGetDky(void *farg1, double const *farg2, int const *far
 }
 
 
+SWIGEXPORT int _wrap_FIDAGetDkyBatch(void *farg1, int const *farg2, double *farg3, int const *farg4, void *farg5) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  int arg2 ;
+  sunrealtype *arg3 = (sunrealtype *) 0 ;
+  int arg4 ;
+  N_Vector *arg5 = (N_Vector *) 0 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (int)(*farg2);
+  arg3 = (sunrealtype *)(farg3);
+  arg4 = (int)(*farg4);
+  arg5 = (N_Vector *)(farg5);
+  result = (int)IDAGetDkyBatch(arg1,arg2,arg3,arg4,arg5);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FIDAGetWorkSpace(void *farg1, long *farg2, long *farg3) {
   int fresult ;
   void *arg1 = (void *) 0 ;
@@ -1570,6 +1618,22 @@ SWIGEXPORT int _wrap_FIDASetIncrementFactor(void *farg1, double const *farg2) {
 }
 
 
+SWIGEXPORT int _wrap_FIDASetJacResBatchFn(void *farg1, IDALsResBatchFn farg2, int const *farg3) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  IDALsResBatchFn arg2 = (IDALsResBatchFn) 0 ;
+  int arg3 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (IDALsResBatchFn)(farg2);
+  arg3 = (int)(*farg3);
+  result = (int)IDASetJacResBatchFn(arg1,arg2,arg3);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FIDAGetJac(void *farg1, void *farg2) {
   int fresult ;
   void *arg1 = (void *) 0 ;
@@ -102,10 +102,13 @@ module fida_mod
  public :: FIDARootInit
  public :: FIDASetRootDirection
  public :: FIDASetNoInactiveRootWarn
+ public :: FIDASetPartialRootFn
+ public :: FIDASetRootInverseInterp
  public :: FIDASolve
  public :: FIDAComputeY
  public :: FIDAComputeYp
  public :: FIDAGetDky
+ public :: FIDAGetDkyBatch
  public :: FIDAGetWorkSpace
  public :: FIDAGetNumSteps
  public :: FIDAGetNumResEvals
@@ -164,6 +167,7 @@ module fida_mod
  public :: FIDASetLSNormFactor
  public :: FIDASetLinearSolutionScaling
  public :: FIDASetIncrementFactor
+ public :: FIDASetJacResBatchFn
  public :: FIDAGetJac
  public :: FIDAGetJacCj
  public :: FIDAGetJacTime
@@ -558,6 +562,24 @@ type(C_PTR), value :: farg1
 integer(C_INT) :: fresult
 end function
 
+function swigc_FIDASetPartialRootFn(farg1, farg2) &
+bind(C, name="_wrap_FIDASetPartialRootFn") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_FUNPTR), value :: farg2
+integer(C_INT) :: fresult
+end function
+
+function swigc_FIDASetRootInverseInterp(farg1, farg2) &
+bind(C, name="_wrap_FIDASetRootInverseInterp") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FIDASolve(farg1, farg2, farg3, farg4, farg5, farg6) &
 bind(C, name="_wrap_FIDASolve") &
 result(fresult)
@@ -602,6 +624,18 @@ type(C_PTR), value :: farg4
 integer(C_INT) :: fresult
 end function
 
+function swigc_FIDAGetDkyBatch(farg1, farg2, farg3, farg4, farg5) &
+bind(C, name="_wrap_FIDAGetDkyBatch") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+type(C_PTR), value :: farg3
+integer(C_INT), intent(in) :: farg4
+type(C_PTR), value :: farg5
+integer(C_INT) :: fresult
+end function
+
 function swigc_FIDAGetWorkSpace(farg1, farg2, farg3) &
 bind(C, name="_wrap_FIDAGetWorkSpace") &
 result(fresult)
@@ -1033,6 +1067,16 @@ real(C_DOUBLE), intent(in) :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FIDASetJacResBatchFn(farg1, farg2, farg3) &
+bind(C, name="_wrap_FIDASetJacResBatchFn") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_FUNPTR), value :: farg2
+integer(C_INT), intent(in) :: farg3
+integer(C_INT) :: fresult
+end function
+
 function swigc_FIDAGetJac(farg1, farg2) &
 bind(C, name="_wrap_FIDAGetJac") &
 result(fresult)
@@ -1851,6 +1895,38 @@ fresult = swigc_FIDASetNoInactiveRootWarn(farg1)
 swig_result = fresult
 end function
 
+function FIDASetPartialRootFn(ida_mem, gpart) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: ida_mem
+type(C_FUNPTR), intent(in), value :: gpart
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_FUNPTR) :: farg2 
+
+farg1 = ida_mem
+farg2 = gpart
+fresult = swigc_FIDASetPartialRootFn(farg1, farg2)
+swig_result = fresult
+end function
+
+function FIDASetRootInverseInterp(ida_mem, onoff) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: ida_mem
+integer(C_INT), intent(in) :: onoff
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = ida_mem
+farg2 = onoff
+fresult = swigc_FIDASetRootInverseInterp(farg1, farg2)
+swig_result = fresult
+end function
+
 function FIDASolve(ida_mem, tout, tret, yret, ypret, itask) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -1939,6 +2015,31 @@ fresult = swigc_FIDAGetDky(farg1, farg2, farg3, farg4)
 swig_result = fresult
 end function
 
+function FIDAGetDkyBatch(ida_mem, nt, t, k, dky) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: ida_mem
+integer(C_INT), intent(in) :: nt
+real(C_DOUBLE), dimension(*), target, intent(inout) :: t
+integer(C_INT), intent(in) :: k
+type(C_PTR) :: dky
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+type(C_PTR) :: farg3 
+integer(C_INT) :: farg4 
+type(C_PTR) :: farg5 
+
+farg1 = ida_mem
+farg2 = nt
+farg3 = c_loc(t(1))
+farg4 = k
+farg5 = dky
+fresult = swigc_FIDAGetDkyBatch(farg1, farg2, farg3, farg4, farg5)
+swig_result = fresult
+end function
+
 function FIDAGetWorkSpace(ida_mem, lenrw, leniw) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -2747,6 +2848,25 @@ fresult = swigc_FIDASetIncrementFactor(farg1, farg2)
 swig_result = fresult
 end function
 
+function FIDASetJacResBatchFn(ida_mem, resbatch, maxbatch) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: ida_mem
+type(C_FUNPTR), intent(in), value :: resbatch
+integer(C_INT), intent(in) :: maxbatch
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_FUNPTR) :: farg2 
+integer(C_INT) :: farg3 
+
+farg1 = ida_mem
+farg2 = resbatch
+farg3 = maxbatch
+fresult = swigc_FIDASetJacResBatchFn(farg1, farg2, farg3)
+swig_result = fresult
+end function
+
 function FIDAGetJac(ida_mem, j) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -89,6 +89,7 @@
 #include <sunnonlinsol/sunnonlinsol_newton.h>
 
 #include "ida_impl.h"
+#include "ida_ls_impl.h"
 #include "sundials/priv/sundials_errors_impl.h"
 
 /*
@@ -179,6 +180,7 @@
 #define MAXNI    10 /* max. Newton iterations in IC calc. */
 #define EPCON    SUN_RCONST(0.33) /* Newton convergence test constant */
 #define MAXBACKS 100 /* max backtracks per Newton step in IDACalcIC */
+#define DKY_BATCH 32 /* output times per pass over phi in IDAGetDkyBatch */
 
 /*
  * =================================================================
@@ -203,10 +205,14 @@ static int IDAEwtSetSV(IDAMem IDA_mem, N_Vector ycur, N_Vector weight);
 /* Main IDAStep function */
 
 static int IDAStep(IDAMem IDA_mem);
+static void IDATelemetryBeginStep(IDAMem IDA_mem);
+static void IDATelemetryEndStep(IDAMem IDA_mem);
 
 /* Function called at beginning of step */
 
 static void IDASetCoeffs(IDAMem IDA_mem, sunrealtype* ck);
+static void IDADkyCoeffs(IDAMem IDA_mem, sunrealtype delt, int k,
+                         sunrealtype* cjk);
 
 /* Nonlinear solver functions */
 
@@ -533,6 +539,9 @@ int IDAInit(void* ida_mem, IDAResFn res, sunrealtype t0, N_Vector yy0,
   IDA_mem->ida_nrtfn   = 0;
   IDA_mem->ida_gactive = NULL;
   IDA_mem->ida_mxgnull = 1;
+  IDA_mem->ida_gpart   = NULL;
+  IDA_mem->ida_rcand   = NULL;
+  IDA_mem->ida_rootiqi = SUNFALSE;
 
   /* Initial setup not done yet */
 
@@ -841,9 +850,11 @@ int IDARootInit(void* ida_mem, int nrtfn, IDARootFn g)
     IDA_mem->ida_rootdir = NULL;
     free(IDA_mem->ida_gactive);
     IDA_mem->ida_gactive = NULL;
+    free(IDA_mem->ida_rcand);
+    IDA_mem->ida_rcand = NULL;
 
     IDA_mem->ida_lrw -= 3 * (IDA_mem->ida_nrtfn);
-    IDA_mem->ida_liw -= 3 * (IDA_mem->ida_nrtfn);
+    IDA_mem->ida_liw -= 4 * (IDA_mem->ida_nrtfn);
   }
 
   /* If IDARootInit() was called with nrtfn == 0, then set ida_nrtfn to
@@ -879,9 +890,11 @@ int IDARootInit(void* ida_mem, int nrtfn, IDARootFn g)
         IDA_mem->ida_rootdir = NULL;
         free(IDA_mem->ida_gactive);
         IDA_mem->ida_gactive = NULL;
+        free(IDA_mem->ida_rcand);
+        IDA_mem->ida_rcand = NULL;
 
         IDA_mem->ida_lrw -= 3 * nrt;
-        IDA_mem->ida_liw -= 3 * nrt;
+        IDA_mem->ida_liw -= 4 * nrt;
 
         IDAProcessError(IDA_mem, IDA_ILL_INPUT, __LINE__, __func__, __FILE__,
                         MSG_ROOT_FUNC_NULL);
@@ -1004,6 +1017,28 @@ int IDARootInit(void* ida_mem, int nrtfn, IDARootFn g)
     return (IDA_MEM_FAIL);
   }
 
+  IDA_mem->ida_rcand = NULL;
+  IDA_mem->ida_rcand = (int*)malloc(nrt * sizeof(int));
+  if (IDA_mem->ida_rcand == NULL)
+  {
+    free(IDA_mem->ida_glo);
+    IDA_mem->ida_glo = NULL;
+    free(IDA_mem->ida_ghi);
+    IDA_mem->ida_ghi = NULL;
+    free(IDA_mem->ida_grout);
+    IDA_mem->ida_grout = NULL;
+    free(IDA_mem->ida_iroots);
+    IDA_mem->ida_iroots = NULL;
+    free(IDA_mem->ida_rootdir);
+    IDA_mem->ida_rootdir = NULL;
+    free(IDA_mem->ida_gactive);
+    IDA_mem->ida_gactive = NULL;
+    IDAProcessError(IDA_mem, IDA_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_MEM_FAIL);
+    SUNDIALS_MARK_FUNCTION_END(IDA_PROFILER);
+    return (IDA_MEM_FAIL);
+  }
+
   /* Set default values for rootdir (both directions) */
   for (i = 0; i < nrt; i++) { IDA_mem->ida_rootdir[i] = 0; }
 
@@ -1011,7 +1046,7 @@ int IDARootInit(void* ida_mem, int nrtfn, IDARootFn g)
   for (i = 0; i < nrt; i++) { IDA_mem->ida_gactive[i] = SUNTRUE; }
 
   IDA_mem->ida_lrw += 3 * nrt;
-  IDA_mem->ida_liw += 3 * nrt;
+  IDA_mem->ida_liw += 4 * nrt;
 
   SUNDIALS_MARK_FUNCTION_END(IDA_PROFILER);
   return (IDA_SUCCESS);
@@ -1395,9 +1430,12 @@ int IDASolve(void* ida_mem, sunrealtype tout, sunrealtype* tret, N_Vector yret,
       break;
     }
 
-    /* Call IDAStep to take a step. */
+    /* Call IDAStep to take a step. Steps after the first are audited for
+       heap allocations when the audit is enabled. */
 
+    SUNAllocAuditBeginStep(IDA_mem->ida_sunctx, IDA_mem->ida_nst > 0);
     sflag = IDAStep(IDA_mem);
+    SUNAllocAuditEndStep(IDA_mem->ida_sunctx);
 
     /* Process all failed-step cases, and exit loop. */
 
@@ -1506,10 +1544,9 @@ int IDASolve(void* ida_mem, sunrealtype tout, sunrealtype* tret, N_Vector yret,
 int IDAGetDky(void* ida_mem, sunrealtype t, int k, N_Vector dky)
 {
   IDAMem IDA_mem;
-  sunrealtype tfuzz, tp, delt, psij_1;
-  int i, j, retval;
+  sunrealtype tfuzz, tp;
+  int retval;
   sunrealtype cjk[MXORDP1];
-  sunrealtype cjk_1[MXORDP1];
 
   /* Check ida_mem */
   if (ida_mem == NULL)
@@ -1550,6 +1587,158 @@ int IDAGetDky(void* ida_mem, sunrealtype t, int k, N_Vector dky)
     return (IDA_BAD_T);
   }
 
+  /* Compute the c_j^(k) */
+  IDADkyCoeffs(IDA_mem, t - IDA_mem->ida_tn, k, cjk);
+
+  /* Compute sum (c_j(t) * phi(t)) */
+
+  /* Sum j=k to j<=IDA_mem->ida_kused */
+  retval = N_VLinearCombination(IDA_mem->ida_kused - k + 1, cjk + k,
+                                IDA_mem->ida_phi + k, dky);
+  if (retval != IDA_SUCCESS)
+  {
+    SUNDIALS_MARK_FUNCTION_END(IDA_PROFILER);
+    return (IDA_VECTOROP_ERR);
+  }
+
+  SUNDIALS_MARK_FUNCTION_END(IDA_PROFILER);
+  return (IDA_SUCCESS);
+}
+
+/*
+ * IDAGetDkyBatch
+ *
+ * This routine evaluates the k-th derivative of the interpolating
+ * polynomial at the nt times t[i] and stores the results in the vectors
+ * dky[i]. All times are checked before any output is computed. The
+ * times are processed in groups of DKY_BATCH and, for each group, every
+ * phi[j] is applied to all outputs of the group with a single call to
+ * N_VScaleAddMulti, instead of one linear combination per time.
+ *
+ * The return values are:
+ *   IDA_SUCCESS       if all t[i] are legal
+ *   IDA_ILL_INPUT     if nt < 1 or t is NULL
+ *   IDA_BAD_T         if a t[i] is not within the interval of the last step
+ *   IDA_BAD_DKY       if dky or one of the dky[i] is NULL
+ *   IDA_BAD_K         if the requested k is not in the range [0,order used]
+ *   IDA_VECTOROP_ERR  if the fused vector operation fails
+ */
+
+int IDAGetDkyBatch(void* ida_mem, int nt, sunrealtype* t, int k, N_Vector* dky)
+{
+  IDAMem IDA_mem;
+  sunrealtype tfuzz, tp;
+  int i, j, i0, nb, retval;
+  sunrealtype cjk[MXORDP1];
+  sunrealtype cvals[MXORDP1 * DKY_BATCH];
+
+  /* Check ida_mem */
+  if (ida_mem == NULL)
+  {
+    IDAProcessError(NULL, IDA_MEM_NULL, __LINE__, __func__, __FILE__, MSG_NO_MEM);
+    return (IDA_MEM_NULL);
+  }
+  IDA_mem = (IDAMem)ida_mem;
+
+  SUNDIALS_MARK_FUNCTION_BEGIN(IDA_PROFILER);
+
+  if ((nt < 1) || (t == NULL))
+  {
+    IDAProcessError(IDA_mem, IDA_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    MSG_BAD_NT);
+    SUNDIALS_MARK_FUNCTION_END(IDA_PROFILER);
+    return (IDA_ILL_INPUT);
+  }
+
+  if (dky == NULL)
+  {
+    IDAProcessError(IDA_mem, IDA_BAD_DKY, __LINE__, __func__, __FILE__,
+                    MSG_NULL_DKY);
+    SUNDIALS_MARK_FUNCTION_END(IDA_PROFILER);
+    return (IDA_BAD_DKY);
+  }
+
+  if ((k < 0) || (k > IDA_mem->ida_kused))
+  {
+    IDAProcessError(IDA_mem, IDA_BAD_K, __LINE__, __func__, __FILE__, MSG_BAD_K);
+    SUNDIALS_MARK_FUNCTION_END(IDA_PROFILER);
+    return (IDA_BAD_K);
+  }
+
+  /* Check the t[i] for legality.  Here tn - hused is t_{n-1}. */
+
+  tfuzz = HUNDRED * IDA_mem->ida_uround *
+          (SUNRabs(IDA_mem->ida_tn) + SUNRabs(IDA_mem->ida_hh));
+  if (IDA_mem->ida_hh < ZERO) { tfuzz = -tfuzz; }
+  tp = IDA_mem->ida_tn - IDA_mem->ida_hused - tfuzz;
+
+  for (i = 0; i < nt; i++)
+  {
+    if (dky[i] == NULL)
+    {
+      IDAProcessError(IDA_mem, IDA_BAD_DKY, __LINE__, __func__, __FILE__,
+                      MSG_NULL_DKY);
+      SUNDIALS_MARK_FUNCTION_END(IDA_PROFILER);
+      return (IDA_BAD_DKY);
+    }
+    if ((t[i] - tp) * IDA_mem->ida_hh < ZERO)
+    {
+      IDAProcessError(IDA_mem, IDA_BAD_T, __LINE__, __func__, __FILE__,
+                      MSG_BAD_T, t[i], IDA_mem->ida_tn - IDA_mem->ida_hused,
+                      IDA_mem->ida_tn);
+      SUNDIALS_MARK_FUNCTION_END(IDA_PROFILER);
+      return (IDA_BAD_T);
+    }
+  }
+
+  for (i0 = 0; i0 < nt; i0 += DKY_BATCH)
+  {
+    nb = SUNMIN(DKY_BATCH, nt - i0);
+
+    /* Coefficients of phi[j] for each time, stored by column j */
+    for (i = 0; i < nb; i++)
+    {
+      IDADkyCoeffs(IDA_mem, t[i0 + i] - IDA_mem->ida_tn, k, cjk);
+      for (j = k; j <= IDA_mem->ida_kused; j++) { cvals[j * nb + i] = cjk[j]; }
+    }
+
+    /* Compute sum (c_j(t) * phi(t)) for all times in the group */
+    for (i = 0; i < nb; i++)
+    {
+      N_VScale(cvals[k * nb + i], IDA_mem->ida_phi[k], dky[i0 + i]);
+    }
+    for (j = k + 1; j <= IDA_mem->ida_kused; j++)
+    {
+      retval = N_VScaleAddMulti(nb, cvals + j * nb, IDA_mem->ida_phi[j],
+                                dky + i0, dky + i0);
+      if (retval != IDA_SUCCESS)
+      {
+        SUNDIALS_MARK_FUNCTION_END(IDA_PROFILER);
+        return (IDA_VECTOROP_ERR);
+      }
+    }
+  }
+
+  SUNDIALS_MARK_FUNCTION_END(IDA_PROFILER);
+  return (IDA_SUCCESS);
+}
+
+/*
+ * IDADkyCoeffs
+ *
+ * This routine computes the coefficients c_j^(k), j = k,...,kused, of
+ * the k-th derivative of the interpolating polynomial at t = tn + delt,
+ *
+ *   dky = SUM c_j^(k) * phi[j] , j = k,...,kused.
+ */
+
+static void IDADkyCoeffs(IDAMem IDA_mem, sunrealtype delt, int k,
+                         sunrealtype* cjk)
+{
+  sunrealtype psij_1;
+  int i, j;
+  sunrealtype cjk_1[MXORDP1];
+
   /* Initialize the c_j^(k) and c_k^(k-1) */
   for (i = 0; i < MXORDP1; i++)
   {
@@ -1557,8 +1746,6 @@ int IDAGetDky(void* ida_mem, sunrealtype t, int k, N_Vector dky)
     cjk_1[i] = 0;
   }
 
-  delt = t - IDA_mem->ida_tn;
-
   for (i = 0; i <= k; i++)
   {
     /* The below reccurence is used to compute the k-th derivative of the solution:
@@ -1603,20 +1790,6 @@ int IDAGetDky(void* ida_mem, sunrealtype t, int k, N_Vector dky)
     /* save existing c_j^(i)'s */
     for (j = i + 1; j <= IDA_mem->ida_kused - k + i; j++) { cjk_1[j] = cjk[j]; }
   }
-
-  /* Compute sum (c_j(t) * phi(t)) */
-
-  /* Sum j=k to j<=IDA_mem->ida_kused */
-  retval = N_VLinearCombination(IDA_mem->ida_kused - k + 1, cjk + k,
-                                IDA_mem->ida_phi + k, dky);
-  if (retval != IDA_SUCCESS)
-  {
-    SUNDIALS_MARK_FUNCTION_END(IDA_PROFILER);
-    return (IDA_VECTOROP_ERR);
-  }
-
-  SUNDIALS_MARK_FUNCTION_END(IDA_PROFILER);
-  return (IDA_SUCCESS);
 }
 
 /*
@@ -1718,6 +1891,8 @@ void IDAFree(void** ida_mem)
     IDA_mem->ida_rootdir = NULL;
     free(IDA_mem->ida_gactive);
     IDA_mem->ida_gactive = NULL;
+    free(IDA_mem->ida_rcand);
+    IDA_mem->ida_rcand = NULL;
   }
 
   free(*ida_mem);
@@ -2485,6 +2660,9 @@ static int IDAStep(IDAMem IDA_mem)
   saved_t = IDA_mem->ida_tn;
   ncf = nef = 0;
 
+  /* Save the counters and start the clock for the telemetry record */
+  if (IDA_mem->ida_telemetry) { IDATelemetryBeginStep(IDA_mem); }
+
   if (IDA_mem->ida_nst == ZERO)
   {
     IDA_mem->ida_kk     = 1;
@@ -2539,7 +2717,13 @@ static int IDAStep(IDAMem IDA_mem)
     IDAPredict(IDA_mem);
 
     /* Nonlinear system solution */
-    nflag = IDANls(IDA_mem);
+    if (IDA_mem->ida_telemetry)
+    {
+      IDA_mem->ida_tel_step.rec.wall_nls -= sunTelemetryWallTime();
+      nflag = IDANls(IDA_mem);
+      IDA_mem->ida_tel_step.rec.wall_nls += sunTelemetryWallTime();
+    }
+    else { nflag = IDANls(IDA_mem); }
 
     /* If NLS was successful, perform error test */
     if (nflag == IDA_SUCCESS)
@@ -2571,6 +2755,13 @@ static int IDAStep(IDAMem IDA_mem)
   /* Nonlinear system solve and error test were both successful;
      update data, and consider change of step and/or order */
 
+  /* The error test norm ck * enorm_k (computed before kk is updated) */
+  if (IDA_mem->ida_telemetry)
+  {
+    IDA_mem->ida_tel_step.rec.error_norm =
+      (double)(ck * err_k / IDA_mem->ida_sigma[IDA_mem->ida_kk]);
+  }
+
   IDACompleteStep(IDA_mem, err_k, err_km1);
 
   /*
@@ -2586,9 +2777,76 @@ static int IDAStep(IDAMem IDA_mem)
 
   N_VScale(ck, IDA_mem->ida_ee, IDA_mem->ida_ee);
 
+  if (IDA_mem->ida_telemetry) { IDATelemetryEndStep(IDA_mem); }
+
   return (IDA_SUCCESS);
 }
 
+/*
+ * IDATelemetryNumLinIters
+ *
+ * Returns the number of linear iterations if the IDALS interface is
+ * attached and zero otherwise.
+ */
+
+static long int IDATelemetryNumLinIters(IDAMem IDA_mem)
+{
+  if (IDA_mem->ida_lmem == NULL || IDA_mem->ida_linit != idaLsInitialize)
+  {
+    return 0;
+  }
+  return ((IDALsMem)IDA_mem->ida_lmem)->nli;
+}
+
+/*
+ * IDATelemetryBeginStep
+ *
+ * This routine saves the solver counters and the wall clock time at
+ * the start of a step.
+ */
+
+static void IDATelemetryBeginStep(IDAMem IDA_mem)
+{
+  sunTelemetryStep* ts = &IDA_mem->ida_tel_step;
+
+  memset(&ts->rec, 0, sizeof(ts->rec));
+  ts->nni     = IDA_mem->ida_nni;
+  ts->nli     = IDATelemetryNumLinIters(IDA_mem);
+  ts->netf    = IDA_mem->ida_netf;
+  ts->ncfn    = IDA_mem->ida_ncfn;
+  ts->nsetups = IDA_mem->ida_nsetups;
+  ts->tic     = sunTelemetryWallTime();
+}
+
+/*
+ * IDATelemetryEndStep
+ *
+ * This routine completes the telemetry record of a successful step
+ * and stores it.
+ */
+
+static void IDATelemetryEndStep(IDAMem IDA_mem)
+{
+  sunTelemetryStep* ts    = &IDA_mem->ida_tel_step;
+  SUNTelemetryRecord* rec = &ts->rec;
+
+  rec->wall_step = sunTelemetryWallTime() - ts->tic;
+  rec->t         = (double)IDA_mem->ida_tn;
+  rec->h         = (double)IDA_mem->ida_hused;
+  rec->step      = IDA_mem->ida_nst;
+  rec->order     = IDA_mem->ida_kused;
+  rec->nni       = (int32_t)(IDA_mem->ida_nni - ts->nni);
+  rec->nli       = (int32_t)(IDATelemetryNumLinIters(IDA_mem) - ts->nli);
+  rec->netf      = (int32_t)(IDA_mem->ida_netf - ts->netf);
+  rec->ncfn      = (int32_t)(IDA_mem->ida_ncfn - ts->ncfn);
+  if (IDA_mem->ida_nsetups != ts->nsetups)
+  {
+    rec->flags |= SUN_TELEMETRY_LSETUP;
+  }
+
+  (void)SUNTelemetry_Record(IDA_mem->ida_telemetry, rec);
+}
+
 /*
  * IDASetCoeffs
  *
@@ -3714,6 +3972,20 @@ static int IDARcheck3(IDAMem IDA_mem)
  * gfun     = user-defined function for g(t).  Its form is
  *            (void) gfun(t, y, yp, gt, user_data)
  *
+ * gpart    = optional user-defined function for a subset of g(t).
+ *            Its form is
+ *            (void) gpart(t, y, yp, ncand, cand, gt, user_data)
+ *            and it sets gt[cand[j]] for j = 0, ..., ncand-1.  If
+ *            gpart is supplied, only the components of g with a sign
+ *            change (or a zero) in the interval are evaluated during
+ *            the search and candidates are dropped as the interval
+ *            shrinks, so the cost of an iteration scales with the
+ *            number of crossings rather than nrtfn.
+ *
+ * rootiqi  = flag to use inverse quadratic interpolation in place of
+ *            the secant step when the previous two iterates bracket
+ *            the root from opposite sides.
+ *
  * rootdir  = in array specifying the direction of zero-crossings.
  *            If rootdir[i] > 0, search for roots of g_i only if
  *            g_i is increasing; if rootdir[i] < 0, search for
@@ -3773,23 +4045,33 @@ static int IDARcheck3(IDAMem IDA_mem)
 static int IDARootfind(IDAMem IDA_mem)
 {
   sunrealtype alph, tmid, gfrac, maxfrac, fracint, fracsub;
-  int i, retval, imax, side, sideprev;
-  sunbooleantype zroot, sgnchg;
-
-  imax = 0;
-
-  /* First check for change in sign in ghi or for a zero in ghi. */
+  sunrealtype tiqi, ga, gb, tc, gc;
+  int i, j, k, retval, imax, ic, ncand, side, sideprev;
+  int* cand;
+  sunbooleantype zroot, sgnchg, partial;
+
+  imax    = 0;
+  cand    = IDA_mem->ida_rcand;
+  partial = (IDA_mem->ida_gpart != NULL);
+
+  /* First check for change in sign in ghi or for a zero in ghi.
+     Record the candidate components for the root search. With a partial
+     g function these are only the components that change sign or are zero,
+     otherwise all components are candidates. */
   maxfrac = ZERO;
   zroot   = SUNFALSE;
   sgnchg  = SUNFALSE;
+  ncand   = 0;
   for (i = 0; i < IDA_mem->ida_nrtfn; i++)
   {
+    if (!partial) { cand[ncand++] = i; }
     if (!IDA_mem->ida_gactive[i]) { continue; }
     if (SUNRabs(IDA_mem->ida_ghi[i]) == ZERO)
     {
       if (IDA_mem->ida_rootdir[i] * IDA_mem->ida_glo[i] <= ZERO)
       {
         zroot = SUNTRUE;
+        if (partial) { cand[ncand++] = i; }
       }
     }
     else
@@ -3797,6 +4079,7 @@ static int IDARootfind(IDAMem IDA_mem)
       if ((DIFFERENT_SIGN(IDA_mem->ida_glo[i], IDA_mem->ida_ghi[i])) &&
           (IDA_mem->ida_rootdir[i] * IDA_mem->ida_glo[i] <= ZERO))
       {
+        if (partial) { cand[ncand++] = i; }
         gfrac = SUNRabs(IDA_mem->ida_ghi[i] /
                         (IDA_mem->ida_ghi[i] - IDA_mem->ida_glo[i]));
         if (gfrac > maxfrac)
@@ -3832,8 +4115,13 @@ static int IDARootfind(IDAMem IDA_mem)
     return (RTFOUND);
   }
 
-  /* Initialize alph to avoid compiler warning */
+  /* Initialize alph, tc, and gc to avoid compiler warnings. The point
+     (tc, gc) is the last discarded endpoint for component ic and is used
+     with inverse quadratic interpolation. */
   alph = ONE;
+  tc   = IDA_mem->ida_thi;
+  gc   = ZERO;
+  ic   = -1;
 
   /* A sign change was found.  Loop to locate nearest root. */
 
@@ -3867,6 +4155,27 @@ static int IDARootfind(IDAMem IDA_mem)
     tmid = IDA_mem->ida_thi -
            (IDA_mem->ida_thi - IDA_mem->ida_tlo) * IDA_mem->ida_ghi[imax] /
              (IDA_mem->ida_ghi[imax] - alph * IDA_mem->ida_glo[imax]);
+
+    /* If enabled, replace the secant value with the inverse quadratic
+       interpolant through tlo, thi, and tc when the last two passes were on
+       opposite sides and the result lies inside (tlo,thi). Otherwise the
+       Illinois weighting above guards against slow one-sided convergence. */
+    if (IDA_mem->ida_rootiqi && ic == imax && alph == ONE)
+    {
+      ga = IDA_mem->ida_glo[imax];
+      gb = IDA_mem->ida_ghi[imax];
+      if (ga != gc && gb != gc)
+      {
+        tiqi = IDA_mem->ida_tlo * gb * gc / ((ga - gb) * (ga - gc)) +
+               IDA_mem->ida_thi * ga * gc / ((gb - ga) * (gb - gc)) +
+               tc * ga * gb / ((gc - ga) * (gc - gb));
+        if ((tiqi - IDA_mem->ida_tlo) * (IDA_mem->ida_thi - tiqi) > ZERO)
+        {
+          tmid = tiqi;
+        }
+      }
+    }
+
     if (SUNRabs(tmid - IDA_mem->ida_tlo) < HALF * IDA_mem->ida_ttol)
     {
       fracint = SUNRabs(IDA_mem->ida_thi - IDA_mem->ida_tlo) / IDA_mem->ida_ttol;
@@ -3881,8 +4190,17 @@ static int IDARootfind(IDAMem IDA_mem)
     }
 
     (void)IDAGetSolution(IDA_mem, tmid, IDA_mem->ida_yy, IDA_mem->ida_yp);
-    retval = IDA_mem->ida_gfun(tmid, IDA_mem->ida_yy, IDA_mem->ida_yp,
-                               IDA_mem->ida_grout, IDA_mem->ida_user_data);
+    if (partial)
+    {
+      retval = IDA_mem->ida_gpart(tmid, IDA_mem->ida_yy, IDA_mem->ida_yp,
+                                  ncand, cand, IDA_mem->ida_grout,
+                                  IDA_mem->ida_user_data);
+    }
+    else
+    {
+      retval = IDA_mem->ida_gfun(tmid, IDA_mem->ida_yy, IDA_mem->ida_yp,
+                                 IDA_mem->ida_grout, IDA_mem->ida_user_data);
+    }
     IDA_mem->ida_nge++;
     if (retval != 0) { return (IDA_RTFUNC_FAIL); }
 
@@ -3892,8 +4210,9 @@ static int IDARootfind(IDAMem IDA_mem)
     zroot    = SUNFALSE;
     sgnchg   = SUNFALSE;
     sideprev = side;
-    for (i = 0; i < IDA_mem->ida_nrtfn; i++)
+    for (j = 0; j < ncand; j++)
     {
+      i = cand[j];
       if (!IDA_mem->ida_gactive[i]) { continue; }
       if (SUNRabs(IDA_mem->ida_grout[i]) == ZERO)
       {
@@ -3920,13 +4239,25 @@ static int IDARootfind(IDAMem IDA_mem)
     }
     if (sgnchg)
     {
-      /* Sign change found in (tlo,tmid); replace thi with tmid. */
+      /* Sign change found in (tlo,tmid); replace thi with tmid. With a
+         partial g function, drop the candidates whose sign change is in
+         (tmid,thi) since they cannot have the nearest root. */
+      tc = IDA_mem->ida_thi;
+      gc = IDA_mem->ida_ghi[imax];
+      ic = imax;
       IDA_mem->ida_thi = tmid;
-      for (i = 0; i < IDA_mem->ida_nrtfn; i++)
+      for (j = 0, k = 0; j < ncand; j++)
       {
+        i                 = cand[j];
         IDA_mem->ida_ghi[i] = IDA_mem->ida_grout[i];
+        if (!partial || SUNRabs(IDA_mem->ida_ghi[i]) == ZERO ||
+            DIFFERENT_SIGN(IDA_mem->ida_glo[i], IDA_mem->ida_ghi[i]))
+        {
+          cand[k++] = i;
+        }
       }
-      side = 1;
+      ncand = k;
+      side  = 1;
       /* Stop at root thi if converged; otherwise loop. */
       if (SUNRabs(IDA_mem->ida_thi - IDA_mem->ida_tlo) <= IDA_mem->ida_ttol)
       {
@@ -3939,8 +4270,9 @@ static int IDARootfind(IDAMem IDA_mem)
     {
       /* No sign change in (tlo,tmid), but g = 0 at tmid; return root tmid. */
       IDA_mem->ida_thi = tmid;
-      for (i = 0; i < IDA_mem->ida_nrtfn; i++)
+      for (j = 0; j < ncand; j++)
       {
+        i                 = cand[j];
         IDA_mem->ida_ghi[i] = IDA_mem->ida_grout[i];
       }
       break;
@@ -3948,9 +4280,13 @@ static int IDARootfind(IDAMem IDA_mem)
 
     /* No sign change in (tlo,tmid), and no zero at tmid.
        Sign change must be in (tmid,thi).  Replace tlo with tmid. */
+    tc = IDA_mem->ida_tlo;
+    gc = IDA_mem->ida_glo[imax];
+    ic = imax;
     IDA_mem->ida_tlo = tmid;
-    for (i = 0; i < IDA_mem->ida_nrtfn; i++)
+    for (j = 0; j < ncand; j++)
     {
+      i                 = cand[j];
       IDA_mem->ida_glo[i] = IDA_mem->ida_grout[i];
     }
     side = 2;
@@ -3962,7 +4298,9 @@ static int IDARootfind(IDAMem IDA_mem)
 
   } /* End of root-search loop */
 
-  /* Reset trout and grout, set iroots, and return RTFOUND. */
+  /* Reset trout and grout, set iroots, and return RTFOUND. Components that
+     were not candidates keep their values at the initial thi, which have the
+     same sign as their values at trout. */
   IDA_mem->ida_trout = IDA_mem->ida_thi;
   for (i = 0; i < IDA_mem->ida_nrtfn; i++)
   {
@@ -23,6 +23,7 @@
 
 #include <ida/ida.h>
 #include <sundials/priv/sundials_context_impl.h>
+#include <sundials/priv/sundials_telemetry_impl.h>
 
 #include "sundials_logger_impl.h"
 #include "sundials_macros.h"
@@ -300,6 +301,13 @@ typedef struct IDAMemRec
 
   sunbooleantype ida_linitOK;
 
+  /*------------------
+    Per-step telemetry
+    ------------------*/
+
+  SUNTelemetry ida_telemetry;    /* telemetry records (NULL if not collected) */
+  sunTelemetryStep ida_tel_step; /* telemetry state of the current step       */
+
   /*----------------
     Rootfinding Data
     ----------------*/
@@ -321,6 +329,9 @@ typedef struct IDAMemRec
   long int ida_nge;       /* counter for g evaluations                       */
   sunbooleantype* ida_gactive; /* array with active/inactive event functions      */
   int ida_mxgnull; /* number of warning messages about possible g==0  */
+  IDAPartialRootFn ida_gpart; /* optional function for a subset of g     */
+  int* ida_rcand;             /* candidate components in root search     */
+  sunbooleantype ida_rootiqi; /* use inverse quadratic interpolation?    */
 
   /* Arrays for Fused Vector Operations */
 
@@ -557,6 +568,7 @@ int idaNlsInit(IDAMem IDA_mem);
 
 #define MSG_BAD_K     "Illegal value for k."
 #define MSG_NULL_DKY  "dky = NULL illegal."
+#define MSG_BAD_NT    "nt < 1 or t = NULL illegal."
 #define MSG_NULL_DKYP "dkyp = NULL illegal."
 #define MSG_BAD_T     "Illegal value for t." MSG_TIME_INT
 #define MSG_BAD_TOUT                        \
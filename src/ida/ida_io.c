@@ -408,6 +408,25 @@ int IDAClearStopTime(void* ida_mem)
 
 /*-----------------------------------------------------------------*/
 
+int IDASetTelemetry(void* ida_mem, SUNTelemetry tel)
+{
+  IDAMem IDA_mem;
+
+  if (ida_mem == NULL)
+  {
+    IDAProcessError(NULL, IDA_MEM_NULL, __LINE__, __func__, __FILE__, MSG_NO_MEM);
+    return (IDA_MEM_NULL);
+  }
+
+  IDA_mem = (IDAMem)ida_mem;
+
+  IDA_mem->ida_telemetry = tel;
+
+  return (IDA_SUCCESS);
+}
+
+/*-----------------------------------------------------------------*/
+
 int IDASetNonlinConvCoef(void* ida_mem, sunrealtype epcon)
 {
   IDAMem IDA_mem;
@@ -679,6 +698,55 @@ int IDASetNoInactiveRootWarn(void* ida_mem)
   return (IDA_SUCCESS);
 }
 
+/*
+ * IDASetPartialRootFn
+ *
+ * Specifies an optional function that evaluates only the listed
+ * components of g. It is used during the root search in place of
+ * the full g function.
+ */
+
+int IDASetPartialRootFn(void* ida_mem, IDAPartialRootFn gpart)
+{
+  IDAMem IDA_mem;
+
+  if (ida_mem == NULL)
+  {
+    IDAProcessError(NULL, IDA_MEM_NULL, __LINE__, __func__, __FILE__, MSG_NO_MEM);
+    return (IDA_MEM_NULL);
+  }
+
+  IDA_mem = (IDAMem)ida_mem;
+
+  IDA_mem->ida_gpart = gpart;
+
+  return (IDA_SUCCESS);
+}
+
+/*
+ * IDASetRootInverseInterp
+ *
+ * Enables or disables inverse quadratic interpolation steps in
+ * the root search
+ */
+
+int IDASetRootInverseInterp(void* ida_mem, sunbooleantype onoff)
+{
+  IDAMem IDA_mem;
+
+  if (ida_mem == NULL)
+  {
+    IDAProcessError(NULL, IDA_MEM_NULL, __LINE__, __func__, __FILE__, MSG_NO_MEM);
+    return (IDA_MEM_NULL);
+  }
+
+  IDA_mem = (IDAMem)ida_mem;
+
+  IDA_mem->ida_rootiqi = onoff;
+
+  return (IDA_SUCCESS);
+}
+
 /*
  * =================================================================
  * IDA IC optional input functions
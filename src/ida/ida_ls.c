@@ -191,6 +191,15 @@ int IDASetLinearSolver(void* ida_mem, SUNLinearSolver LS, SUNMatrix A)
   idals_mem->jt_res   = IDA_mem->ida_res;
   idals_mem->jt_data  = IDA_mem;
 
+  idals_mem->capture = NULL;
+
+  idals_mem->resbatch = NULL;
+  idals_mem->maxbatch = 0;
+  idals_mem->yybatch  = NULL;
+  idals_mem->ypbatch  = NULL;
+  idals_mem->rrbatch  = NULL;
+  idals_mem->incbatch = NULL;
+
   /* Set defaults for preconditioner-related fields */
   idals_mem->pset   = NULL;
   idals_mem->psolve = NULL;
@@ -424,6 +433,31 @@ int IDASetIncrementFactor(void* ida_mem, sunrealtype dqincfac)
   return (IDALS_SUCCESS);
 }
 
+/* IDASetLinSysCapture specifies an archive to which selected linear
+   systems and right-hand sides are written. */
+int IDASetLinSysCapture(void* ida_mem, SUNLinSysCapture capture)
+{
+  IDAMem IDA_mem;
+  IDALsMem idals_mem;
+  int retval;
+
+  /* access IDALsMem structure */
+  retval = idaLs_AccessLMem(ida_mem, __func__, &IDA_mem, &idals_mem);
+  if (retval != IDALS_SUCCESS) { return (retval); }
+
+  /* only matrix-based linear systems can be captured */
+  if ((capture != NULL) && (idals_mem->J == NULL))
+  {
+    IDAProcessError(IDA_mem, IDALS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    MSG_LS_CAPTURE_NO_MATRIX);
+    return (IDALS_ILL_INPUT);
+  }
+
+  idals_mem->capture = capture;
+
+  return (IDALS_SUCCESS);
+}
+
 /* IDASetPreconditioner specifies the user-supplied psetup and psolve routines */
 int IDASetPreconditioner(void* ida_mem, IDALsPrecSetupFn psetup,
                          IDALsPrecSolveFn psolve)
@@ -536,6 +570,57 @@ int IDASetJacTimesResFn(void* ida_mem, IDAResFn jtimesResFn)
   return (IDALS_SUCCESS);
 }
 
+/* IDASetJacResBatchFn specifies a batched DAE residual function for use
+   in the internal difference quotient Jacobian approximation. */
+int IDASetJacResBatchFn(void* ida_mem, IDALsResBatchFn resbatch, int maxbatch)
+{
+  IDAMem IDA_mem;
+  IDALsMem idals_mem;
+  int retval;
+
+  /* access IDALsMem structure */
+  retval = idaLs_AccessLMem(ida_mem, __func__, &IDA_mem, &idals_mem);
+  if (retval != IDALS_SUCCESS) { return (retval); }
+
+  /* the DQ Jacobian approximation requires a matrix */
+  if ((resbatch != NULL) && (idals_mem->J == NULL))
+  {
+    IDAProcessError(IDA_mem, IDALS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    MSG_LS_BATCH_NULL_MAT);
+    return (IDALS_ILL_INPUT);
+  }
+
+  if ((resbatch != NULL) && (maxbatch < 1))
+  {
+    IDAProcessError(IDA_mem, IDALS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    MSG_LS_BAD_MAXBATCH);
+    return (IDALS_ILL_INPUT);
+  }
+
+  /* free any existing batch workspace */
+  idaLsFreeResBatch(idals_mem);
+  if (resbatch == NULL) { return (IDALS_SUCCESS); }
+
+  /* allocate the perturbed states, their residuals, and increments */
+  idals_mem->yybatch  = N_VCloneVectorArray(maxbatch, IDA_mem->ida_tempv1);
+  idals_mem->ypbatch  = N_VCloneVectorArray(maxbatch, IDA_mem->ida_tempv1);
+  idals_mem->rrbatch  = N_VCloneVectorArray(maxbatch, IDA_mem->ida_tempv1);
+  idals_mem->incbatch = (sunrealtype*)malloc(maxbatch * sizeof(sunrealtype));
+  idals_mem->maxbatch = maxbatch;
+  if ((idals_mem->yybatch == NULL) || (idals_mem->ypbatch == NULL) ||
+      (idals_mem->rrbatch == NULL) || (idals_mem->incbatch == NULL))
+  {
+    idaLsFreeResBatch(idals_mem);
+    IDAProcessError(IDA_mem, IDALS_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_LS_MEM_FAIL);
+    return (IDALS_MEM_FAIL);
+  }
+
+  idals_mem->resbatch = resbatch;
+
+  return (IDALS_SUCCESS);
+}
+
 /*===============================================================
   Optional Get routines
   ===============================================================*/
@@ -618,6 +703,13 @@ int IDAGetLinWorkSpace(void* ida_mem, long int* lenrwLS, long int* leniwLS)
     *leniwLS += 3 * liw1;
   }
 
+  /* add batched DQ Jacobian workspace (if applicable) */
+  if (idals_mem->resbatch && IDA_mem->ida_tempv1->ops->nvspace)
+  {
+    *lenrwLS += idals_mem->maxbatch * (3 * lrw1 + 1);
+    *leniwLS += 3 * idals_mem->maxbatch * liw1;
+  }
+
   /* add LS sizes */
   if (idals_mem->LS->ops->space)
   {
@@ -967,6 +1059,12 @@ int idaLsDenseDQJac(sunrealtype tt, sunrealtype c_j, N_Vector yy, N_Vector yp,
   /* access LsMem interface structure */
   idals_mem = (IDALsMem)IDA_mem->ida_lmem;
 
+  /* evaluate the perturbed residuals in batches (if enabled) */
+  if (idals_mem->resbatch)
+  {
+    return (idaLsDenseDQJacBatch(tt, c_j, yy, yp, rr, Jac, IDA_mem));
+  }
+
   /* access matrix dimension */
   N = SUNDenseMatrix_Columns(Jac);
 
@@ -1073,6 +1171,12 @@ int idaLsBandDQJac(sunrealtype tt, sunrealtype c_j, N_Vector yy, N_Vector yp,
   /* access LsMem interface structure */
   idals_mem = (IDALsMem)IDA_mem->ida_lmem;
 
+  /* evaluate the perturbed residuals in batches (if enabled) */
+  if (idals_mem->resbatch)
+  {
+    return (idaLsBandDQJacBatch(tt, c_j, yy, yp, rr, Jac, IDA_mem));
+  }
+
   /* access matrix dimensions */
   N      = SUNBandMatrix_Columns(Jac);
   mupper = SUNBandMatrix_UpperBandwidth(Jac);
@@ -1188,6 +1292,246 @@ int idaLsBandDQJac(sunrealtype tt, sunrealtype c_j, N_Vector yy, N_Vector yp,
   return (retval);
 }
 
+/*---------------------------------------------------------------
+  idaLsDQInc
+
+  This routine returns the increment used in the difference
+  quotient approximation of column j of the Jacobian, with the
+  same sign as hh*yp_j and adjusted again if y_j has an
+  inequality constraint.
+  ---------------------------------------------------------------*/
+sunrealtype idaLsDQInc(IDAMem IDA_mem, sunrealtype yj, sunrealtype ypj,
+                       sunrealtype ewtj, sunrealtype conj, sunrealtype srur)
+{
+  sunrealtype inc;
+
+  inc = SUNMAX(srur * SUNMAX(SUNRabs(yj), SUNRabs(IDA_mem->ida_hh * ypj)),
+               ONE / ewtj);
+  if (IDA_mem->ida_hh * ypj < ZERO) { inc = -inc; }
+  inc = (yj + inc) - yj;
+
+  if (IDA_mem->ida_constraintsSet)
+  {
+    if (SUNRabs(conj) == ONE)
+    {
+      if ((yj + inc) * conj < ZERO) { inc = -inc; }
+    }
+    else if (SUNRabs(conj) == TWO)
+    {
+      if ((yj + inc) * conj <= ZERO) { inc = -inc; }
+    }
+  }
+
+  return (inc);
+}
+
+/*---------------------------------------------------------------
+  idaLsDenseDQJacBatch
+
+  This routine computes the same dense difference quotient
+  approximation as idaLsDenseDQJac, but perturbs up to maxbatch
+  columns at a time and evaluates the perturbed residuals with a
+  single call to the user-supplied batched residual function.
+  ---------------------------------------------------------------*/
+int idaLsDenseDQJacBatch(sunrealtype tt, sunrealtype c_j, N_Vector yy,
+                         N_Vector yp, N_Vector rr, SUNMatrix Jac,
+                         IDAMem IDA_mem)
+{
+  sunrealtype inc_inv, srur, conj;
+  sunrealtype *y_data, *yp_data, *ewt_data, *cns_data = NULL;
+  N_Vector jthCol;
+  sunindextype j, N;
+  IDALsMem idals_mem;
+  int b, nbatch, retval = 0;
+
+  /* access LsMem interface structure */
+  idals_mem = (IDALsMem)IDA_mem->ida_lmem;
+
+  /* access matrix dimension */
+  N = SUNDenseMatrix_Columns(Jac);
+
+  /* Create an empty vector for matrix column calculations */
+  jthCol = N_VCloneEmpty(rr);
+
+  /* Obtain pointers to the data for ewt, yy, yp. */
+  ewt_data = N_VGetArrayPointer(IDA_mem->ida_ewt);
+  y_data   = N_VGetArrayPointer(yy);
+  yp_data  = N_VGetArrayPointer(yp);
+  if (IDA_mem->ida_constraintsSet)
+  {
+    cns_data = N_VGetArrayPointer(IDA_mem->ida_constraints);
+  }
+
+  srur = SUNRsqrt(IDA_mem->ida_uround);
+
+  for (j = 0; j < N; j += nbatch)
+  {
+    nbatch = (int)SUNMIN(idals_mem->maxbatch, N - j);
+
+    /* Perturb y_{j+b} and yp_{j+b} in the b-th batch vectors */
+    for (b = 0; b < nbatch; b++)
+    {
+      conj = (IDA_mem->ida_constraintsSet) ? cns_data[j + b] : ZERO;
+      idals_mem->incbatch[b] = idaLsDQInc(IDA_mem, y_data[j + b],
+                                          yp_data[j + b], ewt_data[j + b],
+                                          conj, srur);
+
+      N_VScale(ONE, yy, idals_mem->yybatch[b]);
+      N_VScale(ONE, yp, idals_mem->ypbatch[b]);
+      N_VGetArrayPointer(idals_mem->yybatch[b])[j + b] +=
+        idals_mem->incbatch[b];
+      N_VGetArrayPointer(idals_mem->ypbatch[b])[j + b] +=
+        c_j * idals_mem->incbatch[b];
+    }
+
+    retval = idals_mem->resbatch(tt, idals_mem->yybatch, idals_mem->ypbatch,
+                                 idals_mem->rrbatch, nbatch,
+                                 IDA_mem->ida_user_data);
+    idals_mem->nreDQ += nbatch;
+    if (retval != 0) { break; }
+
+    /* Form the difference quotients */
+    for (b = 0; b < nbatch; b++)
+    {
+      N_VSetArrayPointer(SUNDenseMatrix_Column(Jac, j + b), jthCol);
+      inc_inv = ONE / idals_mem->incbatch[b];
+      N_VLinearSum(inc_inv, idals_mem->rrbatch[b], -inc_inv, rr, jthCol);
+    }
+  }
+
+  /* Destroy jthCol vector */
+  N_VSetArrayPointer(NULL, jthCol);
+  N_VDestroy(jthCol);
+
+  return (retval);
+}
+
+/*---------------------------------------------------------------
+  idaLsBandDQJacBatch
+
+  This routine computes the same banded difference quotient
+  approximation as idaLsBandDQJac, but perturbs up to maxbatch
+  column groups at a time and evaluates the perturbed residuals
+  with a single call to the user-supplied batched residual
+  function.
+  ---------------------------------------------------------------*/
+int idaLsBandDQJacBatch(sunrealtype tt, sunrealtype c_j, N_Vector yy,
+                        N_Vector yp, N_Vector rr, SUNMatrix Jac, IDAMem IDA_mem)
+{
+  sunrealtype inc, inc_inv, srur, conj;
+  sunrealtype *y_data, *yp_data, *ewt_data, *cns_data = NULL;
+  sunrealtype *yb_data, *ypb_data, *rb_data, *r_data, *col_j;
+  sunindextype i, j, i1, i2, width, ngroups, group;
+  sunindextype N, mupper, mlower;
+  IDALsMem idals_mem;
+  int b, nbatch, retval = 0;
+
+  /* access LsMem interface structure */
+  idals_mem = (IDALsMem)IDA_mem->ida_lmem;
+
+  /* access matrix dimensions */
+  N      = SUNBandMatrix_Columns(Jac);
+  mupper = SUNBandMatrix_UpperBandwidth(Jac);
+  mlower = SUNBandMatrix_LowerBandwidth(Jac);
+
+  /* Obtain pointers to the data for ewt, rr, yy, yp. */
+  ewt_data = N_VGetArrayPointer(IDA_mem->ida_ewt);
+  r_data   = N_VGetArrayPointer(rr);
+  y_data   = N_VGetArrayPointer(yy);
+  yp_data  = N_VGetArrayPointer(yp);
+  if (IDA_mem->ida_constraintsSet)
+  {
+    cns_data = N_VGetArrayPointer(IDA_mem->ida_constraints);
+  }
+
+  /* Compute miscellaneous values for the Jacobian computation. */
+  srur    = SUNRsqrt(IDA_mem->ida_uround);
+  width   = mlower + mupper + 1;
+  ngroups = SUNMIN(width, N);
+
+  /* Loop over batches of column groups. */
+  for (group = 1; group <= ngroups; group += nbatch)
+  {
+    nbatch = (int)SUNMIN(idals_mem->maxbatch, ngroups - group + 1);
+
+    /* Increment all yy[j] and yp[j] of group + b in the b-th batch vectors */
+    for (b = 0; b < nbatch; b++)
+    {
+      N_VScale(ONE, yy, idals_mem->yybatch[b]);
+      N_VScale(ONE, yp, idals_mem->ypbatch[b]);
+      yb_data  = N_VGetArrayPointer(idals_mem->yybatch[b]);
+      ypb_data = N_VGetArrayPointer(idals_mem->ypbatch[b]);
+      for (j = group + b - 1; j < N; j += width)
+      {
+        conj = (IDA_mem->ida_constraintsSet) ? cns_data[j] : ZERO;
+        inc  = idaLsDQInc(IDA_mem, y_data[j], yp_data[j], ewt_data[j], conj,
+                          srur);
+        yb_data[j] += inc;
+        ypb_data[j] += c_j * inc;
+      }
+    }
+
+    retval = idals_mem->resbatch(tt, idals_mem->yybatch, idals_mem->ypbatch,
+                                 idals_mem->rrbatch, nbatch,
+                                 IDA_mem->ida_user_data);
+    idals_mem->nreDQ += nbatch;
+    if (retval != 0) { break; }
+
+    /* Load the difference quotient Jacobian elements */
+    for (b = 0; b < nbatch; b++)
+    {
+      rb_data = N_VGetArrayPointer(idals_mem->rrbatch[b]);
+      for (j = group + b - 1; j < N; j += width)
+      {
+        col_j   = SUNBandMatrix_Column(Jac, j);
+        conj    = (IDA_mem->ida_constraintsSet) ? cns_data[j] : ZERO;
+        inc     = idaLsDQInc(IDA_mem, y_data[j], yp_data[j], ewt_data[j], conj,
+                             srur);
+        inc_inv = ONE / inc;
+        i1      = SUNMAX(0, j - mupper);
+        i2      = SUNMIN(j + mlower, N - 1);
+        for (i = i1; i <= i2; i++)
+        {
+          SM_COLUMN_ELEMENT_B(col_j, i, j) = inc_inv * (rb_data[i] - r_data[i]);
+        }
+      }
+    }
+  }
+
+  return (retval);
+}
+
+/*---------------------------------------------------------------
+  idaLsFreeResBatch
+
+  This routine frees the batched DQ Jacobian workspace.
+  ---------------------------------------------------------------*/
+void idaLsFreeResBatch(IDALsMem idals_mem)
+{
+  if (idals_mem->yybatch)
+  {
+    N_VDestroyVectorArray(idals_mem->yybatch, idals_mem->maxbatch);
+    idals_mem->yybatch = NULL;
+  }
+  if (idals_mem->ypbatch)
+  {
+    N_VDestroyVectorArray(idals_mem->ypbatch, idals_mem->maxbatch);
+    idals_mem->ypbatch = NULL;
+  }
+  if (idals_mem->rrbatch)
+  {
+    N_VDestroyVectorArray(idals_mem->rrbatch, idals_mem->maxbatch);
+    idals_mem->rrbatch = NULL;
+  }
+  if (idals_mem->incbatch)
+  {
+    free(idals_mem->incbatch);
+    idals_mem->incbatch = NULL;
+  }
+  idals_mem->resbatch = NULL;
+  idals_mem->maxbatch = 0;
+}
+
 /*---------------------------------------------------------------
   idaLsDQJtimes
 
@@ -1414,6 +1758,13 @@ int idaLsSetup(IDAMem IDA_mem, N_Vector y, N_Vector yp, N_Vector r,
       idals_mem->last_flag = IDALS_JACFUNC_RECVR;
       return (1);
     }
+
+    /* Write J to the capture archive (if selected) */
+    if (idals_mem->capture)
+    {
+      (void)SUNLinSysCapture_Matrix(idals_mem->capture, IDA_mem->ida_tn,
+                                    IDA_mem->ida_cj, idals_mem->J);
+    }
   }
 
   /* Call LS setup routine -- the LS will call idaLsPSetup if applicable */
@@ -1520,6 +1871,12 @@ int idaLsSolve(IDAMem IDA_mem, N_Vector b, N_Vector weight, N_Vector ycur,
     }
   }
 
+  /* Write b to the capture archive (if J was captured) */
+  if (idals_mem->capture)
+  {
+    (void)SUNLinSysCapture_Rhs(idals_mem->capture, IDA_mem->ida_tn, tol, b);
+  }
+
   /* Call solver */
   retval = SUNLinSolSolve(idals_mem->LS, idals_mem->J, idals_mem->x, b, tol);
 
@@ -1690,6 +2047,9 @@ int idaLsFree(IDAMem IDA_mem)
   /* Nullify SUNMatrix pointer */
   idals_mem->J = NULL;
 
+  /* Free batched DQ Jacobian workspace */
+  idaLsFreeResBatch(idals_mem);
+
   /* Free preconditioner memory (if applicable) */
   if (idals_mem->pfree) { idals_mem->pfree(IDA_mem); }
 
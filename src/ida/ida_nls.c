@@ -247,9 +247,17 @@ static int idaNlsLSetup(SUNDIALS_MAYBE_UNUSED sunbooleantype jbad,
   IDA_mem = (IDAMem)ida_mem;
 
   IDA_mem->ida_nsetups++;
+  if (IDA_mem->ida_telemetry)
+  {
+    IDA_mem->ida_tel_step.rec.wall_lsetup -= sunTelemetryWallTime();
+  }
   retval = IDA_mem->ida_lsetup(IDA_mem, IDA_mem->ida_yy, IDA_mem->ida_yp,
                                IDA_mem->ida_savres, IDA_mem->ida_tempv1,
                                IDA_mem->ida_tempv2, IDA_mem->ida_tempv3);
+  if (IDA_mem->ida_telemetry)
+  {
+    IDA_mem->ida_tel_step.rec.wall_lsetup += sunTelemetryWallTime();
+  }
 
   /* update Jacobian status */
   *jcur = SUNTRUE;
@@ -277,8 +285,16 @@ static int idaNlsLSolve(N_Vector delta, void* ida_mem)
   }
   IDA_mem = (IDAMem)ida_mem;
 
+  if (IDA_mem->ida_telemetry)
+  {
+    IDA_mem->ida_tel_step.rec.wall_lsolve -= sunTelemetryWallTime();
+  }
   retval = IDA_mem->ida_lsolve(IDA_mem, delta, IDA_mem->ida_ewt, IDA_mem->ida_yy,
                                IDA_mem->ida_yp, IDA_mem->ida_savres);
+  if (IDA_mem->ida_telemetry)
+  {
+    IDA_mem->ida_tel_step.rec.wall_lsolve += sunTelemetryWallTime();
+  }
 
   if (retval < 0) { return (IDA_LSOLVE_FAIL); }
   if (retval > 0) { return (IDA_LSOLVE_RECVR); }
@@ -1002,6 +1002,26 @@ SWIGEXPORT int _wrap_FIDAGetDky(void *farg1, double const *farg2, int const *far
 }
 
 
+SWIGEXPORT int _wrap_FIDAGetDkyBatch(void *farg1, int const *farg2, double *farg3, int const *farg4, void *farg5) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  int arg2 ;
+  sunrealtype *arg3 = (sunrealtype *) 0 ;
+  int arg4 ;
+  N_Vector *arg5 = (N_Vector *) 0 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (int)(*farg2);
+  arg3 = (sunrealtype *)(farg3);
+  arg4 = (int)(*farg4);
+  arg5 = (N_Vector *)(farg5);
+  result = (int)IDAGetDkyBatch(arg1,arg2,arg3,arg4,arg5);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FIDAGetWorkSpace(void *farg1, long *farg2, long *farg3) {
   int fresult ;
   void *arg1 = (void *) 0 ;
@@ -1875,6 +1895,22 @@ SWIGEXPORT int _wrap_FIDASetSensParams(void *farg1, double *farg2, double *farg3
 }
 
 
+SWIGEXPORT int _wrap_FIDASetSensResBatchFn(void *farg1, IDALsResBatchFn farg2, int const *farg3) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  IDALsResBatchFn arg2 = (IDALsResBatchFn) 0 ;
+  int arg3 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (IDALsResBatchFn)(farg2);
+  arg3 = (int)(*farg3);
+  result = (int)IDASetSensResBatchFn(arg1,arg2,arg3);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FIDASetNonlinearSolverSensSim(void *farg1, SUNNonlinearSolver farg2) {
   int fresult ;
   void *arg1 = (void *) 0 ;
@@ -2703,6 +2739,40 @@ SWIGEXPORT int _wrap_FIDAAdjSetNoSensi(void *farg1) {
 }
 
 
+SWIGEXPORT int _wrap_FIDAAdjSetCheckPointFile(void *farg1, SwigArrayWrapper *farg2) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  char *arg2 = (char *) 0 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (char *)(farg2->data);
+  result = (int)IDAAdjSetCheckPointFile(arg1,(char const *)arg2);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
+SWIGEXPORT int _wrap_FIDAAdjSetCheckPointStorage(void *farg1, void *farg2, IDAAdjCheckPointStoreFn farg3, IDAAdjCheckPointLoadFn farg4, IDAAdjCheckPointFreeFn farg5) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  void *arg2 = (void *) 0 ;
+  IDAAdjCheckPointStoreFn arg3 = (IDAAdjCheckPointStoreFn) 0 ;
+  IDAAdjCheckPointLoadFn arg4 = (IDAAdjCheckPointLoadFn) 0 ;
+  IDAAdjCheckPointFreeFn arg5 = (IDAAdjCheckPointFreeFn) 0 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (void *)(farg2);
+  arg3 = (IDAAdjCheckPointStoreFn)(farg3);
+  arg4 = (IDAAdjCheckPointLoadFn)(farg4);
+  arg5 = (IDAAdjCheckPointFreeFn)(farg5);
+  result = (int)IDAAdjSetCheckPointStorage(arg1,arg2,arg3,arg4,arg5);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FIDASetUserDataB(void *farg1, int const *farg2, void *farg3) {
   int fresult ;
   void *arg1 = (void *) 0 ;
@@ -3165,6 +3235,24 @@ SWIGEXPORT int _wrap_FIDAGetAdjCheckPointsInfo(void *farg1, SwigClassWrapper con
 }
 
 
+SWIGEXPORT int _wrap_FIDAGetAdjCheckPointFileStats(void *farg1, long *farg2, long *farg3, long *farg4) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  long *arg2 = (long *) 0 ;
+  long *arg3 = (long *) 0 ;
+  long *arg4 = (long *) 0 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (long *)(farg2);
+  arg3 = (long *)(farg3);
+  arg4 = (long *)(farg4);
+  result = (int)IDAGetAdjCheckPointFileStats(arg1,arg2,arg3,arg4);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FIDASetJacTimesResFnB(void *farg1, int const *farg2, IDAResFn farg3) {
   int fresult ;
   void *arg1 = (void *) 0 ;
@@ -3479,6 +3567,22 @@ SWIGEXPORT int _wrap_FIDASetIncrementFactor(void *farg1, double const *farg2) {
 }
 
 
+SWIGEXPORT int _wrap_FIDASetJacResBatchFn(void *farg1, IDALsResBatchFn farg2, int const *farg3) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  IDALsResBatchFn arg2 = (IDALsResBatchFn) 0 ;
+  int arg3 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (IDALsResBatchFn)(farg2);
+  arg3 = (int)(*farg3);
+  result = (int)IDASetJacResBatchFn(arg1,arg2,arg3);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FIDAGetJac(void *farg1, void *farg2) {
   int fresult ;
   void *arg1 = (void *) 0 ;
@@ -133,6 +133,7 @@ module fidas_mod
  public :: FIDAComputeYSens
  public :: FIDAComputeYpSens
  public :: FIDAGetDky
+ public :: FIDAGetDkyBatch
  public :: FIDAGetWorkSpace
  public :: FIDAGetNumSteps
  public :: FIDAGetNumResEvals
@@ -194,6 +195,7 @@ module fidas_mod
  public :: FIDASetSensErrCon
  public :: FIDASetSensMaxNonlinIters
  public :: FIDASetSensParams
+ public :: FIDASetSensResBatchFn
  public :: FIDASetNonlinearSolverSensSim
  public :: FIDASetNonlinearSolverSensStg
  public :: FIDASensToggleOff
@@ -246,6 +248,8 @@ module fidas_mod
  public :: FIDASolveF
  public :: FIDASolveB
  public :: FIDAAdjSetNoSensi
+ public :: FIDAAdjSetCheckPointFile
+ public :: FIDAAdjSetCheckPointStorage
  public :: FIDASetUserDataB
  public :: FIDASetMaxOrdB
  public :: FIDASetMaxNumStepsB
@@ -295,6 +299,7 @@ module fidas_mod
   module procedure swigf_create_IDAadjCheckPointRec
  end interface
  public :: FIDAGetAdjCheckPointsInfo
+ public :: FIDAGetAdjCheckPointFileStats
  public :: FIDASetJacTimesResFnB
  public :: FIDAGetAdjDataPointHermite
  public :: FIDAGetAdjDataPointPolynomial
@@ -325,6 +330,7 @@ module fidas_mod
  public :: FIDASetLSNormFactor
  public :: FIDASetLinearSolutionScaling
  public :: FIDASetIncrementFactor
+ public :: FIDASetJacResBatchFn
  public :: FIDAGetJac
  public :: FIDAGetJacCj
  public :: FIDAGetJacTime
@@ -794,6 +800,18 @@ type(C_PTR), value :: farg4
 integer(C_INT) :: fresult
 end function
 
+function swigc_FIDAGetDkyBatch(farg1, farg2, farg3, farg4, farg5) &
+bind(C, name="_wrap_FIDAGetDkyBatch") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+type(C_PTR), value :: farg3
+integer(C_INT), intent(in) :: farg4
+type(C_PTR), value :: farg5
+integer(C_INT) :: fresult
+end function
+
 function swigc_FIDAGetWorkSpace(farg1, farg2, farg3) &
 bind(C, name="_wrap_FIDAGetWorkSpace") &
 result(fresult)
@@ -1350,6 +1368,16 @@ type(C_PTR), value :: farg4
 integer(C_INT) :: fresult
 end function
 
+function swigc_FIDASetSensResBatchFn(farg1, farg2, farg3) &
+bind(C, name="_wrap_FIDASetSensResBatchFn") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_FUNPTR), value :: farg2
+integer(C_INT), intent(in) :: farg3
+integer(C_INT) :: fresult
+end function
+
 function swigc_FIDASetNonlinearSolverSensSim(farg1, farg2) &
 bind(C, name="_wrap_FIDASetNonlinearSolverSensSim") &
 result(fresult)
@@ -1868,6 +1896,28 @@ type(C_PTR), value :: farg1
 integer(C_INT) :: fresult
 end function
 
+function swigc_FIDAAdjSetCheckPointFile(farg1, farg2) &
+bind(C, name="_wrap_FIDAAdjSetCheckPointFile") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+import :: swigarraywrapper
+type(C_PTR), value :: farg1
+type(SwigArrayWrapper) :: farg2
+integer(C_INT) :: fresult
+end function
+
+function swigc_FIDAAdjSetCheckPointStorage(farg1, farg2, farg3, farg4, farg5) &
+bind(C, name="_wrap_FIDAAdjSetCheckPointStorage") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_PTR), value :: farg2
+type(C_FUNPTR), value :: farg3
+type(C_FUNPTR), value :: farg4
+type(C_FUNPTR), value :: farg5
+integer(C_INT) :: fresult
+end function
+
 function swigc_FIDASetUserDataB(farg1, farg2, farg3) &
 bind(C, name="_wrap_FIDASetUserDataB") &
 result(fresult)
@@ -2174,6 +2224,17 @@ type(SwigClassWrapper) :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FIDAGetAdjCheckPointFileStats(farg1, farg2, farg3, farg4) &
+bind(C, name="_wrap_FIDAGetAdjCheckPointFileStats") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_PTR), value :: farg2
+type(C_PTR), value :: farg3
+type(C_PTR), value :: farg4
+integer(C_INT) :: fresult
+end function
+
 function swigc_FIDASetJacTimesResFnB(farg1, farg2, farg3) &
 bind(C, name="_wrap_FIDASetJacTimesResFnB") &
 result(fresult)
@@ -2367,6 +2428,16 @@ real(C_DOUBLE), intent(in) :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FIDASetJacResBatchFn(farg1, farg2, farg3) &
+bind(C, name="_wrap_FIDASetJacResBatchFn") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_FUNPTR), value :: farg2
+integer(C_INT), intent(in) :: farg3
+integer(C_INT) :: fresult
+end function
+
 function swigc_FIDAGetJac(farg1, farg2) &
 bind(C, name="_wrap_FIDAGetJac") &
 result(fresult)
@@ -3426,6 +3497,31 @@ fresult = swigc_FIDAGetDky(farg1, farg2, farg3, farg4)
 swig_result = fresult
 end function
 
+function FIDAGetDkyBatch(ida_mem, nt, t, k, dky) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: ida_mem
+integer(C_INT), intent(in) :: nt
+real(C_DOUBLE), dimension(*), target, intent(inout) :: t
+integer(C_INT), intent(in) :: k
+type(C_PTR) :: dky
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+type(C_PTR) :: farg3 
+integer(C_INT) :: farg4 
+type(C_PTR) :: farg5 
+
+farg1 = ida_mem
+farg2 = nt
+farg3 = c_loc(t(1))
+farg4 = k
+farg5 = dky
+fresult = swigc_FIDAGetDkyBatch(farg1, farg2, farg3, farg4, farg5)
+swig_result = fresult
+end function
+
 function FIDAGetWorkSpace(ida_mem, lenrw, leniw) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -4468,6 +4564,25 @@ fresult = swigc_FIDASetSensParams(farg1, farg2, farg3, farg4)
 swig_result = fresult
 end function
 
+function FIDASetSensResBatchFn(ida_mem, resbatch, maxbatch) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: ida_mem
+type(C_FUNPTR), intent(in), value :: resbatch
+integer(C_INT), intent(in) :: maxbatch
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_FUNPTR) :: farg2 
+integer(C_INT) :: farg3 
+
+farg1 = ida_mem
+farg2 = resbatch
+farg3 = maxbatch
+fresult = swigc_FIDASetSensResBatchFn(farg1, farg2, farg3)
+swig_result = fresult
+end function
+
 function FIDASetNonlinearSolverSensSim(ida_mem, nls) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -5456,6 +5571,65 @@ fresult = swigc_FIDAAdjSetNoSensi(farg1)
 swig_result = fresult
 end function
 
+subroutine SWIG_string_to_chararray(string, chars, wrap)
+  use, intrinsic :: ISO_C_BINDING
+  character(kind=C_CHAR, len=*), intent(IN) :: string
+  character(kind=C_CHAR), dimension(:), target, allocatable, intent(OUT) :: chars
+  type(SwigArrayWrapper), intent(OUT) :: wrap
+  integer :: i
+
+  allocate(character(kind=C_CHAR) :: chars(len(string) + 1))
+  do i=1,len(string)
+    chars(i) = string(i:i)
+  end do
+  i = len(string) + 1
+  chars(i) = C_NULL_CHAR ! C string compatibility
+  wrap%data = c_loc(chars)
+  wrap%size = len(string)
+end subroutine
+
+function FIDAAdjSetCheckPointFile(ida_mem, fname) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: ida_mem
+character(kind=C_CHAR, len=*), target :: fname
+character(kind=C_CHAR), dimension(:), allocatable, target :: farg2_chars
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(SwigArrayWrapper) :: farg2 
+
+farg1 = ida_mem
+call SWIG_string_to_chararray(fname, farg2_chars, farg2)
+fresult = swigc_FIDAAdjSetCheckPointFile(farg1, farg2)
+swig_result = fresult
+end function
+
+function FIDAAdjSetCheckPointStorage(ida_mem, content, store, load, freefn) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: ida_mem
+type(C_PTR) :: content
+type(C_FUNPTR), intent(in), value :: store
+type(C_FUNPTR), intent(in), value :: load
+type(C_FUNPTR), intent(in), value :: freefn
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_PTR) :: farg2 
+type(C_FUNPTR) :: farg3 
+type(C_FUNPTR) :: farg4 
+type(C_FUNPTR) :: farg5 
+
+farg1 = ida_mem
+farg2 = content
+farg3 = store
+farg4 = load
+farg5 = freefn
+fresult = swigc_FIDAAdjSetCheckPointStorage(farg1, farg2, farg3, farg4, farg5)
+swig_result = fresult
+end function
+
 function FIDASetUserDataB(ida_mem, which, user_datab) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -5981,6 +6155,28 @@ fresult = swigc_FIDAGetAdjCheckPointsInfo(farg1, farg2)
 swig_result = fresult
 end function
 
+function FIDAGetAdjCheckPointFileStats(ida_mem, nckfile, nbyteswrite, nbytesread) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: ida_mem
+integer(C_LONG), dimension(*), target, intent(inout) :: nckfile
+integer(C_LONG), dimension(*), target, intent(inout) :: nbyteswrite
+integer(C_LONG), dimension(*), target, intent(inout) :: nbytesread
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_PTR) :: farg2 
+type(C_PTR) :: farg3 
+type(C_PTR) :: farg4 
+
+farg1 = ida_mem
+farg2 = c_loc(nckfile(1))
+farg3 = c_loc(nbyteswrite(1))
+farg4 = c_loc(nbytesread(1))
+fresult = swigc_FIDAGetAdjCheckPointFileStats(farg1, farg2, farg3, farg4)
+swig_result = fresult
+end function
+
 function FIDASetJacTimesResFnB(ida_mem, which, jtimesresfn) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -6362,6 +6558,25 @@ fresult = swigc_FIDASetIncrementFactor(farg1, farg2)
 swig_result = fresult
 end function
 
+function FIDASetJacResBatchFn(ida_mem, resbatch, maxbatch) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: ida_mem
+type(C_FUNPTR), intent(in), value :: resbatch
+integer(C_INT), intent(in) :: maxbatch
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_FUNPTR) :: farg2 
+integer(C_INT) :: farg3 
+
+farg1 = ida_mem
+farg2 = resbatch
+farg3 = maxbatch
+fresult = swigc_FIDASetJacResBatchFn(farg1, farg2, farg3)
+swig_result = fresult
+end function
+
 function FIDAGetJac(ida_mem, j) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
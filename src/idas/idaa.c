@@ -149,6 +149,19 @@ int IDAAdjInit(void* ida_mem, long int steps, int interp)
   IDAADJ_mem->ia_nckpnts   = 0;
   IDAADJ_mem->ia_ckpntData = NULL;
 
+  /* By default check points are held in memory */
+  IDAADJ_mem->ia_ckcontent = NULL;
+  IDAADJ_mem->ia_ckstore   = NULL;
+  IDAADJ_mem->ia_ckload    = NULL;
+  IDAADJ_mem->ia_ckfree    = NULL;
+  IDAADJ_mem->ia_ckasync   = NULL;
+  IDAADJ_mem->ia_ckindex   = 0;
+  IDAADJ_mem->ia_ckbuf     = NULL;
+  IDAADJ_mem->ia_ckbuflen  = 0;
+  IDAADJ_mem->ia_nckfile   = 0;
+  IDAADJ_mem->ia_ckfwrite  = 0;
+  IDAADJ_mem->ia_ckfread   = 0;
+
   /* Initialization of interpolation data. */
   IDAADJ_mem->ia_interpType = interp;
   IDAADJ_mem->ia_nsteps     = steps;
@@ -297,6 +310,10 @@ void IDAAdjFree(void* ida_mem)
       IDAAckpntDelete(&(IDAADJ_mem->ck_mem));
     }
 
+    /* Free the check point storage */
+    IDAAckpntStorageFree(IDAADJ_mem);
+    free(IDAADJ_mem->ia_ckbuf);
+
     IDAAdataFree(IDA_mem);
 
     /* Free all backward problems. */
@@ -454,7 +471,15 @@ int IDASolveF(void* ida_mem, sunrealtype tout, sunrealtype* tret, N_Vector yret,
   if (IDAADJ_mem->ia_firstIDAFcall)
   {
     IDAADJ_mem->ia_tinitial = IDA_mem->ida_tn;
-    IDAADJ_mem->ck_mem      = IDAAckpntInit(IDA_mem);
+
+    flag = IDAAckpntStorageStart(IDA_mem);
+    if (flag != IDA_SUCCESS)
+    {
+      SUNDIALS_MARK_FUNCTION_END(IDA_PROFILER);
+      return (flag);
+    }
+
+    IDAADJ_mem->ck_mem = IDAAckpntInit(IDA_mem);
     if (IDAADJ_mem->ck_mem == NULL)
     {
       IDAProcessError(IDA_mem, IDA_MEM_FAIL, __LINE__, __func__, __FILE__,
@@ -2000,6 +2025,11 @@ static IDAckpntMem IDAAckpntInit(IDAMem IDA_mem)
   /* Alloc 3: current order, i.e. 1,  +   2. */
   ck_mem->ck_phi_alloc = 3;
 
+  /* The initial check point is always held in memory */
+  ck_mem->ck_stored = SUNFALSE;
+  ck_mem->ck_index  = 0;
+  ck_mem->ck_size   = 0;
+
   if (!IDAAckpntAllocVectors(IDA_mem, ck_mem))
   {
     free(ck_mem);
@@ -2071,6 +2101,22 @@ static IDAckpntMem IDAAckpntNew(IDAMem IDA_mem)
   ck_mem->ck_phi_alloc = (IDA_mem->ida_kk + 2 < MXORDP1) ? IDA_mem->ida_kk + 2
                                                          : MXORDP1;
 
+  /* Hand phi* vectors from IDA_mem to the check point storage, if any. */
+  ck_mem->ck_stored = SUNFALSE;
+  ck_mem->ck_index  = 0;
+  ck_mem->ck_size   = 0;
+
+  if (IDA_mem->ida_adj_mem->ia_ckstore != NULL)
+  {
+    if (!IDAAckpntStore(IDA_mem, ck_mem))
+    {
+      free(ck_mem);
+      ck_mem = NULL;
+      return (NULL);
+    }
+    return (ck_mem);
+  }
+
   if (!IDAAckpntAllocVectors(IDA_mem, ck_mem))
   {
     free(ck_mem);
@@ -2101,29 +2147,32 @@ static void IDAAckpntDelete(IDAckpntMem* ck_memPtr)
     /* move head of list */
     *ck_memPtr = (*ck_memPtr)->ck_next;
 
-    /* free N_Vectors in tmp */
-    for (j = 0; j < tmp->ck_phi_alloc; j++) { N_VDestroy(tmp->ck_phi[j]); }
-
-    /* free N_Vectors for quadratures in tmp */
-    if (tmp->ck_quadr)
+    /* free N_Vectors in tmp, unless they are in the check point storage */
+    if (!tmp->ck_stored)
     {
-      for (j = 0; j < tmp->ck_phi_alloc; j++) { N_VDestroy(tmp->ck_phiQ[j]); }
-    }
+      for (j = 0; j < tmp->ck_phi_alloc; j++) { N_VDestroy(tmp->ck_phi[j]); }
 
-    /* Free sensitivity related data. */
-    if (tmp->ck_sensi)
-    {
-      for (j = 0; j < tmp->ck_phi_alloc; j++)
+      /* free N_Vectors for quadratures in tmp */
+      if (tmp->ck_quadr)
       {
-        N_VDestroyVectorArray(tmp->ck_phiS[j], tmp->ck_Ns);
+        for (j = 0; j < tmp->ck_phi_alloc; j++) { N_VDestroy(tmp->ck_phiQ[j]); }
       }
-    }
 
-    if (tmp->ck_quadr_sensi)
-    {
-      for (j = 0; j < tmp->ck_phi_alloc; j++)
+      /* Free sensitivity related data. */
+      if (tmp->ck_sensi)
+      {
+        for (j = 0; j < tmp->ck_phi_alloc; j++)
+        {
+          N_VDestroyVectorArray(tmp->ck_phiS[j], tmp->ck_Ns);
+        }
+      }
+
+      if (tmp->ck_quadr_sensi)
       {
-        N_VDestroyVectorArray(tmp->ck_phiQS[j], tmp->ck_Ns);
+        for (j = 0; j < tmp->ck_phi_alloc; j++)
+        {
+          N_VDestroyVectorArray(tmp->ck_phiQS[j], tmp->ck_Ns);
+        }
       }
     }
 
@@ -2505,38 +2554,45 @@ static int IDAAckpntGet(IDAMem IDA_mem, IDAckpntMem ck_mem)
     IDA_mem->ida_ss       = ck_mem->ck_ss;
     IDA_mem->ida_ssS      = ck_mem->ck_ssS;
 
-    /* Copy the arrays from check point data structure */
-    for (j = 0; j < ck_mem->ck_phi_alloc; j++)
+    /* Copy the arrays from check point data structure or storage */
+    if (ck_mem->ck_stored)
     {
-      N_VScale(ONE, ck_mem->ck_phi[j], IDA_mem->ida_phi[j]);
+      if (!IDAAckpntLoad(IDA_mem, ck_mem)) { return (IDA_MEM_FAIL); }
     }
-
-    if (ck_mem->ck_quadr)
+    else
     {
       for (j = 0; j < ck_mem->ck_phi_alloc; j++)
       {
-        N_VScale(ONE, ck_mem->ck_phiQ[j], IDA_mem->ida_phiQ[j]);
+        N_VScale(ONE, ck_mem->ck_phi[j], IDA_mem->ida_phi[j]);
       }
-    }
 
-    if (ck_mem->ck_sensi)
-    {
-      for (is = 0; is < IDA_mem->ida_Ns; is++)
+      if (ck_mem->ck_quadr)
       {
         for (j = 0; j < ck_mem->ck_phi_alloc; j++)
         {
-          N_VScale(ONE, ck_mem->ck_phiS[j][is], IDA_mem->ida_phiS[j][is]);
+          N_VScale(ONE, ck_mem->ck_phiQ[j], IDA_mem->ida_phiQ[j]);
         }
       }
-    }
 
-    if (ck_mem->ck_quadr_sensi)
-    {
-      for (is = 0; is < IDA_mem->ida_Ns; is++)
+      if (ck_mem->ck_sensi)
       {
-        for (j = 0; j < ck_mem->ck_phi_alloc; j++)
+        for (is = 0; is < IDA_mem->ida_Ns; is++)
+        {
+          for (j = 0; j < ck_mem->ck_phi_alloc; j++)
+          {
+            N_VScale(ONE, ck_mem->ck_phiS[j][is], IDA_mem->ida_phiS[j][is]);
+          }
+        }
+      }
+
+      if (ck_mem->ck_quadr_sensi)
+      {
+        for (is = 0; is < IDA_mem->ida_Ns; is++)
         {
-          N_VScale(ONE, ck_mem->ck_phiQS[j][is], IDA_mem->ida_phiQS[j][is]);
+          for (j = 0; j < ck_mem->ck_phi_alloc; j++)
+          {
+            N_VScale(ONE, ck_mem->ck_phiQS[j][is], IDA_mem->ida_phiQS[j][is]);
+          }
         }
       }
     }
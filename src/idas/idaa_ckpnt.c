@@ -0,0 +1,685 @@
+/*
+ * -----------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the implementation file for the adjoint check point
+ * storage in the IDAS solver. The phi* arrays of each check point
+ * after the first are packed with N_VBufPack into one buffer and
+ * handed to the store function of the storage, e.g., the check
+ * point file set by IDAAdjSetCheckPointFile or a user storage set
+ * by IDAAdjSetCheckPointStorage.
+ *
+ * When SUNDIALS_ENABLE_ASYNC_OUTPUT is defined, the store and load
+ * functions are called by a storage thread. Check points are stored
+ * behind the forward integration, and during a backward sweep the
+ * check point the next interval starts from is loaded ahead.
+ * -----------------------------------------------------------------
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "idas_impl.h"
+#include "sundials_threads_impl.h"
+#include "sundials_utils.h"
+
+/*
+ * =================================================================
+ * CHECK POINT FILE
+ * =================================================================
+ */
+
+/* Check point k is stored at offsets[k] */
+typedef struct
+{
+  FILE* fp;
+  char* fname;
+  int64_t* offsets;
+  long int noffsets;
+  int64_t end;
+} IDAckpntFile;
+
+static int IDAAckpntFileStore(long int index, const void* data, size_t size,
+                              void* content)
+{
+  IDAckpntFile* file = (IDAckpntFile*)content;
+  int64_t* offsets;
+  long int n;
+
+  /* A new forward integration overwrites the file */
+  if (index == 0) { file->end = 0; }
+
+  if (index >= file->noffsets)
+  {
+    n = (index < 2 * file->noffsets) ? 2 * file->noffsets : index + 1;
+    offsets = (int64_t*)realloc(file->offsets, n * sizeof(int64_t));
+    if (offsets == NULL) { return (-1); }
+    file->offsets  = offsets;
+    file->noffsets = n;
+  }
+
+  if (sunFileSeek(file->fp, file->end, SEEK_SET)) { return (-1); }
+  if (fwrite(data, 1, size, file->fp) != size) { return (-1); }
+
+  file->offsets[index] = file->end;
+  file->end += (int64_t)size;
+
+  return (0);
+}
+
+static int IDAAckpntFileLoad(long int index, void* data, size_t size,
+                             void* content)
+{
+  IDAckpntFile* file = (IDAckpntFile*)content;
+
+  if (index < 0 || index >= file->noffsets) { return (-1); }
+  if (sunFileSeek(file->fp, file->offsets[index], SEEK_SET)) { return (-1); }
+  if (fread(data, 1, size, file->fp) != size) { return (-1); }
+
+  return (0);
+}
+
+static void IDAAckpntFileFree(void* content)
+{
+  IDAckpntFile* file = (IDAckpntFile*)content;
+
+  fclose(file->fp);
+  remove(file->fname);
+  free(file->fname);
+  free(file->offsets);
+  free(file);
+}
+
+/*
+ * =================================================================
+ * STORAGE THREAD
+ * =================================================================
+ */
+
+#if defined(SUNDIALS_ENABLE_ASYNC_OUTPUT)
+
+#define CKPNT_NBUFFERS 2
+
+/* States of the read ahead */
+#define CKPNT_READ_IDLE   0
+#define CKPNT_READ_QUEUED 1
+#define CKPNT_READ_DONE   2
+
+struct IDAckpntAsyncRec
+{
+  void* content;                   /* storage content                   */
+  IDAAdjCheckPointStoreFn store;   /* storage store function            */
+  IDAAdjCheckPointLoadFn load;     /* storage load function             */
+  void* wbuf[CKPNT_NBUFFERS];      /* packed check points to store      */
+  size_t wlen[CKPNT_NBUFFERS];     /* write buffer lengths              */
+  size_t wsize[CKPNT_NBUFFERS];    /* sizes of the queued check points  */
+  long int windex[CKPNT_NBUFFERS]; /* indices of the queued points      */
+  long int nqueued;                /* check points queued               */
+  long int nstored;                /* check points stored by the thread */
+  void* rbuf;                      /* check point loaded ahead          */
+  size_t rlen;                     /* read buffer length                */
+  size_t rsize;                    /* size of the read ahead            */
+  long int rindex;                 /* index of the read ahead           */
+  int rstate;                      /* state of the read ahead           */
+  int err;                         /* first store error in the thread   */
+  sunbooleantype stop;             /* the thread should exit            */
+  sunMutex mutex;                  /* protects the counts, rstate, err  */
+  sunCond work;                    /* signaled when work is queued      */
+  sunCond done;                    /* signaled when work is completed   */
+  sunThread thread;                /* storage thread                    */
+};
+
+static void* IDAAckpntThread(void* arg)
+{
+  struct IDAckpntAsyncRec* async = (struct IDAckpntAsyncRec*)arg;
+  int k, retval;
+
+  sunMutexLock(&async->mutex);
+  for (;;)
+  {
+    while (async->nstored == async->nqueued &&
+           async->rstate != CKPNT_READ_QUEUED && !async->stop)
+    {
+      sunCondWait(&async->work, &async->mutex);
+    }
+
+    if (async->nstored != async->nqueued)
+    {
+      /* Queued check points are stored first and in order */
+      k = (int)(async->nstored % CKPNT_NBUFFERS);
+      sunMutexUnlock(&async->mutex);
+
+      retval = async->store(async->windex[k], async->wbuf[k], async->wsize[k],
+                            async->content);
+
+      sunMutexLock(&async->mutex);
+      if (retval && !async->err) { async->err = retval; }
+      async->nstored++;
+      sunCondSignal(&async->done);
+    }
+    else if (async->rstate == CKPNT_READ_QUEUED)
+    {
+      sunMutexUnlock(&async->mutex);
+
+      retval = async->load(async->rindex, async->rbuf, async->rsize,
+                           async->content);
+
+      /* A failed read ahead is repeated, and reported, by IDAAckpntLoad */
+      sunMutexLock(&async->mutex);
+      async->rstate = retval ? CKPNT_READ_IDLE : CKPNT_READ_DONE;
+      sunCondSignal(&async->done);
+    }
+    else { break; }
+  }
+  sunMutexUnlock(&async->mutex);
+
+  return (NULL);
+}
+
+/* Waits until the thread is idle and cancels the read ahead. Returns the
+   first store error since the last call and the index of the check point
+   loaded ahead, or -1 if there is none. */
+static int IDAAckpntAsyncWait(struct IDAckpntAsyncRec* async, long int* rindex)
+{
+  int err;
+
+  sunMutexLock(&async->mutex);
+  while (async->nstored != async->nqueued ||
+         async->rstate == CKPNT_READ_QUEUED)
+  {
+    sunCondWait(&async->done, &async->mutex);
+  }
+  *rindex = (async->rstate == CKPNT_READ_DONE) ? async->rindex : -1;
+  err     = async->err;
+
+  async->rstate = CKPNT_READ_IDLE;
+  async->err    = 0;
+  sunMutexUnlock(&async->mutex);
+
+  return (err);
+}
+
+/* Starts the storage thread. On failure the storage is used synchronously. */
+static void IDAAckpntAsyncCreate(IDAadjMem IDAADJ_mem)
+{
+  struct IDAckpntAsyncRec* async;
+
+  async = (struct IDAckpntAsyncRec*)calloc(1, sizeof(struct IDAckpntAsyncRec));
+  if (async == NULL) { return; }
+
+  async->content = IDAADJ_mem->ia_ckcontent;
+  async->store   = IDAADJ_mem->ia_ckstore;
+  async->load    = IDAADJ_mem->ia_ckload;
+
+  if (sunMutexInit(&async->mutex))
+  {
+    free(async);
+    return;
+  }
+  if (sunCondInit(&async->work))
+  {
+    sunMutexDestroy(&async->mutex);
+    free(async);
+    return;
+  }
+  if (sunCondInit(&async->done))
+  {
+    sunCondDestroy(&async->work);
+    sunMutexDestroy(&async->mutex);
+    free(async);
+    return;
+  }
+  if (sunThreadCreate(&async->thread, IDAAckpntThread, async))
+  {
+    sunCondDestroy(&async->done);
+    sunCondDestroy(&async->work);
+    sunMutexDestroy(&async->mutex);
+    free(async);
+    return;
+  }
+
+  IDAADJ_mem->ia_ckasync = async;
+}
+
+/* Stores the queued check points and stops the storage thread */
+static void IDAAckpntAsyncFree(IDAadjMem IDAADJ_mem)
+{
+  struct IDAckpntAsyncRec* async = IDAADJ_mem->ia_ckasync;
+  long int rindex;
+  int k;
+
+  (void)IDAAckpntAsyncWait(async, &rindex);
+
+  sunMutexLock(&async->mutex);
+  async->stop = SUNTRUE;
+  sunCondSignal(&async->work);
+  sunMutexUnlock(&async->mutex);
+
+  sunThreadJoin(async->thread);
+  sunCondDestroy(&async->done);
+  sunCondDestroy(&async->work);
+  sunMutexDestroy(&async->mutex);
+
+  for (k = 0; k < CKPNT_NBUFFERS; k++) { free(async->wbuf[k]); }
+  free(async->rbuf);
+  free(async);
+
+  IDAADJ_mem->ia_ckasync = NULL;
+}
+
+#endif
+
+/*
+ * =================================================================
+ * CHECK POINT STORAGE
+ * =================================================================
+ */
+
+/* Grows a buffer to at least size bytes */
+static sunbooleantype IDAAckpntGrow(void** buf, size_t* len, size_t size)
+{
+  void* tmp;
+
+  if (size <= *len) { return (SUNTRUE); }
+
+  tmp = realloc(*buf, size);
+  if (tmp == NULL) { return (SUNFALSE); }
+  *buf = tmp;
+  *len = size;
+
+  return (SUNTRUE);
+}
+
+/*
+ * IDAAckpntPack
+ *
+ * Packs (pack = SUNTRUE) the phi* arrays of IDA_mem into buf or unpacks
+ * them from buf, in the order they are held in memory: phi, phiQ, phiS and
+ * phiQS. The packed size is returned in size. If buf is NULL, only the size
+ * is computed.
+ */
+
+static sunbooleantype IDAAckpntPack(IDAMem IDA_mem, IDAckpntMem ck_mem,
+                                    char* buf, sunbooleantype pack,
+                                    size_t* size)
+{
+  N_Vector v;
+  sunindextype vsize;
+  int kind, j, is, nvec;
+
+  *size = 0;
+
+  for (kind = 0; kind < 4; kind++)
+  {
+    if (kind == 1 && !ck_mem->ck_quadr) { continue; }
+    if (kind == 2 && !ck_mem->ck_sensi) { continue; }
+    if (kind == 3 && !ck_mem->ck_quadr_sensi) { continue; }
+
+    nvec = (kind < 2) ? 1 : ck_mem->ck_Ns;
+
+    for (j = 0; j < ck_mem->ck_phi_alloc; j++)
+    {
+      for (is = 0; is < nvec; is++)
+      {
+        if (kind == 0) { v = IDA_mem->ida_phi[j]; }
+        else if (kind == 1) { v = IDA_mem->ida_phiQ[j]; }
+        else if (kind == 2) { v = IDA_mem->ida_phiS[j][is]; }
+        else { v = IDA_mem->ida_phiQS[j][is]; }
+
+        if (N_VBufSize(v, &vsize)) { return (SUNFALSE); }
+
+        if (buf != NULL)
+        {
+          if (pack)
+          {
+            if (N_VBufPack(v, buf + *size)) { return (SUNFALSE); }
+          }
+          else if (N_VBufUnpack(v, buf + *size)) { return (SUNFALSE); }
+        }
+
+        *size += (size_t)vsize;
+      }
+    }
+  }
+
+  return (SUNTRUE);
+}
+
+/*
+ * IDAAckpntStorageSet
+ *
+ * Replaces the check point storage. A NULL store function restores
+ * storage in memory.
+ */
+
+void IDAAckpntStorageSet(IDAMem IDA_mem, void* content,
+                         IDAAdjCheckPointStoreFn store,
+                         IDAAdjCheckPointLoadFn load,
+                         IDAAdjCheckPointFreeFn freefn)
+{
+  IDAadjMem IDAADJ_mem;
+
+  IDAADJ_mem = IDA_mem->ida_adj_mem;
+
+  IDAAckpntStorageFree(IDAADJ_mem);
+
+  if (store == NULL) { return; }
+
+  IDAADJ_mem->ia_ckcontent = content;
+  IDAADJ_mem->ia_ckstore   = store;
+  IDAADJ_mem->ia_ckload    = load;
+  IDAADJ_mem->ia_ckfree    = freefn;
+
+#if defined(SUNDIALS_ENABLE_ASYNC_OUTPUT)
+  IDAAckpntAsyncCreate(IDAADJ_mem);
+#endif
+}
+
+/*
+ * IDAAckpntStorageSetFile
+ *
+ * Creates (or truncates) the check point file fname and makes it the
+ * check point storage. A NULL file name restores storage in memory.
+ */
+
+int IDAAckpntStorageSetFile(IDAMem IDA_mem, const char* fname)
+{
+  IDAckpntFile* file;
+
+  /* Remove the current file first, it may have the same name */
+  IDAAckpntStorageFree(IDA_mem->ida_adj_mem);
+
+  if (fname == NULL) { return (IDA_SUCCESS); }
+
+  file = (IDAckpntFile*)calloc(1, sizeof(IDAckpntFile));
+  if (file != NULL) { file->fname = (char*)malloc(strlen(fname) + 1); }
+  if (file == NULL || file->fname == NULL)
+  {
+    free(file);
+    IDAProcessError(IDA_mem, IDA_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSGAM_MEM_FAIL);
+    return (IDA_MEM_FAIL);
+  }
+  strcpy(file->fname, fname);
+
+  file->fp = fopen(fname, "w+b");
+  if (file->fp == NULL)
+  {
+    free(file->fname);
+    free(file);
+    IDAProcessError(IDA_mem, IDA_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    MSGAM_CKFILE_OPEN, fname);
+    return (IDA_ILL_INPUT);
+  }
+
+  IDAAckpntStorageSet(IDA_mem, file, IDAAckpntFileStore, IDAAckpntFileLoad,
+                      IDAAckpntFileFree);
+
+  return (IDA_SUCCESS);
+}
+
+/*
+ * IDAAckpntStorageStart
+ *
+ * Prepares the check point storage, if any, for a new forward
+ * integration. Returns IDA_ILL_INPUT if the vectors do not support the
+ * buffer operations.
+ */
+
+int IDAAckpntStorageStart(IDAMem IDA_mem)
+{
+  IDAadjMem IDAADJ_mem;
+  N_Vector v[4];
+  int nv, i;
+#if defined(SUNDIALS_ENABLE_ASYNC_OUTPUT)
+  long int rindex;
+#endif
+
+  IDAADJ_mem = IDA_mem->ida_adj_mem;
+
+  if (IDAADJ_mem->ia_ckstore == NULL) { return (IDA_SUCCESS); }
+
+  /* Vectors of each kind that will be stored */
+  nv      = 0;
+  v[nv++] = IDA_mem->ida_phi[0];
+  if (IDA_mem->ida_quadr && IDA_mem->ida_errconQ)
+  {
+    v[nv++] = IDA_mem->ida_phiQ[0];
+  }
+  if (IDA_mem->ida_sensi) { v[nv++] = IDA_mem->ida_phiS[0][0]; }
+  if (IDA_mem->ida_quadr_sensi && IDA_mem->ida_errconQS)
+  {
+    v[nv++] = IDA_mem->ida_phiQS[0][0];
+  }
+
+  for (i = 0; i < nv; i++)
+  {
+    if (v[i]->ops->nvbufsize == NULL || v[i]->ops->nvbufpack == NULL ||
+        v[i]->ops->nvbufunpack == NULL)
+    {
+      IDAProcessError(IDA_mem, IDA_ILL_INPUT, __LINE__, __func__, __FILE__,
+                      MSGAM_CKSTORE_NVEC);
+      return (IDA_ILL_INPUT);
+    }
+  }
+
+#if defined(SUNDIALS_ENABLE_ASYNC_OUTPUT)
+  /* Errors and reads ahead of an earlier integration no longer matter */
+  if (IDAADJ_mem->ia_ckasync != NULL)
+  {
+    (void)IDAAckpntAsyncWait(IDAADJ_mem->ia_ckasync, &rindex);
+  }
+#endif
+
+  IDAADJ_mem->ia_ckindex  = 0;
+  IDAADJ_mem->ia_nckfile  = 0;
+  IDAADJ_mem->ia_ckfwrite = 0;
+  IDAADJ_mem->ia_ckfread  = 0;
+
+  return (IDA_SUCCESS);
+}
+
+/*
+ * IDAAckpntStorageFree
+ *
+ * Stops the storage thread, if any, and frees the check point storage.
+ */
+
+void IDAAckpntStorageFree(IDAadjMem IDAADJ_mem)
+{
+#if defined(SUNDIALS_ENABLE_ASYNC_OUTPUT)
+  if (IDAADJ_mem->ia_ckasync != NULL) { IDAAckpntAsyncFree(IDAADJ_mem); }
+#endif
+
+  if (IDAADJ_mem->ia_ckfree != NULL)
+  {
+    IDAADJ_mem->ia_ckfree(IDAADJ_mem->ia_ckcontent);
+  }
+
+  IDAADJ_mem->ia_ckcontent = NULL;
+  IDAADJ_mem->ia_ckstore   = NULL;
+  IDAADJ_mem->ia_ckload    = NULL;
+  IDAADJ_mem->ia_ckfree    = NULL;
+}
+
+/*
+ * IDAAckpntStore
+ *
+ * Hands the phi* arrays of IDA_mem to the check point storage under the
+ * next index. With a storage thread the call returns once the arrays are
+ * packed, and a failure is reported by the next store or load.
+ */
+
+sunbooleantype IDAAckpntStore(IDAMem IDA_mem, IDAckpntMem ck_mem)
+{
+  IDAadjMem IDAADJ_mem;
+  void** buf;
+  size_t* len;
+  size_t size;
+#if defined(SUNDIALS_ENABLE_ASYNC_OUTPUT)
+  struct IDAckpntAsyncRec* async;
+  int k   = 0;
+  int err = 0;
+#endif
+
+  IDAADJ_mem = IDA_mem->ida_adj_mem;
+  buf        = &IDAADJ_mem->ia_ckbuf;
+  len        = &IDAADJ_mem->ia_ckbuflen;
+
+  if (!IDAAckpntPack(IDA_mem, ck_mem, NULL, SUNTRUE, &size))
+  {
+    return (SUNFALSE);
+  }
+
+#if defined(SUNDIALS_ENABLE_ASYNC_OUTPUT)
+  /* Wait for a write buffer the thread is not storing */
+  async = IDAADJ_mem->ia_ckasync;
+  if (async != NULL)
+  {
+    sunMutexLock(&async->mutex);
+    while (async->nqueued - async->nstored == CKPNT_NBUFFERS)
+    {
+      sunCondWait(&async->done, &async->mutex);
+    }
+    err        = async->err;
+    async->err = 0;
+    sunMutexUnlock(&async->mutex);
+    if (err) { return (SUNFALSE); }
+
+    k   = (int)(async->nqueued % CKPNT_NBUFFERS);
+    buf = &async->wbuf[k];
+    len = &async->wlen[k];
+  }
+#endif
+
+  if (!IDAAckpntGrow(buf, len, size)) { return (SUNFALSE); }
+  if (!IDAAckpntPack(IDA_mem, ck_mem, (char*)*buf, SUNTRUE, &size))
+  {
+    return (SUNFALSE);
+  }
+
+  ck_mem->ck_index = IDAADJ_mem->ia_ckindex;
+  ck_mem->ck_size  = size;
+
+#if defined(SUNDIALS_ENABLE_ASYNC_OUTPUT)
+  if (async != NULL)
+  {
+    async->windex[k] = ck_mem->ck_index;
+    async->wsize[k]  = size;
+
+    sunMutexLock(&async->mutex);
+    async->nqueued++;
+    sunCondSignal(&async->work);
+    sunMutexUnlock(&async->mutex);
+  }
+  else if (IDAADJ_mem->ia_ckstore(ck_mem->ck_index, *buf, size,
+                                  IDAADJ_mem->ia_ckcontent))
+  {
+    return (SUNFALSE);
+  }
+#else
+  if (IDAADJ_mem->ia_ckstore(ck_mem->ck_index, *buf, size,
+                             IDAADJ_mem->ia_ckcontent))
+  {
+    return (SUNFALSE);
+  }
+#endif
+
+  ck_mem->ck_stored = SUNTRUE;
+
+  IDAADJ_mem->ia_ckindex++;
+  IDAADJ_mem->ia_nckfile++;
+  IDAADJ_mem->ia_ckfwrite += (long int)size;
+
+  return (SUNTRUE);
+}
+
+/*
+ * IDAAckpntLoad
+ *
+ * Loads the phi* arrays saved at ck_mem from the check point storage back
+ * into IDA_mem. With a storage thread the check point the next backward
+ * interval starts from is then loaded ahead.
+ */
+
+sunbooleantype IDAAckpntLoad(IDAMem IDA_mem, IDAckpntMem ck_mem)
+{
+  IDAadjMem IDAADJ_mem;
+  void* buf;
+  size_t size;
+  sunbooleantype loaded = SUNFALSE;
+#if defined(SUNDIALS_ENABLE_ASYNC_OUTPUT)
+  struct IDAckpntAsyncRec* async;
+  IDAckpntMem next;
+  long int rindex;
+#endif
+
+  IDAADJ_mem = IDA_mem->ida_adj_mem;
+  buf        = IDAADJ_mem->ia_ckbuf;
+
+#if defined(SUNDIALS_ENABLE_ASYNC_OUTPUT)
+  /* The thread is idle once the queued check points are stored */
+  async = IDAADJ_mem->ia_ckasync;
+  if (async != NULL)
+  {
+    if (IDAAckpntAsyncWait(async, &rindex)) { return (SUNFALSE); }
+    if (rindex == ck_mem->ck_index)
+    {
+      buf    = async->rbuf;
+      loaded = SUNTRUE;
+    }
+  }
+#endif
+
+  if (!loaded)
+  {
+    if (!IDAAckpntGrow(&IDAADJ_mem->ia_ckbuf, &IDAADJ_mem->ia_ckbuflen,
+                       ck_mem->ck_size))
+    {
+      return (SUNFALSE);
+    }
+    buf = IDAADJ_mem->ia_ckbuf;
+
+    if (IDAADJ_mem->ia_ckload(ck_mem->ck_index, buf, ck_mem->ck_size,
+                              IDAADJ_mem->ia_ckcontent))
+    {
+      return (SUNFALSE);
+    }
+  }
+
+  if (!IDAAckpntPack(IDA_mem, ck_mem, (char*)buf, SUNFALSE, &size))
+  {
+    return (SUNFALSE);
+  }
+
+  IDAADJ_mem->ia_ckfread += (long int)size;
+
+#if defined(SUNDIALS_ENABLE_ASYNC_OUTPUT)
+  /* The backward integration continues from the previous check point */
+  next = ck_mem->ck_next;
+  if (async != NULL && next != NULL && next->ck_stored &&
+      IDAAckpntGrow(&async->rbuf, &async->rlen, next->ck_size))
+  {
+    async->rindex = next->ck_index;
+    async->rsize  = next->ck_size;
+
+    sunMutexLock(&async->mutex);
+    async->rstate = CKPNT_READ_QUEUED;
+    sunCondSignal(&async->work);
+    sunMutexUnlock(&async->mutex);
+  }
+#endif
+
+  return (SUNTRUE);
+}
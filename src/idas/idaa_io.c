@@ -82,6 +82,105 @@ int IDAAdjSetNoSensi(void* ida_mem)
   return (IDA_SUCCESS);
 }
 
+/*
+ * -----------------------------------------------------------------
+ * IDAAdjSetCheckPointFile
+ * -----------------------------------------------------------------
+ * Stores the check point vectors in the file fname instead of in
+ * memory. A NULL file name restores the default.
+ * -----------------------------------------------------------------
+ */
+
+int IDAAdjSetCheckPointFile(void* ida_mem, const char* fname)
+{
+  IDAMem IDA_mem;
+  IDAadjMem IDAADJ_mem;
+
+  /* Is ida_mem valid? */
+  if (ida_mem == NULL)
+  {
+    IDAProcessError(NULL, IDA_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSGAM_NULL_IDAMEM);
+    return IDA_MEM_NULL;
+  }
+  IDA_mem = (IDAMem)ida_mem;
+
+  /* Is ASA initialized? */
+  if (IDA_mem->ida_adjMallocDone == SUNFALSE)
+  {
+    IDAProcessError(IDA_mem, IDA_NO_ADJ, __LINE__, __func__, __FILE__,
+                    MSGAM_NO_ADJ);
+    return (IDA_NO_ADJ);
+  }
+  IDAADJ_mem = IDA_mem->ida_adj_mem;
+
+  /* The storage cannot change while it holds check points */
+  if (!IDAADJ_mem->ia_firstIDAFcall)
+  {
+    IDAProcessError(IDA_mem, IDA_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    MSGAM_CKSTORE_SET);
+    return (IDA_ILL_INPUT);
+  }
+
+  return (IDAAckpntStorageSetFile(IDA_mem, fname));
+}
+
+/*
+ * -----------------------------------------------------------------
+ * IDAAdjSetCheckPointStorage
+ * -----------------------------------------------------------------
+ * Stores the check point vectors with the user-supplied store and
+ * load functions instead of in memory. NULL functions restore the
+ * default.
+ * -----------------------------------------------------------------
+ */
+
+int IDAAdjSetCheckPointStorage(void* ida_mem, void* content,
+                               IDAAdjCheckPointStoreFn store,
+                               IDAAdjCheckPointLoadFn load,
+                               IDAAdjCheckPointFreeFn freefn)
+{
+  IDAMem IDA_mem;
+  IDAadjMem IDAADJ_mem;
+
+  /* Is ida_mem valid? */
+  if (ida_mem == NULL)
+  {
+    IDAProcessError(NULL, IDA_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSGAM_NULL_IDAMEM);
+    return IDA_MEM_NULL;
+  }
+  IDA_mem = (IDAMem)ida_mem;
+
+  /* Is ASA initialized? */
+  if (IDA_mem->ida_adjMallocDone == SUNFALSE)
+  {
+    IDAProcessError(IDA_mem, IDA_NO_ADJ, __LINE__, __func__, __FILE__,
+                    MSGAM_NO_ADJ);
+    return (IDA_NO_ADJ);
+  }
+  IDAADJ_mem = IDA_mem->ida_adj_mem;
+
+  /* The storage cannot change while it holds check points */
+  if (!IDAADJ_mem->ia_firstIDAFcall)
+  {
+    IDAProcessError(IDA_mem, IDA_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    MSGAM_CKSTORE_SET);
+    return (IDA_ILL_INPUT);
+  }
+
+  if ((store == NULL) != (load == NULL))
+  {
+    IDAProcessError(IDA_mem, IDA_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    MSGAM_CKSTORE_FN);
+    return (IDA_ILL_INPUT);
+  }
+
+  IDAAckpntStorageSet(IDA_mem, content, store, load, freefn);
+
+  return (IDA_SUCCESS);
+}
+
 /*
  * -----------------------------------------------------------------
  * Optional input functions for backward integration
@@ -667,6 +766,45 @@ int IDAGetAdjCheckPointsInfo(void* ida_mem, IDAadjCheckPointRec* ckpnt)
   return (IDA_SUCCESS);
 }
 
+/*
+ * IDAGetAdjCheckPointFileStats
+ *
+ * Returns the number of check points in the check point storage and the
+ * number of bytes stored and loaded since the start of the last forward
+ * integration.
+ */
+
+int IDAGetAdjCheckPointFileStats(void* ida_mem, long int* nckfile,
+                                 long int* nbyteswrite, long int* nbytesread)
+{
+  IDAMem IDA_mem;
+  IDAadjMem IDAADJ_mem;
+
+  /* Is ida_mem valid? */
+  if (ida_mem == NULL)
+  {
+    IDAProcessError(NULL, IDA_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSGAM_NULL_IDAMEM);
+    return (IDA_MEM_NULL);
+  }
+  IDA_mem = (IDAMem)ida_mem;
+
+  /* Is ASA initialized? */
+  if (IDA_mem->ida_adjMallocDone == SUNFALSE)
+  {
+    IDAProcessError(IDA_mem, IDA_NO_ADJ, __LINE__, __func__, __FILE__,
+                    MSGAM_NO_ADJ);
+    return (IDA_NO_ADJ);
+  }
+  IDAADJ_mem = IDA_mem->ida_adj_mem;
+
+  *nckfile     = IDAADJ_mem->ia_nckfile;
+  *nbyteswrite = IDAADJ_mem->ia_ckfwrite;
+  *nbytesread  = IDAADJ_mem->ia_ckfread;
+
+  return (IDA_SUCCESS);
+}
+
 /* IDAGetConsistentICB
  *
  * Returns the consistent initial conditions computed by IDACalcICB or
@@ -237,6 +237,7 @@
 #define MAXNI    10 /* max. Newton iterations in IC calc. */
 #define EPCON    SUN_RCONST(0.33) /* Newton convergence test constant */
 #define MAXBACKS 100 /* max backtracks per Newton step in IDACalcIC */
+#define DKY_BATCH 32 /* output times per pass over phi in IDAGetDkyBatch */
 
 /*
  * =================================================================
@@ -256,6 +257,8 @@ static void IDAQuadFreeVectors(IDAMem IDA_mem);
 
 static sunbooleantype IDASensAllocVectors(IDAMem IDA_mem, N_Vector tmpl);
 static void IDASensFreeVectors(IDAMem IDA_mem);
+static void IDASensFreeBatchVectors(IDAMem IDA_mem);
+static sunbooleantype IDASensBatchSetup(IDAMem IDA_mem);
 
 static sunbooleantype IDAQuadSensAllocVectors(IDAMem ida_mem, N_Vector tmpl);
 static void IDAQuadSensFreeVectors(IDAMem ida_mem);
@@ -292,6 +295,8 @@ static int IDAStep(IDAMem IDA_mem);
 /* Function called at beginning of step */
 
 static void IDASetCoeffs(IDAMem IDA_mem, sunrealtype* ck);
+static void IDADkyCoeffs(IDAMem IDA_mem, sunrealtype delt, int k,
+                         sunrealtype* cjk);
 
 /* Nonlinear solver functions */
 
@@ -365,7 +370,17 @@ static int IDARootfind(IDAMem IDA_mem);
 static int IDASensRes1DQ(int Ns, sunrealtype t, N_Vector yy, N_Vector yp,
                          N_Vector resval, int iS, N_Vector yyS, N_Vector ypS,
                          N_Vector resvalS, void* user_dataS, N_Vector ytemp,
-                         N_Vector yptemp, N_Vector restemp);
+                         N_Vector yptemp, N_Vector restemp,
+                         sunbooleantype ydone);
+static int IDASensDQMethod(IDAMem IDA_mem, int is, N_Vector yyS,
+                           sunrealtype* Dely, sunrealtype* rDely,
+                           sunrealtype* Delp);
+static int IDASensResBatchDQ(IDAMem IDA_mem, sunrealtype t, N_Vector yy,
+                             N_Vector yp, N_Vector resval, N_Vector* yyS,
+                             N_Vector* ypS, N_Vector* resvalS, N_Vector ytemp,
+                             N_Vector yptemp, N_Vector restemp);
+static int IDASensResBatchEval(IDAMem IDA_mem, sunrealtype t, N_Vector resval,
+                               N_Vector* resvalS, int nbatch);
 
 static int IDAQuadSensRhsInternalDQ(int Ns, sunrealtype t, N_Vector yy,
                                     N_Vector yp, N_Vector* yyS, N_Vector* ypS,
@@ -485,6 +500,14 @@ void* IDACreate(SUNContext sunctx)
   IDA_mem->ida_resSDQ     = SUNTRUE;
   IDA_mem->ida_DQtype     = IDA_CENTERED;
   IDA_mem->ida_DQrhomax   = ZERO;
+  IDA_mem->ida_resbatchS  = NULL;
+  IDA_mem->ida_maxbatchS  = 0;
+  IDA_mem->ida_nbatchS_alloc = 0;
+  IDA_mem->ida_yybatchS   = NULL;
+  IDA_mem->ida_ypbatchS   = NULL;
+  IDA_mem->ida_rrbatchS   = NULL;
+  IDA_mem->ida_isbatchS   = NULL;
+  IDA_mem->ida_cbatchS    = NULL;
   IDA_mem->ida_p          = NULL;
   IDA_mem->ida_pbar       = NULL;
   IDA_mem->ida_plist      = NULL;
@@ -3089,10 +3112,9 @@ int IDASolve(void* ida_mem, sunrealtype tout, sunrealtype* tret, N_Vector yret,
 int IDAGetDky(void* ida_mem, sunrealtype t, int k, N_Vector dky)
 {
   IDAMem IDA_mem;
-  sunrealtype tfuzz, tp, delt, psij_1;
-  int i, j, retval;
+  sunrealtype tfuzz, tp;
+  int retval;
   sunrealtype cjk[MXORDP1];
-  sunrealtype cjk_1[MXORDP1];
 
   /* Check ida_mem */
   if (ida_mem == NULL)
@@ -3133,6 +3155,158 @@ int IDAGetDky(void* ida_mem, sunrealtype t, int k, N_Vector dky)
     return (IDA_BAD_T);
   }
 
+  /* Compute the c_j^(k) */
+  IDADkyCoeffs(IDA_mem, t - IDA_mem->ida_tn, k, cjk);
+
+  /* Compute sum (c_j(t) * phi(t)) */
+
+  /* Sum j=k to j<=IDA_mem->ida_kused */
+  retval = N_VLinearCombination(IDA_mem->ida_kused - k + 1, cjk + k,
+                                IDA_mem->ida_phi + k, dky);
+  if (retval != IDA_SUCCESS)
+  {
+    SUNDIALS_MARK_FUNCTION_END(IDA_PROFILER);
+    return (IDA_VECTOROP_ERR);
+  }
+
+  SUNDIALS_MARK_FUNCTION_END(IDA_PROFILER);
+  return (IDA_SUCCESS);
+}
+
+/*
+ * IDAGetDkyBatch
+ *
+ * This routine evaluates the k-th derivative of the interpolating
+ * polynomial at the nt times t[i] and stores the results in the vectors
+ * dky[i]. All times are checked before any output is computed. The
+ * times are processed in groups of DKY_BATCH and, for each group, every
+ * phi[j] is applied to all outputs of the group with a single call to
+ * N_VScaleAddMulti, instead of one linear combination per time.
+ *
+ * The return values are:
+ *   IDA_SUCCESS       if all t[i] are legal
+ *   IDA_ILL_INPUT     if nt < 1 or t is NULL
+ *   IDA_BAD_T         if a t[i] is not within the interval of the last step
+ *   IDA_BAD_DKY       if dky or one of the dky[i] is NULL
+ *   IDA_BAD_K         if the requested k is not in the range [0,order used]
+ *   IDA_VECTOROP_ERR  if the fused vector operation fails
+ */
+
+int IDAGetDkyBatch(void* ida_mem, int nt, sunrealtype* t, int k, N_Vector* dky)
+{
+  IDAMem IDA_mem;
+  sunrealtype tfuzz, tp;
+  int i, j, i0, nb, retval;
+  sunrealtype cjk[MXORDP1];
+  sunrealtype cvals[MXORDP1 * DKY_BATCH];
+
+  /* Check ida_mem */
+  if (ida_mem == NULL)
+  {
+    IDAProcessError(NULL, IDA_MEM_NULL, __LINE__, __func__, __FILE__, MSG_NO_MEM);
+    return (IDA_MEM_NULL);
+  }
+  IDA_mem = (IDAMem)ida_mem;
+
+  SUNDIALS_MARK_FUNCTION_BEGIN(IDA_PROFILER);
+
+  if ((nt < 1) || (t == NULL))
+  {
+    IDAProcessError(IDA_mem, IDA_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    MSG_BAD_NT);
+    SUNDIALS_MARK_FUNCTION_END(IDA_PROFILER);
+    return (IDA_ILL_INPUT);
+  }
+
+  if (dky == NULL)
+  {
+    IDAProcessError(IDA_mem, IDA_BAD_DKY, __LINE__, __func__, __FILE__,
+                    MSG_NULL_DKY);
+    SUNDIALS_MARK_FUNCTION_END(IDA_PROFILER);
+    return (IDA_BAD_DKY);
+  }
+
+  if ((k < 0) || (k > IDA_mem->ida_kused))
+  {
+    IDAProcessError(IDA_mem, IDA_BAD_K, __LINE__, __func__, __FILE__, MSG_BAD_K);
+    SUNDIALS_MARK_FUNCTION_END(IDA_PROFILER);
+    return (IDA_BAD_K);
+  }
+
+  /* Check the t[i] for legality.  Here tn - hused is t_{n-1}. */
+
+  tfuzz = HUNDRED * IDA_mem->ida_uround *
+          (SUNRabs(IDA_mem->ida_tn) + SUNRabs(IDA_mem->ida_hh));
+  if (IDA_mem->ida_hh < ZERO) { tfuzz = -tfuzz; }
+  tp = IDA_mem->ida_tn - IDA_mem->ida_hused - tfuzz;
+
+  for (i = 0; i < nt; i++)
+  {
+    if (dky[i] == NULL)
+    {
+      IDAProcessError(IDA_mem, IDA_BAD_DKY, __LINE__, __func__, __FILE__,
+                      MSG_NULL_DKY);
+      SUNDIALS_MARK_FUNCTION_END(IDA_PROFILER);
+      return (IDA_BAD_DKY);
+    }
+    if ((t[i] - tp) * IDA_mem->ida_hh < ZERO)
+    {
+      IDAProcessError(IDA_mem, IDA_BAD_T, __LINE__, __func__, __FILE__,
+                      MSG_BAD_T, t[i], IDA_mem->ida_tn - IDA_mem->ida_hused,
+                      IDA_mem->ida_tn);
+      SUNDIALS_MARK_FUNCTION_END(IDA_PROFILER);
+      return (IDA_BAD_T);
+    }
+  }
+
+  for (i0 = 0; i0 < nt; i0 += DKY_BATCH)
+  {
+    nb = SUNMIN(DKY_BATCH, nt - i0);
+
+    /* Coefficients of phi[j] for each time, stored by column j */
+    for (i = 0; i < nb; i++)
+    {
+      IDADkyCoeffs(IDA_mem, t[i0 + i] - IDA_mem->ida_tn, k, cjk);
+      for (j = k; j <= IDA_mem->ida_kused; j++) { cvals[j * nb + i] = cjk[j]; }
+    }
+
+    /* Compute sum (c_j(t) * phi(t)) for all times in the group */
+    for (i = 0; i < nb; i++)
+    {
+      N_VScale(cvals[k * nb + i], IDA_mem->ida_phi[k], dky[i0 + i]);
+    }
+    for (j = k + 1; j <= IDA_mem->ida_kused; j++)
+    {
+      retval = N_VScaleAddMulti(nb, cvals + j * nb, IDA_mem->ida_phi[j],
+                                dky + i0, dky + i0);
+      if (retval != IDA_SUCCESS)
+      {
+        SUNDIALS_MARK_FUNCTION_END(IDA_PROFILER);
+        return (IDA_VECTOROP_ERR);
+      }
+    }
+  }
+
+  SUNDIALS_MARK_FUNCTION_END(IDA_PROFILER);
+  return (IDA_SUCCESS);
+}
+
+/*
+ * IDADkyCoeffs
+ *
+ * This routine computes the coefficients c_j^(k), j = k,...,kused, of
+ * the k-th derivative of the interpolating polynomial at t = tn + delt,
+ *
+ *   dky = SUM c_j^(k) * phi[j] , j = k,...,kused.
+ */
+
+static void IDADkyCoeffs(IDAMem IDA_mem, sunrealtype delt, int k,
+                         sunrealtype* cjk)
+{
+  sunrealtype psij_1;
+  int i, j;
+  sunrealtype cjk_1[MXORDP1];
+
   /* Initialize the c_j^(k) and c_k^(k-1) */
   for (i = 0; i < MXORDP1; i++)
   {
@@ -3140,8 +3314,6 @@ int IDAGetDky(void* ida_mem, sunrealtype t, int k, N_Vector dky)
     cjk_1[i] = 0;
   }
 
-  delt = t - IDA_mem->ida_tn;
-
   for (i = 0; i <= k; i++)
   {
     /* The below reccurence is used to compute the k-th derivative of the solution:
@@ -3186,20 +3358,6 @@ int IDAGetDky(void* ida_mem, sunrealtype t, int k, N_Vector dky)
     /* save existing c_j^(i)'s */
     for (j = i + 1; j <= IDA_mem->ida_kused - k + i; j++) { cjk_1[j] = cjk[j]; }
   }
-
-  /* Compute sum (c_j(t) * phi(t)) */
-
-  /* Sum j=k to j<=IDA_mem->ida_kused */
-  retval = N_VLinearCombination(IDA_mem->ida_kused - k + 1, cjk + k,
-                                IDA_mem->ida_phi + k, dky);
-  if (retval != IDA_SUCCESS)
-  {
-    SUNDIALS_MARK_FUNCTION_END(IDA_PROFILER);
-    return (IDA_VECTOROP_ERR);
-  }
-
-  SUNDIALS_MARK_FUNCTION_END(IDA_PROFILER);
-  return (IDA_SUCCESS);
 }
 
 /*
@@ -4774,6 +4932,94 @@ static void IDASensFreeVectors(IDAMem IDA_mem)
     IDA_mem->ida_lrw -= IDA_mem->ida_Ns;
     IDA_mem->ida_SatolSMallocDone = SUNFALSE;
   }
+
+  IDASensFreeBatchVectors(IDA_mem);
+}
+
+/*
+ * IDASensFreeBatchVectors
+ *
+ * Frees memory allocated by IDASensBatchSetup.
+ */
+
+static void IDASensFreeBatchVectors(IDAMem IDA_mem)
+{
+  int nbatch = IDA_mem->ida_nbatchS_alloc;
+
+  if (nbatch == 0) { return; }
+
+  N_VDestroyVectorArray(IDA_mem->ida_yybatchS, nbatch);
+  N_VDestroyVectorArray(IDA_mem->ida_ypbatchS, nbatch);
+  N_VDestroyVectorArray(IDA_mem->ida_rrbatchS, nbatch);
+  free(IDA_mem->ida_isbatchS);
+  free(IDA_mem->ida_cbatchS);
+  IDA_mem->ida_yybatchS = NULL;
+  IDA_mem->ida_ypbatchS = NULL;
+  IDA_mem->ida_rrbatchS = NULL;
+  IDA_mem->ida_isbatchS = NULL;
+  IDA_mem->ida_cbatchS  = NULL;
+
+  IDA_mem->ida_lrw -= nbatch * (3 * IDA_mem->ida_lrw1 + 1);
+  IDA_mem->ida_liw -= nbatch * (3 * IDA_mem->ida_liw1 + 1);
+  IDA_mem->ida_nbatchS_alloc = 0;
+}
+
+/*
+ * IDASensBatchSetup
+ *
+ * (Re)allocates the perturbed states, their residuals, and the
+ * bookkeeping arrays used when the internal DQ sensitivity residual is
+ * evaluated with a batched residual function. Returns SUNTRUE if a batched
+ * residual function is attached and the workspace matches its batch size,
+ * and SUNFALSE otherwise, in which case the perturbed states are evaluated
+ * one at a time.
+ */
+
+static sunbooleantype IDASensBatchSetup(IDAMem IDA_mem)
+{
+  int nbatch = IDA_mem->ida_maxbatchS;
+
+  if (IDA_mem->ida_resbatchS == NULL) { return (SUNFALSE); }
+  if (IDA_mem->ida_nbatchS_alloc == nbatch) { return (SUNTRUE); }
+
+  IDASensFreeBatchVectors(IDA_mem);
+
+  IDA_mem->ida_yybatchS = N_VCloneVectorArray(nbatch, IDA_mem->ida_tempv1);
+  IDA_mem->ida_ypbatchS = N_VCloneVectorArray(nbatch, IDA_mem->ida_tempv1);
+  IDA_mem->ida_rrbatchS = N_VCloneVectorArray(nbatch, IDA_mem->ida_tempv1);
+  IDA_mem->ida_isbatchS = (int*)malloc(nbatch * sizeof(int));
+  IDA_mem->ida_cbatchS  = (sunrealtype*)malloc(nbatch * sizeof(sunrealtype));
+  if ((IDA_mem->ida_yybatchS == NULL) || (IDA_mem->ida_ypbatchS == NULL) ||
+      (IDA_mem->ida_rrbatchS == NULL) || (IDA_mem->ida_isbatchS == NULL) ||
+      (IDA_mem->ida_cbatchS == NULL))
+  {
+    if (IDA_mem->ida_yybatchS != NULL)
+    {
+      N_VDestroyVectorArray(IDA_mem->ida_yybatchS, nbatch);
+    }
+    if (IDA_mem->ida_ypbatchS != NULL)
+    {
+      N_VDestroyVectorArray(IDA_mem->ida_ypbatchS, nbatch);
+    }
+    if (IDA_mem->ida_rrbatchS != NULL)
+    {
+      N_VDestroyVectorArray(IDA_mem->ida_rrbatchS, nbatch);
+    }
+    free(IDA_mem->ida_isbatchS);
+    free(IDA_mem->ida_cbatchS);
+    IDA_mem->ida_yybatchS = NULL;
+    IDA_mem->ida_ypbatchS = NULL;
+    IDA_mem->ida_rrbatchS = NULL;
+    IDA_mem->ida_isbatchS = NULL;
+    IDA_mem->ida_cbatchS  = NULL;
+    return (SUNFALSE);
+  }
+
+  IDA_mem->ida_nbatchS_alloc = nbatch;
+  IDA_mem->ida_lrw += nbatch * (3 * IDA_mem->ida_lrw1 + 1);
+  IDA_mem->ida_liw += nbatch * (3 * IDA_mem->ida_liw1 + 1);
+
+  return (SUNTRUE);
 }
 
 /*
@@ -8423,10 +8669,18 @@ int IDASensResDQ(int Ns, sunrealtype t, N_Vector yy, N_Vector yp,
 {
   int retval, is;
 
+  /* evaluate the perturbed states in batches (if enabled) */
+  if (IDASensBatchSetup((IDAMem)user_dataS))
+  {
+    return (IDASensResBatchDQ((IDAMem)user_dataS, t, yy, yp, resval, yyS, ypS,
+                              resvalS, ytemp, yptemp, restemp));
+  }
+
   for (is = 0; is < Ns; is++)
   {
     retval = IDASensRes1DQ(Ns, t, yy, yp, resval, is, yyS[is], ypS[is],
-                           resvalS[is], user_dataS, ytemp, yptemp, restemp);
+                           resvalS[is], user_dataS, ytemp, yptemp, restemp,
+                           SUNFALSE);
     if (retval != 0) { return (retval); }
   }
   return (0);
@@ -8436,7 +8690,10 @@ int IDASensResDQ(int Ns, sunrealtype t, N_Vector yy, N_Vector yp,
  * IDASensRes1DQ
  *
  * IDASensRes1DQ computes the residual of the is-th sensitivity
- * equation by finite differences.
+ * equation by finite differences. If ydone is SUNTRUE and the separate DQ
+ * approximation is used, resvalS already holds the difference quotient in
+ * the direction of (yyS, ypS) (see IDASensResBatchDQ) and only the
+ * parameter is perturbed.
  *
  * Returns 0 if successful or the return value of res if res fails
  * (<0 if res fails unrecoverably, >0 if res has a recoverable error).
@@ -8445,56 +8702,27 @@ int IDASensResDQ(int Ns, sunrealtype t, N_Vector yy, N_Vector yp,
 static int IDASensRes1DQ(SUNDIALS_MAYBE_UNUSED int Ns, sunrealtype t, N_Vector yy,
                          N_Vector yp, N_Vector resval, int is, N_Vector yyS,
                          N_Vector ypS, N_Vector resvalS, void* user_dataS,
-                         N_Vector ytemp, N_Vector yptemp, N_Vector restemp)
+                         N_Vector ytemp, N_Vector yptemp, N_Vector restemp,
+                         sunbooleantype ydone)
 {
   IDAMem IDA_mem;
   int method;
   int which;
   int retval;
-  sunrealtype psave, pbari;
-  sunrealtype del, rdel;
+  sunrealtype psave;
   sunrealtype Delp, rDelp, r2Delp;
   sunrealtype Dely, rDely, r2Dely;
   sunrealtype Del, rDel, r2Del;
-  sunrealtype norms, ratio;
 
   /* user_dataS points to IDA_mem */
   IDA_mem = (IDAMem)user_dataS;
 
-  /* Set base perturbation del */
-  del  = SUNRsqrt(SUNMAX(IDA_mem->ida_rtol, IDA_mem->ida_uround));
-  rdel = ONE / del;
-
-  pbari = IDA_mem->ida_pbar[is];
-
   which = IDA_mem->ida_plist[is];
 
   psave = IDA_mem->ida_p[which];
 
-  Delp  = pbari * del;
-  rDelp = ONE / Delp;
-  norms = N_VWrmsNorm(yyS, IDA_mem->ida_ewt) * pbari;
-  rDely = SUNMAX(norms, rdel) / pbari;
-  Dely  = ONE / rDely;
-
-  if (IDA_mem->ida_DQrhomax == ZERO)
-  {
-    /* No switching */
-    method = (IDA_mem->ida_DQtype == IDA_CENTERED) ? CENTERED1 : FORWARD1;
-  }
-  else
-  {
-    /* switch between simultaneous/separate DQ */
-    ratio = Dely * rDelp;
-    if (SUNMAX(ONE / ratio, ratio) <= IDA_mem->ida_DQrhomax)
-    {
-      method = (IDA_mem->ida_DQtype == IDA_CENTERED) ? CENTERED1 : FORWARD1;
-    }
-    else
-    {
-      method = (IDA_mem->ida_DQtype == IDA_CENTERED) ? CENTERED2 : FORWARD2;
-    }
-  }
+  method = IDASensDQMethod(IDA_mem, is, yyS, &Dely, &rDely, &Delp);
+  rDelp  = ONE / Delp;
 
   switch (method)
   {
@@ -8533,26 +8761,31 @@ static int IDASensRes1DQ(SUNDIALS_MAYBE_UNUSED int Ns, sunrealtype t, N_Vector y
     r2Delp = HALF / Delp;
     r2Dely = HALF / Dely;
 
-    /* Forward perturb y and y' */
-    N_VLinearSum(Dely, yyS, ONE, yy, ytemp);
-    N_VLinearSum(Dely, ypS, ONE, yp, yptemp);
+    if (!ydone)
+    {
+      /* Forward perturb y and y' */
+      N_VLinearSum(Dely, yyS, ONE, yy, ytemp);
+      N_VLinearSum(Dely, ypS, ONE, yp, yptemp);
 
-    /* Save residual in resvalS */
-    retval = IDA_mem->ida_res(t, ytemp, yptemp, resvalS, IDA_mem->ida_user_data);
-    IDA_mem->ida_nreS++;
-    if (retval != 0) { return (retval); }
+      /* Save residual in resvalS */
+      retval = IDA_mem->ida_res(t, ytemp, yptemp, resvalS,
+                                IDA_mem->ida_user_data);
+      IDA_mem->ida_nreS++;
+      if (retval != 0) { return (retval); }
 
-    /* Backward perturb y and y' */
-    N_VLinearSum(-Dely, yyS, ONE, yy, ytemp);
-    N_VLinearSum(-Dely, ypS, ONE, yp, yptemp);
+      /* Backward perturb y and y' */
+      N_VLinearSum(-Dely, yyS, ONE, yy, ytemp);
+      N_VLinearSum(-Dely, ypS, ONE, yp, yptemp);
 
-    /* Save residual in restemp */
-    retval = IDA_mem->ida_res(t, ytemp, yptemp, restemp, IDA_mem->ida_user_data);
-    IDA_mem->ida_nreS++;
-    if (retval != 0) { return (retval); }
+      /* Save residual in restemp */
+      retval = IDA_mem->ida_res(t, ytemp, yptemp, restemp,
+                                IDA_mem->ida_user_data);
+      IDA_mem->ida_nreS++;
+      if (retval != 0) { return (retval); }
 
-    /* Save the first difference quotient in resvalS */
-    N_VLinearSum(r2Dely, resvalS, -r2Dely, restemp, resvalS);
+      /* Save the first difference quotient in resvalS */
+      N_VLinearSum(r2Dely, resvalS, -r2Dely, restemp, resvalS);
+    }
 
     /* Forward perturb parameter */
     IDA_mem->ida_p[which] = psave + Delp;
@@ -8600,17 +8833,21 @@ static int IDASensRes1DQ(SUNDIALS_MAYBE_UNUSED int Ns, sunrealtype t, N_Vector y
 
   case FORWARD2:
 
-    /* Forward perturb y and y' */
-    N_VLinearSum(Dely, yyS, ONE, yy, ytemp);
-    N_VLinearSum(Dely, ypS, ONE, yp, yptemp);
+    if (!ydone)
+    {
+      /* Forward perturb y and y' */
+      N_VLinearSum(Dely, yyS, ONE, yy, ytemp);
+      N_VLinearSum(Dely, ypS, ONE, yp, yptemp);
 
-    /* Save residual in resvalS */
-    retval = IDA_mem->ida_res(t, ytemp, yptemp, resvalS, IDA_mem->ida_user_data);
-    IDA_mem->ida_nreS++;
-    if (retval != 0) { return (retval); }
+      /* Save residual in resvalS */
+      retval = IDA_mem->ida_res(t, ytemp, yptemp, resvalS,
+                                IDA_mem->ida_user_data);
+      IDA_mem->ida_nreS++;
+      if (retval != 0) { return (retval); }
 
-    /* Save the first difference quotient in resvalS */
-    N_VLinearSum(rDely, resvalS, -rDely, resval, resvalS);
+      /* Save the first difference quotient in resvalS */
+      N_VLinearSum(rDely, resvalS, -rDely, resval, resvalS);
+    }
 
     /* Forward perturb parameter */
     IDA_mem->ida_p[which] = psave + Delp;
@@ -8635,6 +8872,154 @@ static int IDASensRes1DQ(SUNDIALS_MAYBE_UNUSED int Ns, sunrealtype t, N_Vector y
   return (0);
 }
 
+/*
+ * IDASensDQMethod
+ *
+ * IDASensDQMethod returns the DQ method used for the is-th sensitivity
+ * together with the increments in the directions of yyS and p.
+ */
+
+static int IDASensDQMethod(IDAMem IDA_mem, int is, N_Vector yyS,
+                           sunrealtype* Dely, sunrealtype* rDely,
+                           sunrealtype* Delp)
+{
+  sunrealtype del, rdel, pbari, norms, ratio;
+
+  /* Set base perturbation del */
+  del  = SUNRsqrt(SUNMAX(IDA_mem->ida_rtol, IDA_mem->ida_uround));
+  rdel = ONE / del;
+
+  pbari = IDA_mem->ida_pbar[is];
+
+  *Delp  = pbari * del;
+  norms  = N_VWrmsNorm(yyS, IDA_mem->ida_ewt) * pbari;
+  *rDely = SUNMAX(norms, rdel) / pbari;
+  *Dely  = ONE / *rDely;
+
+  if (IDA_mem->ida_DQrhomax == ZERO)
+  {
+    /* No switching */
+    return ((IDA_mem->ida_DQtype == IDA_CENTERED) ? CENTERED1 : FORWARD1);
+  }
+
+  /* switch between simultaneous/separate DQ */
+  ratio = *Dely * (ONE / *Delp);
+  if (SUNMAX(ONE / ratio, ratio) <= IDA_mem->ida_DQrhomax)
+  {
+    return ((IDA_mem->ida_DQtype == IDA_CENTERED) ? CENTERED1 : FORWARD1);
+  }
+  return ((IDA_mem->ida_DQtype == IDA_CENTERED) ? CENTERED2 : FORWARD2);
+}
+
+/*
+ * IDASensResBatchDQ
+ *
+ * IDASensResBatchDQ computes the residuals of all sensitivity equations
+ * by finite differences, evaluating the states perturbed in the directions
+ * (yyS, ypS) of all sensitivities that use the separate DQ methods
+ * (CENTERED2 and FORWARD2) in batches with the batched residual function.
+ * The parameter perturbations, and the simultaneous methods (the default)
+ * that perturb the states and the parameter together, still call res once
+ * per evaluation since res only sees p through user_data.
+ */
+
+static int IDASensResBatchDQ(IDAMem IDA_mem, sunrealtype t, N_Vector yy,
+                             N_Vector yp, N_Vector resval, N_Vector* yyS,
+                             N_Vector* ypS, N_Vector* resvalS, N_Vector ytemp,
+                             N_Vector yptemp, N_Vector restemp)
+{
+  int is, k, nev, method, nbatch = 0, retval;
+  sunrealtype Dely, rDely, Delp, sign;
+
+  /* Queue the states perturbed in the directions of yyS and ypS */
+  for (is = 0; is < IDA_mem->ida_Ns; is++)
+  {
+    method = IDASensDQMethod(IDA_mem, is, yyS[is], &Dely, &rDely, &Delp);
+    if ((method == CENTERED1) || (method == FORWARD1)) { continue; }
+
+    nev = (method == CENTERED2) ? 2 : 1;
+    for (k = 0; k < nev; k++)
+    {
+      sign = (k == 0) ? ONE : -ONE;
+      N_VLinearSum(sign * Dely, yyS[is], ONE, yy,
+                   IDA_mem->ida_yybatchS[nbatch]);
+      N_VLinearSum(sign * Dely, ypS[is], ONE, yp,
+                   IDA_mem->ida_ypbatchS[nbatch]);
+      IDA_mem->ida_isbatchS[nbatch] = is;
+      IDA_mem->ida_cbatchS[nbatch]  = (nev == 2) ? sign * (HALF / Dely) : rDely;
+      nbatch++;
+
+      if (nbatch == IDA_mem->ida_maxbatchS)
+      {
+        retval = IDASensResBatchEval(IDA_mem, t, resval, resvalS, nbatch);
+        if (retval != 0) { return (retval); }
+        nbatch = 0;
+      }
+    }
+  }
+
+  if (nbatch > 0)
+  {
+    retval = IDASensResBatchEval(IDA_mem, t, resval, resvalS, nbatch);
+    if (retval != 0) { return (retval); }
+  }
+
+  /* Add the parameter perturbations (or do the simultaneous methods) */
+  for (is = 0; is < IDA_mem->ida_Ns; is++)
+  {
+    retval = IDASensRes1DQ(IDA_mem->ida_Ns, t, yy, yp, resval, is, yyS[is],
+                           ypS[is], resvalS[is], IDA_mem, ytemp, yptemp,
+                           restemp, SUNTRUE);
+    if (retval != 0) { return (retval); }
+  }
+
+  return (0);
+}
+
+/*
+ * IDASensResBatchEval
+ *
+ * IDASensResBatchEval evaluates the first nbatch queued states with the
+ * batched residual function and forms the difference quotients in the
+ * directions of (yyS, ypS) in resvalS. A positive coefficient marks the
+ * forward (or only) state of a sensitivity, a negative one the backward
+ * state of a centered difference, whose forward residual is kept in
+ * resvalS until then.
+ */
+
+static int IDASensResBatchEval(IDAMem IDA_mem, sunrealtype t, N_Vector resval,
+                               N_Vector* resvalS, int nbatch)
+{
+  int b, is, retval;
+  sunrealtype c;
+
+  retval = IDA_mem->ida_resbatchS(t, IDA_mem->ida_yybatchS,
+                                  IDA_mem->ida_ypbatchS, IDA_mem->ida_rrbatchS,
+                                  nbatch, IDA_mem->ida_user_data);
+  IDA_mem->ida_nreS += nbatch;
+  if (retval != 0) { return (retval); }
+
+  for (b = 0; b < nbatch; b++)
+  {
+    is = IDA_mem->ida_isbatchS[b];
+    c  = IDA_mem->ida_cbatchS[b];
+    if (c < ZERO)
+    {
+      N_VLinearSum(-c, resvalS[is], c, IDA_mem->ida_rrbatchS[b], resvalS[is]);
+    }
+    else if (IDA_mem->ida_DQtype == IDA_CENTERED)
+    {
+      N_VScale(ONE, IDA_mem->ida_rrbatchS[b], resvalS[is]);
+    }
+    else
+    {
+      N_VLinearSum(c, IDA_mem->ida_rrbatchS[b], -c, resval, resvalS[is]);
+    }
+  }
+
+  return (0);
+}
+
 /* IDAQuadSensRhsInternalDQ   - internal IDAQuadSensRhsFn
  *
  * IDAQuadSensRhsInternalDQ computes right hand side of all quadrature
@@ -19,6 +19,7 @@
 #define _IDAS_IMPL_H
 
 #include <stdarg.h>
+#include <stdint.h>
 
 #include <idas/idas.h>
 #include <sundials/priv/sundials_context_impl.h>
@@ -164,6 +165,15 @@ typedef struct IDAMemRec
   int ida_DQtype;
   sunrealtype ida_DQrhomax;
 
+  IDALsResBatchFn ida_resbatchS; /* batched residual for the internal DQ    */
+  int ida_maxbatchS;             /* max. states per call to resbatchS       */
+  int ida_nbatchS_alloc;         /* batch size the workspace was alloc. for */
+  N_Vector* ida_yybatchS;        /* perturbed states y                      */
+  N_Vector* ida_ypbatchS;        /* perturbed states y'                     */
+  N_Vector* ida_rrbatchS;        /* residuals at the perturbed states       */
+  int* ida_isbatchS;             /* sensitivity of each perturbed state     */
+  sunrealtype* ida_cbatchS;      /* DQ coefficient of each perturbed state  */
+
   sunbooleantype ida_errconS; /* SUNTRUE if sensitivities in err. control  */
 
   int ida_itolS;
@@ -638,6 +648,13 @@ struct IDAckpntMemRec
   /* How many phi, phiS, phiQ and phiQS were allocated? */
   int ck_phi_alloc;
 
+  /* Are the phi* arrays held by the check point storage? If so, the
+     vectors above are not allocated and the arrays were stored under
+     ck_index as ck_size packed bytes */
+  sunbooleantype ck_stored;
+  long int ck_index;
+  size_t ck_size;
+
   /* Pointer to next structure in list */
   struct IDAckpntMemRec* ck_next;
 };
@@ -801,6 +818,20 @@ struct IDAadjMemRec
   /* Number of checkpoints. */
   int ia_nckpnts;
 
+  /* Check point storage (ia_ckstore is NULL if check points are held in
+     memory) */
+  void* ia_ckcontent;                  /* storage content                */
+  IDAAdjCheckPointStoreFn ia_ckstore;  /* stores a packed check point    */
+  IDAAdjCheckPointLoadFn ia_ckload;    /* loads a packed check point     */
+  IDAAdjCheckPointFreeFn ia_ckfree;    /* frees the storage content      */
+  struct IDAckpntAsyncRec* ia_ckasync; /* storage thread, NULL if none   */
+  long int ia_ckindex;                 /* index of the next check point  */
+  void* ia_ckbuf;                      /* buffer for packed check points */
+  size_t ia_ckbuflen;                  /* buffer length in bytes         */
+  long int ia_nckfile;                 /* number of stored check points  */
+  long int ia_ckfwrite;                /* bytes stored                   */
+  long int ia_ckfread;                 /* bytes loaded                   */
+
   /* ------------------
    * Interpolation data
    * ------------------ */
@@ -982,6 +1013,18 @@ int IDASensResDQ(int Ns, sunrealtype t, N_Vector yy, N_Vector yp,
                  N_Vector* resvalS, void* user_dataS, N_Vector ytemp,
                  N_Vector yptemp, N_Vector restemp);
 
+/* Adjoint check point storage */
+
+void IDAAckpntStorageSet(IDAMem IDA_mem, void* content,
+                         IDAAdjCheckPointStoreFn store,
+                         IDAAdjCheckPointLoadFn load,
+                         IDAAdjCheckPointFreeFn freefn);
+int IDAAckpntStorageSetFile(IDAMem IDA_mem, const char* fname);
+int IDAAckpntStorageStart(IDAMem IDA_mem);
+void IDAAckpntStorageFree(IDAadjMem IDAADJ_mem);
+sunbooleantype IDAAckpntStore(IDAMem IDA_mem, IDAckpntMem ck_mem);
+sunbooleantype IDAAckpntLoad(IDAMem IDA_mem, IDAckpntMem ck_mem);
+
 /*
  * =================================================================
  *    E R R O R    M E S S A G E S
@@ -1076,6 +1119,7 @@ int IDASensResDQ(int Ns, sunrealtype t, N_Vector yy, N_Vector yp,
 #define MSG_BAD_DQTYPE \
   "Illegal value for DQtype. Legal values are: IDA_CENTERED and IDA_FORWARD."
 #define MSG_BAD_DQRHO "DQrhomax < 0 illegal."
+#define MSG_BAD_MAXBATCH "maxbatch < 1 illegal."
 
 #define MSG_NULL_ABSTOLQS "abstolQS = NULL illegal parameter."
 #define MSG_BAD_RELTOLQS  "reltolQS < 0 illegal parameter."
@@ -1126,6 +1170,7 @@ int IDASensResDQ(int Ns, sunrealtype t, N_Vector yy, N_Vector yp,
 
 #define MSG_BAD_K     "Illegal value for k."
 #define MSG_NULL_DKY  "dky = NULL illegal."
+#define MSG_BAD_NT    "nt < 1 or t = NULL illegal."
 #define MSG_NULL_DKYP "dkyp = NULL illegal."
 #define MSG_BAD_T     "Illegal value for t." MSG_TIME_INT
 #define MSG_BAD_TOUT                        \
@@ -1250,6 +1295,13 @@ int IDASensResDQ(int Ns, sunrealtype t, N_Vector yy, N_Vector yp,
   "This function cannot be called for the specified interp type."
 #define MSGAM_MEM_FAIL  "A memory request failed."
 #define MSGAM_NO_INITBS "Illegal attempt to call before calling IDAInitBS."
+#define MSGAM_CKSTORE_SET \
+  "The check point storage must be set before the first call to IDASolveF."
+#define MSGAM_CKSTORE_FN \
+  "The check point store and load functions must both be NULL or both be non-NULL."
+#define MSGAM_CKSTORE_NVEC \
+  "The N_Vector buffer operations required for check point storage are not implemented."
+#define MSGAM_CKFILE_OPEN "Unable to open the check point file %s."
 
 #ifdef __cplusplus
 }
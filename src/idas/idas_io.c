@@ -1060,6 +1060,35 @@ int IDASetSensParams(void* ida_mem, sunrealtype* p, sunrealtype* pbar, int* plis
   return (IDA_SUCCESS);
 }
 
+/*-----------------------------------------------------------------*/
+
+int IDASetSensResBatchFn(void* ida_mem, IDALsResBatchFn resbatch, int maxbatch)
+{
+  IDAMem IDA_mem;
+
+  if (ida_mem == NULL)
+  {
+    IDAProcessError(NULL, IDA_MEM_NULL, __LINE__, __func__, __FILE__, MSG_NO_MEM);
+    return (IDA_MEM_NULL);
+  }
+
+  IDA_mem = (IDAMem)ida_mem;
+
+  if ((resbatch != NULL) && (maxbatch < 1))
+  {
+    IDAProcessError(IDA_mem, IDA_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    MSG_BAD_MAXBATCH);
+    return (IDA_ILL_INPUT);
+  }
+
+  /* the workspace is (re)allocated when the sensitivity residual is
+     evaluated */
+  IDA_mem->ida_resbatchS = resbatch;
+  IDA_mem->ida_maxbatchS = (resbatch != NULL) ? maxbatch : 0;
+
+  return (IDA_SUCCESS);
+}
+
 /*
  * -----------------------------------------------------------------
  * Function: IDASetQuadSensErrCon
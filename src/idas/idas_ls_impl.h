@@ -106,6 +106,15 @@ typedef struct IDALsMemRec
   IDAResFn jt_res;
   void* jt_data;
 
+  /* Batched residual function for the DQ Jacobian approximation, with
+     workspace for up to maxbatch perturbed states */
+  IDALsResBatchFn resbatch;
+  int maxbatch;
+  N_Vector* yybatch;
+  N_Vector* ypbatch;
+  N_Vector* rrbatch;
+  sunrealtype* incbatch;
+
 }* IDALsMem;
 
 /*-----------------------------------------------------------------
@@ -131,6 +140,14 @@ int idaLsDenseDQJac(sunrealtype tt, sunrealtype c_j, N_Vector yy, N_Vector yp,
 int idaLsBandDQJac(sunrealtype tt, sunrealtype c_j, N_Vector yy, N_Vector yp,
                    N_Vector rr, SUNMatrix Jac, IDAMem IDA_mem, N_Vector tmp1,
                    N_Vector tmp2, N_Vector tmp3);
+sunrealtype idaLsDQInc(IDAMem IDA_mem, sunrealtype yj, sunrealtype ypj,
+                       sunrealtype ewtj, sunrealtype conj, sunrealtype srur);
+int idaLsDenseDQJacBatch(sunrealtype tt, sunrealtype c_j, N_Vector yy,
+                         N_Vector yp, N_Vector rr, SUNMatrix Jac,
+                         IDAMem IDA_mem);
+int idaLsBandDQJacBatch(sunrealtype tt, sunrealtype c_j, N_Vector yy,
+                        N_Vector yp, N_Vector rr, SUNMatrix Jac,
+                        IDAMem IDA_mem);
 
 /* Generic linit/lsetup/lsolve/lperf/lfree interface routines for IDA to call */
 int idaLsInitialize(IDAMem IDA_mem);
@@ -143,6 +160,7 @@ int idaLsFree(IDAMem IDA_mem);
 
 /* Auxilliary functions */
 int idaLsInitializeCounters(IDALsMem idals_mem);
+void idaLsFreeResBatch(IDALsMem idals_mem);
 int idaLs_AccessLMem(void* ida_mem, const char* fname, IDAMem* IDA_mem,
                      IDALsMem* idals_mem);
 
@@ -173,6 +191,9 @@ int idaLs_AccessLMem(void* ida_mem, const char* fname, IDAMem* IDA_mem,
 #define MSG_LS_NEG_MAXRS    "maxrs < 0 illegal."
 #define MSG_LS_NEG_EPLIFAC  "eplifac < 0.0 illegal."
 #define MSG_LS_NEG_DQINCFAC "dqincfac < 0.0 illegal."
+#define MSG_LS_BATCH_NULL_MAT \
+  "Batched residual function cannot be supplied for NULL SUNMatrix."
+#define MSG_LS_BAD_MAXBATCH "maxbatch < 1 illegal."
 #define MSG_LS_PSET_FAILED \
   "The preconditioner setup routine failed in an unrecoverable manner."
 #define MSG_LS_PSOLVE_FAILED \
@@ -802,6 +802,22 @@ SWIGEXPORT int _wrap_FKINSetJacTimesVecSysFn(void *farg1, KINSysFn farg2) {
 }
 
 
+SWIGEXPORT int _wrap_FKINSetJacSysBatchFn(void *farg1, KINLsSysBatchFn farg2, int const *farg3) {
+  int fresult ;
+  void *arg1 = (void *) 0 ;
+  KINLsSysBatchFn arg2 = (KINLsSysBatchFn) 0 ;
+  int arg3 ;
+  int result;
+  
+  arg1 = (void *)(farg1);
+  arg2 = (KINLsSysBatchFn)(farg2);
+  arg3 = (int)(*farg3);
+  result = (int)KINSetJacSysBatchFn(arg1,arg2,arg3);
+  fresult = (int)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FKINBBDPrecInit(void *farg1, int64_t const *farg2, int64_t const *farg3, int64_t const *farg4, int64_t const *farg5, int64_t const *farg6, double const *farg7, KINBBDLocalFn farg8, KINBBDCommFn farg9) {
   int fresult ;
   void *arg1 = (void *) 0 ;
@@ -101,6 +101,7 @@ module fkinsol_mod
  public :: FKINGetReturnFlagName
  public :: FKINFree
  public :: FKINSetJacTimesVecSysFn
+ public :: FKINSetJacSysBatchFn
  integer(C_INT), parameter, public :: KINBBDPRE_SUCCESS = 0_C_INT
  integer(C_INT), parameter, public :: KINBBDPRE_PDATA_NULL = -11_C_INT
  integer(C_INT), parameter, public :: KINBBDPRE_FUNC_UNRECVR = -12_C_INT
@@ -504,6 +505,16 @@ type(C_FUNPTR), value :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FKINSetJacSysBatchFn(farg1, farg2, farg3) &
+bind(C, name="_wrap_FKINSetJacSysBatchFn") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_FUNPTR), value :: farg2
+integer(C_INT), intent(in) :: farg3
+integer(C_INT) :: fresult
+end function
+
 function swigc_FKINBBDPrecInit(farg1, farg2, farg3, farg4, farg5, farg6, farg7, farg8, farg9) &
 bind(C, name="_wrap_FKINBBDPrecInit") &
 result(fresult)
@@ -1357,6 +1368,25 @@ fresult = swigc_FKINSetJacTimesVecSysFn(farg1, farg2)
 swig_result = fresult
 end function
 
+function FKINSetJacSysBatchFn(kinmem, sysbatch, maxbatch) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: kinmem
+type(C_FUNPTR), intent(in), value :: sysbatch
+integer(C_INT), intent(in) :: maxbatch
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_FUNPTR) :: farg2 
+integer(C_INT) :: farg3 
+
+farg1 = kinmem
+farg2 = sysbatch
+farg3 = maxbatch
+fresult = swigc_FKINSetJacSysBatchFn(farg1, farg2, farg3)
+swig_result = fresult
+end function
+
 function FKINBBDPrecInit(kinmem, nlocal, mudq, mldq, mukeep, mlkeep, dq_rel_uu, gloc, gcomm) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
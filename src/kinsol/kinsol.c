@@ -69,6 +69,7 @@
 #include <sundials/sundials_math.h>
 
 #include "kinsol_impl.h"
+#include "kinsol_ls_impl.h"
 #include "sundials/priv/sundials_errors_impl.h"
 
 /*
@@ -182,6 +183,9 @@ static int KINPicardFcnEval(KINMem kin_mem, N_Vector gval, N_Vector uval,
 static sunrealtype KINScFNorm(KINMem kin_mem, N_Vector v, N_Vector scale);
 static sunrealtype KINScSNorm(KINMem kin_mem, N_Vector v, N_Vector u);
 static int KINStop(KINMem kin_mem, sunbooleantype maxStepTaken, int sflag);
+
+static void KINTelemetryBeginIter(KINMem kin_mem);
+static void KINTelemetryEndIter(KINMem kin_mem);
 static int AndersonAcc(KINMem kin_mem, N_Vector gval, N_Vector fv, N_Vector x,
                        N_Vector x_old, long int iter, sunrealtype* R,
                        sunrealtype* gamma);
@@ -622,6 +626,14 @@ int KINSol(void* kinmem, N_Vector u, int strategy_in, N_Vector u_scale,
 
     kin_mem->kin_nni++;
 
+    if (kin_mem->kin_telemetry) { KINTelemetryBeginIter(kin_mem); }
+
+    /* Iterations after the first are audited for heap allocations */
+    if (kin_mem->kin_nni == 2)
+    {
+      SUNAllocAuditBeginStep(kin_mem->kin_sunctx, SUNTRUE);
+    }
+
     /* calculate the epsilon (stopping criteria for iterative linear solver)
        for this iteration based on eta from the routine KINForcingTerm */
 
@@ -706,6 +718,8 @@ int KINSol(void* kinmem, N_Vector u, int strategy_in, N_Vector u_scale,
 
     kin_mem->kin_f1norm = f1normp;
 
+    if (kin_mem->kin_telemetry) { KINTelemetryEndIter(kin_mem); }
+
     /* print the current nni, fnorm, and nfe values */
 
 #if SUNDIALS_LOGGING_LEVEL >= SUNDIALS_LOGLEVEL_INFO
@@ -717,6 +731,8 @@ int KINSol(void* kinmem, N_Vector u, int strategy_in, N_Vector u_scale,
 
   } /* end of loop; return */
 
+  if (kin_mem->kin_nni >= 2) { SUNAllocAuditEndStep(kin_mem->kin_sunctx); }
+
 #if SUNDIALS_LOGGING_LEVEL >= SUNDIALS_LOGLEVEL_INFO
   KINPrintInfo(kin_mem, PRNT_RETVAL, "KINSOL", "KINSol", INFO_RETVAL, ret);
 #endif
@@ -1656,7 +1672,15 @@ static int KINLinSolDrv(KINMem kin_mem)
 
     if ((kin_mem->kin_sthrsh > ONEPT5) && (kin_mem->kin_lsetup != NULL))
     {
-      retval                   = kin_mem->kin_lsetup(kin_mem);
+      if (kin_mem->kin_telemetry)
+      {
+        kin_mem->kin_tel_step.rec.wall_lsetup -= sunTelemetryWallTime();
+      }
+      retval = kin_mem->kin_lsetup(kin_mem);
+      if (kin_mem->kin_telemetry)
+      {
+        kin_mem->kin_tel_step.rec.wall_lsetup += sunTelemetryWallTime();
+      }
       kin_mem->kin_jacCurrent  = SUNTRUE;
       kin_mem->kin_nnilset     = kin_mem->kin_nni;
       kin_mem->kin_nnilset_sub = kin_mem->kin_nni;
@@ -1674,8 +1698,16 @@ static int KINLinSolDrv(KINMem kin_mem)
 
     /* call the generic 'lsolve' routine to solve the system Jx = b */
 
+    if (kin_mem->kin_telemetry)
+    {
+      kin_mem->kin_tel_step.rec.wall_lsolve -= sunTelemetryWallTime();
+    }
     retval = kin_mem->kin_lsolve(kin_mem, x, b, &(kin_mem->kin_sJpnorm),
                                  &(kin_mem->kin_sFdotJp));
+    if (kin_mem->kin_telemetry)
+    {
+      kin_mem->kin_tel_step.rec.wall_lsolve += sunTelemetryWallTime();
+    }
 
     if (retval == 0) { return (KIN_SUCCESS); }
     else if (retval < 0) { return (KIN_LSOLVE_FAIL); }
@@ -2652,6 +2684,14 @@ static int KINPicardAA(KINMem kin_mem)
     /* update iteration count */
     kin_mem->kin_nni++;
 
+    if (kin_mem->kin_telemetry) { KINTelemetryBeginIter(kin_mem); }
+
+    /* Iterations after the first are audited for heap allocations */
+    if (kin_mem->kin_nni == 2)
+    {
+      SUNAllocAuditBeginStep(kin_mem->kin_sunctx, SUNTRUE);
+    }
+
     /* Update the forcing term for the inexact linear solves */
     if (kin_mem->kin_inexact_ls)
     {
@@ -2735,6 +2775,8 @@ static int KINPicardAA(KINMem kin_mem)
                  kin_mem->kin_nni, kin_mem->kin_nfe, kin_mem->kin_fnorm);
 #endif
 
+    if (kin_mem->kin_telemetry) { KINTelemetryEndIter(kin_mem); }
+
     /* Check if the maximum number of iterations is reached */
     if (kin_mem->kin_nni >= kin_mem->kin_mxiter) { ret = KIN_MAXITER_REACHED; }
     if (kin_mem->kin_fnorm <= kin_mem->kin_fnormtol) { ret = KIN_SUCCESS; }
@@ -2751,6 +2793,8 @@ static int KINPicardAA(KINMem kin_mem)
     }
 
   } /* end of loop; return */
+
+  if (kin_mem->kin_nni >= 2) { SUNAllocAuditEndStep(kin_mem->kin_sunctx); }
 #if SUNDIALS_LOGGING_LEVEL >= SUNDIALS_LOGLEVEL_INFO
   KINPrintInfo(kin_mem, PRNT_RETVAL, "KINSOL", "KINPicardAA", INFO_RETVAL, ret);
 #endif
@@ -2789,7 +2833,15 @@ static int KINPicardFcnEval(KINMem kin_mem, N_Vector gval, N_Vector uval,
 
     if ((kin_mem->kin_sthrsh > ONEPT5) && (kin_mem->kin_lsetup != NULL))
     {
-      retval                   = kin_mem->kin_lsetup(kin_mem);
+      if (kin_mem->kin_telemetry)
+      {
+        kin_mem->kin_tel_step.rec.wall_lsetup -= sunTelemetryWallTime();
+      }
+      retval = kin_mem->kin_lsetup(kin_mem);
+      if (kin_mem->kin_telemetry)
+      {
+        kin_mem->kin_tel_step.rec.wall_lsetup += sunTelemetryWallTime();
+      }
       kin_mem->kin_jacCurrent  = SUNTRUE;
       kin_mem->kin_nnilset     = kin_mem->kin_nni;
       kin_mem->kin_nnilset_sub = kin_mem->kin_nni;
@@ -2799,8 +2851,16 @@ static int KINPicardFcnEval(KINMem kin_mem, N_Vector gval, N_Vector uval,
     /* call the generic 'lsolve' routine to solve the system Lx = -fval
        Note that we are using gval to hold x. */
     N_VScale(-ONE, fval1, fval1);
+    if (kin_mem->kin_telemetry)
+    {
+      kin_mem->kin_tel_step.rec.wall_lsolve -= sunTelemetryWallTime();
+    }
     retval = kin_mem->kin_lsolve(kin_mem, gval, fval1, &(kin_mem->kin_sJpnorm),
                                  &(kin_mem->kin_sFdotJp));
+    if (kin_mem->kin_telemetry)
+    {
+      kin_mem->kin_tel_step.rec.wall_lsolve += sunTelemetryWallTime();
+    }
 
     if (retval == 0)
     {
@@ -2854,6 +2914,14 @@ static int KINFP(KINMem kin_mem)
     /* update iteration count */
     kin_mem->kin_nni++;
 
+    if (kin_mem->kin_telemetry) { KINTelemetryBeginIter(kin_mem); }
+
+    /* Iterations after the first are audited for heap allocations */
+    if (kin_mem->kin_nni == 2)
+    {
+      SUNAllocAuditBeginStep(kin_mem->kin_sunctx, SUNTRUE);
+    }
+
     /* evaluate func(uu) and return if failed */
     retval = kin_mem->kin_func(kin_mem->kin_uu, kin_mem->kin_fval,
                                kin_mem->kin_user_data);
@@ -2939,6 +3007,8 @@ static int KINFP(KINMem kin_mem)
                  kin_mem->kin_nni, kin_mem->kin_nfe, kin_mem->kin_fnorm);
 #endif
 
+    if (kin_mem->kin_telemetry) { KINTelemetryEndIter(kin_mem); }
+
     /* Check if the maximum number of iterations is reached */
     if (kin_mem->kin_nni >= kin_mem->kin_mxiter) { ret = KIN_MAXITER_REACHED; }
     if (kin_mem->kin_fnorm <= (tolfac * kin_mem->kin_fnormtol))
@@ -2956,6 +3026,8 @@ static int KINFP(KINMem kin_mem)
 
   } /* end of loop; return */
 
+  if (kin_mem->kin_nni >= 2) { SUNAllocAuditEndStep(kin_mem->kin_sunctx); }
+
 #if SUNDIALS_LOGGING_LEVEL >= SUNDIALS_LOGLEVEL_INFO
   KINPrintInfo(kin_mem, PRNT_RETVAL, "KINSOL", "KINFP", INFO_RETVAL, ret);
 #endif
@@ -2963,6 +3035,77 @@ static int KINFP(KINMem kin_mem)
   return (ret);
 }
 
+/*
+ * ========================================================================
+ * Telemetry
+ * ========================================================================
+ */
+
+/*
+ * KINTelemetryNumLinIters
+ *
+ * Returns the number of linear iterations if the KINLS interface is
+ * attached and zero otherwise.
+ */
+
+static long int KINTelemetryNumLinIters(KINMem kin_mem)
+{
+  if (kin_mem->kin_lmem == NULL || kin_mem->kin_linit != kinLsInitialize)
+  {
+    return 0;
+  }
+  return ((KINLsMem)kin_mem->kin_lmem)->nli;
+}
+
+/*
+ * KINTelemetryBeginIter
+ *
+ * This routine saves the solver counters and the wall clock time at
+ * the start of a nonlinear iteration.
+ */
+
+static void KINTelemetryBeginIter(KINMem kin_mem)
+{
+  sunTelemetryStep* ts = &kin_mem->kin_tel_step;
+
+  memset(&ts->rec, 0, sizeof(ts->rec));
+  ts->nli  = KINTelemetryNumLinIters(kin_mem);
+  ts->netf = kin_mem->kin_nbktrk;
+  ts->ncfn = kin_mem->kin_nbcf;
+  ts->tic  = sunTelemetryWallTime();
+}
+
+/*
+ * KINTelemetryEndIter
+ *
+ * This routine completes the telemetry record of a nonlinear
+ * iteration and stores it. The line search backtracks and beta
+ * condition failures are stored as the error test and convergence
+ * failures and the whole iteration is in the nonlinear solver.
+ */
+
+static void KINTelemetryEndIter(KINMem kin_mem)
+{
+  sunTelemetryStep* ts    = &kin_mem->kin_tel_step;
+  SUNTelemetryRecord* rec = &ts->rec;
+
+  rec->wall_step  = sunTelemetryWallTime() - ts->tic;
+  rec->wall_nls   = rec->wall_step;
+  rec->h          = (double)kin_mem->kin_stepl;
+  rec->error_norm = (double)kin_mem->kin_fnorm;
+  rec->step       = kin_mem->kin_nni;
+  rec->nni        = 1;
+  rec->nli        = (int32_t)(KINTelemetryNumLinIters(kin_mem) - ts->nli);
+  rec->netf       = (int32_t)(kin_mem->kin_nbktrk - ts->netf);
+  rec->ncfn       = (int32_t)(kin_mem->kin_nbcf - ts->ncfn);
+  if (kin_mem->kin_nnilset == kin_mem->kin_nni)
+  {
+    rec->flags |= SUN_TELEMETRY_LSETUP;
+  }
+
+  (void)SUNTelemetry_Record(kin_mem->kin_telemetry, rec);
+}
+
 /*
  * ========================================================================
  * Anderson Acceleration
@@ -24,6 +24,7 @@
 
 #include <kinsol/kinsol.h>
 #include <sundials/priv/sundials_context_impl.h>
+#include <sundials/priv/sundials_telemetry_impl.h>
 
 #include "sundials_iterative_impl.h"
 #include "sundials_logger_impl.h"
@@ -233,6 +234,9 @@ typedef struct KINMemRec
 
   void* kin_lmem; /* pointer to linear solver memory block             */
 
+  SUNTelemetry kin_telemetry;    /* telemetry records (NULL if not collected) */
+  sunTelemetryStep kin_tel_step; /* telemetry state of the current iteration  */
+
   sunrealtype kin_fnorm; /* value of L2-norm of fscale*fval                   */
   sunrealtype kin_f1norm; /* f1norm = 0.5*(fnorm)^2                            */
   sunrealtype kin_sFdotJp; /* value of scaled F(u) vector (fscale*fval)
@@ -885,6 +885,29 @@ int KINSetSysFunc(void* kinmem, KINSysFn func)
   return (KIN_SUCCESS);
 }
 
+/*
+ * -----------------------------------------------------------------
+ * Function : KINSetTelemetry
+ * -----------------------------------------------------------------
+ */
+
+int KINSetTelemetry(void* kinmem, SUNTelemetry tel)
+{
+  KINMem kin_mem;
+
+  if (kinmem == NULL)
+  {
+    KINProcessError(NULL, KIN_MEM_NULL, __LINE__, __func__, __FILE__, MSG_NO_MEM);
+    return (KIN_MEM_NULL);
+  }
+
+  kin_mem = (KINMem)kinmem;
+
+  kin_mem->kin_telemetry = tel;
+
+  return (KIN_SUCCESS);
+}
+
 /*
  * =================================================================
  * KINSOL optional output functions
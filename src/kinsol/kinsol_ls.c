@@ -171,6 +171,14 @@ int KINSetLinearSolver(void* kinmem, SUNLinearSolver LS, SUNMatrix A)
   kinls_mem->jt_func  = kin_mem->kin_func;
   kinls_mem->jt_data  = kin_mem;
 
+  kinls_mem->capture = NULL;
+
+  kinls_mem->sysbatch = NULL;
+  kinls_mem->maxbatch = 0;
+  kinls_mem->ubatch   = NULL;
+  kinls_mem->fbatch   = NULL;
+  kinls_mem->incbatch = NULL;
+
   /* Set defaults for preconditioner-related fields */
   kinls_mem->pset   = NULL;
   kinls_mem->psolve = NULL;
@@ -377,6 +385,86 @@ int KINSetJacTimesVecSysFn(void* kinmem, KINSysFn jtimesSysFn)
   return (KINLS_SUCCESS);
 }
 
+/*------------------------------------------------------------------
+  KINSetJacSysBatchFn specifies a batched system function for use in
+  the internal difference quotient Jacobian approximation
+  ------------------------------------------------------------------*/
+int KINSetJacSysBatchFn(void* kinmem, KINLsSysBatchFn sysbatch, int maxbatch)
+{
+  int retval;
+  KINMem kin_mem     = NULL;
+  KINLsMem kinls_mem = NULL;
+
+  /* access KINLsMem structure */
+  retval = kinLs_AccessLMem(kinmem, __func__, &kin_mem, &kinls_mem);
+  if (retval != KIN_SUCCESS) { return (retval); }
+
+  /* the DQ Jacobian approximation requires a matrix */
+  if ((sysbatch != NULL) && (kinls_mem->J == NULL))
+  {
+    KINProcessError(kin_mem, KINLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    MSG_LS_BATCH_NULL_MAT);
+    return (KINLS_ILL_INPUT);
+  }
+
+  if ((sysbatch != NULL) && (maxbatch < 1))
+  {
+    KINProcessError(kin_mem, KINLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    MSG_LS_BAD_MAXBATCH);
+    return (KINLS_ILL_INPUT);
+  }
+
+  /* free any existing batch workspace */
+  kinLsFreeSysBatch(kinls_mem);
+  if (sysbatch == NULL) { return (KINLS_SUCCESS); }
+
+  /* allocate the perturbed iterates, their function values, and increments */
+  kinls_mem->ubatch   = N_VCloneVectorArray(maxbatch, kin_mem->kin_vtemp1);
+  kinls_mem->fbatch   = N_VCloneVectorArray(maxbatch, kin_mem->kin_vtemp1);
+  kinls_mem->incbatch = (sunrealtype*)malloc(maxbatch * sizeof(sunrealtype));
+  kinls_mem->maxbatch = maxbatch;
+  if ((kinls_mem->ubatch == NULL) || (kinls_mem->fbatch == NULL) ||
+      (kinls_mem->incbatch == NULL))
+  {
+    kinLsFreeSysBatch(kinls_mem);
+    KINProcessError(kin_mem, KINLS_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_LS_MEM_FAIL);
+    return (KINLS_MEM_FAIL);
+  }
+
+  kinls_mem->sysbatch = sysbatch;
+
+  return (KINLS_SUCCESS);
+}
+
+/*------------------------------------------------------------------
+  KINSetLinSysCapture specifies an archive to which selected
+  Jacobians and right-hand sides are written
+  ------------------------------------------------------------------*/
+
+int KINSetLinSysCapture(void* kinmem, SUNLinSysCapture capture)
+{
+  int retval;
+  KINMem kin_mem     = NULL;
+  KINLsMem kinls_mem = NULL;
+
+  /* access KINLsMem structure */
+  retval = kinLs_AccessLMem(kinmem, __func__, &kin_mem, &kinls_mem);
+  if (retval != KIN_SUCCESS) { return (retval); }
+
+  /* only matrix-based linear systems can be captured */
+  if ((capture != NULL) && (kinls_mem->J == NULL))
+  {
+    KINProcessError(kin_mem, KINLS_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    MSG_LS_CAPTURE_NO_MATRIX);
+    return (KINLS_ILL_INPUT);
+  }
+
+  kinls_mem->capture = capture;
+
+  return (KINLS_SUCCESS);
+}
+
 /*==================================================================
   Optional Get routines
   ==================================================================*/
@@ -434,6 +522,13 @@ int KINGetLinWorkSpace(void* kinmem, long int* lenrwLS, long int* leniwLS)
     *leniwLS += liw1;
   }
 
+  /* add batched DQ Jacobian workspace (if applicable) */
+  if (kinls_mem->sysbatch && kin_mem->kin_vtemp1->ops->nvspace)
+  {
+    *lenrwLS += kinls_mem->maxbatch * (2 * lrw1 + 1);
+    *leniwLS += 2 * kinls_mem->maxbatch * liw1;
+  }
+
   /* add LS sizes */
   if (kinls_mem->LS->ops->space)
   {
@@ -786,6 +881,12 @@ int kinLsDenseDQJac(N_Vector u, N_Vector fu, SUNMatrix Jac, KINMem kin_mem,
   /* access LsMem interface structure */
   kinls_mem = (KINLsMem)kin_mem->kin_lmem;
 
+  /* evaluate the perturbed system function in batches (if enabled) */
+  if (kinls_mem->sysbatch)
+  {
+    return (kinLsDenseDQJacBatch(u, fu, Jac, kin_mem, tmp2));
+  }
+
   /* access matrix dimension */
   N = SUNDenseMatrix_Columns(Jac);
 
@@ -864,6 +965,12 @@ int kinLsBandDQJac(N_Vector u, N_Vector fu, SUNMatrix Jac, KINMem kin_mem,
   /* access LsMem interface structure */
   kinls_mem = (KINLsMem)kin_mem->kin_lmem;
 
+  /* evaluate the perturbed system function in batches (if enabled) */
+  if (kinls_mem->sysbatch)
+  {
+    return (kinLsBandDQJacBatch(u, fu, Jac, kin_mem));
+  }
+
   /* access matrix dimensions */
   N      = SUNBandMatrix_Columns(Jac);
   mupper = SUNBandMatrix_UpperBandwidth(Jac);
@@ -925,6 +1032,184 @@ int kinLsBandDQJac(N_Vector u, N_Vector fu, SUNMatrix Jac, KINMem kin_mem,
   return (0);
 }
 
+/*------------------------------------------------------------------
+  kinLsDenseDQJacBatch
+
+  This routine computes the same dense difference quotient
+  approximation as kinLsDenseDQJac, but perturbs up to maxbatch
+  columns at a time and evaluates the perturbed iterates with a
+  single call to the user-supplied batched system function.
+  ------------------------------------------------------------------*/
+int kinLsDenseDQJacBatch(N_Vector u, N_Vector fu, SUNMatrix Jac,
+                         KINMem kin_mem, N_Vector tmp2)
+{
+  sunrealtype inc_inv, sign;
+  sunrealtype *tmp2_data, *u_data, *uscale_data;
+  N_Vector jthCol;
+  sunindextype j, N;
+  KINLsMem kinls_mem;
+  int b, nbatch, retval = 0;
+
+  /* access LsMem interface structure */
+  kinls_mem = (KINLsMem)kin_mem->kin_lmem;
+
+  /* access matrix dimension */
+  N = SUNDenseMatrix_Columns(Jac);
+
+  /* Save pointer to the array in tmp2 */
+  tmp2_data = N_VGetArrayPointer(tmp2);
+
+  /* Rename work vector for readibility */
+  jthCol = tmp2;
+
+  /* Obtain pointers to the data for u and uscale */
+  u_data      = N_VGetArrayPointer(u);
+  uscale_data = N_VGetArrayPointer(kin_mem->kin_uscale);
+
+  for (j = 0; j < N; j += nbatch)
+  {
+    nbatch = (int)SUNMIN(kinls_mem->maxbatch, N - j);
+
+    /* Perturb u_{j+b} in the b-th batch vector */
+    for (b = 0; b < nbatch; b++)
+    {
+      sign = (u_data[j + b] >= ZERO) ? ONE : -ONE;
+      kinls_mem->incbatch[b] = kin_mem->kin_sqrt_relfunc *
+                               SUNMAX(SUNRabs(u_data[j + b]),
+                                      ONE / uscale_data[j + b]) *
+                               sign;
+
+      N_VScale(ONE, u, kinls_mem->ubatch[b]);
+      N_VGetArrayPointer(kinls_mem->ubatch[b])[j + b] += kinls_mem->incbatch[b];
+    }
+
+    retval = kinls_mem->sysbatch(kinls_mem->ubatch, kinls_mem->fbatch, nbatch,
+                                 kin_mem->kin_user_data);
+    kinls_mem->nfeDQ += nbatch;
+    if (retval != 0) { break; }
+
+    /* Construct the difference quotients */
+    for (b = 0; b < nbatch; b++)
+    {
+      N_VSetArrayPointer(SUNDenseMatrix_Column(Jac, j + b), jthCol);
+      inc_inv = ONE / kinls_mem->incbatch[b];
+      N_VLinearSum(inc_inv, kinls_mem->fbatch[b], -inc_inv, fu, jthCol);
+    }
+  }
+
+  /* Restore original array pointer in tmp2 */
+  N_VSetArrayPointer(tmp2_data, tmp2);
+
+  return (retval);
+}
+
+/*------------------------------------------------------------------
+  kinLsBandDQJacBatch
+
+  This routine computes the same banded difference quotient
+  approximation as kinLsBandDQJac, but perturbs up to maxbatch
+  column groups at a time and evaluates the perturbed iterates with
+  a single call to the user-supplied batched system function.
+  ------------------------------------------------------------------*/
+int kinLsBandDQJacBatch(N_Vector u, N_Vector fu, SUNMatrix Jac, KINMem kin_mem)
+{
+  sunrealtype inc, inc_inv;
+  sunindextype group, i, j, width, ngroups, i1, i2;
+  sunindextype N, mupper, mlower;
+  sunrealtype *col_j, *fu_data, *fb_data, *u_data, *ub_data, *uscale_data;
+  KINLsMem kinls_mem;
+  int b, nbatch, retval = 0;
+
+  /* access LsMem interface structure */
+  kinls_mem = (KINLsMem)kin_mem->kin_lmem;
+
+  /* access matrix dimensions */
+  N      = SUNBandMatrix_Columns(Jac);
+  mupper = SUNBandMatrix_UpperBandwidth(Jac);
+  mlower = SUNBandMatrix_LowerBandwidth(Jac);
+
+  /* Obtain pointers to the data for fu, u, uscale */
+  fu_data     = N_VGetArrayPointer(fu);
+  u_data      = N_VGetArrayPointer(u);
+  uscale_data = N_VGetArrayPointer(kin_mem->kin_uscale);
+
+  /* Set bandwidth and number of column groups for band differencing */
+  width   = mlower + mupper + 1;
+  ngroups = SUNMIN(width, N);
+
+  for (group = 1; group <= ngroups; group += nbatch)
+  {
+    nbatch = (int)SUNMIN(kinls_mem->maxbatch, ngroups - group + 1);
+
+    /* Increment all u components of group + b in the b-th batch vector */
+    for (b = 0; b < nbatch; b++)
+    {
+      N_VScale(ONE, u, kinls_mem->ubatch[b]);
+      ub_data = N_VGetArrayPointer(kinls_mem->ubatch[b]);
+      for (j = group + b - 1; j < N; j += width)
+      {
+        inc = kin_mem->kin_sqrt_relfunc *
+              SUNMAX(SUNRabs(u_data[j]), ONE / SUNRabs(uscale_data[j]));
+        ub_data[j] += inc;
+      }
+    }
+
+    /* Evaluate f with the incremented batch of u */
+    retval = kinls_mem->sysbatch(kinls_mem->ubatch, kinls_mem->fbatch, nbatch,
+                                 kin_mem->kin_user_data);
+    if (retval != 0) { return (retval); }
+    kinls_mem->nfeDQ += nbatch;
+
+    /* Form and load difference quotients */
+    for (b = 0; b < nbatch; b++)
+    {
+      fb_data = N_VGetArrayPointer(kinls_mem->fbatch[b]);
+      for (j = group + b - 1; j < N; j += width)
+      {
+        col_j = SUNBandMatrix_Column(Jac, j);
+        inc   = kin_mem->kin_sqrt_relfunc *
+              SUNMAX(SUNRabs(u_data[j]), ONE / SUNRabs(uscale_data[j]));
+        inc_inv = ONE / inc;
+        i1      = SUNMAX(0, j - mupper);
+        i2      = SUNMIN(j + mlower, N - 1);
+        for (i = i1; i <= i2; i++)
+        {
+          SM_COLUMN_ELEMENT_B(col_j, i, j) = inc_inv *
+                                             (fb_data[i] - fu_data[i]);
+        }
+      }
+    }
+  }
+
+  return (0);
+}
+
+/*------------------------------------------------------------------
+  kinLsFreeSysBatch
+
+  This routine frees the batched DQ Jacobian workspace.
+  ------------------------------------------------------------------*/
+void kinLsFreeSysBatch(KINLsMem kinls_mem)
+{
+  if (kinls_mem->ubatch)
+  {
+    N_VDestroyVectorArray(kinls_mem->ubatch, kinls_mem->maxbatch);
+    kinls_mem->ubatch = NULL;
+  }
+  if (kinls_mem->fbatch)
+  {
+    N_VDestroyVectorArray(kinls_mem->fbatch, kinls_mem->maxbatch);
+    kinls_mem->fbatch = NULL;
+  }
+  if (kinls_mem->incbatch)
+  {
+    free(kinls_mem->incbatch);
+    kinls_mem->incbatch = NULL;
+  }
+  kinls_mem->sysbatch = NULL;
+  kinls_mem->maxbatch = 0;
+}
+
 /*------------------------------------------------------------------
   kinLsDQJtimes
 
@@ -1188,6 +1473,14 @@ int kinLsSetup(KINMem kin_mem)
       kinls_mem->last_flag = KINLS_JACFUNC_ERR;
       return (kinls_mem->last_flag);
     }
+
+    /* Write J to the capture archive (if selected) */
+    if (kinls_mem->capture)
+    {
+      (void)SUNLinSysCapture_Matrix(kinls_mem->capture,
+                                    (sunrealtype)kin_mem->kin_nni, ZERO,
+                                    kinls_mem->J);
+    }
   }
 
   /* Call LS setup routine -- the LS will call kinLsPSetup (if applicable) */
@@ -1234,6 +1527,13 @@ int kinLsSolve(KINMem kin_mem, N_Vector xx, N_Vector bb, sunrealtype* sJpnorm,
   /* set flag required for user-supplied J*v routine */
   kinls_mem->new_uu = SUNTRUE;
 
+  /* Write bb to the capture archive (if J was captured) */
+  if (kinls_mem->capture)
+  {
+    (void)SUNLinSysCapture_Rhs(kinls_mem->capture,
+                               (sunrealtype)kin_mem->kin_nni, tol, bb);
+  }
+
   /* Call solver */
   retval = SUNLinSolSolve(kinls_mem->LS, kinls_mem->J, xx, bb, tol);
 
@@ -1360,6 +1660,9 @@ int kinLsFree(KINMem kin_mem)
   /* Nullify SUNMatrix pointer */
   kinls_mem->J = NULL;
 
+  /* Free batched DQ Jacobian workspace */
+  kinLsFreeSysBatch(kinls_mem);
+
   /* Free preconditioner memory (if applicable) */
   if (kinls_mem->pfree) { kinls_mem->pfree(kin_mem); }
 
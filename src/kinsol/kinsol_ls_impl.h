@@ -98,6 +98,17 @@ typedef struct KINLsMemRec
   KINSysFn jt_func;
   void* jt_data;
 
+  /* Archive for selected linear systems and right-hand sides */
+  SUNLinSysCapture capture;
+
+  /* Batched system function for the DQ Jacobian approximation, with
+     workspace for up to maxbatch perturbed iterates */
+  KINLsSysBatchFn sysbatch;
+  int maxbatch;
+  N_Vector* ubatch;
+  N_Vector* fbatch;
+  sunrealtype* incbatch;
+
 }* KINLsMem;
 
 /*------------------------------------------------------------------
@@ -123,6 +134,11 @@ int kinLsDenseDQJac(N_Vector u, N_Vector fu, SUNMatrix Jac, KINMem kin_mem,
 int kinLsBandDQJac(N_Vector u, N_Vector fu, SUNMatrix Jac, KINMem kin_mem,
                    N_Vector tmp1, N_Vector tmp2);
 
+int kinLsDenseDQJacBatch(N_Vector u, N_Vector fu, SUNMatrix Jac,
+                         KINMem kin_mem, N_Vector tmp2);
+
+int kinLsBandDQJacBatch(N_Vector u, N_Vector fu, SUNMatrix Jac, KINMem kin_mem);
+
 /* Generic linit/lsetup/lsolve/lfree interface routines for KINSOL to call */
 int kinLsInitialize(KINMem kin_mem);
 int kinLsSetup(KINMem kin_mem);
@@ -132,6 +148,7 @@ int kinLsFree(KINMem kin_mem);
 
 /* Auxilliary functions */
 int kinLsInitializeCounters(KINLsMem kinls_mem);
+void kinLsFreeSysBatch(KINLsMem kinls_mem);
 int kinLs_AccessLMem(void* kinmem, const char* fname, KINMem* kin_mem,
                      KINLsMem* kinls_mem);
 
@@ -146,6 +163,11 @@ int kinLs_AccessLMem(void* kinmem, const char* fname, KINMem* kin_mem,
 #define MSG_LS_NEG_MAXRS   "maxrs < 0 illegal."
 #define MSG_LS_BAD_SIZES \
   "Illegal bandwidth parameter(s). Must have 0 <=  ml, mu <= N-1."
+#define MSG_LS_CAPTURE_NO_MATRIX \
+  "Linear systems cannot be captured for NULL SUNMatrix."
+#define MSG_LS_BATCH_NULL_MAT \
+  "Batched system function cannot be supplied for NULL SUNMatrix."
+#define MSG_LS_BAD_MAXBATCH "maxbatch < 1 illegal."
 
 #define MSG_LS_JACFUNC_FAILED \
   "The Jacobian routine failed in an unrecoverable manner."
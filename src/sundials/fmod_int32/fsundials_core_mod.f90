@@ -111,13 +111,22 @@ module fsundials_core_mod
  public :: FSUNContext_SetLogger
  public :: FSUNContext_Free
  public :: FSUNProfiler_Create
+ public :: FSUNProfiler_CreateFromEnv
  public :: FSUNProfiler_Free
  public :: FSUNProfiler_Begin
  public :: FSUNProfiler_End
+ public :: FSUNProfiler_RegisterTimer
+ public :: FSUNProfiler_BeginTimer
+ public :: FSUNProfiler_EndTimer
  public :: FSUNProfiler_GetTimerResolution
  public :: FSUNProfiler_GetElapsedTime
  public :: FSUNProfiler_Print
  public :: FSUNProfiler_Reset
+ public :: FSUNProfiler_EnableTrace
+ public :: FSUNProfiler_SetTraceFilename
+ public :: FSUNProfiler_WriteTrace
+ public :: FSUNProfiler_EnableCounters
+ public :: FSUNProfiler_GetCounters
  ! typedef enum SUNLogLevel
  enum, bind(c)
   enumerator :: SUN_LOGLEVEL_ALL = -1
@@ -136,6 +145,8 @@ module fsundials_core_mod
  public :: FSUNLogger_SetWarningFilename
  public :: FSUNLogger_SetDebugFilename
  public :: FSUNLogger_SetInfoFilename
+ public :: FSUNLogger_EnableDeferred
+ public :: FSUNLogger_SetBinaryFilename
  public :: FSUNLogger_QueueMsg
  public :: FSUNLogger_Flush
  public :: FSUNLogger_GetOutputRank
@@ -325,6 +336,7 @@ module fsundials_core_mod
   type(C_FUNPTR), public :: matvecsetup
   type(C_FUNPTR), public :: matvec
   type(C_FUNPTR), public :: space
+  type(C_FUNPTR), public :: writecapture
  end type SUNMatrix_Ops
  ! struct struct _generic_SUNMatrix
  type, bind(C), public :: SUNMatrix
@@ -692,6 +704,17 @@ type(C_PTR), value :: farg3
 integer(C_INT) :: fresult
 end function
 
+function swigc_FSUNProfiler_CreateFromEnv(farg1, farg2, farg3) &
+bind(C, name="_wrap_FSUNProfiler_CreateFromEnv") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+import :: swigarraywrapper
+integer(C_INT), intent(in) :: farg1
+type(SwigArrayWrapper) :: farg2
+type(C_PTR), value :: farg3
+integer(C_INT) :: fresult
+end function
+
 function swigc_FSUNProfiler_Free(farg1) &
 bind(C, name="_wrap_FSUNProfiler_Free") &
 result(fresult)
@@ -720,6 +743,35 @@ type(SwigArrayWrapper) :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FSUNProfiler_RegisterTimer(farg1, farg2, farg3) &
+bind(C, name="_wrap_FSUNProfiler_RegisterTimer") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+import :: swigarraywrapper
+type(C_PTR), value :: farg1
+type(SwigArrayWrapper) :: farg2
+type(C_PTR), value :: farg3
+integer(C_INT) :: fresult
+end function
+
+function swigc_FSUNProfiler_BeginTimer(farg1, farg2) &
+bind(C, name="_wrap_FSUNProfiler_BeginTimer") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
+function swigc_FSUNProfiler_EndTimer(farg1, farg2) &
+bind(C, name="_wrap_FSUNProfiler_EndTimer") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FSUNProfiler_GetTimerResolution(farg1, farg2) &
 bind(C, name="_wrap_FSUNProfiler_GetTimerResolution") &
 result(fresult)
@@ -757,6 +809,56 @@ type(C_PTR), value :: farg1
 integer(C_INT) :: fresult
 end function
 
+function swigc_FSUNProfiler_EnableTrace(farg1, farg2) &
+bind(C, name="_wrap_FSUNProfiler_EnableTrace") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_LONG), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
+function swigc_FSUNProfiler_SetTraceFilename(farg1, farg2) &
+bind(C, name="_wrap_FSUNProfiler_SetTraceFilename") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+import :: swigarraywrapper
+type(C_PTR), value :: farg1
+type(SwigArrayWrapper) :: farg2
+integer(C_INT) :: fresult
+end function
+
+function swigc_FSUNProfiler_WriteTrace(farg1, farg2) &
+bind(C, name="_wrap_FSUNProfiler_WriteTrace") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+type(C_PTR), value :: farg2
+integer(C_INT) :: fresult
+end function
+
+function swigc_FSUNProfiler_EnableCounters(farg1) &
+bind(C, name="_wrap_FSUNProfiler_EnableCounters") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_INT) :: fresult
+end function
+
+function swigc_FSUNProfiler_GetCounters(farg1, farg2, farg3, farg4, farg5, farg6) &
+bind(C, name="_wrap_FSUNProfiler_GetCounters") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+import :: swigarraywrapper
+type(C_PTR), value :: farg1
+type(SwigArrayWrapper) :: farg2
+type(C_PTR), value :: farg3
+type(C_PTR), value :: farg4
+type(C_PTR), value :: farg5
+type(C_PTR), value :: farg6
+integer(C_INT) :: fresult
+end function
+
 function swigc_FSUNLogger_Create(farg1, farg2, farg3) &
 bind(C, name="_wrap_FSUNLogger_Create") &
 result(fresult)
@@ -816,6 +918,25 @@ type(SwigArrayWrapper) :: farg2
 integer(C_INT) :: fresult
 end function
 
+function swigc_FSUNLogger_EnableDeferred(farg1, farg2) &
+bind(C, name="_wrap_FSUNLogger_EnableDeferred") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+type(C_PTR), value :: farg1
+integer(C_LONG), intent(in) :: farg2
+integer(C_INT) :: fresult
+end function
+
+function swigc_FSUNLogger_SetBinaryFilename(farg1, farg2) &
+bind(C, name="_wrap_FSUNLogger_SetBinaryFilename") &
+result(fresult)
+use, intrinsic :: ISO_C_BINDING
+import :: swigarraywrapper
+type(C_PTR), value :: farg1
+type(SwigArrayWrapper) :: farg2
+integer(C_INT) :: fresult
+end function
+
 function swigc_FSUNLogger_QueueMsg(farg1, farg2, farg3, farg4, farg5) &
 bind(C, name="_wrap_FSUNLogger_QueueMsg") &
 result(fresult)
@@ -2336,6 +2457,26 @@ fresult = swigc_FSUNProfiler_Create(farg1, farg2, farg3)
 swig_result = fresult
 end function
 
+function FSUNProfiler_CreateFromEnv(comm, title, p) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+integer :: comm
+character(kind=C_CHAR, len=*), target :: title
+character(kind=C_CHAR), dimension(:), allocatable, target :: farg2_chars
+type(C_PTR), target, intent(inout) :: p
+integer(C_INT) :: fresult 
+integer(C_INT) :: farg1 
+type(SwigArrayWrapper) :: farg2 
+type(C_PTR) :: farg3 
+
+farg1 = int(comm, C_INT)
+call SWIG_string_to_chararray(title, farg2_chars, farg2)
+farg3 = c_loc(p)
+fresult = swigc_FSUNProfiler_CreateFromEnv(farg1, farg2, farg3)
+swig_result = fresult
+end function
+
 function FSUNProfiler_Free(p) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -2383,6 +2524,58 @@ fresult = swigc_FSUNProfiler_End(farg1, farg2)
 swig_result = fresult
 end function
 
+function FSUNProfiler_RegisterTimer(p, name, handle) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: p
+character(kind=C_CHAR, len=*), target :: name
+character(kind=C_CHAR), dimension(:), allocatable, target :: farg2_chars
+integer(C_INT), dimension(*), target, intent(inout) :: handle
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(SwigArrayWrapper) :: farg2 
+type(C_PTR) :: farg3 
+
+farg1 = p
+call SWIG_string_to_chararray(name, farg2_chars, farg2)
+farg3 = c_loc(handle(1))
+fresult = swigc_FSUNProfiler_RegisterTimer(farg1, farg2, farg3)
+swig_result = fresult
+end function
+
+function FSUNProfiler_BeginTimer(p, handle) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: p
+integer(C_INT), intent(in) :: handle
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = p
+farg2 = handle
+fresult = swigc_FSUNProfiler_BeginTimer(farg1, farg2)
+swig_result = fresult
+end function
+
+function FSUNProfiler_EndTimer(p, handle) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: p
+integer(C_INT), intent(in) :: handle
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_INT) :: farg2 
+
+farg1 = p
+farg2 = handle
+fresult = swigc_FSUNProfiler_EndTimer(farg1, farg2)
+swig_result = fresult
+end function
+
 function FSUNProfiler_GetTimerResolution(p, resolution) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -2448,6 +2641,97 @@ fresult = swigc_FSUNProfiler_Reset(farg1)
 swig_result = fresult
 end function
 
+function FSUNProfiler_EnableTrace(p, capacity) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: p
+integer(C_LONG), intent(in) :: capacity
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_LONG) :: farg2 
+
+farg1 = p
+farg2 = capacity
+fresult = swigc_FSUNProfiler_EnableTrace(farg1, farg2)
+swig_result = fresult
+end function
+
+function FSUNProfiler_SetTraceFilename(p, filename) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: p
+character(kind=C_CHAR, len=*), target :: filename
+character(kind=C_CHAR), dimension(:), allocatable, target :: farg2_chars
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(SwigArrayWrapper) :: farg2 
+
+farg1 = p
+call SWIG_string_to_chararray(filename, farg2_chars, farg2)
+fresult = swigc_FSUNProfiler_SetTraceFilename(farg1, farg2)
+swig_result = fresult
+end function
+
+function FSUNProfiler_WriteTrace(p, fp) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: p
+type(C_PTR) :: fp
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(C_PTR) :: farg2 
+
+farg1 = p
+farg2 = fp
+fresult = swigc_FSUNProfiler_WriteTrace(farg1, farg2)
+swig_result = fresult
+end function
+
+function FSUNProfiler_EnableCounters(p) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: p
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+
+farg1 = p
+fresult = swigc_FSUNProfiler_EnableCounters(farg1)
+swig_result = fresult
+end function
+
+function FSUNProfiler_GetCounters(p, name, cycles, instructions, llc_references, llc_misses) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: p
+character(kind=C_CHAR, len=*), target :: name
+character(kind=C_CHAR), dimension(:), allocatable, target :: farg2_chars
+integer(C_LONG_LONG), dimension(*), target, intent(inout) :: cycles
+integer(C_LONG_LONG), dimension(*), target, intent(inout) :: instructions
+integer(C_LONG_LONG), dimension(*), target, intent(inout) :: llc_references
+integer(C_LONG_LONG), dimension(*), target, intent(inout) :: llc_misses
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(SwigArrayWrapper) :: farg2 
+type(C_PTR) :: farg3 
+type(C_PTR) :: farg4 
+type(C_PTR) :: farg5 
+type(C_PTR) :: farg6 
+
+farg1 = p
+call SWIG_string_to_chararray(name, farg2_chars, farg2)
+farg3 = c_loc(cycles(1))
+farg4 = c_loc(instructions(1))
+farg5 = c_loc(llc_references(1))
+farg6 = c_loc(llc_misses(1))
+fresult = swigc_FSUNProfiler_GetCounters(farg1, farg2, farg3, farg4, farg5, farg6)
+swig_result = fresult
+end function
+
 function FSUNLogger_Create(comm, output_rank, logger) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
@@ -2551,6 +2835,39 @@ fresult = swigc_FSUNLogger_SetInfoFilename(farg1, farg2)
 swig_result = fresult
 end function
 
+function FSUNLogger_EnableDeferred(logger, buffer_size) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: logger
+integer(C_LONG), intent(in) :: buffer_size
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+integer(C_LONG) :: farg2 
+
+farg1 = logger
+farg2 = buffer_size
+fresult = swigc_FSUNLogger_EnableDeferred(farg1, farg2)
+swig_result = fresult
+end function
+
+function FSUNLogger_SetBinaryFilename(logger, filename) &
+result(swig_result)
+use, intrinsic :: ISO_C_BINDING
+integer(C_INT) :: swig_result
+type(C_PTR) :: logger
+character(kind=C_CHAR, len=*), target :: filename
+character(kind=C_CHAR), dimension(:), allocatable, target :: farg2_chars
+integer(C_INT) :: fresult 
+type(C_PTR) :: farg1 
+type(SwigArrayWrapper) :: farg2 
+
+farg1 = logger
+call SWIG_string_to_chararray(filename, farg2_chars, farg2)
+fresult = swigc_FSUNLogger_SetBinaryFilename(farg1, farg2)
+swig_result = fresult
+end function
+
 function FSUNLogger_QueueMsg(logger, lvl, scope, label, msg_txt) &
 result(swig_result)
 use, intrinsic :: ISO_C_BINDING
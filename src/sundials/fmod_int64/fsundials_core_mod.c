@@ -526,6 +526,32 @@ SWIGEXPORT int _wrap_FSUNProfiler_Create(int const *farg1, SwigArrayWrapper *far
 }
 
 
+SWIGEXPORT int _wrap_FSUNProfiler_CreateFromEnv(int const *farg1, SwigArrayWrapper *farg2, void *farg3) {
+  int fresult ;
+  SUNComm arg1 ;
+  char *arg2 = (char *) 0 ;
+  SUNProfiler *arg3 = (SUNProfiler *) 0 ;
+  SUNErrCode result;
+  
+#if SUNDIALS_MPI_ENABLED
+  int flag = 0;
+  MPI_Initialized(&flag);
+  if(flag) {
+    arg1 = MPI_Comm_f2c((MPI_Fint)(*farg1));
+  } else {
+    arg1 = SUN_COMM_NULL;
+  }
+#else
+  arg1 = *farg1;
+#endif
+  arg2 = (char *)(farg2->data);
+  arg3 = (SUNProfiler *)(farg3);
+  result = (SUNErrCode)SUNProfiler_CreateFromEnv(arg1,(char const *)arg2,arg3);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FSUNProfiler_Free(void *farg1) {
   int fresult ;
   SUNProfiler *arg1 = (SUNProfiler *) 0 ;
@@ -566,6 +592,50 @@ SWIGEXPORT int _wrap_FSUNProfiler_End(void *farg1, SwigArrayWrapper *farg2) {
 }
 
 
+SWIGEXPORT int _wrap_FSUNProfiler_RegisterTimer(void *farg1, SwigArrayWrapper *farg2, int *farg3) {
+  int fresult ;
+  SUNProfiler arg1 = (SUNProfiler) 0 ;
+  char *arg2 = (char *) 0 ;
+  int *arg3 = (int *) 0 ;
+  SUNErrCode result;
+  
+  arg1 = (SUNProfiler)(farg1);
+  arg2 = (char *)(farg2->data);
+  arg3 = (int *)(farg3);
+  result = (SUNErrCode)SUNProfiler_RegisterTimer(arg1,(char const *)arg2,arg3);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
+SWIGEXPORT int _wrap_FSUNProfiler_BeginTimer(void *farg1, int const *farg2) {
+  int fresult ;
+  SUNProfiler arg1 = (SUNProfiler) 0 ;
+  int arg2 ;
+  SUNErrCode result;
+  
+  arg1 = (SUNProfiler)(farg1);
+  arg2 = (int)(*farg2);
+  result = (SUNErrCode)SUNProfiler_BeginTimer(arg1,arg2);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
+SWIGEXPORT int _wrap_FSUNProfiler_EndTimer(void *farg1, int const *farg2) {
+  int fresult ;
+  SUNProfiler arg1 = (SUNProfiler) 0 ;
+  int arg2 ;
+  SUNErrCode result;
+  
+  arg1 = (SUNProfiler)(farg1);
+  arg2 = (int)(*farg2);
+  result = (SUNErrCode)SUNProfiler_EndTimer(arg1,arg2);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FSUNProfiler_GetTimerResolution(void *farg1, double *farg2) {
   int fresult ;
   SUNProfiler arg1 = (SUNProfiler) 0 ;
@@ -622,6 +692,82 @@ SWIGEXPORT int _wrap_FSUNProfiler_Reset(void *farg1) {
 }
 
 
+SWIGEXPORT int _wrap_FSUNProfiler_EnableTrace(void *farg1, long const *farg2) {
+  int fresult ;
+  SUNProfiler arg1 = (SUNProfiler) 0 ;
+  long arg2 ;
+  SUNErrCode result;
+  
+  arg1 = (SUNProfiler)(farg1);
+  arg2 = (long)(*farg2);
+  result = (SUNErrCode)SUNProfiler_EnableTrace(arg1,arg2);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
+SWIGEXPORT int _wrap_FSUNProfiler_SetTraceFilename(void *farg1, SwigArrayWrapper *farg2) {
+  int fresult ;
+  SUNProfiler arg1 = (SUNProfiler) 0 ;
+  char *arg2 = (char *) 0 ;
+  SUNErrCode result;
+  
+  arg1 = (SUNProfiler)(farg1);
+  arg2 = (char *)(farg2->data);
+  result = (SUNErrCode)SUNProfiler_SetTraceFilename(arg1,(char const *)arg2);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
+SWIGEXPORT int _wrap_FSUNProfiler_WriteTrace(void *farg1, void *farg2) {
+  int fresult ;
+  SUNProfiler arg1 = (SUNProfiler) 0 ;
+  FILE *arg2 = (FILE *) 0 ;
+  SUNErrCode result;
+  
+  arg1 = (SUNProfiler)(farg1);
+  arg2 = (FILE *)(farg2);
+  result = (SUNErrCode)SUNProfiler_WriteTrace(arg1,arg2);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
+SWIGEXPORT int _wrap_FSUNProfiler_EnableCounters(void *farg1) {
+  int fresult ;
+  SUNProfiler arg1 = (SUNProfiler) 0 ;
+  SUNErrCode result;
+  
+  arg1 = (SUNProfiler)(farg1);
+  result = (SUNErrCode)SUNProfiler_EnableCounters(arg1);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
+SWIGEXPORT int _wrap_FSUNProfiler_GetCounters(void *farg1, SwigArrayWrapper *farg2, long long *farg3, long long *farg4, long long *farg5, long long *farg6) {
+  int fresult ;
+  SUNProfiler arg1 = (SUNProfiler) 0 ;
+  char *arg2 = (char *) 0 ;
+  long long *arg3 = (long long *) 0 ;
+  long long *arg4 = (long long *) 0 ;
+  long long *arg5 = (long long *) 0 ;
+  long long *arg6 = (long long *) 0 ;
+  SUNErrCode result;
+  
+  arg1 = (SUNProfiler)(farg1);
+  arg2 = (char *)(farg2->data);
+  arg3 = (long long *)(farg3);
+  arg4 = (long long *)(farg4);
+  arg5 = (long long *)(farg5);
+  arg6 = (long long *)(farg6);
+  result = (SUNErrCode)SUNProfiler_GetCounters(arg1,(char const *)arg2,arg3,arg4,arg5,arg6);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FSUNLogger_Create(int const *farg1, int const *farg2, void *farg3) {
   int fresult ;
   SUNComm arg1 ;
@@ -728,6 +874,34 @@ SWIGEXPORT int _wrap_FSUNLogger_SetInfoFilename(void *farg1, SwigArrayWrapper *f
 }
 
 
+SWIGEXPORT int _wrap_FSUNLogger_EnableDeferred(void *farg1, long const *farg2) {
+  int fresult ;
+  SUNLogger arg1 = (SUNLogger) 0 ;
+  long arg2 ;
+  SUNErrCode result;
+  
+  arg1 = (SUNLogger)(farg1);
+  arg2 = (long)(*farg2);
+  result = (SUNErrCode)SUNLogger_EnableDeferred(arg1,arg2);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
+SWIGEXPORT int _wrap_FSUNLogger_SetBinaryFilename(void *farg1, SwigArrayWrapper *farg2) {
+  int fresult ;
+  SUNLogger arg1 = (SUNLogger) 0 ;
+  char *arg2 = (char *) 0 ;
+  SUNErrCode result;
+  
+  arg1 = (SUNLogger)(farg1);
+  arg2 = (char *)(farg2->data);
+  result = (SUNErrCode)SUNLogger_SetBinaryFilename(arg1,(char const *)arg2);
+  fresult = (SUNErrCode)(result);
+  return fresult;
+}
+
+
 SWIGEXPORT int _wrap_FSUNLogger_QueueMsg(void *farg1, int const *farg2, SwigArrayWrapper *farg3, SwigArrayWrapper *farg4, SwigArrayWrapper *farg5) {
   int fresult ;
   SUNLogger arg1 = (SUNLogger) 0 ;
@@ -0,0 +1,224 @@
+/* -----------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * Implementation of the allocation audit. The audit counts the
+ * allocations made by SUNDIALS in steps taken after the first step
+ * of an integrator (or after the first KINSOL iteration), grouped
+ * by the profiler region and the allocation site.
+ * -----------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <sundials/priv/sundials_allocaudit_impl.h>
+#include <sundials/sundials_context.h>
+#include <sundials/sundials_errors.h>
+#include <sundials/sundials_types.h>
+
+#include "sundials_profiler_impl.h"
+#include "sundials_threads_impl.h"
+
+/* Number of (region, site) pairs reported, later pairs are combined */
+#define SUN_ALLOCAUDIT_MAX_SITES 64
+
+/* Number of nested steps tracked */
+#define SUN_ALLOCAUDIT_MAX_DEPTH 32
+
+typedef struct
+{
+  const char* region;
+  const char* site;
+  long int count;
+  long int bytes;
+} sunAllocAuditSite;
+
+struct sunAllocAudit_
+{
+  int mode;
+  SUNProfiler profiler;
+#if defined(SUNDIALS_ENABLE_THREAD_SAFE_CONTEXT)
+  unsigned long owner; /* only the thread that enabled the audit is recorded */
+#endif
+
+  /* nested steps, bit i is set if step i is steady */
+  unsigned long steady;
+  int depth;
+
+  /* all recorded allocations */
+  long int total_allocs;
+  long int total_bytes;
+
+  /* allocations in steady steps */
+  long int num_allocs;
+  long int num_bytes;
+  sunAllocAuditSite sites[SUN_ALLOCAUDIT_MAX_SITES];
+  int nsites;
+};
+
+SUNErrCode sunAllocAuditCreate(int mode, SUNProfiler profiler,
+                               sunAllocAudit* audit_ptr)
+{
+  sunAllocAudit audit = NULL;
+
+  audit = (sunAllocAudit)calloc(1, sizeof(*audit));
+  if (audit == NULL) { return SUN_ERR_MALLOC_FAIL; }
+
+  audit->mode     = mode;
+  audit->profiler = profiler;
+#if defined(SUNDIALS_ENABLE_THREAD_SAFE_CONTEXT)
+  audit->owner = sunThreadSelf();
+#endif
+
+  *audit_ptr = audit;
+
+  return SUN_SUCCESS;
+}
+
+void sunAllocAuditFree(sunAllocAudit* audit)
+{
+  if (audit == NULL || *audit == NULL) { return; }
+  free(*audit);
+  *audit = NULL;
+}
+
+void sunAllocAuditSetProfiler(sunAllocAudit audit, SUNProfiler profiler)
+{
+  audit->profiler = profiler;
+}
+
+/* Other threads sharing the context are not recorded, the audit is not
+   synchronized */
+static inline sunbooleantype sunAllocAuditIsOwner(sunAllocAudit audit)
+{
+#if defined(SUNDIALS_ENABLE_THREAD_SAFE_CONTEXT)
+  return audit->owner == sunThreadSelf();
+#else
+  (void)audit;
+  return SUNTRUE;
+#endif
+}
+
+void sunAllocAuditBeginStep(sunAllocAudit audit, sunbooleantype steady)
+{
+  if (!sunAllocAuditIsOwner(audit)) { return; }
+
+  if (audit->depth < SUN_ALLOCAUDIT_MAX_DEPTH && steady)
+  {
+    audit->steady |= 1UL << audit->depth;
+  }
+  audit->depth++;
+}
+
+void sunAllocAuditEndStep(sunAllocAudit audit)
+{
+  if (!sunAllocAuditIsOwner(audit)) { return; }
+  if (audit->depth == 0) { return; }
+  audit->depth--;
+  if (audit->depth < SUN_ALLOCAUDIT_MAX_DEPTH)
+  {
+    audit->steady &= ~(1UL << audit->depth);
+  }
+}
+
+void sunAllocAuditRecord(sunAllocAudit audit, size_t bytes, const char* site)
+{
+  int i;
+  const char* region = NULL;
+  sunAllocAuditSite* entry;
+
+  if (!sunAllocAuditIsOwner(audit)) { return; }
+
+  audit->total_allocs++;
+  audit->total_bytes += (long int)bytes;
+
+  /* Only allocations in a steady step are reported */
+  if (!audit->steady) { return; }
+
+  /* Report the region calling the allocation site, the site may be a
+     profiled function itself */
+  region = sunProfilerCurrentRegion(audit->profiler, site);
+  if (region == NULL) { region = "(no region)"; }
+
+  if (audit->mode == SUN_ALLOCAUDIT_ASSERT)
+  {
+    fprintf(stderr,
+            "[ALLOC AUDIT] %s allocated %zu bytes in region %s after the "
+            "first step\n",
+            site, bytes, region);
+    abort();
+  }
+
+  audit->num_allocs++;
+  audit->num_bytes += (long int)bytes;
+
+  /* Find the entry for this region and site, the names are string literals
+     or profiler timer names so comparing the pointers is enough */
+  for (i = 0; i < audit->nsites; i++)
+  {
+    entry = &audit->sites[i];
+    if (entry->site == site && entry->region == region) { break; }
+  }
+
+  if (i == audit->nsites)
+  {
+    if (audit->nsites == SUN_ALLOCAUDIT_MAX_SITES)
+    {
+      /* Combine the remaining allocations in the last entry */
+      i             = SUN_ALLOCAUDIT_MAX_SITES - 1;
+      entry         = &audit->sites[i];
+      entry->site   = "(other)";
+      entry->region = "(other)";
+    }
+    else
+    {
+      entry         = &audit->sites[audit->nsites++];
+      entry->region = region;
+      entry->site   = site;
+      entry->count  = 0;
+      entry->bytes  = 0;
+    }
+  }
+
+  entry = &audit->sites[i];
+  entry->count++;
+  entry->bytes += (long int)bytes;
+}
+
+void sunAllocAuditGetCounts(sunAllocAudit audit, long int* num_allocs,
+                            long int* num_bytes)
+{
+  *num_allocs = audit->num_allocs;
+  *num_bytes  = audit->num_bytes;
+}
+
+void sunAllocAuditPrint(sunAllocAudit audit, FILE* fp)
+{
+  int i;
+
+  fprintf(fp, "%-40s = %ld\n", "Recorded allocations", audit->total_allocs);
+  fprintf(fp, "%-40s = %ld\n", "Recorded bytes", audit->total_bytes);
+  fprintf(fp, "%-40s = %ld\n", "Allocations after the first step",
+          audit->num_allocs);
+  fprintf(fp, "%-40s = %ld\n", "Bytes after the first step", audit->num_bytes);
+
+  if (audit->nsites == 0) { return; }
+
+  fprintf(fp, "\n%-32s %-32s %10s %12s\n", "Region", "Site", "Count", "Bytes");
+  for (i = 0; i < audit->nsites; i++)
+  {
+    fprintf(fp, "%-32s %-32s %10ld %12ld\n", audit->sites[i].region,
+            audit->sites[i].site, audit->sites[i].count,
+            audit->sites[i].bytes);
+  }
+}
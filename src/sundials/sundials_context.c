@@ -28,7 +28,103 @@
 #include <sundials/sundials_types.h>
 
 #include "sundials_adiak_metadata.h"
+#include "sundials_logger_impl.h"
 #include "sundials_macros.h"
+#include "sundials_threads_impl.h"
+
+#if defined(SUNDIALS_ENABLE_THREAD_SAFE_CONTEXT)
+
+/* Error handlers removed from the stack, freed with the context */
+typedef struct sunRetiredErrHandler_
+{
+  SUNErrHandler eh;
+  struct sunRetiredErrHandler_* next;
+} sunRetiredErrHandler;
+
+struct sunContextThreads_
+{
+  sunMutex lock;             /* serializes changes to the handler stack */
+  sunThreadKey last_err_key; /* last error of each thread               */
+  sunRetiredErrHandler* retired;
+};
+
+static SUNErrCode sunContextThreadsCreate(SUNContext sunctx)
+{
+  struct sunContextThreads_* threads = NULL;
+
+  threads = (struct sunContextThreads_*)malloc(sizeof(*threads));
+  if (!threads) { return SUN_ERR_MALLOC_FAIL; }
+
+  if (sunMutexInit(&threads->lock))
+  {
+    free(threads);
+    return SUN_ERR_OP_FAIL;
+  }
+
+  if (sunThreadKeyCreate(&threads->last_err_key))
+  {
+    sunMutexDestroy(&threads->lock);
+    free(threads);
+    return SUN_ERR_OP_FAIL;
+  }
+
+  threads->retired = NULL;
+  sunctx->threads  = threads;
+
+  return SUN_SUCCESS;
+}
+
+static void sunContextThreadsFree(SUNContext sunctx)
+{
+  sunRetiredErrHandler* node = NULL;
+
+  if (!sunctx->threads) { return; }
+
+  while (sunctx->threads->retired)
+  {
+    node                     = sunctx->threads->retired;
+    sunctx->threads->retired = node->next;
+    SUNErrHandler_Destroy(&node->eh);
+    free(node);
+  }
+
+  sunThreadKeyDelete(sunctx->threads->last_err_key);
+  sunMutexDestroy(&sunctx->threads->lock);
+  free(sunctx->threads);
+  sunctx->threads = NULL;
+}
+
+static SUNErrCode sunContextGetThreadErr(SUNContext sunctx)
+{
+  return (SUNErrCode)(intptr_t)sunThreadKeyGet(sunctx->threads->last_err_key);
+}
+
+static void sunContextSetThreadErr(SUNContext sunctx, SUNErrCode code)
+{
+  sunThreadKeySet(sunctx->threads->last_err_key, (void*)(intptr_t)code);
+}
+
+SUNErrHandler sunContextRecordError(SUNContext sunctx, SUNErrCode code)
+{
+  SUNErrHandler eh = NULL;
+
+  /* The context is still being created */
+  if (!sunctx->threads)
+  {
+    sunctx->last_err = code;
+    return sunctx->err_handler;
+  }
+
+  sunContextSetThreadErr(sunctx, code);
+
+  sunMutexLock(&sunctx->threads->lock);
+  eh = sunctx->err_handler;
+  sunMutexUnlock(&sunctx->threads->lock);
+
+  return eh;
+}
+
+#endif
 
 SUNErrCode SUNContext_Create(SUNComm comm, SUNContext* sunctx_out)
 {
@@ -37,6 +133,7 @@ SUNErrCode SUNContext_Create(SUNComm comm, SUNContext* sunctx_out)
   SUNLogger logger     = NULL;
   SUNContext sunctx    = NULL;
   SUNErrHandler eh     = NULL;
+  char* audit_env      = NULL;
 
   *sunctx_out = NULL;
   sunctx      = (SUNContext)malloc(sizeof(struct SUNContext_));
@@ -47,6 +144,10 @@ SUNErrCode SUNContext_Create(SUNComm comm, SUNContext* sunctx_out)
 
   SUNFunctionBegin(sunctx);
 
+#if defined(SUNDIALS_ENABLE_THREAD_SAFE_CONTEXT)
+  sunctx->threads = NULL;
+#endif
+
 #ifdef SUNDIALS_ADIAK_ENABLED
   adiak_init(&comm);
   sunAdiakCollectMetadata();
@@ -82,7 +183,7 @@ SUNErrCode SUNContext_Create(SUNComm comm, SUNContext* sunctx_out)
 #endif
 
 #if defined(SUNDIALS_BUILD_WITH_PROFILING) && !defined(SUNDIALS_CALIPER_ENABLED)
-    err = SUNProfiler_Create(comm, "SUNContext Default", &profiler);
+    err = SUNProfiler_CreateFromEnv(comm, "SUNContext Default", &profiler);
     SUNCheckCallNoRet(err);
     if (err) { break; }
 #endif
@@ -98,11 +199,36 @@ SUNErrCode SUNContext_Create(SUNComm comm, SUNContext* sunctx_out)
     sunctx->last_err     = SUN_SUCCESS;
     sunctx->err_handler  = eh;
     sunctx->comm         = comm;
+    sunctx->audit        = NULL;
+
+#if defined(SUNDIALS_ENABLE_THREAD_SAFE_CONTEXT)
+    err = sunContextThreadsCreate(sunctx);
+    SUNCheckCallNoRet(err);
+    if (err) { break; }
+#endif
+
+    audit_env = getenv("SUNDIALS_ALLOC_AUDIT");
+    if (audit_env && !strcmp(audit_env, "report"))
+    {
+      err = SUNContext_SetAllocAudit(sunctx, SUN_ALLOCAUDIT_REPORT);
+      SUNCheckCallNoRet(err);
+      if (err) { break; }
+    }
+    else if (audit_env && !strcmp(audit_env, "assert"))
+    {
+      err = SUNContext_SetAllocAudit(sunctx, SUN_ALLOCAUDIT_ASSERT);
+      SUNCheckCallNoRet(err);
+      if (err) { break; }
+    }
   }
   while (0);
 
   if (err)
   {
+#if defined(SUNDIALS_ENABLE_THREAD_SAFE_CONTEXT)
+    sunContextThreadsFree(sunctx);
+#endif
+    SUNErrHandler_Destroy(&eh);
 #if defined(SUNDIALS_BUILD_WITH_PROFILING) && !defined(SUNDIALS_CALIPER_ENABLED)
     SUNCheckCallNoRet(SUNProfiler_Free(&profiler));
 #endif
@@ -119,8 +245,13 @@ SUNErrCode SUNContext_GetLastError(SUNContext sunctx)
   if (!sunctx) { return SUN_ERR_SUNCTX_CORRUPT; }
 
   SUNFunctionBegin(sunctx);
+#if defined(SUNDIALS_ENABLE_THREAD_SAFE_CONTEXT)
+  SUNErrCode err = sunContextGetThreadErr(sunctx);
+  sunContextSetThreadErr(sunctx, SUN_SUCCESS);
+#else
   SUNErrCode err   = sunctx->last_err;
   sunctx->last_err = SUN_SUCCESS;
+#endif
   return err;
 }
 
@@ -129,7 +260,11 @@ SUNErrCode SUNContext_PeekLastError(SUNContext sunctx)
   if (!sunctx) { return SUN_ERR_SUNCTX_CORRUPT; }
 
   SUNFunctionBegin(sunctx);
+#if defined(SUNDIALS_ENABLE_THREAD_SAFE_CONTEXT)
+  return sunContextGetThreadErr(sunctx);
+#else
   return sunctx->last_err;
+#endif
 }
 
 SUNErrCode SUNContext_PushErrHandler(SUNContext sunctx, SUNErrHandlerFn err_fn,
@@ -143,8 +278,14 @@ SUNErrCode SUNContext_PushErrHandler(SUNContext sunctx, SUNErrHandlerFn err_fn,
   {
     return SUN_ERR_CORRUPT;
   }
+#if defined(SUNDIALS_ENABLE_THREAD_SAFE_CONTEXT)
+  sunMutexLock(&sunctx->threads->lock);
+#endif
   new_err_handler->previous = sunctx->err_handler;
   sunctx->err_handler       = new_err_handler;
+#if defined(SUNDIALS_ENABLE_THREAD_SAFE_CONTEXT)
+  sunMutexUnlock(&sunctx->threads->lock);
+#endif
   return SUN_SUCCESS;
 }
 
@@ -153,6 +294,24 @@ SUNErrCode SUNContext_PopErrHandler(SUNContext sunctx)
   if (!sunctx) { return SUN_ERR_SUNCTX_CORRUPT; }
 
   SUNFunctionBegin(sunctx);
+#if defined(SUNDIALS_ENABLE_THREAD_SAFE_CONTEXT)
+  /* Another thread may be calling the handler, so it is kept until the context
+     is freed */
+  sunRetiredErrHandler* node = NULL;
+  node = (sunRetiredErrHandler*)malloc(sizeof(*node));
+  if (!node) { return SUN_ERR_MALLOC_FAIL; }
+  sunMutexLock(&sunctx->threads->lock);
+  if (sunctx->err_handler)
+  {
+    node->eh                 = sunctx->err_handler;
+    node->next               = sunctx->threads->retired;
+    sunctx->threads->retired = node;
+    sunctx->err_handler      = sunctx->err_handler->previous;
+    node                     = NULL;
+  }
+  sunMutexUnlock(&sunctx->threads->lock);
+  free(node);
+#else
   if (sunctx->err_handler)
   {
     SUNErrHandler eh = sunctx->err_handler;
@@ -163,6 +322,7 @@ SUNErrCode SUNContext_PopErrHandler(SUNContext sunctx)
     else { sunctx->err_handler = NULL; }
     SUNErrHandler_Destroy(&eh);
   }
+#endif
   return SUN_SUCCESS;
 }
 
@@ -211,6 +371,7 @@ SUNErrCode SUNContext_SetProfiler(SUNContext sunctx, SUNProfiler profiler)
   /* set profiler */
   sunctx->profiler     = profiler;
   sunctx->own_profiler = SUNFALSE;
+  if (sunctx->audit) { sunAllocAuditSetProfiler(sunctx->audit, profiler); }
 #else
   /* silence warnings when profiling is disabled */
   ((void)profiler);
@@ -236,6 +397,12 @@ SUNErrCode SUNContext_SetLogger(SUNContext sunctx, SUNLogger logger)
 
   SUNFunctionBegin(sunctx);
 
+  /* detach the allocation audit from the current logger */
+  if (sunctx->logger && sunctx->logger->audit == sunctx->audit)
+  {
+    sunctx->logger->audit = NULL;
+  }
+
   /* free any existing logger */
   if (sunctx->logger && sunctx->own_logger)
   {
@@ -246,6 +413,71 @@ SUNErrCode SUNContext_SetLogger(SUNContext sunctx, SUNLogger logger)
   /* set logger */
   sunctx->logger     = logger;
   sunctx->own_logger = SUNFALSE;
+  if (logger && sunctx->audit) { logger->audit = sunctx->audit; }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNContext_SetAllocAudit(SUNContext sunctx, SUNAllocAuditMode mode)
+{
+  if (!sunctx) { return SUN_ERR_SUNCTX_CORRUPT; }
+
+  SUNFunctionBegin(sunctx);
+
+  SUNAssert(mode == SUN_ALLOCAUDIT_OFF || mode == SUN_ALLOCAUDIT_REPORT ||
+              mode == SUN_ALLOCAUDIT_ASSERT,
+            SUN_ERR_ARG_OUTOFRANGE);
+
+  /* remove any existing audit, the counts start over */
+  if (sunctx->audit)
+  {
+    if (sunctx->logger && sunctx->logger->audit == sunctx->audit)
+    {
+      sunctx->logger->audit = NULL;
+    }
+    sunAllocAuditFree(&sunctx->audit);
+  }
+
+  if (mode == SUN_ALLOCAUDIT_OFF) { return SUN_SUCCESS; }
+
+  SUNCheckCall(
+    sunAllocAuditCreate((int)mode, sunctx->profiler, &sunctx->audit));
+  if (sunctx->logger) { sunctx->logger->audit = sunctx->audit; }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNContext_GetAllocAuditCounts(SUNContext sunctx,
+                                          long int* num_allocs,
+                                          long int* num_bytes)
+{
+  if (!sunctx) { return SUN_ERR_SUNCTX_CORRUPT; }
+
+  SUNFunctionBegin(sunctx);
+
+  SUNAssert(num_allocs && num_bytes, SUN_ERR_ARG_CORRUPT);
+
+  if (!sunctx->audit)
+  {
+    *num_allocs = 0;
+    *num_bytes  = 0;
+    return SUN_SUCCESS;
+  }
+
+  sunAllocAuditGetCounts(sunctx->audit, num_allocs, num_bytes);
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNContext_PrintAllocAudit(SUNContext sunctx, FILE* fp)
+{
+  if (!sunctx) { return SUN_ERR_SUNCTX_CORRUPT; }
+
+  SUNFunctionBegin(sunctx);
+
+  SUNAssert(fp, SUN_ERR_ARG_CORRUPT);
+
+  if (sunctx->audit) { sunAllocAuditPrint(sunctx->audit, fp); }
 
   return SUN_SUCCESS;
 }
@@ -285,6 +517,21 @@ SUNErrCode SUNContext_Free(SUNContext* sunctx)
   }
 #endif
 
+  if ((*sunctx)->audit)
+  {
+    /* Print the report when the audit was enabled by the environment */
+    char* audit_env = getenv("SUNDIALS_ALLOC_AUDIT");
+    if (audit_env && !strcmp(audit_env, "report"))
+    {
+      sunAllocAuditPrint((*sunctx)->audit, stdout);
+    }
+    if ((*sunctx)->logger && (*sunctx)->logger->audit == (*sunctx)->audit)
+    {
+      (*sunctx)->logger->audit = NULL;
+    }
+    sunAllocAuditFree(&(*sunctx)->audit);
+  }
+
   if ((*sunctx)->logger && (*sunctx)->own_logger)
   {
     SUNLogger_Destroy(&(*sunctx)->logger);
@@ -292,6 +539,10 @@ SUNErrCode SUNContext_Free(SUNContext* sunctx)
 
   SUNContext_ClearErrHandlers(*sunctx);
 
+#if defined(SUNDIALS_ENABLE_THREAD_SAFE_CONTEXT)
+  sunContextThreadsFree(*sunctx);
+#endif
+
   free(*sunctx);
   *sunctx = NULL;
 
@@ -56,6 +56,8 @@ SUNLinearSolver SUNLinSolNewEmpty(SUNContext sunctx)
   ops = (SUNLinearSolver_Ops)malloc(sizeof *ops);
   SUNAssertNull(ops, SUN_ERR_MALLOC_FAIL);
 
+  SUNAllocAuditRecord(sunctx, sizeof *LS + sizeof *ops);
+
   /* initialize operations to NULL */
   ops->gettype           = NULL;
   ops->getid             = NULL;
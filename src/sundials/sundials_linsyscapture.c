@@ -0,0 +1,237 @@
+/* -----------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the implementation of the SUNLinSysCapture archive writer.
+ * -----------------------------------------------------------------*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <sundials/sundials_config.h>
+#include <sundials/sundials_errors.h>
+#include <sundials/sundials_linsyscapture.h>
+#include <sundials/sundials_matrix.h>
+#include <sundials/sundials_nvector.h>
+#include <sundials/sundials_types.h>
+
+/* Binary file magic number */
+#define SUN_LINSYSCAPTURE_MAGIC "SUNLSC01"
+
+/*
+  File layout
+
+  The file starts with the header below (24 bytes) followed by a sequence of
+  records. Each record is a SUNLinSysCaptureRecord followed by its data:
+
+  - dense:  rows * cols sunrealtype values in column-major order
+  - band:   cols * (upper + lower + 1) sunrealtype values, column j holds
+            the entries in rows j - upper to j + lower (entries outside of
+            the matrix are undefined)
+  - sparse: np + 1 index pointers and nnz index values (sunindextype) and
+            nnz sunrealtype values, np = cols for CSC and rows for CSR
+  - rhs:    rows sunrealtype values (the packed vector, see N_VBufPack)
+
+  A right-hand side record belongs to the matrix record with the same system
+  index, which always comes before it in the file. Matrix records are written
+  by the writecapture operation of the matrix.
+
+  Capturing stops after the first failed write, the last record in the file
+  may then be incomplete.
+ */
+
+typedef struct
+{
+  char magic[8];
+  uint32_t byte_order; /* 0x01020304 written in native byte order */
+  uint32_t real_size;  /* size of a sunrealtype                    */
+  uint32_t index_size; /* size of a sunindextype                   */
+  uint32_t reserved;
+} sunLinSysCaptureHeader;
+
+struct SUNLinSysCapture_
+{
+  FILE* fp;               /* output file                               */
+  long interval;          /* capture every interval-th matrix          */
+  long max_systems;       /* maximum number of systems, 0 for no limit */
+  long max_rhs;           /* maximum rhs per system, 0 for no limit    */
+  long nmatrices;         /* number of matrices offered                */
+  long nsystems;          /* number of systems captured                */
+  long nrhs;              /* number of right-hand sides captured       */
+  long nrhs_cur;          /* right-hand sides for the current system   */
+  sunbooleantype current; /* the current matrix was captured           */
+  SUNErrCode err;         /* first write error, capturing stops after it */
+};
+
+SUNErrCode SUNLinSysCapture_Create(const char* filename, SUNLinSysCapture* cap)
+{
+  SUNLinSysCapture c = NULL;
+  sunLinSysCaptureHeader header;
+
+  if (cap == NULL || filename == NULL) { return SUN_ERR_ARG_CORRUPT; }
+
+  c = (SUNLinSysCapture)malloc(sizeof(*c));
+  if (c == NULL) { return SUN_ERR_MALLOC_FAIL; }
+
+  c->fp = fopen(filename, "wb");
+  if (c->fp == NULL)
+  {
+    free(c);
+    return SUN_ERR_FILE_OPEN;
+  }
+
+  c->interval    = 1;
+  c->max_systems = 0;
+  c->max_rhs     = 0;
+  c->nmatrices   = 0;
+  c->nsystems    = 0;
+  c->nrhs        = 0;
+  c->nrhs_cur    = 0;
+  c->current     = SUNFALSE;
+  c->err         = SUN_SUCCESS;
+
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, SUN_LINSYSCAPTURE_MAGIC, sizeof(header.magic));
+  header.byte_order = 0x01020304;
+  header.real_size  = (uint32_t)sizeof(sunrealtype);
+  header.index_size = (uint32_t)sizeof(sunindextype);
+
+  if (fwrite(&header, sizeof(header), 1, c->fp) != 1)
+  {
+    fclose(c->fp);
+    free(c);
+    return SUN_ERR_OP_FAIL;
+  }
+
+  *cap = c;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNLinSysCapture_Destroy(SUNLinSysCapture* cap)
+{
+  SUNErrCode err = SUN_SUCCESS;
+
+  if (cap == NULL || *cap == NULL) { return SUN_SUCCESS; }
+
+  if (fclose((*cap)->fp)) { err = SUN_ERR_OP_FAIL; }
+
+  free(*cap);
+  *cap = NULL;
+
+  return err;
+}
+
+SUNErrCode SUNLinSysCapture_SetSelection(SUNLinSysCapture cap, long interval,
+                                         long max_systems, long max_rhs)
+{
+  if (cap == NULL) { return SUN_ERR_ARG_CORRUPT; }
+
+  cap->interval    = (interval < 1) ? 1 : interval;
+  cap->max_systems = (max_systems < 0) ? 0 : max_systems;
+  cap->max_rhs     = (max_rhs < 0) ? 0 : max_rhs;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNLinSysCapture_Matrix(SUNLinSysCapture cap, sunrealtype t,
+                                   sunrealtype gamma, SUNMatrix A)
+{
+  SUNLinSysCaptureRecord rec;
+
+  if (cap == NULL || A == NULL) { return SUN_ERR_ARG_CORRUPT; }
+  if (cap->err) { return cap->err; }
+
+  /* Check if this matrix is selected */
+  cap->current  = SUNFALSE;
+  cap->nrhs_cur = 0;
+  cap->nmatrices++;
+  if ((cap->nmatrices - 1) % cap->interval) { return SUN_SUCCESS; }
+  if (cap->max_systems && cap->nsystems >= cap->max_systems)
+  {
+    return SUN_SUCCESS;
+  }
+
+  if (A->ops->writecapture == NULL) { return SUN_ERR_ARG_INCOMPATIBLE; }
+
+  /* The matrix fills in its format and size and writes the record */
+  memset(&rec, 0, sizeof(rec));
+  rec.kind   = SUN_LINSYSCAPTURE_MATRIX;
+  rec.system = cap->nsystems;
+  rec.t      = (double)t;
+  rec.value  = (double)gamma;
+
+  cap->err = A->ops->writecapture(A, &rec, cap->fp);
+  if (cap->err) { return cap->err; }
+
+  cap->current = SUNTRUE;
+  cap->nsystems++;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNLinSysCapture_Rhs(SUNLinSysCapture cap, sunrealtype t,
+                                sunrealtype tol, N_Vector b)
+{
+  SUNLinSysCaptureRecord rec;
+  sunindextype size;
+  SUNErrCode err;
+
+  if (cap == NULL || b == NULL) { return SUN_ERR_ARG_CORRUPT; }
+  if (cap->err) { return cap->err; }
+
+  /* Only right-hand sides solved with a captured matrix are written */
+  if (!cap->current) { return SUN_SUCCESS; }
+  if (cap->max_rhs && cap->nrhs_cur >= cap->max_rhs) { return SUN_SUCCESS; }
+
+  err = N_VBufSize(b, &size);
+  if (err) { return err; }
+
+  memset(&rec, 0, sizeof(rec));
+  rec.kind   = SUN_LINSYSCAPTURE_RHS;
+  rec.system = cap->nsystems - 1;
+  rec.rows   = size / (sunindextype)sizeof(sunrealtype);
+  rec.cols   = 1;
+  rec.t      = (double)t;
+  rec.value  = (double)tol;
+
+  if (fwrite(&rec, sizeof(rec), 1, cap->fp) != 1)
+  {
+    cap->err = SUN_ERR_OP_FAIL;
+    return cap->err;
+  }
+
+  cap->err = N_VWriteBinary(b, cap->fp, SUNFALSE);
+  if (cap->err) { return cap->err; }
+
+  cap->nrhs_cur++;
+  cap->nrhs++;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNLinSysCapture_GetNumSystems(SUNLinSysCapture cap,
+                                          long* num_systems)
+{
+  if (cap == NULL || num_systems == NULL) { return SUN_ERR_ARG_CORRUPT; }
+  *num_systems = cap->nsystems;
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNLinSysCapture_GetNumRhs(SUNLinSysCapture cap, long* num_rhs)
+{
+  if (cap == NULL || num_rhs == NULL) { return SUN_ERR_ARG_CORRUPT; }
+  *num_rhs = cap->nrhs;
+  return SUN_SUCCESS;
+}
@@ -13,6 +13,8 @@
  * -----------------------------------------------------------------*/
 
 #include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -119,6 +121,722 @@ static sunbooleantype sunLoggerIsOutputRank(SUNDIALS_MAYBE_UNUSED SUNLogger logg
   return retval;
 }
 
+/*
+  Deferred logging.
+
+  When deferred logging is enabled, info messages are not formatted when they
+  are queued. The scope, label, and format string are replaced by the ids of
+  interned copies and the arguments, as given by the conversions in the format
+  string, are copied into a buffer of binary records. The buffer is formatted
+  (or written as is to a binary file) when it is full, when the logger is
+  flushed or destroyed, and before any message that is written immediately so
+  the order of the output is kept. There is one buffer per logger, not per
+  thread. A logger (like the SUNContext that owns it) is used by one thread at
+  a time or, with SUNDIALS_ENABLE_THREAD_SAFE_CONTEXT, under the logger lock.
+
+  With SUNDIALS_ENABLE_ASYNC_OUTPUT the buffer is flushed in the background. A
+  full buffer is swapped with a second buffer that is formatted (or written) by
+  a flush thread while the calling thread fills the other one. The calling
+  thread only waits when the flush thread is still busy with the previous
+  buffer, or when the output must be complete (flushing the logger, writing an
+  immediate message to the info file, changing files, or destroying the
+  logger). Records are only appended to the strings array, so the flush thread
+  can read the strings used by its buffer while new strings are added.
+
+  A binary log file is a header followed by the records. String records define
+  the id of an interned string and message records hold the level, rank, and
+  string ids of a message followed by its arguments, each prefixed with a tag
+  character. The file can be converted to text or JSON lines with the script
+  scripts/sundialsdev/binlog.py.
+ */
+
+#if SUNDIALS_LOGGING_LEVEL >= SUNDIALS_LOGGING_INFO
+
+/* default size of the deferred message buffer in bytes */
+#define SUN_LOGGER_BUFFER_SIZE_ 1048576
+
+/* smallest size of the deferred message buffer in bytes */
+#define SUN_LOGGER_MIN_BUFFER_SIZE_ 4096
+
+/* max number of distinct strings (scopes, labels, and formats) */
+#define SUN_MAX_LOGSTRINGS_ 4096
+
+/* number of entries in the interned string cache (must be a power of 2) */
+#define SUN_LOGSTRING_CACHE_SIZE_ 256
+
+/* binary log file magic number and record types */
+#define SUN_LOGFILE_MAGIC_  "SUNLOG01"
+#define SUN_LOGREC_STRING_  'S'
+#define SUN_LOGREC_MESSAGE_ 'M'
+
+typedef struct
+{
+  char type;
+  char pad[3];
+  uint32_t id;
+  uint32_t length; /* string length including the null terminator */
+} sunLogStringRecord;
+
+typedef struct
+{
+  char type;
+  char level;
+  char pad[2];
+  int32_t rank;
+  uint32_t scope;
+  uint32_t label;
+  uint32_t format;
+  uint32_t size; /* size of the arguments following the record */
+} sunLogMessageRecord;
+
+typedef struct
+{
+  char magic[8];
+  uint32_t byte_order;       /* 0x01020304 written in native byte order */
+  uint32_t long_double_size; /* size of long double arguments           */
+} sunLogFileHeader;
+
+static void sunLoggerFlushDeferred(SUNLogger logger);
+static void sunLoggerStartFlush(SUNLogger logger);
+
+static void sunLoggerNoFree(SUNDIALS_MAYBE_UNUSED void* ptr) {}
+
+static const char* sunLogLevelPrefix(int lvl)
+{
+  if (lvl == SUN_LOGLEVEL_DEBUG) { return "DEBUG"; }
+  if (lvl == SUN_LOGLEVEL_WARNING) { return "WARNING"; }
+  if (lvl == SUN_LOGLEVEL_INFO) { return "INFO"; }
+  if (lvl == SUN_LOGLEVEL_ERROR) { return "ERROR"; }
+  return NULL;
+}
+
+/* Parse the conversion specification starting at fmt (a '%') and return its
+   length, the conversion character, the length modifier ('H' for hh and 'q'
+   for ll), and the number of '*' widths and precisions */
+static int sunParseConversion(const char* fmt, char* conv, char* mod,
+                              int* nstars)
+{
+  const char* p = fmt + 1;
+
+  *mod    = 0;
+  *nstars = 0;
+
+  while (*p && strchr("-+ #0", *p)) { p++; }
+  if (*p == '*')
+  {
+    (*nstars)++;
+    p++;
+  }
+  else
+  {
+    while (*p >= '0' && *p <= '9') { p++; }
+  }
+  if (*p == '.')
+  {
+    p++;
+    if (*p == '*')
+    {
+      (*nstars)++;
+      p++;
+    }
+    else
+    {
+      while (*p >= '0' && *p <= '9') { p++; }
+    }
+  }
+
+  if (*p == 'h')
+  {
+    p++;
+    if (*p == 'h')
+    {
+      *mod = 'H';
+      p++;
+    }
+    else { *mod = 'h'; }
+  }
+  else if (*p == 'l')
+  {
+    p++;
+    if (*p == 'l')
+    {
+      *mod = 'q';
+      p++;
+    }
+    else { *mod = 'l'; }
+  }
+  else if (*p && strchr("Ljzt", *p)) { *mod = *p++; }
+
+  *conv = *p;
+
+  return (int)(p - fmt) + (*p ? 1 : 0);
+}
+
+/* Append a tagged value to the arguments, returns nonzero if it does not fit */
+static int sunPutArg(unsigned char** pos, const unsigned char* end, char tag,
+                     const void* value, size_t size)
+{
+  if ((size_t)(end - *pos) < 1 + size) { return 1; }
+  **pos = (unsigned char)tag;
+  memcpy(*pos + 1, value, size);
+  *pos += 1 + size;
+  return 0;
+}
+
+static int sunPutString(unsigned char** pos, const unsigned char* end,
+                        const char* str)
+{
+  uint32_t length = (uint32_t)strlen(str) + 1;
+  if ((size_t)(end - *pos) < 1 + sizeof(length) + length) { return 1; }
+  **pos = 's';
+  memcpy(*pos + 1, &length, sizeof(length));
+  memcpy(*pos + 1 + sizeof(length), str, length);
+  *pos += 1 + sizeof(length) + length;
+  return 0;
+}
+
+/* Copy the arguments of a message, returns 1 if they do not fit and -1 if the
+   format has conversions that cannot be deferred */
+static int sunPutArgs(unsigned char** pos, const unsigned char* end,
+                      const char* fmt, va_list* args)
+{
+  int i, nstars;
+  char conv, mod;
+
+  for (; *fmt; fmt++)
+  {
+    long long ival;
+    unsigned long long uval;
+    double dval;
+    long double ldval;
+    const char* sval;
+
+    if (*fmt != '%') { continue; }
+
+    fmt += sunParseConversion(fmt, &conv, &mod, &nstars) - 1;
+    if (conv == '%') { continue; }
+
+    for (i = 0; i < nstars; i++)
+    {
+      ival = va_arg(*args, int);
+      if (sunPutArg(pos, end, 'i', &ival, sizeof(ival))) { return 1; }
+    }
+
+    switch (conv)
+    {
+    case 'd':
+    case 'i':
+      if (mod == 'l') { ival = va_arg(*args, long); }
+      else if (mod == 'q') { ival = va_arg(*args, long long); }
+      else if (mod == 'z') { ival = (long long)va_arg(*args, size_t); }
+      else if (mod == 'j') { ival = (long long)va_arg(*args, intmax_t); }
+      else if (mod == 't') { ival = (long long)va_arg(*args, ptrdiff_t); }
+      else { ival = va_arg(*args, int); }
+      if (sunPutArg(pos, end, 'i', &ival, sizeof(ival))) { return 1; }
+      break;
+    case 'o':
+    case 'u':
+    case 'x':
+    case 'X':
+      if (mod == 'l') { uval = va_arg(*args, unsigned long); }
+      else if (mod == 'q') { uval = va_arg(*args, unsigned long long); }
+      else if (mod == 'z') { uval = va_arg(*args, size_t); }
+      else if (mod == 'j') { uval = va_arg(*args, uintmax_t); }
+      else if (mod == 't') { uval = (unsigned long long)va_arg(*args, ptrdiff_t); }
+      else { uval = va_arg(*args, unsigned int); }
+      if (sunPutArg(pos, end, 'u', &uval, sizeof(uval))) { return 1; }
+      break;
+    case 'c':
+      ival = va_arg(*args, int);
+      if (sunPutArg(pos, end, 'i', &ival, sizeof(ival))) { return 1; }
+      break;
+    case 'e':
+    case 'E':
+    case 'f':
+    case 'F':
+    case 'g':
+    case 'G':
+    case 'a':
+    case 'A':
+      if (mod == 'L')
+      {
+        ldval = va_arg(*args, long double);
+        if (sunPutArg(pos, end, 'L', &ldval, sizeof(ldval))) { return 1; }
+      }
+      else
+      {
+        dval = va_arg(*args, double);
+        if (sunPutArg(pos, end, 'd', &dval, sizeof(dval))) { return 1; }
+      }
+      break;
+    case 's':
+      sval = va_arg(*args, const char*);
+      if (sunPutString(pos, end, sval ? sval : "(null)")) { return 1; }
+      break;
+    case 'p':
+      uval = (unsigned long long)(uintptr_t)va_arg(*args, void*);
+      if (sunPutArg(pos, end, 'p', &uval, sizeof(uval))) { return 1; }
+      break;
+    default: return -1;
+    }
+  }
+
+  return 0;
+}
+
+/* Make room for size bytes in the buffer, returns nonzero if they do not fit */
+static int sunLoggerReserve(SUNLogger logger, size_t size)
+{
+  if (logger->records_used + size <= logger->records_size) { return 0; }
+  sunLoggerStartFlush(logger);
+  return size > logger->records_size;
+}
+
+/* Get the id of an interned copy of a string, adding the string if it is new.
+   Lookups are cached by the address of the string, which is usually a string
+   literal, and a cache hit is confirmed by comparing the strings. */
+static int sunLoggerStringId(SUNLogger logger, const char* str, uint32_t* id)
+{
+  int idx;
+  void* value;
+  char* copy;
+  sunLogStringRecord rec;
+
+  if (!str) { str = "(null)"; }
+
+  idx = (int)((((uintptr_t)str) >> 3) & (SUN_LOGSTRING_CACHE_SIZE_ - 1));
+  if (logger->string_cache[idx].str == str &&
+      !strcmp(logger->strings[logger->string_cache[idx].id], str))
+  {
+    *id = logger->string_cache[idx].id;
+    return 0;
+  }
+
+  if (!SUNHashMap_GetValue(logger->string_ids, str, &value))
+  {
+    *id = (uint32_t)((uintptr_t)value - 1);
+  }
+  else
+  {
+    if (logger->nstrings == SUN_MAX_LOGSTRINGS_) { return 1; }
+
+    rec.type   = SUN_LOGREC_STRING_;
+    rec.id     = (uint32_t)logger->nstrings;
+    rec.length = (uint32_t)strlen(str) + 1;
+    memset(rec.pad, 0, sizeof(rec.pad));
+    if (sunLoggerReserve(logger, sizeof(rec) + rec.length)) { return 1; }
+
+    copy = (char*)malloc(rec.length);
+    if (!copy) { return 1; }
+    if (logger->audit)
+    {
+      sunAllocAuditRecord(logger->audit, rec.length, __func__);
+    }
+    memcpy(copy, str, rec.length);
+    if (SUNHashMap_Insert(logger->string_ids, copy,
+                          (void*)(uintptr_t)(logger->nstrings + 1)))
+    {
+      free(copy);
+      return 1;
+    }
+    logger->strings[logger->nstrings++] = copy;
+
+    /* Strings are defined in the records before they are used */
+    memcpy(logger->records + logger->records_used, &rec, sizeof(rec));
+    memcpy(logger->records + logger->records_used + sizeof(rec), copy,
+           rec.length);
+    logger->records_used += sizeof(rec) + rec.length;
+
+    *id = rec.id;
+  }
+
+  logger->string_cache[idx].str = str;
+  logger->string_cache[idx].id  = *id;
+
+  return 0;
+}
+
+/* Add a message record with the arguments of a format string (or a formatted
+   text) to the buffer, returns 1 if it does not fit and -1 if the format has
+   conversions that cannot be deferred */
+static int sunLoggerPutMessage(SUNLogger logger, SUNLogLevel lvl, int rank,
+                               const uint32_t* ids, const char* fmt,
+                               va_list* args, const char* text)
+{
+  int retval;
+  sunLogMessageRecord rec;
+  unsigned char* start = logger->records + logger->records_used;
+  unsigned char* end   = logger->records + logger->records_size;
+  unsigned char* pos   = start + sizeof(rec);
+
+  if (logger->records_used + sizeof(rec) > logger->records_size) { return 1; }
+
+  retval = (text) ? sunPutString(&pos, end, text)
+                  : sunPutArgs(&pos, end, fmt, args);
+  if (retval) { return retval; }
+
+  rec.type   = SUN_LOGREC_MESSAGE_;
+  rec.level  = (char)lvl;
+  rec.rank   = (int32_t)rank;
+  rec.scope  = ids[0];
+  rec.label  = ids[1];
+  rec.format = ids[2];
+  rec.size   = (uint32_t)(pos - start - sizeof(rec));
+  memset(rec.pad, 0, sizeof(rec.pad));
+  memcpy(start, &rec, sizeof(rec));
+
+  logger->records_used += (size_t)(pos - start);
+
+  return 0;
+}
+
+/* Queue a deferred message, returns nonzero if the message was not queued */
+static int sunLoggerDefer(SUNLogger logger, SUNLogLevel lvl, int rank,
+                          const char* scope, const char* label,
+                          const char* msg_txt, va_list args)
+{
+  int retval;
+  uint32_t ids[3];
+  char* text = NULL;
+  va_list args_copy;
+
+  if (sunLoggerStringId(logger, scope, &ids[0]) ||
+      sunLoggerStringId(logger, label, &ids[1]) ||
+      sunLoggerStringId(logger, msg_txt, &ids[2]))
+  {
+    return 1;
+  }
+
+  va_copy(args_copy, args);
+  retval = sunLoggerPutMessage(logger, lvl, rank, ids, msg_txt, &args_copy,
+                               NULL);
+  va_end(args_copy);
+
+  if (retval > 0)
+  {
+    sunLoggerStartFlush(logger);
+    va_copy(args_copy, args);
+    retval = sunLoggerPutMessage(logger, lvl, rank, ids, msg_txt, &args_copy,
+                                 NULL);
+    va_end(args_copy);
+  }
+
+  /* Format messages that cannot be deferred now and queue the text */
+  if (retval < 0)
+  {
+    va_copy(args_copy, args);
+    retval = sunvasnprintf(&text, msg_txt, args_copy);
+    va_end(args_copy);
+    if (retval < 0) { return 1; }
+
+    retval = sunLoggerStringId(logger, "%s", &ids[2]);
+    if (!retval)
+    {
+      retval = sunLoggerPutMessage(logger, lvl, rank, ids, NULL, NULL, text);
+      if (retval > 0)
+      {
+        sunLoggerStartFlush(logger);
+        retval = sunLoggerPutMessage(logger, lvl, rank, ids, NULL, NULL, text);
+      }
+    }
+    free(text);
+  }
+
+  return retval;
+}
+
+/* Print one conversion with its '*' arguments */
+#define SUN_LOGGER_PRINT_(fp, spec, nstars, stars, value)          \
+  ((nstars) == 0   ? fprintf(fp, spec, value)                      \
+   : (nstars) == 1 ? fprintf(fp, spec, (int)stars[0], value)       \
+                   : fprintf(fp, spec, (int)stars[0], (int)stars[1], value))
+
+/* Format a message record as in sunCreateLogMessage */
+static void sunLoggerFormatRecord(SUNLogger logger, FILE* fp,
+                                  const sunLogMessageRecord* rec,
+                                  const unsigned char* args)
+{
+  int i, n, nstars;
+  char conv, mod;
+  char spec[64];
+  long long stars[2];
+  const char* fmt = logger->strings[rec->format];
+  const char* lit = fmt;
+
+  fprintf(fp, "[%s][rank %d][%s][%s] ", sunLogLevelPrefix(rec->level),
+          (int)rec->rank, logger->strings[rec->scope],
+          logger->strings[rec->label]);
+
+  while (*fmt)
+  {
+    long long ival;
+    unsigned long long uval;
+    double dval;
+    long double ldval;
+    uint32_t length;
+
+    if (*fmt != '%')
+    {
+      fmt++;
+      continue;
+    }
+
+    /* Print the text before the conversion */
+    if (fmt > lit) { fwrite(lit, 1, (size_t)(fmt - lit), fp); }
+
+    n = sunParseConversion(fmt, &conv, &mod, &nstars);
+    lit = fmt + n;
+    if (conv == '%' || n >= (int)sizeof(spec))
+    {
+      if (conv == '%') { fputc('%', fp); }
+      fmt += n;
+      continue;
+    }
+    memcpy(spec, fmt, (size_t)n);
+    spec[n] = '\0';
+    fmt += n;
+
+    for (i = 0; i < nstars; i++)
+    {
+      memcpy(&stars[i], args + 1, sizeof(long long));
+      args += 1 + sizeof(long long);
+    }
+
+    switch (*args)
+    {
+    case 'i':
+      memcpy(&ival, args + 1, sizeof(ival));
+      args += 1 + sizeof(ival);
+      if (mod == 'l') { SUN_LOGGER_PRINT_(fp, spec, nstars, stars, (long)ival); }
+      else if (mod == 'q') { SUN_LOGGER_PRINT_(fp, spec, nstars, stars, ival); }
+      else if (mod == 'z')
+      {
+        SUN_LOGGER_PRINT_(fp, spec, nstars, stars, (size_t)ival);
+      }
+      else if (mod == 'j')
+      {
+        SUN_LOGGER_PRINT_(fp, spec, nstars, stars, (intmax_t)ival);
+      }
+      else if (mod == 't')
+      {
+        SUN_LOGGER_PRINT_(fp, spec, nstars, stars, (ptrdiff_t)ival);
+      }
+      else { SUN_LOGGER_PRINT_(fp, spec, nstars, stars, (int)ival); }
+      break;
+    case 'u':
+      memcpy(&uval, args + 1, sizeof(uval));
+      args += 1 + sizeof(uval);
+      if (mod == 'l')
+      {
+        SUN_LOGGER_PRINT_(fp, spec, nstars, stars, (unsigned long)uval);
+      }
+      else if (mod == 'q') { SUN_LOGGER_PRINT_(fp, spec, nstars, stars, uval); }
+      else if (mod == 'z')
+      {
+        SUN_LOGGER_PRINT_(fp, spec, nstars, stars, (size_t)uval);
+      }
+      else if (mod == 'j')
+      {
+        SUN_LOGGER_PRINT_(fp, spec, nstars, stars, (uintmax_t)uval);
+      }
+      else if (mod == 't')
+      {
+        SUN_LOGGER_PRINT_(fp, spec, nstars, stars, (ptrdiff_t)uval);
+      }
+      else { SUN_LOGGER_PRINT_(fp, spec, nstars, stars, (unsigned int)uval); }
+      break;
+    case 'd':
+      memcpy(&dval, args + 1, sizeof(dval));
+      args += 1 + sizeof(dval);
+      SUN_LOGGER_PRINT_(fp, spec, nstars, stars, dval);
+      break;
+    case 'L':
+      memcpy(&ldval, args + 1, sizeof(ldval));
+      args += 1 + sizeof(ldval);
+      SUN_LOGGER_PRINT_(fp, spec, nstars, stars, ldval);
+      break;
+    case 's':
+      memcpy(&length, args + 1, sizeof(length));
+      SUN_LOGGER_PRINT_(fp, spec, nstars, stars,
+                        (const char*)(args + 1 + sizeof(length)));
+      args += 1 + sizeof(length) + length;
+      break;
+    case 'p':
+      memcpy(&uval, args + 1, sizeof(uval));
+      args += 1 + sizeof(uval);
+      SUN_LOGGER_PRINT_(fp, spec, nstars, stars, (void*)(uintptr_t)uval);
+      break;
+    }
+  }
+
+  if (fmt > lit) { fwrite(lit, 1, (size_t)(fmt - lit), fp); }
+  fputc('\n', fp);
+}
+
+/* Format buffered messages, or write them to the binary log file */
+static void sunLoggerWriteRecords(SUNLogger logger,
+                                  const unsigned char* records, size_t used)
+{
+  size_t pos = 0;
+
+  if (logger->binary_fp)
+  {
+    fwrite(records, 1, used, logger->binary_fp);
+    return;
+  }
+
+  while (pos < used)
+  {
+    if (records[pos] == SUN_LOGREC_STRING_)
+    {
+      sunLogStringRecord rec;
+      memcpy(&rec, records + pos, sizeof(rec));
+      pos += sizeof(rec) + rec.length;
+    }
+    else
+    {
+      FILE* fp = NULL;
+      sunLogMessageRecord rec;
+      memcpy(&rec, records + pos, sizeof(rec));
+
+      switch (rec.level)
+      {
+      case (SUN_LOGLEVEL_DEBUG): fp = logger->debug_fp; break;
+      case (SUN_LOGLEVEL_WARNING): fp = logger->warning_fp; break;
+      case (SUN_LOGLEVEL_INFO): fp = logger->info_fp; break;
+      case (SUN_LOGLEVEL_ERROR): fp = logger->error_fp; break;
+      }
+      if (fp)
+      {
+        sunLoggerFormatRecord(logger, fp, &rec, records + pos + sizeof(rec));
+      }
+      pos += sizeof(rec) + rec.size;
+    }
+  }
+}
+
+#if defined(SUNDIALS_ENABLE_ASYNC_OUTPUT)
+
+static void* sunLoggerFlushThread(void* arg)
+{
+  SUNLogger logger = (SUNLogger)arg;
+
+  sunMutexLock(&logger->flush_mutex);
+  for (;;)
+  {
+    while (!logger->flush_used && !logger->flush_stop)
+    {
+      sunCondWait(&logger->flush_work, &logger->flush_mutex);
+    }
+    if (!logger->flush_used) { break; }
+    sunMutexUnlock(&logger->flush_mutex);
+
+    /* The records are not touched by the calling thread until flush_used is
+       reset */
+    sunLoggerWriteRecords(logger, logger->flush_records, logger->flush_used);
+
+    sunMutexLock(&logger->flush_mutex);
+    logger->flush_used = 0;
+    sunCondSignal(&logger->flush_done);
+  }
+  sunMutexUnlock(&logger->flush_mutex);
+
+  return NULL;
+}
+
+/* Wait until the flush thread has written the records handed off to it */
+static void sunLoggerWaitFlush(SUNLogger logger)
+{
+  sunMutexLock(&logger->flush_mutex);
+  while (logger->flush_used)
+  {
+    sunCondWait(&logger->flush_done, &logger->flush_mutex);
+  }
+  sunMutexUnlock(&logger->flush_mutex);
+}
+
+#endif
+
+/* Hand the buffered messages off to the flush thread, or write them now if
+   there is no flush thread */
+static void sunLoggerStartFlush(SUNLogger logger)
+{
+  if (!logger->records_used) { return; }
+
+#if defined(SUNDIALS_ENABLE_ASYNC_OUTPUT)
+  if (logger->flush_records)
+  {
+    unsigned char* records = NULL;
+
+    sunMutexLock(&logger->flush_mutex);
+    while (logger->flush_used)
+    {
+      sunCondWait(&logger->flush_done, &logger->flush_mutex);
+    }
+    records               = logger->flush_records;
+    logger->flush_records = logger->records;
+    logger->flush_used    = logger->records_used;
+    logger->records       = records;
+    logger->records_used  = 0;
+    sunCondSignal(&logger->flush_work);
+    sunMutexUnlock(&logger->flush_mutex);
+    return;
+  }
+#endif
+
+  sunLoggerWriteRecords(logger, logger->records, logger->records_used);
+  logger->records_used = 0;
+}
+
+/* Format the buffered messages, or write them to the binary log file, and
+   wait until all of them have been written */
+static void sunLoggerFlushDeferred(SUNLogger logger)
+{
+  sunLoggerStartFlush(logger);
+#if defined(SUNDIALS_ENABLE_ASYNC_OUTPUT)
+  if (logger->flush_records) { sunLoggerWaitFlush(logger); }
+#endif
+}
+
+static void sunLoggerFreeDeferred(SUNLogger logger)
+{
+  int i;
+
+  if (!logger->records) { return; }
+
+  sunLoggerFlushDeferred(logger);
+#if defined(SUNDIALS_ENABLE_ASYNC_OUTPUT)
+  if (logger->flush_records)
+  {
+    sunMutexLock(&logger->flush_mutex);
+    logger->flush_stop = SUNTRUE;
+    sunCondSignal(&logger->flush_work);
+    sunMutexUnlock(&logger->flush_mutex);
+
+    sunThreadJoin(logger->flush_thread);
+    sunCondDestroy(&logger->flush_done);
+    sunCondDestroy(&logger->flush_work);
+    sunMutexDestroy(&logger->flush_mutex);
+    free(logger->flush_records);
+    logger->flush_records = NULL;
+  }
+#endif
+  if (logger->string_ids)
+  {
+    SUNHashMap_Destroy(&logger->string_ids, sunLoggerNoFree);
+  }
+  for (i = 0; i < logger->nstrings; i++) { free(logger->strings[i]); }
+  free(logger->strings);
+  free(logger->string_cache);
+  free(logger->records);
+  logger->strings      = NULL;
+  logger->string_cache = NULL;
+  logger->records      = NULL;
+  logger->nstrings     = 0;
+}
+
+#endif
+
 SUNErrCode SUNLogger_Create(SUNComm comm, int output_rank, SUNLogger* logger_ptr)
 {
   SUNLogger logger = NULL;
@@ -126,6 +844,15 @@ SUNErrCode SUNLogger_Create(SUNComm comm, int output_rank, SUNLogger* logger_ptr
   *logger_ptr = logger = (SUNLogger)malloc(sizeof(struct SUNLogger_));
   if (logger == NULL) { return SUN_ERR_MALLOC_FAIL; }
 
+#if defined(SUNDIALS_ENABLE_THREAD_SAFE_CONTEXT)
+  if (sunMutexInit(&logger->lock))
+  {
+    free(logger);
+    *logger_ptr = NULL;
+    return SUN_ERR_OP_FAIL;
+  }
+#endif
+
   /* Attach the comm, duplicating it if MPI is used. */
 #if SUNDIALS_MPI_ENABLED
   logger->comm = SUN_COMM_NULL;
@@ -140,6 +867,21 @@ SUNErrCode SUNLogger_Create(SUNComm comm, int output_rank, SUNLogger* logger_ptr
 #endif
   logger->output_rank = output_rank;
   logger->content     = NULL;
+  logger->audit       = NULL;
+
+  /* deferred logging is disabled by default */
+  logger->records      = NULL;
+  logger->records_size = 0;
+  logger->records_used = 0;
+  logger->binary_fp    = NULL;
+  logger->string_ids   = NULL;
+  logger->strings      = NULL;
+  logger->nstrings     = 0;
+  logger->string_cache = NULL;
+#if defined(SUNDIALS_ENABLE_ASYNC_OUTPUT)
+  logger->flush_records = NULL;
+  logger->flush_used    = 0;
+#endif
 
   /* use default routines */
   logger->queuemsg = NULL;
@@ -174,6 +916,9 @@ SUNErrCode SUNLogger_CreateFromEnv(SUNComm comm, SUNLogger* logger_out)
   const char* warning_fname_env = getenv("SUNLOGGER_WARNING_FILENAME");
   const char* info_fname_env    = getenv("SUNLOGGER_INFO_FILENAME");
   const char* debug_fname_env   = getenv("SUNLOGGER_DEBUG_FILENAME");
+  const char* binary_fname_env  = getenv("SUNLOGGER_BINARY_FILENAME");
+  const char* deferred_env      = getenv("SUNLOGGER_DEFERRED");
+  long buffer_size              = (deferred_env) ? atol(deferred_env) : 0;
 
   if (SUNLogger_Create(comm, output_rank, &logger))
   {
@@ -189,6 +934,14 @@ SUNErrCode SUNLogger_CreateFromEnv(SUNComm comm, SUNLogger* logger_out)
     err = SUNLogger_SetDebugFilename(logger, debug_fname_env);
     if (err) { break; }
     err = SUNLogger_SetInfoFilename(logger, info_fname_env);
+    if (err) { break; }
+    if (buffer_size)
+    {
+      /* 1 enables deferred logging with the default buffer size */
+      err = SUNLogger_EnableDeferred(logger, (buffer_size > 1) ? buffer_size : 0);
+      if (err) { break; }
+    }
+    err = SUNLogger_SetBinaryFilename(logger, binary_fname_env);
   }
   while (0);
 
@@ -269,6 +1022,10 @@ SUNErrCode SUNLogger_SetInfoFilename(SUNLogger logger, const char* info_filename
   {
 #if SUNDIALS_LOGGING_LEVEL >= SUNDIALS_LOGGING_INFO
     FILE* fp = NULL;
+
+    /* Deferred messages go to the current file */
+    if (logger->records) { sunLoggerFlushDeferred(logger); }
+
     if (!SUNHashMap_GetValue(logger->filenames, info_filename, (void*)&fp))
     {
       logger->info_fp = fp;
@@ -319,6 +1076,147 @@ SUNErrCode SUNLogger_SetDebugFilename(SUNLogger logger, const char* debug_filena
   return SUN_SUCCESS;
 }
 
+SUNErrCode SUNLogger_EnableDeferred(SUNLogger logger, long buffer_size)
+{
+  if (!logger) { return SUN_ERR_ARG_CORRUPT; }
+
+  if (!sunLoggerIsOutputRank(logger, NULL)) { return SUN_SUCCESS; }
+
+#if SUNDIALS_LOGGING_LEVEL >= SUNDIALS_LOGGING_INFO
+  if (buffer_size <= 0) { buffer_size = SUN_LOGGER_BUFFER_SIZE_; }
+  if (buffer_size < SUN_LOGGER_MIN_BUFFER_SIZE_)
+  {
+    buffer_size = SUN_LOGGER_MIN_BUFFER_SIZE_;
+  }
+
+  /* Resize the buffer, keeping the interned strings */
+  if (logger->records)
+  {
+    unsigned char* records = NULL;
+    sunLoggerFlushDeferred(logger);
+    records = (unsigned char*)realloc(logger->records, (size_t)buffer_size);
+    if (!records) { return SUN_ERR_MALLOC_FAIL; }
+    logger->records = records;
+#if defined(SUNDIALS_ENABLE_ASYNC_OUTPUT)
+    /* The flush thread is idle after the flush above */
+    if (logger->flush_records)
+    {
+      records = (unsigned char*)realloc(logger->flush_records,
+                                        (size_t)buffer_size);
+      if (!records) { return SUN_ERR_MALLOC_FAIL; }
+      logger->flush_records = records;
+    }
+#endif
+    logger->records_size = (size_t)buffer_size;
+    return SUN_SUCCESS;
+  }
+
+  logger->records      = (unsigned char*)malloc((size_t)buffer_size);
+  logger->strings      = (char**)malloc(SUN_MAX_LOGSTRINGS_ * sizeof(char*));
+  logger->string_cache = (sunLogStringCacheEntry*)
+    calloc(SUN_LOGSTRING_CACHE_SIZE_, sizeof(sunLogStringCacheEntry));
+  if (!logger->records || !logger->strings || !logger->string_cache ||
+      SUNHashMap_New(SUN_MAX_LOGSTRINGS_, &logger->string_ids))
+  {
+    free(logger->records);
+    free(logger->strings);
+    free(logger->string_cache);
+    logger->records      = NULL;
+    logger->strings      = NULL;
+    logger->string_cache = NULL;
+    return SUN_ERR_MALLOC_FAIL;
+  }
+  logger->records_size = (size_t)buffer_size;
+  logger->records_used = 0;
+  logger->nstrings     = 0;
+
+#if defined(SUNDIALS_ENABLE_ASYNC_OUTPUT)
+  /* Start the flush thread, if any step fails the buffer is flushed by the
+     calling thread instead */
+  logger->flush_records = (unsigned char*)malloc((size_t)buffer_size);
+  logger->flush_used    = 0;
+  logger->flush_stop    = SUNFALSE;
+  if (logger->flush_records)
+  {
+    int failed = 1;
+    if (!sunMutexInit(&logger->flush_mutex))
+    {
+      if (!sunCondInit(&logger->flush_work))
+      {
+        if (!sunCondInit(&logger->flush_done))
+        {
+          failed = sunThreadCreate(&logger->flush_thread, sunLoggerFlushThread,
+                                   logger);
+          if (failed) { sunCondDestroy(&logger->flush_done); }
+        }
+        if (failed) { sunCondDestroy(&logger->flush_work); }
+      }
+      if (failed) { sunMutexDestroy(&logger->flush_mutex); }
+    }
+    if (failed)
+    {
+      free(logger->flush_records);
+      logger->flush_records = NULL;
+    }
+  }
+#endif
+#else
+  /* silence warnings when info logging is disabled */
+  ((void)buffer_size);
+#endif
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNLogger_SetBinaryFilename(SUNLogger logger,
+                                       const char* binary_filename)
+{
+  if (!logger) { return SUN_ERR_ARG_CORRUPT; }
+
+  if (!sunLoggerIsOutputRank(logger, NULL)) { return SUN_SUCCESS; }
+
+  if (binary_filename && strcmp(binary_filename, ""))
+  {
+#if SUNDIALS_LOGGING_LEVEL >= SUNDIALS_LOGGING_INFO
+    int i;
+    SUNErrCode err;
+    sunLogFileHeader header;
+    sunLogStringRecord rec;
+
+    if (!logger->records)
+    {
+      err = SUNLogger_EnableDeferred(logger, 0);
+      if (err) { return err; }
+    }
+
+    /* Finish the current file */
+    sunLoggerFlushDeferred(logger);
+    if (logger->binary_fp) { fclose(logger->binary_fp); }
+
+    logger->binary_fp = fopen(binary_filename, "wb");
+    if (!logger->binary_fp) { return SUN_ERR_FILE_OPEN; }
+
+    memcpy(header.magic, SUN_LOGFILE_MAGIC_, sizeof(header.magic));
+    header.byte_order       = 0x01020304;
+    header.long_double_size = (uint32_t)sizeof(long double);
+    fwrite(&header, sizeof(header), 1, logger->binary_fp);
+
+    /* Define the strings interned so far in the new file */
+    rec.type = SUN_LOGREC_STRING_;
+    memset(rec.pad, 0, sizeof(rec.pad));
+    for (i = 0; i < logger->nstrings; i++)
+    {
+      rec.id     = (uint32_t)i;
+      rec.length = (uint32_t)strlen(logger->strings[i]) + 1;
+      fwrite(&rec, sizeof(rec), 1, logger->binary_fp);
+      fwrite(logger->strings[i], 1, rec.length, logger->binary_fp);
+    }
+#endif
+  }
+
+  return SUN_SUCCESS;
+}
+
 SUNErrCode SUNLogger_QueueMsg(SUNLogger logger, SUNLogLevel lvl,
                               const char* scope, const char* label,
                               const char* msg_txt, ...)
@@ -346,30 +1244,55 @@ SUNErrCode SUNLogger_QueueMsg(SUNLogger logger, SUNLogLevel lvl,
       int rank = 0;
       if (sunLoggerIsOutputRank(logger, &rank))
       {
+        FILE* fp      = NULL;
         char* log_msg = NULL;
-        sunCreateLogMessage(lvl, rank, scope, label, msg_txt, args, &log_msg);
+
+#if defined(SUNDIALS_ENABLE_THREAD_SAFE_CONTEXT)
+        /* Messages from different threads are written one at a time */
+        sunMutexLock(&logger->lock);
+#endif
 
         switch (lvl)
         {
-        case (SUN_LOGLEVEL_DEBUG):
-          if (logger->debug_fp) { fprintf(logger->debug_fp, "%s", log_msg); }
-          break;
-        case (SUN_LOGLEVEL_WARNING):
-          if (logger->warning_fp)
+        case (SUN_LOGLEVEL_DEBUG): fp = logger->debug_fp; break;
+        case (SUN_LOGLEVEL_WARNING): fp = logger->warning_fp; break;
+        case (SUN_LOGLEVEL_INFO): fp = logger->info_fp; break;
+        case (SUN_LOGLEVEL_ERROR): fp = logger->error_fp; break;
+        default: retval = SUN_ERR_UNREACHABLE;
+        }
+
+#if SUNDIALS_LOGGING_LEVEL >= SUNDIALS_LOGGING_INFO
+        if (logger->records)
+        {
+          /* Info messages are deferred. Other messages written to the file
+             of the deferred messages are written after them to keep the order
+             of the output. */
+          if (lvl == SUN_LOGLEVEL_INFO && (fp || logger->binary_fp) &&
+              !sunLoggerDefer(logger, lvl, rank, scope, label, msg_txt, args))
           {
-            fprintf(logger->warning_fp, "%s", log_msg);
+            fp = NULL;
           }
-          break;
-        case (SUN_LOGLEVEL_INFO):
-          if (logger->info_fp) { fprintf(logger->info_fp, "%s", log_msg); }
-          break;
-        case (SUN_LOGLEVEL_ERROR):
-          if (logger->error_fp) { fprintf(logger->error_fp, "%s", log_msg); }
-          break;
-        default: retval = SUN_ERR_UNREACHABLE;
+          else if (fp && fp == logger->info_fp && !logger->binary_fp)
+          {
+            sunLoggerFlushDeferred(logger);
+          }
+        }
+#endif
+
+        if (fp)
+        {
+          sunCreateLogMessage(lvl, rank, scope, label, msg_txt, args, &log_msg);
+          if (logger->audit && log_msg)
+          {
+            sunAllocAuditRecord(logger->audit, strlen(log_msg) + 1, __func__);
+          }
+          fprintf(fp, "%s", log_msg);
+          free(log_msg);
         }
 
-        free(log_msg);
+#if defined(SUNDIALS_ENABLE_THREAD_SAFE_CONTEXT)
+        sunMutexUnlock(&logger->lock);
+#endif
       }
     }
 
@@ -404,6 +1327,18 @@ SUNErrCode SUNLogger_Flush(SUNLogger logger, SUNLogLevel lvl)
     /* Default implementation */
     if (sunLoggerIsOutputRank(logger, NULL))
     {
+#if defined(SUNDIALS_ENABLE_THREAD_SAFE_CONTEXT)
+      sunMutexLock(&logger->lock);
+#endif
+#if SUNDIALS_LOGGING_LEVEL >= SUNDIALS_LOGGING_INFO
+      if (logger->records &&
+          (lvl == SUN_LOGLEVEL_INFO || lvl == SUN_LOGLEVEL_ALL))
+      {
+        sunLoggerFlushDeferred(logger);
+        if (logger->binary_fp) { fflush(logger->binary_fp); }
+      }
+#endif
+
       switch (lvl)
       {
       case (SUN_LOGLEVEL_DEBUG):
@@ -426,6 +1361,9 @@ SUNErrCode SUNLogger_Flush(SUNLogger logger, SUNLogLevel lvl)
         break;
       default: retval = SUN_ERR_UNREACHABLE;
       }
+#if defined(SUNDIALS_ENABLE_THREAD_SAFE_CONTEXT)
+      sunMutexUnlock(&logger->lock);
+#endif
     }
   }
 #else
@@ -459,6 +1397,10 @@ SUNErrCode SUNLogger_Destroy(SUNLogger* logger_ptr)
 
     if (sunLoggerIsOutputRank(logger, NULL))
     {
+#if SUNDIALS_LOGGING_LEVEL >= SUNDIALS_LOGGING_INFO
+      sunLoggerFreeDeferred(logger);
+      if (logger->binary_fp) { fclose(logger->binary_fp); }
+#endif
       SUNHashMap_Destroy(&logger->filenames, sunCloseLogFile);
     }
 
@@ -466,6 +1408,10 @@ SUNErrCode SUNLogger_Destroy(SUNLogger* logger_ptr)
     if (logger->comm != SUN_COMM_NULL) { MPI_Comm_free(&logger->comm); }
 #endif
 
+#if defined(SUNDIALS_ENABLE_THREAD_SAFE_CONTEXT)
+    sunMutexDestroy(&logger->lock);
+#endif
+
     free(logger);
     logger = NULL;
   }
@@ -18,10 +18,13 @@
 #define _SUNDIALS_LOGGER_IMPL_H
 
 #include <stdarg.h>
+#include <stdint.h>
+#include <sundials/priv/sundials_allocaudit_impl.h>
 #include <sundials/sundials_logger.h>
 #include <sundials/sundials_types.h>
 
 #include "sundials_hashmap_impl.h"
+#include "sundials_threads_impl.h"
 #include "sundials_utils.h"
 
 #define SUNDIALS_LOGGING_ERROR   1
@@ -32,6 +35,13 @@
 #define SUNDIALS_LOGGING_EXTRA_DEBUG
 #endif
 
+/* Entry in the cache of interned strings used by deferred logging */
+typedef struct sunLogStringCacheEntry_
+{
+  const char* str;
+  uint32_t id;
+} sunLogStringCacheEntry;
+
 struct SUNLogger_
 {
   /* MPI information */
@@ -50,6 +60,36 @@ struct SUNLogger_
   /* Slic-style format string */
   const char* format;
 
+  /* Deferred logging, buffered binary records of info messages */
+  unsigned char* records;
+  size_t records_size;
+  size_t records_used;
+  FILE* binary_fp;
+  SUNHashMap string_ids;
+  char** strings;
+  int nstrings;
+  sunLogStringCacheEntry* string_cache;
+
+#if defined(SUNDIALS_ENABLE_ASYNC_OUTPUT)
+  /* Background flush of the deferred records, a full buffer is swapped with
+     flush_records and formatted (or written) by the flush thread */
+  unsigned char* flush_records; /* records owned by the flush thread      */
+  size_t flush_used;            /* size of the records, 0 when idle       */
+  sunbooleantype flush_stop;    /* the flush thread should exit           */
+  sunMutex flush_mutex;         /* protects flush_used and flush_stop     */
+  sunCond flush_work;           /* signaled when records are handed off   */
+  sunCond flush_done;           /* signaled when the records are written  */
+  sunThread flush_thread;       /* flush thread                           */
+#endif
+
+  /* Allocation audit of the context using this logger (NULL if off) */
+  sunAllocAudit audit;
+
+#if defined(SUNDIALS_ENABLE_THREAD_SAFE_CONTEXT)
+  /* Serializes the output of the default implementation */
+  sunMutex lock;
+#endif
+
   /* Content for custom implementations */
   void* content;
 
@@ -51,17 +51,20 @@ SUNMatrix SUNMatNewEmpty(SUNContext sunctx)
   ops = (SUNMatrix_Ops)malloc(sizeof *ops);
   SUNAssertNull(ops, SUN_ERR_MALLOC_FAIL);
 
+  SUNAllocAuditRecord(sunctx, sizeof *A + sizeof *ops);
+
   /* initialize operations to NULL */
-  ops->getid       = NULL;
-  ops->clone       = NULL;
-  ops->destroy     = NULL;
-  ops->zero        = NULL;
-  ops->copy        = NULL;
-  ops->scaleadd    = NULL;
-  ops->scaleaddi   = NULL;
-  ops->matvecsetup = NULL;
-  ops->matvec      = NULL;
-  ops->space       = NULL;
+  ops->getid        = NULL;
+  ops->clone        = NULL;
+  ops->destroy      = NULL;
+  ops->zero         = NULL;
+  ops->copy         = NULL;
+  ops->scaleadd     = NULL;
+  ops->scaleaddi    = NULL;
+  ops->matvecsetup  = NULL;
+  ops->matvec       = NULL;
+  ops->space        = NULL;
+  ops->writecapture = NULL;
 
   /* attach ops and initialize content to NULL */
   A->ops     = ops;
@@ -100,16 +103,17 @@ SUNErrCode SUNMatCopyOps(SUNMatrix A, SUNMatrix B)
   SUNAssert(B && B->ops, SUN_ERR_ARG_CORRUPT);
 
   /* Copy ops from A to B */
-  B->ops->getid       = A->ops->getid;
-  B->ops->clone       = A->ops->clone;
-  B->ops->destroy     = A->ops->destroy;
-  B->ops->zero        = A->ops->zero;
-  B->ops->copy        = A->ops->copy;
-  B->ops->scaleadd    = A->ops->scaleadd;
-  B->ops->scaleaddi   = A->ops->scaleaddi;
-  B->ops->matvecsetup = A->ops->matvecsetup;
-  B->ops->matvec      = A->ops->matvec;
-  B->ops->space       = A->ops->space;
+  B->ops->getid        = A->ops->getid;
+  B->ops->clone        = A->ops->clone;
+  B->ops->destroy      = A->ops->destroy;
+  B->ops->zero         = A->ops->zero;
+  B->ops->copy         = A->ops->copy;
+  B->ops->scaleadd     = A->ops->scaleadd;
+  B->ops->scaleaddi    = A->ops->scaleaddi;
+  B->ops->matvecsetup  = A->ops->matvecsetup;
+  B->ops->matvec       = A->ops->matvec;
+  B->ops->space        = A->ops->space;
+  B->ops->writecapture = A->ops->writecapture;
 
   return (0);
 }
@@ -0,0 +1,476 @@
+/* -----------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the implementation of the Matrix Market coordinate file
+ * reader and writer used by the SUNMatrix modules.
+ * -----------------------------------------------------------------*/
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <sundials/priv/sundials_matrixmarket_impl.h>
+#include <sundials/sundials_config.h>
+#include <sundials/sundials_errors.h>
+#include <sundials/sundials_math.h>
+#include <sundials/sundials_types.h>
+
+#include "sundials_threads_impl.h"
+
+#if defined(SUNDIALS_ENABLE_THREADED_MATRIX_READ)
+#define SUN_MM_THREADS
+#endif
+
+#define ONE SUN_RCONST(1.0)
+
+/* Largest value of a sunindextype */
+#define SUN_MM_INDEX_MAX \
+  ((long long)((1ULL << (8 * sizeof(sunindextype) - 1)) - 1))
+
+/* Size of the blocks used to read the file */
+#define SUN_MM_BLOCK (1 << 20)
+
+/* Smallest part of the entries (in bytes) given to a thread */
+#define SUN_MM_MIN_CHUNK (1 << 20)
+
+/*
+  Parsing
+
+  The file is read into memory and the banner and size line are parsed.
+  The entries that follow are split into chunks that start at the beginning
+  of a line. The entries in each chunk are counted, the counts give the
+  offset of each chunk in the output arrays, and each chunk is then parsed
+  into its part of the arrays. With SUNDIALS_ENABLE_THREADED_MATRIX_READ, the
+  chunks are counted and parsed in parallel. The text is only read, so threads
+  may look past the end of their chunk.
+ */
+
+typedef struct
+{
+  const char* begin;       /* first character of the chunk          */
+  const char* end;         /* one past the last character           */
+  sunindextype count;      /* number of entries in the chunk        */
+  sunindextype offset;     /* index of the first entry in the chunk */
+  sunbooleantype pattern;  /* the file has no values                */
+  sunMatrixMarketCOO* coo; /* output arrays                         */
+  SUNErrCode err;          /* first error in the chunk              */
+} sunMMChunk;
+
+typedef void* (*sunMMChunkFn)(void*);
+
+/* Returns the end of the line starting at p (the newline or end) */
+static const char* sunMMLineEnd(const char* p, const char* end)
+{
+  const char* eol = (const char*)memchr(p, '\n', (size_t)(end - p));
+  return eol ? eol : end;
+}
+
+/* Returns true if the line has an entry (not blank and not a comment) */
+static sunbooleantype sunMMIsEntry(const char* p, const char* eol)
+{
+  while (p < eol && isspace((unsigned char)*p)) { p++; }
+  return (p < eol && *p != '%') ? SUNTRUE : SUNFALSE;
+}
+
+/* Parse an integer that must end before eol */
+static int sunMMParseIndex(const char** p, const char* eol, long long* value)
+{
+  char* q;
+  *value = strtoll(*p, &q, 10);
+  if (q == *p || q > eol) { return 1; }
+  *p = q;
+  return 0;
+}
+
+/* Parse a real number that must end before eol */
+static int sunMMParseReal(const char** p, const char* eol, sunrealtype* value)
+{
+  char* q;
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+  *value = strtold(*p, &q);
+#else
+  *value = (sunrealtype)strtod(*p, &q);
+#endif
+  if (q == *p || q > eol) { return 1; }
+  *p = q;
+  return 0;
+}
+
+static void* sunMMCountChunk(void* arg)
+{
+  sunMMChunk* chunk = (sunMMChunk*)arg;
+  const char* p     = chunk->begin;
+  const char* eol;
+
+  chunk->count = 0;
+  while (p < chunk->end)
+  {
+    eol = sunMMLineEnd(p, chunk->end);
+    if (sunMMIsEntry(p, eol)) { chunk->count++; }
+    p = eol + (eol < chunk->end);
+  }
+
+  return NULL;
+}
+
+static void* sunMMParseChunk(void* arg)
+{
+  sunMMChunk* chunk       = (sunMMChunk*)arg;
+  sunMatrixMarketCOO* coo = chunk->coo;
+  sunindextype k          = chunk->offset;
+  const char* p           = chunk->begin;
+  const char* eol;
+  long long i, j;
+
+  while (p < chunk->end)
+  {
+    eol = sunMMLineEnd(p, chunk->end);
+    if (sunMMIsEntry(p, eol))
+    {
+      if (sunMMParseIndex(&p, eol, &i) || sunMMParseIndex(&p, eol, &j))
+      {
+        chunk->err = SUN_ERR_CORRUPT;
+        return NULL;
+      }
+      if (i < 1 || i > coo->rows || j < 1 || j > coo->cols)
+      {
+        chunk->err = SUN_ERR_OUTOFRANGE;
+        return NULL;
+      }
+      coo->row[k] = (sunindextype)(i - 1);
+      coo->col[k] = (sunindextype)(j - 1);
+      if (chunk->pattern) { coo->val[k] = ONE; }
+      else if (sunMMParseReal(&p, eol, &coo->val[k]))
+      {
+        chunk->err = SUN_ERR_CORRUPT;
+        return NULL;
+      }
+      k++;
+    }
+    p = eol + (eol < chunk->end);
+  }
+
+  return NULL;
+}
+
+/* Apply fn to every chunk, in parallel when threads are available */
+static void sunMMRunChunks(sunMMChunk* chunks, int nchunks, sunMMChunkFn fn)
+{
+  int c;
+#if defined(SUN_MM_THREADS)
+  sunThread* threads = NULL;
+  int nstarted       = 0;
+
+  if (nchunks > 1)
+  {
+    threads = (sunThread*)malloc((nchunks - 1) * sizeof(*threads));
+  }
+  if (threads)
+  {
+    /* The calling thread handles the first chunk and any chunk whose
+       thread could not be started */
+    for (c = 1; c < nchunks; c++)
+    {
+      if (sunThreadCreate(&threads[nstarted], fn, &chunks[c])) { break; }
+      nstarted++;
+    }
+    for (c = nstarted + 1; c < nchunks; c++) { fn(&chunks[c]); }
+    fn(&chunks[0]);
+    for (c = 0; c < nstarted; c++) { sunThreadJoin(threads[c]); }
+    free(threads);
+    return;
+  }
+#endif
+  for (c = 0; c < nchunks; c++) { fn(&chunks[c]); }
+}
+
+/* Read from the current position to the end of the file into a null
+   terminated buffer */
+static SUNErrCode sunMMReadAll(FILE* infile, char** buf, size_t* len)
+{
+  size_t capacity = SUN_MM_BLOCK;
+  size_t nread;
+  char* tmp;
+
+  *len = 0;
+  *buf = (char*)malloc(capacity + 1);
+  if (*buf == NULL) { return SUN_ERR_MALLOC_FAIL; }
+
+  for (;;)
+  {
+    nread = fread(*buf + *len, 1, capacity - *len, infile);
+    *len += nread;
+    if (*len < capacity) { break; }
+    capacity *= 2;
+    tmp = (char*)realloc(*buf, capacity + 1);
+    if (tmp == NULL)
+    {
+      free(*buf);
+      *buf = NULL;
+      return SUN_ERR_MALLOC_FAIL;
+    }
+    *buf = tmp;
+  }
+  if (ferror(infile))
+  {
+    free(*buf);
+    *buf = NULL;
+    return SUN_ERR_OP_FAIL;
+  }
+  (*buf)[*len] = '\0';
+
+  return SUN_SUCCESS;
+}
+
+/* Lower case copy of the next word on the line */
+static const char* sunMMNextWord(const char* p, const char* eol, char* word,
+                                 size_t size)
+{
+  size_t n = 0;
+  while (p < eol && isspace((unsigned char)*p)) { p++; }
+  while (p < eol && !isspace((unsigned char)*p))
+  {
+    if (n + 1 < size) { word[n++] = (char)tolower((unsigned char)*p); }
+    p++;
+  }
+  word[n] = '\0';
+  return p;
+}
+
+/* Parse the banner line, returns the data type and symmetry */
+static SUNErrCode sunMMParseBanner(const char* p, const char* eol,
+                                   sunbooleantype* pattern,
+                                   sunbooleantype* symmetric)
+{
+  char word[32];
+
+  p = sunMMNextWord(p, eol, word, sizeof(word));
+  if (strcmp(word, "%%matrixmarket")) { return SUN_ERR_CORRUPT; }
+
+  /* Only sparse (coordinate) real matrices are supported */
+  p = sunMMNextWord(p, eol, word, sizeof(word));
+  if (strcmp(word, "matrix")) { return SUN_ERR_ARG_INCOMPATIBLE; }
+  p = sunMMNextWord(p, eol, word, sizeof(word));
+  if (strcmp(word, "coordinate")) { return SUN_ERR_ARG_INCOMPATIBLE; }
+
+  p = sunMMNextWord(p, eol, word, sizeof(word));
+  if (!strcmp(word, "pattern")) { *pattern = SUNTRUE; }
+  else if (!strcmp(word, "real") || !strcmp(word, "integer"))
+  {
+    *pattern = SUNFALSE;
+  }
+  else { return SUN_ERR_ARG_INCOMPATIBLE; }
+
+  p = sunMMNextWord(p, eol, word, sizeof(word));
+  if (!strcmp(word, "symmetric")) { *symmetric = SUNTRUE; }
+  else if (!strcmp(word, "general")) { *symmetric = SUNFALSE; }
+  else { return SUN_ERR_ARG_INCOMPATIBLE; }
+
+  return SUN_SUCCESS;
+}
+
+/* Add the transpose of the off-diagonal entries of a symmetric matrix */
+static SUNErrCode sunMMExpandSymmetric(sunMatrixMarketCOO* coo)
+{
+  sunindextype k, n, noff = 0;
+  sunindextype* row;
+  sunindextype* col;
+  sunrealtype* val;
+
+  for (k = 0; k < coo->nnz; k++) { noff += (coo->row[k] != coo->col[k]); }
+  if (noff == 0) { return SUN_SUCCESS; }
+
+  n   = coo->nnz + noff;
+  row = (sunindextype*)realloc(coo->row, n * sizeof(sunindextype));
+  if (row == NULL) { return SUN_ERR_MALLOC_FAIL; }
+  coo->row = row;
+  col      = (sunindextype*)realloc(coo->col, n * sizeof(sunindextype));
+  if (col == NULL) { return SUN_ERR_MALLOC_FAIL; }
+  coo->col = col;
+  val      = (sunrealtype*)realloc(coo->val, n * sizeof(sunrealtype));
+  if (val == NULL) { return SUN_ERR_MALLOC_FAIL; }
+  coo->val = val;
+
+  n = coo->nnz;
+  for (k = 0; k < coo->nnz; k++)
+  {
+    if (row[k] == col[k]) { continue; }
+    row[n] = col[k];
+    col[n] = row[k];
+    val[n] = val[k];
+    n++;
+  }
+  coo->nnz = n;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode sunMatrixMarketRead(FILE* infile, int nthreads,
+                               sunMatrixMarketCOO* coo)
+{
+  SUNErrCode err = SUN_SUCCESS;
+  char* buf      = NULL;
+  size_t len;
+  const char *p, *eol, *end;
+  sunbooleantype pattern, symmetric;
+  long long rows, cols, nnz;
+  sunMMChunk* chunks = NULL;
+  sunindextype total;
+  int c, nchunks;
+
+  if (infile == NULL || coo == NULL) { return SUN_ERR_ARG_CORRUPT; }
+
+  memset(coo, 0, sizeof(*coo));
+
+  err = sunMMReadAll(infile, &buf, &len);
+  if (err) { return err; }
+  end = buf + len;
+
+  /* Banner */
+  eol = sunMMLineEnd(buf, end);
+  err = sunMMParseBanner(buf, eol, &pattern, &symmetric);
+  if (err)
+  {
+    free(buf);
+    return err;
+  }
+
+  /* Skip comments to the size line */
+  p = eol + (eol < end);
+  while (p < end)
+  {
+    eol = sunMMLineEnd(p, end);
+    if (sunMMIsEntry(p, eol)) { break; }
+    p = eol + (eol < end);
+  }
+  if (p >= end || sunMMParseIndex(&p, eol, &rows) ||
+      sunMMParseIndex(&p, eol, &cols) || sunMMParseIndex(&p, eol, &nnz) ||
+      rows < 1 || cols < 1 || nnz < 0 || (symmetric && rows != cols))
+  {
+    free(buf);
+    return SUN_ERR_CORRUPT;
+  }
+  if (rows > SUN_MM_INDEX_MAX || cols > SUN_MM_INDEX_MAX ||
+      nnz > SUN_MM_INDEX_MAX / 2)
+  {
+    free(buf);
+    return SUN_ERR_OUTOFRANGE;
+  }
+  p = eol + (eol < end);
+
+  /* Split the entries into chunks that start at a line */
+#if defined(SUN_MM_THREADS)
+  nchunks = (int)SUNMIN((size_t)SUNMAX(nthreads, 1),
+                        (size_t)(end - p) / SUN_MM_MIN_CHUNK + 1);
+#else
+  nchunks = 1;
+  (void)nthreads;
+#endif
+  chunks = (sunMMChunk*)calloc(nchunks, sizeof(*chunks));
+  if (chunks == NULL)
+  {
+    free(buf);
+    return SUN_ERR_MALLOC_FAIL;
+  }
+  for (c = 0; c < nchunks; c++)
+  {
+    chunks[c].begin = (c == 0) ? p : chunks[c - 1].end;
+    chunks[c].end   = end;
+    if (c < nchunks - 1)
+    {
+      chunks[c].end = p + (size_t)(end - p) * (c + 1) / nchunks;
+      if (chunks[c].end < chunks[c].begin) { chunks[c].end = chunks[c].begin; }
+      chunks[c].end = sunMMLineEnd(chunks[c].end, end);
+      if (chunks[c].end < end) { chunks[c].end++; }
+    }
+    chunks[c].pattern = pattern;
+    chunks[c].coo     = coo;
+    chunks[c].err     = SUN_SUCCESS;
+  }
+
+  /* Count the entries in each chunk to find where the chunks go */
+  sunMMRunChunks(chunks, nchunks, sunMMCountChunk);
+
+  total = 0;
+  for (c = 0; c < nchunks; c++)
+  {
+    chunks[c].offset = total;
+    total += chunks[c].count;
+  }
+  if ((long long)total != nnz)
+  {
+    free(chunks);
+    free(buf);
+    return SUN_ERR_CORRUPT;
+  }
+
+  coo->rows = (sunindextype)rows;
+  coo->cols = (sunindextype)cols;
+  coo->nnz  = total;
+  coo->row  = (sunindextype*)malloc(SUNMAX(total, 1) * sizeof(sunindextype));
+  coo->col  = (sunindextype*)malloc(SUNMAX(total, 1) * sizeof(sunindextype));
+  coo->val  = (sunrealtype*)malloc(SUNMAX(total, 1) * sizeof(sunrealtype));
+  if (coo->row == NULL || coo->col == NULL || coo->val == NULL)
+  {
+    err = SUN_ERR_MALLOC_FAIL;
+  }
+
+  if (!err)
+  {
+    sunMMRunChunks(chunks, nchunks, sunMMParseChunk);
+    for (c = 0; c < nchunks && !err; c++) { err = chunks[c].err; }
+  }
+
+  if (!err && symmetric) { err = sunMMExpandSymmetric(coo); }
+
+  free(chunks);
+  free(buf);
+  if (err) { sunMatrixMarketFree(coo); }
+
+  return err;
+}
+
+void sunMatrixMarketFree(sunMatrixMarketCOO* coo)
+{
+  if (coo == NULL) { return; }
+  free(coo->row);
+  free(coo->col);
+  free(coo->val);
+  memset(coo, 0, sizeof(*coo));
+}
+
+void sunMatrixMarketWriteHeader(FILE* outfile, sunbooleantype symmetric,
+                                sunindextype rows, sunindextype cols,
+                                sunindextype nnz)
+{
+  fprintf(outfile, "%%%%MatrixMarket matrix coordinate real %s\n",
+          symmetric ? "symmetric" : "general");
+  fprintf(outfile, "%ld %ld %ld\n", (long int)rows, (long int)cols,
+          (long int)nnz);
+}
+
+void sunMatrixMarketWriteEntry(FILE* outfile, sunindextype row,
+                               sunindextype col, sunrealtype value)
+{
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+  fprintf(outfile, "%ld %ld %.32Lg\n", (long int)row + 1, (long int)col + 1,
+          value);
+#elif defined(SUNDIALS_DOUBLE_PRECISION)
+  fprintf(outfile, "%ld %ld %.17g\n", (long int)row + 1, (long int)col + 1,
+          value);
+#else
+  fprintf(outfile, "%ld %ld %.9g\n", (long int)row + 1, (long int)col + 1,
+          (double)value);
+#endif
+}
@@ -40,6 +40,8 @@ SUNMemory SUNMemoryNewEmpty(SUNContext sunctx)
   mem = (SUNMemory)malloc(sizeof(struct SUNMemory_));
   SUNAssertNull(mem, SUN_ERR_MALLOC_FAIL);
 
+  if (sunctx) { SUNAllocAuditRecord(sunctx, sizeof(struct SUNMemory_)); }
+
   mem->bytes = 0;
 
   return (mem);
@@ -53,6 +53,8 @@ SUNNonlinearSolver SUNNonlinSolNewEmpty(SUNContext sunctx)
   ops = (SUNNonlinearSolver_Ops)malloc(sizeof *ops);
   SUNAssertNull(ops, SUN_ERR_MALLOC_FAIL);
 
+  SUNAllocAuditRecord(sunctx, sizeof *NLS + sizeof *ops);
+
   /* initialize operations to NULL */
   ops->gettype         = NULL;
   ops->initialize      = NULL;
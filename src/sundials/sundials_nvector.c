@@ -18,8 +18,10 @@
  * in nvector.h.
  * -----------------------------------------------------------------*/
 
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <sundials/priv/sundials_context_impl.h>
 #include <sundials/sundials_core.h>
 #include <sundials/sundials_nvector.h>
@@ -58,6 +60,8 @@ N_Vector N_VNewEmpty(SUNContext sunctx)
   ops = (N_Vector_Ops)malloc(sizeof *ops);
   SUNAssertNull(ops, SUN_ERR_MALLOC_FAIL);
 
+  SUNAllocAuditRecord(sunctx, sizeof *v + sizeof *ops);
+
   /* initialize operations to NULL */
 
   /*
@@ -286,6 +290,16 @@ N_Vector N_VClone(N_Vector w)
   SUNDIALS_MARK_FUNCTION_BEGIN(getSUNProfiler(w));
   result = w->ops->nvclone(w);
   if (result) { result->sunctx = w->sunctx; }
+  if (result && w->sunctx->audit)
+  {
+    /* The vector structure is recorded by N_VNewEmpty, record the data */
+    size_t bytes = 0;
+    if (w->ops->nvgetlocallength)
+    {
+      bytes = (size_t)w->ops->nvgetlocallength(w) * sizeof(sunrealtype);
+    }
+    sunAllocAuditRecord(w->sunctx->audit, bytes, __func__);
+  }
   SUNDIALS_MARK_FUNCTION_END(getSUNProfiler(w));
   return result;
 }
@@ -1094,6 +1108,102 @@ void N_VSetVecAtIndexVectorArray(N_Vector* vs, int index, N_Vector w)
   vs[index] = w;
 }
 
+/* -----------------------------------------------------------------
+ * Binary I/O functions
+ *   N_VWriteBinary
+ *   N_VReadBinary
+ *
+ * The vector data is written as the buffer produced by N_VBufPack,
+ * optionally preceded by a header describing the data. The data is
+ * always packed into (or unpacked from) a temporary buffer with
+ * N_VBufPack and N_VBufUnpack.
+ * ----------------------------------------------------------------- */
+
+/* binary vector file magic number */
+#define SUN_NVBINARY_MAGIC "SUNNVB01"
+
+typedef struct
+{
+  char magic[8];
+  uint32_t byte_order; /* 0x01020304 written in native byte order */
+  uint32_t real_size;  /* size of a sunrealtype                    */
+  uint64_t nbytes;     /* size of the packed vector data           */
+} sunNVBinaryHeader;
+
+SUNErrCode N_VWriteBinary(N_Vector x, FILE* outfile, sunbooleantype header)
+{
+  SUNFunctionBegin(x->sunctx);
+  SUNErrCode ier = SUN_SUCCESS;
+  sunindextype size;
+  sunNVBinaryHeader hdr;
+  void* buf;
+
+  SUNAssert(outfile, SUN_ERR_ARG_CORRUPT);
+
+  SUNCheckCall(N_VBufSize(x, &size));
+
+  if (header)
+  {
+    memcpy(hdr.magic, SUN_NVBINARY_MAGIC, sizeof(hdr.magic));
+    hdr.byte_order = 0x01020304;
+    hdr.real_size  = (uint32_t)sizeof(sunrealtype);
+    hdr.nbytes     = (uint64_t)size;
+    if (fwrite(&hdr, sizeof(hdr), 1, outfile) != 1) { return SUN_ERR_OP_FAIL; }
+  }
+
+  if (size == 0) { return SUN_SUCCESS; }
+
+  buf = malloc(size);
+  if (buf == NULL) { return SUN_ERR_MALLOC_FAIL; }
+
+  ier = N_VBufPack(x, buf);
+  if (!ier && fwrite(buf, 1, size, outfile) != (size_t)size)
+  {
+    ier = SUN_ERR_OP_FAIL;
+  }
+
+  free(buf);
+
+  return ier;
+}
+
+SUNErrCode N_VReadBinary(N_Vector x, FILE* infile, sunbooleantype header)
+{
+  SUNFunctionBegin(x->sunctx);
+  SUNErrCode ier = SUN_SUCCESS;
+  sunindextype size;
+  sunNVBinaryHeader hdr;
+  void* buf;
+
+  SUNAssert(infile, SUN_ERR_ARG_CORRUPT);
+
+  SUNCheckCall(N_VBufSize(x, &size));
+
+  if (header)
+  {
+    if (fread(&hdr, sizeof(hdr), 1, infile) != 1) { return SUN_ERR_OP_FAIL; }
+    if (memcmp(hdr.magic, SUN_NVBINARY_MAGIC, sizeof(hdr.magic)) ||
+        hdr.byte_order != 0x01020304 ||
+        hdr.real_size != (uint32_t)sizeof(sunrealtype))
+    {
+      return SUN_ERR_ARG_INCOMPATIBLE;
+    }
+    if (hdr.nbytes != (uint64_t)size) { return SUN_ERR_ARG_DIMSMISMATCH; }
+  }
+
+  if (size == 0) { return SUN_SUCCESS; }
+
+  buf = malloc(size);
+  if (buf == NULL) { return SUN_ERR_MALLOC_FAIL; }
+
+  if (fread(buf, 1, size, infile) != (size_t)size) { ier = SUN_ERR_OP_FAIL; }
+  else { ier = N_VBufUnpack(x, buf); }
+
+  free(buf);
+
+  return ier;
+}
+
 /* -----------------------------------------------------------------
  * Debugging functions
  * ----------------------------------------------------------------- */
@@ -12,6 +12,7 @@
  * SUNDIALS Copyright End
  * -----------------------------------------------------------------*/
 
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -28,6 +29,7 @@
 #endif
 
 #if defined(SUNDIALS_HAVE_POSIX_TIMERS)
+#include <pthread.h>
 #include <stddef.h>
 #include <time.h>
 #include <unistd.h>
@@ -37,12 +39,44 @@
 #error SUNProfiler needs POSIX or Windows timers
 #endif
 
+#if defined(__linux__)
+#include <errno.h>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#define SUNDIALS_PERF_COUNTERS
+#endif
+
 #include "sundials_debug.h"
 #include "sundials_hashmap_impl.h"
 #include "sundials_macros.h"
+#include "sundials_profiler_impl.h"
+#include "sundials_threads_impl.h"
 
 #define SUNDIALS_ROOT_TIMER ((const char*)"From profiler epoch")
 
+/* Number of entries in the timer lookup cache (must be a power of 2) */
+#define SUNDIALS_TIMER_CACHE_SIZE 1024
+
+/* Depth of the open regions kept to report the current region */
+#define SUNDIALS_REGION_STACK_SIZE 64
+
+/* Default number of events kept in the trace buffer */
+#define SUNDIALS_TRACE_CAPACITY 65536
+
+/* Number of clock reads used to estimate the cost of reading the clock */
+#define SUNDIALS_CLOCK_SAMPLES 1000
+
+/* Number of hardware counters collected for each region */
+#define SUNDIALS_NUM_COUNTERS 4
+
+/* Prefer the raw hardware clock, which is not slewed by NTP, when available */
+#if defined(SUNDIALS_HAVE_POSIX_TIMERS) && defined(CLOCK_MONOTONIC_RAW)
+#define SUNDIALS_CLOCK_ID CLOCK_MONOTONIC_RAW
+#elif defined(SUNDIALS_HAVE_POSIX_TIMERS)
+#define SUNDIALS_CLOCK_ID CLOCK_MONOTONIC
+#endif
+
 #if defined(SUNDIALS_HAVE_POSIX_TIMERS)
 typedef struct timespec sunTimespec;
 #else
@@ -58,69 +92,45 @@ typedef struct _sunTimespec
 static SUNErrCode sunCollectTimers(SUNProfiler p);
 #endif
 static void sunPrintTimer(SUNHashMapKeyValue kv, FILE* fp, void* pvoid);
+static void sunNoFree(void* ptr);
 static int sunCompareTimes(const void* l, const void* r);
 static int sunclock_gettime_monotonic(sunTimespec* tp);
 
 /*
   sunTimerStruct.
-  A private structure holding timing information.
+  A private structure holding timing information. The timers of a profiler are
+  stored contiguously and the tic is kept inline so starting and stopping a
+  timer does not chase pointers. The timer owns a copy of its name.
  */
 
 struct _sunTimerStruct
 {
-  sunTimespec* tic;
-  sunTimespec* toc;
   double average;
   double maximum;
   double elapsed;
   long count;
+  sunTimespec tic;
+  char* name;
 };
 
 typedef struct _sunTimerStruct sunTimerStruct;
 
-static sunTimerStruct* sunTimerStructNew(void)
-{
-  sunTimerStruct* ts = (sunTimerStruct*)malloc(sizeof(sunTimerStruct));
-  ts->tic            = (sunTimespec*)malloc(sizeof(sunTimespec));
-  ts->toc            = (sunTimespec*)malloc(sizeof(sunTimespec));
-  ts->tic->tv_sec    = 0;
-  ts->tic->tv_nsec   = 0;
-  ts->elapsed        = 0.0;
-  ts->average        = 0.0;
-  ts->maximum        = 0.0;
-  ts->count          = 0;
-  return ts;
-}
-
-static void sunTimerStructFree(void* TS)
-{
-  sunTimerStruct* ts = (sunTimerStruct*)TS;
-  if (ts)
-  {
-    if (ts->tic) { free(ts->tic); }
-    if (ts->toc) { free(ts->toc); }
-    free(ts);
-  }
-}
-
 static void sunStartTiming(sunTimerStruct* entry)
 {
-  sunclock_gettime_monotonic(entry->tic);
+  sunclock_gettime_monotonic(&entry->tic);
 }
 
-static void sunStopTiming(sunTimerStruct* entry)
+static void sunStopTimingAt(sunTimerStruct* entry, const sunTimespec* toc)
 {
   long s_difference  = 0;
   long ns_difference = 0;
 
-  sunclock_gettime_monotonic(entry->toc);
-
-  s_difference  = entry->toc->tv_sec - entry->tic->tv_sec;
-  ns_difference = entry->toc->tv_nsec - entry->tic->tv_nsec;
+  s_difference  = toc->tv_sec - entry->tic.tv_sec;
+  ns_difference = toc->tv_nsec - entry->tic.tv_nsec;
   if (ns_difference < 0)
   {
     s_difference--;
-    ns_difference = 1000000000 + entry->toc->tv_nsec - entry->tic->tv_nsec;
+    ns_difference = 1000000000 + toc->tv_nsec - entry->tic.tv_nsec;
   }
 
   entry->elapsed += ((double)s_difference) + ((double)ns_difference) * 1e-9;
@@ -128,52 +138,935 @@ static void sunStopTiming(sunTimerStruct* entry)
   entry->maximum = entry->elapsed;
 }
 
+static void sunStopTiming(sunTimerStruct* entry)
+{
+  sunTimespec toc;
+  sunclock_gettime_monotonic(&toc);
+  sunStopTimingAt(entry, &toc);
+}
+
 static void sunResetTiming(sunTimerStruct* entry)
 {
-  entry->tic->tv_sec  = 0;
-  entry->tic->tv_nsec = 0;
-  entry->toc->tv_sec  = 0;
-  entry->toc->tv_nsec = 0;
-  entry->elapsed      = 0.0;
-  entry->average      = 0.0;
-  entry->maximum      = 0.0;
-  entry->count        = 0;
+  entry->tic.tv_sec  = 0;
+  entry->tic.tv_nsec = 0;
+  entry->elapsed     = 0.0;
+  entry->average     = 0.0;
+  entry->maximum     = 0.0;
+  entry->count       = 0;
 }
 
 /*
   SUNProfiler.
 
-  This structure holds all of the timers in a map.s
+  This structure holds all of the timers in a contiguous array. A timer is
+  identified by its index (handle) in the array, and the map from names to
+  timers is only used the first time a name is seen. After that, names are
+  resolved through a direct-mapped cache keyed by the address of the name,
+  e.g., __func__ in the SUNDIALS_MARK_FUNCTION_* macros. A cache hit is
+  confirmed by comparing the name with the timer name, so a name stored at a
+  reused address (e.g., a temporary string) cannot alias another timer.
  */
 
+typedef struct _sunTimerCacheEntry
+{
+  const char* name;
+  sunTimerStruct* timer;
+} sunTimerCacheEntry;
+
+typedef struct _sunTraceEvent
+{
+  long long time;       /* nanoseconds since the trace epoch */
+  unsigned long thread; /* calling thread                    */
+  int timer;            /* timer index                       */
+  char phase;           /* 'B' (begin) or 'E' (end)          */
+} sunTraceEvent;
+
+typedef struct _sunTraceThread
+{
+  unsigned long id;
+  int depth;
+} sunTraceThread;
+
+typedef struct _sunCallNode
+{
+  int timer;           /* timer index (-1 for the root)     */
+  int parent;          /* parent node                       */
+  int child;           /* first child node (-1 if none)     */
+  int sibling;         /* next sibling node (-1 if none)    */
+  long count;          /* number of calls on this path      */
+  long long inclusive; /* nanoseconds in the region         */
+  long long children;  /* nanoseconds in its child regions  */
+} sunCallNode;
+
+typedef struct _sunCallFrame
+{
+  int node;        /* call tree node of an open region */
+  long long start; /* start time of the region         */
+} sunCallFrame;
+
+typedef struct _sunCounterSet
+{
+  long long total[SUNDIALS_NUM_COUNTERS]; /* counts in the region           */
+  long long start[SUNDIALS_NUM_COUNTERS]; /* counts when the region began   */
+  int open;                               /* is the region being counted    */
+} sunCounterSet;
+
 struct SUNProfiler_
 {
   SUNComm comm;
   char* title;
   SUNHashMap map;
-  sunTimerStruct* overhead;
+  sunTimerStruct* timers;
+  int ntimers;
+  int max_timers;
+  sunTimerCacheEntry cache[SUNDIALS_TIMER_CACHE_SIZE];
+  sunTimerStruct overhead;
+  long nmarks;
+  int region_stack[SUNDIALS_REGION_STACK_SIZE];
+  int region_depth;
+  double clock_cost;
   double sundials_time;
+
+  /* Event trace and call tree, only allocated when tracing is enabled */
+  sunTraceEvent* trace;
+  long trace_capacity;
+  long trace_count;
+  sunTimespec trace_epoch;
+  char* trace_filename;
+  sunCallNode* nodes;
+  int nnodes;
+  int max_nodes;
+  sunCallFrame* frames;
+  int depth;
+  int max_depth;
+
+  /* Hardware counters, only allocated when counters are enabled */
+  sunCounterSet* counters;
+  int counter_fd[SUNDIALS_NUM_COUNTERS];
+  int counter_slot[SUNDIALS_NUM_COUNTERS];
+  int ncounters;
+  int counter_leader;
+  int counter_error;
+  double counter_cost;
+  long line_size;
+
+#if defined(SUNDIALS_ENABLE_THREAD_SAFE_CONTEXT)
+  /* Threads other than the owner time regions in their own shard */
+  unsigned long owner;      /* thread that created the profiler     */
+  int is_shard;             /* is this the shard of another thread  */
+  sunThreadKey shard_key;   /* shard of each thread                 */
+  sunMutex shard_lock;      /* protects the list of shards          */
+  SUNProfiler shards;       /* first shard                          */
+  SUNProfiler next_shard;   /* next shard of the owning profiler    */
+#endif
 };
 
-SUNErrCode SUNProfiler_Create(SUNComm comm, const char* title, SUNProfiler* p)
+/* Index into the timer cache for a name */
+static inline int sunTimerCacheIndex(const char* name)
+{
+  uintptr_t key = (uintptr_t)name;
+  return (int)(((key >> 3) ^ (key >> 13)) & (SUNDIALS_TIMER_CACHE_SIZE - 1));
+}
+
+/* Estimate the cost of reading the clock, which dominates the overhead of
+   starting and stopping a timer */
+static double sunEstimateClockCost(void)
+{
+  int i;
+  sunTimerStruct ts;
+
+  sunResetTiming(&ts);
+  sunStartTiming(&ts);
+  for (i = 0; i < SUNDIALS_CLOCK_SAMPLES; i++)
+  {
+    sunTimespec tmp;
+    sunclock_gettime_monotonic(&tmp);
+  }
+  sunStopTiming(&ts);
+
+  return ts.elapsed / SUNDIALS_CLOCK_SAMPLES;
+}
+
+/* Find the timer for a name, adding a new timer if the name is not known */
+static SUNErrCode sunLookupTimer(SUNProfiler p, const char* name,
+                                 sunbooleantype insert, sunTimerStruct** timer)
+{
+  int ier;
+  int idx = sunTimerCacheIndex(name);
+
+  if (p->cache[idx].name == name && !strcmp(p->cache[idx].timer->name, name))
+  {
+    *timer = p->cache[idx].timer;
+    return SUN_SUCCESS;
+  }
+
+  sunStartTiming(&p->overhead);
+
+  ier = SUNHashMap_GetValue(p->map, name, (void**)timer);
+  if (ier == -2 && insert)
+  {
+    if (p->ntimers == p->max_timers)
+    {
+      sunStopTiming(&p->overhead);
+      return SUN_ERR_PROFILER_MAPFULL;
+    }
+    *timer = &p->timers[p->ntimers];
+    sunResetTiming(*timer);
+    (*timer)->name = (char*)malloc((strlen(name) + 1) * sizeof(char));
+    if (!(*timer)->name)
+    {
+      sunStopTiming(&p->overhead);
+      return SUN_ERR_MALLOC_FAIL;
+    }
+    strcpy((*timer)->name, name);
+    ier = SUNHashMap_Insert(p->map, (*timer)->name, (void*)*timer);
+    if (ier)
+    {
+      free((*timer)->name);
+      sunStopTiming(&p->overhead);
+      if (ier == -1) { return SUN_ERR_PROFILER_MAPINSERT; }
+      if (ier == -2) { return SUN_ERR_PROFILER_MAPFULL; }
+    }
+    p->ntimers++;
+  }
+  else if (ier)
+  {
+    sunStopTiming(&p->overhead);
+    if (ier == -1) { return SUN_ERR_PROFILER_MAPGET; }
+    if (ier == -2) { return SUN_ERR_PROFILER_MAPKEYNOTFOUND; }
+  }
+
+  p->cache[idx].name  = name;
+  p->cache[idx].timer = *timer;
+
+  sunStopTiming(&p->overhead);
+  return SUN_SUCCESS;
+}
+
+/*
+  Event trace.
+
+  When tracing is enabled, the begin and end of every timed region are
+  recorded in a ring buffer of events that can be exported in the Chrome
+  trace-event format. The nesting of regions is also tracked in a call tree
+  so the inclusive and exclusive time of each region can be reported for each
+  call path. A SUNProfiler (like the SUNContext that owns it) is used by one
+  thread at a time, so the buffer and call tree need no synchronization; the
+  calling thread is recorded with each event.
+ */
+
+/* Convert a time to nanoseconds since the trace epoch */
+static long long sunTraceTime(SUNProfiler p, const sunTimespec* ts)
+{
+  return ((long long)ts->tv_sec - (long long)p->trace_epoch.tv_sec) * 1000000000LL +
+         ((long long)ts->tv_nsec - (long long)p->trace_epoch.tv_nsec);
+}
+
+static unsigned long sunThreadId(void)
+{
+#if defined(SUNDIALS_HAVE_POSIX_TIMERS)
+  return (unsigned long)(uintptr_t)pthread_self();
+#else
+  return (unsigned long)GetCurrentThreadId();
+#endif
+}
+
+static void sunTraceRecord(SUNProfiler p, sunTimerStruct* timer, char phase,
+                           long long time)
+{
+  sunTraceEvent* ev = &p->trace[p->trace_count % p->trace_capacity];
+
+  ev->time   = time;
+  ev->thread = sunThreadId();
+  ev->timer  = (int)(timer - p->timers);
+  ev->phase  = phase;
+  p->trace_count++;
+}
+
+/* Find or add the child of a call tree node for a timer */
+static int sunCallTreeChild(SUNProfiler p, int parent, int timer)
+{
+  int node;
+  int last = -1;
+  sunCallNode* nodes;
+
+  for (node = p->nodes[parent].child; node >= 0; node = p->nodes[node].sibling)
+  {
+    if (p->nodes[node].timer == timer) { return node; }
+    last = node;
+  }
+
+  if (p->nnodes == p->max_nodes)
+  {
+    nodes = (sunCallNode*)realloc(p->nodes,
+                                  2 * p->max_nodes * sizeof(sunCallNode));
+    if (!nodes) { return -1; }
+    p->nodes = nodes;
+    p->max_nodes *= 2;
+  }
+
+  /* Children are kept in the order they are first called */
+  node                     = p->nnodes++;
+  p->nodes[node].timer     = timer;
+  p->nodes[node].parent    = parent;
+  p->nodes[node].child     = -1;
+  p->nodes[node].sibling   = -1;
+  p->nodes[node].count     = 0;
+  p->nodes[node].inclusive = 0;
+  p->nodes[node].children  = 0;
+  if (last < 0) { p->nodes[parent].child = node; }
+  else { p->nodes[last].sibling = node; }
+
+  return node;
+}
+
+static void sunTraceBegin(SUNProfiler p, sunTimerStruct* timer)
+{
+  int node;
+  long long time;
+  sunCallFrame* frames;
+
+  /* The root timer spans the life of the profiler and is not traced */
+  if (timer == p->timers) { return; }
+
+  time = sunTraceTime(p, &timer->tic);
+  sunTraceRecord(p, timer, 'B', time);
+
+  node = sunCallTreeChild(p, p->frames[p->depth - 1].node,
+                          (int)(timer - p->timers));
+  if (node < 0) { return; }
+
+  if (p->depth == p->max_depth)
+  {
+    frames = (sunCallFrame*)realloc(p->frames,
+                                    2 * p->max_depth * sizeof(sunCallFrame));
+    if (!frames) { return; }
+    p->frames = frames;
+    p->max_depth *= 2;
+  }
+
+  p->nodes[node].count++;
+  p->frames[p->depth].node  = node;
+  p->frames[p->depth].start = time;
+  p->depth++;
+}
+
+static void sunTraceEnd(SUNProfiler p, sunTimerStruct* timer,
+                        const sunTimespec* toc)
+{
+  int depth;
+  int index = (int)(timer - p->timers);
+  long long time;
+
+  if (timer == p->timers) { return; }
+
+  time = sunTraceTime(p, toc);
+  sunTraceRecord(p, timer, 'E', time);
+
+  /* Find the innermost open region for this timer. Regions opened inside it
+     that were not ended are closed with it. */
+  for (depth = p->depth - 1; depth > 0; depth--)
+  {
+    if (p->nodes[p->frames[depth].node].timer == index) { break; }
+  }
+  if (depth == 0) { return; }
+
+  while (p->depth > depth)
+  {
+    sunCallFrame* frame = &p->frames[--p->depth];
+    long long elapsed   = time - frame->start;
+    p->nodes[frame->node].inclusive += elapsed;
+    p->nodes[p->nodes[frame->node].parent].children += elapsed;
+  }
+}
+
+/* Clear the recorded events and call tree and restart the trace clock */
+static void sunTraceReset(SUNProfiler p)
+{
+  p->trace_count        = 0;
+  p->nnodes             = 1;
+  p->nodes[0].timer     = -1;
+  p->nodes[0].parent    = 0;
+  p->nodes[0].child     = -1;
+  p->nodes[0].sibling   = -1;
+  p->nodes[0].count     = 0;
+  p->nodes[0].inclusive = 0;
+  p->nodes[0].children  = 0;
+  p->depth              = 1;
+  p->frames[0].node     = 0;
+  p->frames[0].start    = 0;
+  sunclock_gettime_monotonic(&p->trace_epoch);
+}
+
+static void sunTraceFree(SUNProfiler p)
+{
+  free(p->trace);
+  free(p->nodes);
+  free(p->frames);
+  p->trace  = NULL;
+  p->nodes  = NULL;
+  p->frames = NULL;
+}
+
+/* Write a string as a JSON string */
+static void sunWriteJSONString(FILE* fp, const char* str)
+{
+  fputc('"', fp);
+  for (; *str; str++)
+  {
+    if (*str == '"' || *str == '\\') { fprintf(fp, "\\%c", *str); }
+    else if ((unsigned char)*str < 0x20)
+    {
+      fprintf(fp, "\\u%04x", (unsigned int)(unsigned char)*str);
+    }
+    else { fputc(*str, fp); }
+  }
+  fputc('"', fp);
+}
+
+/* Print the call tree below a node, depth first */
+static void sunPrintCallTree(SUNProfiler p, FILE* fp, int node, int level)
+{
+  int child;
+  int width = SUNMAX(40 - 2 * level, 1);
+
+  for (child = p->nodes[node].child; child >= 0; child = p->nodes[child].sibling)
+  {
+    sunCallNode* n = &p->nodes[child];
+    fprintf(fp, "%*s%-*s\t %.6fs \t %.6fs \t %ld\n", 2 * level, "", width,
+            p->timers[n->timer].name, 1e-9 * (double)n->inclusive,
+            1e-9 * (double)(n->inclusive - n->children), n->count);
+    sunPrintCallTree(p, fp, child, level + 1);
+  }
+}
+
+SUNErrCode SUNProfiler_EnableTrace(SUNProfiler p, long capacity)
+{
+  if (!p) { return SUN_ERR_ARG_CORRUPT; }
+
+  if (capacity <= 0) { capacity = SUNDIALS_TRACE_CAPACITY; }
+
+  sunStartTiming(&p->overhead);
+
+  sunTraceFree(p);
+
+  p->trace     = (sunTraceEvent*)malloc(capacity * sizeof(sunTraceEvent));
+  p->max_nodes = 64;
+  p->nodes     = (sunCallNode*)malloc(p->max_nodes * sizeof(sunCallNode));
+  p->max_depth = 16;
+  p->frames    = (sunCallFrame*)malloc(p->max_depth * sizeof(sunCallFrame));
+  if (!p->trace || !p->nodes || !p->frames)
+  {
+    sunTraceFree(p);
+    sunStopTiming(&p->overhead);
+    return SUN_ERR_MALLOC_FAIL;
+  }
+  p->trace_capacity = capacity;
+
+  /* Start the trace clock at the same time on all ranks */
+#if SUNDIALS_MPI_ENABLED
+  if (p->comm != SUN_COMM_NULL) { MPI_Barrier(p->comm); }
+#endif
+  sunTraceReset(p);
+
+  sunStopTiming(&p->overhead);
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNProfiler_SetTraceFilename(SUNProfiler p, const char* filename)
+{
+  if (!p) { return SUN_ERR_ARG_CORRUPT; }
+
+  free(p->trace_filename);
+  p->trace_filename = NULL;
+
+  if (filename && strcmp(filename, ""))
+  {
+    p->trace_filename = (char*)malloc((strlen(filename) + 1) * sizeof(char));
+    if (!p->trace_filename) { return SUN_ERR_MALLOC_FAIL; }
+    strcpy(p->trace_filename, filename);
+  }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNProfiler_WriteTrace(SUNProfiler p, FILE* fp)
+{
+  long i, first;
+  int j;
+  int rank                = 0;
+  int nthreads            = 0;
+  int max_threads         = 8;
+  sunTraceThread* threads = NULL;
+
+  if (!p || !fp) { return SUN_ERR_ARG_CORRUPT; }
+  if (!p->trace) { return SUN_ERR_ARG_INCOMPATIBLE; }
+
+  sunStartTiming(&p->overhead);
+
+#if SUNDIALS_MPI_ENABLED
+  if (p->comm != SUN_COMM_NULL) { MPI_Comm_rank(p->comm, &rank); }
+#endif
+
+  threads = (sunTraceThread*)malloc(max_threads * sizeof(sunTraceThread));
+  if (!threads)
+  {
+    sunStopTiming(&p->overhead);
+    return SUN_ERR_MALLOC_FAIL;
+  }
+
+  fprintf(fp, "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [\n");
+  fprintf(fp, "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": %d, "
+              "\"tid\": 0, \"args\": {\"name\": ",
+          rank);
+  sunWriteJSONString(fp, p->title);
+  fprintf(fp, "}}");
+
+  /* Once the buffer wraps around, only the most recent events are kept */
+  first = SUNMAX(p->trace_count - p->trace_capacity, 0);
+
+  for (i = first; i < p->trace_count; i++)
+  {
+    sunTraceEvent* ev = &p->trace[i % p->trace_capacity];
+
+    /* Threads are numbered in the order they appear in the trace */
+    for (j = 0; j < nthreads; j++)
+    {
+      if (threads[j].id == ev->thread) { break; }
+    }
+    if (j == nthreads)
+    {
+      if (nthreads == max_threads)
+      {
+        sunTraceThread* tmp = (sunTraceThread*)realloc(threads,
+                                                       2 * max_threads *
+                                                         sizeof(sunTraceThread));
+        if (!tmp)
+        {
+          free(threads);
+          sunStopTiming(&p->overhead);
+          return SUN_ERR_MALLOC_FAIL;
+        }
+        threads = tmp;
+        max_threads *= 2;
+      }
+      threads[nthreads].id    = ev->thread;
+      threads[nthreads].depth = 0;
+      nthreads++;
+    }
+
+    /* Skip the end of a region whose begin was overwritten */
+    if (ev->phase == 'B') { threads[j].depth++; }
+    else if (threads[j].depth > 0) { threads[j].depth--; }
+    else { continue; }
+
+    fprintf(fp, ",\n{\"name\": ");
+    sunWriteJSONString(fp, p->timers[ev->timer].name);
+    fprintf(fp,
+            ", \"cat\": \"sundials\", \"ph\": \"%c\", \"ts\": %.3f, "
+            "\"pid\": %d, \"tid\": %d}",
+            ev->phase, 1e-3 * (double)ev->time, rank, j);
+  }
+
+  for (j = 0; j < nthreads; j++)
+  {
+    fprintf(fp,
+            ",\n{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": %d, "
+            "\"tid\": %d, \"args\": {\"name\": \"thread %d\"}}",
+            rank, j, j);
+  }
+
+  fprintf(fp, "\n]}\n");
+
+  free(threads);
+
+  sunStopTiming(&p->overhead);
+  return SUN_SUCCESS;
+}
+
+/*
+  Hardware counters.
+
+  On Linux, the profiler can count the CPU cycles, instructions, and last
+  level cache (LLC) references and misses of each region with perf_event_open.
+  The counters are opened as one group for the calling thread and only count
+  user space, so all of them are read with a single system call when a region
+  begins and ends. Counters that are not provided by the hardware or kernel
+  are skipped. If none can be opened, e.g., in a virtual machine without a PMU
+  or when /proc/sys/kernel/perf_event_paranoid does not allow it, regions are
+  only timed and SUNProfiler_Print notes why.
+ */
+
+#if defined(SUNDIALS_PERF_COUNTERS)
+static const unsigned long long sunCounterConfig[SUNDIALS_NUM_COUNTERS] = {
+  PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+  PERF_COUNT_HW_CACHE_REFERENCES, PERF_COUNT_HW_CACHE_MISSES};
+#endif
+
+/* Read the current counts, returns nonzero if the counters could not be read */
+static int sunReadCounters(SUNProfiler p, long long* values)
+{
+#if defined(SUNDIALS_PERF_COUNTERS)
+  int i;
+  unsigned long long buffer[1 + SUNDIALS_NUM_COUNTERS];
+  ssize_t size = (ssize_t)((1 + p->ncounters) * sizeof(unsigned long long));
+
+  /* With PERF_FORMAT_GROUP the number of counters is followed by the counts */
+  if (read(p->counter_fd[p->counter_leader], buffer, size) != size)
+  {
+    return 1;
+  }
+
+  for (i = 0; i < SUNDIALS_NUM_COUNTERS; i++)
+  {
+    values[i] = (p->counter_slot[i] < 0)
+                  ? 0
+                  : (long long)buffer[1 + p->counter_slot[i]];
+  }
+
+  return 0;
+#else
+  return 1;
+#endif
+}
+
+static void sunCountersBegin(SUNProfiler p, sunTimerStruct* timer)
+{
+  sunCounterSet* set = &p->counters[timer - p->timers];
+  set->open          = !sunReadCounters(p, set->start);
+}
+
+static void sunCountersEnd(SUNProfiler p, sunTimerStruct* timer)
+{
+  int i;
+  long long values[SUNDIALS_NUM_COUNTERS];
+  sunCounterSet* set = &p->counters[timer - p->timers];
+
+  /* Regions that began before the counters were enabled are not counted */
+  if (!set->open) { return; }
+  set->open = 0;
+
+  if (sunReadCounters(p, values)) { return; }
+  for (i = 0; i < SUNDIALS_NUM_COUNTERS; i++)
+  {
+    set->total[i] += values[i] - set->start[i];
+  }
+}
+
+static void sunCountersFree(SUNProfiler p)
+{
+#if defined(SUNDIALS_PERF_COUNTERS)
+  int i;
+  if (p->counters)
+  {
+    for (i = 0; i < SUNDIALS_NUM_COUNTERS; i++)
+    {
+      if (p->counter_fd[i] >= 0) { close(p->counter_fd[i]); }
+    }
+  }
+#endif
+  free(p->counters);
+  p->counters = NULL;
+}
+
+/* Format a ratio of counts for printing, or -- if it is not available */
+static const char* sunFormatRatio(char* buffer, size_t size, const char* fmt,
+                                  long long num, long long den, double scale)
+{
+  if (num < 0 || den <= 0) { return "--"; }
+  snprintf(buffer, size, fmt, scale * (double)num / (double)den);
+  return buffer;
+}
+
+/* Print the counters of each timer (in the sorted order of the timers) */
+static void sunPrintCounters(SUNProfiler p, FILE* fp,
+                             SUNHashMapKeyValue* sorted)
+{
+  int i, j;
+  char buffer[4][32];
+
+  fprintf(fp, "\n%-40s\t IPC \t\t LLC miss rate \t LLC MPKI \t est. GB/s \n",
+          "HARDWARE COUNTERS:");
+  fprintf(fp, "=============================================================="
+              "==================================================\n");
+
+  if (!p->counters)
+  {
+    const char* reason = "not supported on this platform";
+#if defined(SUNDIALS_PERF_COUNTERS)
+    if (p->counter_error == EACCES || p->counter_error == EPERM)
+    {
+      reason = "permission denied, see /proc/sys/kernel/perf_event_paranoid";
+    }
+    else if (p->counter_error == ENOENT || p->counter_error == EOPNOTSUPP)
+    {
+      reason = "no hardware counters were found";
+    }
+    else if (p->counter_error > 0) { reason = strerror(p->counter_error); }
+#endif
+    fprintf(fp, "not available (%s)\n", reason);
+    return;
+  }
+
+  for (i = 0; i < p->map->size; i++)
+  {
+    sunTimerStruct* timer;
+    long long values[SUNDIALS_NUM_COUNTERS];
+    long long bytes = -1;
+    long long nsec;
+
+    if (!sorted[i]) { continue; }
+    timer = (sunTimerStruct*)sorted[i]->value;
+
+    for (j = 0; j < SUNDIALS_NUM_COUNTERS; j++)
+    {
+      values[j] = (p->counter_slot[j] < 0)
+                    ? -1
+                    : p->counters[timer - p->timers].total[j];
+    }
+
+    /* Estimate the memory traffic from the number of LLC misses */
+    if (values[3] >= 0) { bytes = values[3] * p->line_size; }
+    nsec = (long long)(timer->elapsed * 1e9);
+
+    fprintf(fp, "%-40s\t %s \t\t %s \t\t %s \t\t %s\n", timer->name,
+            sunFormatRatio(buffer[0], 32, "%.2f", values[1], values[0], 1.0),
+            sunFormatRatio(buffer[1], 32, "%.2f%%", values[3], values[2], 100.0),
+            sunFormatRatio(buffer[2], 32, "%.2f", values[3], values[1], 1000.0),
+            sunFormatRatio(buffer[3], 32, "%.3f", bytes, nsec, 1.0));
+  }
+}
+
+SUNErrCode SUNProfiler_EnableCounters(SUNProfiler p)
+{
+#if defined(SUNDIALS_PERF_COUNTERS)
+  int i, fd;
+  int error = 0;
+  long long values[SUNDIALS_NUM_COUNTERS];
+  sunTimerStruct ts;
+#endif
+
+  if (!p) { return SUN_ERR_ARG_CORRUPT; }
+
+#if defined(SUNDIALS_PERF_COUNTERS)
+  if (p->counters) { return SUN_SUCCESS; }
+
+  sunStartTiming(&p->overhead);
+
+  p->ncounters      = 0;
+  p->counter_leader = -1;
+  for (i = 0; i < SUNDIALS_NUM_COUNTERS; i++)
+  {
+    struct perf_event_attr attr;
+
+    memset(&attr, 0, sizeof(attr));
+    attr.size           = sizeof(attr);
+    attr.type           = PERF_TYPE_HARDWARE;
+    attr.config         = sunCounterConfig[i];
+    attr.read_format    = PERF_FORMAT_GROUP;
+    attr.disabled       = (p->counter_leader < 0);
+    attr.exclude_kernel = 1;
+    attr.exclude_hv     = 1;
+
+    fd = (int)syscall(SYS_perf_event_open, &attr, 0, -1,
+                      (p->counter_leader < 0)
+                        ? -1
+                        : p->counter_fd[p->counter_leader],
+                      0);
+
+    p->counter_fd[i]   = fd;
+    p->counter_slot[i] = -1;
+    if (fd < 0)
+    {
+      if (!error) { error = errno; }
+      continue;
+    }
+
+    if (p->counter_leader < 0) { p->counter_leader = i; }
+    p->counter_slot[i] = p->ncounters++;
+  }
+
+  if (!p->ncounters)
+  {
+    p->counter_error = error;
+    sunStopTiming(&p->overhead);
+    return SUN_ERR_OP_FAIL;
+  }
+  p->counter_error = 0;
+
+  p->counters = (sunCounterSet*)calloc(p->max_timers, sizeof(sunCounterSet));
+  if (!p->counters)
+  {
+    for (i = 0; i < SUNDIALS_NUM_COUNTERS; i++)
+    {
+      if (p->counter_fd[i] >= 0) { close(p->counter_fd[i]); }
+    }
+    sunStopTiming(&p->overhead);
+    return SUN_ERR_MALLOC_FAIL;
+  }
+
+  ioctl(p->counter_fd[p->counter_leader], PERF_EVENT_IOC_RESET,
+        PERF_IOC_FLAG_GROUP);
+  ioctl(p->counter_fd[p->counter_leader], PERF_EVENT_IOC_ENABLE,
+        PERF_IOC_FLAG_GROUP);
+
+  p->line_size = 0;
+#if defined(_SC_LEVEL3_CACHE_LINESIZE)
+  p->line_size = sysconf(_SC_LEVEL3_CACHE_LINESIZE);
+#endif
+  if (p->line_size <= 0) { p->line_size = 64; }
+
+  /* Estimate the cost of reading the counters for the overhead estimate */
+  sunResetTiming(&ts);
+  sunStartTiming(&ts);
+  for (i = 0; i < SUNDIALS_CLOCK_SAMPLES; i++) { sunReadCounters(p, values); }
+  sunStopTiming(&ts);
+  p->counter_cost = ts.elapsed / SUNDIALS_CLOCK_SAMPLES;
+
+  sunStopTiming(&p->overhead);
+  return SUN_SUCCESS;
+#else
+  p->counter_error = -1;
+  return SUN_ERR_NOT_IMPLEMENTED;
+#endif
+}
+
+SUNErrCode SUNProfiler_GetCounters(SUNProfiler p, const char* name,
+                                   long long* cycles, long long* instructions,
+                                   long long* llc_references,
+                                   long long* llc_misses)
+{
+  int i;
+  long long values[SUNDIALS_NUM_COUNTERS];
+  sunTimerStruct* timer;
+
+  if (!p) { return SUN_ERR_ARG_CORRUPT; }
+  if (!p->counters) { return SUN_ERR_ARG_INCOMPATIBLE; }
+
+  if (SUNHashMap_GetValue(p->map, name, (void**)&timer)) { return (-1); }
+
+  for (i = 0; i < SUNDIALS_NUM_COUNTERS; i++)
+  {
+    values[i] = (p->counter_slot[i] < 0)
+                  ? -1
+                  : p->counters[timer - p->timers].total[i];
+  }
+
+  if (cycles) { *cycles = values[0]; }
+  if (instructions) { *instructions = values[1]; }
+  if (llc_references) { *llc_references = values[2]; }
+  if (llc_misses) { *llc_misses = values[3]; }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNProfiler_CreateFromEnv(SUNComm comm, const char* title,
+                                     SUNProfiler* p)
+{
+  SUNErrCode err;
+  const char* trace_env    = getenv("SUNPROFILER_TRACE");
+  const char* capacity_env = getenv("SUNPROFILER_TRACE_CAPACITY");
+  const char* counters_env = getenv("SUNPROFILER_COUNTERS");
+  long capacity            = (capacity_env) ? atol(capacity_env) : 0;
+
+  err = SUNProfiler_Create(comm, title, p);
+  if (err || !(*p)) { return err; }
+
+  /* If the counters are not available, regions are still timed */
+  if (counters_env && strcmp(counters_env, "") && strcmp(counters_env, "0"))
+  {
+    SUNProfiler_EnableCounters(*p);
+  }
+
+  if (trace_env && strcmp(trace_env, "") && strcmp(trace_env, "0"))
+  {
+    do {
+      err = SUNProfiler_SetTraceFilename(*p, trace_env);
+      if (err) { break; }
+      err = SUNProfiler_EnableTrace(*p, capacity);
+    }
+    while (0);
+
+    if (err) { SUNProfiler_Free(p); }
+  }
+
+  return err;
+}
+
+/* Write the trace to the trace file, adding the rank to the file name (before
+   a .json extension) when there are several ranks */
+static void sunWriteTraceFile(SUNProfiler p)
+{
+  FILE* fp       = NULL;
+  char* filename = p->trace_filename;
+  char* buffer   = NULL;
+
+#if SUNDIALS_MPI_ENABLED
+  int rank, nranks;
+  if (p->comm != SUN_COMM_NULL)
+  {
+    MPI_Comm_rank(p->comm, &rank);
+    MPI_Comm_size(p->comm, &nranks);
+    if (nranks > 1)
+    {
+      size_t len = strlen(p->trace_filename);
+      size_t ext = (len > 5 && !strcmp(p->trace_filename + len - 5, ".json"))
+                     ? len - 5
+                     : len;
+      buffer     = (char*)malloc((len + 16) * sizeof(char));
+      if (!buffer) { return; }
+      sprintf(buffer, "%.*s.%d%s", (int)ext, p->trace_filename, rank,
+              p->trace_filename + ext);
+      filename = buffer;
+    }
+  }
+#endif
+
+  fp = fopen(filename, "w");
+  if (fp)
+  {
+    SUNProfiler_WriteTrace(p, fp);
+    fclose(fp);
+  }
+  free(buffer);
+}
+
+static SUNErrCode sunProfilerCreate(SUNComm comm, const char* title,
+                                    int is_shard, SUNProfiler* p)
 {
   SUNProfiler profiler;
   int max_entries;
   char* max_entries_env;
 
-  *p = profiler = (SUNProfiler)malloc(sizeof(struct SUNProfiler_));
+  *p = profiler = (SUNProfiler)calloc(1, sizeof(struct SUNProfiler_));
 
   if (profiler == NULL) { return SUN_SUCCESS; }
 
-  profiler->overhead = sunTimerStructNew();
-  if (!profiler->overhead)
+  sunResetTiming(&profiler->overhead);
+  sunStartTiming(&profiler->overhead);
+
+#if defined(SUNDIALS_ENABLE_THREAD_SAFE_CONTEXT)
+  profiler->owner    = sunThreadSelf();
+  profiler->is_shard = is_shard;
+  if (!is_shard)
   {
-    free(profiler);
-    *p = profiler = NULL;
-    return SUN_ERR_MALLOC_FAIL;
+    if (sunThreadKeyCreate(&profiler->shard_key))
+    {
+      free(profiler);
+      *p = NULL;
+      return SUN_ERR_OP_FAIL;
+    }
+    if (sunMutexInit(&profiler->shard_lock))
+    {
+      sunThreadKeyDelete(profiler->shard_key);
+      free(profiler);
+      *p = NULL;
+      return SUN_ERR_OP_FAIL;
+    }
   }
-
-  sunStartTiming(profiler->overhead);
+#else
+  (void)is_shard;
+#endif
 
   /* Check to see if max entries env variable was set, and use if it was. */
   max_entries     = 2560;
@@ -181,10 +1074,21 @@ SUNErrCode SUNProfiler_Create(SUNComm comm, const char* title, SUNProfiler* p)
   if (max_entries_env) { max_entries = atoi(max_entries_env); }
   if (max_entries <= 0) { max_entries = 2560; }
 
-  /* Create the hashmap used to store the timers */
+  /* Create the timers and the hashmap used to look them up by name */
+  profiler->timers = (sunTimerStruct*)malloc(max_entries *
+                                             sizeof(sunTimerStruct));
+  if (!profiler->timers)
+  {
+    free(profiler);
+    *p = profiler = NULL;
+    return SUN_ERR_MALLOC_FAIL;
+  }
+  profiler->ntimers    = 0;
+  profiler->max_timers = max_entries;
+
   if (SUNHashMap_New(max_entries, &profiler->map))
   {
-    sunTimerStructFree((void*)profiler->overhead);
+    free(profiler->timers);
     free(profiler);
     *p = profiler = NULL;
     return SUN_ERR_MALLOC_FAIL;
@@ -197,7 +1101,10 @@ SUNErrCode SUNProfiler_Create(SUNComm comm, const char* title, SUNProfiler* p)
 #else
   if (comm != SUN_COMM_NULL)
   {
+    SUNHashMap_Destroy(&profiler->map, sunNoFree);
+    free(profiler->timers);
     free(profiler);
+    *p = NULL;
     return -1;
   }
   profiler->comm = SUN_COMM_NULL;
@@ -211,22 +1118,123 @@ SUNErrCode SUNProfiler_Create(SUNComm comm, const char* title, SUNProfiler* p)
   /* Initialize the overall timer to 0. */
   profiler->sundials_time = 0.0;
 
+  profiler->clock_cost = sunEstimateClockCost();
+
   SUNDIALS_MARK_BEGIN(profiler, SUNDIALS_ROOT_TIMER);
-  sunStopTiming(profiler->overhead);
+  sunStopTiming(&profiler->overhead);
 
   return SUN_SUCCESS;
 }
 
+SUNErrCode SUNProfiler_Create(SUNComm comm, const char* title, SUNProfiler* p)
+{
+  return sunProfilerCreate(comm, title, 0, p);
+}
+
+#if defined(SUNDIALS_ENABLE_THREAD_SAFE_CONTEXT)
+
+/* Get the profiler that the calling thread records into, creating a shard for
+   threads other than the owner on first use. The shards are merged into the
+   profiler when it is printed. */
+static SUNProfiler sunProfilerShard(SUNProfiler p, sunbooleantype create)
+{
+  SUNProfiler shard = NULL;
+
+  if (p->is_shard || p->owner == sunThreadSelf()) { return p; }
+
+  shard = (SUNProfiler)sunThreadKeyGet(p->shard_key);
+  if (shard || !create) { return shard; }
+
+  if (sunProfilerCreate(SUN_COMM_NULL, p->title, 1, &shard) || !shard)
+  {
+    return NULL;
+  }
+
+  if (sunThreadKeySet(p->shard_key, shard))
+  {
+    SUNProfiler_Free(&shard);
+    return NULL;
+  }
+
+  sunMutexLock(&p->shard_lock);
+  shard->next_shard = p->shards;
+  p->shards         = shard;
+  sunMutexUnlock(&p->shard_lock);
+
+  return shard;
+}
+
+/* Add the timers of the shards to the profiler and clear the shards */
+static SUNErrCode sunMergeShards(SUNProfiler p)
+{
+  int i;
+  SUNErrCode ier;
+  SUNProfiler shard;
+  sunTimerStruct* timer;
+
+  sunMutexLock(&p->shard_lock);
+  for (shard = p->shards; shard; shard = shard->next_shard)
+  {
+    for (i = 0; i < shard->ntimers; i++)
+    {
+      /* The time since the epoch is only kept by the owning profiler */
+      if (!strcmp(shard->timers[i].name, SUNDIALS_ROOT_TIMER)) { continue; }
+      if (!shard->timers[i].count) { continue; }
+
+      ier = sunLookupTimer(p, shard->timers[i].name, SUNTRUE, &timer);
+      if (ier)
+      {
+        sunMutexUnlock(&p->shard_lock);
+        return ier;
+      }
+      timer->elapsed += shard->timers[i].elapsed;
+      timer->average = timer->elapsed;
+      timer->maximum = timer->elapsed;
+      timer->count += shard->timers[i].count;
+      sunResetTiming(&shard->timers[i]);
+    }
+    p->nmarks += shard->nmarks;
+    shard->nmarks = 0;
+  }
+  sunMutexUnlock(&p->shard_lock);
+
+  return SUN_SUCCESS;
+}
+
+#endif
+
 SUNErrCode SUNProfiler_Free(SUNProfiler* p)
 {
+  int i;
+
   if (!p || !(*p)) { return SUN_SUCCESS; }
 
   SUNDIALS_MARK_END(*p, SUNDIALS_ROOT_TIMER);
 
+#if defined(SUNDIALS_ENABLE_THREAD_SAFE_CONTEXT)
+  if (!(*p)->is_shard)
+  {
+    SUNProfiler shard = (*p)->shards;
+    while (shard)
+    {
+      SUNProfiler next = shard->next_shard;
+      SUNProfiler_Free(&shard);
+      shard = next;
+    }
+    sunThreadKeyDelete((*p)->shard_key);
+    sunMutexDestroy(&(*p)->shard_lock);
+  }
+#endif
+
   if (*p)
   {
-    SUNHashMap_Destroy(&(*p)->map, sunTimerStructFree);
-    sunTimerStructFree((void*)(*p)->overhead);
+    if ((*p)->trace && (*p)->trace_filename) { sunWriteTraceFile(*p); }
+    sunTraceFree(*p);
+    free((*p)->trace_filename);
+    sunCountersFree(*p);
+    SUNHashMap_Destroy(&(*p)->map, sunNoFree);
+    for (i = 0; i < (*p)->ntimers; i++) { free((*p)->timers[i].name); }
+    free((*p)->timers);
 #if SUNDIALS_MPI_ENABLED
     if ((*p)->comm != SUN_COMM_NULL) { MPI_Comm_free(&(*p)->comm); }
 #endif
@@ -238,55 +1246,169 @@ SUNErrCode SUNProfiler_Free(SUNProfiler* p)
   return SUN_SUCCESS;
 }
 
-SUNErrCode SUNProfiler_Begin(SUNProfiler p, const char* name)
+static void sunPushRegion(SUNProfiler p, sunTimerStruct* timer)
 {
-  SUNErrCode ier;
-  sunTimerStruct* timer = NULL;
+  if (p->region_depth < SUNDIALS_REGION_STACK_SIZE)
+  {
+    p->region_stack[p->region_depth] = (int)(timer - p->timers);
+  }
+  p->region_depth++;
+}
 
-  if (!p) { return SUN_ERR_ARG_CORRUPT; }
+/* Close the innermost open region for this timer and any regions opened
+   inside it that were not ended */
+static void sunPopRegion(SUNProfiler p, sunTimerStruct* timer)
+{
+  int depth;
+  int index = (int)(timer - p->timers);
 
-  sunStartTiming(p->overhead);
+  if (p->region_depth > SUNDIALS_REGION_STACK_SIZE)
+  {
+    p->region_depth--;
+    return;
+  }
 
-  if (SUNHashMap_GetValue(p->map, name, (void**)&timer))
+  for (depth = p->region_depth - 1; depth >= 0; depth--)
   {
-    timer = sunTimerStructNew();
-    ier   = SUNHashMap_Insert(p->map, name, (void*)timer);
-    if (ier)
+    if (p->region_stack[depth] == index)
     {
-      sunTimerStructFree(timer);
-      sunStopTiming(p->overhead);
-      if (ier == -1) { return SUN_ERR_PROFILER_MAPINSERT; }
-      if (ier == -2) { return SUN_ERR_PROFILER_MAPFULL; }
+      p->region_depth = depth;
+      return;
     }
   }
+}
+
+const char* sunProfilerCurrentRegion(SUNProfiler p, const char* skip)
+{
+  int depth;
+  const char* name;
+
+  if (!p) { return NULL; }
+
+#if defined(SUNDIALS_ENABLE_THREAD_SAFE_CONTEXT)
+  p = sunProfilerShard(p, SUNFALSE);
+  if (!p) { return NULL; }
+#endif
+
+  depth = SUNMIN(p->region_depth, SUNDIALS_REGION_STACK_SIZE);
+
+  for (; depth > 0; depth--)
+  {
+    name = p->timers[p->region_stack[depth - 1]].name;
+    if (!skip || strcmp(name, skip)) { return name; }
+  }
+
+  return NULL;
+}
 
+static void sunBeginRegion(SUNProfiler p, sunTimerStruct* timer)
+{
+  p->nmarks++;
   timer->count++;
+  sunPushRegion(p, timer);
+  if (p->counters) { sunCountersBegin(p, timer); }
   sunStartTiming(timer);
+  if (p->trace) { sunTraceBegin(p, timer); }
+}
+
+static void sunEndRegion(SUNProfiler p, sunTimerStruct* timer)
+{
+  sunTimespec toc;
+
+  p->nmarks++;
+  sunclock_gettime_monotonic(&toc);
+  sunStopTimingAt(timer, &toc);
+  sunPopRegion(p, timer);
+  if (p->counters) { sunCountersEnd(p, timer); }
+  if (p->trace) { sunTraceEnd(p, timer, &toc); }
+}
+
+SUNErrCode SUNProfiler_Begin(SUNProfiler p, const char* name)
+{
+  SUNErrCode ier;
+  sunTimerStruct* timer = NULL;
+
+  if (!p) { return SUN_ERR_ARG_CORRUPT; }
+
+#if defined(SUNDIALS_ENABLE_THREAD_SAFE_CONTEXT)
+  p = sunProfilerShard(p, SUNTRUE);
+  if (!p) { return SUN_ERR_MALLOC_FAIL; }
+#endif
+
+  ier = sunLookupTimer(p, name, SUNTRUE, &timer);
+  if (ier) { return ier; }
+
+  sunBeginRegion(p, timer);
 
-  sunStopTiming(p->overhead);
   return SUN_SUCCESS;
 }
 
 SUNErrCode SUNProfiler_End(SUNProfiler p, const char* name)
 {
   SUNErrCode ier;
-  sunTimerStruct* timer;
+  sunTimerStruct* timer = NULL;
 
   if (!p) { return SUN_ERR_ARG_CORRUPT; }
 
-  sunStartTiming(p->overhead);
+#if defined(SUNDIALS_ENABLE_THREAD_SAFE_CONTEXT)
+  p = sunProfilerShard(p, SUNFALSE);
+  if (!p) { return SUN_ERR_PROFILER_MAPKEYNOTFOUND; }
+#endif
 
-  ier = SUNHashMap_GetValue(p->map, name, (void**)&timer);
-  if (ier)
-  {
-    sunStopTiming(p->overhead);
-    if (ier == -1) { return SUN_ERR_PROFILER_MAPGET; }
-    if (ier == -2) { return SUN_ERR_PROFILER_MAPKEYNOTFOUND; }
-  }
+  ier = sunLookupTimer(p, name, SUNFALSE, &timer);
+  if (ier) { return ier; }
 
-  sunStopTiming(timer);
+  sunEndRegion(p, timer);
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNProfiler_RegisterTimer(SUNProfiler p, const char* name,
+                                     int* handle)
+{
+  SUNErrCode ier;
+  sunTimerStruct* timer = NULL;
+
+  if (!p || !name || !handle) { return SUN_ERR_ARG_CORRUPT; }
+
+  ier = sunLookupTimer(p, name, SUNTRUE, &timer);
+  if (ier) { return ier; }
+
+  *handle = (int)(timer - p->timers);
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNProfiler_BeginTimer(SUNProfiler p, int handle)
+{
+  if (!p) { return SUN_ERR_ARG_CORRUPT; }
+  if (handle < 0 || handle >= p->ntimers) { return SUN_ERR_ARG_OUTOFRANGE; }
+
+#if defined(SUNDIALS_ENABLE_THREAD_SAFE_CONTEXT)
+  /* The handles are indices into the timers of the owning profiler */
+  SUNProfiler shard = sunProfilerShard(p, SUNTRUE);
+  if (!shard) { return SUN_ERR_MALLOC_FAIL; }
+  if (shard != p) { return SUNProfiler_Begin(shard, p->timers[handle].name); }
+#endif
+
+  sunBeginRegion(p, &p->timers[handle]);
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNProfiler_EndTimer(SUNProfiler p, int handle)
+{
+  if (!p) { return SUN_ERR_ARG_CORRUPT; }
+  if (handle < 0 || handle >= p->ntimers) { return SUN_ERR_ARG_OUTOFRANGE; }
+
+#if defined(SUNDIALS_ENABLE_THREAD_SAFE_CONTEXT)
+  SUNProfiler shard = sunProfilerShard(p, SUNFALSE);
+  if (!shard) { return SUN_ERR_PROFILER_MAPKEYNOTFOUND; }
+  if (shard != p) { return SUNProfiler_End(shard, p->timers[handle].name); }
+#endif
+
+  sunEndRegion(p, &p->timers[handle]);
 
-  sunStopTiming(p->overhead);
   return SUN_SUCCESS;
 }
 
@@ -296,7 +1418,7 @@ SUNErrCode SUNProfiler_GetTimerResolution(SUNProfiler p, double* resolution)
 
 #if defined(SUNDIALS_HAVE_POSIX_TIMERS)
   sunTimespec spec;
-  clock_getres(CLOCK_MONOTONIC, &spec);
+  clock_getres(SUNDIALS_CLOCK_ID, &spec);
   *resolution = 1e-9 * ((double)spec.tv_nsec);
 
   return SUN_SUCCESS;
@@ -333,28 +1455,52 @@ SUNErrCode SUNProfiler_GetElapsedTime(SUNProfiler p, const char* name,
 
 SUNErrCode SUNProfiler_Reset(SUNProfiler p)
 {
-  int i                 = 0;
-  sunTimerStruct* timer = NULL;
+  int i = 0;
 
   if (!p) { return SUN_ERR_ARG_CORRUPT; }
 
   /* Reset the overhead timer */
-  sunResetTiming(p->overhead);
-  sunStartTiming(p->overhead);
+  sunResetTiming(&p->overhead);
+  sunStartTiming(&p->overhead);
+  p->nmarks = 0;
 
   /* Reset all timers */
-  for (i = 0; i < p->map->max_size; i++)
+  for (i = 0; i < p->ntimers; i++) { sunResetTiming(&p->timers[i]); }
+  p->region_depth = 0;
+
+#if defined(SUNDIALS_ENABLE_THREAD_SAFE_CONTEXT)
+  /* Reset the timers of the other threads */
+  if (!p->is_shard)
   {
-    if (!(p->map->buckets[i])) { continue; }
-    timer = p->map->buckets[i]->value;
-    if (timer) { sunResetTiming(timer); }
+    SUNProfiler shard;
+    sunMutexLock(&p->shard_lock);
+    for (shard = p->shards; shard; shard = shard->next_shard)
+    {
+      for (i = 0; i < shard->ntimers; i++)
+      {
+        sunResetTiming(&shard->timers[i]);
+      }
+      shard->nmarks       = 0;
+      shard->region_depth = 0;
+    }
+    sunMutexUnlock(&p->shard_lock);
   }
+#endif
+
+  /* Clear the counters */
+  if (p->counters)
+  {
+    memset(p->counters, 0, p->max_timers * sizeof(sunCounterSet));
+  }
+
+  /* Clear the trace */
+  if (p->trace) { sunTraceReset(p); }
 
   /* Reset the overall timer. */
   p->sundials_time = 0.0;
 
   SUNDIALS_MARK_BEGIN(p, SUNDIALS_ROOT_TIMER);
-  sunStopTiming(p->overhead);
+  sunStopTiming(&p->overhead);
 
   return SUN_SUCCESS;
 }
@@ -364,12 +1510,22 @@ SUNErrCode SUNProfiler_Print(SUNProfiler p, FILE* fp)
   SUNErrCode ier             = 0;
   int i                      = 0;
   int rank                   = 0;
+  double overhead            = 0.0;
   sunTimerStruct* timer      = NULL;
   SUNHashMapKeyValue* sorted = NULL;
 
   if (!p) { return SUN_ERR_ARG_CORRUPT; }
 
-  sunStartTiming(p->overhead);
+  sunStartTiming(&p->overhead);
+
+#if defined(SUNDIALS_ENABLE_THREAD_SAFE_CONTEXT)
+  /* Include the regions timed by other threads */
+  if (!p->is_shard)
+  {
+    ier = sunMergeShards(p);
+    if (ier) { return ier; }
+  }
+#endif
 
   /* Get the total SUNDIALS time up to this point */
   SUNDIALS_MARK_END(p, SUNDIALS_ROOT_TIMER);
@@ -421,17 +1577,44 @@ SUNErrCode SUNProfiler_Print(SUNProfiler p, FILE* fp)
     {
       if (sorted[i]) { sunPrintTimer(sorted[i], fp, (void*)p); }
     }
-    free(sorted);
   }
 
-  sunStopTiming(p->overhead);
+  sunStopTiming(&p->overhead);
+
+  /* The overhead of starting and stopping timers is estimated from the number
+     of clock reads rather than timed, since timing it would double the cost */
+  overhead = p->overhead.elapsed + p->nmarks * p->clock_cost;
+  if (p->counters) { overhead += p->nmarks * p->counter_cost; }
 
   if (rank == 0)
   {
     /* Print out the total time and the profiler overhead */
     fprintf(fp, "%-40s\t %6.2f%% \t         %.6fs \t -- \t\t -- \n",
-            "Est. profiler overhead", p->overhead->elapsed / p->sundials_time,
-            p->overhead->elapsed);
+            "Est. profiler overhead", overhead / p->sundials_time * 100,
+            overhead);
+
+#if defined(SUNDIALS_ENABLE_THREAD_SAFE_CONTEXT)
+    /* The shards only time regions, the trace and counters are not copied */
+    if (p->shards && (p->trace || p->counters))
+    {
+      fprintf(fp, "WARNING: the call tree, trace, and hardware counters only "
+                  "include the thread that created the profiler\n");
+    }
+#endif
+
+    /* Print the hardware counters of this rank when they were requested */
+    if (p->counters || p->counter_error) { sunPrintCounters(p, fp, sorted); }
+    free(sorted);
+
+    /* Print the call tree of this rank when tracing */
+    if (p->trace)
+    {
+      fprintf(fp, "\n%-40s\t inclusive \t exclusive \t count \n",
+              "CALL TREE:");
+      fprintf(fp, "=============================================================="
+                  "==================================================\n");
+      sunPrintCallTree(p, fp, 0, 0);
+    }
 
     /* End of output */
     fprintf(fp, "\n");
@@ -473,9 +1656,9 @@ SUNErrCode sunCollectTimers(SUNProfiler p)
 
   /* Register MPI datatype for sunTimerStruct */
   MPI_Datatype tmp_type, MPI_sunTimerStruct;
-  const int block_lens[2]     = {5, 1};
+  const int block_lens[2]     = {3, 1};
   const MPI_Datatype types[2] = {MPI_DOUBLE, MPI_LONG};
-  const MPI_Aint displ[2]     = {offsetof(sunTimerStruct, tic),
+  const MPI_Aint displ[2]     = {offsetof(sunTimerStruct, average),
                                  offsetof(sunTimerStruct, count)};
   MPI_Aint lb, extent;
 
@@ -520,6 +1703,9 @@ SUNErrCode sunCollectTimers(SUNProfiler p)
 }
 #endif
 
+/* Timers are owned by the profiler, not the map */
+void sunNoFree(SUNDIALS_MAYBE_UNUSED void* ptr) {}
+
 /* Print out the: timer name, percentage of exec time (based on the max),
    max across ranks, average across ranks, and the timer counter. */
 void sunPrintTimer(SUNHashMapKeyValue kv, FILE* fp, void* pvoid)
@@ -561,7 +1747,7 @@ int sunCompareTimes(const void* l, const void* r)
 int sunclock_gettime_monotonic(sunTimespec* ts)
 {
 #if defined(SUNDIALS_HAVE_POSIX_TIMERS)
-  return clock_gettime(CLOCK_MONOTONIC, ts);
+  return clock_gettime(SUNDIALS_CLOCK_ID, ts);
 #elif (defined(WIN32) || defined(_WIN32))
   static LARGE_INTEGER ticks_per_sec;
   LARGE_INTEGER ticks;
@@ -0,0 +1,27 @@
+/* -----------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * SUNDIALS profiler functions used by other parts of the core
+ * library.
+ * ----------------------------------------------------------------*/
+
+#ifndef _SUNDIALS_PROFILER_IMPL_H
+#define _SUNDIALS_PROFILER_IMPL_H
+
+#include <sundials/sundials_profiler.h>
+
+/* Name of the innermost open region other than skip (may be NULL), or NULL
+   if there is no such region */
+const char* sunProfilerCurrentRegion(SUNProfiler p, const char* skip);
+
+#endif
@@ -0,0 +1,337 @@
+/* -----------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the implementation of the SUNTelemetry ring buffer.
+ * -----------------------------------------------------------------*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <sundials/priv/sundials_telemetry_impl.h>
+#include <sundials/sundials_config.h>
+#include <sundials/sundials_errors.h>
+#include <sundials/sundials_telemetry.h>
+#include <sundials/sundials_types.h>
+
+#if defined(SUNDIALS_HAVE_POSIX_TIMERS)
+#include <time.h>
+#elif defined(WIN32) || defined(_WIN32)
+#include <windows.h>
+#endif
+
+/* Default number of records kept in the ring buffer */
+#define SUN_TELEMETRY_CAPACITY 4096
+
+/* Binary file magic number */
+#define SUN_TELEMETRY_MAGIC "SUNTEL01"
+
+typedef struct
+{
+  char magic[8];
+  uint32_t byte_order;  /* 0x01020304 written in native byte order */
+  uint32_t record_size; /* size of a SUNTelemetryRecord             */
+} sunTelemetryFileHeader;
+
+/*
+  SUNTelemetry_ structure
+
+  The records are kept in a ring buffer. When the buffer is full, the records
+  are appended to the binary file if one is attached, otherwise the oldest
+  record is overwritten and counted as dropped.
+ */
+
+struct SUNTelemetry_
+{
+  SUNTelemetryRecord* records; /* ring buffer                       */
+  long capacity;               /* size of the ring buffer           */
+  long first;                  /* index of the oldest record        */
+  long count;                  /* number of records in the buffer   */
+  long ndropped;               /* number of overwritten records     */
+  FILE* fp;                    /* binary file (NULL if not written) */
+};
+
+static SUNErrCode sunTelemetryWrite(SUNTelemetry tel)
+{
+  long n1, n2;
+
+  if (!tel->fp || !tel->count) { return SUN_SUCCESS; }
+
+  /* Write the records in order, the buffer may wrap around */
+  n1 = tel->capacity - tel->first;
+  if (n1 > tel->count) { n1 = tel->count; }
+  n2 = tel->count - n1;
+
+  if (fwrite(tel->records + tel->first, sizeof(SUNTelemetryRecord), n1,
+             tel->fp) != (size_t)n1)
+  {
+    return SUN_ERR_OP_FAIL;
+  }
+  if (n2 > 0 && fwrite(tel->records, sizeof(SUNTelemetryRecord), n2,
+                       tel->fp) != (size_t)n2)
+  {
+    return SUN_ERR_OP_FAIL;
+  }
+
+  tel->first = 0;
+  tel->count = 0;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNTelemetry_Create(long capacity, SUNTelemetry* tel_ptr)
+{
+  SUNTelemetry tel = NULL;
+
+  if (tel_ptr == NULL) { return SUN_ERR_ARG_CORRUPT; }
+
+  if (capacity <= 0) { capacity = SUN_TELEMETRY_CAPACITY; }
+
+  tel = (SUNTelemetry)malloc(sizeof(*tel));
+  if (tel == NULL) { return SUN_ERR_MALLOC_FAIL; }
+
+  tel->records = (SUNTelemetryRecord*)malloc(capacity *
+                                             sizeof(SUNTelemetryRecord));
+  if (tel->records == NULL)
+  {
+    free(tel);
+    return SUN_ERR_MALLOC_FAIL;
+  }
+
+  tel->capacity = capacity;
+  tel->first    = 0;
+  tel->count    = 0;
+  tel->ndropped = 0;
+  tel->fp       = NULL;
+
+  *tel_ptr = tel;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNTelemetry_Destroy(SUNTelemetry* tel_ptr)
+{
+  SUNTelemetry tel;
+
+  if (tel_ptr == NULL || *tel_ptr == NULL) { return SUN_SUCCESS; }
+
+  tel = *tel_ptr;
+
+  if (tel->fp)
+  {
+    sunTelemetryWrite(tel);
+    fclose(tel->fp);
+  }
+
+  free(tel->records);
+  free(tel);
+  *tel_ptr = NULL;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNTelemetry_SetBinaryFilename(SUNTelemetry tel,
+                                          const char* filename)
+{
+  SUNErrCode err;
+  sunTelemetryFileHeader header;
+
+  if (tel == NULL) { return SUN_ERR_ARG_CORRUPT; }
+
+  /* Finish the current file */
+  if (tel->fp)
+  {
+    err = sunTelemetryWrite(tel);
+    fclose(tel->fp);
+    tel->fp = NULL;
+    if (err) { return err; }
+  }
+
+  if (filename == NULL || !strcmp(filename, "")) { return SUN_SUCCESS; }
+
+  tel->fp = fopen(filename, "wb");
+  if (tel->fp == NULL) { return SUN_ERR_FILE_OPEN; }
+
+  memcpy(header.magic, SUN_TELEMETRY_MAGIC, sizeof(header.magic));
+  header.byte_order  = 0x01020304;
+  header.record_size = (uint32_t)sizeof(SUNTelemetryRecord);
+
+  if (fwrite(&header, sizeof(header), 1, tel->fp) != 1)
+  {
+    fclose(tel->fp);
+    tel->fp = NULL;
+    return SUN_ERR_OP_FAIL;
+  }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNTelemetry_Record(SUNTelemetry tel, const SUNTelemetryRecord* rec)
+{
+  SUNErrCode err;
+  long last;
+
+  if (tel == NULL || rec == NULL) { return SUN_ERR_ARG_CORRUPT; }
+
+  if (tel->count == tel->capacity)
+  {
+    if (tel->fp)
+    {
+      err = sunTelemetryWrite(tel);
+      if (err) { return err; }
+    }
+    else
+    {
+      /* Overwrite the oldest record */
+      tel->first = (tel->first + 1) % tel->capacity;
+      tel->count--;
+      tel->ndropped++;
+    }
+  }
+
+  last = (tel->first + tel->count) % tel->capacity;
+  tel->records[last] = *rec;
+  tel->count++;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNTelemetry_Drain(SUNTelemetry tel, SUNTelemetryRecord* records,
+                              long max_records, long* num_records)
+{
+  long i, n;
+
+  if (tel == NULL || num_records == NULL) { return SUN_ERR_ARG_CORRUPT; }
+  if (records == NULL && max_records > 0) { return SUN_ERR_ARG_CORRUPT; }
+
+  n = (max_records < tel->count) ? max_records : tel->count;
+  if (n < 0) { n = 0; }
+
+  for (i = 0; i < n; i++)
+  {
+    records[i] = tel->records[(tel->first + i) % tel->capacity];
+  }
+
+  tel->first = (tel->first + n) % tel->capacity;
+  tel->count -= n;
+
+  *num_records = n;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNTelemetry_Flush(SUNTelemetry tel)
+{
+  SUNErrCode err;
+
+  if (tel == NULL) { return SUN_ERR_ARG_CORRUPT; }
+
+  if (tel->fp)
+  {
+    err = sunTelemetryWrite(tel);
+    if (err) { return err; }
+    fflush(tel->fp);
+  }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNTelemetry_GetNumRecords(SUNTelemetry tel, long* num_records)
+{
+  if (tel == NULL || num_records == NULL) { return SUN_ERR_ARG_CORRUPT; }
+  *num_records = tel->count;
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNTelemetry_GetNumDropped(SUNTelemetry tel, long* num_dropped)
+{
+  if (tel == NULL || num_dropped == NULL) { return SUN_ERR_ARG_CORRUPT; }
+  *num_dropped = tel->ndropped;
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNTelemetry_Print(SUNTelemetry tel, FILE* fp)
+{
+  long i;
+  long nni = 0, nli = 0, netf = 0, ncfn = 0, nsetups = 0;
+  double hmin = 0.0, hmax = 0.0;
+  double wall_step = 0.0, wall_nls = 0.0, wall_lsetup = 0.0, wall_lsolve = 0.0;
+  double pct = 0.0;
+  const SUNTelemetryRecord* rec;
+
+  if (tel == NULL || fp == NULL) { return SUN_ERR_ARG_CORRUPT; }
+
+  for (i = 0; i < tel->count; i++)
+  {
+    rec = tel->records + (tel->first + i) % tel->capacity;
+    if (i == 0 || rec->h < hmin) { hmin = rec->h; }
+    if (i == 0 || rec->h > hmax) { hmax = rec->h; }
+    nni += rec->nni;
+    nli += rec->nli;
+    netf += rec->netf;
+    ncfn += rec->ncfn;
+    if (rec->flags & SUN_TELEMETRY_LSETUP) { nsetups++; }
+    wall_step += rec->wall_step;
+    wall_nls += rec->wall_nls;
+    wall_lsetup += rec->wall_lsetup;
+    wall_lsolve += rec->wall_lsolve;
+  }
+
+  if (wall_step > 0.0) { pct = 100.0 / wall_step; }
+
+  fprintf(fp, "%-30s = %ld\n", "Telemetry records", tel->count);
+  fprintf(fp, "%-30s = %ld\n", "Dropped records", tel->ndropped);
+  if (tel->count == 0) { return SUN_SUCCESS; }
+  fprintf(fp, "%-30s = %lld - %lld\n", "Steps",
+          (long long)tel->records[tel->first].step,
+          (long long)tel->records[(tel->first + tel->count - 1) % tel->capacity]
+            .step);
+  fprintf(fp, "%-30s = %.6e\n", "Min step size", hmin);
+  fprintf(fp, "%-30s = %.6e\n", "Max step size", hmax);
+  fprintf(fp, "%-30s = %ld\n", "Nonlinear iterations", nni);
+  fprintf(fp, "%-30s = %ld\n", "Linear iterations", nli);
+  fprintf(fp, "%-30s = %ld\n", "Error test fails", netf);
+  fprintf(fp, "%-30s = %ld\n", "Nonlinear convergence fails", ncfn);
+  fprintf(fp, "%-30s = %ld\n", "Steps with linear solver setup", nsetups);
+  fprintf(fp, "%-30s = %.6e s\n", "Wall time in steps", wall_step);
+  fprintf(fp, "%-30s = %.6e s (%.1f%%)\n", "Wall time in nonlinear solver",
+          wall_nls, wall_nls * pct);
+  fprintf(fp, "%-30s = %.6e s (%.1f%%)\n", "Wall time in linear setup",
+          wall_lsetup, wall_lsetup * pct);
+  fprintf(fp, "%-30s = %.6e s (%.1f%%)\n", "Wall time in linear solve",
+          wall_lsolve, wall_lsolve * pct);
+  fprintf(fp, "%-30s = %.6e s\n", "Average wall time per step",
+          wall_step / tel->count);
+
+  return SUN_SUCCESS;
+}
+
+double sunTelemetryWallTime(void)
+{
+#if defined(SUNDIALS_HAVE_POSIX_TIMERS)
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + 1.0e-9 * (double)ts.tv_nsec;
+#elif defined(WIN32) || defined(_WIN32)
+  static LARGE_INTEGER ticks_per_sec;
+  LARGE_INTEGER ticks;
+
+  if (!ticks_per_sec.QuadPart) { QueryPerformanceFrequency(&ticks_per_sec); }
+  QueryPerformanceCounter(&ticks);
+
+  return (double)ticks.QuadPart / (double)ticks_per_sec.QuadPart;
+#else
+  return 0.0;
+#endif
+}
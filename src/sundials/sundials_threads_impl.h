@@ -0,0 +1,214 @@
+/* -----------------------------------------------------------------
+ * Programmer(s): Cody J. Balos @ LLNL
+ * -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * Minimal mutex and thread-specific storage wrappers used to make
+ * the SUNContext, SUNLogger, and SUNProfiler safe to share between
+ * threads when SUNDIALS_ENABLE_THREAD_SAFE_CONTEXT is defined, and
+ * condition variable and thread wrappers used by the SUNTimeSeries
+ * writer thread, the SUNLogger flush thread, and the IDAS adjoint
+ * check point storage thread when SUNDIALS_ENABLE_ASYNC_OUTPUT is
+ * defined. The thread wrappers are
+ * also used by the Matrix Market reader when
+ * SUNDIALS_ENABLE_THREADED_MATRIX_READ is defined.
+ * ----------------------------------------------------------------*/
+
+#ifndef _SUNDIALS_THREADS_IMPL_H
+#define _SUNDIALS_THREADS_IMPL_H
+
+#include <stdint.h>
+#include <sundials/sundials_config.h>
+
+#if defined(SUNDIALS_ENABLE_THREAD_SAFE_CONTEXT) || \
+  defined(SUNDIALS_ENABLE_ASYNC_OUTPUT) ||         \
+  defined(SUNDIALS_ENABLE_THREADED_MATRIX_READ)
+
+#if defined(_WIN32)
+#include <stdlib.h>
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
+
+#if defined(_WIN32)
+
+typedef SRWLOCK sunMutex;
+typedef DWORD sunThreadKey;
+
+static inline int sunMutexInit(sunMutex* m)
+{
+  InitializeSRWLock(m);
+  return 0;
+}
+
+static inline void sunMutexDestroy(sunMutex* m) { (void)m; }
+
+static inline void sunMutexLock(sunMutex* m) { AcquireSRWLockExclusive(m); }
+
+static inline void sunMutexUnlock(sunMutex* m) { ReleaseSRWLockExclusive(m); }
+
+static inline int sunThreadKeyCreate(sunThreadKey* key)
+{
+  *key = TlsAlloc();
+  return (*key == TLS_OUT_OF_INDEXES) ? 1 : 0;
+}
+
+static inline void sunThreadKeyDelete(sunThreadKey key) { TlsFree(key); }
+
+static inline void* sunThreadKeyGet(sunThreadKey key)
+{
+  return TlsGetValue(key);
+}
+
+static inline int sunThreadKeySet(sunThreadKey key, void* value)
+{
+  return TlsSetValue(key, value) ? 0 : 1;
+}
+
+static inline unsigned long sunThreadSelf(void)
+{
+  return (unsigned long)GetCurrentThreadId();
+}
+
+typedef CONDITION_VARIABLE sunCond;
+typedef HANDLE sunThread;
+typedef void* (*sunThreadFn)(void*);
+
+static inline int sunCondInit(sunCond* c)
+{
+  InitializeConditionVariable(c);
+  return 0;
+}
+
+static inline void sunCondDestroy(sunCond* c) { (void)c; }
+
+static inline void sunCondWait(sunCond* c, sunMutex* m)
+{
+  SleepConditionVariableSRW(c, m, INFINITE, 0);
+}
+
+static inline void sunCondSignal(sunCond* c) { WakeConditionVariable(c); }
+
+static inline void sunCondBroadcast(sunCond* c)
+{
+  WakeAllConditionVariable(c);
+}
+
+typedef struct
+{
+  sunThreadFn fn;
+  void* arg;
+} sunThreadStart;
+
+static inline DWORD WINAPI sunThreadTrampoline(LPVOID p)
+{
+  sunThreadStart start = *(sunThreadStart*)p;
+  free(p);
+  start.fn(start.arg);
+  return 0;
+}
+
+static inline int sunThreadCreate(sunThread* t, sunThreadFn fn, void* arg)
+{
+  sunThreadStart* start = (sunThreadStart*)malloc(sizeof(*start));
+  if (start == NULL) { return 1; }
+  start->fn  = fn;
+  start->arg = arg;
+  *t         = CreateThread(NULL, 0, sunThreadTrampoline, start, 0, NULL);
+  if (*t == NULL)
+  {
+    free(start);
+    return 1;
+  }
+  return 0;
+}
+
+static inline void sunThreadJoin(sunThread t)
+{
+  WaitForSingleObject(t, INFINITE);
+  CloseHandle(t);
+}
+
+#else
+
+typedef pthread_mutex_t sunMutex;
+typedef pthread_key_t sunThreadKey;
+
+static inline int sunMutexInit(sunMutex* m)
+{
+  return pthread_mutex_init(m, NULL);
+}
+
+static inline void sunMutexDestroy(sunMutex* m) { pthread_mutex_destroy(m); }
+
+static inline void sunMutexLock(sunMutex* m) { pthread_mutex_lock(m); }
+
+static inline void sunMutexUnlock(sunMutex* m) { pthread_mutex_unlock(m); }
+
+static inline int sunThreadKeyCreate(sunThreadKey* key)
+{
+  return pthread_key_create(key, NULL);
+}
+
+static inline void sunThreadKeyDelete(sunThreadKey key)
+{
+  pthread_key_delete(key);
+}
+
+static inline void* sunThreadKeyGet(sunThreadKey key)
+{
+  return pthread_getspecific(key);
+}
+
+static inline int sunThreadKeySet(sunThreadKey key, void* value)
+{
+  return pthread_setspecific(key, value);
+}
+
+static inline unsigned long sunThreadSelf(void)
+{
+  return (unsigned long)(uintptr_t)pthread_self();
+}
+
+typedef pthread_cond_t sunCond;
+typedef pthread_t sunThread;
+typedef void* (*sunThreadFn)(void*);
+
+static inline int sunCondInit(sunCond* c)
+{
+  return pthread_cond_init(c, NULL);
+}
+
+static inline void sunCondDestroy(sunCond* c) { pthread_cond_destroy(c); }
+
+static inline void sunCondWait(sunCond* c, sunMutex* m)
+{
+  pthread_cond_wait(c, m);
+}
+
+static inline void sunCondSignal(sunCond* c) { pthread_cond_signal(c); }
+
+static inline void sunCondBroadcast(sunCond* c) { pthread_cond_broadcast(c); }
+
+static inline int sunThreadCreate(sunThread* t, sunThreadFn fn, void* arg)
+{
+  return pthread_create(t, NULL, fn, arg);
+}
+
+static inline void sunThreadJoin(sunThread t) { pthread_join(t, NULL); }
+
+#endif
+
+#endif /* SUNDIALS_ENABLE_THREAD_SAFE_CONTEXT || SUNDIALS_ENABLE_ASYNC_OUTPUT \
+          || SUNDIALS_ENABLE_THREADED_MATRIX_READ */
+
+#endif
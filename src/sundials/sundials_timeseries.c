@@ -0,0 +1,538 @@
+/* -----------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This is the implementation of the SUNTimeSeries writer.
+ * -----------------------------------------------------------------*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <sundials/sundials_config.h>
+#include <sundials/sundials_errors.h>
+#include <sundials/sundials_nvector.h>
+#include <sundials/sundials_timeseries.h>
+#include <sundials/sundials_types.h>
+
+#include "sundials_threads_impl.h"
+#include "sundials_utils.h"
+
+/* Binary file magic number */
+#define SUN_TIMESERIES_MAGIC "SUNTS001"
+
+/* Snapshots start on multiples of this many bytes */
+#define SUN_TIMESERIES_ALIGN 64
+
+/* Initial number of snapshot times kept in memory */
+#define SUN_TIMESERIES_CAPACITY 64
+
+/*
+  File layout
+
+  The file starts with the header below (64 bytes). Snapshot k is the packed
+  vector (see N_VBufPack) at byte offset data_offset + k * snapshot_stride.
+  The index, an array of num_snapshots sunrealtype values with the snapshot
+  times, starts at index_offset. The header and index are written when the
+  time series is flushed or destroyed. Appending a snapshot after a flush
+  overwrites the index, which is written again at the next flush.
+
+  Asynchronous output
+
+  With SUNTimeSeries_SetAsync, snapshot k is packed into buffer k % nbuffers
+  by the calling thread and written by a background thread. Buffers are
+  written in order, so buffer k % nbuffers is free once nwritten > k -
+  nbuffers. When all buffers are in use, SUNTimeSeries_Append waits for the
+  writer thread (and counts a stall). The times array is only used by the
+  calling thread, the file is only used by the writer thread until the queue
+  is drained.
+ */
+
+typedef struct
+{
+  char magic[8];
+  uint32_t byte_order;      /* 0x01020304 written in native byte order */
+  uint32_t real_size;       /* size of a sunrealtype                    */
+  uint64_t snapshot_size;   /* size of a packed snapshot                */
+  uint64_t snapshot_stride; /* distance between snapshots               */
+  uint64_t num_snapshots;   /* number of snapshots in the index         */
+  uint64_t data_offset;     /* offset of the first snapshot             */
+  uint64_t index_offset;    /* offset of the snapshot times             */
+  uint64_t reserved;
+} sunTimeSeriesHeader;
+
+struct SUNTimeSeries_
+{
+  FILE* fp;                   /* output file                            */
+  sunTimeSeriesHeader header; /* file header                            */
+  sunrealtype* times;         /* snapshot times                         */
+  long capacity;              /* size of the times array                */
+  long count;                 /* number of snapshots written            */
+  sunbooleantype at_end;      /* file position is after the last record */
+#if defined(SUNDIALS_ENABLE_ASYNC_OUTPUT)
+  int nbuffers;         /* number of buffers, 0 if synchronous     */
+  char* buffers;        /* packed snapshot buffers                 */
+  long nwritten;        /* snapshots written by the writer thread  */
+  long nstalls;         /* appends that waited for a free buffer   */
+  SUNErrCode async_err; /* first error in the writer thread        */
+  sunbooleantype stop;  /* the writer thread should exit           */
+  sunMutex mutex;       /* protects count, nwritten, and async_err */
+  sunCond work;         /* signaled when a snapshot is queued      */
+  sunCond done;         /* signaled when a snapshot is written     */
+  sunThread thread;     /* writer thread                           */
+#endif
+};
+
+/* Move to an offset, which may exceed the range of long */
+static SUNErrCode sunTimeSeriesSeek(FILE* fp, uint64_t offset)
+{
+  if (offset > (uint64_t)INT64_MAX) { return SUN_ERR_OP_FAIL; }
+  if (sunFileSeek(fp, (int64_t)offset, SEEK_SET)) { return SUN_ERR_OP_FAIL; }
+  return SUN_SUCCESS;
+}
+
+/* Move to snapshot k unless the file position is already there */
+static SUNErrCode sunTimeSeriesSeekSnapshot(SUNTimeSeries ts, long k)
+{
+  if (ts->at_end) { return SUN_SUCCESS; }
+  return sunTimeSeriesSeek(ts->fp, ts->header.data_offset +
+                                     k * ts->header.snapshot_stride);
+}
+
+#if defined(SUNDIALS_ENABLE_ASYNC_OUTPUT)
+
+static void* sunTimeSeriesWriter(void* arg)
+{
+  SUNTimeSeries ts = (SUNTimeSeries)arg;
+  SUNErrCode err;
+  size_t stride;
+  char* buf;
+  long k;
+
+  sunMutexLock(&ts->mutex);
+  for (;;)
+  {
+    while (ts->nwritten == ts->count && !ts->stop)
+    {
+      sunCondWait(&ts->work, &ts->mutex);
+    }
+    if (ts->nwritten == ts->count) { break; }
+
+    k = ts->nwritten;
+    sunMutexUnlock(&ts->mutex);
+
+    /* The snapshot size is set by the first append, before any is queued */
+    stride = (size_t)ts->header.snapshot_stride;
+    buf    = ts->buffers + (k % ts->nbuffers) * stride;
+
+    err = sunTimeSeriesSeekSnapshot(ts, k);
+    if (!err && fwrite(buf, 1, stride, ts->fp) != stride)
+    {
+      err = SUN_ERR_OP_FAIL;
+    }
+    ts->at_end = (err == SUN_SUCCESS);
+
+    sunMutexLock(&ts->mutex);
+    if (err && !ts->async_err) { ts->async_err = err; }
+    ts->nwritten++;
+    sunCondSignal(&ts->done);
+  }
+  sunMutexUnlock(&ts->mutex);
+
+  return NULL;
+}
+
+/* Wait until the writer thread has written all queued snapshots */
+static SUNErrCode sunTimeSeriesDrain(SUNTimeSeries ts)
+{
+  SUNErrCode err;
+
+  sunMutexLock(&ts->mutex);
+  while (ts->nwritten != ts->count) { sunCondWait(&ts->done, &ts->mutex); }
+  err           = ts->async_err;
+  ts->async_err = SUN_SUCCESS;
+  sunMutexUnlock(&ts->mutex);
+
+  return err;
+}
+
+static SUNErrCode sunTimeSeriesAppendAsync(SUNTimeSeries ts, N_Vector y)
+{
+  SUNErrCode err;
+  size_t stride = (size_t)ts->header.snapshot_stride;
+
+  /* The buffers are allocated once the snapshot size is known, the padding
+     is zeroed here and never overwritten */
+  if (ts->buffers == NULL)
+  {
+    ts->buffers = (char*)calloc(ts->nbuffers, stride);
+    if (ts->buffers == NULL) { return SUN_ERR_MALLOC_FAIL; }
+  }
+
+  sunMutexLock(&ts->mutex);
+  if (ts->count - ts->nwritten == ts->nbuffers)
+  {
+    ts->nstalls++;
+    while (ts->count - ts->nwritten == ts->nbuffers)
+    {
+      sunCondWait(&ts->done, &ts->mutex);
+    }
+  }
+  err           = ts->async_err;
+  ts->async_err = SUN_SUCCESS;
+  sunMutexUnlock(&ts->mutex);
+  if (err) { return err; }
+
+  /* The buffer for this snapshot is not used by the writer thread */
+  return N_VBufPack(y, ts->buffers + (ts->count % ts->nbuffers) * stride);
+}
+
+#endif
+
+static SUNErrCode sunTimeSeriesReadHeader(FILE* fp, sunTimeSeriesHeader* header)
+{
+  if (fread(header, sizeof(*header), 1, fp) != 1) { return SUN_ERR_OP_FAIL; }
+
+  if (memcmp(header->magic, SUN_TIMESERIES_MAGIC, sizeof(header->magic)) ||
+      header->byte_order != 0x01020304 ||
+      header->real_size != (uint32_t)sizeof(sunrealtype))
+  {
+    return SUN_ERR_ARG_INCOMPATIBLE;
+  }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNTimeSeries_Create(const char* filename, SUNTimeSeries* ts_ptr)
+{
+  SUNTimeSeries ts = NULL;
+
+  if (ts_ptr == NULL || filename == NULL) { return SUN_ERR_ARG_CORRUPT; }
+
+  ts = (SUNTimeSeries)malloc(sizeof(*ts));
+  if (ts == NULL) { return SUN_ERR_MALLOC_FAIL; }
+
+  ts->times = (sunrealtype*)malloc(SUN_TIMESERIES_CAPACITY *
+                                   sizeof(sunrealtype));
+  if (ts->times == NULL)
+  {
+    free(ts);
+    return SUN_ERR_MALLOC_FAIL;
+  }
+
+  ts->fp = fopen(filename, "wb");
+  if (ts->fp == NULL)
+  {
+    free(ts->times);
+    free(ts);
+    return SUN_ERR_FILE_OPEN;
+  }
+
+  ts->capacity = SUN_TIMESERIES_CAPACITY;
+  ts->count    = 0;
+  ts->at_end   = SUNFALSE;
+#if defined(SUNDIALS_ENABLE_ASYNC_OUTPUT)
+  ts->nbuffers  = 0;
+  ts->buffers   = NULL;
+  ts->nwritten  = 0;
+  ts->nstalls   = 0;
+  ts->async_err = SUN_SUCCESS;
+  ts->stop      = SUNFALSE;
+#endif
+
+  memset(&ts->header, 0, sizeof(ts->header));
+  memcpy(ts->header.magic, SUN_TIMESERIES_MAGIC, sizeof(ts->header.magic));
+  ts->header.byte_order   = 0x01020304;
+  ts->header.real_size    = (uint32_t)sizeof(sunrealtype);
+  ts->header.data_offset  = sizeof(sunTimeSeriesHeader);
+  ts->header.index_offset = sizeof(sunTimeSeriesHeader);
+
+  if (fwrite(&ts->header, sizeof(ts->header), 1, ts->fp) != 1)
+  {
+    fclose(ts->fp);
+    free(ts->times);
+    free(ts);
+    return SUN_ERR_OP_FAIL;
+  }
+
+  *ts_ptr = ts;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNTimeSeries_Destroy(SUNTimeSeries* ts_ptr)
+{
+  SUNErrCode err, flush_err;
+  SUNTimeSeries ts;
+
+  if (ts_ptr == NULL || *ts_ptr == NULL) { return SUN_SUCCESS; }
+
+  /* Stop the writer thread (if any) and write the index */
+  ts        = *ts_ptr;
+  err       = SUNTimeSeries_SetAsync(ts, 0);
+  flush_err = SUNTimeSeries_Flush(ts);
+  if (!err) { err = flush_err; }
+
+  fclose(ts->fp);
+  free(ts->times);
+  free(ts);
+  *ts_ptr = NULL;
+
+  return err;
+}
+
+SUNErrCode SUNTimeSeries_Append(SUNTimeSeries ts, sunrealtype t, N_Vector y)
+{
+  static const char zeros[SUN_TIMESERIES_ALIGN] = {0};
+  SUNErrCode err;
+  sunindextype size;
+  uint64_t pad;
+  sunrealtype* times;
+
+  if (ts == NULL || y == NULL) { return SUN_ERR_ARG_CORRUPT; }
+
+  err = N_VBufSize(y, &size);
+  if (err) { return err; }
+
+  /* The first snapshot sets the size, all others must match */
+  if (ts->count == 0)
+  {
+    ts->header.snapshot_size   = (uint64_t)size;
+    ts->header.snapshot_stride = ((uint64_t)size + SUN_TIMESERIES_ALIGN - 1) /
+                                 SUN_TIMESERIES_ALIGN * SUN_TIMESERIES_ALIGN;
+  }
+  else if ((uint64_t)size != ts->header.snapshot_size)
+  {
+    return SUN_ERR_ARG_DIMSMISMATCH;
+  }
+
+  if (ts->count == ts->capacity)
+  {
+    times = (sunrealtype*)realloc(ts->times,
+                                  2 * ts->capacity * sizeof(sunrealtype));
+    if (times == NULL) { return SUN_ERR_MALLOC_FAIL; }
+    ts->times = times;
+    ts->capacity *= 2;
+  }
+
+#if defined(SUNDIALS_ENABLE_ASYNC_OUTPUT)
+  if (ts->nbuffers > 0)
+  {
+    err = sunTimeSeriesAppendAsync(ts, y);
+    if (err) { return err; }
+
+    ts->times[ts->count] = t;
+
+    sunMutexLock(&ts->mutex);
+    ts->count++;
+    sunCondSignal(&ts->work);
+    sunMutexUnlock(&ts->mutex);
+
+    return SUN_SUCCESS;
+  }
+#endif
+
+  /* A flush leaves the file position after the index */
+  err = sunTimeSeriesSeekSnapshot(ts, ts->count);
+  if (err) { return err; }
+
+  err = N_VWriteBinary(y, ts->fp, SUNFALSE);
+  if (err) { return err; }
+
+  pad = ts->header.snapshot_stride - ts->header.snapshot_size;
+  if (pad && fwrite(zeros, 1, pad, ts->fp) != pad) { return SUN_ERR_OP_FAIL; }
+
+  ts->times[ts->count++] = t;
+  ts->at_end             = SUNTRUE;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNTimeSeries_Flush(SUNTimeSeries ts)
+{
+  SUNErrCode err;
+
+  if (ts == NULL) { return SUN_ERR_ARG_CORRUPT; }
+
+#if defined(SUNDIALS_ENABLE_ASYNC_OUTPUT)
+  /* The writer thread waits for new snapshots once the queue is empty */
+  if (ts->nbuffers > 0)
+  {
+    err = sunTimeSeriesDrain(ts);
+    if (err) { return err; }
+  }
+#endif
+
+  ts->header.num_snapshots = (uint64_t)ts->count;
+  ts->header.index_offset  = ts->header.data_offset +
+                            ts->count * ts->header.snapshot_stride;
+
+  err = sunTimeSeriesSeek(ts->fp, ts->header.index_offset);
+  if (err) { return err; }
+
+  if (fwrite(ts->times, sizeof(sunrealtype), ts->count, ts->fp) !=
+      (size_t)ts->count)
+  {
+    return SUN_ERR_OP_FAIL;
+  }
+
+  err = sunTimeSeriesSeek(ts->fp, 0);
+  if (err) { return err; }
+
+  if (fwrite(&ts->header, sizeof(ts->header), 1, ts->fp) != 1)
+  {
+    return SUN_ERR_OP_FAIL;
+  }
+
+  fflush(ts->fp);
+  ts->at_end = SUNFALSE;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNTimeSeries_SetAsync(SUNTimeSeries ts, int nbuffers)
+{
+#if defined(SUNDIALS_ENABLE_ASYNC_OUTPUT)
+  SUNErrCode err = SUN_SUCCESS;
+
+  if (ts == NULL) { return SUN_ERR_ARG_CORRUPT; }
+  if (nbuffers < 0) { return SUN_ERR_ARG_OUTOFRANGE; }
+
+  /* Write the queued snapshots and stop the current writer thread */
+  if (ts->nbuffers > 0)
+  {
+    err = sunTimeSeriesDrain(ts);
+
+    sunMutexLock(&ts->mutex);
+    ts->stop = SUNTRUE;
+    sunCondSignal(&ts->work);
+    sunMutexUnlock(&ts->mutex);
+
+    sunThreadJoin(ts->thread);
+    sunCondDestroy(&ts->done);
+    sunCondDestroy(&ts->work);
+    sunMutexDestroy(&ts->mutex);
+
+    free(ts->buffers);
+    ts->buffers  = NULL;
+    ts->nbuffers = 0;
+  }
+
+  if (nbuffers == 0) { return err; }
+
+  if (sunMutexInit(&ts->mutex)) { return SUN_ERR_OP_FAIL; }
+  if (sunCondInit(&ts->work))
+  {
+    sunMutexDestroy(&ts->mutex);
+    return SUN_ERR_OP_FAIL;
+  }
+  if (sunCondInit(&ts->done))
+  {
+    sunCondDestroy(&ts->work);
+    sunMutexDestroy(&ts->mutex);
+    return SUN_ERR_OP_FAIL;
+  }
+
+  ts->nbuffers  = nbuffers;
+  ts->nwritten  = ts->count;
+  ts->async_err = SUN_SUCCESS;
+  ts->stop      = SUNFALSE;
+
+  if (sunThreadCreate(&ts->thread, sunTimeSeriesWriter, ts))
+  {
+    sunCondDestroy(&ts->done);
+    sunCondDestroy(&ts->work);
+    sunMutexDestroy(&ts->mutex);
+    ts->nbuffers = 0;
+    return SUN_ERR_OP_FAIL;
+  }
+
+  return err;
+#else
+  if (ts == NULL) { return SUN_ERR_ARG_CORRUPT; }
+  if (nbuffers < 0) { return SUN_ERR_ARG_OUTOFRANGE; }
+  return (nbuffers == 0) ? SUN_SUCCESS : SUN_ERR_NOT_IMPLEMENTED;
+#endif
+}
+
+SUNErrCode SUNTimeSeries_GetNumStalls(SUNTimeSeries ts, long* num_stalls)
+{
+  if (ts == NULL || num_stalls == NULL) { return SUN_ERR_ARG_CORRUPT; }
+#if defined(SUNDIALS_ENABLE_ASYNC_OUTPUT)
+  *num_stalls = ts->nstalls;
+#else
+  *num_stalls = 0;
+#endif
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNTimeSeries_GetNumSnapshots(SUNTimeSeries ts, long* num_snapshots)
+{
+  if (ts == NULL || num_snapshots == NULL) { return SUN_ERR_ARG_CORRUPT; }
+  *num_snapshots = ts->count;
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNTimeSeries_ReadSnapshot(const char* filename, long k,
+                                      sunrealtype* t, N_Vector y)
+{
+  SUNErrCode err;
+  FILE* fp;
+  sunindextype size;
+  sunTimeSeriesHeader header;
+
+  if (filename == NULL || y == NULL) { return SUN_ERR_ARG_CORRUPT; }
+
+  fp = fopen(filename, "rb");
+  if (fp == NULL) { return SUN_ERR_FILE_OPEN; }
+
+  err = sunTimeSeriesReadHeader(fp, &header);
+  if (err)
+  {
+    fclose(fp);
+    return err;
+  }
+
+  if (k < 0 || (uint64_t)k >= header.num_snapshots)
+  {
+    fclose(fp);
+    return SUN_ERR_ARG_OUTOFRANGE;
+  }
+
+  err = N_VBufSize(y, &size);
+  if (!err && (uint64_t)size != header.snapshot_size)
+  {
+    err = SUN_ERR_ARG_DIMSMISMATCH;
+  }
+
+  if (!err && t)
+  {
+    err = sunTimeSeriesSeek(fp, header.index_offset + k * sizeof(sunrealtype));
+    if (!err && fread(t, sizeof(sunrealtype), 1, fp) != 1)
+    {
+      err = SUN_ERR_OP_FAIL;
+    }
+  }
+
+  if (!err)
+  {
+    err = sunTimeSeriesSeek(fp, header.data_offset +
+                                  k * header.snapshot_stride);
+  }
+
+  if (!err) { err = N_VReadBinary(y, fp, SUNFALSE); }
+
+  fclose(fp);
+
+  return err;
+}
@@ -18,12 +18,17 @@
 #define _SUNDIALS_UTILS_H
 
 #include <stdarg.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <sundials/sundials_config.h>
 #include <sundials/sundials_types.h>
 
+#if !defined(_WIN32)
+#include <sys/types.h>
+#endif
+
 static inline char* sunCombineFileAndLine(int line, const char* file)
 {
   size_t total_str_len = strlen(file) + 6;
@@ -86,4 +91,23 @@ static inline void sunCompensatedSum(sunrealtype base, sunrealtype inc,
   *sum                      = tmp2;
 }
 
+/*
+ * Moves the position of a file to a 64-bit offset, since long is only
+ * 32 bits on some platforms. Returns 0 on success like fseek.
+ */
+static inline int sunFileSeek(FILE* fp, int64_t offset, int whence)
+{
+#if defined(_WIN32)
+  return _fseeki64(fp, (__int64)offset, whence);
+#elif defined(_DEFAULT_SOURCE) || defined(_GNU_SOURCE) || \
+  defined(__APPLE__) ||                                    \
+  (defined(_POSIX_C_SOURCE) && _POSIX_C_SOURCE >= 200112L)
+  if ((int64_t)(off_t)offset != offset) { return -1; }
+  return fseeko(fp, (off_t)offset, whence);
+#else
+  if ((int64_t)(long)offset != offset) { return -1; }
+  return fseek(fp, (long)offset, whence);
+#endif
+}
+
 #endif /* _SUNDIALS_UTILS_H */
@@ -24,6 +24,7 @@
 #include <stdlib.h>
 
 #include <sundials/priv/sundials_errors_impl.h>
+#include <sundials/priv/sundials_matrixmarket_impl.h>
 #include <sundials/sundials_errors.h>
 #include <sundials/sundials_math.h>
 #include <sunmatrix/sunmatrix_band.h>
@@ -77,15 +78,16 @@ SUNMatrix SUNBandMatrixStorage(sunindextype N, sunindextype mu, sunindextype ml,
   SUNCheckLastErrNull();
 
   /* Attach operations */
-  A->ops->getid     = SUNMatGetID_Band;
-  A->ops->clone     = SUNMatClone_Band;
-  A->ops->destroy   = SUNMatDestroy_Band;
-  A->ops->zero      = SUNMatZero_Band;
-  A->ops->copy      = SUNMatCopy_Band;
-  A->ops->scaleadd  = SUNMatScaleAdd_Band;
-  A->ops->scaleaddi = SUNMatScaleAddI_Band;
-  A->ops->matvec    = SUNMatMatvec_Band;
-  A->ops->space     = SUNMatSpace_Band;
+  A->ops->getid        = SUNMatGetID_Band;
+  A->ops->clone        = SUNMatClone_Band;
+  A->ops->destroy      = SUNMatDestroy_Band;
+  A->ops->zero         = SUNMatZero_Band;
+  A->ops->copy         = SUNMatCopy_Band;
+  A->ops->scaleadd     = SUNMatScaleAdd_Band;
+  A->ops->scaleaddi    = SUNMatScaleAddI_Band;
+  A->ops->matvec       = SUNMatMatvec_Band;
+  A->ops->space        = SUNMatSpace_Band;
+  A->ops->writecapture = SUNMatWriteCapture_Band;
 
   /* Create content */
   content = NULL;
@@ -152,6 +154,101 @@ void SUNBandMatrix_Print(SUNMatrix A, FILE* outfile)
   return;
 }
 
+/* ----------------------------------------------------------------------------
+ * Function to write the band matrix in Matrix Market coordinate format. All
+ * entries in the band are written so the bandwidths are kept.
+ */
+
+SUNErrCode SUNBandMatrix_WriteMatrixMarket(SUNMatrix A, FILE* outfile,
+                                           sunbooleantype symmetric)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunindextype i, j, start, finish, nnz;
+
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_BAND, SUN_ERR_ARG_WRONGTYPE);
+  SUNAssert(outfile, SUN_ERR_ARG_CORRUPT);
+
+  /* only the lower triangle of a symmetric matrix is written */
+  nnz = 0;
+  for (j = 0; j < SM_COLUMNS_B(A); j++)
+  {
+    start  = symmetric ? j : SUNMAX(0, j - SM_UBAND_B(A));
+    finish = SUNMIN(SM_ROWS_B(A) - 1, j + SM_LBAND_B(A));
+    nnz += SUNMAX(finish - start + 1, 0);
+  }
+
+  sunMatrixMarketWriteHeader(outfile, symmetric, SM_ROWS_B(A),
+                             SM_COLUMNS_B(A), nnz);
+  for (j = 0; j < SM_COLUMNS_B(A); j++)
+  {
+    start  = symmetric ? j : SUNMAX(0, j - SM_UBAND_B(A));
+    finish = SUNMIN(SM_ROWS_B(A) - 1, j + SM_LBAND_B(A));
+    for (i = start; i <= finish; i++)
+    {
+      sunMatrixMarketWriteEntry(outfile, i, j, SM_ELEMENT_B(A, i, j));
+    }
+  }
+
+  return ferror(outfile) ? SUN_ERR_OP_FAIL : SUN_SUCCESS;
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to create a band matrix from a Matrix Market coordinate file. The
+ * bandwidths are the smallest that hold the entries and the storage upper
+ * bandwidth leaves room for the LU factors. Duplicate entries are added
+ * together.
+ */
+
+SUNErrCode SUNBandMatrix_ReadMatrixMarket(FILE* infile, int nthreads,
+                                          SUNContext sunctx, SUNMatrix* A)
+{
+  SUNFunctionBegin(sunctx);
+  sunMatrixMarketCOO coo;
+  SUNErrCode err;
+  SUNMatrix B;
+  sunindextype k, mu, ml;
+
+  SUNAssert(infile && A, SUN_ERR_ARG_CORRUPT);
+
+  *A = NULL;
+
+  err = sunMatrixMarketRead(infile, nthreads, &coo);
+  if (err) { return err; }
+
+  if (coo.rows != coo.cols)
+  {
+    sunMatrixMarketFree(&coo);
+    return SUN_ERR_ARG_INCOMPATIBLE;
+  }
+
+  mu = 0;
+  ml = 0;
+  for (k = 0; k < coo.nnz; k++)
+  {
+    mu = SUNMAX(mu, coo.col[k] - coo.row[k]);
+    ml = SUNMAX(ml, coo.row[k] - coo.col[k]);
+  }
+
+  B = SUNBandMatrixStorage(coo.rows, mu, ml, SUNMIN(coo.rows - 1, mu + ml),
+                           sunctx);
+  if (B == NULL)
+  {
+    sunMatrixMarketFree(&coo);
+    return SUN_ERR_MALLOC_FAIL;
+  }
+
+  for (k = 0; k < coo.nnz; k++)
+  {
+    SM_ELEMENT_B(B, coo.row[k], coo.col[k]) += coo.val[k];
+  }
+
+  sunMatrixMarketFree(&coo);
+
+  *A = B;
+
+  return SUN_SUCCESS;
+}
+
 /* ----------------------------------------------------------------------------
  * Functions to access the contents of the band matrix structure
  */
@@ -427,6 +524,38 @@ SUNErrCode SUNMatSpace_Band(SUNMatrix A, long int* lenrw, long int* leniw)
   return SUN_SUCCESS;
 }
 
+SUNErrCode SUNMatWriteCapture_Band(SUNMatrix A, SUNLinSysCaptureRecord* rec,
+                                   FILE* outfile)
+{
+  sunindextype j;
+  size_t ncol;
+  SUNFunctionBegin(A->sunctx);
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_BAND, SUN_ERR_ARG_WRONGTYPE);
+  SUNAssert(rec, SUN_ERR_ARG_CORRUPT);
+  SUNAssert(outfile, SUN_ERR_ARG_CORRUPT);
+
+  rec->format = SUN_LINSYSCAPTURE_BAND;
+  rec->rows   = SM_ROWS_B(A);
+  rec->cols   = SM_COLUMNS_B(A);
+  rec->upper  = SM_UBAND_B(A);
+  rec->lower  = SM_LBAND_B(A);
+
+  /* record header followed by the band of each column, the extra storage
+     above the upper bandwidth is not written */
+  if (fwrite(rec, sizeof(*rec), 1, outfile) != 1) { return SUN_ERR_OP_FAIL; }
+  ncol = (size_t)(SM_UBAND_B(A) + SM_LBAND_B(A) + 1);
+  for (j = 0; j < SM_COLUMNS_B(A); j++)
+  {
+    if (fwrite(SM_COLUMN_B(A, j) - SM_UBAND_B(A), sizeof(sunrealtype), ncol,
+               outfile) != ncol)
+    {
+      return SUN_ERR_OP_FAIL;
+    }
+  }
+
+  return SUN_SUCCESS;
+}
+
 /*
  * -----------------------------------------------------------------
  * private functions
@@ -22,6 +22,7 @@
 #include <stdlib.h>
 
 #include <sundials/priv/sundials_errors_impl.h>
+#include <sundials/priv/sundials_matrixmarket_impl.h>
 #include <sundials/sundials_errors.h>
 #include <sunmatrix/sunmatrix_dense.h>
 
@@ -61,15 +62,16 @@ SUNMatrix SUNDenseMatrix(sunindextype M, sunindextype N, SUNContext sunctx)
   SUNCheckLastErrNull();
 
   /* Attach operations */
-  A->ops->getid     = SUNMatGetID_Dense;
-  A->ops->clone     = SUNMatClone_Dense;
-  A->ops->destroy   = SUNMatDestroy_Dense;
-  A->ops->zero      = SUNMatZero_Dense;
-  A->ops->copy      = SUNMatCopy_Dense;
-  A->ops->scaleadd  = SUNMatScaleAdd_Dense;
-  A->ops->scaleaddi = SUNMatScaleAddI_Dense;
-  A->ops->matvec    = SUNMatMatvec_Dense;
-  A->ops->space     = SUNMatSpace_Dense;
+  A->ops->getid        = SUNMatGetID_Dense;
+  A->ops->clone        = SUNMatClone_Dense;
+  A->ops->destroy      = SUNMatDestroy_Dense;
+  A->ops->zero         = SUNMatZero_Dense;
+  A->ops->copy         = SUNMatCopy_Dense;
+  A->ops->scaleadd     = SUNMatScaleAdd_Dense;
+  A->ops->scaleaddi    = SUNMatScaleAddI_Dense;
+  A->ops->matvec       = SUNMatMatvec_Dense;
+  A->ops->space        = SUNMatSpace_Dense;
+  A->ops->writecapture = SUNMatWriteCapture_Dense;
 
   /* Create content */
   content = NULL;
@@ -128,6 +130,86 @@ void SUNDenseMatrix_Print(SUNMatrix A, FILE* outfile)
   return;
 }
 
+/* ----------------------------------------------------------------------------
+ * Function to write the dense matrix in Matrix Market coordinate format. Only
+ * the nonzero entries are written.
+ */
+
+SUNErrCode SUNDenseMatrix_WriteMatrixMarket(SUNMatrix A, FILE* outfile,
+                                            sunbooleantype symmetric)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunindextype i, j, nnz;
+
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_DENSE, SUN_ERR_ARG_WRONGTYPE);
+  SUNAssert(outfile, SUN_ERR_ARG_CORRUPT);
+  SUNAssert(!symmetric || SM_ROWS_D(A) == SM_COLUMNS_D(A),
+            SUN_ERR_ARG_INCOMPATIBLE);
+
+  /* only the lower triangle of a symmetric matrix is written */
+  nnz = 0;
+  for (j = 0; j < SM_COLUMNS_D(A); j++)
+  {
+    for (i = symmetric ? j : 0; i < SM_ROWS_D(A); i++)
+    {
+      if (SM_ELEMENT_D(A, i, j) != ZERO) { nnz++; }
+    }
+  }
+
+  sunMatrixMarketWriteHeader(outfile, symmetric, SM_ROWS_D(A),
+                             SM_COLUMNS_D(A), nnz);
+  for (j = 0; j < SM_COLUMNS_D(A); j++)
+  {
+    for (i = symmetric ? j : 0; i < SM_ROWS_D(A); i++)
+    {
+      if (SM_ELEMENT_D(A, i, j) == ZERO) { continue; }
+      sunMatrixMarketWriteEntry(outfile, i, j, SM_ELEMENT_D(A, i, j));
+    }
+  }
+
+  return ferror(outfile) ? SUN_ERR_OP_FAIL : SUN_SUCCESS;
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to create a dense matrix from a Matrix Market coordinate file.
+ * Duplicate entries are added together.
+ */
+
+SUNErrCode SUNDenseMatrix_ReadMatrixMarket(FILE* infile, int nthreads,
+                                           SUNContext sunctx, SUNMatrix* A)
+{
+  SUNFunctionBegin(sunctx);
+  sunMatrixMarketCOO coo;
+  SUNErrCode err;
+  SUNMatrix B;
+  sunindextype k;
+
+  SUNAssert(infile && A, SUN_ERR_ARG_CORRUPT);
+
+  *A = NULL;
+
+  err = sunMatrixMarketRead(infile, nthreads, &coo);
+  if (err) { return err; }
+
+  B = SUNDenseMatrix(coo.rows, coo.cols, sunctx);
+  if (B == NULL)
+  {
+    sunMatrixMarketFree(&coo);
+    return SUN_ERR_MALLOC_FAIL;
+  }
+
+  for (k = 0; k < coo.nnz; k++)
+  {
+    SM_ELEMENT_D(B, coo.row[k], coo.col[k]) += coo.val[k];
+  }
+
+  sunMatrixMarketFree(&coo);
+
+  *A = B;
+
+  return SUN_SUCCESS;
+}
+
 /* ----------------------------------------------------------------------------
  * Functions to access the contents of the dense matrix structure
  */
@@ -345,6 +427,33 @@ SUNErrCode SUNMatSpace_Dense(SUNMatrix A, long int* lenrw, long int* leniw)
   return SUN_SUCCESS;
 }
 
+SUNErrCode SUNMatWriteCapture_Dense(SUNMatrix A, SUNLinSysCaptureRecord* rec,
+                                    FILE* outfile)
+{
+  size_t ndata;
+  SUNFunctionBegin(A->sunctx);
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_DENSE, SUN_ERR_ARG_WRONGTYPE);
+  SUNAssert(rec, SUN_ERR_ARG_CORRUPT);
+  SUNAssert(outfile, SUN_ERR_ARG_CORRUPT);
+
+  rec->format = SUN_LINSYSCAPTURE_DENSE;
+  rec->rows   = SM_ROWS_D(A);
+  rec->cols   = SM_COLUMNS_D(A);
+  rec->upper  = 0;
+  rec->lower  = 0;
+
+  /* record header followed by the column-major data */
+  ndata = (size_t)SM_LDATA_D(A);
+  if (fwrite(rec, sizeof(*rec), 1, outfile) != 1) { return SUN_ERR_OP_FAIL; }
+  if (ndata > 0 &&
+      fwrite(SM_DATA_D(A), sizeof(sunrealtype), ndata, outfile) != ndata)
+  {
+    return SUN_ERR_OP_FAIL;
+  }
+
+  return SUN_SUCCESS;
+}
+
 /*
  * -----------------------------------------------------------------
  * private functions
@@ -20,10 +20,13 @@
  * -----------------------------------------------------------------
  */
 
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include <sundials/priv/sundials_errors_impl.h>
+#include <sundials/priv/sundials_matrixmarket_impl.h>
 #include <sundials/sundials_errors.h>
 #include <sundials/sundials_math.h>
 #include <sunmatrix/sunmatrix_band.h>
@@ -42,6 +45,31 @@ static sunbooleantype compatibleMatrixAndVectors(SUNMatrix A, N_Vector x,
 static SUNErrCode Matvec_SparseCSC(SUNMatrix A, N_Vector x, N_Vector y);
 static SUNErrCode Matvec_SparseCSR(SUNMatrix A, N_Vector x, N_Vector y);
 static SUNErrCode format_convert(const SUNMatrix A, SUNMatrix B);
+static SUNErrCode coo_to_sparse(sunMatrixMarketCOO* coo, int sparsetype,
+                                SUNContext sunctx, SUNMatrix* Aout);
+
+/* Binary file magic number */
+#define SUN_SPARSEBINARY_MAGIC "SUNSPM01"
+
+/* Arrays in a binary file start on multiples of this many bytes */
+#define SUN_SPARSEBINARY_ALIGN 64
+
+/* Binary file header (64 bytes). The index pointers start right after the
+   header, the index values and data start at the given offsets. Offsets are
+   relative to the start of the header. */
+typedef struct
+{
+  char magic[8];
+  uint32_t byte_order;       /* 0x01020304 written in native byte order */
+  uint32_t real_size;        /* size of a sunrealtype                    */
+  uint32_t index_size;       /* size of a sunindextype                   */
+  uint32_t sparsetype;       /* CSC_MAT or CSR_MAT                       */
+  uint64_t rows;             /* number of rows                           */
+  uint64_t cols;             /* number of columns                        */
+  uint64_t nnz;              /* number of nonzeros                       */
+  uint64_t indexvals_offset; /* offset of the index values               */
+  uint64_t data_offset;      /* offset of the nonzero values             */
+} sunSparseBinaryHeader;
 
 /*
  * -----------------------------------------------------------------
@@ -78,15 +106,16 @@ SUNMatrix SUNSparseMatrix(sunindextype M, sunindextype N, sunindextype NNZ,
   SUNCheckLastErrNull();
 
   /* Attach operations */
-  A->ops->getid     = SUNMatGetID_Sparse;
-  A->ops->clone     = SUNMatClone_Sparse;
-  A->ops->destroy   = SUNMatDestroy_Sparse;
-  A->ops->zero      = SUNMatZero_Sparse;
-  A->ops->copy      = SUNMatCopy_Sparse;
-  A->ops->scaleadd  = SUNMatScaleAdd_Sparse;
-  A->ops->scaleaddi = SUNMatScaleAddI_Sparse;
-  A->ops->matvec    = SUNMatMatvec_Sparse;
-  A->ops->space     = SUNMatSpace_Sparse;
+  A->ops->getid        = SUNMatGetID_Sparse;
+  A->ops->clone        = SUNMatClone_Sparse;
+  A->ops->destroy      = SUNMatDestroy_Sparse;
+  A->ops->zero         = SUNMatZero_Sparse;
+  A->ops->copy         = SUNMatCopy_Sparse;
+  A->ops->scaleadd     = SUNMatScaleAdd_Sparse;
+  A->ops->scaleaddi    = SUNMatScaleAddI_Sparse;
+  A->ops->matvec       = SUNMatMatvec_Sparse;
+  A->ops->space        = SUNMatSpace_Sparse;
+  A->ops->writecapture = SUNMatWriteCapture_Sparse;
 
   /* Create content */
   content = NULL;
@@ -135,6 +164,11 @@ SUNMatrix SUNSparseMatrix(sunindextype M, sunindextype N, sunindextype NNZ,
   SUNAssertNull(content->indexptrs, SUN_ERR_MALLOC_FAIL);
   content->indexptrs[content->NP] = 0;
 
+  SUNAllocAuditRecord(sunctx, sizeof *content +
+                                NNZ * (sizeof(sunrealtype) +
+                                       sizeof(sunindextype)) +
+                                (content->NP + 1) * sizeof(sunindextype));
+
   return (A);
 }
 
@@ -350,6 +384,9 @@ SUNErrCode SUNSparseMatrix_Realloc(SUNMatrix A)
   SM_DATA_S(A) = (sunrealtype*)realloc(SM_DATA_S(A), nzmax * sizeof(sunrealtype));
   SUNAssert(SM_DATA_S(A), SUN_ERR_MALLOC_FAIL);
 
+  SUNAllocAuditRecord(A->sunctx,
+                      nzmax * (sizeof(sunindextype) + sizeof(sunrealtype)));
+
   SM_NNZ_S(A) = nzmax;
 
   return SUN_SUCCESS;
@@ -376,6 +413,9 @@ SUNErrCode SUNSparseMatrix_Reallocate(SUNMatrix A, sunindextype NNZ)
   SM_DATA_S(A) = (sunrealtype*)realloc(SM_DATA_S(A), NNZ * sizeof(sunrealtype));
   SUNAssert(SM_DATA_S(A), SUN_ERR_MALLOC_FAIL);
 
+  SUNAllocAuditRecord(A->sunctx,
+                      NNZ * (sizeof(sunindextype) + sizeof(sunrealtype)));
+
   SM_NNZ_S(A) = NNZ;
 
   return SUN_SUCCESS;
@@ -433,6 +473,273 @@ void SUNSparseMatrix_Print(SUNMatrix A, FILE* outfile)
   return;
 }
 
+/* ----------------------------------------------------------------------------
+ * Function to write the sparse matrix in Matrix Market coordinate format
+ */
+
+SUNErrCode SUNSparseMatrix_WriteMatrixMarket(SUNMatrix A, FILE* outfile,
+                                             sunbooleantype symmetric)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunindextype p, k, row, col, nnz;
+  sunindextype* indexptrs;
+  sunindextype* indexvals;
+  sunrealtype* data;
+  sunbooleantype csr;
+
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_SPARSE, SUN_ERR_ARG_WRONGTYPE);
+  SUNAssert(outfile, SUN_ERR_ARG_CORRUPT);
+  SUNAssert(!symmetric || SM_ROWS_S(A) == SM_COLUMNS_S(A),
+            SUN_ERR_ARG_INCOMPATIBLE);
+
+  indexptrs = SM_INDEXPTRS_S(A);
+  indexvals = SM_INDEXVALS_S(A);
+  data      = SM_DATA_S(A);
+  csr       = (SM_SPARSETYPE_S(A) == CSR_MAT);
+
+  /* only the lower triangle of a symmetric matrix is written */
+  nnz = indexptrs[SM_NP_S(A)];
+  if (symmetric)
+  {
+    nnz = 0;
+    for (p = 0; p < SM_NP_S(A); p++)
+    {
+      for (k = indexptrs[p]; k < indexptrs[p + 1]; k++)
+      {
+        row = csr ? p : indexvals[k];
+        col = csr ? indexvals[k] : p;
+        if (row >= col) { nnz++; }
+      }
+    }
+  }
+
+  sunMatrixMarketWriteHeader(outfile, symmetric, SM_ROWS_S(A),
+                             SM_COLUMNS_S(A), nnz);
+  for (p = 0; p < SM_NP_S(A); p++)
+  {
+    for (k = indexptrs[p]; k < indexptrs[p + 1]; k++)
+    {
+      row = csr ? p : indexvals[k];
+      col = csr ? indexvals[k] : p;
+      if (symmetric && row < col) { continue; }
+      sunMatrixMarketWriteEntry(outfile, row, col, data[k]);
+    }
+  }
+
+  return ferror(outfile) ? SUN_ERR_OP_FAIL : SUN_SUCCESS;
+}
+
+/* ----------------------------------------------------------------------------
+ * Function to create a sparse matrix from a Matrix Market coordinate file.
+ * Duplicate entries are added together.
+ */
+
+SUNErrCode SUNSparseMatrix_ReadMatrixMarket(FILE* infile, int sparsetype,
+                                            int nthreads, SUNContext sunctx,
+                                            SUNMatrix* A)
+{
+  SUNFunctionBegin(sunctx);
+  sunMatrixMarketCOO coo;
+  SUNErrCode err;
+
+  SUNAssert(infile && A, SUN_ERR_ARG_CORRUPT);
+  SUNAssert(sparsetype == CSC_MAT || sparsetype == CSR_MAT,
+            SUN_ERR_ARG_OUTOFRANGE);
+
+  *A = NULL;
+
+  err = sunMatrixMarketRead(infile, nthreads, &coo);
+  if (err) { return err; }
+
+  err = coo_to_sparse(&coo, sparsetype, sunctx, A);
+  sunMatrixMarketFree(&coo);
+
+  return err;
+}
+
+/* ----------------------------------------------------------------------------
+ * Functions to write and read the sparse matrix in a binary format that can
+ * be memory-mapped
+ */
+
+static SUNErrCode sparse_binary_pad(FILE* outfile, uint64_t nbytes)
+{
+  static const char zeros[SUN_SPARSEBINARY_ALIGN] = {0};
+  uint64_t npad = (SUN_SPARSEBINARY_ALIGN - nbytes % SUN_SPARSEBINARY_ALIGN) %
+                  SUN_SPARSEBINARY_ALIGN;
+  if (npad && fwrite(zeros, 1, npad, outfile) != npad)
+  {
+    return SUN_ERR_OP_FAIL;
+  }
+  return SUN_SUCCESS;
+}
+
+/* Check that the index pointers start at zero, do not decrease, and end at
+   the number of nonzeros, and that the index values are in range */
+static SUNErrCode sparse_binary_check(SUNMatrix A, sunindextype nnz)
+{
+  sunindextype i, k;
+  sunindextype np         = SM_NP_S(A);
+  sunindextype nidx       = (SM_SPARSETYPE_S(A) == CSC_MAT) ? SM_ROWS_S(A)
+                                                            : SM_COLUMNS_S(A);
+  sunindextype* indexptrs = SM_INDEXPTRS_S(A);
+  sunindextype* indexvals = SM_INDEXVALS_S(A);
+
+  if (indexptrs[0] != 0 || indexptrs[np] != nnz) { return SUN_ERR_CORRUPT; }
+  for (i = 0; i < np; i++)
+  {
+    if (indexptrs[i + 1] < indexptrs[i]) { return SUN_ERR_CORRUPT; }
+  }
+  for (k = 0; k < nnz; k++)
+  {
+    if (indexvals[k] < 0 || indexvals[k] >= nidx) { return SUN_ERR_CORRUPT; }
+  }
+
+  return SUN_SUCCESS;
+}
+
+static uint64_t sparse_binary_align(uint64_t offset)
+{
+  return (offset + SUN_SPARSEBINARY_ALIGN - 1) / SUN_SPARSEBINARY_ALIGN *
+         SUN_SPARSEBINARY_ALIGN;
+}
+
+SUNErrCode SUNSparseMatrix_WriteBinary(SUNMatrix A, FILE* outfile)
+{
+  SUNFunctionBegin(A->sunctx);
+  sunSparseBinaryHeader hdr;
+  uint64_t np, nnz;
+
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_SPARSE, SUN_ERR_ARG_WRONGTYPE);
+  SUNAssert(outfile, SUN_ERR_ARG_CORRUPT);
+
+  np  = (uint64_t)SM_NP_S(A);
+  nnz = (uint64_t)SM_INDEXPTRS_S(A)[np];
+
+  memset(&hdr, 0, sizeof(hdr));
+  memcpy(hdr.magic, SUN_SPARSEBINARY_MAGIC, sizeof(hdr.magic));
+  hdr.byte_order       = 0x01020304;
+  hdr.real_size        = (uint32_t)sizeof(sunrealtype);
+  hdr.index_size       = (uint32_t)sizeof(sunindextype);
+  hdr.sparsetype       = (uint32_t)SM_SPARSETYPE_S(A);
+  hdr.rows             = (uint64_t)SM_ROWS_S(A);
+  hdr.cols             = (uint64_t)SM_COLUMNS_S(A);
+  hdr.nnz              = nnz;
+  hdr.indexvals_offset = sparse_binary_align(sizeof(hdr) +
+                                             (np + 1) * sizeof(sunindextype));
+  hdr.data_offset = sparse_binary_align(hdr.indexvals_offset +
+                                        nnz * sizeof(sunindextype));
+
+  if (fwrite(&hdr, sizeof(hdr), 1, outfile) != 1) { return SUN_ERR_OP_FAIL; }
+
+  if (fwrite(SM_INDEXPTRS_S(A), sizeof(sunindextype), np + 1, outfile) !=
+      np + 1)
+  {
+    return SUN_ERR_OP_FAIL;
+  }
+  if (sparse_binary_pad(outfile, (np + 1) * sizeof(sunindextype)))
+  {
+    return SUN_ERR_OP_FAIL;
+  }
+
+  if (nnz > 0)
+  {
+    if (fwrite(SM_INDEXVALS_S(A), sizeof(sunindextype), nnz, outfile) != nnz)
+    {
+      return SUN_ERR_OP_FAIL;
+    }
+    if (sparse_binary_pad(outfile, nnz * sizeof(sunindextype)))
+    {
+      return SUN_ERR_OP_FAIL;
+    }
+
+    if (fwrite(SM_DATA_S(A), sizeof(sunrealtype), nnz, outfile) != nnz)
+    {
+      return SUN_ERR_OP_FAIL;
+    }
+  }
+
+  return SUN_SUCCESS;
+}
+
+/* Skip the padding after an array in a binary file */
+static SUNErrCode sparse_binary_skip(FILE* infile, uint64_t nbytes)
+{
+  char pad[SUN_SPARSEBINARY_ALIGN];
+  size_t npad = (SUN_SPARSEBINARY_ALIGN - nbytes % SUN_SPARSEBINARY_ALIGN) %
+                SUN_SPARSEBINARY_ALIGN;
+  if (npad && fread(pad, 1, npad, infile) != npad) { return SUN_ERR_OP_FAIL; }
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNSparseMatrix_ReadBinary(FILE* infile, SUNContext sunctx,
+                                      SUNMatrix* A)
+{
+  SUNFunctionBegin(sunctx);
+  SUNErrCode err = SUN_SUCCESS;
+  sunSparseBinaryHeader hdr;
+  SUNMatrix B;
+  uint64_t np, nnz;
+  const uint64_t index_max = (1ULL << (8 * sizeof(sunindextype) - 1)) - 1;
+
+  SUNAssert(infile && A, SUN_ERR_ARG_CORRUPT);
+
+  *A = NULL;
+
+  if (fread(&hdr, sizeof(hdr), 1, infile) != 1) { return SUN_ERR_OP_FAIL; }
+  if (memcmp(hdr.magic, SUN_SPARSEBINARY_MAGIC, sizeof(hdr.magic)) ||
+      hdr.byte_order != 0x01020304 ||
+      hdr.real_size != (uint32_t)sizeof(sunrealtype) ||
+      hdr.index_size != (uint32_t)sizeof(sunindextype) ||
+      (hdr.sparsetype != CSC_MAT && hdr.sparsetype != CSR_MAT) ||
+      hdr.rows < 1 || hdr.cols < 1)
+  {
+    return SUN_ERR_ARG_INCOMPATIBLE;
+  }
+  if (hdr.rows > index_max || hdr.cols > index_max || hdr.nnz > index_max)
+  {
+    return SUN_ERR_OUTOFRANGE;
+  }
+
+  nnz = hdr.nnz;
+  B   = SUNSparseMatrix((sunindextype)hdr.rows, (sunindextype)hdr.cols,
+                        (sunindextype)SUNMAX(nnz, 1), (int)hdr.sparsetype,
+                        sunctx);
+  if (B == NULL) { return SUN_ERR_MALLOC_FAIL; }
+  np = (uint64_t)SM_NP_S(B);
+
+  if (fread(SM_INDEXPTRS_S(B), sizeof(sunindextype), np + 1, infile) != np + 1)
+  {
+    err = SUN_ERR_OP_FAIL;
+  }
+  if (!err)
+  {
+    err = sparse_binary_skip(infile, (np + 1) * sizeof(sunindextype));
+  }
+  if (!err && nnz > 0)
+  {
+    if (fread(SM_INDEXVALS_S(B), sizeof(sunindextype), nnz, infile) != nnz)
+    {
+      err = SUN_ERR_OP_FAIL;
+    }
+    if (!err) { err = sparse_binary_skip(infile, nnz * sizeof(sunindextype)); }
+    if (!err && fread(SM_DATA_S(B), sizeof(sunrealtype), nnz, infile) != nnz)
+    {
+      err = SUN_ERR_OP_FAIL;
+    }
+  }
+  if (!err) { err = sparse_binary_check(B, (sunindextype)nnz); }
+  if (err)
+  {
+    SUNMatDestroy(B);
+    return err;
+  }
+
+  *A = B;
+
+  return SUN_SUCCESS;
+}
+
 /* ----------------------------------------------------------------------------
  * Functions to access the contents of the sparse matrix structure
  */
@@ -598,6 +905,9 @@ SUNErrCode SUNMatCopy_Sparse(SUNMatrix A, SUNMatrix B)
                                          A_nz * sizeof(sunrealtype));
     SUNAssert(SM_DATA_S(B), SUN_ERR_MALLOC_FAIL);
 
+    SUNAllocAuditRecord(A->sunctx,
+                        A_nz * (sizeof(sunindextype) + sizeof(sunrealtype)));
+
     SM_NNZ_S(B) = A_nz;
   }
 
@@ -705,6 +1015,8 @@ SUNErrCode SUNMatScaleAddI_Sparse(sunrealtype c, SUNMatrix A)
     SUNAssert(w, SUN_ERR_MALLOC_FAIL);
     x = (sunrealtype*)malloc(M * sizeof(sunrealtype));
     SUNAssert(x, SUN_ERR_MALLOC_FAIL);
+    SUNAllocAuditRecord(A->sunctx,
+                        M * (sizeof(sunindextype) + sizeof(sunrealtype)));
 
     /* determine storage location where last column (row) should end */
     nz = Ap[N] + newvals;
@@ -769,6 +1081,7 @@ SUNErrCode SUNMatScaleAddI_Sparse(sunrealtype c, SUNMatrix A)
   {
     /* create work array for nonzero values in a single column (row) */
     x = (sunrealtype*)malloc(M * sizeof(sunrealtype));
+    SUNAllocAuditRecord(A->sunctx, M * sizeof(sunrealtype));
 
     /* create new matrix for sum */
     C = SUNSparseMatrix(SM_ROWS_S(A), SM_COLUMNS_S(A), Ap[N] + newvals,
@@ -900,6 +1213,8 @@ SUNErrCode SUNMatScaleAdd_Sparse(sunrealtype c, SUNMatrix A, SUNMatrix B)
   SUNAssert(w, SUN_ERR_MALLOC_FAIL);
   x = (sunrealtype*)malloc(M * sizeof(sunrealtype));
   SUNAssert(x, SUN_ERR_MALLOC_FAIL);
+  SUNAllocAuditRecord(A->sunctx,
+                      M * (sizeof(sunindextype) + sizeof(sunrealtype)));
 
   /* determine if A already contains the sparsity pattern of B */
   newvals = 0;
@@ -1115,6 +1430,43 @@ SUNErrCode SUNMatSpace_Sparse(SUNMatrix A, long int* lenrw, long int* leniw)
   return SUN_SUCCESS;
 }
 
+SUNErrCode SUNMatWriteCapture_Sparse(SUNMatrix A, SUNLinSysCaptureRecord* rec,
+                                     FILE* outfile)
+{
+  size_t np, nnz;
+  SUNFunctionBegin(A->sunctx);
+  SUNAssert(SUNMatGetID(A) == SUNMATRIX_SPARSE, SUN_ERR_ARG_WRONGTYPE);
+  SUNAssert(rec, SUN_ERR_ARG_CORRUPT);
+  SUNAssert(outfile, SUN_ERR_ARG_CORRUPT);
+
+  np  = (size_t)SM_NP_S(A);
+  nnz = (size_t)SM_INDEXPTRS_S(A)[np];
+
+  rec->format = (SM_SPARSETYPE_S(A) == CSC_MAT) ? SUN_LINSYSCAPTURE_CSC
+                                                : SUN_LINSYSCAPTURE_CSR;
+  rec->rows   = SM_ROWS_S(A);
+  rec->cols   = SM_COLUMNS_S(A);
+  rec->upper  = (int64_t)nnz;
+  rec->lower  = 0;
+
+  /* record header followed by the index pointers, the index values, and the
+     data of the nonzeros in use */
+  if (fwrite(rec, sizeof(*rec), 1, outfile) != 1) { return SUN_ERR_OP_FAIL; }
+  if (fwrite(SM_INDEXPTRS_S(A), sizeof(sunindextype), np + 1, outfile) !=
+      np + 1)
+  {
+    return SUN_ERR_OP_FAIL;
+  }
+  if (nnz > 0 &&
+      (fwrite(SM_INDEXVALS_S(A), sizeof(sunindextype), nnz, outfile) != nnz ||
+       fwrite(SM_DATA_S(A), sizeof(sunrealtype), nnz, outfile) != nnz))
+  {
+    return SUN_ERR_OP_FAIL;
+  }
+
+  return SUN_SUCCESS;
+}
+
 /*
  * =================================================================
  * private functions
@@ -1324,3 +1676,104 @@ SUNErrCode format_convert(const SUNMatrix A, SUNMatrix B)
 
   return SUN_SUCCESS;
 }
+
+/* ----------------------------------------------------------------------------
+ * Create a sparse matrix from Matrix Market entries. The entries are sorted by
+ * the minor and then (stably) by the major index with two counting sorts, so
+ * each column (CSC) or row (CSR) is in increasing order and duplicates are
+ * next to each other.
+ */
+
+SUNErrCode coo_to_sparse(sunMatrixMarketCOO* coo, int sparsetype,
+                         SUNContext sunctx, SUNMatrix* Aout)
+{
+  SUNFunctionBegin(sunctx);
+  SUNErrCode err;
+  SUNMatrix A;
+  sunindextype *major, *minor, *count, *perm;
+  sunindextype *indexptrs, *indexvals;
+  sunrealtype* data;
+  sunindextype np, nminor, k, p, q, start, end, nz;
+
+  major  = (sparsetype == CSR_MAT) ? coo->row : coo->col;
+  minor  = (sparsetype == CSR_MAT) ? coo->col : coo->row;
+  np     = (sparsetype == CSR_MAT) ? coo->rows : coo->cols;
+  nminor = (sparsetype == CSR_MAT) ? coo->cols : coo->rows;
+
+  A = SUNSparseMatrix(coo->rows, coo->cols, SUNMAX(coo->nnz, 1), sparsetype,
+                      sunctx);
+  if (A == NULL) { return SUN_ERR_MALLOC_FAIL; }
+
+  indexptrs = SM_INDEXPTRS_S(A);
+  indexvals = SM_INDEXVALS_S(A);
+  data      = SM_DATA_S(A);
+
+  count = (sunindextype*)calloc(SUNMAX(np, nminor) + 1, sizeof(sunindextype));
+  perm  = (sunindextype*)malloc(SUNMAX(coo->nnz, 1) * sizeof(sunindextype));
+  if (count == NULL || perm == NULL)
+  {
+    free(count);
+    free(perm);
+    SUNMatDestroy(A);
+    return SUN_ERR_MALLOC_FAIL;
+  }
+
+  /* sort by the minor index */
+  for (k = 0; k < coo->nnz; k++) { count[minor[k] + 1]++; }
+  for (q = 0; q < nminor; q++) { count[q + 1] += count[q]; }
+  for (k = 0; k < coo->nnz; k++) { perm[count[minor[k]]++] = k; }
+
+  /* sort by the major index keeping the minor index order */
+  for (p = 0; p <= np; p++) { indexptrs[p] = 0; }
+  for (k = 0; k < coo->nnz; k++) { indexptrs[major[k] + 1]++; }
+  for (p = 0; p < np; p++) { indexptrs[p + 1] += indexptrs[p]; }
+  for (p = 0; p < np; p++) { count[p] = indexptrs[p]; }
+  for (q = 0; q < coo->nnz; q++)
+  {
+    k            = perm[q];
+    p            = count[major[k]]++;
+    indexvals[p] = minor[k];
+    data[p]      = coo->val[k];
+  }
+
+  /* add duplicate entries together */
+  nz    = 0;
+  start = 0;
+  for (p = 0; p < np; p++)
+  {
+    end          = indexptrs[p + 1];
+    indexptrs[p] = nz;
+    for (q = start; q < end; q++)
+    {
+      if (nz > indexptrs[p] && indexvals[nz - 1] == indexvals[q])
+      {
+        data[nz - 1] += data[q];
+      }
+      else
+      {
+        indexvals[nz] = indexvals[q];
+        data[nz]      = data[q];
+        nz++;
+      }
+    }
+    start = end;
+  }
+  indexptrs[np] = nz;
+
+  free(count);
+  free(perm);
+
+  if (nz > 0 && nz < SM_NNZ_S(A))
+  {
+    err = SUNSparseMatrix_Realloc(A);
+    if (err)
+    {
+      SUNMatDestroy(A);
+      return err;
+    }
+  }
+
+  *Aout = A;
+
+  return SUN_SUCCESS;
+}
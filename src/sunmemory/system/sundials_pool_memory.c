@@ -0,0 +1,504 @@
+/* -----------------------------------------------------------------
+ * Programmer(s): Cody J. Balos @ LLNL
+ * -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * SUNDIALS memory helper implementation that keeps released system
+ * memory in size class free lists so that it can be reused.
+ * ----------------------------------------------------------------*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <sundials/priv/sundials_errors_impl.h>
+#include <sundials/sundials_errors.h>
+#include <sundials/sundials_math.h>
+#include <sundials/sundials_memory.h>
+#include <sunmemory/sunmemory_pool.h>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#if defined(MADV_HUGEPAGE)
+#define SUNDIALS_POOL_HUGE_PAGES
+#endif
+#endif
+
+#include "sundials_debug.h"
+#include "sundials_macros.h"
+
+/*
+ * Size classes
+ *
+ * Requests are rounded up to a size class. The smallest class is 64 bytes and
+ * each power of two is split into four classes, so at most 25% of a block is
+ * unused. Requests larger than the largest class are not pooled.
+ */
+
+#define POOL_MIN_BITS    6
+#define POOL_MAX_BITS    30
+#define POOL_SUBCLASSES  4
+#define POOL_NUM_CLASSES (1 + (POOL_MAX_BITS - POOL_MIN_BITS) * POOL_SUBCLASSES)
+
+/* Index used for the statistics of requests that are not pooled */
+#define POOL_UNPOOLED POOL_NUM_CLASSES
+
+/* Blocks up to this size are carved from arena chunks of the given size */
+#define POOL_ARENA_MAX_BLOCK ((size_t)64 * 1024)
+#define POOL_ARENA_BYTES     ((size_t)2 * 1024 * 1024)
+
+/* Size of a transparent huge page */
+#define POOL_HUGE_PAGE_BYTES ((size_t)2 * 1024 * 1024)
+
+#define POOL_DEFAULT_ALIGNMENT 64
+
+/* A released block, the link is stored in the block itself */
+typedef struct sunPoolBlock_
+{
+  struct sunPoolBlock_* next;
+} sunPoolBlock;
+
+struct SUNMemoryHelper_Content_Pool_
+{
+  /* settings */
+  size_t alignment;
+  sunbooleantype huge_pages;
+
+  /* released blocks for each size class */
+  sunPoolBlock* free_list[POOL_NUM_CLASSES];
+
+  /* unused part of the current arena chunk */
+  char* arena_ptr;
+  size_t arena_left;
+
+  /* pooled memory obtained from the system, freed by Destroy */
+  void** sys_blocks;
+  size_t num_sys_blocks;
+  size_t max_sys_blocks;
+
+  /* released SUNMemory objects, linked through their ptr field */
+  SUNMemory free_mem;
+
+  /* statistics */
+  unsigned long num_allocations;
+  unsigned long num_deallocations;
+  unsigned long num_reused;
+  unsigned long num_sys_allocations;
+  size_t bytes_allocated;
+  size_t bytes_high_watermark;
+  size_t bytes_reserved;
+  unsigned long class_requests[POOL_NUM_CLASSES + 1];
+  unsigned long class_in_use[POOL_NUM_CLASSES + 1];
+  unsigned long class_peak[POOL_NUM_CLASSES + 1];
+};
+
+typedef struct SUNMemoryHelper_Content_Pool_ SUNMemoryHelper_Content_Pool;
+
+#define SUNHELPER_CONTENT(h) ((SUNMemoryHelper_Content_Pool*)h->content)
+
+/* Returns the size class of a request or POOL_UNPOOLED */
+static int sunPoolSizeClass(size_t bytes)
+{
+  int bits = 0;
+  size_t n;
+
+  if (bytes <= ((size_t)1 << POOL_MIN_BITS)) { return 0; }
+  if (bytes > ((size_t)1 << POOL_MAX_BITS)) { return POOL_UNPOOLED; }
+
+  /* bytes - 1 is in [2^bits, 2^(bits+1)) */
+  n = bytes - 1;
+  while (n >> (bits + 1)) { bits++; }
+
+  return 1 + (bits - POOL_MIN_BITS) * POOL_SUBCLASSES +
+         (int)((n >> (bits - 2)) & (POOL_SUBCLASSES - 1));
+}
+
+/* Returns the block size of a size class */
+static size_t sunPoolClassBytes(int k)
+{
+  int bits, sub;
+
+  if (k == 0) { return (size_t)1 << POOL_MIN_BITS; }
+
+  bits = POOL_MIN_BITS + (k - 1) / POOL_SUBCLASSES;
+  sub  = (k - 1) % POOL_SUBCLASSES;
+
+  return ((size_t)1 << bits) + (size_t)(sub + 1) * ((size_t)1 << (bits - 2));
+}
+
+/* Allocates aligned memory from the system. The pointer returned by malloc is
+   stored just before the aligned block. */
+static void* sunPoolSysAlloc(SUNMemoryHelper_Content_Pool* pool, size_t bytes)
+{
+  size_t align = pool->alignment;
+  char* raw    = NULL;
+  char* ptr    = NULL;
+
+  if (pool->huge_pages && bytes >= POOL_HUGE_PAGE_BYTES)
+  {
+    align = SUNMAX(align, POOL_HUGE_PAGE_BYTES);
+  }
+
+  raw = (char*)malloc(bytes + align + sizeof(void*));
+  if (raw == NULL) { return NULL; }
+
+  ptr = (char*)(((uintptr_t)(raw + sizeof(void*)) + align - 1) &
+                ~((uintptr_t)align - 1));
+  ((void**)ptr)[-1] = raw;
+
+#if defined(SUNDIALS_POOL_HUGE_PAGES)
+  if (align >= POOL_HUGE_PAGE_BYTES)
+  {
+    /* Only a hint, the memory is usable if the kernel declines */
+    (void)madvise(ptr, bytes & ~(POOL_HUGE_PAGE_BYTES - 1), MADV_HUGEPAGE);
+  }
+#endif
+
+  pool->num_sys_allocations++;
+  pool->bytes_reserved += bytes;
+
+  return ptr;
+}
+
+static void sunPoolSysFree(void* ptr) { free(((void**)ptr)[-1]); }
+
+/* Allocates system memory that is kept until the helper is destroyed */
+static void* sunPoolReserve(SUNMemoryHelper_Content_Pool* pool, size_t bytes)
+{
+  void* ptr     = NULL;
+  void** blocks = NULL;
+
+  if (pool->num_sys_blocks == pool->max_sys_blocks)
+  {
+    size_t new_max = SUNMAX(2 * pool->max_sys_blocks, 64);
+    blocks = (void**)realloc(pool->sys_blocks, new_max * sizeof(void*));
+    if (blocks == NULL) { return NULL; }
+    pool->sys_blocks     = blocks;
+    pool->max_sys_blocks = new_max;
+  }
+
+  ptr = sunPoolSysAlloc(pool, bytes);
+  if (ptr) { pool->sys_blocks[pool->num_sys_blocks++] = ptr; }
+
+  return ptr;
+}
+
+/* Returns a new block for size class k */
+static void* sunPoolNewBlock(SUNMemoryHelper_Content_Pool* pool, int k)
+{
+  size_t bytes = sunPoolClassBytes(k);
+  void* ptr    = NULL;
+
+  if (bytes > POOL_ARENA_MAX_BLOCK) { return sunPoolReserve(pool, bytes); }
+
+  /* Keep every block in the arena aligned */
+  bytes = (bytes + pool->alignment - 1) & ~(pool->alignment - 1);
+
+  if (pool->arena_left < bytes)
+  {
+    /* The rest of the old chunk is released to the smaller classes it fits */
+    while (pool->arena_left >= sunPoolClassBytes(0))
+    {
+      int j = sunPoolSizeClass(pool->arena_left);
+      if (sunPoolClassBytes(j) > pool->arena_left) { j--; }
+      size_t jbytes = (sunPoolClassBytes(j) + pool->alignment - 1) &
+                      ~(pool->alignment - 1);
+      if (jbytes > pool->arena_left) { break; }
+      ((sunPoolBlock*)pool->arena_ptr)->next = pool->free_list[j];
+      pool->free_list[j] = (sunPoolBlock*)pool->arena_ptr;
+      pool->arena_ptr += jbytes;
+      pool->arena_left -= jbytes;
+    }
+
+    pool->arena_ptr = (char*)sunPoolReserve(pool, POOL_ARENA_BYTES);
+    if (pool->arena_ptr == NULL)
+    {
+      pool->arena_left = 0;
+      return NULL;
+    }
+    pool->arena_left = POOL_ARENA_BYTES;
+  }
+
+  ptr = pool->arena_ptr;
+  pool->arena_ptr += bytes;
+  pool->arena_left -= bytes;
+
+  return ptr;
+}
+
+SUNMemoryHelper SUNMemoryHelper_Pool(SUNContext sunctx)
+{
+  SUNFunctionBegin(sunctx);
+
+  SUNMemoryHelper helper;
+
+  /* Allocate the helper */
+  helper = SUNMemoryHelper_NewEmpty(sunctx);
+  SUNCheckLastErrNull();
+
+  /* Set the ops */
+  helper->ops->alloc         = SUNMemoryHelper_Alloc_Pool;
+  helper->ops->dealloc       = SUNMemoryHelper_Dealloc_Pool;
+  helper->ops->copy          = SUNMemoryHelper_Copy_Pool;
+  helper->ops->getallocstats = SUNMemoryHelper_GetAllocStats_Pool;
+  helper->ops->clone         = SUNMemoryHelper_Clone_Pool;
+  helper->ops->destroy       = SUNMemoryHelper_Destroy_Pool;
+
+  /* Attach content, all free lists and statistics start at zero */
+  helper->content = (SUNMemoryHelper_Content_Pool*)calloc(
+    1, sizeof(SUNMemoryHelper_Content_Pool));
+  SUNAssertNull(helper->content, SUN_ERR_MALLOC_FAIL);
+
+  SUNHELPER_CONTENT(helper)->alignment  = POOL_DEFAULT_ALIGNMENT;
+  SUNHELPER_CONTENT(helper)->huge_pages = SUNFALSE;
+
+  return helper;
+}
+
+SUNErrCode SUNMemoryHelper_SetAlignment_Pool(SUNMemoryHelper helper,
+                                             size_t alignment)
+{
+  SUNFunctionBegin(helper->sunctx);
+
+  SUNMemoryHelper_Content_Pool* pool = SUNHELPER_CONTENT(helper);
+
+  if (alignment == 0) { alignment = POOL_DEFAULT_ALIGNMENT; }
+
+  /* The alignment must be a power of two that can hold a free list link */
+  SUNAssert(alignment >= sizeof(sunPoolBlock) &&
+              (alignment & (alignment - 1)) == 0,
+            SUN_ERR_ARG_OUTOFRANGE);
+
+  /* Blocks already in the pool have the old alignment */
+  SUNAssert(pool->num_sys_allocations == 0, SUN_ERR_ARG_INCOMPATIBLE);
+
+  pool->alignment = alignment;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMemoryHelper_SetUseHugePages_Pool(SUNMemoryHelper helper,
+                                                sunbooleantype onoff)
+{
+  SUNFunctionBegin(helper->sunctx);
+  SUNHELPER_CONTENT(helper)->huge_pages = onoff;
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMemoryHelper_Alloc_Pool(SUNMemoryHelper helper, SUNMemory* memptr,
+                                      size_t mem_size, SUNMemoryType mem_type,
+                                      SUNDIALS_MAYBE_UNUSED void* queue)
+{
+  SUNFunctionBegin(helper->sunctx);
+
+  SUNMemoryHelper_Content_Pool* pool = SUNHELPER_CONTENT(helper);
+  SUNMemory mem                      = NULL;
+  int k;
+
+  SUNAssert(mem_type == SUNMEMTYPE_HOST, SUN_ERR_ARG_INCOMPATIBLE);
+
+  /* Reuse a released SUNMemory object if possible */
+  if (pool->free_mem)
+  {
+    mem            = pool->free_mem;
+    pool->free_mem = (SUNMemory)mem->ptr;
+  }
+  else
+  {
+    mem = SUNMemoryNewEmpty(helper->sunctx);
+    SUNCheckLastErr();
+  }
+
+  mem->ptr   = NULL;
+  mem->own   = SUNTRUE;
+  mem->type  = mem_type;
+  mem->bytes = mem_size;
+
+  k = sunPoolSizeClass(mem_size);
+
+  if (k == POOL_UNPOOLED) { mem->ptr = sunPoolSysAlloc(pool, mem_size); }
+  else if (pool->free_list[k])
+  {
+    mem->ptr           = pool->free_list[k];
+    pool->free_list[k] = pool->free_list[k]->next;
+    pool->num_reused++;
+  }
+  else { mem->ptr = sunPoolNewBlock(pool, k); }
+
+  SUNAssert(mem->ptr, SUN_ERR_MALLOC_FAIL);
+
+  pool->bytes_allocated += mem_size;
+  pool->num_allocations++;
+  pool->bytes_high_watermark = SUNMAX(pool->bytes_allocated,
+                                      pool->bytes_high_watermark);
+
+  pool->class_requests[k]++;
+  pool->class_in_use[k]++;
+  pool->class_peak[k] = SUNMAX(pool->class_in_use[k], pool->class_peak[k]);
+
+  *memptr = mem;
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMemoryHelper_Dealloc_Pool(SUNMemoryHelper helper, SUNMemory mem,
+                                        SUNDIALS_MAYBE_UNUSED void* queue)
+{
+  SUNFunctionBegin(helper->sunctx);
+
+  SUNMemoryHelper_Content_Pool* pool = SUNHELPER_CONTENT(helper);
+  int k;
+
+  if (mem == NULL) { return SUN_SUCCESS; }
+
+  SUNAssert(mem->type == SUNMEMTYPE_HOST, SUN_ERR_ARG_INCOMPATIBLE);
+
+  if (mem->ptr != NULL && mem->own)
+  {
+    k = sunPoolSizeClass(mem->bytes);
+
+    pool->num_deallocations++;
+    pool->bytes_allocated -= mem->bytes;
+    pool->class_in_use[k]--;
+
+    if (k == POOL_UNPOOLED)
+    {
+      pool->bytes_reserved -= mem->bytes;
+      sunPoolSysFree(mem->ptr);
+    }
+    else
+    {
+      ((sunPoolBlock*)mem->ptr)->next = pool->free_list[k];
+      pool->free_list[k]              = (sunPoolBlock*)mem->ptr;
+    }
+  }
+
+  /* Keep the SUNMemory object for the next allocation */
+  mem->ptr       = pool->free_mem;
+  pool->free_mem = mem;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMemoryHelper_Copy_Pool(SUNMemoryHelper helper, SUNMemory dst,
+                                     SUNMemory src, size_t memory_size,
+                                     SUNDIALS_MAYBE_UNUSED void* queue)
+{
+  SUNFunctionBegin(helper->sunctx);
+  SUNAssert(src->type == SUNMEMTYPE_HOST, SUN_ERR_ARG_INCOMPATIBLE);
+  SUNAssert(dst->type == SUNMEMTYPE_HOST, SUN_ERR_ARG_INCOMPATIBLE);
+  memcpy(dst->ptr, src->ptr, memory_size);
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMemoryHelper_GetAllocStats_Pool(
+  SUNMemoryHelper helper, SUNDIALS_MAYBE_UNUSED SUNMemoryType mem_type,
+  unsigned long* num_allocations, unsigned long* num_deallocations,
+  size_t* bytes_allocated, size_t* bytes_high_watermark)
+{
+  SUNFunctionBegin(helper->sunctx);
+  SUNAssert(mem_type == SUNMEMTYPE_HOST, SUN_ERR_ARG_INCOMPATIBLE);
+  *num_allocations      = SUNHELPER_CONTENT(helper)->num_allocations;
+  *num_deallocations    = SUNHELPER_CONTENT(helper)->num_deallocations;
+  *bytes_allocated      = SUNHELPER_CONTENT(helper)->bytes_allocated;
+  *bytes_high_watermark = SUNHELPER_CONTENT(helper)->bytes_high_watermark;
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMemoryHelper_GetPoolStats_Pool(SUNMemoryHelper helper,
+                                             unsigned long* num_reused,
+                                             unsigned long* num_sys_allocations,
+                                             size_t* bytes_reserved)
+{
+  SUNFunctionBegin(helper->sunctx);
+  *num_reused          = SUNHELPER_CONTENT(helper)->num_reused;
+  *num_sys_allocations = SUNHELPER_CONTENT(helper)->num_sys_allocations;
+  *bytes_reserved      = SUNHELPER_CONTENT(helper)->bytes_reserved;
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMemoryHelper_PrintStats_Pool(SUNMemoryHelper helper,
+                                           FILE* outfile)
+{
+  SUNFunctionBegin(helper->sunctx);
+
+  SUNMemoryHelper_Content_Pool* pool = SUNHELPER_CONTENT(helper);
+  int k;
+
+  SUNAssert(outfile, SUN_ERR_ARG_CORRUPT);
+
+  fprintf(outfile, "%-28s = %lu\n", "Allocations", pool->num_allocations);
+  fprintf(outfile, "%-28s = %lu\n", "Deallocations", pool->num_deallocations);
+  fprintf(outfile, "%-28s = %lu\n", "Allocations reusing a block",
+          pool->num_reused);
+  fprintf(outfile, "%-28s = %lu\n", "System allocations",
+          pool->num_sys_allocations);
+  fprintf(outfile, "%-28s = %zu\n", "Bytes allocated", pool->bytes_allocated);
+  fprintf(outfile, "%-28s = %zu\n", "Bytes high watermark",
+          pool->bytes_high_watermark);
+  fprintf(outfile, "%-28s = %zu\n", "Bytes reserved", pool->bytes_reserved);
+
+  fprintf(outfile, "\n%12s %12s %12s %12s\n", "Block bytes", "Requests",
+          "In use", "Peak");
+  for (k = 0; k <= POOL_NUM_CLASSES; k++)
+  {
+    if (!pool->class_requests[k]) { continue; }
+    if (k == POOL_UNPOOLED) { fprintf(outfile, "%12s", "unpooled"); }
+    else { fprintf(outfile, "%12zu", sunPoolClassBytes(k)); }
+    fprintf(outfile, " %12lu %12lu %12lu\n", pool->class_requests[k],
+            pool->class_in_use[k], pool->class_peak[k]);
+  }
+
+  return SUN_SUCCESS;
+}
+
+SUNMemoryHelper SUNMemoryHelper_Clone_Pool(SUNMemoryHelper helper)
+{
+  SUNFunctionBegin(helper->sunctx);
+  SUNMemoryHelper hclone = SUNMemoryHelper_Pool(helper->sunctx);
+  SUNCheckLastErrNull();
+  SUNHELPER_CONTENT(hclone)->alignment  = SUNHELPER_CONTENT(helper)->alignment;
+  SUNHELPER_CONTENT(hclone)->huge_pages = SUNHELPER_CONTENT(helper)->huge_pages;
+  return hclone;
+}
+
+SUNErrCode SUNMemoryHelper_Destroy_Pool(SUNMemoryHelper helper)
+{
+  SUNMemoryHelper_Content_Pool* pool = NULL;
+  SUNMemory mem                      = NULL;
+  size_t i;
+
+  if (helper)
+  {
+    pool = SUNHELPER_CONTENT(helper);
+    if (pool)
+    {
+      /* Pooled blocks are returned to the system all at once */
+      for (i = 0; i < pool->num_sys_blocks; i++)
+      {
+        sunPoolSysFree(pool->sys_blocks[i]);
+      }
+      free(pool->sys_blocks);
+
+      while (pool->free_mem)
+      {
+        mem            = pool->free_mem;
+        pool->free_mem = (SUNMemory)mem->ptr;
+        free(mem);
+      }
+
+      free(pool);
+    }
+    if (helper->ops) { free(helper->ops); }
+    free(helper);
+  }
+  return SUN_SUCCESS;
+}
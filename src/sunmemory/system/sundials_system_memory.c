@@ -90,6 +90,7 @@ SUNErrCode SUNMemoryHelper_Alloc_Sys(SUNMemoryHelper helper, SUNMemory* memptr,
   {
     mem->ptr = malloc(mem_size);
     SUNAssert(mem->ptr, SUN_ERR_MALLOC_FAIL);
+    SUNAllocAuditRecord(helper->sunctx, mem_size);
     SUNHELPER_CONTENT(helper)->bytes_allocated += mem_size;
     SUNHELPER_CONTENT(helper)->num_allocations++;
     SUNHELPER_CONTENT(helper)->bytes_high_watermark =
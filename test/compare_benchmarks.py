@@ -14,12 +14,12 @@
 # -----------------------------------------------------------------------------
 
 import os
+import sys
 import glob
+import json
 import argparse
 import multiprocessing as mp
 
-import thicket as tt
-
 
 def main():
     parser = argparse.ArgumentParser(description='Compare Sundials performance results against previous results')
@@ -36,8 +36,15 @@ def main():
 
     parser.add_argument('--threshold', dest="threshold", type=float, help='the percentage threshold in performance difference that indicates a regression', default=2.0)
 
+    parser.add_argument('--json', dest='jsonFiles', type=str, nargs=2, metavar=('BASELINE', 'CURRENT'), help='compare two solver benchmark JSON files instead of caliper files')
+
+    parser.add_argument('--mintime', dest='minTime', type=float, help='ignore wall time changes in JSON runs faster than this many seconds', default=1.0e-3)
+
     args = parser.parse_args()
 
+    if args.jsonFiles:
+        sys.exit(compare_json(args.jsonFiles[0], args.jsonFiles[1], args.threshold, args.minTime, args.outPath))
+
     release = args.release
     releaseDir = args.releaseDir
     caliDir = args.caliDir
@@ -70,6 +77,8 @@ def main():
     return 0
 
 def process_benchmark(jobID, isRelease, releaseDir, benchmarkDir, threshold):
+    import thicket as tt
+
     # Get the current benchmark run
     benchmarkFiles = glob.glob("%s/*.cali" % benchmarkDir)
     # Don't compare if the run didn't include this benchmark
@@ -105,5 +114,62 @@ def process_benchmark(jobID, isRelease, releaseDir, benchmarkDir, threshold):
         return benchmarkName
 
 
+def compare_json(baselineFile, currentFile, threshold, minTime, outPath):
+    """Compare solver benchmark results (benchmarks/solvers) and report any
+    configuration that fails, needs more work, is less accurate, or is slower
+    than the baseline by more than the threshold percentage."""
+
+    def load(fileName):
+        with open(fileName, 'r') as f:
+            data = json.load(f)
+        results = {}
+        for res in data['results']:
+            key = (data['package'], res['problem'], res['method'], res['linsol'], res['rtol'])
+            results[key] = res
+        return results
+
+    baseline = load(baselineFile)
+    current = load(currentFile)
+
+    tolerance = 1.0 + threshold / 100
+    counters = ['steps', 'rhs_evals', 'jac_evals', 'nonlin_iters', 'lin_iters']
+
+    regressions = []
+    for key, cur in current.items():
+        if key not in baseline:
+            continue
+        base = baseline[key]
+        name = "%s %s %s %s rtol=%g" % key
+
+        if base['status'] >= 0 and cur['status'] < 0:
+            regressions.append("%s: failed with flag %d" % (name, cur['status']))
+            continue
+
+        for counter in counters:
+            if cur[counter] > base[counter] * tolerance:
+                regressions.append("%s: %s increased from %d to %d" % (name, counter, base[counter], cur[counter]))
+
+        if base['error'] is not None and cur['error'] is not None:
+            if cur['error'] > base['error'] * tolerance:
+                regressions.append("%s: error increased from %g to %g" % (name, base['error'], cur['error']))
+
+        if base['wall_time'] >= minTime and cur['wall_time'] > base['wall_time'] * tolerance:
+            regressions.append("%s: wall time increased from %g to %g s" % (name, base['wall_time'], cur['wall_time']))
+
+    for line in regressions:
+        print(line)
+
+    if outPath != "/dev/null":
+        if not os.path.exists(outPath):
+            os.makedirs(outPath)
+        with open("%s/benchmark_output.out" % outPath, 'w') as outFile:
+            for line in regressions:
+                outFile.write(line + "\n")
+
+    print("Compared %d configurations, found %d regressions" % (len(current), len(regressions)))
+
+    return 1 if regressions else 0
+
+
 if __name__ == "__main__":
     main()
@@ -0,0 +1,179 @@
+/*---------------------------------------------------------------
+ * Programmer(s): Daniel R. Reynolds @ SMU
+ *---------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ *----------------------------------------------------------------
+ * Routine to test the compile-time ERK tables and step kernels
+ * against the runtime Butcher tables and ERKStep.
+ *-----------------------------------------------------------------*/
+
+// Header files
+#include <arkode/arkode_erkstep.h>
+#include <arkode/arkode_erkstep_kernels.hpp>
+#include <cmath>
+#include <iostream>
+#include <nvector/nvector_serial.h>
+#include <sundials/sundials_context.hpp>
+#include <sundials/sundials_math.h>
+#include <vector>
+
+using sundials::arkode::ERKKernel;
+using sundials::arkode::ERKTable;
+
+// Lotka-Volterra RHS on raw arrays
+static int lv(sunrealtype t, const sunrealtype* y, sunrealtype* ydot)
+{
+  ydot[0] = SUN_RCONST(1.5) * y[0] - y[0] * y[1];
+  ydot[1] = -SUN_RCONST(3.0) * y[1] + y[0] * y[1];
+  return 0;
+}
+
+// Lotka-Volterra RHS for ERKStep
+static int f(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  return lv(t, N_VGetArrayPointer(y), N_VGetArrayPointer(ydot));
+}
+
+// Check a compile-time table matches the runtime table
+template<class Table>
+static int check_table(ARKODE_ERKTableID id)
+{
+  ARKodeButcherTable B = ARKodeButcherTable_LoadERK(id);
+  int stages           = Table::stages;
+  int q                = Table::q;
+  int p                = Table::p;
+  int fails            = 0;
+
+  if (B->stages != stages || B->q != q || B->p != p) { fails++; }
+
+  for (int i = 0; i < B->stages && !fails; i++)
+  {
+    if (B->b[i] != Table::b(i) || B->c[i] != Table::c(i) ||
+        B->d[i] != Table::d(i))
+    {
+      fails++;
+    }
+    for (int j = 0; j < B->stages; j++)
+    {
+      if (B->A[i][j] != Table::A(i, j)) { fails++; }
+    }
+  }
+
+  ARKodeButcherTable_Free(B);
+
+  std::cout << "Table " << ARKodeButcherTable_ERKIDToName(id) << ": "
+            << (fails ? "coefficients differ" : "coefficients match") << "\n";
+
+  return fails ? 1 : 0;
+}
+
+// Compare fixed step kernel results against ERKStep
+static int check_kernel(ARKODE_ERKTableID id, sundials::Context& sunctx)
+{
+  const sunrealtype h     = SUN_RCONST(0.01);
+  const sunrealtype tf    = SUN_RCONST(1.0);
+  const sunrealtype tol   = SUN_RCONST(1.0e-12);
+  const sunrealtype y0[2] = {SUN_RCONST(1.0), SUN_RCONST(1.0)};
+  int fails               = 0;
+
+  // integrate with ERKStep
+  N_Vector y = N_VNew_Serial(2, sunctx);
+  NV_Ith_S(y, 0) = y0[0];
+  NV_Ith_S(y, 1) = y0[1];
+
+  void* arkode_mem = ERKStepCreate(f, SUN_RCONST(0.0), y, sunctx);
+  ERKStepSetTableNum(arkode_mem, id);
+  ARKodeSetFixedStep(arkode_mem, h);
+  ARKodeSetStopTime(arkode_mem, tf);
+
+  sunrealtype t = SUN_RCONST(0.0);
+  ARKodeEvolve(arkode_mem, tf, y, &t, ARK_NORMAL);
+
+  // integrate with the kernel
+  ERKKernel kernel(id);
+  std::vector<sunrealtype> work(kernel.WorkspaceSize(2));
+  std::vector<sunrealtype> yk(y0, y0 + 2);
+  std::vector<sunrealtype> ynew(2), yerr(2), ygen(2), egen(2);
+  sunrealtype errdiff = SUN_RCONST(0.0);
+
+  int nsteps = static_cast<int>(std::lround(tf / h));
+  for (int i = 0; i < nsteps; i++)
+  {
+    fails += kernel.Step(lv, i * h, h, 2, yk.data(), ynew.data(), yerr.data(),
+                         work.data());
+
+    // the generic step must give the same solution and error estimate
+    ARKodeButcherTable B = ARKodeButcherTable_LoadERK(id);
+    fails += sundials::arkode::impl::ERKStepGeneric(B, lv, i * h, h, 2,
+                                                    yk.data(), ygen.data(),
+                                                    egen.data(), work.data());
+    ARKodeButcherTable_Free(B);
+    for (int k = 0; k < 2; k++)
+    {
+      errdiff = SUNMAX(errdiff, SUNRabs(ynew[k] - ygen[k]));
+      errdiff = SUNMAX(errdiff, SUNRabs(yerr[k] - egen[k]));
+    }
+
+    yk = ynew;
+  }
+
+  sunrealtype soldiff = SUNMAX(SUNRabs(yk[0] - NV_Ith_S(y, 0)),
+                               SUNRabs(yk[1] - NV_Ith_S(y, 1)));
+
+  if (soldiff > tol || errdiff > tol) { fails++; }
+
+  std::cout << "Kernel " << ARKodeButcherTable_ERKIDToName(id) << " ("
+            << (kernel.IsSpecialized() ? "specialized" : "generic")
+            << "): " << (fails ? "differs from" : "matches") << " ERKStep\n";
+
+  ARKodeFree(&arkode_mem);
+  N_VDestroy(y);
+
+  return fails ? 1 : 0;
+}
+
+// Main Program
+int main()
+{
+  int numfails = 0;
+  sundials::Context sunctx;
+
+  // check the compile-time tables
+  std::cout << "\nTesting compile-time ERK tables:\n\n";
+#define CHECK_TABLE(name) numfails += check_table<ERKTable<name>>(name);
+  ARKODE_ERK_CONSTEXPR_TABLES(CHECK_TABLE)
+#undef CHECK_TABLE
+
+  // check the step kernels, including tables without a specialization
+  std::cout << "\nTesting ERK step kernels:\n\n";
+  numfails += check_kernel(ARKODE_BOGACKI_SHAMPINE_4_2_3, sunctx);
+  numfails += check_kernel(ARKODE_DORMAND_PRINCE_7_4_5, sunctx);
+  numfails += check_kernel(ARKODE_VERNER_9_5_6, sunctx);
+  numfails += check_kernel(ARKODE_VERNER_16_8_9, sunctx);
+  numfails += check_kernel(ARKODE_FEHLBERG_6_4_5, sunctx);
+
+  // an invalid table is reported rather than stepped
+  ERKKernel invalid(ARKODE_ERK_NONE);
+  if (invalid.IsValid() ||
+      invalid.Step(lv, 0, 0, 0, nullptr, nullptr, nullptr, nullptr) !=
+        ARK_ILL_INPUT)
+  {
+    std::cout << "Invalid table ID was not rejected\n";
+    numfails++;
+  }
+
+  if (numfails) { std::cout << "\n\nFAIL: " << numfails << " failures\n"; }
+  else { std::cout << "\n\nSUCCESS\n"; }
+
+  return numfails;
+}
+
+/*---- end of file ----*/
@@ -0,0 +1,175 @@
+/* -----------------------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for batched dense output. The interpolant and its derivatives are
+ * evaluated at many times in the last step with ARKodeGetDkyBatch and compared
+ * to ARKodeGetDky for the Hermite and Lagrange interpolation modules.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "arkode/arkode_erkstep.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+
+#define NOUT   100
+#define NSTEPS 5
+#define MAXK   3
+
+/* Brusselator RHS */
+static int f(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* yd = N_VGetArrayPointer(y);
+  sunrealtype* fd = N_VGetArrayPointer(ydot);
+
+  fd[0] = ONE - SUN_RCONST(4.0) * yd[0] + yd[0] * yd[0] * yd[1];
+  fd[1] = SUN_RCONST(3.0) * yd[0] - yd[0] * yd[0] * yd[1];
+
+  return 0;
+}
+
+/* Take a few steps and compare the batched and single time dense output */
+static int test_interp(SUNContext sunctx, int itype, int degree,
+                       const char* name)
+{
+  int i, k, retval;
+  int fails       = 0;
+  sunrealtype t   = ZERO;
+  sunrealtype hold, err, tout[NOUT];
+  N_Vector y      = NULL;
+  N_Vector dky    = NULL;
+  N_Vector* dkyb  = NULL;
+  void* arkode_mem = NULL;
+
+  y = N_VNew_Serial(2, sunctx);
+  if (!y) { return 1; }
+  NV_Ith_S(y, 0) = SUN_RCONST(1.2);
+  NV_Ith_S(y, 1) = SUN_RCONST(3.1);
+
+  dky  = N_VClone(y);
+  dkyb = N_VCloneVectorArray(NOUT, y);
+  if (!dky || !dkyb) { return 1; }
+
+  arkode_mem = ERKStepCreate(f, ZERO, y, sunctx);
+  if (!arkode_mem) { return 1; }
+
+  if (ARKodeSStolerances(arkode_mem, SUN_RCONST(1.0e-6), SUN_RCONST(1.0e-10)))
+  {
+    return 1;
+  }
+  if (ARKodeSetInterpolantType(arkode_mem, itype)) { return 1; }
+  if (ARKodeSetInterpolantDegree(arkode_mem, degree)) { return 1; }
+
+  for (i = 0; i < NSTEPS; i++)
+  {
+    retval = ARKodeEvolve(arkode_mem, SUN_RCONST(10.0), y, &t, ARK_ONE_STEP);
+    if (retval < 0)
+    {
+      fprintf(stderr, "%s: ARKodeEvolve returned %i\n", name, retval);
+      return 1;
+    }
+  }
+
+  if (ARKodeGetLastStep(arkode_mem, &hold)) { return 1; }
+  for (i = 0; i < NOUT; i++) { tout[i] = t - hold * i / (NOUT - 1); }
+
+  for (k = 0; k <= MAXK; k++)
+  {
+    retval = ARKodeGetDkyBatch(arkode_mem, NOUT, tout, k, dkyb);
+    if (retval)
+    {
+      fprintf(stderr, "%s: ARKodeGetDkyBatch returned %i\n", name, retval);
+      return 1;
+    }
+
+    err = ZERO;
+    for (i = 0; i < NOUT; i++)
+    {
+      retval = ARKodeGetDky(arkode_mem, tout[i], k, dky);
+      if (retval)
+      {
+        fprintf(stderr, "%s: ARKodeGetDky returned %i\n", name, retval);
+        return 1;
+      }
+      N_VLinearSum(ONE, dkyb[i], -ONE, dky, dky);
+      err = SUNMAX(err, N_VMaxNorm(dky) / (ONE + N_VMaxNorm(dkyb[i])));
+    }
+
+    printf("%s: k = %i, max diff = %" GSYM "\n", name, k, err);
+    if (err > SUN_RCONST(10.0) * SUN_UNIT_ROUNDOFF)
+    {
+      fprintf(stderr, "%s: batched dense output differs for k = %i\n", name, k);
+      fails++;
+    }
+  }
+
+  /* Times outside of the last step are rejected before any output */
+  tout[NOUT / 2] = t + hold;
+  retval         = ARKodeGetDkyBatch(arkode_mem, NOUT, tout, 0, dkyb);
+  if (retval != ARK_BAD_T)
+  {
+    fprintf(stderr, "%s: expected ARK_BAD_T, got %i\n", name, retval);
+    fails++;
+  }
+
+  ARKodeFree(&arkode_mem);
+  N_VDestroy(y);
+  N_VDestroy(dky);
+  N_VDestroyVectorArray(dkyb, NOUT);
+
+  return fails;
+}
+
+/* Main program */
+int main(int argc, char* argv[])
+{
+  int retval        = 0;
+  int fails         = 0;
+  SUNContext sunctx = NULL;
+
+  /* Create the SUNDIALS context object for this simulation. */
+  retval = SUNContext_Create(SUN_COMM_NULL, &sunctx);
+  if (retval)
+  {
+    fprintf(stderr, "SUNContext_Create returned %i\n", retval);
+    return 1;
+  }
+
+  fails += test_interp(sunctx, ARK_INTERP_HERMITE, 5, "Hermite");
+  fails += test_interp(sunctx, ARK_INTERP_HERMITE, 3, "Hermite (cubic)");
+  fails += test_interp(sunctx, ARK_INTERP_LAGRANGE, 3, "Lagrange");
+
+  SUNContext_Free(&sunctx);
+
+  if (fails)
+  {
+    printf("FAIL: %d tests failed\n", fails);
+    return 1;
+  }
+
+  printf("SUCCESS\n");
+
+  return 0;
+}
+
+/*---- end of file ----*/
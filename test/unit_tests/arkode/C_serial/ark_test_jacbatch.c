@@ -0,0 +1,252 @@
+/* -----------------------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for the batched RHS function used in the difference quotient
+ * Jacobian approximation. A nonlinear diffusion-reaction problem is solved with
+ * the dense and band linear solvers, with and without a batched RHS function,
+ * and the results are compared. The problem is also solved with inequality
+ * constraints that flip the sign of some difference quotient increments.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "arkode/arkode_arkstep.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sunlinsol/sunlinsol_band.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_band.h"
+#include "sunmatrix/sunmatrix_dense.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+#define TWO  SUN_RCONST(2.0)
+
+#define NEQ      10
+#define MAXBATCH 4
+#define T0       SUN_RCONST(0.0)
+#define TF       SUN_RCONST(1.0)
+
+/* Number of calls to the batched RHS function */
+static long int nbatchcalls = 0;
+
+/* Diffusion with a nonlinear reaction term and zero boundary values. The RHS
+   is odd in y, so the solution for a negated initial condition is negated. */
+static int f(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* yd = N_VGetArrayPointer(y);
+  sunrealtype* fd = N_VGetArrayPointer(ydot);
+  sunrealtype dx2 = SUN_RCONST(1.0) / ((NEQ + 1) * (NEQ + 1));
+  sunindextype i;
+
+  for (i = 0; i < NEQ; i++)
+  {
+    sunrealtype yl = (i > 0) ? yd[i - 1] : ZERO;
+    sunrealtype yr = (i < NEQ - 1) ? yd[i + 1] : ZERO;
+    fd[i]          = (yl - TWO * yd[i] + yr) / dx2 - yd[i] * SUNRabs(yd[i]);
+  }
+
+  return 0;
+}
+
+/* Batched RHS */
+static int fbatch(int nbatch, sunrealtype t, N_Vector* y, N_Vector* ydot,
+                  void* user_data)
+{
+  int b, retval;
+
+  nbatchcalls++;
+  for (b = 0; b < nbatch; b++)
+  {
+    retval = f(t, y[b], ydot[b], user_data);
+    if (retval) { return retval; }
+  }
+
+  return 0;
+}
+
+/* Set the initial condition. With constraints, the solution is nonpositive
+   and starts at zero in the first component so that the increment for that
+   component must be negated to satisfy the constraint. */
+static void set_ic(N_Vector y, int constrained)
+{
+  sunindextype i;
+  for (i = 0; i < NEQ; i++)
+  {
+    sunrealtype x  = (sunrealtype)(i + 1) / (NEQ + 1);
+    NV_Ith_S(y, i) = SUN_RCONST(4.0) * x * (ONE - x);
+  }
+  if (constrained)
+  {
+    N_VScale(-ONE, y, y);
+    NV_Ith_S(y, 0) = ZERO;
+  }
+}
+
+/* Solve with the given matrix and linear solver, with or without the batched
+   RHS function and constraints (y <= 0) */
+static int solve(SUNContext sunctx, SUNMatrix A, SUNLinearSolver LS, int batch,
+                 N_Vector constraints, N_Vector y, long int* nfeLS)
+{
+  int retval;
+  sunrealtype t;
+  void* arkode_mem;
+
+  set_ic(y, constraints != NULL);
+
+  arkode_mem = ARKStepCreate(NULL, f, T0, y, sunctx);
+  if (!arkode_mem) { return 1; }
+
+  retval = ARKodeSStolerances(arkode_mem, SUN_RCONST(1.0e-6),
+                              SUN_RCONST(1.0e-10));
+  if (retval) { return retval; }
+
+  retval = ARKodeSetLinearSolver(arkode_mem, LS, A);
+  if (retval) { return retval; }
+
+  if (constraints)
+  {
+    retval = ARKodeSetConstraints(arkode_mem, constraints);
+    if (retval) { return retval; }
+  }
+
+  if (batch)
+  {
+    retval = ARKodeSetJacRhsBatchFn(arkode_mem, fbatch, MAXBATCH);
+    if (retval) { return retval; }
+  }
+
+  retval = ARKodeEvolve(arkode_mem, TF, y, &t, ARK_NORMAL);
+  if (retval < 0) { return retval; }
+
+  retval = ARKodeGetNumLinRhsEvals(arkode_mem, nfeLS);
+  if (retval) { return retval; }
+
+  ARKodeFree(&arkode_mem);
+
+  return 0;
+}
+
+/* Main program */
+int main(int argc, char* argv[])
+{
+  int i, k;
+  int retval            = 0;
+  int fails             = 0;
+  long int nfeLS        = 0;
+  long int nfeLS_ref    = 0;
+  SUNContext sunctx     = NULL;
+  N_Vector y            = NULL;
+  N_Vector y_ref        = NULL;
+  N_Vector cns[2]       = {NULL, NULL};
+  SUNMatrix A[2]        = {NULL, NULL};
+  SUNLinearSolver LS[2] = {NULL, NULL};
+  sunrealtype err       = ZERO;
+
+  const char* const names[]     = {"Dense", "Band"};
+  const char* const cns_names[] = {"", ", constraints"};
+
+  /* Create the SUNDIALS context object for this simulation. */
+  retval = SUNContext_Create(SUN_COMM_NULL, &sunctx);
+  if (retval)
+  {
+    fprintf(stderr, "SUNContext_Create returned %i\n", retval);
+    return 1;
+  }
+
+  y      = N_VNew_Serial(NEQ, sunctx);
+  y_ref  = N_VNew_Serial(NEQ, sunctx);
+  cns[1] = N_VNew_Serial(NEQ, sunctx);
+  if (!y || !y_ref || !cns[1])
+  {
+    fprintf(stderr, "N_VNew_Serial returned NULL\n");
+    return 1;
+  }
+  N_VConst(-ONE, cns[1]);
+
+  A[0]  = SUNDenseMatrix(NEQ, NEQ, sunctx);
+  LS[0] = SUNLinSol_Dense(y, A[0], sunctx);
+  A[1]  = SUNBandMatrix(NEQ, 1, 1, sunctx);
+  LS[1] = SUNLinSol_Band(y, A[1], sunctx);
+  if (!A[0] || !LS[0] || !A[1] || !LS[1]) { return 1; }
+
+  /* -------------------------------------------------------- *
+   * Batched DQ Jacobians match the column-by-column versions *
+   * -------------------------------------------------------- */
+
+  for (k = 0; k < 2; k++)
+  {
+    for (i = 0; i < 2; i++)
+    {
+      retval = solve(sunctx, A[i], LS[i], 0, cns[k], y_ref, &nfeLS_ref);
+      if (retval)
+      {
+        fprintf(stderr, "%s%s: reference solve returned %i\n", names[i],
+                cns_names[k], retval);
+        return 1;
+      }
+
+      nbatchcalls = 0;
+      retval      = solve(sunctx, A[i], LS[i], 1, cns[k], y, &nfeLS);
+      if (retval)
+      {
+        fprintf(stderr, "%s%s: batched solve returned %i\n", names[i],
+                cns_names[k], retval);
+        return 1;
+      }
+
+      N_VLinearSum(ONE, y, -ONE, y_ref, y_ref);
+      err = N_VMaxNorm(y_ref);
+      printf("%s%s: DQ RHS evals = %li (reference %li), batch calls = %li, "
+             "max diff = %" GSYM "\n",
+             names[i], cns_names[k], nfeLS, nfeLS_ref, nbatchcalls, err);
+
+      if (nfeLS != nfeLS_ref || nbatchcalls == 0 || nbatchcalls >= nfeLS ||
+          err > ZERO)
+      {
+        fprintf(stderr, "%s%s: batched DQ Jacobian differs\n", names[i],
+                cns_names[k]);
+        fails++;
+      }
+    }
+  }
+
+  for (i = 0; i < 2; i++)
+  {
+    SUNLinSolFree(LS[i]);
+    SUNMatDestroy(A[i]);
+  }
+  N_VDestroy(y);
+  N_VDestroy(y_ref);
+  N_VDestroy(cns[1]);
+  SUNContext_Free(&sunctx);
+
+  if (fails)
+  {
+    printf("FAIL: %d tests failed\n", fails);
+    return 1;
+  }
+
+  printf("SUCCESS\n");
+
+  return 0;
+}
+
+/*---- end of file ----*/
@@ -0,0 +1,307 @@
+/* -----------------------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for the ARKODE Parareal driver using the Brusselator problem with a
+ * fixed step coarse integrator and adaptive fine integrators
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "arkode/arkode_erkstep.h"
+#include "arkode/arkode_parareal.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/priv/sundials_context_impl.h"
+#include "sundials/sundials_math.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+
+#define NSLICES 8
+#define NFINE   3
+#define T0      SUN_RCONST(0.0)
+#define TF      SUN_RCONST(8.0)
+
+/* Brusselator RHS */
+static int f(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* yd = N_VGetArrayPointer(y);
+  sunrealtype* fd = N_VGetArrayPointer(ydot);
+
+  fd[0] = ONE - SUN_RCONST(4.0) * yd[0] + yd[0] * yd[0] * yd[1];
+  fd[1] = SUN_RCONST(3.0) * yd[0] - yd[0] * yd[0] * yd[1];
+
+  return 0;
+}
+
+static void set_ic(N_Vector y)
+{
+  NV_Ith_S(y, 0) = SUN_RCONST(1.2);
+  NV_Ith_S(y, 1) = SUN_RCONST(3.1);
+}
+
+/* Create the coarse (fixed step Heun) or fine (adaptive) integrator */
+static void* create_integrator(SUNContext sunctx, N_Vector y, int fine)
+{
+  void* arkode_mem = ERKStepCreate(f, T0, y, sunctx);
+  if (!arkode_mem) { return NULL; }
+
+  if (fine)
+  {
+    if (ERKStepSetTableNum(arkode_mem, ARKODE_DORMAND_PRINCE_7_4_5))
+    {
+      return NULL;
+    }
+    if (ARKodeSStolerances(arkode_mem, SUN_RCONST(1.0e-8), SUN_RCONST(1.0e-12)))
+    {
+      return NULL;
+    }
+  }
+  else
+  {
+    if (ERKStepSetTableNum(arkode_mem, ARKODE_HEUN_EULER_2_1_2)) { return NULL; }
+    if (ARKodeSetFixedStep(arkode_mem, SUN_RCONST(0.25))) { return NULL; }
+  }
+
+  return arkode_mem;
+}
+
+static sunrealtype max_diff(N_Vector a, N_Vector b)
+{
+  return SUNMAX(SUNRabs(NV_Ith_S(a, 0) - NV_Ith_S(b, 0)),
+                SUNRabs(NV_Ith_S(a, 1) - NV_Ith_S(b, 1)));
+}
+
+/* Solve with Parareal and the given number of fine integrators */
+static int solve(void* coarse_mem, int nfine, void** fine_mem,
+                 sunrealtype reltol, N_Vector y, int* iters)
+{
+  int retval     = 0;
+  ARKParareal pr = NULL;
+
+  set_ic(y);
+
+  retval = ARKParareal_Create(coarse_mem, nfine, fine_mem, &pr);
+  if (retval) { return retval; }
+
+  retval = ARKParareal_SetTolerances(pr, reltol, SUN_RCONST(1.0e-300));
+  if (retval) { return retval; }
+
+  retval = ARKParareal_Evolve(pr, T0, TF, NSLICES, y);
+  if (retval) { return retval; }
+
+  retval = ARKParareal_GetNumIters(pr, iters);
+  if (retval) { return retval; }
+
+  ARKParareal_Free(&pr);
+
+  return 0;
+}
+
+/* Main program */
+int main(int argc, char* argv[])
+{
+  int i, n;
+  int retval                 = 0;
+  int fails                  = 0;
+  int iters                  = 0;
+  int iters_thr              = 0;
+  SUNContext sunctx          = NULL;
+  SUNContext fine_ctx[NFINE] = {NULL};
+  void* coarse_mem           = NULL;
+  void* fine_mem[NFINE]      = {NULL};
+  N_Vector y                 = NULL;
+  N_Vector y_ref             = NULL;
+  N_Vector y_par             = NULL;
+  N_Vector fine_y[NFINE]     = {NULL};
+  sunrealtype t              = ZERO;
+  sunrealtype err            = ZERO;
+
+  /* Create the SUNDIALS context object for this simulation. */
+  retval = SUNContext_Create(SUN_COMM_NULL, &sunctx);
+  if (retval)
+  {
+    fprintf(stderr, "SUNContext_Create returned %i\n", retval);
+    return 1;
+  }
+
+  y     = N_VNew_Serial(2, sunctx);
+  y_ref = N_VNew_Serial(2, sunctx);
+  y_par = N_VNew_Serial(2, sunctx);
+  if (!y || !y_ref || !y_par)
+  {
+    fprintf(stderr, "N_VNew_Serial returned NULL\n");
+    return 1;
+  }
+  set_ic(y);
+
+  /* Coarse integrator and one fine integrator (with its own context) per
+     thread */
+  coarse_mem = create_integrator(sunctx, y, 0);
+  if (!coarse_mem)
+  {
+    fprintf(stderr, "Failed to create the coarse integrator\n");
+    return 1;
+  }
+
+  for (i = 0; i < NFINE; i++)
+  {
+    if (SUNContext_Create(SUN_COMM_NULL, &fine_ctx[i])) { return 1; }
+    fine_y[i] = N_VNew_Serial(2, fine_ctx[i]);
+    if (!fine_y[i]) { return 1; }
+    set_ic(fine_y[i]);
+    fine_mem[i] = create_integrator(fine_ctx[i], fine_y[i], 1);
+    if (!fine_mem[i])
+    {
+      fprintf(stderr, "Failed to create fine integrator %i\n", i);
+      return 1;
+    }
+  }
+
+  /* ---------------------------------------------------------------- *
+   * Reference: sequential fine solve with a new integrator per slice *
+   * ---------------------------------------------------------------- */
+
+  set_ic(y_ref);
+  for (n = 0; n < NSLICES; n++)
+  {
+    sunrealtype t1  = (n == NSLICES - 1) ? TF
+                                         : T0 + (n + 1) * (TF - T0) / NSLICES;
+    void* slice_mem = create_integrator(sunctx, y_ref, 1);
+    if (!slice_mem) { return 1; }
+    if (ARKodeReset(slice_mem, T0 + n * (TF - T0) / NSLICES, y_ref))
+    {
+      return 1;
+    }
+    if (ARKodeSetStopTime(slice_mem, t1)) { return 1; }
+    if (ARKodeEvolve(slice_mem, t1, y_ref, &t, ARK_NORMAL) < 0) { return 1; }
+    ARKodeFree(&slice_mem);
+  }
+
+  /* ---------------------------------------------------- *
+   * Without a convergence test Parareal equals reference *
+   * ---------------------------------------------------- */
+
+  retval = solve(coarse_mem, 1, fine_mem, SUN_RCONST(1.0e-300), y_par, &iters);
+  if (retval)
+  {
+    fprintf(stderr, "Parareal returned %i\n", retval);
+    return 1;
+  }
+
+  err = max_diff(y_par, y_ref);
+  printf("Exact: iterations = %i, max diff = %" GSYM "\n", iters, err);
+  if (iters != NSLICES || err > ZERO)
+  {
+    fprintf(stderr, "Exact: Parareal differs from the fine solution\n");
+    fails++;
+  }
+
+  /* --------------------------------------------------- *
+   * With a convergence test fewer iterations are needed *
+   * --------------------------------------------------- */
+
+  retval = solve(coarse_mem, 1, fine_mem, SUN_RCONST(1.0e-6), y_par, &iters);
+  if (retval)
+  {
+    fprintf(stderr, "Parareal returned %i\n", retval);
+    return 1;
+  }
+
+  err = max_diff(y_par, y_ref);
+  printf("Converged: iterations = %i, max diff = %" GSYM "\n", iters, err);
+  if (iters >= NSLICES || err > SUN_RCONST(1.0e-5))
+  {
+    fprintf(stderr, "Converged: Parareal did not converge as expected\n");
+    fails++;
+  }
+
+  /* -------------------------------------------------- *
+   * Multiple fine integrators give identical solutions *
+   * -------------------------------------------------- */
+
+  retval = solve(coarse_mem, NFINE, fine_mem, SUN_RCONST(1.0e-6), y,
+                 &iters_thr);
+  if (retval)
+  {
+    fprintf(stderr, "Parareal returned %i\n", retval);
+    return 1;
+  }
+
+  err = max_diff(y, y_par);
+  printf("Threads: iterations = %i, max diff = %" GSYM "\n", iters_thr, err);
+  if (iters_thr != iters || err > ZERO)
+  {
+    fprintf(stderr, "Threads: Parareal results depend on the fine integrator\n");
+    fails++;
+  }
+
+  /* ------------------------------------------------------------------ *
+   * Fine integrators may only share a context that threads can share   *
+   * ------------------------------------------------------------------ */
+
+  {
+    ARKParareal pr      = NULL;
+    void* shared_mem[2] = {NULL, NULL};
+    int expected        = ARK_ILL_INPUT;
+#if defined(SUNDIALS_CONTEXT_SHARED_BY_THREADS)
+    expected = ARK_SUCCESS;
+#endif
+
+    shared_mem[0] = create_integrator(sunctx, y, 1);
+    shared_mem[1] = create_integrator(sunctx, y, 1);
+    if (!shared_mem[0] || !shared_mem[1]) { return 1; }
+
+    retval = ARKParareal_Create(coarse_mem, 2, shared_mem, &pr);
+    if (retval != expected)
+    {
+      fprintf(stderr, "Shared context: ARKParareal_Create returned %i\n",
+              retval);
+      fails++;
+    }
+
+    ARKParareal_Free(&pr);
+    ARKodeFree(&shared_mem[0]);
+    ARKodeFree(&shared_mem[1]);
+  }
+
+  ARKodeFree(&coarse_mem);
+  for (i = 0; i < NFINE; i++)
+  {
+    ARKodeFree(&fine_mem[i]);
+    N_VDestroy(fine_y[i]);
+    SUNContext_Free(&fine_ctx[i]);
+  }
+  N_VDestroy(y);
+  N_VDestroy(y_ref);
+  N_VDestroy(y_par);
+  SUNContext_Free(&sunctx);
+
+  if (fails)
+  {
+    printf("FAIL: %d tests failed\n", fails);
+    return 1;
+  }
+
+  printf("SUCCESS\n");
+
+  return 0;
+}
+
+/*---- end of file ----*/
@@ -0,0 +1,266 @@
+/* -----------------------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for rootfinding with many event functions. The harmonic oscillator
+ * y0' = -y1, y1' = y0 with y(0) = (1, 0) is integrated with the event functions
+ * g_i = y0 - a_i for distinct thresholds a_i in (-1, 1). The roots found using
+ * the full g function, a partial g function, and a partial g function with
+ * inverse quadratic interpolation are compared to each other and to the exact
+ * roots. The test also checks that the partial g function evaluates fewer
+ * components than the full g function.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "arkode/arkode_arkstep.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_dense.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+
+/* number of event functions and maximum number of roots */
+#define NRTFN    500
+#define MAXROOTS (2 * NRTFN)
+
+typedef struct
+{
+  sunrealtype a[NRTFN]; /* event thresholds                */
+  long int ncomp;       /* number of g components computed */
+} UserData;
+
+typedef struct
+{
+  int nroots;                 /* number of roots found */
+  sunrealtype troot[MAXROOTS]; /* root locations        */
+  int iroot[MAXROOTS];        /* root components       */
+  long int nge;               /* number of g calls     */
+  long int ncomp;             /* number of components  */
+} Results;
+
+static int ode_rhs(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* ydata    = N_VGetArrayPointer(y);
+  sunrealtype* ydotdata = N_VGetArrayPointer(ydot);
+  ydotdata[0]           = -ydata[1];
+  ydotdata[1]           = ydata[0];
+  return 0;
+}
+
+static int root_fn(sunrealtype t, N_Vector y, sunrealtype* gout,
+                   void* user_data)
+{
+  UserData* udata    = (UserData*)user_data;
+  sunrealtype* ydata = N_VGetArrayPointer(y);
+  int i;
+
+  for (i = 0; i < NRTFN; i++) { gout[i] = ydata[0] - udata->a[i]; }
+  udata->ncomp += NRTFN;
+  return 0;
+}
+
+static int partial_root_fn(sunrealtype t, N_Vector y, int ncand,
+                           const int* cand, sunrealtype* gout, void* user_data)
+{
+  UserData* udata    = (UserData*)user_data;
+  sunrealtype* ydata = N_VGetArrayPointer(y);
+  int j;
+
+  for (j = 0; j < ncand; j++)
+  {
+    gout[cand[j]] = ydata[0] - udata->a[cand[j]];
+  }
+  udata->ncomp += ncand;
+  return 0;
+}
+
+static int run_test(SUNContext sunctx, int partial, int iqi, Results* res)
+{
+  int flag, i, nfound;
+  int iroots[NRTFN];
+  sunrealtype tf   = SUN_RCONST(6.0);
+  sunrealtype tret = ZERO;
+  UserData udata;
+
+  N_Vector y         = NULL;
+  SUNMatrix A        = NULL;
+  SUNLinearSolver LS = NULL;
+  void* arkode_mem   = NULL;
+
+  for (i = 0; i < NRTFN; i++)
+  {
+    udata.a[i] = SUN_RCONST(-0.99) +
+                 SUN_RCONST(1.98) * ((sunrealtype)i + SUN_RCONST(0.5)) / NRTFN;
+  }
+  udata.ncomp = 0;
+
+  y = N_VNew_Serial(2, sunctx);
+  if (!y) { return 1; }
+  N_VGetArrayPointer(y)[0] = ONE;
+  N_VGetArrayPointer(y)[1] = ZERO;
+
+  A = SUNDenseMatrix(2, 2, sunctx);
+  if (!A) { return 1; }
+
+  LS = SUNLinSol_Dense(y, A, sunctx);
+  if (!LS) { return 1; }
+
+  arkode_mem = ARKStepCreate(NULL, ode_rhs, ZERO, y, sunctx);
+  if (!arkode_mem) { return 1; }
+
+  flag = ARKodeSStolerances(arkode_mem, SUN_RCONST(1.0e-10),
+                            SUN_RCONST(1.0e-12));
+  if (flag) { return 1; }
+
+  flag = ARKodeSetLinearSolver(arkode_mem, LS, A);
+  if (flag) { return 1; }
+
+  flag = ARKodeSetUserData(arkode_mem, &udata);
+  if (flag) { return 1; }
+
+  flag = ARKodeSetMaxNumSteps(arkode_mem, 100000);
+  if (flag) { return 1; }
+
+  flag = ARKodeRootInit(arkode_mem, NRTFN, root_fn);
+  if (flag) { return 1; }
+
+  if (partial)
+  {
+    flag = ARKodeSetPartialRootFn(arkode_mem, partial_root_fn);
+    if (flag) { return 1; }
+  }
+
+  flag = ARKodeSetRootInverseInterp(arkode_mem, iqi ? SUNTRUE : SUNFALSE);
+  if (flag) { return 1; }
+
+  res->nroots = 0;
+  while (tret < tf)
+  {
+    flag = ARKodeEvolve(arkode_mem, tf, y, &tret, ARK_NORMAL);
+    if (flag < 0)
+    {
+      fprintf(stderr, "ARKodeEvolve returned %d\n", flag);
+      return 1;
+    }
+
+    if (flag == ARK_ROOT_RETURN)
+    {
+      flag = ARKodeGetRootInfo(arkode_mem, iroots);
+      if (flag) { return 1; }
+
+      /* the thresholds are distinct so only one root is found at a time */
+      nfound = 0;
+      for (i = 0; i < NRTFN; i++)
+      {
+        if (iroots[i] == 0) { continue; }
+        nfound++;
+        if (res->nroots < MAXROOTS)
+        {
+          res->troot[res->nroots] = tret;
+          res->iroot[res->nroots] = (tret < SUN_RCONST(3.14159)) ? i : -i - 1;
+          res->nroots++;
+        }
+      }
+      if (nfound != 1)
+      {
+        fprintf(stderr, "Found %d roots at t = %" GSYM "\n", nfound, tret);
+        return 1;
+      }
+    }
+  }
+
+  flag = ARKodeGetNumGEvals(arkode_mem, &res->nge);
+  if (flag) { return 1; }
+  res->ncomp = udata.ncomp;
+
+  /* check against the exact roots t = acos(a_i) in the first half period */
+  for (i = 0; i < res->nroots; i++)
+  {
+    if (res->iroot[i] < 0) { continue; }
+    if (SUNRabs(res->troot[i] - acos(udata.a[res->iroot[i]])) >
+        SUN_RCONST(1.0e-6))
+    {
+      fprintf(stderr, "Root %d at t = %" GSYM " is inaccurate\n", i,
+              res->troot[i]);
+      return 1;
+    }
+  }
+
+  N_VDestroy(y);
+  SUNMatDestroy(A);
+  SUNLinSolFree(LS);
+  ARKodeFree(&arkode_mem);
+
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  SUNContext sunctx = NULL;
+  Results res[3];
+  const char* names[3] = {"full g", "partial g", "partial g + IQI"};
+  int flag, i, k;
+
+  flag = SUNContext_Create(SUN_COMM_NULL, &sunctx);
+  if (flag) { return 1; }
+
+  for (k = 0; k < 3; k++)
+  {
+    flag = run_test(sunctx, k > 0, k == 2, &res[k]);
+    if (flag)
+    {
+      fprintf(stderr, "Test with %s failed\n", names[k]);
+      return 1;
+    }
+    printf("%-16s roots = %4d, g calls = %6ld, g components = %9ld\n",
+           names[k], res[k].nroots, res[k].nge, res[k].ncomp);
+  }
+
+  for (k = 1; k < 3; k++)
+  {
+    if (res[k].nroots != res[0].nroots)
+    {
+      fprintf(stderr, "Number of roots differ with %s\n", names[k]);
+      return 1;
+    }
+    for (i = 0; i < res[0].nroots; i++)
+    {
+      if (res[k].iroot[i] != res[0].iroot[i] ||
+          SUNRabs(res[k].troot[i] - res[0].troot[i]) > SUN_RCONST(1.0e-10))
+      {
+        fprintf(stderr, "Root %d differs with %s\n", i, names[k]);
+        return 1;
+      }
+    }
+    if (res[k].ncomp >= res[0].ncomp)
+    {
+      fprintf(stderr, "No reduction in g components with %s\n", names[k]);
+      return 1;
+    }
+  }
+
+  SUNContext_Free(&sunctx);
+
+  printf("SUCCESS\n");
+
+  return 0;
+}
@@ -0,0 +1,255 @@
+/* -----------------------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for the stage group analysis of Butcher tables and the concurrent
+ * evaluation of independent stages in ERKStep
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "arkode/arkode_arkstep.h"
+#include "arkode/arkode_erkstep.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/priv/sundials_context_impl.h"
+#include "sundials/sundials_math.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+
+/* Brusselator RHS */
+static int f(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* yd = N_VGetArrayPointer(y);
+  sunrealtype* fd = N_VGetArrayPointer(ydot);
+
+  fd[0] = ONE - SUN_RCONST(4.0) * yd[0] + yd[0] * yd[0] * yd[1];
+  fd[1] = SUN_RCONST(3.0) * yd[0] - yd[0] * yd[0] * yd[1];
+
+  return 0;
+}
+
+/* Check the stage groups of a table against the expected values */
+static int check_groups(ARKodeButcherTable B, const char* name, int ngroups,
+                        const int* groups)
+{
+  int i, n;
+  int* out = (int*)malloc(B->stages * sizeof(int));
+
+  n = ARKodeButcherTable_StageGroups(B, out);
+  if (n != ngroups)
+  {
+    fprintf(stderr, "%s: expected %i stage groups, found %i\n", name, ngroups,
+            n);
+    free(out);
+    return 1;
+  }
+
+  for (i = 0; i < B->stages; i++)
+  {
+    if (out[i] != groups[i])
+    {
+      fprintf(stderr, "%s: stage %i in group %i, expected %i\n", name, i,
+              out[i], groups[i]);
+      free(out);
+      return 1;
+    }
+  }
+
+  printf("%s: %i stage groups\n", name, n);
+  free(out);
+  return 0;
+}
+
+/* Integrate with ERKStep using the given number of stage threads */
+static int solve(SUNContext sunctx, int nthreads, N_Vector y, long int* nst,
+                 long int* nfe)
+{
+  int retval       = 0;
+  sunrealtype t    = ZERO;
+  void* arkode_mem = NULL;
+
+  NV_Ith_S(y, 0) = SUN_RCONST(1.2);
+  NV_Ith_S(y, 1) = SUN_RCONST(3.1);
+
+  arkode_mem = ERKStepCreate(f, ZERO, y, sunctx);
+  if (!arkode_mem) { return 1; }
+
+  retval = ERKStepSetTableNum(arkode_mem, ARKODE_PARALLEL_ERK_4_2_3);
+  if (retval) { return 1; }
+
+  retval = ARKodeSStolerances(arkode_mem, SUN_RCONST(1.0e-4),
+                              SUN_RCONST(1.0e-8));
+  if (retval) { return 1; }
+
+  retval = ARKodeSetNumStageThreads(arkode_mem, nthreads);
+  if (retval)
+  {
+    fprintf(stderr, "ARKodeSetNumStageThreads returned %i\n", retval);
+    return 1;
+  }
+
+  retval = ARKodeEvolve(arkode_mem, SUN_RCONST(10.0), y, &t, ARK_NORMAL);
+  if (retval < 0)
+  {
+    fprintf(stderr, "ARKodeEvolve returned %i\n", retval);
+    return 1;
+  }
+
+  retval = ARKodeGetNumSteps(arkode_mem, nst);
+  if (retval) { return 1; }
+
+  retval = ERKStepGetNumRhsEvals(arkode_mem, nfe);
+  if (retval) { return 1; }
+
+  ARKodeFree(&arkode_mem);
+
+  return 0;
+}
+
+/* Main program */
+int main(int argc, char* argv[])
+{
+  int retval                         = 0;
+  int fails                          = 0;
+  SUNContext sunctx                  = NULL;
+  N_Vector y_seq                     = NULL;
+  N_Vector y_par                     = NULL;
+  void* arkode_mem                   = NULL;
+  long int nst_seq                   = 0;
+  long int nst_par                   = 0;
+  long int nfe_seq                   = 0;
+  long int nfe_par                   = 0;
+  sunrealtype err                    = ZERO;
+  ARKodeButcherTable B               = NULL;
+  const int erk_groups[4]            = {0, 1, 1, 2};
+  const int dirk_groups[4]           = {0, 0, 1, 1};
+  const int dormand_prince_groups[7] = {0, 1, 2, 3, 4, 5, 6};
+
+  /* Create the SUNDIALS context object for this simulation. */
+  retval = SUNContext_Create(SUN_COMM_NULL, &sunctx);
+  if (retval)
+  {
+    fprintf(stderr, "SUNContext_Create returned %i\n", retval);
+    return 1;
+  }
+
+  /* ----------------------- *
+   * Test the table analysis *
+   * ----------------------- */
+
+  B = ARKodeButcherTable_LoadERK(ARKODE_PARALLEL_ERK_4_2_3);
+  fails += check_groups(B, "ARKODE_PARALLEL_ERK_4_2_3", 3, erk_groups);
+  ARKodeButcherTable_Free(B);
+
+  B = ARKodeButcherTable_LoadDIRK(ARKODE_PARALLEL_DIRK_4_2_4);
+  fails += check_groups(B, "ARKODE_PARALLEL_DIRK_4_2_4", 2, dirk_groups);
+  ARKodeButcherTable_Free(B);
+
+  B = ARKodeButcherTable_LoadERK(ARKODE_DORMAND_PRINCE_7_4_5);
+  fails += check_groups(B, "ARKODE_DORMAND_PRINCE_7_4_5", 7,
+                        dormand_prince_groups);
+  ARKodeButcherTable_Free(B);
+
+  /* ------------------------------------- *
+   * Test concurrent evaluation in ERKStep *
+   * ------------------------------------- */
+
+  y_seq = N_VNew_Serial(2, sunctx);
+  y_par = N_VNew_Serial(2, sunctx);
+  if (!y_seq || !y_par)
+  {
+    fprintf(stderr, "N_VNew_Serial returned NULL\n");
+    return 1;
+  }
+
+  if (solve(sunctx, 1, y_seq, &nst_seq, &nfe_seq)) { return 1; }
+
+#if defined(SUNDIALS_CONTEXT_SHARED_BY_THREADS)
+  if (solve(sunctx, 4, y_par, &nst_par, &nfe_par)) { return 1; }
+
+  err = SUNMAX(SUNRabs(NV_Ith_S(y_seq, 0) - NV_Ith_S(y_par, 0)),
+               SUNRabs(NV_Ith_S(y_seq, 1) - NV_Ith_S(y_par, 1)));
+
+  printf("ERKStep: steps = %li / %li, RHS evals = %li / %li, max diff = %" GSYM
+         "\n",
+         nst_seq, nst_par, nfe_seq, nfe_par, err);
+
+  if (nst_seq != nst_par || nfe_seq != nfe_par || err > ZERO)
+  {
+    fprintf(stderr, "ERKStep: concurrent stages differ from sequential\n");
+    fails++;
+  }
+#else
+  /* Concurrent stages would update the shared profiler or logger */
+  arkode_mem = ERKStepCreate(f, ZERO, y_par, sunctx);
+  if (!arkode_mem)
+  {
+    fprintf(stderr, "ERKStepCreate returned NULL\n");
+    return 1;
+  }
+
+  retval = ARKodeSetNumStageThreads(arkode_mem, 4);
+  if (retval != ARK_ILL_INPUT)
+  {
+    fprintf(stderr, "ERKStep: ARKodeSetNumStageThreads returned %i\n", retval);
+    fails++;
+  }
+
+  ARKodeFree(&arkode_mem);
+  (void)nst_par;
+  (void)nfe_par;
+  (void)err;
+#endif
+
+  /* --------------------------------- *
+   * Test ARKStep reports unsupported  *
+   * --------------------------------- */
+
+  arkode_mem = ARKStepCreate(f, NULL, ZERO, y_seq, sunctx);
+  if (!arkode_mem)
+  {
+    fprintf(stderr, "ARKStepCreate returned NULL\n");
+    return 1;
+  }
+
+  retval = ARKodeSetNumStageThreads(arkode_mem, 4);
+  if (retval != ARK_STEPPER_UNSUPPORTED)
+  {
+    fprintf(stderr, "ARKStep: ARKodeSetNumStageThreads returned %i\n", retval);
+    fails++;
+  }
+
+  ARKodeFree(&arkode_mem);
+  N_VDestroy(y_seq);
+  N_VDestroy(y_par);
+  SUNContext_Free(&sunctx);
+
+  if (fails)
+  {
+    printf("FAIL: %d tests failed\n", fails);
+    return 1;
+  }
+
+  printf("SUCCESS\n");
+
+  return 0;
+}
+
+/*---- end of file ----*/
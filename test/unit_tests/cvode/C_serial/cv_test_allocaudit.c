@@ -0,0 +1,153 @@
+/* -----------------------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for the allocation audit. Steps with a dense linear solver should
+ * not allocate after the first step, while a right-hand side function that
+ * clones a vector should be reported.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cvode/cvode.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_context.h"
+#include "sundials/sundials_nvector.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_dense.h"
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+
+/* Number of equations */
+#define NEQ 4
+
+/* Linear decay, y' = -y */
+static int ode_rhs(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  N_VScale(-ONE, y, ydot);
+  return 0;
+}
+
+/* Linear decay computed with a temporary vector */
+static int ode_rhs_clone(sunrealtype t, N_Vector y, N_Vector ydot,
+                         void* user_data)
+{
+  N_Vector tmp = N_VClone(y);
+  if (!tmp) { return -1; }
+  N_VScale(-ONE, y, tmp);
+  N_VScale(ONE, tmp, ydot);
+  N_VDestroy(tmp);
+  return 0;
+}
+
+/* Integrate to tf and return the allocations after the first step */
+static int run_test(SUNContext sunctx, CVRhsFn rhs, long int* num_allocs)
+{
+  int flag           = 0;
+  long int num_bytes = 0;
+  sunrealtype tret   = ZERO;
+  N_Vector y         = NULL;
+  SUNMatrix A        = NULL;
+  SUNLinearSolver LS = NULL;
+  void* cvode_mem    = NULL;
+
+  /* Start a new audit */
+  flag = SUNContext_SetAllocAudit(sunctx, SUN_ALLOCAUDIT_REPORT);
+  if (flag) { return 1; }
+
+  y = N_VNew_Serial(NEQ, sunctx);
+  if (!y) { return 1; }
+  N_VConst(ONE, y);
+
+  cvode_mem = CVodeCreate(CV_BDF, sunctx);
+  if (!cvode_mem) { return 1; }
+
+  flag = CVodeInit(cvode_mem, rhs, ZERO, y);
+  if (flag) { return 1; }
+
+  flag = CVodeSStolerances(cvode_mem, SUN_RCONST(1.0e-4), SUN_RCONST(1.0e-8));
+  if (flag) { return 1; }
+
+  A = SUNDenseMatrix(NEQ, NEQ, sunctx);
+  if (!A) { return 1; }
+
+  LS = SUNLinSol_Dense(y, A, sunctx);
+  if (!LS) { return 1; }
+
+  flag = CVodeSetLinearSolver(cvode_mem, LS, A);
+  if (flag) { return 1; }
+
+  flag = CVode(cvode_mem, SUN_RCONST(10.0), y, &tret, CV_NORMAL);
+  if (flag < 0) { return 1; }
+
+  flag = SUNContext_GetAllocAuditCounts(sunctx, num_allocs, &num_bytes);
+  if (flag) { return 1; }
+
+  flag = SUNContext_PrintAllocAudit(sunctx, stdout);
+  if (flag) { return 1; }
+
+  CVodeFree(&cvode_mem);
+  SUNLinSolFree(LS);
+  SUNMatDestroy(A);
+  N_VDestroy(y);
+
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  int flag            = 0;
+  long int num_allocs = 0;
+  SUNContext sunctx   = NULL;
+
+  flag = SUNContext_Create(SUN_COMM_NULL, &sunctx);
+  if (flag)
+  {
+    fprintf(stderr, "SUNContext_Create returned %i\n", flag);
+    return 1;
+  }
+
+  /* Steps with the dense linear solver do not allocate */
+  printf("Test without allocations in the right-hand side:\n");
+  flag = run_test(sunctx, ode_rhs, &num_allocs);
+  if (flag) { return 1; }
+  if (num_allocs != 0)
+  {
+    printf("ERROR: expected no allocations after the first step, found %ld\n",
+           num_allocs);
+    return 1;
+  }
+
+  /* Steps clone a vector in the right-hand side */
+  printf("\nTest with allocations in the right-hand side:\n");
+  flag = run_test(sunctx, ode_rhs_clone, &num_allocs);
+  if (flag) { return 1; }
+  if (num_allocs == 0)
+  {
+    printf("ERROR: expected allocations after the first step\n");
+    return 1;
+  }
+
+  /* Allocations are not counted when the audit is off */
+  flag = SUNContext_SetAllocAudit(sunctx, SUN_ALLOCAUDIT_OFF);
+  if (flag) { return 1; }
+  flag = SUNContext_GetAllocAuditCounts(sunctx, &num_allocs, &num_allocs);
+  if (flag || num_allocs != 0) { return 1; }
+
+  SUNContext_Free(&sunctx);
+
+  printf("\nSUCCESS\n");
+
+  return 0;
+}
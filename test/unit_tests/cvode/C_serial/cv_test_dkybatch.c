@@ -0,0 +1,193 @@
+/* -----------------------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for batched dense output. The interpolating polynomial and its
+ * derivatives are evaluated at many times in the last step with
+ * CVodeGetDkyBatch and compared to CVodeGetDky.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cvode/cvode.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_dense.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+
+#define NOUT   100
+#define NSTEPS 40
+
+/* Brusselator RHS */
+static int f(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* yd = N_VGetArrayPointer(y);
+  sunrealtype* fd = N_VGetArrayPointer(ydot);
+
+  fd[0] = ONE - SUN_RCONST(4.0) * yd[0] + yd[0] * yd[0] * yd[1];
+  fd[1] = SUN_RCONST(3.0) * yd[0] - yd[0] * yd[0] * yd[1];
+
+  return 0;
+}
+
+/* Main program */
+int main(int argc, char* argv[])
+{
+  int i, k, q, lmm;
+  int retval         = 0;
+  int fails          = 0;
+  sunrealtype t      = ZERO;
+  sunrealtype hlast  = ZERO;
+  sunrealtype err    = ZERO;
+  sunrealtype tout[NOUT];
+  SUNContext sunctx  = NULL;
+  void* cvode_mem    = NULL;
+  N_Vector y         = NULL;
+  N_Vector dky       = NULL;
+  N_Vector* dkyb     = NULL;
+  SUNMatrix A        = NULL;
+  SUNLinearSolver LS = NULL;
+
+  const int lmms[]          = {CV_BDF, CV_ADAMS};
+  const char* const names[] = {"BDF", "Adams"};
+
+  /* Create the SUNDIALS context object for this simulation. */
+  retval = SUNContext_Create(SUN_COMM_NULL, &sunctx);
+  if (retval)
+  {
+    fprintf(stderr, "SUNContext_Create returned %i\n", retval);
+    return 1;
+  }
+
+  y    = N_VNew_Serial(2, sunctx);
+  dky  = N_VClone(y);
+  dkyb = N_VCloneVectorArray(NOUT, y);
+  if (!y || !dky || !dkyb)
+  {
+    fprintf(stderr, "N_VNew_Serial returned NULL\n");
+    return 1;
+  }
+
+  A  = SUNDenseMatrix(2, 2, sunctx);
+  LS = SUNLinSol_Dense(y, A, sunctx);
+  if (!A || !LS) { return 1; }
+
+  for (lmm = 0; lmm < 2; lmm++)
+  {
+    NV_Ith_S(y, 0) = SUN_RCONST(1.2);
+    NV_Ith_S(y, 1) = SUN_RCONST(3.1);
+
+    cvode_mem = CVodeCreate(lmms[lmm], sunctx);
+    if (!cvode_mem) { return 1; }
+    if (CVodeInit(cvode_mem, f, ZERO, y)) { return 1; }
+    if (CVodeSStolerances(cvode_mem, SUN_RCONST(1.0e-6), SUN_RCONST(1.0e-10)))
+    {
+      return 1;
+    }
+    if (CVodeSetLinearSolver(cvode_mem, LS, A)) { return 1; }
+
+    for (i = 0; i < NSTEPS; i++)
+    {
+      retval = CVode(cvode_mem, SUN_RCONST(20.0), y, &t, CV_ONE_STEP);
+      if (retval < 0)
+      {
+        fprintf(stderr, "%s: CVode returned %i\n", names[lmm], retval);
+        return 1;
+      }
+    }
+
+    if (CVodeGetLastOrder(cvode_mem, &q)) { return 1; }
+    if (CVodeGetLastStep(cvode_mem, &hlast)) { return 1; }
+    for (i = 0; i < NOUT; i++) { tout[i] = t - hlast * i / (NOUT - 1); }
+
+    /* ------------------------------------------------ *
+     * Batched dense output matches single time output  *
+     * ------------------------------------------------ */
+
+    for (k = 0; k <= q; k++)
+    {
+      retval = CVodeGetDkyBatch(cvode_mem, NOUT, tout, k, dkyb);
+      if (retval)
+      {
+        fprintf(stderr, "%s: CVodeGetDkyBatch returned %i\n", names[lmm],
+                retval);
+        return 1;
+      }
+
+      err = ZERO;
+      for (i = 0; i < NOUT; i++)
+      {
+        retval = CVodeGetDky(cvode_mem, tout[i], k, dky);
+        if (retval)
+        {
+          fprintf(stderr, "%s: CVodeGetDky returned %i\n", names[lmm], retval);
+          return 1;
+        }
+        N_VLinearSum(ONE, dkyb[i], -ONE, dky, dky);
+        err = SUNMAX(err, N_VMaxNorm(dky) / (ONE + N_VMaxNorm(dkyb[i])));
+      }
+
+      printf("%s: q = %i, k = %i, max diff = %" GSYM "\n", names[lmm], q, k,
+             err);
+      if (err > SUN_RCONST(100.0) * SUN_UNIT_ROUNDOFF)
+      {
+        fprintf(stderr, "%s: batched dense output differs for k = %i\n",
+                names[lmm], k);
+        fails++;
+      }
+    }
+
+    /* Illegal inputs are rejected */
+    if (CVodeGetDkyBatch(cvode_mem, NOUT, tout, q + 1, dkyb) != CV_BAD_K)
+    {
+      fprintf(stderr, "%s: expected CV_BAD_K\n", names[lmm]);
+      fails++;
+    }
+    tout[NOUT / 2] = t + hlast;
+    if (CVodeGetDkyBatch(cvode_mem, NOUT, tout, 0, dkyb) != CV_BAD_T)
+    {
+      fprintf(stderr, "%s: expected CV_BAD_T\n", names[lmm]);
+      fails++;
+    }
+
+    CVodeFree(&cvode_mem);
+  }
+
+  SUNLinSolFree(LS);
+  SUNMatDestroy(A);
+  N_VDestroy(y);
+  N_VDestroy(dky);
+  N_VDestroyVectorArray(dkyb, NOUT);
+  SUNContext_Free(&sunctx);
+
+  if (fails)
+  {
+    printf("FAIL: %d tests failed\n", fails);
+    return 1;
+  }
+
+  printf("SUCCESS\n");
+
+  return 0;
+}
+
+/*---- end of file ----*/
@@ -0,0 +1,186 @@
+/* -----------------------------------------------------------------------------
+ * Programmer(s): Cody J. Balos @ LLNL
+ * -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test comparing the host fused integrator kernels to the default vector
+ * operations using the Robertson chemical kinetics problem
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cvode/cvode.h"
+#include "cvode/cvode_diag.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_dense.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+
+static int f(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* yd = N_VGetArrayPointer(y);
+  sunrealtype* fd = N_VGetArrayPointer(ydot);
+
+  fd[0] = SUN_RCONST(-0.04) * yd[0] + SUN_RCONST(1.0e4) * yd[1] * yd[2];
+  fd[2] = SUN_RCONST(3.0e7) * yd[1] * yd[1];
+  fd[1] = -fd[0] - fd[2];
+
+  return 0;
+}
+
+/* Integrate to tout and return the solution in yout */
+static int solve(SUNContext sunctx, int lmm, sunbooleantype diag,
+                 sunbooleantype fused, N_Vector yout, long int* nst)
+{
+  int retval         = 0;
+  sunrealtype t      = ZERO;
+  sunrealtype tout   = SUN_RCONST(40.0);
+  N_Vector constr    = NULL;
+  SUNMatrix A        = NULL;
+  SUNLinearSolver LS = NULL;
+  void* cvode_mem    = NULL;
+
+  N_VConst(ZERO, yout);
+  NV_Ith_S(yout, 0) = ONE;
+
+  constr = N_VClone(yout);
+  if (!constr) { return 1; }
+  N_VConst(ONE, constr);
+
+  cvode_mem = CVodeCreate(lmm, sunctx);
+  if (!cvode_mem) { return 1; }
+
+  retval = CVodeInit(cvode_mem, f, ZERO, yout);
+  if (retval) { return 1; }
+
+  retval = CVodeSStolerances(cvode_mem, SUN_RCONST(1.0e-6), SUN_RCONST(1.0e-10));
+  if (retval) { return 1; }
+
+  retval = CVodeSetConstraints(cvode_mem, constr);
+  if (retval) { return 1; }
+
+  retval = CVodeSetMaxNumSteps(cvode_mem, 50000);
+  if (retval) { return 1; }
+
+  if (diag)
+  {
+    retval = CVDiag(cvode_mem);
+    if (retval) { return 1; }
+  }
+  else
+  {
+    A  = SUNDenseMatrix(3, 3, sunctx);
+    LS = SUNLinSol_Dense(yout, A, sunctx);
+    if (!A || !LS) { return 1; }
+    retval = CVodeSetLinearSolver(cvode_mem, LS, A);
+    if (retval) { return 1; }
+  }
+
+  retval = CVodeSetUseIntegratorFusedKernels(cvode_mem, fused);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeSetUseIntegratorFusedKernels returned %i\n", retval);
+    return 1;
+  }
+
+  retval = CVode(cvode_mem, tout, yout, &t, CV_NORMAL);
+  if (retval < 0)
+  {
+    fprintf(stderr, "CVode returned %i\n", retval);
+    return 1;
+  }
+
+  retval = CVodeGetNumSteps(cvode_mem, nst);
+  if (retval) { return 1; }
+
+  CVodeFree(&cvode_mem);
+  SUNLinSolFree(LS);
+  SUNMatDestroy(A);
+  N_VDestroy(constr);
+
+  return 0;
+}
+
+/* Compare the solutions with and without fused kernels */
+static int compare(SUNContext sunctx, int lmm, sunbooleantype diag,
+                   const char* name)
+{
+  int i;
+  long int nst_ref = 0, nst_fused = 0;
+  sunrealtype err   = ZERO;
+  N_Vector y_ref    = N_VNew_Serial(3, sunctx);
+  N_Vector y_fused  = N_VNew_Serial(3, sunctx);
+
+  if (!y_ref || !y_fused) { return 1; }
+
+  if (solve(sunctx, lmm, diag, SUNFALSE, y_ref, &nst_ref)) { return 1; }
+  if (solve(sunctx, lmm, diag, SUNTRUE, y_fused, &nst_fused)) { return 1; }
+
+  for (i = 0; i < 3; i++)
+  {
+    err = SUNMAX(err, SUNRabs(NV_Ith_S(y_ref, i) - NV_Ith_S(y_fused, i)) /
+                        (SUNRabs(NV_Ith_S(y_ref, i)) + SUN_RCONST(1.0e-10)));
+  }
+
+  printf("%s: steps = %ld (reference), %ld (fused), max rel diff = %" GSYM "\n",
+         name, nst_ref, nst_fused, err);
+
+  N_VDestroy(y_ref);
+  N_VDestroy(y_fused);
+
+  if (err > SUN_RCONST(1.0e-6))
+  {
+    fprintf(stderr, "%s: fused solution differs from reference\n", name);
+    return 1;
+  }
+
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  int fails         = 0;
+  SUNContext sunctx = NULL;
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx))
+  {
+    fprintf(stderr, "SUNContext_Create failed\n");
+    return 1;
+  }
+
+  fails += compare(sunctx, CV_BDF, SUNFALSE, "BDF + dense");
+  fails += compare(sunctx, CV_ADAMS, SUNFALSE, "Adams + dense");
+  fails += compare(sunctx, CV_BDF, SUNTRUE, "BDF + diag");
+
+  SUNContext_Free(&sunctx);
+
+  if (fails)
+  {
+    printf("FAIL: %d of 3 tests failed\n", fails);
+    return 1;
+  }
+
+  printf("SUCCESS\n");
+
+  return 0;
+}
+
+/*---- end of file ----*/
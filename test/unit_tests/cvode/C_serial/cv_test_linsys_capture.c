@@ -0,0 +1,285 @@
+/* -----------------------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for capturing linear systems from CVODE. The linear ODE y' = L y,
+ * with L the tridiagonal matrix k * [1 -2 1], is integrated with a dense and a
+ * band matrix while every other linear system (at most MAXSYS systems with at
+ * most MAXRHS right-hand sides each) is written to an archive. The archive is
+ * read back and each matrix is checked against I - gamma L.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cvode/cvode.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sunlinsol/sunlinsol_band.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_band.h"
+#include "sunmatrix/sunmatrix_dense.h"
+
+#define NEQ    8
+#define KCOEF  SUN_RCONST(100.0)
+#define MAXSYS 3
+#define MAXRHS 2
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+#define TWO  SUN_RCONST(2.0)
+
+/* Entry (i,j) of the tridiagonal matrix L */
+static sunrealtype L_entry(sunindextype i, sunindextype j)
+{
+  if (i == j) { return -TWO * KCOEF; }
+  if (i - j == 1 || j - i == 1) { return KCOEF; }
+  return ZERO;
+}
+
+static int ode_rhs(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* ydata    = N_VGetArrayPointer(y);
+  sunrealtype* ydotdata = N_VGetArrayPointer(ydot);
+  sunindextype i;
+
+  for (i = 0; i < NEQ; i++)
+  {
+    ydotdata[i] = L_entry(i, i) * ydata[i];
+    if (i > 0) { ydotdata[i] += L_entry(i, i - 1) * ydata[i - 1]; }
+    if (i < NEQ - 1) { ydotdata[i] += L_entry(i, i + 1) * ydata[i + 1]; }
+  }
+  return 0;
+}
+
+static int ode_jac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix J,
+                   void* user_data, N_Vector tmp1, N_Vector tmp2, N_Vector tmp3)
+{
+  sunindextype i, j;
+
+  for (j = 0; j < NEQ; j++)
+  {
+    for (i = j - 1; i <= j + 1; i++)
+    {
+      if (i < 0 || i >= NEQ) { continue; }
+      if (SUNMatGetID(J) == SUNMATRIX_DENSE)
+      {
+        SM_ELEMENT_D(J, i, j) = L_entry(i, j);
+      }
+      else { SM_ELEMENT_B(J, i, j) = L_entry(i, j); }
+    }
+  }
+  return 0;
+}
+
+/* Read the archive and check its contents */
+static int check_archive(const char* filename, long nsetups, long nsys,
+                         long nrhs)
+{
+  FILE* fp = NULL;
+  char header[24];
+  SUNLinSysCaptureRecord rec;
+  sunrealtype* data = NULL;
+  sunrealtype expected;
+  int64_t i, j, k, ndata;
+  int64_t width = NEQ;
+  long nmat = 0, nvec = 0, nvec_sys = 0;
+  int fails = 0;
+
+  fp = fopen(filename, "rb");
+  if (!fp) { return 1; }
+
+  if (fread(header, sizeof(header), 1, fp) != 1 ||
+      memcmp(header, "SUNLSC01", 8))
+  {
+    fprintf(stderr, "Invalid archive header\n");
+    fclose(fp);
+    return 1;
+  }
+
+  while (fread(&rec, sizeof(rec), 1, fp) == 1)
+  {
+    if (rec.kind == SUN_LINSYSCAPTURE_MATRIX)
+    {
+      if (rec.system != nmat || rec.rows != NEQ || rec.cols != NEQ)
+      {
+        fprintf(stderr, "Unexpected matrix record %ld\n", nmat);
+        fails++;
+        break;
+      }
+      width = (rec.format == SUN_LINSYSCAPTURE_BAND)
+                ? rec.upper + rec.lower + 1
+                : NEQ;
+      ndata = width * NEQ;
+      nmat++;
+      nvec_sys = 0;
+    }
+    else
+    {
+      if (rec.system != nmat - 1 || rec.rows != NEQ || ++nvec_sys > MAXRHS)
+      {
+        fprintf(stderr, "Unexpected right-hand side record %ld\n", nvec);
+        fails++;
+        break;
+      }
+      ndata = NEQ;
+      nvec++;
+    }
+
+    data = (sunrealtype*)realloc(data, ndata * sizeof(sunrealtype));
+    if (!data || fread(data, sizeof(sunrealtype), ndata, fp) != (size_t)ndata)
+    {
+      fails++;
+      break;
+    }
+    if (rec.kind != SUN_LINSYSCAPTURE_MATRIX) { continue; }
+
+    /* Check the matrix against I - gamma L */
+    for (j = 0; j < NEQ; j++)
+    {
+      for (k = 0; k < width; k++)
+      {
+        i = (rec.format == SUN_LINSYSCAPTURE_BAND) ? j - rec.upper + k : k;
+        if (i < 0 || i >= NEQ) { continue; }
+        expected = ((i == j) ? ONE : ZERO) -
+                   (sunrealtype)rec.value * L_entry(i, j);
+        if (SUNRabs(data[j * width + k] - expected) >
+            SUN_RCONST(1.0e-12) * SUNRabs(expected))
+        {
+          fprintf(stderr, "Matrix %ld differs at (%ld, %ld)\n", nmat - 1,
+                  (long)i, (long)j);
+          fails++;
+        }
+      }
+    }
+  }
+
+  free(data);
+  fclose(fp);
+
+  /* Every other system is captured until MAXSYS systems are written */
+  if (nmat != nsys || nmat != SUNMIN((nsetups + 1) / 2, MAXSYS))
+  {
+    fprintf(stderr, "Archive has %ld of %ld systems (%ld setups)\n", nmat,
+            nsys, nsetups);
+    fails++;
+  }
+  if (nvec != nrhs || nvec < nmat)
+  {
+    fprintf(stderr, "Archive has %ld of %ld right-hand sides\n", nvec, nrhs);
+    fails++;
+  }
+
+  return fails;
+}
+
+static int run_test(SUNContext sunctx, int band)
+{
+  int flag, fails;
+  long nsetups, nsys, nrhs;
+  sunrealtype tret;
+  const char* filename = band ? "linsys_band.bin" : "linsys_dense.bin";
+
+  N_Vector y           = NULL;
+  SUNMatrix A          = NULL;
+  SUNLinearSolver LS   = NULL;
+  SUNLinSysCapture cap = NULL;
+  void* cvode_mem      = NULL;
+
+  y = N_VNew_Serial(NEQ, sunctx);
+  if (!y) { return 1; }
+  N_VConst(ONE, y);
+
+  A = band ? SUNBandMatrix(NEQ, 1, 1, sunctx)
+           : SUNDenseMatrix(NEQ, NEQ, sunctx);
+  if (!A) { return 1; }
+
+  LS = band ? SUNLinSol_Band(y, A, sunctx) : SUNLinSol_Dense(y, A, sunctx);
+  if (!LS) { return 1; }
+
+  flag = SUNLinSysCapture_Create(filename, &cap);
+  if (flag) { return 1; }
+
+  flag = SUNLinSysCapture_SetSelection(cap, 2, MAXSYS, MAXRHS);
+  if (flag) { return 1; }
+
+  cvode_mem = CVodeCreate(CV_BDF, sunctx);
+  if (!cvode_mem) { return 1; }
+
+  flag = CVodeInit(cvode_mem, ode_rhs, ZERO, y);
+  if (flag) { return 1; }
+
+  flag = CVodeSStolerances(cvode_mem, SUN_RCONST(1.0e-6),
+                           SUN_RCONST(1.0e-10));
+  if (flag) { return 1; }
+
+  flag = CVodeSetLinearSolver(cvode_mem, LS, A);
+  if (flag) { return 1; }
+
+  flag = CVodeSetJacFn(cvode_mem, ode_jac);
+  if (flag) { return 1; }
+
+  flag = CVodeSetLinSysCapture(cvode_mem, cap);
+  if (flag) { return 1; }
+
+  flag = CVode(cvode_mem, ONE, y, &tret, CV_NORMAL);
+  if (flag < 0)
+  {
+    fprintf(stderr, "CVode returned %d\n", flag);
+    return 1;
+  }
+
+  flag = CVodeGetNumLinSolvSetups(cvode_mem, &nsetups);
+  if (flag) { return 1; }
+
+  SUNLinSysCapture_GetNumSystems(cap, &nsys);
+  SUNLinSysCapture_GetNumRhs(cap, &nrhs);
+
+  flag = SUNLinSysCapture_Destroy(&cap);
+  if (flag) { return 1; }
+
+  fails = check_archive(filename, nsetups, nsys, nrhs);
+
+  printf("%-5s setups = %3ld, systems = %ld, right-hand sides = %ld\n",
+         band ? "band" : "dense", nsetups, nsys, nrhs);
+
+  N_VDestroy(y);
+  SUNMatDestroy(A);
+  SUNLinSolFree(LS);
+  CVodeFree(&cvode_mem);
+
+  return fails;
+}
+
+int main(int argc, char* argv[])
+{
+  SUNContext sunctx = NULL;
+  int fails         = 0;
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx)) { return 1; }
+
+  fails += run_test(sunctx, 0);
+  fails += run_test(sunctx, 1);
+
+  SUNContext_Free(&sunctx);
+
+  if (fails)
+  {
+    printf("FAIL: %d tests failed\n", fails);
+    return 1;
+  }
+
+  printf("SUCCESS\n");
+
+  return 0;
+}
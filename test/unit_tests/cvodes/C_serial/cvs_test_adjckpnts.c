@@ -0,0 +1,400 @@
+/* -----------------------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for limiting the number of adjoint check points. The adjoint of the
+ * Brusselator problem is computed with and without a limit and the results are
+ * compared. The backward sweep is also taken in CV_ONE_STEP mode, where every
+ * call must take a step.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cvodes/cvodes.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_dense.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+
+#define T0     SUN_RCONST(0.0)
+#define TF     SUN_RCONST(20.0)
+#define NSTEPS 10
+
+/* Brusselator RHS */
+static int f(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* yd = N_VGetArrayPointer(y);
+  sunrealtype* fd = N_VGetArrayPointer(ydot);
+
+  fd[0] = ONE - SUN_RCONST(4.0) * yd[0] + yd[0] * yd[0] * yd[1];
+  fd[1] = SUN_RCONST(3.0) * yd[0] - yd[0] * yd[0] * yd[1];
+
+  return 0;
+}
+
+/* Adjoint RHS, yB' = -J^T yB */
+static int fB(sunrealtype t, N_Vector y, N_Vector yB, N_Vector yBdot,
+              void* user_dataB)
+{
+  sunrealtype* yd  = N_VGetArrayPointer(y);
+  sunrealtype* yBd = N_VGetArrayPointer(yB);
+  sunrealtype* fd  = N_VGetArrayPointer(yBdot);
+
+  sunrealtype J00 = -SUN_RCONST(4.0) + SUN_RCONST(2.0) * yd[0] * yd[1];
+  sunrealtype J01 = yd[0] * yd[0];
+  sunrealtype J10 = SUN_RCONST(3.0) - SUN_RCONST(2.0) * yd[0] * yd[1];
+  sunrealtype J11 = -yd[0] * yd[0];
+
+  fd[0] = -(J00 * yBd[0] + J10 * yBd[1]);
+  fd[1] = -(J01 * yBd[0] + J11 * yBd[1]);
+
+  return 0;
+}
+
+/* Gradient with respect to the constant source term, qB' = -yB[0] */
+static int fQB(sunrealtype t, N_Vector y, N_Vector yB, N_Vector qBdot,
+               void* user_dataB)
+{
+  NV_Ith_S(qBdot, 0) = -NV_Ith_S(yB, 0);
+  return 0;
+}
+
+static void set_ic(N_Vector y)
+{
+  NV_Ith_S(y, 0) = SUN_RCONST(1.2);
+  NV_Ith_S(y, 1) = SUN_RCONST(3.1);
+}
+
+static void set_icB(N_Vector yB, N_Vector qB)
+{
+  NV_Ith_S(yB, 0) = ZERO;
+  NV_Ith_S(yB, 1) = ONE;
+  NV_Ith_S(qB, 0) = ZERO;
+}
+
+/* Solve the forward and adjoint problems with at most maxckpnts check points
+   and a given number of backward sweeps */
+static int solve(void* cvode_mem, int which, int maxckpnts, int nsweeps,
+                 N_Vector y, N_Vector yB, N_Vector qB, long int* nststore,
+                 long int* nstrecomp, int* nckpntsmax)
+{
+  int retval, ncheck, i;
+  sunrealtype t;
+
+  set_ic(y);
+  retval = CVodeReInit(cvode_mem, T0, y);
+  if (retval) { return retval; }
+
+  retval = CVodeAdjReInit(cvode_mem);
+  if (retval) { return retval; }
+
+  retval = CVodeSetAdjMaxCheckPoints(cvode_mem, maxckpnts);
+  if (retval) { return retval; }
+
+  retval = CVodeF(cvode_mem, TF, y, &t, CV_NORMAL, &ncheck);
+  if (retval < 0) { return retval; }
+
+  if (maxckpnts > 0 && ncheck + 1 > maxckpnts)
+  {
+    fprintf(stderr, "CVodeF stored %i check points\n", ncheck + 1);
+    return 1;
+  }
+
+  for (i = 0; i < nsweeps; i++)
+  {
+    set_icB(yB, qB);
+    retval = CVodeReInitB(cvode_mem, which, TF, yB);
+    if (retval) { return retval; }
+
+    retval = CVodeQuadReInitB(cvode_mem, which, qB);
+    if (retval) { return retval; }
+
+    retval = CVodeB(cvode_mem, T0, CV_NORMAL);
+    if (retval < 0) { return retval; }
+
+    retval = CVodeGetB(cvode_mem, which, &t, yB);
+    if (retval) { return retval; }
+
+    retval = CVodeGetQuadB(cvode_mem, which, &t, qB);
+    if (retval) { return retval; }
+  }
+
+  return CVodeGetAdjCheckPointStats(cvode_mem, nststore, nstrecomp, nckpntsmax);
+}
+
+/* Take the backward sweep one step at a time and return the number of calls */
+static int solve_one_step(void* cvode_mem, int which, int maxckpnts, N_Vector y,
+                          N_Vector yB, N_Vector qB, long int* ncalls)
+{
+  int retval, ncheck;
+  sunrealtype t, tB;
+  sunrealtype tprev = TF;
+
+  set_ic(y);
+  retval = CVodeReInit(cvode_mem, T0, y);
+  if (retval) { return retval; }
+
+  retval = CVodeAdjReInit(cvode_mem);
+  if (retval) { return retval; }
+
+  retval = CVodeSetAdjMaxCheckPoints(cvode_mem, maxckpnts);
+  if (retval) { return retval; }
+
+  retval = CVodeF(cvode_mem, TF, y, &t, CV_NORMAL, &ncheck);
+  if (retval < 0) { return retval; }
+
+  set_icB(yB, qB);
+  retval = CVodeReInitB(cvode_mem, which, TF, yB);
+  if (retval) { return retval; }
+
+  retval = CVodeQuadReInitB(cvode_mem, which, qB);
+  if (retval) { return retval; }
+
+  *ncalls = 0;
+  do {
+    retval = CVodeB(cvode_mem, T0, CV_ONE_STEP);
+    if (retval < 0) { return retval; }
+    (*ncalls)++;
+
+    retval = CVodeGetB(cvode_mem, which, &tB, yB);
+    if (retval) { return retval; }
+
+    if (tB >= tprev)
+    {
+      fprintf(stderr, "CVodeB did not take a step at t = %" GSYM "\n", tB);
+      return 1;
+    }
+    tprev = tB;
+  }
+  while (tB > T0);
+
+  return CVodeGetQuadB(cvode_mem, which, &t, qB);
+}
+
+static sunrealtype max_diff(N_Vector yB, N_Vector qB, N_Vector yB_ref,
+                            N_Vector qB_ref)
+{
+  sunrealtype err = SUNRabs(NV_Ith_S(qB, 0) - NV_Ith_S(qB_ref, 0));
+  err             = SUNMAX(err, SUNRabs(NV_Ith_S(yB, 0) - NV_Ith_S(yB_ref, 0)));
+  err             = SUNMAX(err, SUNRabs(NV_Ith_S(yB, 1) - NV_Ith_S(yB_ref, 1)));
+  return err;
+}
+
+/* Main program */
+int main(int argc, char* argv[])
+{
+  int i, which;
+  int retval          = 0;
+  int fails           = 0;
+  int nckpntsmax      = 0;
+  long int nststore   = 0;
+  long int nstrecomp  = 0;
+  long int ncalls     = 0;
+  SUNContext sunctx   = NULL;
+  void* cvode_mem     = NULL;
+  void* cvodeB_mem    = NULL;
+  N_Vector y          = NULL;
+  N_Vector yB         = NULL;
+  N_Vector qB         = NULL;
+  N_Vector yB_ref     = NULL;
+  N_Vector qB_ref     = NULL;
+  SUNMatrix A         = NULL;
+  SUNMatrix AB        = NULL;
+  SUNLinearSolver LS  = NULL;
+  SUNLinearSolver LSB = NULL;
+  sunrealtype err     = ZERO;
+
+  /* Limits to test and the number of backward sweeps for each */
+  const int budgets[] = {8, 3, 8};
+  const int sweeps[]  = {1, 1, 2};
+
+  /* Create the SUNDIALS context object for this simulation. */
+  retval = SUNContext_Create(SUN_COMM_NULL, &sunctx);
+  if (retval)
+  {
+    fprintf(stderr, "SUNContext_Create returned %i\n", retval);
+    return 1;
+  }
+
+  y      = N_VNew_Serial(2, sunctx);
+  yB     = N_VNew_Serial(2, sunctx);
+  qB     = N_VNew_Serial(1, sunctx);
+  yB_ref = N_VNew_Serial(2, sunctx);
+  qB_ref = N_VNew_Serial(1, sunctx);
+  if (!y || !yB || !qB || !yB_ref || !qB_ref)
+  {
+    fprintf(stderr, "N_VNew_Serial returned NULL\n");
+    return 1;
+  }
+  set_ic(y);
+  set_icB(yB, qB);
+
+  /* Forward problem */
+  cvode_mem = CVodeCreate(CV_BDF, sunctx);
+  if (!cvode_mem) { return 1; }
+  if (CVodeInit(cvode_mem, f, T0, y)) { return 1; }
+  if (CVodeSStolerances(cvode_mem, SUN_RCONST(1.0e-6), SUN_RCONST(1.0e-10)))
+  {
+    return 1;
+  }
+
+  A  = SUNDenseMatrix(2, 2, sunctx);
+  LS = SUNLinSol_Dense(y, A, sunctx);
+  if (!A || !LS) { return 1; }
+  if (CVodeSetLinearSolver(cvode_mem, LS, A)) { return 1; }
+
+  if (CVodeAdjInit(cvode_mem, NSTEPS, CV_HERMITE)) { return 1; }
+
+  /* Backward problem */
+  if (CVodeCreateB(cvode_mem, CV_BDF, &which)) { return 1; }
+  if (CVodeInitB(cvode_mem, which, fB, TF, yB)) { return 1; }
+  if (CVodeSStolerancesB(cvode_mem, which, SUN_RCONST(1.0e-6),
+                         SUN_RCONST(1.0e-10)))
+  {
+    return 1;
+  }
+
+  AB  = SUNDenseMatrix(2, 2, sunctx);
+  LSB = SUNLinSol_Dense(yB, AB, sunctx);
+  if (!AB || !LSB) { return 1; }
+  if (CVodeSetLinearSolverB(cvode_mem, which, LSB, AB)) { return 1; }
+
+  if (CVodeQuadInitB(cvode_mem, which, fQB, qB)) { return 1; }
+  if (CVodeQuadSStolerancesB(cvode_mem, which, SUN_RCONST(1.0e-6),
+                             SUN_RCONST(1.0e-10)))
+  {
+    return 1;
+  }
+  cvodeB_mem = CVodeGetAdjCVodeBmem(cvode_mem, which);
+  if (!cvodeB_mem) { return 1; }
+
+  /* ----------------------------------- *
+   * Reference: no limit on check points *
+   * ----------------------------------- */
+
+  retval = solve(cvode_mem, which, 0, 1, y, yB_ref, qB_ref, &nststore,
+                 &nstrecomp, &nckpntsmax);
+  if (retval)
+  {
+    fprintf(stderr, "Reference solve returned %i\n", retval);
+    return 1;
+  }
+
+  printf("No limit: check points = %i, store steps = %li, recompute steps = "
+         "%li\n",
+         nckpntsmax, nststore, nstrecomp);
+  if (nstrecomp != 0)
+  {
+    fprintf(stderr, "No limit: unexpected recomputation\n");
+    fails++;
+  }
+
+  /* ----------------------------------------------------- *
+   * Limited check points give the same adjoint solution   *
+   * ----------------------------------------------------- */
+
+  for (i = 0; i < 3; i++)
+  {
+    retval = solve(cvode_mem, which, budgets[i], sweeps[i], y, yB, qB,
+                   &nststore, &nstrecomp, &nckpntsmax);
+    if (retval)
+    {
+      fprintf(stderr, "Limit %i: solve returned %i\n", budgets[i], retval);
+      return 1;
+    }
+
+    err = max_diff(yB, qB, yB_ref, qB_ref);
+    printf("Limit %i, sweeps %i: check points = %i, store steps = %li, "
+           "recompute steps = %li, max diff = %" GSYM "\n",
+           budgets[i], sweeps[i], nckpntsmax, nststore, nstrecomp, err);
+
+    if (nckpntsmax > budgets[i])
+    {
+      fprintf(stderr, "Limit %i: too many check points\n", budgets[i]);
+      fails++;
+    }
+    if (nstrecomp <= 0)
+    {
+      fprintf(stderr, "Limit %i: no recomputation\n", budgets[i]);
+      fails++;
+    }
+    if (err > SUN_RCONST(1.0e-10))
+    {
+      fprintf(stderr, "Limit %i: adjoint solution differs\n", budgets[i]);
+      fails++;
+    }
+  }
+
+  /* ------------------------------------------------------- *
+   * Every CV_ONE_STEP call takes a step, with and without a *
+   * limit, and the sweep gives the same adjoint solution    *
+   * ------------------------------------------------------- */
+
+  for (i = 0; i < 2; i++)
+  {
+    int maxckpnts = (i == 0) ? 0 : budgets[1];
+
+    retval = solve_one_step(cvode_mem, which, maxckpnts, y, yB, qB, &ncalls);
+    if (retval)
+    {
+      fprintf(stderr, "One step, limit %i: solve returned %i\n", maxckpnts,
+              retval);
+      fails++;
+      continue;
+    }
+
+    err = max_diff(yB, qB, yB_ref, qB_ref);
+    printf("One step, limit %i: calls = %li, max diff = %" GSYM "\n",
+           maxckpnts, ncalls, err);
+
+    if (err > SUN_RCONST(1.0e-10))
+    {
+      fprintf(stderr, "One step, limit %i: adjoint solution differs\n",
+              maxckpnts);
+      fails++;
+    }
+  }
+
+  SUNLinSolFree(LS);
+  SUNLinSolFree(LSB);
+  SUNMatDestroy(A);
+  SUNMatDestroy(AB);
+  CVodeFree(&cvode_mem);
+  N_VDestroy(y);
+  N_VDestroy(yB);
+  N_VDestroy(qB);
+  N_VDestroy(yB_ref);
+  N_VDestroy(qB_ref);
+  SUNContext_Free(&sunctx);
+
+  if (fails)
+  {
+    printf("FAIL: %d tests failed\n", fails);
+    return 1;
+  }
+
+  printf("SUCCESS\n");
+
+  return 0;
+}
+
+/*---- end of file ----*/
@@ -0,0 +1,283 @@
+/* -----------------------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for the batched RHS function used in the difference quotient
+ * sensitivity RHS approximation. The sensitivities of the Robertson problem
+ * with respect to its three rate constants are computed with the internal
+ * difference quotient approximation, with and without a batched RHS function,
+ * and the results are compared. The separate (centered and forward) methods
+ * evaluate the states perturbed along the sensitivities in batches, while the
+ * simultaneous method (the default) does not use the batched RHS function.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cvodes/cvodes.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_dense.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+#define TWO  SUN_RCONST(2.0)
+
+#define NEQ      3
+#define NS       3
+#define MAXBATCH 5
+#define T0       SUN_RCONST(0.0)
+#define TF       SUN_RCONST(40.0)
+
+/* Number of calls to the batched RHS function */
+static long int nbatchcalls = 0;
+
+/* Robertson RHS */
+static int f(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* p  = (sunrealtype*)user_data;
+  sunrealtype* yd = N_VGetArrayPointer(y);
+  sunrealtype* fd = N_VGetArrayPointer(ydot);
+
+  fd[0] = -p[0] * yd[0] + p[1] * yd[1] * yd[2];
+  fd[2] = p[2] * yd[1] * yd[1];
+  fd[1] = -fd[0] - fd[2];
+
+  return 0;
+}
+
+/* Batched RHS */
+static int fbatch(int nbatch, sunrealtype t, N_Vector* y, N_Vector* ydot,
+                  void* user_data)
+{
+  int b, retval;
+
+  nbatchcalls++;
+  for (b = 0; b < nbatch; b++)
+  {
+    retval = f(t, y[b], ydot[b], user_data);
+    if (retval) { return retval; }
+  }
+
+  return 0;
+}
+
+/* Robertson Jacobian */
+static int Jac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix J,
+               void* user_data, N_Vector tmp1, N_Vector tmp2, N_Vector tmp3)
+{
+  sunrealtype* p  = (sunrealtype*)user_data;
+  sunrealtype* yd = N_VGetArrayPointer(y);
+
+  SM_ELEMENT_D(J, 0, 0) = -p[0];
+  SM_ELEMENT_D(J, 0, 1) = p[1] * yd[2];
+  SM_ELEMENT_D(J, 0, 2) = p[1] * yd[1];
+  SM_ELEMENT_D(J, 1, 0) = p[0];
+  SM_ELEMENT_D(J, 1, 1) = -p[1] * yd[2] - TWO * p[2] * yd[1];
+  SM_ELEMENT_D(J, 1, 2) = -p[1] * yd[1];
+  SM_ELEMENT_D(J, 2, 0) = ZERO;
+  SM_ELEMENT_D(J, 2, 1) = TWO * p[2] * yd[1];
+  SM_ELEMENT_D(J, 2, 2) = ZERO;
+
+  return 0;
+}
+
+/* Solve the forward problem and sensitivities with the given DQ method, with
+   or without the batched RHS function */
+static int solve(SUNContext sunctx, int DQtype, sunrealtype DQrhomax,
+                 int batch, sunrealtype* p, N_Vector y, N_Vector* yS,
+                 long int* nfeS)
+{
+  int is, retval;
+  long int nfSe, netfS, nsetupsS;
+  sunrealtype t;
+  sunrealtype pbar[NS];
+  void* cvode_mem;
+  SUNMatrix A;
+  SUNLinearSolver LS;
+
+  N_VConst(ZERO, y);
+  NV_Ith_S(y, 0) = ONE;
+  for (is = 0; is < NS; is++)
+  {
+    N_VConst(ZERO, yS[is]);
+    pbar[is] = p[is];
+  }
+
+  A  = SUNDenseMatrix(NEQ, NEQ, sunctx);
+  LS = SUNLinSol_Dense(y, A, sunctx);
+  if (!A || !LS) { return 1; }
+
+  cvode_mem = CVodeCreate(CV_BDF, sunctx);
+  if (!cvode_mem) { return 1; }
+
+  retval = CVodeInit(cvode_mem, f, T0, y);
+  if (retval) { return retval; }
+
+  retval = CVodeSStolerances(cvode_mem, SUN_RCONST(1.0e-6),
+                             SUN_RCONST(1.0e-10));
+  if (retval) { return retval; }
+
+  retval = CVodeSetUserData(cvode_mem, p);
+  if (retval) { return retval; }
+
+  retval = CVodeSetLinearSolver(cvode_mem, LS, A);
+  if (retval) { return retval; }
+
+  retval = CVodeSetJacFn(cvode_mem, Jac);
+  if (retval) { return retval; }
+
+  retval = CVodeSensInit(cvode_mem, NS, CV_SIMULTANEOUS, NULL, yS);
+  if (retval) { return retval; }
+
+  retval = CVodeSensEEtolerances(cvode_mem);
+  if (retval) { return retval; }
+
+  retval = CVodeSetSensErrCon(cvode_mem, SUNTRUE);
+  if (retval) { return retval; }
+
+  retval = CVodeSetSensParams(cvode_mem, p, pbar, NULL);
+  if (retval) { return retval; }
+
+  retval = CVodeSetSensDQMethod(cvode_mem, DQtype, DQrhomax);
+  if (retval) { return retval; }
+
+  if (batch)
+  {
+    retval = CVodeSetSensRhsBatchFn(cvode_mem, fbatch, MAXBATCH);
+    if (retval) { return retval; }
+  }
+
+  retval = CVode(cvode_mem, TF, y, &t, CV_NORMAL);
+  if (retval < 0) { return retval; }
+
+  retval = CVodeGetSens(cvode_mem, &t, yS);
+  if (retval) { return retval; }
+
+  retval = CVodeGetSensStats(cvode_mem, &nfSe, nfeS, &netfS, &nsetupsS);
+  if (retval) { return retval; }
+
+  CVodeFree(&cvode_mem);
+  SUNLinSolFree(LS);
+  SUNMatDestroy(A);
+
+  return 0;
+}
+
+/* Main program */
+int main(int argc, char* argv[])
+{
+  int i, is;
+  int retval        = 0;
+  int fails         = 0;
+  long int nfeS     = 0;
+  long int nfeS_ref = 0;
+  SUNContext sunctx = NULL;
+  N_Vector y        = NULL;
+  N_Vector y_ref    = NULL;
+  N_Vector* yS      = NULL;
+  N_Vector* yS_ref  = NULL;
+  sunrealtype err   = ZERO;
+  sunrealtype p[NS] = {SUN_RCONST(0.04), SUN_RCONST(1.0e4), SUN_RCONST(3.0e7)};
+
+  /* DQ methods to test, a cut-off below one selects the separate methods */
+  const int DQtypes[]            = {CV_CENTERED, CV_FORWARD, CV_CENTERED};
+  const sunrealtype DQrhomaxes[] = {SUN_RCONST(0.5), SUN_RCONST(0.5), ZERO};
+  const int batched[]            = {1, 1, 0};
+  const char* const names[]      = {"Centered, separate", "Forward, separate",
+                                    "Centered, simultaneous"};
+
+  /* Create the SUNDIALS context object for this simulation. */
+  retval = SUNContext_Create(SUN_COMM_NULL, &sunctx);
+  if (retval)
+  {
+    fprintf(stderr, "SUNContext_Create returned %i\n", retval);
+    return 1;
+  }
+
+  y      = N_VNew_Serial(NEQ, sunctx);
+  y_ref  = N_VNew_Serial(NEQ, sunctx);
+  yS     = N_VCloneVectorArray(NS, y);
+  yS_ref = N_VCloneVectorArray(NS, y);
+  if (!y || !y_ref || !yS || !yS_ref)
+  {
+    fprintf(stderr, "N_VNew_Serial returned NULL\n");
+    return 1;
+  }
+
+  /* ------------------------------------------------------------ *
+   * Batched DQ sensitivities match the one-at-a-time evaluations *
+   * ------------------------------------------------------------ */
+
+  for (i = 0; i < 3; i++)
+  {
+    retval = solve(sunctx, DQtypes[i], DQrhomaxes[i], 0, p, y_ref, yS_ref,
+                   &nfeS_ref);
+    if (retval)
+    {
+      fprintf(stderr, "%s: reference solve returned %i\n", names[i], retval);
+      return 1;
+    }
+
+    nbatchcalls = 0;
+    retval = solve(sunctx, DQtypes[i], DQrhomaxes[i], 1, p, y, yS, &nfeS);
+    if (retval)
+    {
+      fprintf(stderr, "%s: batched solve returned %i\n", names[i], retval);
+      return 1;
+    }
+
+    N_VLinearSum(ONE, y, -ONE, y_ref, y_ref);
+    err = N_VMaxNorm(y_ref);
+    for (is = 0; is < NS; is++)
+    {
+      N_VLinearSum(ONE, yS[is], -ONE, yS_ref[is], yS_ref[is]);
+      err = SUNMAX(err, N_VMaxNorm(yS_ref[is]));
+    }
+    printf("%s: DQ RHS evals = %li (reference %li), batch calls = %li, "
+           "max diff = %" GSYM "\n",
+           names[i], nfeS, nfeS_ref, nbatchcalls, err);
+
+    if (nfeS != nfeS_ref || err > ZERO ||
+        (batched[i] && (nbatchcalls == 0 || nbatchcalls >= nfeS)) ||
+        (!batched[i] && nbatchcalls != 0))
+    {
+      fprintf(stderr, "%s: batched DQ sensitivities differ\n", names[i]);
+      fails++;
+    }
+  }
+
+  N_VDestroy(y);
+  N_VDestroy(y_ref);
+  N_VDestroyVectorArray(yS, NS);
+  N_VDestroyVectorArray(yS_ref, NS);
+  SUNContext_Free(&sunctx);
+
+  if (fails)
+  {
+    printf("FAIL: %d tests failed\n", fails);
+    return 1;
+  }
+
+  printf("SUCCESS\n");
+
+  return 0;
+}
+
+/*---- end of file ----*/
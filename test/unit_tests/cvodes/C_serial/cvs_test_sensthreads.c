@@ -0,0 +1,436 @@
+/* -----------------------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for concurrent forward sensitivity evaluations. The sensitivities
+ * of the Robertson problem with respect to its three rate constants are
+ * computed with one and several sensitivity threads, using a user-supplied
+ * sensitivity RHS and the internal difference quotient approximation, and the
+ * results are compared. When OpenMP is enabled, the test also checks that more
+ * than one thread evaluated the sensitivities.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "cvodes/cvodes.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/priv/sundials_context_impl.h"
+#include "sundials/sundials_math.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_dense.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+#define TWO  SUN_RCONST(2.0)
+
+#define NEQ      3
+#define NS       3
+#define NTHREADS 4
+#define T0       SUN_RCONST(0.0)
+#define TF       SUN_RCONST(40.0)
+
+/* Threads that evaluated a RHS function */
+static int threads_used[NTHREADS];
+
+static void mark_thread(void)
+{
+#ifdef _OPENMP
+  threads_used[omp_get_thread_num() % NTHREADS] = 1;
+#else
+  threads_used[0] = 1;
+#endif
+}
+
+/* Robertson RHS */
+static int f(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* p  = (sunrealtype*)user_data;
+  sunrealtype* yd = N_VGetArrayPointer(y);
+  sunrealtype* fd = N_VGetArrayPointer(ydot);
+
+  mark_thread();
+
+  fd[0] = -p[0] * yd[0] + p[1] * yd[1] * yd[2];
+  fd[2] = p[2] * yd[1] * yd[1];
+  fd[1] = -fd[0] - fd[2];
+
+  return 0;
+}
+
+/* Robertson Jacobian */
+static int Jac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix J,
+               void* user_data, N_Vector tmp1, N_Vector tmp2, N_Vector tmp3)
+{
+  sunrealtype* p  = (sunrealtype*)user_data;
+  sunrealtype* yd = N_VGetArrayPointer(y);
+
+  SM_ELEMENT_D(J, 0, 0) = -p[0];
+  SM_ELEMENT_D(J, 0, 1) = p[1] * yd[2];
+  SM_ELEMENT_D(J, 0, 2) = p[1] * yd[1];
+  SM_ELEMENT_D(J, 1, 0) = p[0];
+  SM_ELEMENT_D(J, 1, 1) = -p[1] * yd[2] - TWO * p[2] * yd[1];
+  SM_ELEMENT_D(J, 1, 2) = -p[1] * yd[1];
+  SM_ELEMENT_D(J, 2, 0) = ZERO;
+  SM_ELEMENT_D(J, 2, 1) = TWO * p[2] * yd[1];
+  SM_ELEMENT_D(J, 2, 2) = ZERO;
+
+  return 0;
+}
+
+/* Sensitivity RHS for parameter iS, computed in the temporary vector tmp1 to
+   check that each thread has its own workspace */
+static int fS1(int Ns, sunrealtype t, N_Vector y, N_Vector ydot, int iS,
+               N_Vector yS, N_Vector ySdot, void* user_data, N_Vector tmp1,
+               N_Vector tmp2)
+{
+  sunrealtype* p   = (sunrealtype*)user_data;
+  sunrealtype* yd  = N_VGetArrayPointer(y);
+  sunrealtype* sd  = N_VGetArrayPointer(yS);
+  sunrealtype* tmp = N_VGetArrayPointer(tmp1);
+  sunrealtype s0, s1, s2;
+
+  mark_thread();
+
+  s0 = -p[0] * sd[0] + p[1] * yd[2] * sd[1] + p[1] * yd[1] * sd[2];
+  s2 = TWO * p[2] * yd[1] * sd[1];
+
+  switch (iS)
+  {
+  case 0: s0 -= yd[0]; break;
+  case 1: s0 += yd[1] * yd[2]; break;
+  case 2: s2 += yd[1] * yd[1]; break;
+  }
+  s1 = -s0 - s2;
+
+  tmp[0] = s0;
+  tmp[1] = s1;
+  tmp[2] = s2;
+  N_VScale(ONE, tmp1, ySdot);
+
+  return 0;
+}
+
+/* Create an integrator with a user-supplied sensitivity RHS (fS1 != NULL) or
+   the internal difference quotient approximation */
+static void* create(SUNContext sunctx, N_Vector y, N_Vector* yS,
+                    CVSensRhs1Fn fS1_fn, sunrealtype* p, sunrealtype* pbar,
+                    SUNMatrix* A, SUNLinearSolver* LS)
+{
+  int retval;
+  void* cvode_mem;
+
+  cvode_mem = CVodeCreate(CV_BDF, sunctx);
+  if (!cvode_mem) { return NULL; }
+
+  retval = CVodeInit(cvode_mem, f, T0, y);
+  if (!retval)
+  {
+    retval = CVodeSStolerances(cvode_mem, SUN_RCONST(1.0e-6),
+                               SUN_RCONST(1.0e-10));
+  }
+  if (!retval) { retval = CVodeSetUserData(cvode_mem, p); }
+
+  *A  = SUNDenseMatrix(NEQ, NEQ, sunctx);
+  *LS = SUNLinSol_Dense(y, *A, sunctx);
+  if (!(*A) || !(*LS)) { retval = 1; }
+  if (!retval) { retval = CVodeSetLinearSolver(cvode_mem, *LS, *A); }
+  if (!retval) { retval = CVodeSetJacFn(cvode_mem, Jac); }
+
+  if (!retval)
+  {
+    if (fS1_fn)
+    {
+      retval = CVodeSensInit1(cvode_mem, NS, CV_SIMULTANEOUS, fS1_fn, yS);
+    }
+    else { retval = CVodeSensInit(cvode_mem, NS, CV_SIMULTANEOUS, NULL, yS); }
+  }
+  if (!retval) { retval = CVodeSensEEtolerances(cvode_mem); }
+  if (!retval) { retval = CVodeSetSensErrCon(cvode_mem, SUNTRUE); }
+  if (!retval) { retval = CVodeSetSensParams(cvode_mem, p, pbar, NULL); }
+
+  if (retval)
+  {
+    fprintf(stderr, "Creating the integrator failed\n");
+    CVodeFree(&cvode_mem);
+    return NULL;
+  }
+
+  return cvode_mem;
+}
+
+#if defined(SUNDIALS_CONTEXT_SHARED_BY_THREADS)
+
+/* Solve the forward problem and sensitivities with the given number of
+   sensitivity threads */
+static int solve(void* cvode_mem, int ism, int nthreads, N_Vector y,
+                 N_Vector* yS, long int* nfSe, long int* nfeS)
+{
+  int retval;
+  long int netfS, nsetupsS;
+  sunrealtype t;
+
+  N_VConst(ZERO, y);
+  NV_Ith_S(y, 0) = ONE;
+  N_VConst(ZERO, yS[0]);
+  N_VConst(ZERO, yS[1]);
+  N_VConst(ZERO, yS[2]);
+
+  retval = CVodeReInit(cvode_mem, T0, y);
+  if (retval) { return retval; }
+
+  retval = CVodeSensReInit(cvode_mem, ism, yS);
+  if (retval) { return retval; }
+
+  retval = CVodeSetSensNumThreads(cvode_mem, nthreads);
+  if (retval) { return retval; }
+
+  retval = CVode(cvode_mem, TF, y, &t, CV_NORMAL);
+  if (retval < 0) { return retval; }
+
+  retval = CVodeGetSens(cvode_mem, &t, yS);
+  if (retval) { return retval; }
+
+  return CVodeGetSensStats(cvode_mem, nfSe, nfeS, &netfS, &nsetupsS);
+}
+
+static int count_threads(void)
+{
+  int i, n = 0;
+  for (i = 0; i < NTHREADS; i++)
+  {
+    n += threads_used[i];
+    threads_used[i] = 0;
+  }
+  return n;
+}
+
+static sunrealtype max_diff(N_Vector y, N_Vector* yS, N_Vector y_ref,
+                            N_Vector* yS_ref)
+{
+  int is;
+  sunrealtype err;
+
+  N_VLinearSum(ONE, y, -ONE, y_ref, y_ref);
+  err = N_VMaxNorm(y_ref);
+  for (is = 0; is < NS; is++)
+  {
+    N_VLinearSum(ONE, yS[is], -ONE, yS_ref[is], yS_ref[is]);
+    err = SUNMAX(err, N_VMaxNorm(yS_ref[is]));
+  }
+  return err;
+}
+
+#endif
+
+/* Main program */
+int main(int argc, char* argv[])
+{
+  int i, k, is;
+  int retval            = 0;
+  int fails             = 0;
+  int nused             = 0;
+  long int nfSe         = 0;
+  long int nfSe_ref     = 0;
+  long int nfeS         = 0;
+  long int nfeS_ref     = 0;
+  SUNContext sunctx     = NULL;
+  void* cvode_mem[2]    = {NULL, NULL};
+  N_Vector y            = NULL;
+  N_Vector y_ref        = NULL;
+  N_Vector* yS          = NULL;
+  N_Vector* yS_ref      = NULL;
+  SUNMatrix A[2]        = {NULL, NULL};
+  SUNLinearSolver LS[2] = {NULL, NULL};
+  sunrealtype err       = ZERO;
+  sunrealtype p[NS]     = {SUN_RCONST(0.04), SUN_RCONST(1.0e4),
+                           SUN_RCONST(3.0e7)};
+  sunrealtype pbar[NS];
+
+  /* Parameters and user data of each thread for the internal DQ */
+  sunrealtype p_thr[NTHREADS][NS];
+  sunrealtype* p_ptr[NTHREADS];
+  void* user_data_thr[NTHREADS];
+
+  /* Sensitivity RHS and methods to test */
+  const int isms[]               = {CV_SIMULTANEOUS, CV_STAGGERED};
+  const char* const ism_names[]  = {"Simultaneous", "Staggered"};
+  const char* const rhs_names[2] = {"fS1", "DQ"};
+
+  /* Create the SUNDIALS context object for this simulation. */
+  retval = SUNContext_Create(SUN_COMM_NULL, &sunctx);
+  if (retval)
+  {
+    fprintf(stderr, "SUNContext_Create returned %i\n", retval);
+    return 1;
+  }
+
+  y      = N_VNew_Serial(NEQ, sunctx);
+  y_ref  = N_VNew_Serial(NEQ, sunctx);
+  yS     = N_VCloneVectorArray(NS, y);
+  yS_ref = N_VCloneVectorArray(NS, y);
+  if (!y || !y_ref || !yS || !yS_ref)
+  {
+    fprintf(stderr, "N_VNew_Serial returned NULL\n");
+    return 1;
+  }
+  N_VConst(ZERO, y);
+  NV_Ith_S(y, 0) = ONE;
+  for (is = 0; is < NS; is++)
+  {
+    N_VConst(ZERO, yS[is]);
+    pbar[is] = p[is];
+  }
+
+  for (k = 0; k < NTHREADS; k++)
+  {
+    for (is = 0; is < NS; is++) { p_thr[k][is] = p[is]; }
+    p_ptr[k]         = p_thr[k];
+    user_data_thr[k] = p_thr[k];
+  }
+
+  cvode_mem[0] = create(sunctx, y, yS, fS1, p, pbar, &A[0], &LS[0]);
+  cvode_mem[1] = create(sunctx, y, yS, NULL, p, pbar, &A[1], &LS[1]);
+  if (!cvode_mem[0] || !cvode_mem[1]) { return 1; }
+
+  if (CVodeSetSensThreadParams(cvode_mem[1], user_data_thr, p_ptr))
+  {
+    return 1;
+  }
+
+#if defined(SUNDIALS_CONTEXT_SHARED_BY_THREADS)
+
+  /* ------------------------------------------------- *
+   * Threaded sensitivities match sequential solutions *
+   * ------------------------------------------------- */
+
+  for (k = 0; k < 2; k++)
+  {
+    for (i = 0; i < 2; i++)
+    {
+      retval = solve(cvode_mem[k], isms[i], 1, y_ref, yS_ref, &nfSe_ref,
+                     &nfeS_ref);
+      if (retval)
+      {
+        fprintf(stderr, "%s, %s: reference solve returned %i\n",
+                rhs_names[k], ism_names[i], retval);
+        return 1;
+      }
+      (void)count_threads();
+
+      retval = solve(cvode_mem[k], isms[i], NTHREADS, y, yS, &nfSe, &nfeS);
+      if (retval)
+      {
+        fprintf(stderr, "%s, %s: threaded solve returned %i\n", rhs_names[k],
+                ism_names[i], retval);
+        return 1;
+      }
+      nused = count_threads();
+
+      err = max_diff(y, yS, y_ref, yS_ref);
+      printf("%s, %s: sensitivity RHS evals = %li (reference %li), "
+             "DQ RHS evals = %li (reference %li), threads = %d, "
+             "max diff = %" GSYM "\n",
+             rhs_names[k], ism_names[i], nfSe, nfSe_ref, nfeS, nfeS_ref, nused,
+             err);
+
+      if (nfSe != nfSe_ref || nfeS != nfeS_ref || err > ZERO)
+      {
+        fprintf(stderr, "%s, %s: threaded sensitivities differ\n",
+                rhs_names[k], ism_names[i]);
+        fails++;
+      }
+
+#ifdef _OPENMP
+      if (nused < 2)
+      {
+        fprintf(stderr, "%s, %s: sensitivities were not threaded\n",
+                rhs_names[k], ism_names[i]);
+        fails++;
+      }
+#endif
+    }
+  }
+
+  /* the parameters are unchanged */
+  for (is = 0; is < NS; is++)
+  {
+    if (p[is] != pbar[is])
+    {
+      fprintf(stderr, "Parameter %d was modified\n", is);
+      fails++;
+    }
+  }
+
+#else
+
+  /* ------------------------------------------------------------- *
+   * Threads are refused when the context cannot be shared by them *
+   * ------------------------------------------------------------- */
+
+  (void)i;
+  (void)nused;
+  (void)nfSe;
+  (void)nfSe_ref;
+  (void)nfeS;
+  (void)nfeS_ref;
+  (void)err;
+  (void)ism_names;
+  (void)isms;
+
+  for (k = 0; k < 2; k++)
+  {
+    retval = CVodeSetSensNumThreads(cvode_mem[k], NTHREADS);
+    printf("%s: CVodeSetSensNumThreads returned %d\n", rhs_names[k], retval);
+    if (retval != CV_ILL_INPUT)
+    {
+      fprintf(stderr, "Expected CV_ILL_INPUT without a thread-safe context\n");
+      fails++;
+    }
+  }
+
+#endif
+
+  for (k = 0; k < 2; k++)
+  {
+    SUNLinSolFree(LS[k]);
+    SUNMatDestroy(A[k]);
+    CVodeFree(&cvode_mem[k]);
+  }
+  N_VDestroy(y);
+  N_VDestroy(y_ref);
+  N_VDestroyVectorArray(yS, NS);
+  N_VDestroyVectorArray(yS_ref, NS);
+  SUNContext_Free(&sunctx);
+
+  if (fails)
+  {
+    printf("FAIL: %d tests failed\n", fails);
+    return 1;
+  }
+
+  printf("SUCCESS\n");
+
+  return 0;
+}
+
+/*---- end of file ----*/
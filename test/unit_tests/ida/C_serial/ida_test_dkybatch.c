@@ -0,0 +1,207 @@
+/* -----------------------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for batched dense output. The interpolating polynomial and its
+ * derivatives are evaluated at many times in the last step with
+ * IDAGetDkyBatch and compared to IDAGetDky.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "ida/ida.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_dense.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+
+#define NOUT   100
+#define NSTEPS 40
+
+/* Brusselator RHS */
+static void f(N_Vector y, N_Vector ydot)
+{
+  sunrealtype* yd = N_VGetArrayPointer(y);
+  sunrealtype* fd = N_VGetArrayPointer(ydot);
+
+  fd[0] = ONE - SUN_RCONST(4.0) * yd[0] + yd[0] * yd[0] * yd[1];
+  fd[1] = SUN_RCONST(3.0) * yd[0] - yd[0] * yd[0] * yd[1];
+}
+
+/* Brusselator residual, r = y' - f(y) */
+static int res(sunrealtype t, N_Vector y, N_Vector yp, N_Vector r,
+               void* user_data)
+{
+  f(y, r);
+  N_VLinearSum(ONE, yp, -ONE, r, r);
+
+  return 0;
+}
+
+/* Main program */
+int main(int argc, char* argv[])
+{
+  int i, k, q, m;
+  int retval         = 0;
+  int fails          = 0;
+  sunrealtype t      = ZERO;
+  sunrealtype hlast  = ZERO;
+  sunrealtype err    = ZERO;
+  sunrealtype tout[NOUT];
+  SUNContext sunctx  = NULL;
+  void* ida_mem      = NULL;
+  N_Vector y         = NULL;
+  N_Vector yp        = NULL;
+  N_Vector dky       = NULL;
+  N_Vector* dkyb     = NULL;
+  SUNMatrix A        = NULL;
+  SUNLinearSolver LS = NULL;
+
+  const int maxords[] = {5, 2};
+
+  /* Create the SUNDIALS context object for this simulation. */
+  retval = SUNContext_Create(SUN_COMM_NULL, &sunctx);
+  if (retval)
+  {
+    fprintf(stderr, "SUNContext_Create returned %i\n", retval);
+    return 1;
+  }
+
+  y    = N_VNew_Serial(2, sunctx);
+  yp   = N_VClone(y);
+  dky  = N_VClone(y);
+  dkyb = N_VCloneVectorArray(NOUT, y);
+  if (!y || !yp || !dky || !dkyb)
+  {
+    fprintf(stderr, "N_VNew_Serial returned NULL\n");
+    return 1;
+  }
+
+  A  = SUNDenseMatrix(2, 2, sunctx);
+  LS = SUNLinSol_Dense(y, A, sunctx);
+  if (!A || !LS) { return 1; }
+
+  for (m = 0; m < 2; m++)
+  {
+    NV_Ith_S(y, 0) = SUN_RCONST(1.2);
+    NV_Ith_S(y, 1) = SUN_RCONST(3.1);
+    f(y, yp);
+
+    ida_mem = IDACreate(sunctx);
+    if (!ida_mem) { return 1; }
+    if (IDAInit(ida_mem, res, ZERO, y, yp)) { return 1; }
+    if (IDASStolerances(ida_mem, SUN_RCONST(1.0e-6), SUN_RCONST(1.0e-10)))
+    {
+      return 1;
+    }
+    if (IDASetLinearSolver(ida_mem, LS, A)) { return 1; }
+    if (IDASetMaxOrd(ida_mem, maxords[m])) { return 1; }
+
+    for (i = 0; i < NSTEPS; i++)
+    {
+      retval = IDASolve(ida_mem, SUN_RCONST(20.0), &t, y, yp, IDA_ONE_STEP);
+      if (retval < 0)
+      {
+        fprintf(stderr, "maxord %i: IDASolve returned %i\n", maxords[m],
+                retval);
+        return 1;
+      }
+    }
+
+    if (IDAGetLastOrder(ida_mem, &q)) { return 1; }
+    if (IDAGetLastStep(ida_mem, &hlast)) { return 1; }
+    for (i = 0; i < NOUT; i++) { tout[i] = t - hlast * i / (NOUT - 1); }
+
+    /* ------------------------------------------------ *
+     * Batched dense output matches single time output  *
+     * ------------------------------------------------ */
+
+    for (k = 0; k <= q; k++)
+    {
+      retval = IDAGetDkyBatch(ida_mem, NOUT, tout, k, dkyb);
+      if (retval)
+      {
+        fprintf(stderr, "maxord %i: IDAGetDkyBatch returned %i\n",
+                maxords[m], retval);
+        return 1;
+      }
+
+      err = ZERO;
+      for (i = 0; i < NOUT; i++)
+      {
+        retval = IDAGetDky(ida_mem, tout[i], k, dky);
+        if (retval)
+        {
+          fprintf(stderr, "maxord %i: IDAGetDky returned %i\n", maxords[m],
+                  retval);
+          return 1;
+        }
+        N_VLinearSum(ONE, dkyb[i], -ONE, dky, dky);
+        err = SUNMAX(err, N_VMaxNorm(dky) / (ONE + N_VMaxNorm(dkyb[i])));
+      }
+
+      printf("maxord %i: q = %i, k = %i, max diff = %" GSYM "\n", maxords[m],
+             q, k, err);
+      if (err > SUN_RCONST(100.0) * SUN_UNIT_ROUNDOFF)
+      {
+        fprintf(stderr, "maxord %i: batched dense output differs for k = %i\n",
+                maxords[m], k);
+        fails++;
+      }
+    }
+
+    /* Illegal inputs are rejected */
+    if (IDAGetDkyBatch(ida_mem, NOUT, tout, q + 1, dkyb) != IDA_BAD_K)
+    {
+      fprintf(stderr, "maxord %i: expected IDA_BAD_K\n", maxords[m]);
+      fails++;
+    }
+    tout[NOUT / 2] = t - SUN_RCONST(2.0) * hlast;
+    if (IDAGetDkyBatch(ida_mem, NOUT, tout, 0, dkyb) != IDA_BAD_T)
+    {
+      fprintf(stderr, "maxord %i: expected IDA_BAD_T\n", maxords[m]);
+      fails++;
+    }
+
+    IDAFree(&ida_mem);
+  }
+
+  SUNLinSolFree(LS);
+  SUNMatDestroy(A);
+  N_VDestroy(y);
+  N_VDestroy(yp);
+  N_VDestroy(dky);
+  N_VDestroyVectorArray(dkyb, NOUT);
+  SUNContext_Free(&sunctx);
+
+  if (fails)
+  {
+    printf("FAIL: %d tests failed\n", fails);
+    return 1;
+  }
+
+  printf("SUCCESS\n");
+
+  return 0;
+}
+
+/*---- end of file ----*/
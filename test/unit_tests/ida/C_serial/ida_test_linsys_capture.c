@@ -0,0 +1,301 @@
+/* -----------------------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for capturing linear systems from IDA. The linear DAE in residual
+ * form F = y' - L y, with L the tridiagonal matrix k * [1 -2 1], is integrated
+ * with a dense and a band matrix while every other linear system (at most
+ * MAXSYS systems with at most MAXRHS right-hand sides each) is written to an
+ * archive. The archive is read back and each matrix is checked against
+ * cj I - L.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ida/ida.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sunlinsol/sunlinsol_band.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_band.h"
+#include "sunmatrix/sunmatrix_dense.h"
+
+#define NEQ    8
+#define KCOEF  SUN_RCONST(100.0)
+#define MAXSYS 3
+#define MAXRHS 2
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+#define TWO  SUN_RCONST(2.0)
+
+/* Entry (i,j) of the tridiagonal matrix L */
+static sunrealtype L_entry(sunindextype i, sunindextype j)
+{
+  if (i == j) { return -TWO * KCOEF; }
+  if (i - j == 1 || j - i == 1) { return KCOEF; }
+  return ZERO;
+}
+
+/* Compute r = L y */
+static void apply_L(sunrealtype* ydata, sunrealtype* rdata)
+{
+  sunindextype i;
+
+  for (i = 0; i < NEQ; i++)
+  {
+    rdata[i] = L_entry(i, i) * ydata[i];
+    if (i > 0) { rdata[i] += L_entry(i, i - 1) * ydata[i - 1]; }
+    if (i < NEQ - 1) { rdata[i] += L_entry(i, i + 1) * ydata[i + 1]; }
+  }
+}
+
+static int dae_res(sunrealtype t, N_Vector yy, N_Vector yp, N_Vector rr,
+                   void* user_data)
+{
+  sunrealtype* ypdata = N_VGetArrayPointer(yp);
+  sunrealtype* rdata  = N_VGetArrayPointer(rr);
+  sunindextype i;
+
+  apply_L(N_VGetArrayPointer(yy), rdata);
+  for (i = 0; i < NEQ; i++) { rdata[i] = ypdata[i] - rdata[i]; }
+  return 0;
+}
+
+static int dae_jac(sunrealtype t, sunrealtype cj, N_Vector yy, N_Vector yp,
+                   N_Vector rr, SUNMatrix J, void* user_data, N_Vector tmp1,
+                   N_Vector tmp2, N_Vector tmp3)
+{
+  sunindextype i, j;
+  sunrealtype value;
+
+  for (j = 0; j < NEQ; j++)
+  {
+    for (i = j - 1; i <= j + 1; i++)
+    {
+      if (i < 0 || i >= NEQ) { continue; }
+      value = ((i == j) ? cj : ZERO) - L_entry(i, j);
+      if (SUNMatGetID(J) == SUNMATRIX_DENSE) { SM_ELEMENT_D(J, i, j) = value; }
+      else { SM_ELEMENT_B(J, i, j) = value; }
+    }
+  }
+  return 0;
+}
+
+/* Read the archive and check its contents */
+static int check_archive(const char* filename, long nsetups, long nsys,
+                         long nrhs)
+{
+  FILE* fp = NULL;
+  char header[24];
+  SUNLinSysCaptureRecord rec;
+  sunrealtype* data = NULL;
+  sunrealtype expected;
+  int64_t i, j, k, ndata;
+  int64_t width = NEQ;
+  long nmat = 0, nvec = 0, nvec_sys = 0;
+  int fails = 0;
+
+  fp = fopen(filename, "rb");
+  if (!fp) { return 1; }
+
+  if (fread(header, sizeof(header), 1, fp) != 1 ||
+      memcmp(header, "SUNLSC01", 8))
+  {
+    fprintf(stderr, "Invalid archive header\n");
+    fclose(fp);
+    return 1;
+  }
+
+  while (fread(&rec, sizeof(rec), 1, fp) == 1)
+  {
+    if (rec.kind == SUN_LINSYSCAPTURE_MATRIX)
+    {
+      if (rec.system != nmat || rec.rows != NEQ || rec.cols != NEQ)
+      {
+        fprintf(stderr, "Unexpected matrix record %ld\n", nmat);
+        fails++;
+        break;
+      }
+      width = (rec.format == SUN_LINSYSCAPTURE_BAND)
+                ? rec.upper + rec.lower + 1
+                : NEQ;
+      ndata = width * NEQ;
+      nmat++;
+      nvec_sys = 0;
+    }
+    else
+    {
+      if (rec.system != nmat - 1 || rec.rows != NEQ || ++nvec_sys > MAXRHS)
+      {
+        fprintf(stderr, "Unexpected right-hand side record %ld\n", nvec);
+        fails++;
+        break;
+      }
+      ndata = NEQ;
+      nvec++;
+    }
+
+    data = (sunrealtype*)realloc(data, ndata * sizeof(sunrealtype));
+    if (!data || fread(data, sizeof(sunrealtype), ndata, fp) != (size_t)ndata)
+    {
+      fails++;
+      break;
+    }
+    if (rec.kind != SUN_LINSYSCAPTURE_MATRIX) { continue; }
+
+    /* Check the matrix against cj I - L */
+    for (j = 0; j < NEQ; j++)
+    {
+      for (k = 0; k < width; k++)
+      {
+        i = (rec.format == SUN_LINSYSCAPTURE_BAND) ? j - rec.upper + k : k;
+        if (i < 0 || i >= NEQ) { continue; }
+        expected = ((i == j) ? (sunrealtype)rec.value : ZERO) - L_entry(i, j);
+        if (SUNRabs(data[j * width + k] - expected) >
+            SUN_RCONST(1.0e-12) * SUNRabs(expected))
+        {
+          fprintf(stderr, "Matrix %ld differs at (%ld, %ld)\n", nmat - 1,
+                  (long)i, (long)j);
+          fails++;
+        }
+      }
+    }
+  }
+
+  free(data);
+  fclose(fp);
+
+  /* Every other system is captured until MAXSYS systems are written */
+  if (nmat != nsys || nmat != SUNMIN((nsetups + 1) / 2, MAXSYS))
+  {
+    fprintf(stderr, "Archive has %ld of %ld systems (%ld setups)\n", nmat,
+            nsys, nsetups);
+    fails++;
+  }
+  if (nvec != nrhs || nvec < nmat)
+  {
+    fprintf(stderr, "Archive has %ld of %ld right-hand sides\n", nvec, nrhs);
+    fails++;
+  }
+
+  return fails;
+}
+
+static int run_test(SUNContext sunctx, int band)
+{
+  int flag, fails;
+  long nsetups, nsys, nrhs;
+  sunrealtype tret;
+  const char* filename = band ? "ida_linsys_band.bin" : "ida_linsys_dense.bin";
+
+  N_Vector yy          = NULL;
+  N_Vector yp          = NULL;
+  SUNMatrix A          = NULL;
+  SUNLinearSolver LS   = NULL;
+  SUNLinSysCapture cap = NULL;
+  void* ida_mem        = NULL;
+
+  /* Consistent initial condition y = 1, y' = L y */
+  yy = N_VNew_Serial(NEQ, sunctx);
+  if (!yy) { return 1; }
+  N_VConst(ONE, yy);
+
+  yp = N_VClone(yy);
+  if (!yp) { return 1; }
+  apply_L(N_VGetArrayPointer(yy), N_VGetArrayPointer(yp));
+
+  A = band ? SUNBandMatrix(NEQ, 1, 1, sunctx)
+           : SUNDenseMatrix(NEQ, NEQ, sunctx);
+  if (!A) { return 1; }
+
+  LS = band ? SUNLinSol_Band(yy, A, sunctx) : SUNLinSol_Dense(yy, A, sunctx);
+  if (!LS) { return 1; }
+
+  flag = SUNLinSysCapture_Create(filename, &cap);
+  if (flag) { return 1; }
+
+  flag = SUNLinSysCapture_SetSelection(cap, 2, MAXSYS, MAXRHS);
+  if (flag) { return 1; }
+
+  ida_mem = IDACreate(sunctx);
+  if (!ida_mem) { return 1; }
+
+  flag = IDAInit(ida_mem, dae_res, ZERO, yy, yp);
+  if (flag) { return 1; }
+
+  flag = IDASStolerances(ida_mem, SUN_RCONST(1.0e-6), SUN_RCONST(1.0e-10));
+  if (flag) { return 1; }
+
+  flag = IDASetLinearSolver(ida_mem, LS, A);
+  if (flag) { return 1; }
+
+  flag = IDASetJacFn(ida_mem, dae_jac);
+  if (flag) { return 1; }
+
+  flag = IDASetLinSysCapture(ida_mem, cap);
+  if (flag) { return 1; }
+
+  flag = IDASolve(ida_mem, ONE, &tret, yy, yp, IDA_NORMAL);
+  if (flag < 0)
+  {
+    fprintf(stderr, "IDASolve returned %d\n", flag);
+    return 1;
+  }
+
+  flag = IDAGetNumLinSolvSetups(ida_mem, &nsetups);
+  if (flag) { return 1; }
+
+  SUNLinSysCapture_GetNumSystems(cap, &nsys);
+  SUNLinSysCapture_GetNumRhs(cap, &nrhs);
+
+  flag = SUNLinSysCapture_Destroy(&cap);
+  if (flag) { return 1; }
+
+  fails = check_archive(filename, nsetups, nsys, nrhs);
+
+  printf("%-5s setups = %3ld, systems = %ld, right-hand sides = %ld\n",
+         band ? "band" : "dense", nsetups, nsys, nrhs);
+
+  N_VDestroy(yy);
+  N_VDestroy(yp);
+  SUNMatDestroy(A);
+  SUNLinSolFree(LS);
+  IDAFree(&ida_mem);
+
+  return fails;
+}
+
+int main(int argc, char* argv[])
+{
+  SUNContext sunctx = NULL;
+  int fails         = 0;
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx)) { return 1; }
+
+  fails += run_test(sunctx, 0);
+  fails += run_test(sunctx, 1);
+
+  SUNContext_Free(&sunctx);
+
+  if (fails)
+  {
+    printf("FAIL: %d tests failed\n", fails);
+    return 1;
+  }
+
+  printf("SUCCESS\n");
+
+  return 0;
+}
@@ -0,0 +1,278 @@
+/* -----------------------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for rootfinding with many event functions. The harmonic oscillator
+ * y0' = -y1, y1' = y0 with y(0) = (1, 0), written in residual form, is
+ * integrated with the event functions g_i = y0 - a_i for distinct thresholds
+ * a_i in (-1, 1). The roots found using
+ * the full g function, a partial g function, and a partial g function with
+ * inverse quadratic interpolation are compared to each other and to the exact
+ * roots. The test also checks that the partial g function evaluates fewer
+ * components than the full g function.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "ida/ida.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_dense.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+
+/* number of event functions and maximum number of roots */
+#define NRTFN    500
+#define MAXROOTS (2 * NRTFN)
+
+typedef struct
+{
+  sunrealtype a[NRTFN]; /* event thresholds                */
+  long int ncomp;       /* number of g components computed */
+} UserData;
+
+typedef struct
+{
+  int nroots;                 /* number of roots found */
+  sunrealtype troot[MAXROOTS]; /* root locations        */
+  int iroot[MAXROOTS];        /* root components       */
+  long int nge;               /* number of g calls     */
+  long int ncomp;             /* number of components  */
+} Results;
+
+static int dae_res(sunrealtype t, N_Vector y, N_Vector yp, N_Vector r,
+                   void* user_data)
+{
+  sunrealtype* ydata  = N_VGetArrayPointer(y);
+  sunrealtype* ypdata = N_VGetArrayPointer(yp);
+  sunrealtype* rdata  = N_VGetArrayPointer(r);
+  rdata[0]            = ypdata[0] + ydata[1];
+  rdata[1]            = ypdata[1] - ydata[0];
+  return 0;
+}
+
+static int root_fn(sunrealtype t, N_Vector y, N_Vector yp, sunrealtype* gout,
+                   void* user_data)
+{
+  UserData* udata    = (UserData*)user_data;
+  sunrealtype* ydata = N_VGetArrayPointer(y);
+  int i;
+
+  for (i = 0; i < NRTFN; i++) { gout[i] = ydata[0] - udata->a[i]; }
+  udata->ncomp += NRTFN;
+  return 0;
+}
+
+static int partial_root_fn(sunrealtype t, N_Vector y, N_Vector yp, int ncand,
+                           const int* cand, sunrealtype* gout, void* user_data)
+{
+  UserData* udata    = (UserData*)user_data;
+  sunrealtype* ydata = N_VGetArrayPointer(y);
+  int j;
+
+  for (j = 0; j < ncand; j++)
+  {
+    gout[cand[j]] = ydata[0] - udata->a[cand[j]];
+  }
+  udata->ncomp += ncand;
+  return 0;
+}
+
+static int run_test(SUNContext sunctx, int partial, int iqi, Results* res)
+{
+  int flag, i, nfound;
+  int iroots[NRTFN];
+  sunrealtype tf   = SUN_RCONST(6.0);
+  sunrealtype tret = ZERO;
+  UserData udata;
+
+  N_Vector y         = NULL;
+  N_Vector yp        = NULL;
+  SUNMatrix A        = NULL;
+  SUNLinearSolver LS = NULL;
+  void* ida_mem      = NULL;
+
+  for (i = 0; i < NRTFN; i++)
+  {
+    udata.a[i] = SUN_RCONST(-0.99) +
+                 SUN_RCONST(1.98) * ((sunrealtype)i + SUN_RCONST(0.5)) / NRTFN;
+  }
+  udata.ncomp = 0;
+
+  y = N_VNew_Serial(2, sunctx);
+  if (!y) { return 1; }
+  N_VGetArrayPointer(y)[0] = ONE;
+  N_VGetArrayPointer(y)[1] = ZERO;
+
+  yp = N_VClone(y);
+  if (!yp) { return 1; }
+  N_VGetArrayPointer(yp)[0] = ZERO;
+  N_VGetArrayPointer(yp)[1] = ONE;
+
+  A = SUNDenseMatrix(2, 2, sunctx);
+  if (!A) { return 1; }
+
+  LS = SUNLinSol_Dense(y, A, sunctx);
+  if (!LS) { return 1; }
+
+  ida_mem = IDACreate(sunctx);
+  if (!ida_mem) { return 1; }
+
+  flag = IDAInit(ida_mem, dae_res, ZERO, y, yp);
+  if (flag) { return 1; }
+
+  flag = IDASStolerances(ida_mem, SUN_RCONST(1.0e-10), SUN_RCONST(1.0e-12));
+  if (flag) { return 1; }
+
+  flag = IDASetLinearSolver(ida_mem, LS, A);
+  if (flag) { return 1; }
+
+  flag = IDASetUserData(ida_mem, &udata);
+  if (flag) { return 1; }
+
+  flag = IDASetMaxNumSteps(ida_mem, 100000);
+  if (flag) { return 1; }
+
+  flag = IDARootInit(ida_mem, NRTFN, root_fn);
+  if (flag) { return 1; }
+
+  if (partial)
+  {
+    flag = IDASetPartialRootFn(ida_mem, partial_root_fn);
+    if (flag) { return 1; }
+  }
+
+  flag = IDASetRootInverseInterp(ida_mem, iqi ? SUNTRUE : SUNFALSE);
+  if (flag) { return 1; }
+
+  res->nroots = 0;
+  while (tret < tf)
+  {
+    flag = IDASolve(ida_mem, tf, &tret, y, yp, IDA_NORMAL);
+    if (flag < 0)
+    {
+      fprintf(stderr, "IDASolve returned %d\n", flag);
+      return 1;
+    }
+
+    if (flag == IDA_ROOT_RETURN)
+    {
+      flag = IDAGetRootInfo(ida_mem, iroots);
+      if (flag) { return 1; }
+
+      /* the thresholds are distinct so only one root is found at a time */
+      nfound = 0;
+      for (i = 0; i < NRTFN; i++)
+      {
+        if (iroots[i] == 0) { continue; }
+        nfound++;
+        if (res->nroots < MAXROOTS)
+        {
+          res->troot[res->nroots] = tret;
+          res->iroot[res->nroots] = (tret < SUN_RCONST(3.14159)) ? i : -i - 1;
+          res->nroots++;
+        }
+      }
+      if (nfound != 1)
+      {
+        fprintf(stderr, "Found %d roots at t = %" GSYM "\n", nfound, tret);
+        return 1;
+      }
+    }
+  }
+
+  flag = IDAGetNumGEvals(ida_mem, &res->nge);
+  if (flag) { return 1; }
+  res->ncomp = udata.ncomp;
+
+  /* check against the exact roots t = acos(a_i) in the first half period */
+  for (i = 0; i < res->nroots; i++)
+  {
+    if (res->iroot[i] < 0) { continue; }
+    if (SUNRabs(res->troot[i] - acos(udata.a[res->iroot[i]])) >
+        SUN_RCONST(1.0e-6))
+    {
+      fprintf(stderr, "Root %d at t = %" GSYM " is inaccurate\n", i,
+              res->troot[i]);
+      return 1;
+    }
+  }
+
+  N_VDestroy(y);
+  N_VDestroy(yp);
+  SUNMatDestroy(A);
+  SUNLinSolFree(LS);
+  IDAFree(&ida_mem);
+
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  SUNContext sunctx = NULL;
+  Results res[3];
+  const char* names[3] = {"full g", "partial g", "partial g + IQI"};
+  int flag, i, k;
+
+  flag = SUNContext_Create(SUN_COMM_NULL, &sunctx);
+  if (flag) { return 1; }
+
+  for (k = 0; k < 3; k++)
+  {
+    flag = run_test(sunctx, k > 0, k == 2, &res[k]);
+    if (flag)
+    {
+      fprintf(stderr, "Test with %s failed\n", names[k]);
+      return 1;
+    }
+    printf("%-16s roots = %4d, g calls = %6ld, g components = %9ld\n",
+           names[k], res[k].nroots, res[k].nge, res[k].ncomp);
+  }
+
+  for (k = 1; k < 3; k++)
+  {
+    if (res[k].nroots != res[0].nroots)
+    {
+      fprintf(stderr, "Number of roots differ with %s\n", names[k]);
+      return 1;
+    }
+    for (i = 0; i < res[0].nroots; i++)
+    {
+      if (res[k].iroot[i] != res[0].iroot[i] ||
+          SUNRabs(res[k].troot[i] - res[0].troot[i]) > SUN_RCONST(1.0e-10))
+      {
+        fprintf(stderr, "Root %d differs with %s\n", i, names[k]);
+        return 1;
+      }
+    }
+    if (res[k].ncomp >= res[0].ncomp)
+    {
+      fprintf(stderr, "No reduction in g components with %s\n", names[k]);
+      return 1;
+    }
+  }
+
+  SUNContext_Free(&sunctx);
+
+  printf("SUCCESS\n");
+
+  return 0;
+}
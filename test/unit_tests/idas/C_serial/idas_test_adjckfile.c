@@ -0,0 +1,523 @@
+/* -----------------------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for storing adjoint check points in a file or a user-supplied
+ * storage. The adjoint of a small index-1 DAE (with quadratures and forward
+ * sensitivities stored in the check points) is computed with check points in
+ * memory, in a user storage, and in a file and the results are compared.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "idas/idas.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_dense.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+#define HALF SUN_RCONST(0.5)
+#define TWO  SUN_RCONST(2.0)
+#define TNTH SUN_RCONST(0.1)
+
+#define T0     SUN_RCONST(0.0)
+#define TF     SUN_RCONST(10.0)
+#define NSTEPS 10
+#define CKFILE "idas_test_adjckfile.bin"
+
+/* Problem parameter */
+static sunrealtype p[1] = {ONE};
+
+/* DAE residual
+     y1' + p y1 - y2^2         = 0
+     y2 - exp(-t) / 2 - y1 / 10 = 0 */
+static int res(sunrealtype t, N_Vector yy, N_Vector yp, N_Vector rr,
+               void* user_data)
+{
+  sunrealtype* y  = N_VGetArrayPointer(yy);
+  sunrealtype* yd = N_VGetArrayPointer(yp);
+  sunrealtype* r  = N_VGetArrayPointer(rr);
+
+  r[0] = yd[0] + p[0] * y[0] - y[1] * y[1];
+  r[1] = y[1] - HALF * SUNRexp(-t) - TNTH * y[0];
+
+  return 0;
+}
+
+/* Forward quadrature, q' = y1 */
+static int rhsQ(sunrealtype t, N_Vector yy, N_Vector yp, N_Vector qdot,
+                void* user_data)
+{
+  NV_Ith_S(qdot, 0) = NV_Ith_S(yy, 0);
+  return 0;
+}
+
+/* Adjoint residual, (F_y'^T yB)' - F_y^T yB = 0 */
+static int resB(sunrealtype t, N_Vector yy, N_Vector yp, N_Vector yyB,
+                N_Vector ypB, N_Vector rrB, void* user_dataB)
+{
+  sunrealtype* y    = N_VGetArrayPointer(yy);
+  sunrealtype* yB   = N_VGetArrayPointer(yyB);
+  sunrealtype* ypBd = N_VGetArrayPointer(ypB);
+  sunrealtype* r    = N_VGetArrayPointer(rrB);
+
+  r[0] = ypBd[0] - p[0] * yB[0] + TNTH * yB[1];
+  r[1] = TWO * y[1] * yB[0] - yB[1];
+
+  return 0;
+}
+
+/* Gradient with respect to p, qB' = yB1 y1 */
+static int rhsQB(sunrealtype t, N_Vector yy, N_Vector yp, N_Vector yyB,
+                 N_Vector ypB, N_Vector qBdot, void* user_dataB)
+{
+  NV_Ith_S(qBdot, 0) = NV_Ith_S(yyB, 0) * NV_Ith_S(yy, 0);
+  return 0;
+}
+
+static void set_ic(N_Vector yy, N_Vector yp, N_Vector q, N_Vector* yyS,
+                   N_Vector* ypS)
+{
+  NV_Ith_S(yy, 0) = ONE;
+  NV_Ith_S(yy, 1) = HALF + TNTH;
+  NV_Ith_S(yp, 0) = -p[0] + NV_Ith_S(yy, 1) * NV_Ith_S(yy, 1);
+  NV_Ith_S(yp, 1) = -HALF + TNTH * NV_Ith_S(yp, 0);
+  NV_Ith_S(q, 0)  = ZERO;
+
+  N_VConst(ZERO, yyS[0]);
+  NV_Ith_S(ypS[0], 0) = -ONE;
+  NV_Ith_S(ypS[0], 1) = -TNTH;
+}
+
+static void set_icB(N_Vector yy, N_Vector yyB, N_Vector ypB, N_Vector qB)
+{
+  NV_Ith_S(yyB, 0) = ONE;
+  NV_Ith_S(yyB, 1) = TWO * NV_Ith_S(yy, 1);
+  NV_Ith_S(ypB, 0) = p[0] - TNTH * NV_Ith_S(yyB, 1);
+  NV_Ith_S(ypB, 1) = ZERO;
+  NV_Ith_S(qB, 0)  = ZERO;
+}
+
+/* User check point storage, a copy of each packed check point */
+typedef struct
+{
+  void** data;
+  size_t* size;
+  long int n;
+  long int nstore;
+  long int nload;
+  int nfree;
+} UserStorage;
+
+static int user_store(long int index, const void* data, size_t size,
+                      void* content)
+{
+  UserStorage* us = (UserStorage*)content;
+  void* buf;
+
+  if (index >= us->n)
+  {
+    us->data = (void**)realloc(us->data, (index + 1) * sizeof(void*));
+    us->size = (size_t*)realloc(us->size, (index + 1) * sizeof(size_t));
+    if (!us->data || !us->size) { return -1; }
+    for (; us->n <= index; us->n++)
+    {
+      us->data[us->n] = NULL;
+      us->size[us->n] = 0;
+    }
+  }
+
+  buf = realloc(us->data[index], size);
+  if (buf == NULL) { return -1; }
+  memcpy(buf, data, size);
+  us->data[index] = buf;
+  us->size[index] = size;
+  us->nstore++;
+
+  return 0;
+}
+
+static int user_load(long int index, void* data, size_t size, void* content)
+{
+  UserStorage* us = (UserStorage*)content;
+
+  if (index < 0 || index >= us->n || us->size[index] != size) { return -1; }
+  memcpy(data, us->data[index], size);
+  us->nload++;
+
+  return 0;
+}
+
+static void user_free(void* content)
+{
+  UserStorage* us = (UserStorage*)content;
+  long int i;
+
+  for (i = 0; i < us->n; i++) { free(us->data[i]); }
+  free(us->data);
+  free(us->size);
+  us->data = NULL;
+  us->size = NULL;
+  us->n    = 0;
+  us->nfree++;
+}
+
+static sunbooleantype file_exists(const char* fname)
+{
+  FILE* fp = fopen(fname, "rb");
+  if (fp == NULL) { return SUNFALSE; }
+  fclose(fp);
+  return SUNTRUE;
+}
+
+/* Solve the forward and adjoint problems with a given number of backward
+   sweeps, check points are stored in the user storage us (if not NULL) or
+   in the file fname (if not NULL) */
+static int solve(void* ida_mem, int which, UserStorage* us, const char* fname,
+                 int nsweeps,
+                 N_Vector yy, N_Vector yp, N_Vector q, N_Vector* yyS,
+                 N_Vector* ypS, N_Vector yyB, N_Vector ypB, N_Vector qB,
+                 int* ncheck)
+{
+  int retval, i;
+  sunrealtype t;
+
+  set_ic(yy, yp, q, yyS, ypS);
+  retval = IDAReInit(ida_mem, T0, yy, yp);
+  if (retval) { return retval; }
+
+  retval = IDAQuadReInit(ida_mem, q);
+  if (retval) { return retval; }
+
+  retval = IDASensReInit(ida_mem, IDA_SIMULTANEOUS, yyS, ypS);
+  if (retval) { return retval; }
+
+  retval = IDAAdjReInit(ida_mem);
+  if (retval) { return retval; }
+
+  if (us)
+  {
+    retval = IDAAdjSetCheckPointStorage(ida_mem, us, user_store, user_load,
+                                        user_free);
+  }
+  else { retval = IDAAdjSetCheckPointFile(ida_mem, fname); }
+  if (retval) { return retval; }
+
+  retval = IDASolveF(ida_mem, TF, &t, yy, yp, IDA_NORMAL, ncheck);
+  if (retval < 0) { return retval; }
+
+  for (i = 0; i < nsweeps; i++)
+  {
+    set_icB(yy, yyB, ypB, qB);
+    retval = IDAReInitB(ida_mem, which, TF, yyB, ypB);
+    if (retval) { return retval; }
+
+    retval = IDAQuadReInitB(ida_mem, which, qB);
+    if (retval) { return retval; }
+
+    retval = IDASolveB(ida_mem, T0, IDA_NORMAL);
+    if (retval < 0) { return retval; }
+
+    retval = IDAGetB(ida_mem, which, &t, yyB, ypB);
+    if (retval) { return retval; }
+
+    retval = IDAGetQuadB(ida_mem, which, &t, qB);
+    if (retval) { return retval; }
+  }
+
+  return 0;
+}
+
+static sunrealtype max_diff(N_Vector yyB, N_Vector qB, N_Vector yyB_ref,
+                            N_Vector qB_ref)
+{
+  sunrealtype err = SUNRabs(NV_Ith_S(qB, 0) - NV_Ith_S(qB_ref, 0));
+  err = SUNMAX(err, SUNRabs(NV_Ith_S(yyB, 0) - NV_Ith_S(yyB_ref, 0)));
+  err = SUNMAX(err, SUNRabs(NV_Ith_S(yyB, 1) - NV_Ith_S(yyB_ref, 1)));
+  return err;
+}
+
+/* Main program */
+int main(int argc, char* argv[])
+{
+  int i, which;
+  int retval          = 0;
+  int fails           = 0;
+  int ncheck          = 0;
+  long int nckfile    = 0;
+  long int nbytesw    = 0;
+  long int nbytesr    = 0;
+  SUNContext sunctx   = NULL;
+  void* ida_mem       = NULL;
+  N_Vector yy         = NULL;
+  N_Vector yp         = NULL;
+  N_Vector q          = NULL;
+  N_Vector* yyS       = NULL;
+  N_Vector* ypS       = NULL;
+  N_Vector yyB        = NULL;
+  N_Vector ypB        = NULL;
+  N_Vector qB         = NULL;
+  N_Vector yyB_ref    = NULL;
+  N_Vector qB_ref     = NULL;
+  SUNMatrix A         = NULL;
+  SUNMatrix AB        = NULL;
+  SUNLinearSolver LS  = NULL;
+  SUNLinearSolver LSB = NULL;
+  sunrealtype t       = ZERO;
+  sunrealtype err     = ZERO;
+  UserStorage us      = {NULL, NULL, 0, 0, 0, 0};
+
+  /* Create the SUNDIALS context object for this simulation. */
+  retval = SUNContext_Create(SUN_COMM_NULL, &sunctx);
+  if (retval)
+  {
+    fprintf(stderr, "SUNContext_Create returned %i\n", retval);
+    return 1;
+  }
+
+  yy      = N_VNew_Serial(2, sunctx);
+  yp      = N_VNew_Serial(2, sunctx);
+  q       = N_VNew_Serial(1, sunctx);
+  yyB     = N_VNew_Serial(2, sunctx);
+  ypB     = N_VNew_Serial(2, sunctx);
+  qB      = N_VNew_Serial(1, sunctx);
+  yyB_ref = N_VNew_Serial(2, sunctx);
+  qB_ref  = N_VNew_Serial(1, sunctx);
+  if (!yy || !yp || !q || !yyB || !ypB || !qB || !yyB_ref || !qB_ref)
+  {
+    fprintf(stderr, "N_VNew_Serial returned NULL\n");
+    return 1;
+  }
+  yyS = N_VCloneVectorArray(1, yy);
+  ypS = N_VCloneVectorArray(1, yy);
+  if (!yyS || !ypS) { return 1; }
+  set_ic(yy, yp, q, yyS, ypS);
+
+  /* Forward problem with quadratures and sensitivities */
+  ida_mem = IDACreate(sunctx);
+  if (!ida_mem) { return 1; }
+  if (IDAInit(ida_mem, res, T0, yy, yp)) { return 1; }
+  if (IDASStolerances(ida_mem, SUN_RCONST(1.0e-6), SUN_RCONST(1.0e-10)))
+  {
+    return 1;
+  }
+
+  A  = SUNDenseMatrix(2, 2, sunctx);
+  LS = SUNLinSol_Dense(yy, A, sunctx);
+  if (!A || !LS) { return 1; }
+  if (IDASetLinearSolver(ida_mem, LS, A)) { return 1; }
+
+  if (IDAQuadInit(ida_mem, rhsQ, q)) { return 1; }
+  if (IDASetQuadErrCon(ida_mem, SUNTRUE)) { return 1; }
+  if (IDAQuadSStolerances(ida_mem, SUN_RCONST(1.0e-6), SUN_RCONST(1.0e-10)))
+  {
+    return 1;
+  }
+
+  if (IDASensInit(ida_mem, 1, IDA_SIMULTANEOUS, NULL, yyS, ypS)) { return 1; }
+  if (IDASensEEtolerances(ida_mem)) { return 1; }
+  if (IDASetSensParams(ida_mem, p, NULL, NULL)) { return 1; }
+
+  if (IDAAdjInit(ida_mem, NSTEPS, IDA_HERMITE)) { return 1; }
+
+  /* The backward problem is created after a forward solve */
+  if (IDASolveF(ida_mem, TF, &t, yy, yp, IDA_NORMAL, &ncheck) < 0) { return 1; }
+
+  /* Backward problem */
+  if (IDACreateB(ida_mem, &which)) { return 1; }
+  set_icB(yy, yyB, ypB, qB);
+  if (IDAInitB(ida_mem, which, resB, TF, yyB, ypB)) { return 1; }
+  if (IDASStolerancesB(ida_mem, which, SUN_RCONST(1.0e-6), SUN_RCONST(1.0e-10)))
+  {
+    return 1;
+  }
+
+  AB  = SUNDenseMatrix(2, 2, sunctx);
+  LSB = SUNLinSol_Dense(yyB, AB, sunctx);
+  if (!AB || !LSB) { return 1; }
+  if (IDASetLinearSolverB(ida_mem, which, LSB, AB)) { return 1; }
+
+  if (IDAQuadInitB(ida_mem, which, rhsQB, qB)) { return 1; }
+
+  /* ---------------------------------- *
+   * Reference: check points in memory  *
+   * ---------------------------------- */
+
+  retval = solve(ida_mem, which, NULL, NULL, 1, yy, yp, q, yyS, ypS, yyB_ref,
+                 ypB, qB_ref, &ncheck);
+  if (retval)
+  {
+    fprintf(stderr, "Reference solve returned %i\n", retval);
+    return 1;
+  }
+
+  retval = IDAGetAdjCheckPointFileStats(ida_mem, &nckfile, &nbytesw, &nbytesr);
+  if (retval) { return 1; }
+  if (nckfile != 0 || nbytesw != 0 || nbytesr != 0)
+  {
+    fprintf(stderr, "Memory: unexpected file access\n");
+    fails++;
+  }
+
+  /* The file cannot be set once check points exist */
+  if (IDAAdjSetCheckPointFile(ida_mem, CKFILE) != IDA_ILL_INPUT)
+  {
+    fprintf(stderr, "Setting the file after IDASolveF did not fail\n");
+    fails++;
+  }
+
+  /* ---------------------------------------------------- *
+   * Check points in a user storage give the same results *
+   * ---------------------------------------------------- */
+
+  if (IDAAdjReInit(ida_mem)) { return 1; }
+  if (IDAAdjSetCheckPointStorage(ida_mem, &us, user_store, NULL, NULL) !=
+      IDA_ILL_INPUT)
+  {
+    fprintf(stderr, "Setting a storage without a load function did not fail\n");
+    fails++;
+  }
+
+  for (i = 1; i <= 2; i++)
+  {
+    retval = solve(ida_mem, which, &us, NULL, i, yy, yp, q, yyS, ypS, yyB, ypB,
+                   qB, &ncheck);
+    if (retval)
+    {
+      fprintf(stderr, "User, sweeps %i: solve returned %i\n", i, retval);
+      return 1;
+    }
+
+    retval = IDAGetAdjCheckPointFileStats(ida_mem, &nckfile, &nbytesw,
+                                          &nbytesr);
+    if (retval) { return 1; }
+
+    err = max_diff(yyB, qB, yyB_ref, qB_ref);
+    printf("User, sweeps %i: check points = %li, stores = %li, loads = %li, "
+           "max diff = %" GSYM "\n",
+           i, nckfile, us.nstore, us.nload, err);
+
+    if (nckfile != ncheck || us.nstore != ncheck || us.nload <= 0 ||
+        nbytesw <= 0 || nbytesr <= 0)
+    {
+      fprintf(stderr, "User, sweeps %i: check points not in the storage\n", i);
+      fails++;
+    }
+    if (err > ZERO)
+    {
+      fprintf(stderr, "User, sweeps %i: adjoint solution differs\n", i);
+      fails++;
+    }
+
+    /* Each call to IDAAdjSetCheckPointStorage frees the previous storage */
+    if (us.nfree != i - 1)
+    {
+      fprintf(stderr, "User, sweeps %i: storage freed %i times\n", i,
+              us.nfree);
+      fails++;
+    }
+    us.nstore = 0;
+    us.nload  = 0;
+  }
+
+  /* -------------------------------------------- *
+   * Check points in a file give the same results *
+   * -------------------------------------------- */
+
+  for (i = 1; i <= 2; i++)
+  {
+    retval = solve(ida_mem, which, NULL, CKFILE, i, yy, yp, q, yyS, ypS, yyB,
+                   ypB, qB, &ncheck);
+    if (retval)
+    {
+      fprintf(stderr, "File, sweeps %i: solve returned %i\n", i, retval);
+      return 1;
+    }
+
+    retval = IDAGetAdjCheckPointFileStats(ida_mem, &nckfile, &nbytesw,
+                                          &nbytesr);
+    if (retval) { return 1; }
+
+    err = max_diff(yyB, qB, yyB_ref, qB_ref);
+    printf("File, sweeps %i: check points = %li, bytes written = %li, bytes "
+           "read = %li, max diff = %" GSYM "\n",
+           i, nckfile, nbytesw, nbytesr, err);
+
+    if (nckfile != ncheck || nbytesw <= 0 || nbytesr <= 0)
+    {
+      fprintf(stderr, "File, sweeps %i: check points not in the file\n", i);
+      fails++;
+    }
+    if (err > ZERO)
+    {
+      fprintf(stderr, "File, sweeps %i: adjoint solution differs\n", i);
+      fails++;
+    }
+    if (!file_exists(CKFILE))
+    {
+      fprintf(stderr, "File, sweeps %i: check point file missing\n", i);
+      fails++;
+    }
+    if (us.nfree != 2)
+    {
+      fprintf(stderr, "File, sweeps %i: user storage not freed\n", i);
+      fails++;
+    }
+  }
+
+  SUNLinSolFree(LS);
+  SUNLinSolFree(LSB);
+  SUNMatDestroy(A);
+  SUNMatDestroy(AB);
+  IDAFree(&ida_mem);
+
+  /* The file is removed with the adjoint memory */
+  if (file_exists(CKFILE))
+  {
+    fprintf(stderr, "Check point file not removed\n");
+    fails++;
+  }
+
+  N_VDestroy(yy);
+  N_VDestroy(yp);
+  N_VDestroy(q);
+  N_VDestroyVectorArray(yyS, 1);
+  N_VDestroyVectorArray(ypS, 1);
+  N_VDestroy(yyB);
+  N_VDestroy(ypB);
+  N_VDestroy(qB);
+  N_VDestroy(yyB_ref);
+  N_VDestroy(qB_ref);
+  SUNContext_Free(&sunctx);
+
+  if (fails)
+  {
+    printf("FAIL: %d tests failed\n", fails);
+    return 1;
+  }
+
+  printf("SUCCESS\n");
+
+  return 0;
+}
+
+/*---- end of file ----*/
@@ -0,0 +1,308 @@
+/* -----------------------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for the batched residual functions used in the difference quotient
+ * Jacobian and sensitivity residual approximations. The Robertson DAE and its
+ * sensitivities with respect to the three rate constants are solved with the
+ * internal difference quotient approximations, with and without the batched
+ * residual functions, and the results are compared. The separate (centered
+ * and forward) sensitivity methods evaluate the states perturbed along the
+ * sensitivities in batches, while the simultaneous method (the default) does
+ * not use the batched sensitivity residual function.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "idas/idas.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_dense.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+
+#define NEQ      3
+#define NS       3
+#define MAXBATCH 5
+#define T0       SUN_RCONST(0.0)
+#define TF       SUN_RCONST(4.0)
+
+/* Number of calls to the batched residual functions */
+static long int njacbatchcalls  = 0;
+static long int nsensbatchcalls = 0;
+
+/* Robertson residual */
+static int res(sunrealtype t, N_Vector yy, N_Vector yp, N_Vector rr,
+               void* user_data)
+{
+  sunrealtype* p   = (sunrealtype*)user_data;
+  sunrealtype* yd  = N_VGetArrayPointer(yy);
+  sunrealtype* ypd = N_VGetArrayPointer(yp);
+  sunrealtype* rd  = N_VGetArrayPointer(rr);
+
+  rd[0] = -p[0] * yd[0] + p[1] * yd[1] * yd[2];
+  rd[1] = -rd[0] - p[2] * yd[1] * yd[1] - ypd[1];
+  rd[0] -= ypd[0];
+  rd[2] = yd[0] + yd[1] + yd[2] - ONE;
+
+  return 0;
+}
+
+/* Evaluate a batch of residuals */
+static int resbatch(sunrealtype t, N_Vector* yy, N_Vector* yp, N_Vector* rr,
+                    int nbatch, void* user_data)
+{
+  int b, retval;
+
+  for (b = 0; b < nbatch; b++)
+  {
+    retval = res(t, yy[b], yp[b], rr[b], user_data);
+    if (retval) { return retval; }
+  }
+
+  return 0;
+}
+
+/* Batched residual for the DQ Jacobian */
+static int resbatch_jac(sunrealtype t, N_Vector* yy, N_Vector* yp, N_Vector* rr,
+                        int nbatch, void* user_data)
+{
+  njacbatchcalls++;
+  return resbatch(t, yy, yp, rr, nbatch, user_data);
+}
+
+/* Batched residual for the DQ sensitivity residuals */
+static int resbatch_sens(sunrealtype t, N_Vector* yy, N_Vector* yp,
+                         N_Vector* rr, int nbatch, void* user_data)
+{
+  nsensbatchcalls++;
+  return resbatch(t, yy, yp, rr, nbatch, user_data);
+}
+
+/* Solve the DAE and sensitivities with the given DQ method, with or without
+   the batched residual functions */
+static int solve(SUNContext sunctx, int DQtype, sunrealtype DQrhomax,
+                 int batch, sunrealtype* p, N_Vector yy, N_Vector yp,
+                 N_Vector* yyS, N_Vector* ypS, long int* nreLS, long int* nreS)
+{
+  int is, retval;
+  sunrealtype t;
+  sunrealtype pbar[NS];
+  void* ida_mem;
+  SUNMatrix A;
+  SUNLinearSolver LS;
+
+  /* Consistent initial conditions */
+  N_VConst(ZERO, yy);
+  N_VConst(ZERO, yp);
+  NV_Ith_S(yy, 0) = ONE;
+  NV_Ith_S(yp, 0) = -p[0];
+  NV_Ith_S(yp, 1) = p[0];
+  for (is = 0; is < NS; is++)
+  {
+    N_VConst(ZERO, yyS[is]);
+    N_VConst(ZERO, ypS[is]);
+    pbar[is] = p[is];
+  }
+  NV_Ith_S(ypS[0], 0) = -ONE;
+  NV_Ith_S(ypS[0], 1) = ONE;
+
+  A  = SUNDenseMatrix(NEQ, NEQ, sunctx);
+  LS = SUNLinSol_Dense(yy, A, sunctx);
+  if (!A || !LS) { return 1; }
+
+  ida_mem = IDACreate(sunctx);
+  if (!ida_mem) { return 1; }
+
+  retval = IDAInit(ida_mem, res, T0, yy, yp);
+  if (retval) { return retval; }
+
+  retval = IDASStolerances(ida_mem, SUN_RCONST(1.0e-6), SUN_RCONST(1.0e-10));
+  if (retval) { return retval; }
+
+  retval = IDASetUserData(ida_mem, p);
+  if (retval) { return retval; }
+
+  retval = IDASetLinearSolver(ida_mem, LS, A);
+  if (retval) { return retval; }
+
+  retval = IDASensInit(ida_mem, NS, IDA_SIMULTANEOUS, NULL, yyS, ypS);
+  if (retval) { return retval; }
+
+  retval = IDASensEEtolerances(ida_mem);
+  if (retval) { return retval; }
+
+  retval = IDASetSensErrCon(ida_mem, SUNTRUE);
+  if (retval) { return retval; }
+
+  retval = IDASetSensParams(ida_mem, p, pbar, NULL);
+  if (retval) { return retval; }
+
+  retval = IDASetSensDQMethod(ida_mem, DQtype, DQrhomax);
+  if (retval) { return retval; }
+
+  if (batch)
+  {
+    retval = IDASetJacResBatchFn(ida_mem, resbatch_jac, MAXBATCH);
+    if (retval) { return retval; }
+
+    retval = IDASetSensResBatchFn(ida_mem, resbatch_sens, MAXBATCH);
+    if (retval) { return retval; }
+  }
+
+  retval = IDASolve(ida_mem, TF, &t, yy, yp, IDA_NORMAL);
+  if (retval < 0) { return retval; }
+
+  retval = IDAGetSens(ida_mem, &t, yyS);
+  if (retval) { return retval; }
+
+  retval = IDAGetNumLinResEvals(ida_mem, nreLS);
+  if (retval) { return retval; }
+
+  retval = IDAGetNumResEvalsSens(ida_mem, nreS);
+  if (retval) { return retval; }
+
+  IDAFree(&ida_mem);
+  SUNLinSolFree(LS);
+  SUNMatDestroy(A);
+
+  return 0;
+}
+
+/* Main program */
+int main(int argc, char* argv[])
+{
+  int i, is;
+  int retval         = 0;
+  int fails          = 0;
+  long int nreLS     = 0;
+  long int nreLS_ref = 0;
+  long int nreS      = 0;
+  long int nreS_ref  = 0;
+  SUNContext sunctx  = NULL;
+  N_Vector yy        = NULL;
+  N_Vector yy_ref    = NULL;
+  N_Vector yp        = NULL;
+  N_Vector* yyS      = NULL;
+  N_Vector* yyS_ref  = NULL;
+  N_Vector* ypS      = NULL;
+  sunrealtype err    = ZERO;
+  sunrealtype p[NS] = {SUN_RCONST(0.04), SUN_RCONST(1.0e4), SUN_RCONST(3.0e7)};
+
+  /* DQ methods to test, a cut-off below one selects the separate methods */
+  const int DQtypes[]            = {IDA_CENTERED, IDA_FORWARD, IDA_CENTERED};
+  const sunrealtype DQrhomaxes[] = {SUN_RCONST(0.5), SUN_RCONST(0.5), ZERO};
+  const int sensbatched[]        = {1, 1, 0};
+  const char* const names[]      = {"Centered, separate", "Forward, separate",
+                                    "Centered, simultaneous"};
+
+  /* Create the SUNDIALS context object for this simulation. */
+  retval = SUNContext_Create(SUN_COMM_NULL, &sunctx);
+  if (retval)
+  {
+    fprintf(stderr, "SUNContext_Create returned %i\n", retval);
+    return 1;
+  }
+
+  yy      = N_VNew_Serial(NEQ, sunctx);
+  yy_ref  = N_VNew_Serial(NEQ, sunctx);
+  yp      = N_VNew_Serial(NEQ, sunctx);
+  yyS     = N_VCloneVectorArray(NS, yy);
+  yyS_ref = N_VCloneVectorArray(NS, yy);
+  ypS     = N_VCloneVectorArray(NS, yy);
+  if (!yy || !yy_ref || !yp || !yyS || !yyS_ref || !ypS)
+  {
+    fprintf(stderr, "N_VNew_Serial returned NULL\n");
+    return 1;
+  }
+
+  /* ------------------------------------------------------------ *
+   * Batched DQ approximations match the one-at-a-time versions *
+   * ------------------------------------------------------------ */
+
+  for (i = 0; i < 3; i++)
+  {
+    retval = solve(sunctx, DQtypes[i], DQrhomaxes[i], 0, p, yy_ref, yp,
+                   yyS_ref, ypS, &nreLS_ref, &nreS_ref);
+    if (retval)
+    {
+      fprintf(stderr, "%s: reference solve returned %i\n", names[i], retval);
+      return 1;
+    }
+
+    njacbatchcalls  = 0;
+    nsensbatchcalls = 0;
+    retval = solve(sunctx, DQtypes[i], DQrhomaxes[i], 1, p, yy, yp, yyS, ypS,
+                   &nreLS, &nreS);
+    if (retval)
+    {
+      fprintf(stderr, "%s: batched solve returned %i\n", names[i], retval);
+      return 1;
+    }
+
+    N_VLinearSum(ONE, yy, -ONE, yy_ref, yy_ref);
+    err = N_VMaxNorm(yy_ref);
+    for (is = 0; is < NS; is++)
+    {
+      N_VLinearSum(ONE, yyS[is], -ONE, yyS_ref[is], yyS_ref[is]);
+      err = SUNMAX(err, N_VMaxNorm(yyS_ref[is]));
+    }
+    printf("%s: DQ residual evals = %li (reference %li), batch calls = %li, "
+           "sensitivity DQ residual evals = %li (reference %li), "
+           "batch calls = %li, max diff = %" GSYM "\n",
+           names[i], nreLS, nreLS_ref, njacbatchcalls, nreS, nreS_ref,
+           nsensbatchcalls, err);
+
+    if (nreLS != nreLS_ref || njacbatchcalls == 0 || njacbatchcalls >= nreLS)
+    {
+      fprintf(stderr, "%s: batched DQ Jacobian differs\n", names[i]);
+      fails++;
+    }
+
+    if (nreS != nreS_ref || err > ZERO ||
+        (sensbatched[i] && (nsensbatchcalls == 0 || nsensbatchcalls >= nreS)) ||
+        (!sensbatched[i] && nsensbatchcalls != 0))
+    {
+      fprintf(stderr, "%s: batched DQ sensitivities differ\n", names[i]);
+      fails++;
+    }
+  }
+
+  N_VDestroy(yy);
+  N_VDestroy(yy_ref);
+  N_VDestroy(yp);
+  N_VDestroyVectorArray(yyS, NS);
+  N_VDestroyVectorArray(yyS_ref, NS);
+  N_VDestroyVectorArray(ypS, NS);
+  SUNContext_Free(&sunctx);
+
+  if (fails)
+  {
+    printf("FAIL: %d tests failed\n", fails);
+    return 1;
+  }
+
+  printf("SUCCESS\n");
+
+  return 0;
+}
+
+/*---- end of file ----*/
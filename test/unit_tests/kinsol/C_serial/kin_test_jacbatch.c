@@ -0,0 +1,225 @@
+/* -----------------------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for the batched system function used in the difference quotient
+ * Jacobian approximation. The nonlinear system F(u) = L u - u^3 + s = 0, with
+ * L the tridiagonal matrix [1 -2 1] and a source s that changes sign, is solved
+ * with Newton's method using the dense and band linear solvers, with and
+ * without a batched system function, and the results are compared.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "kinsol/kinsol.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sunlinsol/sunlinsol_band.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_band.h"
+#include "sunmatrix/sunmatrix_dense.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define ZERO SUN_RCONST(0.0)
+#define HALF SUN_RCONST(0.5)
+#define ONE  SUN_RCONST(1.0)
+#define TWO  SUN_RCONST(2.0)
+
+#define NEQ      10
+#define MAXBATCH 4
+
+/* Number of calls to the batched system function */
+static long int nbatchcalls = 0;
+
+/* Grid point i in (0, 1) */
+static sunrealtype xgrid(sunindextype i)
+{
+  return (sunrealtype)(i + 1) / (NEQ + 1);
+}
+
+static int nls_func(N_Vector u, N_Vector f, void* user_data)
+{
+  sunrealtype* ud = N_VGetArrayPointer(u);
+  sunrealtype* fd = N_VGetArrayPointer(f);
+  sunindextype i;
+
+  for (i = 0; i < NEQ; i++)
+  {
+    sunrealtype ul = (i > 0) ? ud[i - 1] : ZERO;
+    sunrealtype ur = (i < NEQ - 1) ? ud[i + 1] : ZERO;
+    fd[i] = ul - TWO * ud[i] + ur - ud[i] * ud[i] * ud[i] + (xgrid(i) - HALF);
+  }
+
+  return 0;
+}
+
+/* Batched system function */
+static int nls_batch(N_Vector* u, N_Vector* f, int nbatch, void* user_data)
+{
+  int b, retval;
+
+  nbatchcalls++;
+  for (b = 0; b < nbatch; b++)
+  {
+    retval = nls_func(u[b], f[b], user_data);
+    if (retval) { return retval; }
+  }
+
+  return 0;
+}
+
+/* Solve with the given matrix and linear solver, with or without the batched
+   system function. The initial guess has components of both signs. */
+static int solve(SUNContext sunctx, SUNMatrix A, SUNLinearSolver LS, int batch,
+                 N_Vector u, N_Vector scale, long int* nfeLS)
+{
+  int retval;
+  sunindextype i;
+  void* kin_mem;
+
+  for (i = 0; i < NEQ; i++) { NV_Ith_S(u, i) = xgrid(i) - HALF; }
+
+  kin_mem = KINCreate(sunctx);
+  if (!kin_mem) { return 1; }
+
+  retval = KINInit(kin_mem, nls_func, u);
+  if (retval) { return retval; }
+
+  retval = KINSetLinearSolver(kin_mem, LS, A);
+  if (retval) { return retval; }
+
+  /* Update the Jacobian in every iteration */
+  retval = KINSetMaxSetupCalls(kin_mem, 1);
+  if (retval) { return retval; }
+
+  if (batch)
+  {
+    retval = KINSetJacSysBatchFn(kin_mem, nls_batch, MAXBATCH);
+    if (retval) { return retval; }
+  }
+
+  retval = KINSol(kin_mem, u, KIN_LINESEARCH, scale, scale);
+  if (retval < 0) { return retval; }
+
+  retval = KINGetNumLinFuncEvals(kin_mem, nfeLS);
+  if (retval) { return retval; }
+
+  KINFree(&kin_mem);
+
+  return 0;
+}
+
+/* Main program */
+int main(int argc, char* argv[])
+{
+  int i;
+  int retval            = 0;
+  int fails             = 0;
+  long int nfeLS        = 0;
+  long int nfeLS_ref    = 0;
+  SUNContext sunctx     = NULL;
+  N_Vector u            = NULL;
+  N_Vector u_ref        = NULL;
+  N_Vector scale        = NULL;
+  SUNMatrix A[2]        = {NULL, NULL};
+  SUNLinearSolver LS[2] = {NULL, NULL};
+  sunrealtype err       = ZERO;
+
+  const char* const names[] = {"Dense", "Band"};
+
+  /* Create the SUNDIALS context object for this simulation. */
+  retval = SUNContext_Create(SUN_COMM_NULL, &sunctx);
+  if (retval)
+  {
+    fprintf(stderr, "SUNContext_Create returned %i\n", retval);
+    return 1;
+  }
+
+  u     = N_VNew_Serial(NEQ, sunctx);
+  u_ref = N_VNew_Serial(NEQ, sunctx);
+  scale = N_VNew_Serial(NEQ, sunctx);
+  if (!u || !u_ref || !scale)
+  {
+    fprintf(stderr, "N_VNew_Serial returned NULL\n");
+    return 1;
+  }
+  N_VConst(TWO, scale);
+
+  A[0]  = SUNDenseMatrix(NEQ, NEQ, sunctx);
+  LS[0] = SUNLinSol_Dense(u, A[0], sunctx);
+  A[1]  = SUNBandMatrix(NEQ, 1, 1, sunctx);
+  LS[1] = SUNLinSol_Band(u, A[1], sunctx);
+  if (!A[0] || !LS[0] || !A[1] || !LS[1]) { return 1; }
+
+  /* -------------------------------------------------------- *
+   * Batched DQ Jacobians match the column-by-column versions *
+   * -------------------------------------------------------- */
+
+  for (i = 0; i < 2; i++)
+  {
+    retval = solve(sunctx, A[i], LS[i], 0, u_ref, scale, &nfeLS_ref);
+    if (retval)
+    {
+      fprintf(stderr, "%s: reference solve returned %i\n", names[i], retval);
+      return 1;
+    }
+
+    nbatchcalls = 0;
+    retval      = solve(sunctx, A[i], LS[i], 1, u, scale, &nfeLS);
+    if (retval)
+    {
+      fprintf(stderr, "%s: batched solve returned %i\n", names[i], retval);
+      return 1;
+    }
+
+    N_VLinearSum(ONE, u, -ONE, u_ref, u_ref);
+    err = N_VMaxNorm(u_ref);
+    printf("%s: DQ system evals = %li (reference %li), batch calls = %li, "
+           "max diff = %" GSYM "\n",
+           names[i], nfeLS, nfeLS_ref, nbatchcalls, err);
+
+    if (nfeLS != nfeLS_ref || nbatchcalls == 0 || nbatchcalls >= nfeLS ||
+        err > ZERO)
+    {
+      fprintf(stderr, "%s: batched DQ Jacobian differs\n", names[i]);
+      fails++;
+    }
+  }
+
+  for (i = 0; i < 2; i++)
+  {
+    SUNLinSolFree(LS[i]);
+    SUNMatDestroy(A[i]);
+  }
+  N_VDestroy(u);
+  N_VDestroy(u_ref);
+  N_VDestroy(scale);
+  SUNContext_Free(&sunctx);
+
+  if (fails)
+  {
+    printf("FAIL: %d tests failed\n", fails);
+    return 1;
+  }
+
+  printf("SUCCESS\n");
+
+  return 0;
+}
+
+/*---- end of file ----*/
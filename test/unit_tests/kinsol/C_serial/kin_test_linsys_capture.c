@@ -0,0 +1,298 @@
+/* -----------------------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for capturing linear systems from KINSOL. The nonlinear system
+ * F(u) = L u - u^3 + 1 = 0, with L the tridiagonal matrix k * [1 -2 1], is
+ * solved with Newton's method using a dense and a band matrix while every
+ * other linear system (at most MAXSYS systems with at most MAXRHS right-hand
+ * sides each) is written to an archive. The archive is read back and each
+ * Jacobian, J = L - 3 diag(u^2), is checked against L off the diagonal and
+ * bounded by L on the diagonal.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "kinsol/kinsol.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sunlinsol/sunlinsol_band.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_band.h"
+#include "sunmatrix/sunmatrix_dense.h"
+
+#define NEQ    8
+#define KCOEF  SUN_RCONST(1.0)
+#define MAXSYS 3
+#define MAXRHS 2
+
+#define ZERO  SUN_RCONST(0.0)
+#define ONE   SUN_RCONST(1.0)
+#define TWO   SUN_RCONST(2.0)
+#define THREE SUN_RCONST(3.0)
+
+/* Entry (i,j) of the tridiagonal matrix L */
+static sunrealtype L_entry(sunindextype i, sunindextype j)
+{
+  if (i == j) { return -TWO * KCOEF; }
+  if (i - j == 1 || j - i == 1) { return KCOEF; }
+  return ZERO;
+}
+
+static int nls_func(N_Vector u, N_Vector f, void* user_data)
+{
+  sunrealtype* udata = N_VGetArrayPointer(u);
+  sunrealtype* fdata = N_VGetArrayPointer(f);
+  sunindextype i;
+
+  for (i = 0; i < NEQ; i++)
+  {
+    fdata[i] = L_entry(i, i) * udata[i] - udata[i] * udata[i] * udata[i] + ONE;
+    if (i > 0) { fdata[i] += L_entry(i, i - 1) * udata[i - 1]; }
+    if (i < NEQ - 1) { fdata[i] += L_entry(i, i + 1) * udata[i + 1]; }
+  }
+  return 0;
+}
+
+static int nls_jac(N_Vector u, N_Vector fu, SUNMatrix J, void* user_data,
+                   N_Vector tmp1, N_Vector tmp2)
+{
+  sunrealtype* udata = N_VGetArrayPointer(u);
+  sunindextype i, j;
+  sunrealtype value;
+
+  for (j = 0; j < NEQ; j++)
+  {
+    for (i = j - 1; i <= j + 1; i++)
+    {
+      if (i < 0 || i >= NEQ) { continue; }
+      value = L_entry(i, j);
+      if (i == j) { value -= THREE * udata[j] * udata[j]; }
+      if (SUNMatGetID(J) == SUNMATRIX_DENSE) { SM_ELEMENT_D(J, i, j) = value; }
+      else { SM_ELEMENT_B(J, i, j) = value; }
+    }
+  }
+  return 0;
+}
+
+/* Read the archive and check its contents */
+static int check_archive(const char* filename, long njevals, long nsys,
+                         long nrhs)
+{
+  FILE* fp = NULL;
+  char header[24];
+  SUNLinSysCaptureRecord rec;
+  sunrealtype* data = NULL;
+  sunrealtype expected, entry;
+  double titer = -1.0;
+  int64_t i, j, k, ndata;
+  int64_t width = NEQ;
+  long nmat = 0, nvec = 0, nvec_sys = 0;
+  int fails = 0;
+
+  fp = fopen(filename, "rb");
+  if (!fp) { return 1; }
+
+  if (fread(header, sizeof(header), 1, fp) != 1 ||
+      memcmp(header, "SUNLSC01", 8))
+  {
+    fprintf(stderr, "Invalid archive header\n");
+    fclose(fp);
+    return 1;
+  }
+
+  while (fread(&rec, sizeof(rec), 1, fp) == 1)
+  {
+    if (rec.kind == SUN_LINSYSCAPTURE_MATRIX)
+    {
+      if (rec.system != nmat || rec.rows != NEQ || rec.cols != NEQ ||
+          rec.t <= titer || rec.value != 0.0)
+      {
+        fprintf(stderr, "Unexpected matrix record %ld\n", nmat);
+        fails++;
+        break;
+      }
+      titer = rec.t;
+      width = (rec.format == SUN_LINSYSCAPTURE_BAND)
+                ? rec.upper + rec.lower + 1
+                : NEQ;
+      ndata = width * NEQ;
+      nmat++;
+      nvec_sys = 0;
+    }
+    else
+    {
+      if (rec.system != nmat - 1 || rec.rows != NEQ || ++nvec_sys > MAXRHS)
+      {
+        fprintf(stderr, "Unexpected right-hand side record %ld\n", nvec);
+        fails++;
+        break;
+      }
+      ndata = NEQ;
+      nvec++;
+    }
+
+    data = (sunrealtype*)realloc(data, ndata * sizeof(sunrealtype));
+    if (!data || fread(data, sizeof(sunrealtype), ndata, fp) != (size_t)ndata)
+    {
+      fails++;
+      break;
+    }
+    if (rec.kind != SUN_LINSYSCAPTURE_MATRIX) { continue; }
+
+    /* Check the matrix against L (the diagonal is L - 3 u^2 <= L) */
+    for (j = 0; j < NEQ; j++)
+    {
+      for (k = 0; k < width; k++)
+      {
+        i = (rec.format == SUN_LINSYSCAPTURE_BAND) ? j - rec.upper + k : k;
+        if (i < 0 || i >= NEQ) { continue; }
+        expected = L_entry(i, j);
+        entry    = data[j * width + k];
+        if ((i == j && entry > expected) ||
+            (i != j && SUNRabs(entry - expected) >
+                         SUN_RCONST(1.0e-12) * SUNRabs(expected)))
+        {
+          fprintf(stderr, "Matrix %ld differs at (%ld, %ld)\n", nmat - 1,
+                  (long)i, (long)j);
+          fails++;
+        }
+      }
+    }
+  }
+
+  free(data);
+  fclose(fp);
+
+  /* Every other system is captured until MAXSYS systems are written */
+  if (nmat != nsys || nmat != SUNMIN((njevals + 1) / 2, MAXSYS))
+  {
+    fprintf(stderr, "Archive has %ld of %ld systems (%ld Jacobians)\n", nmat,
+            nsys, njevals);
+    fails++;
+  }
+  if (nvec != nrhs || nvec < nmat)
+  {
+    fprintf(stderr, "Archive has %ld of %ld right-hand sides\n", nvec, nrhs);
+    fails++;
+  }
+
+  return fails;
+}
+
+static int run_test(SUNContext sunctx, int band)
+{
+  int flag, fails;
+  long njevals, nsys, nrhs;
+  const char* filename = band ? "kin_linsys_band.bin" : "kin_linsys_dense.bin";
+
+  N_Vector u           = NULL;
+  N_Vector scale       = NULL;
+  SUNMatrix A          = NULL;
+  SUNLinearSolver LS   = NULL;
+  SUNLinSysCapture cap = NULL;
+  void* kin_mem        = NULL;
+
+  u = N_VNew_Serial(NEQ, sunctx);
+  if (!u) { return 1; }
+  N_VConst(ZERO, u);
+
+  scale = N_VClone(u);
+  if (!scale) { return 1; }
+  N_VConst(ONE, scale);
+
+  A = band ? SUNBandMatrix(NEQ, 1, 1, sunctx)
+           : SUNDenseMatrix(NEQ, NEQ, sunctx);
+  if (!A) { return 1; }
+
+  LS = band ? SUNLinSol_Band(u, A, sunctx) : SUNLinSol_Dense(u, A, sunctx);
+  if (!LS) { return 1; }
+
+  flag = SUNLinSysCapture_Create(filename, &cap);
+  if (flag) { return 1; }
+
+  flag = SUNLinSysCapture_SetSelection(cap, 2, MAXSYS, MAXRHS);
+  if (flag) { return 1; }
+
+  kin_mem = KINCreate(sunctx);
+  if (!kin_mem) { return 1; }
+
+  flag = KINInit(kin_mem, nls_func, u);
+  if (flag) { return 1; }
+
+  flag = KINSetLinearSolver(kin_mem, LS, A);
+  if (flag) { return 1; }
+
+  flag = KINSetJacFn(kin_mem, nls_jac);
+  if (flag) { return 1; }
+
+  /* Update the Jacobian in every iteration */
+  flag = KINSetMaxSetupCalls(kin_mem, 1);
+  if (flag) { return 1; }
+
+  flag = KINSetLinSysCapture(kin_mem, cap);
+  if (flag) { return 1; }
+
+  flag = KINSol(kin_mem, u, KIN_LINESEARCH, scale, scale);
+  if (flag < 0)
+  {
+    fprintf(stderr, "KINSol returned %d\n", flag);
+    return 1;
+  }
+
+  flag = KINGetNumJacEvals(kin_mem, &njevals);
+  if (flag) { return 1; }
+
+  SUNLinSysCapture_GetNumSystems(cap, &nsys);
+  SUNLinSysCapture_GetNumRhs(cap, &nrhs);
+
+  flag = SUNLinSysCapture_Destroy(&cap);
+  if (flag) { return 1; }
+
+  fails = check_archive(filename, njevals, nsys, nrhs);
+
+  printf("%-5s Jacobians = %3ld, systems = %ld, right-hand sides = %ld\n",
+         band ? "band" : "dense", njevals, nsys, nrhs);
+
+  N_VDestroy(u);
+  N_VDestroy(scale);
+  SUNMatDestroy(A);
+  SUNLinSolFree(LS);
+  KINFree(&kin_mem);
+
+  return fails;
+}
+
+int main(int argc, char* argv[])
+{
+  SUNContext sunctx = NULL;
+  int fails         = 0;
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx)) { return 1; }
+
+  fails += run_test(sunctx, 0);
+  fails += run_test(sunctx, 1);
+
+  SUNContext_Free(&sunctx);
+
+  if (fails)
+  {
+    printf("FAIL: %d tests failed\n", fails);
+    return 1;
+  }
+
+  printf("SUCCESS\n");
+
+  return 0;
+}
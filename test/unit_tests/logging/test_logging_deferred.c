@@ -0,0 +1,171 @@
+/* -----------------------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for deferred logging. The same messages are logged immediately and
+ * deferred (with a small buffer that is formatted many times) and the output
+ * files are compared. Warnings written to the same file check that the order
+ * of the output is kept. Finally, the messages are written to a binary log.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sundials/sundials_errors.h"
+#include "sundials/sundials_logger.h"
+
+#define NMSG 500
+
+/* Log a set of messages covering the supported conversions */
+static void log_messages(SUNLogger logger)
+{
+  int i;
+  char scope[32];
+
+  for (i = 0; i < NMSG; i++)
+  {
+    /* The scope is stored in a reused buffer */
+    sprintf(scope, "scope-%d", i % 7);
+
+    SUNLogger_QueueMsg(logger, SUN_LOGLEVEL_INFO, scope, "ints",
+                       "i = %d, l = %li, ll = %lld, u = %u, x = %#x, z = %zu", i,
+                       (long)i * 1000, (long long)i << 40, (unsigned)i, i,
+                       (size_t)i);
+    SUNLogger_QueueMsg(logger, SUN_LOGLEVEL_INFO, "test", "reals",
+                       "g = %.16g, e = %12.4e, f = %-8.3f|, L = %Lg",
+                       1.0 / (i + 1), -3.0e-5 * i, 0.25 * i,
+                       (long double)i / 3);
+    SUNLogger_QueueMsg(logger, SUN_LOGLEVEL_INFO, "test", "strings",
+                       "s = %s, w = [%*d], p = [%.*s], c = %c, 100%%",
+                       (i % 2) ? "odd" : "even", 6, i, 3, "abcdef",
+                       'a' + i % 26);
+
+    /* Positional arguments are formatted when queued */
+    SUNLogger_QueueMsg(logger, SUN_LOGLEVEL_INFO, "test", "positional",
+                       "%2$d %1$d", i, i + 1);
+
+    if (i % 50 == 0)
+    {
+      SUNLogger_QueueMsg(logger, SUN_LOGLEVEL_WARNING, "test", "warning",
+                         "i = %d", i);
+    }
+  }
+}
+
+static int compare_files(const char* fname1, const char* fname2)
+{
+  int c1, c2;
+  long nbytes = 0;
+  FILE* fp1   = fopen(fname1, "r");
+  FILE* fp2   = fopen(fname2, "r");
+
+  if (!fp1 || !fp2)
+  {
+    fprintf(stderr, "Unable to open %s or %s\n", fname1, fname2);
+    return 1;
+  }
+
+  do {
+    c1 = fgetc(fp1);
+    c2 = fgetc(fp2);
+    nbytes++;
+  }
+  while (c1 == c2 && c1 != EOF);
+
+  fclose(fp1);
+  fclose(fp2);
+
+  if (c1 != c2)
+  {
+    fprintf(stderr, "%s and %s differ at byte %li\n", fname1, fname2, nbytes);
+    return 1;
+  }
+
+  printf("%s and %s are identical (%li bytes)\n", fname1, fname2, nbytes - 1);
+
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  int fails        = 0;
+  SUNErrCode err   = SUN_SUCCESS;
+  SUNLogger logger = NULL;
+  FILE* fp         = NULL;
+  char magic[8];
+
+  /* ----------------------------------------------- *
+   * Deferred messages match the immediate messages  *
+   * ----------------------------------------------- */
+
+  err = SUNLogger_Create(SUN_COMM_NULL, 0, &logger);
+  if (err) { return 1; }
+  err = SUNLogger_SetInfoFilename(logger, "logging_immediate.txt");
+  if (err) { return 1; }
+  err = SUNLogger_SetWarningFilename(logger, "logging_immediate.txt");
+  if (err) { return 1; }
+  log_messages(logger);
+  SUNLogger_Destroy(&logger);
+
+  err = SUNLogger_Create(SUN_COMM_NULL, 0, &logger);
+  if (err) { return 1; }
+  err = SUNLogger_SetInfoFilename(logger, "logging_deferred.txt");
+  if (err) { return 1; }
+  err = SUNLogger_SetWarningFilename(logger, "logging_deferred.txt");
+  if (err) { return 1; }
+  err = SUNLogger_EnableDeferred(logger, 4096);
+  if (err)
+  {
+    fprintf(stderr, "SUNLogger_EnableDeferred returned %i\n", err);
+    return 1;
+  }
+  log_messages(logger);
+  SUNLogger_Destroy(&logger);
+
+  fails += compare_files("logging_immediate.txt", "logging_deferred.txt");
+
+  /* ------------------------------ *
+   * Messages written to binary log *
+   * ------------------------------ */
+
+  err = SUNLogger_Create(SUN_COMM_NULL, 0, &logger);
+  if (err) { return 1; }
+  err = SUNLogger_SetBinaryFilename(logger, "logging_deferred.bin");
+  if (err)
+  {
+    fprintf(stderr, "SUNLogger_SetBinaryFilename returned %i\n", err);
+    return 1;
+  }
+  log_messages(logger);
+  SUNLogger_Destroy(&logger);
+
+  fp = fopen("logging_deferred.bin", "rb");
+  if (!fp || fread(magic, 1, 8, fp) != 8 || memcmp(magic, "SUNLOG01", 8))
+  {
+    fprintf(stderr, "logging_deferred.bin is not a binary log\n");
+    fails++;
+  }
+  if (fp) { fclose(fp); }
+
+  if (fails)
+  {
+    printf("FAIL: %d tests failed\n", fails);
+    return 1;
+  }
+
+  printf("SUCCESS\n");
+
+  return 0;
+}
+
+/*---- end of file ----*/
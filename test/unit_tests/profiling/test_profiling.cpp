@@ -19,6 +19,7 @@
 #include <string>
 #include <thread>
 
+#include "sundials/sundials_errors.h"
 #include "sundials/sundials_math.h"
 #include "sundials/sundials_profiler.h"
 #include "sundials/sundials_types.h"
@@ -223,6 +224,235 @@ int main()
 
   std::fclose(fout);
 
+  // ------
+  // Test 4
+  // ------
+
+  std::cout << "\nTest 4: timer handles and names in temporary strings\n";
+
+  flag = SUNProfiler_Reset(prof);
+  if (flag)
+  {
+    std::cerr << ">>> FAILURE: "
+              << "SUNProfiler_Reset returned " << flag << "\n";
+    return 1;
+  }
+
+  int handle = -1;
+  flag       = SUNProfiler_RegisterTimer(prof, "sleep", &handle);
+  if (flag)
+  {
+    std::cerr << ">>> FAILURE: "
+              << "SUNProfiler_RegisterTimer returned " << flag << "\n";
+    return 1;
+  }
+
+  // Registering a name again, from a different string, gives the same handle
+  int handle2 = -1;
+  {
+    std::string name("sleep");
+    flag = SUNProfiler_RegisterTimer(prof, name.c_str(), &handle2);
+  }
+  if (flag || handle2 != handle)
+  {
+    std::cerr << ">>> FAILURE: "
+              << "SUNProfiler_RegisterTimer returned " << flag << " and handle "
+              << handle2 << ", expected handle " << handle << "\n";
+    return 1;
+  }
+
+  flag = SUNProfiler_BeginTimer(prof, -1);
+  if (flag != SUN_ERR_ARG_OUTOFRANGE)
+  {
+    std::cerr << ">>> FAILURE: "
+              << "SUNProfiler_BeginTimer with an invalid handle returned "
+              << flag << "\n";
+    return 1;
+  }
+
+  auto begin = std::chrono::steady_clock::now();
+  SUNProfiler_BeginTimer(prof, handle);
+  std::this_thread::sleep_for(std::chrono::seconds(1));
+  SUNProfiler_EndTimer(prof, handle);
+  auto end = std::chrono::steady_clock::now();
+  chrono   = std::chrono::duration<double>(end - begin).count();
+
+  // Time other regions whose names are stored in the same temporary buffer
+  for (int i = 0; i < 3; i++)
+  {
+    std::string name = "region " + std::to_string(i);
+    SUNProfiler_Begin(prof, name.c_str());
+    SUNProfiler_End(prof, name.c_str());
+  }
+
+  flag = SUNProfiler_GetElapsedTime(prof, "sleep", &time);
+  if (flag)
+  {
+    std::cerr << ">>> FAILURE: "
+              << "SUNProfiler_GetElapsedTime returned " << flag << "\n";
+    return 1;
+  }
+
+  if (SUNRCompareTol(time, chrono, 1e-2))
+  {
+    std::cerr << ">>> FAILURE: "
+              << "time recorded was " << time << "s, but expected " << chrono
+              << "s +/- " << 1e-2 << "\n";
+    return 1;
+  }
+
+  flag = print_timings(prof);
+  if (flag)
+  {
+    std::cerr << ">>> FAILURE: "
+              << "print_timings returned " << flag << "\n";
+    return 1;
+  }
+
+  // ------
+  // Test 5
+  // ------
+
+  std::cout << "\nTest 5: event trace with a small buffer\n";
+
+  flag = SUNProfiler_WriteTrace(prof, stdout);
+  if (flag != SUN_ERR_ARG_INCOMPATIBLE)
+  {
+    std::cerr << ">>> FAILURE: "
+              << "SUNProfiler_WriteTrace without a trace returned " << flag
+              << "\n";
+    return 1;
+  }
+
+  // Keep only the events of the last of 5 outer regions
+  flag = SUNProfiler_EnableTrace(prof, 4);
+  if (flag)
+  {
+    std::cerr << ">>> FAILURE: "
+              << "SUNProfiler_EnableTrace returned " << flag << "\n";
+    return 1;
+  }
+
+  for (int i = 0; i < 5; i++)
+  {
+    SUNProfiler_Begin(prof, "outer");
+    SUNProfiler_Begin(prof, "inner");
+    SUNProfiler_End(prof, "inner");
+    SUNProfiler_End(prof, "outer");
+  }
+
+  std::FILE* ftrace = std::fopen("profiling_test_trace.json", "w+");
+  if (ftrace == nullptr)
+  {
+    std::cerr << ">>> FAILURE: "
+              << "fopen returned a null pointer\n";
+    return 1;
+  }
+
+  flag = SUNProfiler_WriteTrace(prof, ftrace);
+  if (flag)
+  {
+    std::cerr << ">>> FAILURE: "
+              << "SUNProfiler_WriteTrace returned " << flag << "\n";
+    return 1;
+  }
+
+  std::string trace;
+  std::rewind(ftrace);
+  for (int c = std::fgetc(ftrace); c != EOF; c = std::fgetc(ftrace))
+  {
+    trace.push_back(static_cast<char>(c));
+  }
+  std::fclose(ftrace);
+
+  int nbegin = 0;
+  int nend   = 0;
+  for (size_t pos = trace.find("\"ph\": \"B\""); pos != std::string::npos;
+       pos        = trace.find("\"ph\": \"B\"", pos + 1))
+  {
+    nbegin++;
+  }
+  for (size_t pos = trace.find("\"ph\": \"E\""); pos != std::string::npos;
+       pos        = trace.find("\"ph\": \"E\"", pos + 1))
+  {
+    nend++;
+  }
+
+  if (nbegin != 2 || nend != 2)
+  {
+    std::cerr << ">>> FAILURE: "
+              << "trace has " << nbegin << " begin and " << nend
+              << " end events, expected 2 of each\n";
+    return 1;
+  }
+
+  flag = print_timings(prof);
+  if (flag)
+  {
+    std::cerr << ">>> FAILURE: "
+              << "print_timings returned " << flag << "\n";
+    return 1;
+  }
+
+  // ------
+  // Test 6
+  // ------
+
+  std::cout << "\nTest 6: hardware counters\n";
+
+  long long cycles       = 0;
+  long long instructions = 0;
+  flag = SUNProfiler_GetCounters(prof, "outer", &cycles, &instructions,
+                                 nullptr, nullptr);
+  if (flag != SUN_ERR_ARG_INCOMPATIBLE)
+  {
+    std::cerr << ">>> FAILURE: "
+              << "SUNProfiler_GetCounters without counters returned " << flag
+              << "\n";
+    return 1;
+  }
+
+  // Counters may not be available (e.g., in a virtual machine or when the
+  // perf_event_paranoid setting does not allow it), in which case only the
+  // output is checked
+  flag = SUNProfiler_EnableCounters(prof);
+  if (flag != SUN_SUCCESS && flag != SUN_ERR_OP_FAIL &&
+      flag != SUN_ERR_NOT_IMPLEMENTED)
+  {
+    std::cerr << ">>> FAILURE: "
+              << "SUNProfiler_EnableCounters returned " << flag << "\n";
+    return 1;
+  }
+  bool have_counters = (flag == SUN_SUCCESS);
+  if (!have_counters) { std::cout << "Hardware counters are not available\n"; }
+
+  volatile double sum = 0.0;
+  SUNProfiler_Begin(prof, "counted");
+  for (int i = 0; i < 1000000; i++) { sum = sum + 1.0; }
+  SUNProfiler_End(prof, "counted");
+
+  if (have_counters)
+  {
+    flag = SUNProfiler_GetCounters(prof, "counted", &cycles, &instructions,
+                                   nullptr, nullptr);
+    if (flag || (cycles == 0 && instructions == 0))
+    {
+      std::cerr << ">>> FAILURE: "
+                << "SUNProfiler_GetCounters returned " << flag << ", "
+                << cycles << " cycles and " << instructions
+                << " instructions\n";
+      return 1;
+    }
+  }
+
+  flag = print_timings(prof);
+  if (flag)
+  {
+    std::cerr << ">>> FAILURE: "
+              << "print_timings returned " << flag << "\n";
+    return 1;
+  }
+
   // --------
   // Clean up
   // --------
@@ -0,0 +1,220 @@
+/* -----------------------------------------------------------------------------
+ * Programmer(s): Cody J. Balos @ LLNL
+ * -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test sharing a thread-safe SUNContext, SUNLogger, and SUNProfiler
+ * between threads.
+ * ---------------------------------------------------------------------------*/
+
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "sundials/priv/sundials_errors_impl.h"
+#include "sundials/sundials_context.h"
+#include "sundials/sundials_errors.h"
+#include "sundials/sundials_logger.h"
+#include "sundials/sundials_profiler.h"
+#include "sundials/sundials_types.h"
+
+static const int num_threads = 8;
+static const int num_iters   = 2000;
+
+static std::atomic<long> num_handled{0};
+
+static void count_errors(int line, const char* func, const char* file,
+                         const char* msg, SUNErrCode err_code,
+                         void* err_user_data, SUNContext sunctx)
+{
+  num_handled++;
+}
+
+/* Each thread raises its own error and must see it as its last error while
+   another thread pushes and pops error handlers */
+static int test_errors(SUNContext sunctx)
+{
+  std::atomic<int> failures{0};
+  std::atomic<bool> done{false};
+  std::vector<std::thread> threads;
+
+  SUNContext_ClearErrHandlers(sunctx);
+  SUNContext_PushErrHandler(sunctx, count_errors, nullptr);
+
+  std::thread pusher(
+    [&]()
+    {
+      while (!done)
+      {
+        SUNContext_PushErrHandler(sunctx, count_errors, nullptr);
+        SUNContext_PopErrHandler(sunctx);
+      }
+    });
+
+  for (int t = 0; t < num_threads; t++)
+  {
+    threads.emplace_back(
+      [&, t]()
+      {
+        /* Use codes that are not SUN_SUCCESS and differ between threads */
+        SUNErrCode code = SUN_ERR_MINIMUM + 1 + t;
+        for (int i = 0; i < num_iters; i++)
+        {
+          SUNHandleErrWithMsg(__LINE__, __func__, __FILE__, "test error", code,
+                              sunctx);
+          if (SUNContext_PeekLastError(sunctx) != code) { failures++; }
+          if (SUNContext_GetLastError(sunctx) != code) { failures++; }
+          if (SUNContext_PeekLastError(sunctx) != SUN_SUCCESS) { failures++; }
+        }
+      });
+  }
+
+  for (auto& thread : threads) { thread.join(); }
+  done = true;
+  pusher.join();
+
+  if (failures)
+  {
+    std::cerr << ">>> FAILURE: " << failures
+              << " threads did not see their last error\n";
+    return 1;
+  }
+
+  if (num_handled < num_threads * num_iters)
+  {
+    std::cerr << ">>> FAILURE: the error handler was called " << num_handled
+              << " times, expected at least " << num_threads * num_iters
+              << "\n";
+    return 1;
+  }
+
+  std::cout << "Error handling test passed\n";
+  return 0;
+}
+
+/* Messages written by several threads must not be interleaved */
+static int test_logger(SUNContext sunctx)
+{
+#if SUNDIALS_LOGGING_LEVEL >= SUNDIALS_LOGGING_WARNING
+  const char* filename = "test_sundials_threads.log";
+  SUNLogger logger     = nullptr;
+  std::vector<std::thread> threads;
+
+  SUNContext_GetLogger(sunctx, &logger);
+  if (SUNLogger_SetWarningFilename(logger, filename)) { return 1; }
+
+  for (int t = 0; t < num_threads; t++)
+  {
+    threads.emplace_back(
+      [&, t]()
+      {
+        for (int i = 0; i < num_iters; i++)
+        {
+          SUNLogger_QueueMsg(logger, SUN_LOGLEVEL_WARNING, "test_logger",
+                             "thread", "thread = %d, message = %d", t, i);
+        }
+      });
+  }
+
+  for (auto& thread : threads) { thread.join(); }
+  SUNLogger_Flush(logger, SUN_LOGLEVEL_WARNING);
+
+  std::ifstream log(filename);
+  std::string line;
+  long num_lines = 0;
+  while (std::getline(log, line))
+  {
+    if (line.find("[WARNING]") != 0 || line.find("message = ") == line.npos)
+    {
+      std::cerr << ">>> FAILURE: corrupt log line: " << line << "\n";
+      return 1;
+    }
+    num_lines++;
+  }
+
+  if (num_lines != num_threads * num_iters)
+  {
+    std::cerr << ">>> FAILURE: found " << num_lines << " log lines, expected "
+              << num_threads * num_iters << "\n";
+    return 1;
+  }
+
+  std::cout << "Logger test passed\n";
+#endif
+  return 0;
+}
+
+/* Regions timed by other threads are merged when the profiler is printed */
+static int test_profiler()
+{
+  SUNProfiler prof = nullptr;
+  double elapsed   = 0.0;
+  std::vector<std::thread> threads;
+
+  if (SUNProfiler_Create(SUN_COMM_NULL, "Threads Test", &prof)) { return 1; }
+
+  for (int t = 0; t < num_threads; t++)
+  {
+    threads.emplace_back(
+      [&]()
+      {
+        for (int i = 0; i < num_iters; i++)
+        {
+          SUNProfiler_Begin(prof, "thread region");
+          SUNProfiler_End(prof, "thread region");
+        }
+      });
+  }
+
+  for (auto& thread : threads) { thread.join(); }
+
+  if (SUNProfiler_Print(prof, stdout)) { return 1; }
+
+  if (SUNProfiler_GetElapsedTime(prof, "thread region", &elapsed) ||
+      elapsed <= 0.0)
+  {
+    std::cerr << ">>> FAILURE: the thread regions were not merged\n";
+    return 1;
+  }
+
+  SUNProfiler_Free(&prof);
+
+  std::cout << "Profiler test passed\n";
+  return 0;
+}
+
+int main()
+{
+  int fails         = 0;
+  SUNContext sunctx = nullptr;
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx))
+  {
+    std::cerr << ">>> FAILURE: SUNContext_Create failed\n";
+    return 1;
+  }
+
+  fails += test_errors(sunctx);
+  fails += test_logger(sunctx);
+  fails += test_profiler();
+
+  SUNContext_Free(&sunctx);
+
+  if (fails) { std::cout << "FAIL: " << fails << " tests failed\n"; }
+  else { std::cout << "SUCCESS\n"; }
+
+  return fails ? 1 : 0;
+}
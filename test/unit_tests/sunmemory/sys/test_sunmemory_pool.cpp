@@ -0,0 +1,161 @@
+/*------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ *-----------------------------------------------------------------*/
+
+#include <cstdint>
+#include <iostream>
+#include <sundials/sundials_core.hpp>
+#include <sunmemory/sunmemory_pool.h>
+
+// Sizes covering the arena blocks, the larger pooled blocks, and a
+// request that is not pooled
+static const size_t sizes[] = {0, 8, 65, 1000, 100000, (size_t{1} << 30) + 1};
+static const int num_sizes  = sizeof(sizes) / sizeof(sizes[0]);
+
+static int fail(const char* msg)
+{
+  std::cout << "    " << msg << "\n";
+  return -1;
+}
+
+// Allocate a set of blocks, check the alignment and that the blocks can be
+// written, then release them
+static int alloc_cycle(SUNMemoryHelper helper, size_t alignment, void** ptrs)
+{
+  SUNMemory mem[num_sizes];
+
+  for (int i = 0; i < num_sizes; i++)
+  {
+    // Skip the large request except in the first cycle
+    size_t bytes = (ptrs == nullptr && i == num_sizes - 1) ? 16 : sizes[i];
+    if (SUNMemoryHelper_Alloc(helper, &mem[i], bytes, SUNMEMTYPE_HOST, nullptr))
+    {
+      return fail("SUNMemoryHelper_Alloc failed");
+    }
+    if (reinterpret_cast<std::uintptr_t>(mem[i]->ptr) % alignment)
+    {
+      return fail("block is not aligned");
+    }
+    if (bytes > 0) { static_cast<char*>(mem[i]->ptr)[bytes - 1] = 1; }
+    if (ptrs && i < num_sizes - 1) { ptrs[i] = mem[i]->ptr; }
+  }
+
+  for (int i = 0; i < num_sizes; i++)
+  {
+    if (SUNMemoryHelper_Dealloc(helper, mem[i], nullptr))
+    {
+      return fail("SUNMemoryHelper_Dealloc failed");
+    }
+  }
+
+  return 0;
+}
+
+static int test_instance(SUNMemoryHelper helper, size_t alignment)
+{
+  void* ptrs[num_sizes];
+  unsigned long num_reused, num_reused_before;
+  unsigned long num_sys_allocations, num_sys_before;
+  unsigned long num_allocations, num_deallocations;
+  size_t bytes_reserved, bytes_allocated, bytes_high_watermark;
+
+  if (alloc_cycle(helper, alignment, ptrs)) { return -1; }
+
+  SUNMemoryHelper_GetPoolStats_Pool(helper, &num_reused, &num_sys_before,
+                                    &bytes_reserved);
+  if (num_reused != 0) { return fail("blocks reused in the first cycle"); }
+
+  // The later cycles replace the large request with a small one
+  if (alloc_cycle(helper, alignment, nullptr)) { return -1; }
+
+  SUNMemoryHelper_GetPoolStats_Pool(helper, &num_reused_before,
+                                    &num_sys_before, &bytes_reserved);
+
+  // Repeated cycles reuse the released blocks
+  for (int cycle = 0; cycle < 100; cycle++)
+  {
+    if (alloc_cycle(helper, alignment, nullptr)) { return -1; }
+  }
+
+  SUNMemoryHelper_GetPoolStats_Pool(helper, &num_reused, &num_sys_allocations,
+                                    &bytes_reserved);
+  if (num_sys_allocations != num_sys_before)
+  {
+    return fail("repeated cycles allocated system memory");
+  }
+  if (num_reused - num_reused_before != 100 * num_sizes)
+  {
+    return fail("repeated cycles did not reuse all blocks");
+  }
+
+  // A released block of the same size class is returned again
+  SUNMemory mem = nullptr;
+  SUNMemoryHelper_Alloc(helper, &mem, 99000, SUNMEMTYPE_HOST, nullptr);
+  if (mem->ptr != ptrs[4]) { return fail("block was not reused"); }
+  SUNMemoryHelper_Dealloc(helper, mem, nullptr);
+
+  SUNMemoryHelper_GetAllocStats(helper, SUNMEMTYPE_HOST, &num_allocations,
+                                &num_deallocations, &bytes_allocated,
+                                &bytes_high_watermark);
+  if (num_allocations != num_deallocations || bytes_allocated != 0)
+  {
+    return fail("allocation statistics do not balance");
+  }
+  if (bytes_high_watermark < sizes[num_sizes - 1])
+  {
+    return fail("bytes_high_watermark is too small");
+  }
+
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  sundials::Context sunctx;
+
+  std::cout << "Testing the SUNMemoryHelper_Pool module... \n";
+
+  SUNMemoryHelper helper = SUNMemoryHelper_Pool(sunctx);
+  if (!helper)
+  {
+    std::cout << "  SUNMemoryHelper_Pool... FAILED\n";
+    return -1;
+  }
+
+  std::cout << "  Default alignment...\n";
+  if (test_instance(helper, 64)) { return -1; }
+  SUNMemoryHelper_PrintStats_Pool(helper, stdout);
+
+  std::cout << "  Page alignment and huge pages...\n";
+  SUNMemoryHelper helper2 = SUNMemoryHelper_Pool(sunctx);
+  if (SUNMemoryHelper_SetAlignment_Pool(helper2, 4096) ||
+      SUNMemoryHelper_SetUseHugePages_Pool(helper2, SUNTRUE))
+  {
+    std::cout << "  SUNMemoryHelper_Set... FAILED\n";
+    return -1;
+  }
+  if (test_instance(helper2, 4096)) { return -1; }
+
+  std::cout << "  SUNMemoryHelper_Clone...\n";
+  SUNMemoryHelper helper3 = SUNMemoryHelper_Clone(helper2);
+  if (!helper3 || test_instance(helper3, 4096)) { return -1; }
+
+  if (SUNMemoryHelper_Destroy(helper) || SUNMemoryHelper_Destroy(helper2) ||
+      SUNMemoryHelper_Destroy(helper3))
+  {
+    std::cout << "  SUNMemoryHelper_Destroy... FAILED\n";
+    return -1;
+  }
+
+  std::cout << "SUCCESS\n";
+
+  return 0;
+}
@@ -0,0 +1,169 @@
+/* -----------------------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for SUNTelemetry. Records are added to a small ring buffer and
+ * drained to check the order and the dropped count. Then the records are
+ * written to a binary file (the buffer is written many times) and read back.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "sundials/sundials_errors.h"
+#include "sundials/sundials_telemetry.h"
+
+#define CAPACITY 8
+#define NREC     100
+
+static void fill_record(SUNTelemetryRecord* rec, int i)
+{
+  memset(rec, 0, sizeof(*rec));
+  rec->t     = 0.5 * i;
+  rec->h     = 0.5;
+  rec->step  = i;
+  rec->order = i % 5 + 1;
+  rec->nni   = i % 3;
+}
+
+/* Check that records were stored in order starting from the given step */
+static int check_records(const SUNTelemetryRecord* records, long n, int first)
+{
+  long i;
+
+  for (i = 0; i < n; i++)
+  {
+    SUNTelemetryRecord expected;
+    fill_record(&expected, first + (int)i);
+    if (memcmp(records + i, &expected, sizeof(expected)))
+    {
+      fprintf(stderr, "Record %li does not match step %li\n", i, first + i);
+      return 1;
+    }
+  }
+
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  int i, fails     = 0;
+  long n           = 0;
+  SUNErrCode err   = SUN_SUCCESS;
+  SUNTelemetry tel = NULL;
+  SUNTelemetryRecord rec;
+  SUNTelemetryRecord records[NREC];
+  FILE* fp = NULL;
+  char magic[8];
+  uint32_t header[2];
+
+  /* The record layout has no padding */
+  if (sizeof(SUNTelemetryRecord) != 88)
+  {
+    fprintf(stderr, "sizeof(SUNTelemetryRecord) = %zu\n",
+            sizeof(SUNTelemetryRecord));
+    fails++;
+  }
+
+  /* ------------------------------------------ *
+   * Ring buffer keeps the most recent records  *
+   * ------------------------------------------ */
+
+  err = SUNTelemetry_Create(CAPACITY, &tel);
+  if (err) { return 1; }
+
+  for (i = 0; i < NREC; i++)
+  {
+    fill_record(&rec, i);
+    err = SUNTelemetry_Record(tel, &rec);
+    if (err) { return 1; }
+
+    /* Drain part of the buffer partway through */
+    if (i == 4)
+    {
+      SUNTelemetry_Drain(tel, records, 3, &n);
+      if (n != 3 || check_records(records, n, 0)) { fails++; }
+    }
+  }
+
+  SUNTelemetry_GetNumDropped(tel, &n);
+  if (n != NREC - 3 - CAPACITY)
+  {
+    fprintf(stderr, "Dropped %li records, expected %d\n", n,
+            NREC - 3 - CAPACITY);
+    fails++;
+  }
+
+  SUNTelemetry_Drain(tel, records, NREC, &n);
+  if (n != CAPACITY || check_records(records, n, NREC - CAPACITY)) { fails++; }
+
+  SUNTelemetry_GetNumRecords(tel, &n);
+  if (n != 0) { fails++; }
+
+  SUNTelemetry_Destroy(&tel);
+
+  /* ------------------------------- *
+   * Records written to binary file  *
+   * ------------------------------- */
+
+  err = SUNTelemetry_Create(CAPACITY, &tel);
+  if (err) { return 1; }
+  err = SUNTelemetry_SetBinaryFilename(tel, "telemetry.bin");
+  if (err)
+  {
+    fprintf(stderr, "SUNTelemetry_SetBinaryFilename returned %i\n", err);
+    return 1;
+  }
+
+  for (i = 0; i < NREC; i++)
+  {
+    fill_record(&rec, i);
+    err = SUNTelemetry_Record(tel, &rec);
+    if (err) { return 1; }
+  }
+
+  SUNTelemetry_GetNumDropped(tel, &n);
+  if (n != 0) { fails++; }
+
+  SUNTelemetry_Print(tel, stdout);
+  SUNTelemetry_Destroy(&tel);
+
+  fp = fopen("telemetry.bin", "rb");
+  if (!fp || fread(magic, 1, 8, fp) != 8 || memcmp(magic, "SUNTEL01", 8) ||
+      fread(header, sizeof(uint32_t), 2, fp) != 2 || header[0] != 0x01020304 ||
+      header[1] != sizeof(SUNTelemetryRecord))
+  {
+    fprintf(stderr, "telemetry.bin does not have a valid header\n");
+    fails++;
+  }
+  else if (fread(records, sizeof(SUNTelemetryRecord), NREC, fp) != NREC ||
+           check_records(records, NREC, 0))
+  {
+    fprintf(stderr, "telemetry.bin does not contain the records\n");
+    fails++;
+  }
+  if (fp) { fclose(fp); }
+
+  if (fails)
+  {
+    printf("FAIL: %d tests failed\n", fails);
+    return 1;
+  }
+
+  printf("SUCCESS\n");
+
+  return 0;
+}
+
+/*---- end of file ----*/
@@ -0,0 +1,254 @@
+/* -----------------------------------------------------------------------------
+ * Programmer(s): David J. Gardner @ LLNL
+ * -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2024, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for binary N_Vector I/O and SUNTimeSeries. Serial vectors (written
+ * from the data array) and ManyVectors (written through a packed buffer) are
+ * written with N_VWriteBinary and read back. Then snapshots are appended to a
+ * time series, with a flush partway through, and read back. The time series
+ * test is repeated with the asynchronous writer when it is enabled. The vector
+ * is overwritten right after each append to check that snapshots are copied.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "nvector/nvector_manyvector.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_core.h"
+
+#define NLOCAL 1001
+#define NSNAP  7
+#define NASYNC 50
+
+/* Fill the vector with values depending on the snapshot k */
+static void fill_vector(N_Vector y, int k)
+{
+  sunindextype i, j;
+  N_Vector v;
+
+  for (j = 0; j < N_VGetNumSubvectors_ManyVector(y); j++)
+  {
+    v = N_VGetSubvector_ManyVector(y, j);
+    for (i = 0; i < N_VGetLength(v); i++)
+    {
+      N_VGetArrayPointer(v)[i] = (sunrealtype)(k * 10000 + j * NLOCAL + i);
+    }
+  }
+}
+
+/* Check that the vectors are equal */
+static int check_vector(N_Vector x, N_Vector y, const char* msg)
+{
+  N_VLinearSum(SUN_RCONST(1.0), x, -SUN_RCONST(1.0), y, y);
+  if (N_VMaxNorm(y) != SUN_RCONST(0.0))
+  {
+    fprintf(stderr, "%s: vectors differ\n", msg);
+    return 1;
+  }
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  int k, fails      = 0;
+  long n            = 0;
+  sunrealtype t     = SUN_RCONST(0.0);
+  SUNErrCode err    = SUN_SUCCESS;
+  SUNContext sunctx = NULL;
+  SUNTimeSeries ts  = NULL;
+  N_Vector vecs[2]  = {NULL, NULL};
+  N_Vector x        = NULL;
+  N_Vector y        = NULL;
+  N_Vector small    = NULL;
+  FILE* fp          = NULL;
+
+  err = SUNContext_Create(SUN_COMM_NULL, &sunctx);
+  if (err) { return 1; }
+
+  vecs[0] = N_VNew_Serial(NLOCAL, sunctx);
+  vecs[1] = N_VNew_Serial(2 * NLOCAL, sunctx);
+  x       = N_VNew_ManyVector(2, vecs, sunctx);
+  y       = N_VClone(x);
+  small   = N_VNew_Serial(NLOCAL, sunctx);
+  if (!vecs[0] || !vecs[1] || !x || !y || !small) { return 1; }
+
+  /* ----------------------------- *
+   * Binary N_Vector write / read  *
+   * ----------------------------- */
+
+  fill_vector(x, 1);
+
+  fp = fopen("nvector.bin", "wb");
+  if (!fp) { return 1; }
+  err = N_VWriteBinary(x, fp, SUNTRUE);
+  if (!err) { err = N_VWriteBinary(vecs[0], fp, SUNTRUE); }
+  if (!err) { err = N_VWriteBinary(vecs[0], fp, SUNFALSE); }
+  fclose(fp);
+  if (err)
+  {
+    fprintf(stderr, "N_VWriteBinary returned %i\n", err);
+    return 1;
+  }
+
+  fp = fopen("nvector.bin", "rb");
+  if (!fp) { return 1; }
+
+  N_VConst(SUN_RCONST(0.0), y);
+  err = N_VReadBinary(y, fp, SUNTRUE);
+  if (err || check_vector(x, y, "ManyVector with header")) { fails++; }
+
+  /* The size in the header must match the vector */
+  err = N_VReadBinary(y, fp, SUNTRUE);
+  if (err != SUN_ERR_ARG_DIMSMISMATCH)
+  {
+    fprintf(stderr, "Reading into the wrong size vector returned %i\n", err);
+    fails++;
+  }
+
+  N_VConst(SUN_RCONST(0.0), small);
+  err = N_VReadBinary(small, fp, SUNFALSE);
+  if (err || check_vector(vecs[0], small, "Serial without header")) { fails++; }
+
+  fclose(fp);
+
+  /* ------------------------- *
+   * Time series write / read  *
+   * ------------------------- */
+
+  err = SUNTimeSeries_Create("timeseries.bin", &ts);
+  if (err) { return 1; }
+
+  for (k = 0; k < NSNAP; k++)
+  {
+    fill_vector(x, k);
+    err = SUNTimeSeries_Append(ts, SUN_RCONST(0.5) * k, x);
+    if (err)
+    {
+      fprintf(stderr, "SUNTimeSeries_Append returned %i\n", err);
+      return 1;
+    }
+
+    /* Snapshots appended after a flush overwrite the index */
+    if (k == 3)
+    {
+      err = SUNTimeSeries_Flush(ts);
+      if (err) { return 1; }
+
+      err = SUNTimeSeries_ReadSnapshot("timeseries.bin", 3, &t, y);
+      if (err || t != SUN_RCONST(1.5) || check_vector(x, y, "Flushed"))
+      {
+        fails++;
+      }
+    }
+  }
+
+  /* All snapshots must have the same size */
+  err = SUNTimeSeries_Append(ts, SUN_RCONST(0.0), small);
+  if (err != SUN_ERR_ARG_DIMSMISMATCH)
+  {
+    fprintf(stderr, "Appending the wrong size vector returned %i\n", err);
+    fails++;
+  }
+
+  SUNTimeSeries_GetNumSnapshots(ts, &n);
+  if (n != NSNAP) { fails++; }
+
+  err = SUNTimeSeries_Destroy(&ts);
+  if (err) { return 1; }
+
+  for (k = 0; k < NSNAP; k++)
+  {
+    fill_vector(x, k);
+    err = SUNTimeSeries_ReadSnapshot("timeseries.bin", k, &t, y);
+    if (err || t != SUN_RCONST(0.5) * k || check_vector(x, y, "Snapshot"))
+    {
+      fprintf(stderr, "Snapshot %d was not read back\n", k);
+      fails++;
+    }
+  }
+
+  err = SUNTimeSeries_ReadSnapshot("timeseries.bin", NSNAP, &t, y);
+  if (err != SUN_ERR_ARG_OUTOFRANGE) { fails++; }
+
+  /* ------------------------------- *
+   * Asynchronous time series output *
+   * ------------------------------- */
+
+  err = SUNTimeSeries_Create("timeseries_async.bin", &ts);
+  if (err) { return 1; }
+
+  err = SUNTimeSeries_SetAsync(ts, 2);
+#if defined(SUNDIALS_ENABLE_ASYNC_OUTPUT)
+  if (err)
+  {
+    fprintf(stderr, "SUNTimeSeries_SetAsync returned %i\n", err);
+    fails++;
+  }
+#else
+  if (err != SUN_ERR_NOT_IMPLEMENTED) { fails++; }
+#endif
+
+  for (k = 0; k < NASYNC; k++)
+  {
+    fill_vector(x, k);
+    err = SUNTimeSeries_Append(ts, SUN_RCONST(0.5) * k, x);
+    if (err)
+    {
+      fprintf(stderr, "SUNTimeSeries_Append returned %i\n", err);
+      return 1;
+    }
+    N_VConst(SUN_RCONST(-1.0), x);
+
+    if (k == NASYNC / 2)
+    {
+      err = SUNTimeSeries_Flush(ts);
+      if (err) { return 1; }
+    }
+  }
+
+  SUNTimeSeries_GetNumStalls(ts, &n);
+  printf("Asynchronous appends that waited for a buffer: %li\n", n);
+
+  err = SUNTimeSeries_Destroy(&ts);
+  if (err) { return 1; }
+
+  for (k = 0; k < NASYNC; k++)
+  {
+    fill_vector(x, k);
+    err = SUNTimeSeries_ReadSnapshot("timeseries_async.bin", k, &t, y);
+    if (err || t != SUN_RCONST(0.5) * k || check_vector(x, y, "Async"))
+    {
+      fprintf(stderr, "Asynchronous snapshot %d was not read back\n", k);
+      fails++;
+    }
+  }
+
+  N_VDestroy(x);
+  N_VDestroy(y);
+  N_VDestroy(small);
+  N_VDestroy(vecs[0]);
+  N_VDestroy(vecs[1]);
+  SUNContext_Free(&sunctx);
+
+  if (fails)
+  {
+    printf("FAIL: %d tests failed\n", fails);
+    return 1;
+  }
+
+  printf("SUCCESS\n");
+
+  return 0;
+}
+
+/*---- end of file ----*/